@@ -482,6 +482,9 @@ static BOOL extractConfigFile(CHARPTR fileName)
         return FAIL;
     }
 
+    // config journal of previous config must not be applied on restored config
+    unlink(CONFIG_JOURNAL_FILE);
+
     // give a sync to system
     sync();
     return SUCCESS;
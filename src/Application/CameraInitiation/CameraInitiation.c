@@ -174,6 +174,8 @@ static const CHARPTR camHeaderReq[MAX_CI_HEADER_REQ] = {
     "ACK_DID",   // index 5
 };
 
+static STR_INDEX_TABLE_t camHeaderReqIndexTbl = STR_INDEX_TABLE_INIT(camHeaderReq, MAX_CI_HEADER_REQ);
+
 // #################################################################################################
 //  @PROTOTYPES
 // #################################################################################################
@@ -217,6 +219,7 @@ void InitCameraInitiationTcpNw(void)
     UINT8            cmdIndex;
 
     terminateFlag = FALSE;
+    InitStrIndexTable(&camHeaderReqIndexTbl);
     ReadGeneralConfig(&generalConfig);
     DPRINT(CAMERA_INITIATION, "camera initiation: [pollDuration=%d], [pollInterval=%d]", generalConfig.pollDuration, generalConfig.pollInterval);
 
@@ -767,7 +770,7 @@ static NET_CMD_STATUS_e findHeaderIndexCI(CHARPTR *pStrBufPtr, UINT8PTR pMsgId)
         return CMD_INVALID_SYNTAX;
     }
 
-    *pMsgId = ConvertStringToIndex(buf, camHeaderReq, MAX_CI_HEADER_REQ);
+    *pMsgId = FindStrIndex(&camHeaderReqIndexTbl, buf);
     if (*pMsgId >= MAX_CI_HEADER_REQ)
     {
         return CMD_INVALID_MESSAGE;
@@ -28,7 +28,7 @@
 #define CAM_PRODUCT_TYPE                    (3)
 
 #define MAX_CI_RESOLUTION                   (95)
-#define MAX_TIMEOUT_STREAM                  (200000)
+#define MAX_TIMEOUT_STREAM_MS               (200000)
 #define DEFAULT_REF_NUM                     (2)
 
 #define MAX_IMG_LEN                         (10)
@@ -52,6 +52,16 @@
 #define TCP_LIVESTREAM_THREAD_STACK_SZ      (4 * MEGA_BYTE)
 #define TCP_LIVE_STREAM_CMD_THREAD_STACK_SZ (4 * MEGA_BYTE)
 
+/* Live streams of cameras are shared among threads, each thread serves fixed range of cameras */
+#define TCP_LIVE_STREAM_CAMERA_PER_THREAD   (16)
+#define MAX_TCP_LIVE_STREAM_THREAD          ((MAX_CAMERA + TCP_LIVE_STREAM_CAMERA_PER_THREAD - 1) / TCP_LIVE_STREAM_CAMERA_PER_THREAD)
+#define MAX_TCP_LIVE_STREAM_POLL_FD         (MAX_STREAM * TCP_LIVE_STREAM_CAMERA_PER_THREAD)
+#define TCP_LIVE_STREAM_POLL_TIMEOUT_MS     (20)
+
+/* Frame buffers of live streams are taken from shared pool of size classes. Free buffers kept in pool are limited */
+#define CI_FRAME_BUF_CLASS_MAX              (4)
+#define CI_FRAME_BUF_POOL_CACHE_MAX         (8 * MEGA_BYTE)
+
 #define CI_RESET_LIVE_STREAM_STS(strm, camIdx, video)   \
     MUTEX_LOCK(liveStreamInfo[strm].mutex);             \
     liveStreamInfo[strm].status[video][camIdx] = FALSE; \
@@ -168,15 +178,23 @@ typedef struct
 typedef struct
 {
     BOOL               frameRecvF;
-    UINT32             timeoutCnt;
+    UINT64             lastRecvTimeMs;
     FRAME_RECV_STATE_e frameState;
     UINT8              headerData[CI_FRAME_HEADER_LEN];
     UINT8PTR           headerRef;
     UINT8PTR           payloadData;
     UINT8PTR           payloadRef;
     UINT32             payloadLen;
+    UINT8              payloadBufClass;
 } FRAME_DATA_INFO_t;
 
+typedef struct
+{
+    pthread_mutex_t poolLock;
+    UINT32          cacheSize;
+    UINT8PTR        pFreeBuf[CI_FRAME_BUF_CLASS_MAX];
+} CI_FRAME_BUF_POOL_t;
+
 // #################################################################################################
 //  @GLOBAL VARIABLES
 // #################################################################################################
@@ -304,6 +322,8 @@ static const UINT16 frameResolution[MAX_CI_RESOLUTION][MAX_FRAME_DIMENSION] = {
     {3840, 2160}, // resolution 94
 };
 
+static const UINT32 ciFrameBufSize[CI_FRAME_BUF_CLASS_MAX] = {64 * KILO_BYTE, 256 * KILO_BYTE, MEGA_BYTE, CI_MAX_FRAME_LEN};
+
 // #################################################################################################
 //  @STATIC VARIABLES
 // #################################################################################################
@@ -314,6 +334,9 @@ static pthread_mutex_t   tcpReqListMutex;
 static TCP_CLIENT_INFO_t tcpClientInfo[MAX_TCP_REQUEST];
 static TCP_DATA_INFO_t   tcpRespData[MAX_TCP_REQUEST];
 static LIVE_STREAM_t     liveStreamInfo[MAX_LIVE_STREAM_TID];
+static UINT8             liveStreamThreadIdx[MAX_TCP_LIVE_STREAM_THREAD];
+static CI_FRAME_BUF_POOL_t ciFrameBufPool;
+static STR_INDEX_TABLE_t ciReqHeaderIndexTbl = STR_INDEX_TABLE_INIT(CIReqHeader, MAX_TCP_REQUEST_TYPE);
 
 // #################################################################################################
 //  @PROTOTYPES
@@ -325,10 +348,16 @@ static VOIDPTR tcpTransferImage(VOIDPTR tcpSessionPtr);
 //-------------------------------------------------------------------------------------------------
 static VOIDPTR tcpLiveStreamCmd(VOIDPTR tcpSessionPtr);
 //-------------------------------------------------------------------------------------------------
-static VOIDPTR tcpLiveStream(VOIDPTR tcpSessionPtr);
+static VOIDPTR tcpLiveStream(VOIDPTR threadArg);
+//-------------------------------------------------------------------------------------------------
+static void recvTcpLiveStreamFrame(UINT8 camIndex, UINT8 streamType, INT32 streamFd, FRAME_DATA_INFO_t *pFrameInfo);
 //-------------------------------------------------------------------------------------------------
 static void resetTcpLiveStreamFrameInfo(FRAME_DATA_INFO_t *pFrameInfo);
 //-------------------------------------------------------------------------------------------------
+static BOOL reserveTcpLiveStreamFrameBuf(FRAME_DATA_INFO_t *pFrameInfo, UINT32 frameLen);
+//-------------------------------------------------------------------------------------------------
+static void releaseTcpLiveStreamFrameBuf(FRAME_DATA_INFO_t *pFrameInfo);
+//-------------------------------------------------------------------------------------------------
 static CI_CNFG_PARSER_e getCnfgParserIndex(UINT64 tableId);
 //-------------------------------------------------------------------------------------------------
 static BOOL streamProfileCnfgParser(CHARPTR *respStrPtr, TCP_HANDLE tcpHandle);
@@ -355,7 +384,7 @@ static void sendStopToCameraInterface(UINT8 camIndex, UINT8 streamType);
 //-------------------------------------------------------------------------------------------------
 static void StopCameraStream(UINT8 camIndex, UINT8 streamType, BOOL force);
 //-------------------------------------------------------------------------------------------------
-static BOOL isAnyCameraAddedForLiveStream(BOOL liveStreamStatusF[MAX_STREAM][MAX_CAMERA]);
+static BOOL isAnyCameraAddedForLiveStream(BOOL liveStreamStatusF[MAX_STREAM][MAX_CAMERA], UINT8 startCamIdx, UINT8 endCamIdx);
 //-------------------------------------------------------------------------------------------------
 static BOOL (*ciCnfgRespParserFuncPtr[MAX_CI_CFG_TABLE_PARSER])(CHARPTR *respStrPtr, TCP_HANDLE tcpHandle) = {
     streamProfileCnfgParser,      // stream config parser
@@ -382,8 +411,11 @@ void InitTcpClient(void)
     TYPE_REQ_e reqType;
     TCP_HANDLE handle;
     UINT8      camIndex, streamType;
+    UINT8      threadIdx, threadCnt;
+    UINT8      bufClass;
 
     MUTEX_INIT(tcpReqListMutex, NULL);
+    InitStrIndexTable(&ciReqHeaderIndexTbl);
 
     for (handle = 0; handle < MAX_TCP_REQUEST; handle++)
     {
@@ -404,6 +436,13 @@ void InitTcpClient(void)
         }
     }
 
+    MUTEX_INIT(ciFrameBufPool.poolLock, NULL);
+    ciFrameBufPool.cacheSize = 0;
+    for (bufClass = 0; bufClass < CI_FRAME_BUF_CLASS_MAX; bufClass++)
+    {
+        ciFrameBufPool.pFreeBuf[bufClass] = NULL;
+    }
+
     for (reqType = 0; reqType < MAX_LIVE_STREAM_TID; reqType++)
     {
         MUTEX_INIT(liveStreamInfo[reqType].mutex, NULL);
@@ -424,11 +463,16 @@ void InitTcpClient(void)
         return;
     }
 
-    /* Create TCP live stream thread */
-    if (FALSE == Utils_CreateThread(NULL, tcpLiveStream, NULL, DETACHED_THREAD, TCP_LIVESTREAM_THREAD_STACK_SZ))
+    /* Create TCP live stream threads as per cameras supported in variant */
+    threadCnt = (getMaxCameraForCurrentVariant() + TCP_LIVE_STREAM_CAMERA_PER_THREAD - 1) / TCP_LIVE_STREAM_CAMERA_PER_THREAD;
+    for (threadIdx = 0; threadIdx < threadCnt; threadIdx++)
     {
-        EPRINT(CAMERA_INITIATION, "Failed to create tcp live stream thread");
-        return;
+        liveStreamThreadIdx[threadIdx] = threadIdx;
+        if (FALSE == Utils_CreateThread(NULL, tcpLiveStream, &liveStreamThreadIdx[threadIdx], DETACHED_THREAD, TCP_LIVESTREAM_THREAD_STACK_SZ))
+        {
+            EPRINT(CAMERA_INITIATION, "Failed to create tcp live stream thread: [thread=%d]", threadIdx);
+            return;
+        }
     }
 #endif
 }
@@ -457,7 +501,7 @@ static void StopCameraStream(UINT8 camIndex, UINT8 streamType, BOOL force)
     if (TRUE == liveStreamInfo[LIVE_STREAM].status[streamType][camIndex])
     {
         liveStreamInfo[LIVE_STREAM].status[streamType][camIndex] = FALSE;
-        pthread_cond_signal(&liveStreamInfo[LIVE_STREAM].signal);
+        pthread_cond_broadcast(&liveStreamInfo[LIVE_STREAM].signal);
     }
     MUTEX_UNLOCK(liveStreamInfo[LIVE_STREAM].mutex);
 
@@ -636,7 +680,7 @@ static NET_CMD_STATUS_e findHeaderIndexTcpClient(CHARPTR *tmpBufPtr, UINT8PTR te
         return CMD_INVALID_SYNTAX;
     }
 
-    *tempMsgId = ConvertStringToIndex(buf, CIReqHeader, MAX_TCP_REQUEST_TYPE);
+    *tempMsgId = FindStrIndex(&ciReqHeaderIndexTbl, buf);
     if (*tempMsgId >= MAX_TCP_REQUEST_TYPE)
     {
         EPRINT(CAMERA_INITIATION, "invld tcp client request type");
@@ -739,18 +783,20 @@ static void sendStopToCameraInterface(UINT8 camIndex, UINT8 streamType)
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   It provides status of camera added for live stream. It checks status of all camera and
- *          its main and sub stream status.
+ * @brief   It provides status of camera added for live stream. It checks status of cameras in given
+ *          range and its main and sub stream status.
  * @param   liveStreamStatusF - Pointer to live stream status of all cameras
+ * @param   startCamIdx - First camera of range
+ * @param   endCamIdx - Camera after last camera of range
  * @return  Returns TRUE if any camera added for live stream else returns FALSE
  */
-static BOOL isAnyCameraAddedForLiveStream(BOOL liveStreamStatusF[MAX_STREAM][MAX_CAMERA])
+static BOOL isAnyCameraAddedForLiveStream(BOOL liveStreamStatusF[MAX_STREAM][MAX_CAMERA], UINT8 startCamIdx, UINT8 endCamIdx)
 {
     UINT8 camIndex, streamType;
 
     for (streamType = 0; streamType < MAX_STREAM; streamType++)
     {
-        for (camIndex = 0; camIndex < getMaxCameraForCurrentVariant(); camIndex++)
+        for (camIndex = startCamIdx; camIndex < endCamIdx; camIndex++)
         {
             /* Check live stream status for both streams of camera */
             if (TRUE == liveStreamStatusF[streamType][camIndex])
@@ -806,7 +852,7 @@ static VOIDPTR tcpLiveStreamCmd(VOIDPTR tcpSessionPtr)
     while (threadExitF == FALSE)
     {
         MUTEX_LOCK(liveStreamInfo[CMD_STREAM].mutex);
-        if (FALSE == isAnyCameraAddedForLiveStream(liveStreamInfo[CMD_STREAM].status))
+        if (FALSE == isAnyCameraAddedForLiveStream(liveStreamInfo[CMD_STREAM].status, 0, getMaxCameraForCurrentVariant()))
         {
             pthread_cond_wait(&liveStreamInfo[CMD_STREAM].signal, &liveStreamInfo[CMD_STREAM].mutex);
         }
@@ -826,7 +872,7 @@ static VOIDPTR tcpLiveStreamCmd(VOIDPTR tcpSessionPtr)
                 if (TRUE == liveStreamInfo[LIVE_STREAM].status[streamType][camIndex])
                 {
                     liveStreamInfo[LIVE_STREAM].status[streamType][camIndex] = FALSE;
-                    pthread_cond_signal(&liveStreamInfo[LIVE_STREAM].signal);
+                    pthread_cond_broadcast(&liveStreamInfo[LIVE_STREAM].signal);
                 }
                 MUTEX_UNLOCK(liveStreamInfo[LIVE_STREAM].mutex);
 
@@ -874,7 +920,7 @@ static VOIDPTR tcpLiveStreamCmd(VOIDPTR tcpSessionPtr)
                 if (TRUE == liveStreamInfo[LIVE_STREAM].status[streamType][camIndex])
                 {
                     liveStreamInfo[LIVE_STREAM].status[streamType][camIndex] = FALSE;
-                    pthread_cond_signal(&liveStreamInfo[LIVE_STREAM].signal);
+                    pthread_cond_broadcast(&liveStreamInfo[LIVE_STREAM].signal);
                 }
                 MUTEX_UNLOCK(liveStreamInfo[LIVE_STREAM].mutex);
 
@@ -1022,7 +1068,7 @@ static VOIDPTR tcpLiveStreamCmd(VOIDPTR tcpSessionPtr)
                         else
                         {
                             liveStreamInfo[LIVE_STREAM].status[streamType][camIndex] = TRUE;
-                            pthread_cond_signal(&liveStreamInfo[LIVE_STREAM].signal);
+                            pthread_cond_broadcast(&liveStreamInfo[LIVE_STREAM].signal);
                             MUTEX_UNLOCK(liveStreamInfo[LIVE_STREAM].mutex);
 
                             DPRINT(CAMERA_INITIATION, "increased socket buffer size: [camera=%d], [stream=%d], [send=%d], [recv=%d]", camIndex,
@@ -1057,7 +1103,7 @@ static VOIDPTR tcpLiveStreamCmd(VOIDPTR tcpSessionPtr)
 static void resetTcpLiveStreamFrameInfo(FRAME_DATA_INFO_t *pFrameInfo)
 {
     pFrameInfo->frameRecvF = FALSE;
-    pFrameInfo->timeoutCnt = 0;
+    pFrameInfo->lastRecvTimeMs = GetMonotonicTimeInMilliSec();
     pFrameInfo->frameState = FRAME_RECV_STATE_FIRST_FRAME;
     pFrameInfo->headerRef = NULL;
     pFrameInfo->payloadRef = NULL;
@@ -1066,31 +1112,137 @@ static void resetTcpLiveStreamFrameInfo(FRAME_DATA_INFO_t *pFrameInfo)
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   TCP live streaming thread
- * @param   tcpSessionPtr
+ * @brief   Make frame buffer of live stream large enough for given length. Buffer of required size class is
+ *          taken from pool and data received till now is moved to it. Old buffer is given back to pool.
+ * @param   pFrameInfo - Frame receive information of live stream
+ * @param   frameLen - Required length of buffer
+ * @return  SUCCESS if buffer is available else FAIL
+ */
+static BOOL reserveTcpLiveStreamFrameBuf(FRAME_DATA_INFO_t *pFrameInfo, UINT32 frameLen)
+{
+    UINT8    bufClass;
+    UINT32   dataLen = 0;
+    UINT8PTR pBuf;
+
+    if ((NULL != pFrameInfo->payloadData) && (frameLen <= ciFrameBufSize[pFrameInfo->payloadBufClass]))
+    {
+        /* Current buffer is enough */
+        return SUCCESS;
+    }
+
+    for (bufClass = 0; bufClass < CI_FRAME_BUF_CLASS_MAX; bufClass++)
+    {
+        if (frameLen <= ciFrameBufSize[bufClass])
+        {
+            break;
+        }
+    }
+
+    if (bufClass >= CI_FRAME_BUF_CLASS_MAX)
+    {
+        return FAIL;
+    }
+
+    MUTEX_LOCK(ciFrameBufPool.poolLock);
+    pBuf = ciFrameBufPool.pFreeBuf[bufClass];
+    if (NULL != pBuf)
+    {
+        /* Next free buffer is stored at start of free buffer */
+        ciFrameBufPool.pFreeBuf[bufClass] = *(UINT8PTR *)pBuf;
+        ciFrameBufPool.cacheSize -= ciFrameBufSize[bufClass];
+    }
+    MUTEX_UNLOCK(ciFrameBufPool.poolLock);
+
+    if (NULL == pBuf)
+    {
+        pBuf = (UINT8PTR)malloc(ciFrameBufSize[bufClass]);
+        if (NULL == pBuf)
+        {
+            return FAIL;
+        }
+    }
+
+    if (NULL != pFrameInfo->payloadData)
+    {
+        /* Move partially received data to new buffer */
+        if (NULL != pFrameInfo->payloadRef)
+        {
+            dataLen = pFrameInfo->payloadRef - pFrameInfo->payloadData;
+            memcpy(pBuf, pFrameInfo->payloadData, dataLen);
+        }
+        releaseTcpLiveStreamFrameBuf(pFrameInfo);
+        pFrameInfo->payloadRef = (NULL != pFrameInfo->payloadRef) ? (pBuf + dataLen) : NULL;
+    }
+
+    pFrameInfo->payloadData = pBuf;
+    pFrameInfo->payloadBufClass = bufClass;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Give frame buffer of live stream back to pool. Buffer is freed if pool has enough free buffers.
+ *          Size class of buffer is kept to take same size buffer on next run of stream.
+ * @param   pFrameInfo - Frame receive information of live stream
+ */
+static void releaseTcpLiveStreamFrameBuf(FRAME_DATA_INFO_t *pFrameInfo)
+{
+    UINT8 bufClass = pFrameInfo->payloadBufClass;
+
+    if (NULL == pFrameInfo->payloadData)
+    {
+        return;
+    }
+
+    MUTEX_LOCK(ciFrameBufPool.poolLock);
+    if ((ciFrameBufPool.cacheSize + ciFrameBufSize[bufClass]) <= CI_FRAME_BUF_POOL_CACHE_MAX)
+    {
+        *(UINT8PTR *)pFrameInfo->payloadData = ciFrameBufPool.pFreeBuf[bufClass];
+        ciFrameBufPool.pFreeBuf[bufClass] = pFrameInfo->payloadData;
+        ciFrameBufPool.cacheSize += ciFrameBufSize[bufClass];
+        pFrameInfo->payloadData = NULL;
+    }
+    MUTEX_UNLOCK(ciFrameBufPool.poolLock);
+
+    FREE_MEMORY(pFrameInfo->payloadData);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   TCP live streaming thread. It serves live streams of its range of cameras. It waits for data on
+ *          sockets of all running streams and receives frame only from sockets which have data.
+ * @param   threadArg - Pointer to index of live stream thread
  * @return
  */
-static VOIDPTR tcpLiveStream(VOIDPTR tcpSessionPtr)
+static VOIDPTR tcpLiveStream(VOIDPTR threadArg)
 {
     BOOL              status;
-    UINT8             camIndex;
+    UINT8             threadIdx = *(UINT8PTR)threadArg;
+    UINT8             camIndex, startCamIdx, endCamIdx;
     UINT8             streamType;
-    UINT32            recvMsgLen;
+    UINT8             pollFdCnt, pollIdx;
     INT32             streamFd;
-    UINT32            loopCnt;
-    UINT32            dataLen;
-    UINT32            dataRecvLen;
-    UINT32            maxFrameLen;
+    UINT64            currTimeMs;
     TCP_FRAME_INFO_t  tcpFrame;
-    FRAME_HEADER_t   *pMediaFrameHeader = NULL;
+    struct pollfd     pollFds[MAX_TCP_LIVE_STREAM_POLL_FD];
+    UINT8             pollCamIndex[MAX_TCP_LIVE_STREAM_POLL_FD];
+    UINT8             pollStreamType[MAX_TCP_LIVE_STREAM_POLL_FD];
     BOOL              liveStreamLocalStatus[MAX_STREAM][MAX_CAMERA];
     BOOL              newLiveStreamLocalStatus[MAX_STREAM][MAX_CAMERA];
     FRAME_DATA_INFO_t frameInfo[MAX_STREAM][MAX_CAMERA];
 
-    THREAD_START("TCP_LIVE_STREAM");
+    THREAD_START_INDEX("TCP_LV_STRM", threadIdx);
 
     setpriority(PRIO_PROCESS, PRIO_PROCESS, -1);
 
+    /* Cameras served by this thread */
+    startCamIdx = threadIdx * TCP_LIVE_STREAM_CAMERA_PER_THREAD;
+    endCamIdx = startCamIdx + TCP_LIVE_STREAM_CAMERA_PER_THREAD;
+    if (endCamIdx > getMaxCameraForCurrentVariant())
+    {
+        endCamIdx = getMaxCameraForCurrentVariant();
+    }
+
     for (streamType = 0; streamType < MAX_STREAM; streamType++)
     {
         for (camIndex = 0; camIndex < MAX_CAMERA; camIndex++)
@@ -1098,6 +1250,7 @@ static VOIDPTR tcpLiveStream(VOIDPTR tcpSessionPtr)
             liveStreamLocalStatus[streamType][camIndex] = FALSE;
             newLiveStreamLocalStatus[streamType][camIndex] = FALSE;
             frameInfo[streamType][camIndex].payloadData = NULL;
+            frameInfo[streamType][camIndex].payloadBufClass = 0;
             resetTcpLiveStreamFrameInfo(&frameInfo[streamType][camIndex]);
         }
     }
@@ -1105,26 +1258,28 @@ static VOIDPTR tcpLiveStream(VOIDPTR tcpSessionPtr)
     while (threadExitF == FALSE)
     {
         MUTEX_LOCK(liveStreamInfo[LIVE_STREAM].mutex);
-        if ((memcmp(liveStreamInfo[LIVE_STREAM].status, liveStreamLocalStatus, sizeof(liveStreamLocalStatus)) == 0) &&
-            (FALSE == isAnyCameraAddedForLiveStream(liveStreamInfo[LIVE_STREAM].status)))
+        if ((FALSE == isAnyCameraAddedForLiveStream(liveStreamLocalStatus, startCamIdx, endCamIdx)) &&
+            (FALSE == isAnyCameraAddedForLiveStream(liveStreamInfo[LIVE_STREAM].status, startCamIdx, endCamIdx)))
         {
-            DPRINT(CAMERA_INITIATION, "tcp live stream thread waiting");
+            DPRINT(CAMERA_INITIATION, "tcp live stream thread waiting: [thread=%d]", threadIdx);
             pthread_cond_wait(&liveStreamInfo[LIVE_STREAM].signal, &liveStreamInfo[LIVE_STREAM].mutex);
-            DPRINT(CAMERA_INITIATION, "tcp live stream thread waked-up");
+            DPRINT(CAMERA_INITIATION, "tcp live stream thread waked-up: [thread=%d]", threadIdx);
         }
         memcpy(newLiveStreamLocalStatus, liveStreamInfo[LIVE_STREAM].status, sizeof(newLiveStreamLocalStatus));
         MUTEX_UNLOCK(liveStreamInfo[LIVE_STREAM].mutex);
 
+        pollFdCnt = 0;
+        currTimeMs = GetMonotonicTimeInMilliSec();
         for (streamType = 0; streamType < MAX_STREAM; streamType++)
         {
-            for (camIndex = 0; camIndex < getMaxCameraForCurrentVariant(); camIndex++)
+            for (camIndex = startCamIdx; camIndex < endCamIdx; camIndex++)
             {
                 if (liveStreamLocalStatus[streamType][camIndex] != newLiveStreamLocalStatus[streamType][camIndex])
                 {
                     /* Update the camera status to old variable */
                     liveStreamLocalStatus[streamType][camIndex] = newLiveStreamLocalStatus[streamType][camIndex];
 
-                    FREE_MEMORY(frameInfo[streamType][camIndex].payloadData);
+                    releaseTcpLiveStreamFrameBuf(&frameInfo[streamType][camIndex]);
                     resetTcpLiveStreamFrameInfo(&frameInfo[streamType][camIndex]);
 
                     if ((FALSE == newLiveStreamLocalStatus[streamType][camIndex]) || (INACTIVE == GetCameraConnectionStatus(camIndex)))
@@ -1201,6 +1356,17 @@ static VOIDPTR tcpLiveStream(VOIDPTR tcpSessionPtr)
                     }
                 }
 
+                /* No data received from camera since long time. Stream started in this pass is reset after
+                 * time of pass is taken, hence its receive time can be later than time of pass */
+                if ((currTimeMs > frameInfo[streamType][camIndex].lastRecvTimeMs)
+                        && ((currTimeMs - frameInfo[streamType][camIndex].lastRecvTimeMs) >= MAX_TIMEOUT_STREAM_MS))
+                {
+                    EPRINT(CAMERA_INITIATION, "no data rcvd till timeout: [camera=%d], [stream=%d]", camIndex, streamType);
+                    CI_RESET_LIVE_STREAM_STS(LIVE_STREAM, camIndex, streamType);
+                    resetTcpLiveStreamFrameInfo(&frameInfo[streamType][camIndex]);
+                    continue;
+                }
+
                 MUTEX_LOCK(liveStreamCommInfo[streamType][camIndex].tcpCamLock);
                 streamFd = liveStreamCommInfo[streamType][camIndex].tcpCommFd;
                 MUTEX_UNLOCK(liveStreamCommInfo[streamType][camIndex].tcpCamLock);
@@ -1214,10 +1380,10 @@ static VOIDPTR tcpLiveStream(VOIDPTR tcpSessionPtr)
                     continue;
                 }
 
+                /* Buffer is taken as per frame size of last run of stream and it grows as per frames received */
                 if (NULL == frameInfo[streamType][camIndex].payloadData)
                 {
-                    frameInfo[streamType][camIndex].payloadData = (UINT8PTR)malloc(CI_MAX_FRAME_LEN);
-                    if (NULL == frameInfo[streamType][camIndex].payloadData)
+                    if (FAIL == reserveTcpLiveStreamFrameBuf(&frameInfo[streamType][camIndex], ciFrameBufSize[frameInfo[streamType][camIndex].payloadBufClass]))
                     {
                         EPRINT(CAMERA_INITIATION, "fail to allocate memory: [camera=%d], [stream=%d]", camIndex, streamType);
                         CI_RESET_LIVE_STREAM_STS(LIVE_STREAM, camIndex, streamType);
@@ -1226,395 +1392,459 @@ static VOIDPTR tcpLiveStream(VOIDPTR tcpSessionPtr)
                     }
                 }
 
-                /* Initialize the local variables */
-                recvMsgLen = dataRecvLen = loopCnt = 0;
-                maxFrameLen = CI_MAX_FRAME_LEN;
-                pMediaFrameHeader = NULL;
+                /* Add stream socket to wait for data */
+                pollFds[pollFdCnt].fd = streamFd;
+                pollFds[pollFdCnt].events = (POLLRDNORM | POLLRDHUP);
+                pollFds[pollFdCnt].revents = 0;
+                pollCamIndex[pollFdCnt] = camIndex;
+                pollStreamType[pollFdCnt] = streamType;
+                pollFdCnt++;
+            }
+        }
+
+        /* Wait for data on stream sockets. Change in live stream status is taken on timeout */
+        if (poll(pollFds, pollFdCnt, TCP_LIVE_STREAM_POLL_TIMEOUT_MS) <= 0)
+        {
+            continue;
+        }
+
+        for (pollIdx = 0; pollIdx < pollFdCnt; pollIdx++)
+        {
+            if (0 == pollFds[pollIdx].revents)
+            {
+                continue;
+            }
+
+            camIndex = pollCamIndex[pollIdx];
+            streamType = pollStreamType[pollIdx];
+            if ((pollFds[pollIdx].revents & POLLNVAL) == POLLNVAL)
+            {
+                EPRINT(CAMERA_INITIATION, "invld stream fd found: [camera=%d], [stream=%d], [fd=%d]", camIndex, streamType, pollFds[pollIdx].fd);
+                CI_RESET_LIVE_STREAM_STS(LIVE_STREAM, camIndex, streamType);
+                resetTcpLiveStreamFrameInfo(&frameInfo[streamType][camIndex]);
+                continue;
+            }
+
+            recvTcpLiveStreamFrame(camIndex, streamType, pollFds[pollIdx].fd, &frameInfo[streamType][camIndex]);
+        }
+    }
+
+    /* Give buffers of running streams back to pool */
+    for (streamType = 0; streamType < MAX_STREAM; streamType++)
+    {
+        for (camIndex = startCamIdx; camIndex < endCamIdx; camIndex++)
+        {
+            releaseTcpLiveStreamFrameBuf(&frameInfo[streamType][camIndex]);
+        }
+    }
+
+    pthread_exit(NULL);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Receive available data of live stream from socket and give frame to camera interface when it is
+ *          received completely. Partially received header or payload is kept in frame info till next data.
+ * @param   camIndex
+ * @param   streamType
+ * @param   streamFd - Socket of live stream which has data
+ * @param   pFrameInfo - Frame receive information of live stream
+ */
+static void recvTcpLiveStreamFrame(UINT8 camIndex, UINT8 streamType, INT32 streamFd, FRAME_DATA_INFO_t *pFrameInfo)
+{
+    BOOL              status;
+    UINT32            recvMsgLen;
+    UINT32            loopCnt;
+    UINT32            dataLen;
+    UINT32            dataRecvLen;
+    UINT32            maxFrameLen;
+    TCP_FRAME_INFO_t  tcpFrame;
+    FRAME_HEADER_t   *pMediaFrameHeader = NULL;
+
+    /* Initialize the local variables */
+    recvMsgLen = dataRecvLen = loopCnt = 0;
+    maxFrameLen = CI_MAX_FRAME_LEN;
+    pMediaFrameHeader = NULL;
+
+    /* Update frame data ptr only if null */
+    if (NULL == pFrameInfo->payloadRef)
+    {
+        pFrameInfo->payloadRef = pFrameInfo->payloadData;
+        pFrameInfo->headerRef = pFrameInfo->headerData;
+    }
 
-                /* Update frame data ptr only if null */
-                if (NULL == frameInfo[streamType][camIndex].payloadRef)
+    do
+    {
+        if (loopCnt >= MAX_LOOP_ALLOW)
+        {
+            break;
+        }
+
+        switch (pFrameInfo->frameState)
+        {
+            case FRAME_RECV_STATE_FIRST_FRAME:
+            {
+                /* if I-Frame Recv then now recv the 40 byte header */
+                if (TRUE == pFrameInfo->frameRecvF)
                 {
-                    frameInfo[streamType][camIndex].payloadRef = frameInfo[streamType][camIndex].payloadData;
-                    frameInfo[streamType][camIndex].headerRef = frameInfo[streamType][camIndex].headerData;
+                    dataRecvLen = CI_FRAME_HEADER_LEN;
                 }
-
-                do
+                else
                 {
-                    if (loopCnt >= MAX_LOOP_ALLOW)
+                    /* If I-Frame not Recv till then find the magic code */
+                    if (0 == dataRecvLen)
                     {
-                        break;
+                        dataRecvLen = MAX_MAGIC_CODE_LEN;
                     }
+                }
+            }
+            break;
 
-                    switch (frameInfo[streamType][camIndex].frameState)
-                    {
-                        case FRAME_RECV_STATE_FIRST_FRAME:
-                        {
-                            /* if I-Frame Recv then now recv the 40 byte header */
-                            if (TRUE == frameInfo[streamType][camIndex].frameRecvF)
-                            {
-                                dataRecvLen = CI_FRAME_HEADER_LEN;
-                            }
-                            else
-                            {
-                                /* If I-Frame not Recv till then find the magic code */
-                                if (0 == dataRecvLen)
-                                {
-                                    dataRecvLen = MAX_MAGIC_CODE_LEN;
-                                }
-                            }
-                        }
-                        break;
+            case FRAME_RECV_STATE_MAGIC_CODE:
+            {
+                dataRecvLen = CI_FRAME_HEADER_LEN - MAX_MAGIC_CODE_LEN;
+            }
+            break;
 
-                        case FRAME_RECV_STATE_MAGIC_CODE:
-                        {
-                            dataRecvLen = CI_FRAME_HEADER_LEN - MAX_MAGIC_CODE_LEN;
-                        }
-                        break;
+            case FRAME_RECV_STATE_LEFT_HEADER:
+            {
+                if (pFrameInfo->headerRef == NULL)
+                {
+                    break;
+                }
 
-                        case FRAME_RECV_STATE_LEFT_HEADER:
-                        {
-                            if (frameInfo[streamType][camIndex].headerRef == NULL)
-                            {
-                                break;
-                            }
+                if (pFrameInfo->headerRef <= pFrameInfo->headerData)
+                {
+                    break;
+                }
 
-                            if (frameInfo[streamType][camIndex].headerRef <= frameInfo[streamType][camIndex].headerData)
-                            {
-                                break;
-                            }
+                dataLen = pFrameInfo->headerRef - pFrameInfo->headerData;
+                if (dataLen > CI_FRAME_HEADER_LEN)
+                {
+                    dataRecvLen = 0;
+                    EPRINT(CAMERA_INITIATION, "invld frame length found: [camera=%d], [stream=%d]", camIndex, streamType);
+                    resetTcpLiveStreamFrameInfo(pFrameInfo);
+                    break;
+                }
 
-                            dataLen = frameInfo[streamType][camIndex].headerRef - frameInfo[streamType][camIndex].headerData;
-                            if (dataLen > CI_FRAME_HEADER_LEN)
-                            {
-                                dataRecvLen = 0;
-                                EPRINT(CAMERA_INITIATION, "invld frame length found: [camera=%d], [stream=%d]", camIndex, streamType);
-                                resetTcpLiveStreamFrameInfo(&frameInfo[streamType][camIndex]);
-                                break;
-                            }
+                if (CI_FRAME_HEADER_LEN == dataLen)
+                {
+                    dataRecvLen = 0;
+                    recvMsgLen = CI_FRAME_HEADER_LEN;
+                    pFrameInfo->frameState = FRAME_RECV_STATE_NEW_HEADER;
+                    memcpy(pFrameInfo->payloadData, pFrameInfo->headerData, CI_FRAME_HEADER_LEN);
+                    pFrameInfo->payloadRef = pFrameInfo->payloadData;
+                    pFrameInfo->headerRef = NULL;
+                    continue;
+                }
 
-                            if (CI_FRAME_HEADER_LEN == dataLen)
-                            {
-                                dataRecvLen = 0;
-                                recvMsgLen = CI_FRAME_HEADER_LEN;
-                                frameInfo[streamType][camIndex].frameState = FRAME_RECV_STATE_NEW_HEADER;
-                                memcpy(frameInfo[streamType][camIndex].payloadData, frameInfo[streamType][camIndex].headerData, CI_FRAME_HEADER_LEN);
-                                frameInfo[streamType][camIndex].payloadRef = frameInfo[streamType][camIndex].payloadData;
-                                frameInfo[streamType][camIndex].headerRef = NULL;
-                                continue;
-                            }
+                /* Receive remaining frame header */
+                dataRecvLen = CI_FRAME_HEADER_LEN - dataLen;
+            }
+            break;
 
-                            /* Receive remaining frame header */
-                            dataRecvLen = CI_FRAME_HEADER_LEN - dataLen;
-                        }
-                        break;
+            case FRAME_RECV_STATE_LEFT_PAYLOAD:
+            {
+                pMediaFrameHeader = (FRAME_HEADER_t *)pFrameInfo->headerData;
+                dataRecvLen = (UINT32)(pMediaFrameHeader->mediaFrmLen);
+            }
+            break;
 
-                        case FRAME_RECV_STATE_LEFT_PAYLOAD:
-                        {
-                            pMediaFrameHeader = (FRAME_HEADER_t *)frameInfo[streamType][camIndex].headerData;
-                            dataRecvLen = (UINT32)(pMediaFrameHeader->mediaFrmLen);
-                        }
-                        break;
+            case FRAME_RECV_STATE_NEW_HEADER:
+            {
+                pMediaFrameHeader = (FRAME_HEADER_t *)pFrameInfo->headerData;
+                if (pMediaFrameHeader->mediaFrmLen <= CI_FRAME_HEADER_LEN)
+                {
+                    dataRecvLen = 0;
+                    EPRINT(CAMERA_INITIATION, "invld frame length found: [camera=%d], [stream=%d]", camIndex, streamType);
+                    resetTcpLiveStreamFrameInfo(pFrameInfo);
+                    break;
+                }
 
-                        case FRAME_RECV_STATE_NEW_HEADER:
-                        {
-                            pMediaFrameHeader = (FRAME_HEADER_t *)frameInfo[streamType][camIndex].headerData;
-                            if (pMediaFrameHeader->mediaFrmLen <= CI_FRAME_HEADER_LEN)
-                            {
-                                dataRecvLen = 0;
-                                EPRINT(CAMERA_INITIATION, "invld frame length found: [camera=%d], [stream=%d]", camIndex, streamType);
-                                resetTcpLiveStreamFrameInfo(&frameInfo[streamType][camIndex]);
-                                break;
-                            }
+                pMediaFrameHeader->mediaFrmLen -= CI_FRAME_HEADER_LEN;
+                tcpFrame.frameInfo.len = (UINT32)(pMediaFrameHeader->mediaFrmLen);
+                dataRecvLen = tcpFrame.frameInfo.len;
+            }
+            break;
 
-                            pMediaFrameHeader->mediaFrmLen -= CI_FRAME_HEADER_LEN;
-                            tcpFrame.frameInfo.len = (UINT32)(pMediaFrameHeader->mediaFrmLen);
-                            dataRecvLen = tcpFrame.frameInfo.len;
-                        }
-                        break;
+            default:
+            {
+                /* Nothing to do */
+            }
+            break;
+        }
 
-                        default:
-                        {
-                            /* Nothing to do */
-                        }
-                        break;
-                    }
+        /* If length is 0, start from beginning */
+        if (dataRecvLen == 0)
+        {
+            EPRINT(CAMERA_INITIATION, "invld operation: [camera=%d], [stream=%d], [camState=%d]", camIndex, streamType,
+                   pFrameInfo->frameState);
+            break;
+        }
 
-                    /* If length is 0, start from beginning */
-                    if (dataRecvLen == 0)
-                    {
-                        EPRINT(CAMERA_INITIATION, "invld operation: [camera=%d], [stream=%d], [camState=%d]", camIndex, streamType,
-                               frameInfo[streamType][camIndex].frameState);
-                        break;
-                    }
+        /* Buffer must have space for data to be received */
+        if (FAIL == reserveTcpLiveStreamFrameBuf(pFrameInfo, (pFrameInfo->payloadRef - pFrameInfo->payloadData) + dataRecvLen))
+        {
+            EPRINT(CAMERA_INITIATION, "frame buffer not available: [camera=%d], [stream=%d], [len=%d]", camIndex, streamType,
+                   (UINT32)(pFrameInfo->payloadRef - pFrameInfo->payloadData) + dataRecvLen);
+            resetTcpLiveStreamFrameInfo(pFrameInfo);
+            break;
+        }
+
+        /* Receive frame from socket */
+        loopCnt++;
+        status = RecvFrame(streamFd, (CHARPTR)pFrameInfo->payloadRef, &recvMsgLen, dataRecvLen, 0, 0);
+        if (REFUSE == status)
+        {
+            EPRINT(CAMERA_INITIATION, "camera connection closed: [camera=%d], [stream=%d]", camIndex, streamType);
+            CI_RESET_LIVE_STREAM_STS(LIVE_STREAM, camIndex, streamType);
+            resetTcpLiveStreamFrameInfo(pFrameInfo);
+            break;
+        }
+
+        if (recvMsgLen > 0)
+        {
+            pFrameInfo->lastRecvTimeMs = GetMonotonicTimeInMilliSec();
+        }
+
+        if ((FAIL == status) || (FRAME_RECV_STATE_LEFT_HEADER == pFrameInfo->frameState) ||
+            (FRAME_RECV_STATE_LEFT_PAYLOAD == pFrameInfo->frameState))
+        {
+            if (0 == recvMsgLen)
+            {
+                if (FRAME_RECV_STATE_NEW_HEADER == pFrameInfo->frameState)
+                {
+                    pFrameInfo->frameState = FRAME_RECV_STATE_LEFT_PAYLOAD;
+                }
+
+                /* Wait till socket has more data */
+                break;
+            }
 
-                    /* Receive frame from socket */
-                    loopCnt++;
-                    status = RecvFrame(streamFd, (CHARPTR)frameInfo[streamType][camIndex].payloadRef, &recvMsgLen, dataRecvLen, 0, 0);
-                    if (REFUSE == status)
+            if (recvMsgLen <= dataRecvLen)
+            {
+                if ((FRAME_RECV_STATE_LEFT_HEADER == pFrameInfo->frameState) ||
+                    (FRAME_RECV_STATE_FIRST_FRAME == pFrameInfo->frameState) ||
+                    (FRAME_RECV_STATE_MAGIC_CODE == pFrameInfo->frameState))
+                {
+                    if ((FRAME_RECV_STATE_FIRST_FRAME == pFrameInfo->frameState) ||
+                        (FRAME_RECV_STATE_MAGIC_CODE == pFrameInfo->frameState))
                     {
-                        EPRINT(CAMERA_INITIATION, "camera connection closed: [camera=%d], [stream=%d]", camIndex, streamType);
-                        CI_RESET_LIVE_STREAM_STS(LIVE_STREAM, camIndex, streamType);
-                        resetTcpLiveStreamFrameInfo(&frameInfo[streamType][camIndex]);
-                        break;
+                        pFrameInfo->headerRef = pFrameInfo->headerData;
+                        pFrameInfo->frameState = FRAME_RECV_STATE_LEFT_HEADER;
                     }
 
-                    if ((FAIL == status) || (FRAME_RECV_STATE_LEFT_HEADER == frameInfo[streamType][camIndex].frameState) ||
-                        (FRAME_RECV_STATE_LEFT_PAYLOAD == frameInfo[streamType][camIndex].frameState))
+                    if (pFrameInfo->payloadRef > pFrameInfo->payloadData)
                     {
-                        if (0 == recvMsgLen)
+                        dataLen = pFrameInfo->payloadRef - pFrameInfo->payloadData;
+                        EPRINT(CAMERA_INITIATION, "invld frame length found: [camera=%d], [stream=%d], [dataLen=%d]", camIndex,
+                               streamType, dataLen);
+                        if (dataLen > CI_FRAME_HEADER_LEN)
                         {
-                            if (FRAME_RECV_STATE_NEW_HEADER == frameInfo[streamType][camIndex].frameState)
-                            {
-                                frameInfo[streamType][camIndex].frameState = FRAME_RECV_STATE_LEFT_PAYLOAD;
-                            }
-
-                            frameInfo[streamType][camIndex].timeoutCnt++;
-                            if (frameInfo[streamType][camIndex].timeoutCnt >= MAX_TIMEOUT_STREAM)
-                            {
-                                EPRINT(CAMERA_INITIATION, "timeout cnt reached max: [camera=%d], [stream=%d]", camIndex, streamType);
-                                CI_RESET_LIVE_STREAM_STS(LIVE_STREAM, camIndex, streamType);
-                                resetTcpLiveStreamFrameInfo(&frameInfo[streamType][camIndex]);
-                            }
+                            resetTcpLiveStreamFrameInfo(pFrameInfo);
                             break;
                         }
 
-                        if (recvMsgLen <= dataRecvLen)
-                        {
-                            if ((FRAME_RECV_STATE_LEFT_HEADER == frameInfo[streamType][camIndex].frameState) ||
-                                (FRAME_RECV_STATE_FIRST_FRAME == frameInfo[streamType][camIndex].frameState) ||
-                                (FRAME_RECV_STATE_MAGIC_CODE == frameInfo[streamType][camIndex].frameState))
-                            {
-                                if ((FRAME_RECV_STATE_FIRST_FRAME == frameInfo[streamType][camIndex].frameState) ||
-                                    (FRAME_RECV_STATE_MAGIC_CODE == frameInfo[streamType][camIndex].frameState))
-                                {
-                                    frameInfo[streamType][camIndex].headerRef = frameInfo[streamType][camIndex].headerData;
-                                    frameInfo[streamType][camIndex].frameState = FRAME_RECV_STATE_LEFT_HEADER;
-                                }
-
-                                if (frameInfo[streamType][camIndex].payloadRef > frameInfo[streamType][camIndex].payloadData)
-                                {
-                                    dataLen = frameInfo[streamType][camIndex].payloadRef - frameInfo[streamType][camIndex].payloadData;
-                                    EPRINT(CAMERA_INITIATION, "invld frame length found: [camera=%d], [stream=%d], [dataLen=%d]", camIndex,
-                                           streamType, dataLen);
-                                    if (dataLen > CI_FRAME_HEADER_LEN)
-                                    {
-                                        resetTcpLiveStreamFrameInfo(&frameInfo[streamType][camIndex]);
-                                        break;
-                                    }
-
-                                    memcpy(frameInfo[streamType][camIndex].headerRef, frameInfo[streamType][camIndex].payloadData, dataLen);
-                                    frameInfo[streamType][camIndex].headerRef += dataLen;
-                                }
-
-                                memcpy(frameInfo[streamType][camIndex].headerRef, frameInfo[streamType][camIndex].payloadRef, recvMsgLen);
-                                frameInfo[streamType][camIndex].headerRef += recvMsgLen;
-
-                                if (CI_FRAME_HEADER_LEN != (frameInfo[streamType][camIndex].headerRef - frameInfo[streamType][camIndex].headerData))
-                                {
-                                    /* If header is left then come again to receive left header */
-                                    break;
-                                }
-
-                                frameInfo[streamType][camIndex].frameState = FRAME_RECV_STATE_MAGIC_CODE;
-                                memcpy(frameInfo[streamType][camIndex].payloadData, frameInfo[streamType][camIndex].headerData, CI_FRAME_HEADER_LEN);
-                                pMediaFrameHeader = (FRAME_HEADER_t *)frameInfo[streamType][camIndex].headerData;
-                                frameInfo[streamType][camIndex].payloadLen = pMediaFrameHeader->mediaFrmLen - CI_FRAME_HEADER_LEN;
-                                recvMsgLen = CI_FRAME_HEADER_LEN;
-                                frameInfo[streamType][camIndex].payloadRef = frameInfo[streamType][camIndex].payloadData;
-                                frameInfo[streamType][camIndex].headerRef = NULL;
-                            }
-                            else if ((FRAME_RECV_STATE_NEW_HEADER == frameInfo[streamType][camIndex].frameState) ||
-                                     (FRAME_RECV_STATE_LEFT_PAYLOAD == frameInfo[streamType][camIndex].frameState))
-                            {
-                                pMediaFrameHeader = (FRAME_HEADER_t *)frameInfo[streamType][camIndex].headerData;
-                                frameInfo[streamType][camIndex].frameState = FRAME_RECV_STATE_LEFT_PAYLOAD;
-
-                                if (pMediaFrameHeader->mediaFrmLen >= recvMsgLen)
-                                {
-                                    pMediaFrameHeader->mediaFrmLen -= ((UINT32)recvMsgLen);
-                                    frameInfo[streamType][camIndex].payloadRef += recvMsgLen;
-                                    maxFrameLen -= MAX_MAGIC_CODE_LEN;
-                                }
-                                else
-                                {
-                                    pMediaFrameHeader->mediaFrmLen = 0;
-                                }
-
-                                if (pMediaFrameHeader->mediaFrmLen > 0)
-                                {
-                                    break;
-                                }
-
-                                frameInfo[streamType][camIndex].frameState = FRAME_RECV_STATE_NEW_HEADER;
-                            }
-                        }
+                        memcpy(pFrameInfo->headerRef, pFrameInfo->payloadData, dataLen);
+                        pFrameInfo->headerRef += dataLen;
+                    }
+
+                    memcpy(pFrameInfo->headerRef, pFrameInfo->payloadRef, recvMsgLen);
+                    pFrameInfo->headerRef += recvMsgLen;
+
+                    if (CI_FRAME_HEADER_LEN != (pFrameInfo->headerRef - pFrameInfo->headerData))
+                    {
+                        /* If header is left then come again to receive left header */
+                        break;
+                    }
+
+                    pFrameInfo->frameState = FRAME_RECV_STATE_MAGIC_CODE;
+                    memcpy(pFrameInfo->payloadData, pFrameInfo->headerData, CI_FRAME_HEADER_LEN);
+                    pMediaFrameHeader = (FRAME_HEADER_t *)pFrameInfo->headerData;
+                    pFrameInfo->payloadLen = pMediaFrameHeader->mediaFrmLen - CI_FRAME_HEADER_LEN;
+                    recvMsgLen = CI_FRAME_HEADER_LEN;
+                    pFrameInfo->payloadRef = pFrameInfo->payloadData;
+                    pFrameInfo->headerRef = NULL;
+                }
+                else if ((FRAME_RECV_STATE_NEW_HEADER == pFrameInfo->frameState) ||
+                         (FRAME_RECV_STATE_LEFT_PAYLOAD == pFrameInfo->frameState))
+                {
+                    pMediaFrameHeader = (FRAME_HEADER_t *)pFrameInfo->headerData;
+                    pFrameInfo->frameState = FRAME_RECV_STATE_LEFT_PAYLOAD;
+
+                    if (pMediaFrameHeader->mediaFrmLen >= recvMsgLen)
+                    {
+                        pMediaFrameHeader->mediaFrmLen -= ((UINT32)recvMsgLen);
+                        pFrameInfo->payloadRef += recvMsgLen;
+                        maxFrameLen -= MAX_MAGIC_CODE_LEN;
                     }
                     else
                     {
-                        /* Reset the time out count to receive frame */
-                        frameInfo[streamType][camIndex].timeoutCnt = 0;
+                        pMediaFrameHeader->mediaFrmLen = 0;
                     }
 
-                    /* Just a double check */
-                    if (recvMsgLen == 0)
+                    if (pMediaFrameHeader->mediaFrmLen > 0)
                     {
-                        DPRINT(CAMERA_INITIATION, "no data rcvd: [camera=%d], [stream=%d]", camIndex, streamType);
-                        resetTcpLiveStreamFrameInfo(&frameInfo[streamType][camIndex]);
                         break;
                     }
 
-                    if ((FRAME_RECV_STATE_FIRST_FRAME == frameInfo[streamType][camIndex].frameState) ||
-                        (FRAME_RECV_STATE_MAGIC_CODE == frameInfo[streamType][camIndex].frameState))
-                    {
-                        if ((MAX_MAGIC_CODE_LEN == recvMsgLen) && (FALSE == frameInfo[streamType][camIndex].frameRecvF))
-                        {
-                            pMediaFrameHeader = (FRAME_HEADER_t *)frameInfo[streamType][camIndex].payloadRef;
-                            if (pMediaFrameHeader->magicCode == MAGIC_CODE)
-                            {
-                                /* Again read the frame after the magic code */
-                                DPRINT(CAMERA_INITIATION, "magic code found: [camera=%d], [stream=%d]", camIndex, streamType);
-                                frameInfo[streamType][camIndex].frameState = FRAME_RECV_STATE_MAGIC_CODE;
-                                frameInfo[streamType][camIndex].payloadRef += MAX_MAGIC_CODE_LEN;
-                                maxFrameLen -= MAX_MAGIC_CODE_LEN;
-                            }
-                            else
-                            {
-                                dataRecvLen = 0;
-                                frameInfo[streamType][camIndex].frameState = FRAME_RECV_STATE_FIRST_FRAME;
-                            }
-                            continue;
-                        }
+                    pFrameInfo->frameState = FRAME_RECV_STATE_NEW_HEADER;
+                }
+            }
+        }
 
-                        dataRecvLen = 0;
-                        pMediaFrameHeader = (FRAME_HEADER_t *)frameInfo[streamType][camIndex].payloadData;
-                        if ((MAGIC_CODE != pMediaFrameHeader->magicCode) || (CAM_PRODUCT_TYPE != pMediaFrameHeader->productType))
-                        {
-                            EPRINT(CAMERA_INITIATION,
-                                   "invld magic code or product type found: [camera=%d], [stream=%d], [magicCode=0x%x], [productType=%d]", camIndex,
-                                   streamType, pMediaFrameHeader->magicCode, pMediaFrameHeader->productType);
-                            resetTcpLiveStreamFrameInfo(&frameInfo[streamType][camIndex]);
-                            break;
-                        }
+        /* Just a double check */
+        if (recvMsgLen == 0)
+        {
+            DPRINT(CAMERA_INITIATION, "no data rcvd: [camera=%d], [stream=%d]", camIndex, streamType);
+            resetTcpLiveStreamFrameInfo(pFrameInfo);
+            break;
+        }
 
-                        if ((FALSE == frameInfo[streamType][camIndex].frameRecvF) && (I_FRAME == pMediaFrameHeader->frmType))
-                        {
-                            frameInfo[streamType][camIndex].frameRecvF = TRUE;
-                        }
+        if ((FRAME_RECV_STATE_FIRST_FRAME == pFrameInfo->frameState) ||
+            (FRAME_RECV_STATE_MAGIC_CODE == pFrameInfo->frameState))
+        {
+            if ((MAX_MAGIC_CODE_LEN == recvMsgLen) && (FALSE == pFrameInfo->frameRecvF))
+            {
+                pMediaFrameHeader = (FRAME_HEADER_t *)pFrameInfo->payloadRef;
+                if (pMediaFrameHeader->magicCode == MAGIC_CODE)
+                {
+                    /* Again read the frame after the magic code */
+                    DPRINT(CAMERA_INITIATION, "magic code found: [camera=%d], [stream=%d]", camIndex, streamType);
+                    pFrameInfo->frameState = FRAME_RECV_STATE_MAGIC_CODE;
+                    pFrameInfo->payloadRef += MAX_MAGIC_CODE_LEN;
+                    maxFrameLen -= MAX_MAGIC_CODE_LEN;
+                }
+                else
+                {
+                    dataRecvLen = 0;
+                    pFrameInfo->frameState = FRAME_RECV_STATE_FIRST_FRAME;
+                }
+                continue;
+            }
 
-                        if (recvMsgLen <= CI_FRAME_HEADER_LEN)
-                        {
-                            /* Receive frame header */
-                            frameInfo[streamType][camIndex].frameState = FRAME_RECV_STATE_NEW_HEADER;
-                            memcpy(frameInfo[streamType][camIndex].headerData, frameInfo[streamType][camIndex].payloadData, CI_FRAME_HEADER_LEN);
-                            pMediaFrameHeader = (FRAME_HEADER_t *)frameInfo[streamType][camIndex].headerData;
-                            frameInfo[streamType][camIndex].payloadLen = pMediaFrameHeader->mediaFrmLen - CI_FRAME_HEADER_LEN;
+            dataRecvLen = 0;
+            pMediaFrameHeader = (FRAME_HEADER_t *)pFrameInfo->payloadData;
+            if ((MAGIC_CODE != pMediaFrameHeader->magicCode) || (CAM_PRODUCT_TYPE != pMediaFrameHeader->productType))
+            {
+                EPRINT(CAMERA_INITIATION,
+                       "invld magic code or product type found: [camera=%d], [stream=%d], [magicCode=0x%x], [productType=%d]", camIndex,
+                       streamType, pMediaFrameHeader->magicCode, pMediaFrameHeader->productType);
+                resetTcpLiveStreamFrameInfo(pFrameInfo);
+                break;
+            }
 
-                            if (frameInfo[streamType][camIndex].payloadLen >= CI_MAX_FRAME_LEN)
-                            {
-                                EPRINT(CAMERA_INITIATION, "frame is greater size. update buffer memory: [camera=%d], [stream=%d]", camIndex,
-                                       streamType);
-                                resetTcpLiveStreamFrameInfo(&frameInfo[streamType][camIndex]);
-                                break;
-                            }
+            if ((FALSE == pFrameInfo->frameRecvF) && (I_FRAME == pMediaFrameHeader->frmType))
+            {
+                pFrameInfo->frameRecvF = TRUE;
+            }
 
-                            frameInfo[streamType][camIndex].payloadRef += recvMsgLen;
-                            maxFrameLen -= recvMsgLen;
-                            continue;
-                        }
-                    }
-                    else if ((FRAME_RECV_STATE_NEW_HEADER == frameInfo[streamType][camIndex].frameState) ||
-                             (FRAME_RECV_STATE_LEFT_PAYLOAD == frameInfo[streamType][camIndex].frameState))
-                    {
-                        loopCnt = 0;
-                        if (FALSE == frameInfo[streamType][camIndex].frameRecvF)
-                        {
-                            if (FRAME_RECV_STATE_LEFT_PAYLOAD == frameInfo[streamType][camIndex].frameState)
-                            {
-                                continue;
-                            }
+            if (recvMsgLen <= CI_FRAME_HEADER_LEN)
+            {
+                /* Receive frame header */
+                pFrameInfo->frameState = FRAME_RECV_STATE_NEW_HEADER;
+                memcpy(pFrameInfo->headerData, pFrameInfo->payloadData, CI_FRAME_HEADER_LEN);
+                pMediaFrameHeader = (FRAME_HEADER_t *)pFrameInfo->headerData;
+                pFrameInfo->payloadLen = pMediaFrameHeader->mediaFrmLen - CI_FRAME_HEADER_LEN;
 
-                            /* Note: If I-Frame Not Recv until then ignore all the frames */
-                            resetTcpLiveStreamFrameInfo(&frameInfo[streamType][camIndex]);
-                            break;
-                        }
+                if (pFrameInfo->payloadLen >= CI_MAX_FRAME_LEN)
+                {
+                    EPRINT(CAMERA_INITIATION, "frame is greater size. update buffer memory: [camera=%d], [stream=%d]", camIndex,
+                           streamType);
+                    resetTcpLiveStreamFrameInfo(pFrameInfo);
+                    break;
+                }
 
-                        if (FRAME_RECV_STATE_NEW_HEADER == frameInfo[streamType][camIndex].frameState)
-                        {
-                            frameInfo[streamType][camIndex].frameState = FRAME_RECV_STATE_NEW_PAYLOAD;
-                        }
+                pFrameInfo->payloadRef += recvMsgLen;
+                maxFrameLen -= recvMsgLen;
+                continue;
+            }
+        }
+        else if ((FRAME_RECV_STATE_NEW_HEADER == pFrameInfo->frameState) ||
+                 (FRAME_RECV_STATE_LEFT_PAYLOAD == pFrameInfo->frameState))
+        {
+            loopCnt = 0;
+            if (FALSE == pFrameInfo->frameRecvF)
+            {
+                if (FRAME_RECV_STATE_LEFT_PAYLOAD == pFrameInfo->frameState)
+                {
+                    continue;
+                }
 
-                        pMediaFrameHeader = (FRAME_HEADER_t *)frameInfo[streamType][camIndex].headerData;
-                        if (MAGIC_CODE != (UINT32)pMediaFrameHeader->magicCode)
-                        {
-                            EPRINT(CAMERA_INITIATION, "header not found, reseting logic: [camera=%d], [stream=%d]", camIndex, streamType);
-                            resetTcpLiveStreamFrameInfo(&frameInfo[streamType][camIndex]);
-                            break;
-                        }
+                /* Note: If I-Frame Not Recv until then ignore all the frames */
+                resetTcpLiveStreamFrameInfo(pFrameInfo);
+                break;
+            }
 
-                        if (pMediaFrameHeader->vidResolution >= MAX_CI_RESOLUTION)
-                        {
-                            EPRINT(CAMERA_INITIATION, "invld frame resolution: [camera=%d], [stream=%d], [resolution=%d]", camIndex, streamType,
-                                   pMediaFrameHeader->vidResolution);
-                            break;
-                        }
+            if (FRAME_RECV_STATE_NEW_HEADER == pFrameInfo->frameState)
+            {
+                pFrameInfo->frameState = FRAME_RECV_STATE_NEW_PAYLOAD;
+            }
 
-                        if ((pMediaFrameHeader->frmType != I_FRAME) && (pMediaFrameHeader->frmType != P_FRAME))
-                        {
-                            EPRINT(CAMERA_INITIATION, "different frame type found: [camera=%d], [stream=%d], [frameType=%d]", camIndex, streamType,
-                                   pMediaFrameHeader->frmType);
-                            break;
-                        }
+            pMediaFrameHeader = (FRAME_HEADER_t *)pFrameInfo->headerData;
+            if (MAGIC_CODE != (UINT32)pMediaFrameHeader->magicCode)
+            {
+                EPRINT(CAMERA_INITIATION, "header not found, reseting logic: [camera=%d], [stream=%d]", camIndex, streamType);
+                resetTcpLiveStreamFrameInfo(pFrameInfo);
+                break;
+            }
 
-                        if (NULL == liveStreamCommInfo[streamType][camIndex].tcpFrameCb)
-                        {
-                            EPRINT(CAMERA_INITIATION, "frame callback is not set: [camera=%d], [stream=%d]", camIndex, streamType);
-                            break;
-                        }
+            if (pMediaFrameHeader->vidResolution >= MAX_CI_RESOLUTION)
+            {
+                EPRINT(CAMERA_INITIATION, "invld frame resolution: [camera=%d], [stream=%d], [resolution=%d]", camIndex, streamType,
+                       pMediaFrameHeader->vidResolution);
+                break;
+            }
 
-                        tcpFrame.state = START;
-                        tcpFrame.channel = GET_STREAM_MAPPED_CAMERA_ID(camIndex, streamType);
-                        tcpFrame.streamType = pMediaFrameHeader->streamType;
-                        tcpFrame.frameInfo.isRTSP = TRUE;
-                        tcpFrame.frameInfo.avPresentationTime.tv_sec = pMediaFrameHeader->localTime.totalSec;
-                        tcpFrame.frameInfo.avPresentationTime.tv_usec = (pMediaFrameHeader->localTime.mSec * 1000L);
-                        tcpFrame.frameInfo.len = frameInfo[streamType][camIndex].payloadLen;
-                        tcpFrame.frameInfo.codecType = pMediaFrameHeader->codecType;
-                        tcpFrame.frameInfo.sampleRate = pMediaFrameHeader->audSampleFrq;
-                        tcpFrame.frameInfo.videoInfo.frameType = pMediaFrameHeader->frmType;
-                        tcpFrame.frameInfo.videoInfo.noOfRefFrame = DEFAULT_REF_NUM; /* We take default reference frame */
-
-                        if (pMediaFrameHeader->vidResolution == 0)
-                        {
-                            tcpFrame.frameInfo.videoInfo.width = INVALID_HEIGHT_WIDTH;
-                            tcpFrame.frameInfo.videoInfo.height = INVALID_HEIGHT_WIDTH;
-                        }
-                        else
-                        {
-                            tcpFrame.frameInfo.videoInfo.width = frameResolution[pMediaFrameHeader->vidResolution][FRAME_WIDTH];
-                            tcpFrame.frameInfo.videoInfo.height = frameResolution[pMediaFrameHeader->vidResolution][FRAME_HEIGHT];
-                        }
+            if ((pMediaFrameHeader->frmType != I_FRAME) && (pMediaFrameHeader->frmType != P_FRAME))
+            {
+                EPRINT(CAMERA_INITIATION, "different frame type found: [camera=%d], [stream=%d], [frameType=%d]", camIndex, streamType,
+                       pMediaFrameHeader->frmType);
+                break;
+            }
 
-                        /* Provide frame to camera interface for further processing */
-                        tcpFrame.dataPtr = frameInfo[streamType][camIndex].payloadData + CI_FRAME_HEADER_LEN;
-                        liveStreamCommInfo[streamType][camIndex].tcpFrameCb(&tcpFrame);
-                        frameInfo[streamType][camIndex].payloadRef = NULL;
+            if (NULL == liveStreamCommInfo[streamType][camIndex].tcpFrameCb)
+            {
+                EPRINT(CAMERA_INITIATION, "frame callback is not set: [camera=%d], [stream=%d]", camIndex, streamType);
+                break;
+            }
 
-                        if (FRAME_RECV_STATE_NEW_PAYLOAD == frameInfo[streamType][camIndex].frameState)
-                        {
-                            frameInfo[streamType][camIndex].frameState = FRAME_RECV_STATE_FIRST_FRAME;
-                        }
-                        break;
-                    }
+            tcpFrame.state = START;
+            tcpFrame.channel = GET_STREAM_MAPPED_CAMERA_ID(camIndex, streamType);
+            tcpFrame.streamType = pMediaFrameHeader->streamType;
+            tcpFrame.frameInfo.isRTSP = TRUE;
+            tcpFrame.frameInfo.avPresentationTime.tv_sec = pMediaFrameHeader->localTime.totalSec;
+            tcpFrame.frameInfo.avPresentationTime.tv_usec = (pMediaFrameHeader->localTime.mSec * 1000L);
+            tcpFrame.frameInfo.len = pFrameInfo->payloadLen;
+            tcpFrame.frameInfo.codecType = pMediaFrameHeader->codecType;
+            tcpFrame.frameInfo.sampleRate = pMediaFrameHeader->audSampleFrq;
+            tcpFrame.frameInfo.videoInfo.frameType = pMediaFrameHeader->frmType;
+            tcpFrame.frameInfo.videoInfo.noOfRefFrame = DEFAULT_REF_NUM; /* We take default reference frame */
+
+            if (pMediaFrameHeader->vidResolution == 0)
+            {
+                tcpFrame.frameInfo.videoInfo.width = INVALID_HEIGHT_WIDTH;
+                tcpFrame.frameInfo.videoInfo.height = INVALID_HEIGHT_WIDTH;
+            }
+            else
+            {
+                tcpFrame.frameInfo.videoInfo.width = frameResolution[pMediaFrameHeader->vidResolution][FRAME_WIDTH];
+                tcpFrame.frameInfo.videoInfo.height = frameResolution[pMediaFrameHeader->vidResolution][FRAME_HEIGHT];
+            }
+
+            /* Provide frame to camera interface for further processing */
+            tcpFrame.dataPtr = pFrameInfo->payloadData + CI_FRAME_HEADER_LEN;
+            liveStreamCommInfo[streamType][camIndex].tcpFrameCb(&tcpFrame);
+            pFrameInfo->payloadRef = NULL;
 
-                } while (TRUE);
+            if (FRAME_RECV_STATE_NEW_PAYLOAD == pFrameInfo->frameState)
+            {
+                pFrameInfo->frameState = FRAME_RECV_STATE_FIRST_FRAME;
             }
+            break;
         }
 
-        /* Provide sleep to reduce CPU usage */
-        usleep(1000);
-    }
-
-    pthread_exit(NULL);
+    } while (TRUE);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -33,6 +33,15 @@
 //#################################################################################################
 #define MAX_FRAME_IN_BUFFER                 (1000)
 
+/* Frame sequence number of slot which is being written. Valid sequence numbers never have this value */
+#define FRAME_SEQ_INVALID                   (0)
+#define NEXT_FRAME_SEQ(seq)                 ((((seq) + 1) == FRAME_SEQ_INVALID) ? ((seq) + 2) : ((seq) + 1))
+
+/* Write position and sequence number of next frame are published together in single word */
+#define MAKE_WRITE_MARKER(seq, pos)         ((((UINT64)(seq)) << 32) | (UINT16)(pos))
+#define GET_WRITE_MARKER_SEQ(marker)        ((UINT32)((marker) >> 32))
+#define GET_WRITE_MARKER_POS(marker)        ((INT16)((marker) & 0xFFFF))
+
 #define MAX_CAMERA_DISCONN_COUNT            (3)
 #define MIN_CAMERA_DISCONN_COUNT            (0)
 #define DFLT_CAMERA_DISCONN_COUNT           (0)
@@ -68,6 +77,13 @@
 #define CONN_MONITORT_THREAD_STACK_SZ       (2 * MEGA_BYTE)
 #define PTZ_CTRL_THREAD_STACK_SZ            (2 * MEGA_BYTE)
 
+/* Image received from camera is given to other image requests till this time instead of asking camera again */
+#define IMAGE_CACHE_FRESH_TIME              (1)     //in seconds
+#define IMAGE_CACHE_SIZE_MAX                (2 * MEGA_BYTE)
+
+/* Image requests which wait for response of image request in progress of same camera */
+#define GET_IMAGE_WAITER_MAX                (8)
+
 //#################################################################################################
 // @DATA_TYPES
 //#################################################################################################
@@ -145,20 +161,33 @@ typedef struct
 //Frame information
 typedef struct
 {
+    UINT32                  frameSeq;               // sequence number of frame, invalid while slot is being written
     UINT32 					frameLen;
     UINT8PTR 				framePtr;
+    UINT64                  dataPos;                // logical position of frame data, it never rolls back
     STREAM_STATUS_INFO_t	streamStatusInfo;
 
 }FRAME_INFO_t;
 
+//Read position of client and frame which is pinned by client
+typedef struct
+{
+    INT16                   rdPos;
+    UINT32                  rdSeq;                  // sequence number of frame expected at read position
+    INT16                   pinPos;
+    UINT32                  pinSeq;
+    UINT64                  pinDataPos;
+
+}BUFFER_READER_t;
+
 //This provide current Read / Write point inside buffer.
 typedef struct
 {
-    INT16 					rdPos[MAX_CI_STREAM_CLIENT];
-    INT16 					wrPos;
+    BUFFER_READER_t         reader[MAX_CI_STREAM_CLIENT];
+    UINT64                  wrMarker;               // write position and sequence number of next frame
+    UINT64                  dataWrEnd;              // logical end of frame data being written
     INT16 					maxWriteIndex;
     INT16					lastIframe;
-    pthread_rwlock_t 		writeIndexLock;
     pthread_mutex_t 		writeBuffLock;
     FRAME_INFO_t 			frameInfo[MAX_FRAME_IN_BUFFER];
 
@@ -336,6 +365,25 @@ typedef struct
 
 }PTZ_FUNC_PAUSE_t;
 
+typedef struct
+{
+    IMAGE_REQUEST_CB        callback;
+    CLIENT_CB_TYPE_e        clientCbType;
+
+}GET_IMAGE_WAITER_t;
+
+typedef struct
+{
+    UINT8                   waiterCnt;
+    BOOL                    respGivenF;
+    GET_IMAGE_WAITER_t      waiter[GET_IMAGE_WAITER_MAX];
+    CHARPTR                 pImageBuff;
+    UINT32                  imageBuffSize;
+    UINT32                  imageSize;
+    UINT32                  imageTick;
+
+}GET_IMAGE_CACHE_t;
+
 //#################################################################################################
 // @PROTOTYPES
 //#################################################################################################
@@ -408,6 +456,10 @@ static void actualTimeStampFrame(UINT8 cameraIndex,MEDIA_FRAME_INFO_t *frameInfo
 //-------------------------------------------------------------------------------------------------
 static void writeToStreamBuff(UINT8 cameraIndex, STREAM_TYPE_e streamType, UINT8PTR streamData, MEDIA_FRAME_INFO_t *frameInfoPtr);
 //-------------------------------------------------------------------------------------------------
+static BOOL isFrameIntact(STREAM_INFO_t *pStreamInfo, INT16 frameIndex, UINT32 frameSeq, UINT64 dataPos);
+//-------------------------------------------------------------------------------------------------
+static BOOL getLastIframeReadPos(STREAM_INFO_t *pStreamInfo, INT16 *pFrameIndex, UINT32 *pFrameSeq);
+//-------------------------------------------------------------------------------------------------
 static UINT32 readFromStreamBuff(UINT16 cameraIndex, UINT8 clientIndex, STREAM_STATUS_INFO_t **streamStatusInfo,
                                  UINT8PTR *streamData, UINT32PTR streamDataLen,BOOL firstIframeSent);
 //-------------------------------------------------------------------------------------------------
@@ -481,6 +533,10 @@ static BOOL onvifStreamUrlCb(ONVIF_RESPONSE_PARA_t *responseData);
 //-------------------------------------------------------------------------------------------------
 static BOOL onvifImageCb(ONVIF_RESPONSE_PARA_t *responseData);
 //-------------------------------------------------------------------------------------------------
+static void getImageRespCb(UINT8 cameraIndex, NET_CMD_STATUS_e status, CHARPTR imageBuff, UINT32 imageSize, CLIENT_CB_TYPE_e clientCbType);
+//-------------------------------------------------------------------------------------------------
+static CHARPTR getFreshImageFromCache(UINT8 cameraIndex, UINT32PTR pImageSize);
+//-------------------------------------------------------------------------------------------------
 static BOOL onvifSetDateTimeCb(ONVIF_RESPONSE_PARA_t *responseData);
 //-------------------------------------------------------------------------------------------------
 static BOOL onvifSetPtzCb(ONVIF_RESPONSE_PARA_t *responseData);
@@ -614,6 +670,7 @@ static CAMERA_CONFIG_NOTIFY_CONTROL_t	camCnfgNotifyControl[MAX_CAMERA];
 static STREAM_INFO_t                    streamInfo[MAX_CAMERA][MAX_STREAM_TYPE];
 static CAMERA_REQUEST_t                 storePtzRequest[MAX_CAMERA];
 static CAMERA_REQUEST_t                 getImageRequest[MAX_CAMERA];
+static GET_IMAGE_CACHE_t                getImageCache[MAX_CAMERA];
 static CAMERA_REQUEST_t                 setPtzRequest[MAX_CAMERA];
 static CAMERA_REQUEST_t                 gotoPtzRequest[MAX_CAMERA];
 static CAMERA_REQUEST_t                 setFocusRequest[MAX_CAMERA];
@@ -758,11 +815,11 @@ void InitCameraInterface(void)
             streamInfo[cameraIndex][loop].offWaitUnHandleCnt = 0;
             streamInfo[cameraIndex][loop].configFrameRate = 0;
 
-            pthread_rwlock_init(&streamInfo[cameraIndex][loop].frameMarker.writeIndexLock, NULL);
             MUTEX_INIT(streamInfo[cameraIndex][loop].frameMarker.writeBuffLock, NULL);
 
-            /* Initialize write index of live stream frame marker to zero */
-            streamInfo[cameraIndex][loop].frameMarker.wrPos = 0;
+            /* Initialize write index of live stream frame marker to zero and first frame sequence number */
+            streamInfo[cameraIndex][loop].frameMarker.wrMarker = MAKE_WRITE_MARKER(NEXT_FRAME_SEQ(FRAME_SEQ_INVALID), 0);
+            streamInfo[cameraIndex][loop].frameMarker.dataWrEnd = 0;
 
             /* Initialize max write index of live stream frame marker to one to avoid arithmatic exception in modulo */
             streamInfo[cameraIndex][loop].frameMarker.maxWriteIndex = 1;
@@ -775,6 +832,8 @@ void InitCameraInterface(void)
             for (requestCount = 0; requestCount < MAX_CI_STREAM_CLIENT; requestCount++)
             {
                 streamInfo[cameraIndex][loop].clientCb[requestCount] = NULL;
+                streamInfo[cameraIndex][loop].frameMarker.reader[requestCount].rdSeq = GET_WRITE_MARKER_SEQ(streamInfo[cameraIndex][loop].frameMarker.wrMarker);
+                streamInfo[cameraIndex][loop].frameMarker.reader[requestCount].pinSeq = FRAME_SEQ_INVALID;
             }
 
             /*******************************************************************************/
@@ -791,6 +850,7 @@ void InitCameraInterface(void)
         initCameraRequestParam(cameraIndex, &getImageRequest[cameraIndex]);
         getImageRequest[cameraIndex].httpCallback[CAM_REQ_CONTROL] = httpImageControlCb;
         getImageRequest[cameraIndex].httpCallback[CAM_REQ_MEDIA] = httpImageMediaCb;
+        memset(&getImageCache[cameraIndex], 0, sizeof(GET_IMAGE_CACHE_t));
 
         /*******************************************************************************/
         initCameraRequestParam(cameraIndex, &setPtzRequest[cameraIndex]);
@@ -1131,6 +1191,9 @@ static void *connMonitorThread(void *pThreadArg)
     BOOL						connStatus[MAX_CAMERA] = { INACTIVE };
     CI_STREAM_EXT_TRG_PARAM_t	triggerParam;
     GENERAL_CONFIG_t		    generalConfig;
+    UINT32                      generalConfigVersion = CONFIG_VERSION_INVALID;
+    UINT32                      cameraConfigVersion = CONFIG_VERSION_INVALID;
+    UINT32                      ipCamConfigVersion = CONFIG_VERSION_INVALID;
     UINT8 						videoLossDuration;
     IP_ADDR_TYPE_e              internetIpAddrType = IP_ADDR_TYPE_IPV4;
     const CHAR                  *pInternetCheckIpAddr[IP_ADDR_TYPE_MAX] = {INTERNET_CONNECTIVITY_CHECK_IPV4, INTERNET_CONNECTIVITY_CHECK_IPV6};
@@ -1151,10 +1214,10 @@ static void *connMonitorThread(void *pThreadArg)
             INIT_POLL_FD(pollFds[cameraIndex]);
         }
 
-        /* Read camera and general configuration */
-        ReadGeneralConfig(&generalConfig);
-        ReadCameraConfig(cameraConfig);
-        ReadIpCameraConfig(ipCamCfg);
+        /* Read camera and general configuration if changed */
+        ReadGeneralConfigIfChanged(&generalConfig, &generalConfigVersion);
+        ReadCameraConfigIfChanged(cameraConfig, &cameraConfigVersion);
+        ReadIpCameraConfigIfChanged(ipCamCfg, &ipCamConfigVersion);
 
         /* Convert counting seconds into count */
         videoLossDuration = generalConfig.preVideoLossDuration / MAX_CONN_CHECK_PERIOD;
@@ -1903,6 +1966,28 @@ static BOOL onvifBrandModelCb(ONVIF_RESPONSE_PARA_t *responseData)
                         snprintf(onvifCamDetail[responseData->cameraIndex].onvifCamBrand, MAX_BRAND_NAME_LEN, "%s", brandNamePtr);
                         snprintf(onvifCamDetail[responseData->cameraIndex].onvifCamModel, MAX_MODEL_NAME_LEN, "%s", modelNamePtr);
 
+                        // If capabilities are restored from cache then start stream now and revalidate capabilities after retry time
+                        if (RestoreOnvifCameraCache(responseData->cameraIndex) == SUCCESS)
+                        {
+                            DPRINT(CAMERA_INTERFACE, "capabilities restored from cache, revalidation scheduled: [camera=%d]", responseData->cameraIndex);
+                            MUTEX_LOCK(onvifCamDetail[responseData->cameraIndex].onvifAccessLock);
+                            onvifCamDetail[responseData->cameraIndex].initialSetupF = SUCCESS;
+                            MUTEX_UNLOCK(onvifCamDetail[responseData->cameraIndex].onvifAccessLock);
+
+                            triggerParam.camIndex = responseData->cameraIndex;
+                            triggerParam.connState = CAM_REACHABLE;
+                            triggerParam.type = CI_STREAM_EXT_TRG_CONNECTIVITY;
+                            ciStreamExtTriggerHandler(&triggerParam);
+
+                            triggerParam.camIndex += getMaxCameraForCurrentVariant();
+                            ciStreamExtTriggerHandler(&triggerParam);
+
+                            if (startOnvifRetryTimer(responseData->cameraIndex, ONVIF_GET_CAPABILITY) == SUCCESS)
+                            {
+                                return SUCCESS;
+                            }
+                        }
+
                         // If start onvif client fils with camera disabled, no need to retry
                         requestStatus = sendOnvifCommonCmd(responseData->cameraIndex, ONVIF_GET_CAPABILITY, onvifCamCapabilityCb, &ipCamCfg, NULL);
                         if((requestStatus != CMD_SUCCESS) && (requestStatus != CMD_CHANNEL_DISABLED))
@@ -2015,6 +2100,9 @@ static BOOL onvifCamCapabilityCb(ONVIF_RESPONSE_PARA_t *responseData)
     NET_CMD_STATUS_e			requestStatus;
     IP_CAMERA_CONFIG_t			ipCamCfg;
     CI_STREAM_EXT_TRG_PARAM_t	triggerParam;
+    UINT32						changedProfileMask;
+    VIDEO_TYPE_e				streamType;
+    UINT8						streamProfileIndex = 0;
 
     if(responseData->response == ONVIF_CMD_TIMEOUT)
     {
@@ -2035,9 +2123,10 @@ static BOOL onvifCamCapabilityCb(ONVIF_RESPONSE_PARA_t *responseData)
             WriteSingleIpCameraConfig(responseData->cameraIndex, &ipCamCfg);
         }
 
-        //make onvif in running state
+        //make onvif in running state. Profiles changed in revalidation of capabilities restored from cache are applied here
         MUTEX_LOCK(onvifCamDetail[responseData->cameraIndex].onvifAccessLock);
         onvifCamDetail[responseData->cameraIndex].initialSetupF = SUCCESS;
+        changedProfileMask = ApplyOnvifCameraRevalidation(responseData->cameraIndex);
         MUTEX_UNLOCK(onvifCamDetail[responseData->cameraIndex].onvifAccessLock);
 
         triggerParam.camIndex = responseData->cameraIndex;
@@ -2047,10 +2136,29 @@ static BOOL onvifCamCapabilityCb(ONVIF_RESPONSE_PARA_t *responseData)
 
         triggerParam.camIndex += getMaxCameraForCurrentVariant();
         ciStreamExtTriggerHandler(&triggerParam);
+
+        // Restart streams which are running on changed profiles
+        triggerParam.type = CI_STREAM_EXT_TRG_CONFIG_CHANGE;
+        triggerParam.clientType = MAX_CI_STREAM_CLIENT;
+        for (streamType = MAIN_STREAM; (changedProfileMask != 0) && (streamType < MAX_STREAM); streamType++)
+        {
+            if ((getStreamProfileNum(streamType, responseData->cameraIndex, &streamProfileIndex) == FAIL)
+                    || (streamProfileIndex == 0) || ((changedProfileMask & (1 << (streamProfileIndex - 1))) == 0))
+            {
+                continue;
+            }
+
+            DPRINT(CAMERA_INTERFACE, "stream profile changed in camera, restart stream: [camera=%d], [stream=%d], [profile=%d]",
+                   responseData->cameraIndex, streamType, streamProfileIndex);
+            triggerParam.camIndex = (streamType == MAIN_STREAM) ? responseData->cameraIndex
+                                                                : (responseData->cameraIndex + getMaxCameraForCurrentVariant());
+            ciStreamExtTriggerHandler(&triggerParam);
+        }
     }
     else
     {
         EPRINT(CAMERA_INTERFACE, "get capability request failed: [camera=%d]",  responseData->cameraIndex);
+        RemoveOnvifCameraCache(responseData->cameraIndex);
         memset(onvifCamDetail[responseData->cameraIndex].onvifCamBrand, '\0', MAX_BRAND_NAME_LEN);
         memset(onvifCamDetail[responseData->cameraIndex].onvifCamModel, '\0', MAX_MODEL_NAME_LEN);
         FreeCameraCapability(GET_STREAM_INDEX(responseData->cameraIndex));
@@ -3044,6 +3152,8 @@ NET_CMD_STATUS_e StreamParamCopyToCamera(UINT8 srcCamIndex, STREAM_CONFIG_t *pSr
     srcGop[SUB_STREAM] = pSrcStreamCfg->gopSub;
     srcAudioF[SUB_STREAM] = pSrcStreamCfg->enableAudioSub;
 
+    /* Commit stream config of all destination cameras in single config journal commit */
+    BeginConfigJournalBatch();
     for (camIndex = 0; camIndex < getMaxCameraForCurrentVariant(); camIndex++)
     {
         /* Skip source camera from copy to camera :) */
@@ -3272,6 +3382,14 @@ NET_CMD_STATUS_e StreamParamCopyToCamera(UINT8 srcCamIndex, STREAM_CONFIG_t *pSr
         DPRINT(CAMERA_INTERFACE, "new stream param copy to camera written: [camera=%d], [dstCamera=%d]", srcCamIndex, camIndex);
     }
 
+    if (FAIL == EndConfigJournalBatch())
+    {
+        EPRINT(CAMERA_INTERFACE, "fail to save stream param copy to camera: [camera=%d], [mainMask1=0x%llx], [mainMask2=0x%llx], [subMask1=0x%llx], [subMask2=0x%llx]",
+               srcCamIndex, pCopyToCamMask[MAIN_STREAM].bitMask[0], pCopyToCamMask[MAIN_STREAM].bitMask[1],
+               pCopyToCamMask[SUB_STREAM].bitMask[0], pCopyToCamMask[SUB_STREAM].bitMask[1]);
+        return CMD_PROCESS_ERROR;
+    }
+
     DPRINT(CAMERA_INTERFACE, "stream param copy to camera done: [camera=%d], [mainMask1=0x%llx], [mainMask2=0x%llx], [subMask1=0x%llx], [subMask2=0x%llx]",
             srcCamIndex, pCopyToCamMask[MAIN_STREAM].bitMask[0], pCopyToCamMask[MAIN_STREAM].bitMask[1],
             pCopyToCamMask[SUB_STREAM].bitMask[0], pCopyToCamMask[SUB_STREAM].bitMask[1]);
@@ -3318,6 +3436,8 @@ NET_CMD_STATUS_e MotionDetectionCopyToCamera(UINT8 srcCamIndex, CAMERA_CONFIG_t
         return CMD_FEATURE_NOT_SUPPORTED;
     }
 
+    /* Commit camera config of all destination cameras in single config journal commit */
+    BeginConfigJournalBatch();
     for (camIndex = 0; camIndex < getMaxCameraForCurrentVariant(); camIndex++)
     {
         /* Skip source camera from copy to camera :) */
@@ -3405,6 +3525,15 @@ NET_CMD_STATUS_e MotionDetectionCopyToCamera(UINT8 srcCamIndex, CAMERA_CONFIG_t
         DPRINT(CAMERA_INTERFACE, "motion detection area copied to camera: [camera=%d], [dstCamera=%d]", srcCamIndex, camIndex);
     }
 
+    if (FAIL == EndConfigJournalBatch())
+    {
+        EPRINT(CAMERA_INTERFACE, "fail to save motion detection copy to camera: [camera=%d], [mask1=0x%llx], [mask2=0x%llx]",
+               srcCamIndex, copyToCamMask.bitMask[0], copyToCamMask.bitMask[1]);
+        snprintf(details, MAX_EVENT_DETAIL_SIZE, "%02d", GET_CAMERA_NO(srcCamIndex));
+        WriteEvent(LOG_CAMERA_EVENT, LOG_MOTION_DETECTION_COPY_TO_CAM, details, "Config Save Failed", EVENT_FAIL);
+        return CMD_PROCESS_ERROR;
+    }
+
     DPRINT(CAMERA_INTERFACE, "motion detection copy to camera done: [camera=%d], [mask1=0x%llx], [mask2=0x%llx]",
            srcCamIndex, copyToCamMask.bitMask[0], copyToCamMask.bitMask[1]);
     return CMD_SUCCESS;
@@ -4277,25 +4406,32 @@ BOOL InitStreamSession(UINT8 cameraIndex, UINT8 sessionIndex,CI_BUFFER_READ_POS_
         return FAIL;
     }
 
-    STREAM_INFO_t *pStreamInfo = &streamInfo[GET_STREAM_INDEX(cameraIndex)][GET_STREAM_TYPE(cameraIndex)];
-    pthread_rwlock_rdlock(&pStreamInfo->frameMarker.writeIndexLock);
-    INT16 rdIndx = pStreamInfo->frameMarker.wrPos;
+    STREAM_INFO_t   *pStreamInfo = &streamInfo[GET_STREAM_INDEX(cameraIndex)][GET_STREAM_TYPE(cameraIndex)];
+    BUFFER_READER_t *pReader = &pStreamInfo->frameMarker.reader[sessionIndex];
+    UINT64          wrMarker = __atomic_load_n(&pStreamInfo->frameMarker.wrMarker, __ATOMIC_ACQUIRE);
+    INT16           rdIndx = GET_WRITE_MARKER_POS(wrMarker);
+    INT16           maxWriteIndex = __atomic_load_n(&pStreamInfo->frameMarker.maxWriteIndex, __ATOMIC_RELAXED);
+    UINT32          rdSeq;
+
+    /* By default start from next frame */
+    pReader->rdPos = rdIndx;
+    pReader->rdSeq = GET_WRITE_MARKER_SEQ(wrMarker);
+    pReader->pinSeq = FRAME_SEQ_INVALID;
 
-    if (sessionIndex == CI_STREAM_CLIENT_RECORD)
+    if ((sessionIndex == CI_STREAM_CLIENT_RECORD) && (readPos == CI_READ_OLDEST_FRAME))
     {
-        if(readPos == CI_READ_OLDEST_FRAME)
-        {
-            rdIndx +=5;
-        }
+        /* Oldest frames are just after write position */
+        rdIndx = ((rdIndx + 5) % maxWriteIndex);
 
-        if(rdIndx >= pStreamInfo->frameMarker.maxWriteIndex)
+        /* Start from oldest frame only if it is older than write position */
+        rdSeq = __atomic_load_n(&pStreamInfo->frameMarker.frameInfo[rdIndx].frameSeq, __ATOMIC_ACQUIRE);
+        if ((rdSeq != FRAME_SEQ_INVALID) && ((INT32)(pReader->rdSeq - rdSeq) > 0))
         {
-            rdIndx -= pStreamInfo->frameMarker.maxWriteIndex;
+            pReader->rdPos = rdIndx;
+            pReader->rdSeq = rdSeq;
         }
     }
 
-    pStreamInfo->frameMarker.rdPos[sessionIndex] = rdIndx;
-    pthread_rwlock_unlock(&pStreamInfo->frameMarker.writeIndexLock);
     return SUCCESS;
 }
 
@@ -5760,7 +5896,8 @@ void CiActionChangeDateTime(void)
  *          buffers are maintained, one is frame buffer which stores the incoming frames and other
  *          stores location of those frames in frame buffer, length of frame and other frame information.
  *          Both buffers are circular; i.e. whenever overflow is detected, buffer is rolled back to
- *          beginning position.
+ *          beginning position. Every frame gets a sequence number and logical data position, readers
+ *          use them to detect that frame was overwritten. Writer never waits for readers.
  * @param cameraIndex
  * @param streamType
  * @param streamData
@@ -5770,7 +5907,10 @@ static void writeToStreamBuff(UINT8 cameraIndex, STREAM_TYPE_e streamType, UINT8
 {
     BOOL					frameIflag = FALSE;
     INT16 					writeIndex, maxWriteIndex;
+    UINT32                  frameSeq;
+    UINT64                  wrMarker, dataPos;
     UINT8PTR 				nextFramePtr;
+    FRAME_INFO_t            *pFrameInfo;
     STREAM_STATUS_INFO_t	*streamStatusPtr;
     STREAM_INFO_t			*pStreamInfo;
     LocalTime_t 			currentSystemTime = {0};
@@ -5804,12 +5944,12 @@ static void writeToStreamBuff(UINT8 cameraIndex, STREAM_TYPE_e streamType, UINT8
         }
     }
 
-    /* Get lock for frame write into buffer */
+    /* Get lock for frame write into buffer. Write marker is updated by writer only */
     MUTEX_LOCK(pStreamInfo->frameMarker.writeBuffLock);
-    pthread_rwlock_rdlock(&pStreamInfo->frameMarker.writeIndexLock);
-    writeIndex = pStreamInfo->frameMarker.wrPos;
+    wrMarker = pStreamInfo->frameMarker.wrMarker;
+    writeIndex = GET_WRITE_MARKER_POS(wrMarker);
+    frameSeq = GET_WRITE_MARKER_SEQ(wrMarker);
     maxWriteIndex = pStreamInfo->frameMarker.maxWriteIndex;
-    pthread_rwlock_unlock(&pStreamInfo->frameMarker.writeIndexLock);
 
     /* if we have written 1000 frames already in buffer, assign starting of buf to framePtr again :)) */
     if(writeIndex >= MAX_FRAME_IN_BUFFER)
@@ -5828,15 +5968,26 @@ static void writeToStreamBuff(UINT8 cameraIndex, STREAM_TYPE_e streamType, UINT8
         pStreamInfo->frameMarker.frameInfo[writeIndex].framePtr = pStreamInfo->bufferPtr;
     }
 
+    /* Logical data position moves ahead by skipped space when frame buffer is rolled back */
+    pFrameInfo = &pStreamInfo->frameMarker.frameInfo[writeIndex];
+    dataPos = pStreamInfo->frameMarker.dataWrEnd;
+    dataPos += (((UINT64)(pFrameInfo->framePtr - pStreamInfo->bufferPtr) + pStreamInfo->bufferSize - (dataPos % pStreamInfo->bufferSize)) % pStreamInfo->bufferSize);
+
+    /* Invalidate slot and claim frame data area before overwriting them. Readers of overwritten frames will detect it */
+    __atomic_store_n(&pFrameInfo->frameSeq, FRAME_SEQ_INVALID, __ATOMIC_RELAXED);
+    __atomic_store_n(&pStreamInfo->frameMarker.dataWrEnd, (dataPos + frameInfoPtr->len), __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
     /* Store the received frame to frame buffer at current write pointer */
-    memcpy(pStreamInfo->frameMarker.frameInfo[writeIndex].framePtr, streamData, frameInfoPtr->len);
+    memcpy(pFrameInfo->framePtr, streamData, frameInfoPtr->len);
 
     /* Update video loss status as no video loss */
     updateVideoLossStatus(GET_STREAM_INDEX(cameraIndex), TRUE);
 
     /* Store frame configuration data into frame marker at current write index */
-    pStreamInfo->frameMarker.frameInfo[writeIndex].frameLen = frameInfoPtr->len;
-    streamStatusPtr = &pStreamInfo->frameMarker.frameInfo[writeIndex].streamStatusInfo;
+    pFrameInfo->frameLen = frameInfoPtr->len;
+    pFrameInfo->dataPos = dataPos;
+    streamStatusPtr = &pFrameInfo->streamStatusInfo;
 
     /* Get system's local time */
     GetLocalTime(&currentSystemTime);
@@ -6018,8 +6169,11 @@ static void writeToStreamBuff(UINT8 cameraIndex, STREAM_TYPE_e streamType, UINT8
     streamStatusPtr->streamPara.noOfRefFrame = frameInfoPtr->videoInfo.noOfRefFrame;
     streamStatusPtr->streamPara.streamCodecType = frameInfoPtr->codecType;
 
+    /* Publish frame in slot */
+    __atomic_store_n(&pFrameInfo->frameSeq, frameSeq, __ATOMIC_RELEASE);
+
     // Set next frame pointer to current write pointer plus current frame length
-    nextFramePtr = (pStreamInfo->frameMarker.frameInfo[writeIndex].framePtr + frameInfoPtr->len);
+    nextFramePtr = (pFrameInfo->framePtr + frameInfoPtr->len);
 
     /* Increment write index by one */
     writeIndex++;
@@ -6035,25 +6189,77 @@ static void writeToStreamBuff(UINT8 cameraIndex, STREAM_TYPE_e streamType, UINT8
         maxWriteIndex = writeIndex;
     }
 
-    /* Lock for frame buffer location update */
-    pthread_rwlock_wrlock(&pStreamInfo->frameMarker.writeIndexLock);
     if (frameIflag == TRUE)
     {
         /* Set index for last received i-frame for reference */
-        pStreamInfo->frameMarker.lastIframe = (writeIndex - 1);
+        __atomic_store_n(&pStreamInfo->frameMarker.lastIframe, (writeIndex - 1), __ATOMIC_RELAXED);
     }
 
-    /* Update write position and index */
-    pStreamInfo->frameMarker.wrPos = writeIndex;
-    pStreamInfo->frameMarker.maxWriteIndex = maxWriteIndex;
-    pthread_rwlock_unlock(&pStreamInfo->frameMarker.writeIndexLock);
+    /* Update write position and index. Readers see the frame after write marker is updated */
+    __atomic_store_n(&pStreamInfo->frameMarker.maxWriteIndex, maxWriteIndex, __ATOMIC_RELAXED);
+    __atomic_store_n(&pStreamInfo->frameMarker.wrMarker, MAKE_WRITE_MARKER(NEXT_FRAME_SEQ(frameSeq), writeIndex), __ATOMIC_RELEASE);
     MUTEX_UNLOCK(pStreamInfo->frameMarker.writeBuffLock);
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check that frame is not overwritten by writer. It must be called after frame information
+ *          and data are used by reader.
+ * @param   pStreamInfo
+ * @param   frameIndex
+ * @param   frameSeq
+ * @param   dataPos
+ * @return  TRUE if frame is intact else FALSE
+ */
+static BOOL isFrameIntact(STREAM_INFO_t *pStreamInfo, INT16 frameIndex, UINT32 frameSeq, UINT64 dataPos)
+{
+    /* All reads of frame must be completed before checking writer position */
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    if (__atomic_load_n(&pStreamInfo->frameMarker.frameInfo[frameIndex].frameSeq, __ATOMIC_RELAXED) != frameSeq)
+    {
+        return FALSE;
+    }
+
+    return ((__atomic_load_n(&pStreamInfo->frameMarker.dataWrEnd, __ATOMIC_RELAXED) - dataPos) <= pStreamInfo->bufferSize) ? TRUE : FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Get read position of last received i-frame
+ * @param   pStreamInfo
+ * @param   pFrameIndex
+ * @param   pFrameSeq
+ * @return  SUCCESS if i-frame is available in buffer else FAIL
+ */
+static BOOL getLastIframeReadPos(STREAM_INFO_t *pStreamInfo, INT16 *pFrameIndex, UINT32 *pFrameSeq)
+{
+    INT16           frameIndex = __atomic_load_n(&pStreamInfo->frameMarker.lastIframe, __ATOMIC_RELAXED);
+    FRAME_INFO_t    *pFrameInfo = &pStreamInfo->frameMarker.frameInfo[frameIndex];
+    UINT32          frameSeq = __atomic_load_n(&pFrameInfo->frameSeq, __ATOMIC_ACQUIRE);
+    UINT64          dataPos = pFrameInfo->dataPos;
+
+    if ((frameSeq == FRAME_SEQ_INVALID) || (pFrameInfo->streamStatusInfo.streamPara.videoStreamType != I_FRAME))
+    {
+        return FAIL;
+    }
+
+    if (FALSE == isFrameIntact(pStreamInfo, frameIndex, frameSeq, dataPos))
+    {
+        return FAIL;
+    }
+
+    *pFrameIndex = frameIndex;
+    *pFrameSeq = frameSeq;
+    return SUCCESS;
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   This function used to read a frame from the frame buffer. Other stream status information
- *          is also passed to user.
+ *          is also passed to user. Returned frame remains pinned for client till next read, client can
+ *          use frame from buffer without copy and check it using UnpinFrame after use. If writer has
+ *          overwritten the frames which are not read yet then client resumes from last i-frame.
  * @param   cameraIndex
  * @param   clientIndex
  * @param   streamStatusInfo
@@ -6065,63 +6271,140 @@ static void writeToStreamBuff(UINT8 cameraIndex, STREAM_TYPE_e streamType, UINT8
 static UINT32 readFromStreamBuff(UINT16 cameraIndex, UINT8 clientIndex, STREAM_STATUS_INFO_t **streamStatusInfo,
                                  UINT8PTR *streamData, UINT32PTR streamDataLen, BOOL firstIframeSent)
 {
-    BOOL				updateRdIdx = FALSE;
-    INT16 				maxWriteIdx, writeIndex, readIndex, lastIframe;
+    BOOL                resyncF = (firstIframeSent == FALSE) ? TRUE : FALSE;
+    UINT8               retryCnt;
+    INT16 				readIndex, iFrameIndex;
+    UINT32              writeSeq, readSeq, iFrameSeq;
     UINT32 				framesInBuff = 0;
+    UINT64              dataPos;
     STREAM_INFO_t		*pStreamInfo = &streamInfo[GET_STREAM_INDEX(cameraIndex)][GET_STREAM_TYPE(cameraIndex)];
     BUFFER_MARKER_t		*frameMarkPtr = &pStreamInfo->frameMarker;
+    BUFFER_READER_t     *pReader = &frameMarkPtr->reader[clientIndex];
+    FRAME_INFO_t        *pFrameInfo;
 
-    pthread_rwlock_rdlock(&frameMarkPtr->writeIndexLock);
-    writeIndex = frameMarkPtr->wrPos;
-    maxWriteIdx = frameMarkPtr->maxWriteIndex;
-    lastIframe = frameMarkPtr->lastIframe;
-    pthread_rwlock_unlock(&frameMarkPtr->writeIndexLock);
-
-    readIndex = (firstIframeSent == FALSE) ? lastIframe : frameMarkPtr->rdPos[clientIndex];
-    if ((writeIndex == readIndex) || (writeIndex >= MAX_FRAME_IN_BUFFER))
-    {
-        return 0;
-    }
-
-    if (readIndex >= maxWriteIdx)
-    {
-        readIndex = 0;
-    }
+    /* Previously read frame is released */
+    pReader->pinSeq = FRAME_SEQ_INVALID;
+    writeSeq = GET_WRITE_MARKER_SEQ(__atomic_load_n(&frameMarkPtr->wrMarker, __ATOMIC_ACQUIRE));
 
-    framesInBuff = (UINT32)((maxWriteIdx - (readIndex - writeIndex)) % maxWriteIdx);
-    if (clientIndex != CI_STREAM_CLIENT_RECORD)
+    /* Frame may be overwritten by writer while reading, hence retry once after resync */
+    for (retryCnt = 0; retryCnt < 2; retryCnt++)
     {
-        if(framesInBuff > (UINT32)pStreamInfo->gopTotal)
+        if (resyncF == TRUE)
         {
-            if(writeIndex > readIndex)
-            {
-                if((lastIframe > readIndex) && (lastIframe < writeIndex))
-                {
-                    updateRdIdx = TRUE;
-                }
-            }
-            else if(writeIndex < readIndex)
+            /* Start from last received i-frame */
+            resyncF = FALSE;
+            if (FAIL == getLastIframeReadPos(pStreamInfo, &iFrameIndex, &iFrameSeq))
             {
-                if(!((lastIframe < readIndex) && (lastIframe > writeIndex)))
-                {
-                    updateRdIdx = TRUE;
-                }
+                return 0;
             }
 
-            if(updateRdIdx == TRUE)
+            pReader->rdPos = iFrameIndex;
+            pReader->rdSeq = iFrameSeq;
+        }
+
+        readSeq = pReader->rdSeq;
+        if ((INT32)(writeSeq - readSeq) <= 0)
+        {
+            return 0;
+        }
+
+        framesInBuff = (writeSeq - readSeq);
+        readIndex = pReader->rdPos;
+        if (readIndex >= MAX_FRAME_IN_BUFFER)
+        {
+            readIndex = 0;
+        }
+
+        /* Next frame is at start of buffer if buffer was rolled back after read position */
+        if ((__atomic_load_n(&frameMarkPtr->frameInfo[readIndex].frameSeq, __ATOMIC_ACQUIRE) != readSeq)
+                && (__atomic_load_n(&frameMarkPtr->frameInfo[0].frameSeq, __ATOMIC_ACQUIRE) == readSeq))
+        {
+            readIndex = 0;
+        }
+
+        /* Skip to last i-frame if client is lagging more than a gop */
+        if ((clientIndex != CI_STREAM_CLIENT_RECORD) && (framesInBuff > (UINT32)pStreamInfo->gopTotal)
+                && (SUCCESS == getLastIframeReadPos(pStreamInfo, &iFrameIndex, &iFrameSeq)) && ((INT32)(iFrameSeq - readSeq) > 0)
+                && ((INT32)(writeSeq - iFrameSeq) > 0))
+        {
+            readIndex = iFrameIndex;
+            readSeq = iFrameSeq;
+            framesInBuff = (writeSeq - readSeq);
+        }
+
+        pFrameInfo = &frameMarkPtr->frameInfo[readIndex];
+        if (__atomic_load_n(&pFrameInfo->frameSeq, __ATOMIC_ACQUIRE) == readSeq)
+        {
+            *streamData = pFrameInfo->framePtr;
+            *streamStatusInfo =	&pFrameInfo->streamStatusInfo;
+            *streamDataLen = pFrameInfo->frameLen;
+            dataPos = pFrameInfo->dataPos;
+
+            if (TRUE == isFrameIntact(pStreamInfo, readIndex, readSeq, dataPos))
             {
-                readIndex = lastIframe;
-                framesInBuff = (UINT32)((maxWriteIdx - (readIndex - writeIndex)) % maxWriteIdx);
+                pReader->rdPos = (readIndex + 1);
+                pReader->rdSeq = NEXT_FRAME_SEQ(readSeq);
+                pReader->pinPos = readIndex;
+                pReader->pinSeq = readSeq;
+                pReader->pinDataPos = dataPos;
+                return framesInBuff;
             }
         }
+
+        /* Writer has overwritten the frame before it was read */
+        if (firstIframeSent == TRUE)
+        {
+            DPRINT(CAMERA_INTERFACE, "frame overrun, resume from last i-frame: [camera=%d], [client=%d], [pending=%d]",
+                   cameraIndex, clientIndex, framesInBuff);
+        }
+
+        resyncF = TRUE;
+        firstIframeSent = FALSE;
+    }
+
+    return 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This API is used to release the frame pinned by last GetNextFrame or GetNextFrameForLive.
+ *          Frame is not copied on read, hence writer may overwrite it while client is using it.
+ *          Client must discard the frame if it was overwritten.
+ * @param   cameraIndex
+ * @param   clientIndex
+ * @return  SUCCESS if frame was intact till now else FAIL
+ */
+BOOL UnpinFrame(UINT16 cameraIndex, UINT8 clientIndex)
+{
+    STREAM_INFO_t   *pStreamInfo;
+    BUFFER_READER_t *pReader;
+    BOOL            frameIntact;
+    UINT64          wrMarker;
+
+    if ((GET_STREAM_INDEX(cameraIndex) >= getMaxCameraForCurrentVariant()) || (clientIndex >= MAX_CI_STREAM_CLIENT))
+    {
+        return FAIL;
     }
 
-    *streamData = frameMarkPtr->frameInfo[readIndex].framePtr;
-    *streamStatusInfo =	&frameMarkPtr->frameInfo[readIndex].streamStatusInfo;
-    *streamDataLen = frameMarkPtr->frameInfo[readIndex].frameLen;
+    pStreamInfo = &streamInfo[GET_STREAM_INDEX(cameraIndex)][GET_STREAM_TYPE(cameraIndex)];
+    pReader = &pStreamInfo->frameMarker.reader[clientIndex];
+    if (pReader->pinSeq == FRAME_SEQ_INVALID)
+    {
+        return FAIL;
+    }
+
+    frameIntact = isFrameIntact(pStreamInfo, pReader->pinPos, pReader->pinSeq, pReader->pinDataPos);
+    pReader->pinSeq = FRAME_SEQ_INVALID;
+    if (FALSE == frameIntact)
+    {
+        /* Frames after this one were also overwritten, resume from last i-frame on next read */
+        wrMarker = __atomic_load_n(&pStreamInfo->frameMarker.wrMarker, __ATOMIC_ACQUIRE);
+        pReader->rdSeq = GET_WRITE_MARKER_SEQ(wrMarker);
+        pReader->rdPos = GET_WRITE_MARKER_POS(wrMarker);
+        return FAIL;
+    }
 
-    frameMarkPtr->rdPos[clientIndex] = (readIndex + 1);
-    return framesInBuff;
+    return SUCCESS;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -6181,9 +6464,14 @@ UINT32 GetNextFrameForLive(UINT16 cameraIndex, UINT8 clientIndex, STREAM_STATUS_
  */
 NET_CMD_STATUS_e GetImage(UINT8 cameraIndex, CHARPTR resolutionStr, IMAGE_REQUEST_CB callback, CLIENT_CB_TYPE_e clientCbType)
 {
-    NET_CMD_STATUS_e 	requestStatus = CMD_SUCCESS;
-    CAMERA_CONFIG_t 	camCfg;
-    IP_CAMERA_CONFIG_t 	ipCamCfg;
+    NET_CMD_STATUS_e 	    requestStatus = CMD_SUCCESS;
+    CAMERA_CONFIG_t 	    camCfg;
+    IP_CAMERA_CONFIG_t 	    ipCamCfg;
+    UINT8                   waiterIdx, waiterCnt;
+    GET_IMAGE_WAITER_t      waiter[GET_IMAGE_WAITER_MAX];
+    GET_IMAGE_CACHE_t       *pImageCache;
+    CHARPTR                 pCacheImage;
+    UINT32                  cacheImageSize;
 
     if (cameraIndex >= getMaxCameraForCurrentVariant())
     {
@@ -6199,21 +6487,49 @@ NET_CMD_STATUS_e GetImage(UINT8 cameraIndex, CHARPTR resolutionStr, IMAGE_REQUES
         return CMD_CHANNEL_DISABLED;
     }
 
-    // Only one request will be served at a time. hence if request is busy give failure
+    pImageCache = &getImageCache[cameraIndex];
+
+    /* Give recently received image of camera without asking camera again. Callers set up their request
+     * information before this function, so callback is given here without cache lock */
+    pCacheImage = getFreshImageFromCache(cameraIndex, &cacheImageSize);
+    if (pCacheImage != NULL)
+    {
+        DPRINT(CAMERA_INTERFACE, "image request served from cache: [camera=%d]", cameraIndex);
+        callback(cameraIndex, CMD_SUCCESS, pCacheImage, cacheImageSize, clientCbType);
+        free(pCacheImage);
+        return CMD_SUCCESS;
+    }
+
+    // Only one request will be sent to camera at a time. Other requests wait for its response
     MUTEX_LOCK(getImageRequest[cameraIndex].camReqFlagLock);
     if (getImageRequest[cameraIndex].camReqBusyF == BUSY)
     {
+        /* Response is already given or too many requests are waiting */
+        if ((pImageCache->respGivenF == TRUE) || (pImageCache->waiterCnt >= GET_IMAGE_WAITER_MAX))
+        {
+            MUTEX_UNLOCK(getImageRequest[cameraIndex].camReqFlagLock);
+            EPRINT(CAMERA_INTERFACE, "get image request is busy: [camera=%d]", cameraIndex);
+            return CMD_CAM_REQUEST_IN_PROCESS;
+        }
+
+        pImageCache->waiter[pImageCache->waiterCnt].callback = callback;
+        pImageCache->waiter[pImageCache->waiterCnt].clientCbType = clientCbType;
+        pImageCache->waiterCnt++;
         MUTEX_UNLOCK(getImageRequest[cameraIndex].camReqFlagLock);
-        EPRINT(CAMERA_INTERFACE, "get image request is busy: [camera=%d]", cameraIndex);
-        return CMD_CAM_REQUEST_IN_PROCESS;
+        DPRINT(CAMERA_INTERFACE, "image request joined with request in progress: [camera=%d]", cameraIndex);
+        return CMD_SUCCESS;
     }
 
     // If request is free, reset the flag
     getImageRequest[cameraIndex].camReqBusyF = BUSY;
+    pImageCache->respGivenF = FALSE;
+    pImageCache->waiter[0].callback = callback;
+    pImageCache->waiter[0].clientCbType = clientCbType;
+    pImageCache->waiterCnt = 1;
     MUTEX_UNLOCK(getImageRequest[cameraIndex].camReqFlagLock);
 
     DPRINT(CAMERA_INTERFACE, "image request received: [camera=%d]", cameraIndex);
-    getImageRequest[cameraIndex].clientCb[ON] = callback;
+    getImageRequest[cameraIndex].clientCb[ON] = getImageRespCb;
     getImageRequest[cameraIndex].clientCbType = clientCbType;
 
     /* Read ip camera config */
@@ -6271,14 +6587,117 @@ NET_CMD_STATUS_e GetImage(UINT8 cameraIndex, CHARPTR resolutionStr, IMAGE_REQUES
 
     if (requestStatus != CMD_SUCCESS)
     {
+        /* Caller gets failure in return but requests joined in between need callback */
         MUTEX_LOCK(getImageRequest[cameraIndex].camReqFlagLock);
+        waiterCnt = pImageCache->waiterCnt;
+        memcpy(waiter, pImageCache->waiter, sizeof(waiter));
+        pImageCache->waiterCnt = 0;
+        pImageCache->respGivenF = TRUE;
         getImageRequest[cameraIndex].camReqBusyF = FREE;
         MUTEX_UNLOCK(getImageRequest[cameraIndex].camReqFlagLock);
+
+        for (waiterIdx = 1; waiterIdx < waiterCnt; waiterIdx++)
+        {
+            waiter[waiterIdx].callback(cameraIndex, requestStatus, NULL, 0, waiter[waiterIdx].clientCbType);
+        }
     }
 
     return requestStatus;
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Response of image request sent to camera. Image is stored in cache of camera and given
+ *          to all requests which were waiting for it.
+ * @param   cameraIndex
+ * @param   status
+ * @param   imageBuff
+ * @param   imageSize
+ * @param   clientCbType
+ */
+static void getImageRespCb(UINT8 cameraIndex, NET_CMD_STATUS_e status, CHARPTR imageBuff, UINT32 imageSize, CLIENT_CB_TYPE_e clientCbType)
+{
+    UINT8               waiterIdx, waiterCnt;
+    GET_IMAGE_WAITER_t  waiter[GET_IMAGE_WAITER_MAX];
+    GET_IMAGE_CACHE_t   *pImageCache = &getImageCache[cameraIndex];
+
+    MUTEX_LOCK(getImageRequest[cameraIndex].camReqFlagLock);
+    if ((status == CMD_SUCCESS) && (imageBuff != NULL) && (imageSize > 0) && (imageSize <= IMAGE_CACHE_SIZE_MAX))
+    {
+        /* Reuse cache buffer if image fits in it */
+        if (pImageCache->imageBuffSize < imageSize)
+        {
+            FREE_MEMORY(pImageCache->pImageBuff);
+            pImageCache->imageBuffSize = 0;
+            pImageCache->pImageBuff = malloc(imageSize);
+            if (pImageCache->pImageBuff != NULL)
+            {
+                pImageCache->imageBuffSize = imageSize;
+            }
+        }
+
+        if (pImageCache->pImageBuff != NULL)
+        {
+            memcpy(pImageCache->pImageBuff, imageBuff, imageSize);
+            pImageCache->imageSize = imageSize;
+            pImageCache->imageTick = GetSysTick();
+        }
+    }
+
+    /* Requests received after this are served from cache */
+    waiterCnt = pImageCache->waiterCnt;
+    memcpy(waiter, pImageCache->waiter, sizeof(waiter));
+    pImageCache->waiterCnt = 0;
+    pImageCache->respGivenF = TRUE;
+    MUTEX_UNLOCK(getImageRequest[cameraIndex].camReqFlagLock);
+
+    for (waiterIdx = 0; waiterIdx < waiterCnt; waiterIdx++)
+    {
+        waiter[waiterIdx].callback(cameraIndex, status, imageBuff, imageSize, waiter[waiterIdx].clientCbType);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Get copy of cached image of camera if it is received recently. Stale image is freed.
+ * @param   cameraIndex
+ * @param   pImageSize - Size of copied image
+ * @return  Copy of image (caller has to free it) if fresh image is available otherwise NULL
+ */
+static CHARPTR getFreshImageFromCache(UINT8 cameraIndex, UINT32PTR pImageSize)
+{
+    GET_IMAGE_CACHE_t   *pImageCache = &getImageCache[cameraIndex];
+    CHARPTR             pImageBuff;
+
+    MUTEX_LOCK(getImageRequest[cameraIndex].camReqFlagLock);
+    if (pImageCache->imageSize == 0)
+    {
+        MUTEX_UNLOCK(getImageRequest[cameraIndex].camReqFlagLock);
+        return NULL;
+    }
+
+    if (ElapsedTick(pImageCache->imageTick) >= CONVERT_SEC_TO_TIMER_COUNT(IMAGE_CACHE_FRESH_TIME))
+    {
+        /* Do not hold memory for old image */
+        FREE_MEMORY(pImageCache->pImageBuff);
+        pImageCache->imageBuffSize = 0;
+        pImageCache->imageSize = 0;
+        MUTEX_UNLOCK(getImageRequest[cameraIndex].camReqFlagLock);
+        return NULL;
+    }
+
+    /* Image is copied to keep it valid even if cache is updated while callback uses it */
+    pImageBuff = malloc(pImageCache->imageSize);
+    if (pImageBuff != NULL)
+    {
+        memcpy(pImageBuff, pImageCache->pImageBuff, pImageCache->imageSize);
+        *pImageSize = pImageCache->imageSize;
+    }
+    MUTEX_UNLOCK(getImageRequest[cameraIndex].camReqFlagLock);
+
+    return pImageBuff;
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   call back to the snapshot request of an ONVIF camera. It will handle the response and
@@ -172,6 +172,8 @@ UINT32 GetNextFrame(UINT16 cameraIndex, UINT8 clientIndex, STREAM_STATUS_INFO_t
 UINT32 GetNextFrameForLive(UINT16 cameraIndex, UINT8 clientIndex, STREAM_STATUS_INFO_t **streamStatusInfo,
                            UINT8PTR *streamBuffPtr, UINT32PTR streamDataLen,BOOL firstIframeSent);
 //-------------------------------------------------------------------------------------------------
+BOOL UnpinFrame(UINT16 cameraIndex, UINT8 clientIndex);
+//-------------------------------------------------------------------------------------------------
 void CiCameraConfigNotify(CAMERA_CONFIG_t newCameraConfig, CAMERA_CONFIG_t *oldCameraConfig, UINT8 cameraIndex);
 //-------------------------------------------------------------------------------------------------
 void CiIpCameraConfigNotify(IP_CAMERA_CONFIG_t newIpCfg, IP_CAMERA_CONFIG_t *oldIpCfg, UINT8 cameraIndex);
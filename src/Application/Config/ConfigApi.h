@@ -208,6 +208,9 @@ extern void StorageAllocationConfigNotify(STORAGE_ALLOCATION_CONFIG_t newCopy, S
 #define FCM_PUSH_NOTIFY_CONFIG_CHANGE(NEW_COPY, OLD_COPY)                           {FcmPushNotifyConfigUpdate(NEW_COPY, OLD_COPY);}
 #define STORAGE_ALLOCATION_CONFIG_CHANGE(NEW_COPY, OLD_COPY)                        {StorageAllocationConfigNotify(NEW_COPY, OLD_COPY);}
 
+/* Initial value of caller's cached config version, it never matches with actual config version */
+#define CONFIG_VERSION_INVALID                                                      0
+
 //#################################################################################################
 // @DATA TYPES
 //#################################################################################################
@@ -234,6 +237,14 @@ BOOL RemoveConfigFile(CONFIG_INDEX_e cfgIndex);
 //-------------------------------------------------------------------------------------------------
 BOOL RemoveLocalConfigFile(LOCAL_CONFIG_INDEX_e cfgIndex);
 //-------------------------------------------------------------------------------------------------
+UINT32 GetConfigVersion(CONFIG_INDEX_e cfgIndex);
+//-------------------------------------------------------------------------------------------------
+void BeginConfigJournalBatch(void);
+//-------------------------------------------------------------------------------------------------
+BOOL EndConfigJournalBatch(void);
+//-------------------------------------------------------------------------------------------------
+BOOL FlushConfigJournal(void);
+//-------------------------------------------------------------------------------------------------
 
 /** ******************************************************************************************* **/
 /**                                  Config Default APIs                                        **/
@@ -714,6 +725,19 @@ BOOL ReadSingleFcmPushNotificationConfig(UINT8 deviceIndex, FCM_PUSH_NOTIFY_CONF
 //-------------------------------------------------------------------------------------------------
 BOOL ReadSinglePasswordRecoveryConfig(UINT8 userIndex, PASSWORD_RECOVERY_CONFIG_t *userCopy);
 //-------------------------------------------------------------------------------------------------
+
+/** ******************************************************************************************* **/
+/**           Config Read If Changed APIs (for periodic readers, copy only on change)           **/
+/** ******************************************************************************************* **/
+//-------------------------------------------------------------------------------------------------
+BOOL ReadGeneralConfigIfChanged(GENERAL_CONFIG_t *userCopy, UINT32PTR pVersion);
+//-------------------------------------------------------------------------------------------------
+BOOL ReadHddConfigIfChanged(HDD_CONFIG_t *userCopy, UINT32PTR pVersion);
+//-------------------------------------------------------------------------------------------------
+BOOL ReadCameraConfigIfChanged(CAMERA_CONFIG_t *userCopy, UINT32PTR pVersion);
+//-------------------------------------------------------------------------------------------------
+BOOL ReadIpCameraConfigIfChanged(IP_CAMERA_CONFIG_t *userCopy, UINT32PTR pVersion);
+//-------------------------------------------------------------------------------------------------
 //#################################################################################################
 // @END OF FILE
 //#################################################################################################
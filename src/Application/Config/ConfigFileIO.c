@@ -26,7 +26,9 @@
         and file with the content of user copy. WriteSingleXXXConfig function receives a user copy and
         index of the element to be edited. Element specified by index is updated in master copy and in
         the file with content of user copy. readXXXConfig function outputs the values of master copy to
-        the user copy.
+        the user copy. After system init, updates are appended in config journal and synced once per
+        commit (single update or batch of updates); committed updates are compacted into configuration
+        files in background and applied at next start-up if system goes down before compaction.
 */
 //#################################################################################################
 // @INCLUDES
@@ -34,6 +36,7 @@
 /* OS Includes */
 #include <stdarg.h>
 #include <stdint.h>
+#include <sys/uio.h>
 
 /* Application Includes */
 #include "DebugLog.h"
@@ -49,6 +52,19 @@
 //#################################################################################################
 #define CONFIG_FILE_EXT ".cfg"
 
+/* Config journal record identification and commit record id */
+#define CONFIG_JOURNAL_MAGIC            0x4A47464E  // "NFGJ"
+#define CONFIG_JOURNAL_COMMIT_ID        0xFFFF
+#define CONFIG_JOURNAL_CHECKSUM_INIT    2166136261U
+#define CONFIG_JOURNAL_CHECKSUM_PRIME   16777619U
+
+/* Journal is compacted into config files when it grows beyond this size or remains idle for given time */
+#define CONFIG_JOURNAL_COMPACT_SIZE     (256 * KILO_BYTE)
+#define CONFIG_JOURNAL_IDLE_TIME_SEC    30
+#define CONFIG_JOURNAL_CHECK_TIME_SEC   5
+#define CONFIG_JOURNAL_RECOVER_RETRY    3
+#define CONFIG_JOURNAL_THREAD_STACK_SZ  (1 * MEGA_BYTE)
+
 //#################################################################################################
 // @DATA TYPES
 //#################################################################################################
@@ -78,6 +94,36 @@ typedef struct
 
 }CONFIG_PARAM_t;
 
+typedef struct
+{
+    UINT32              magic;
+    UINT32              batchSeq;
+    UINT16              configId;   // CONFIG_JOURNAL_COMMIT_ID for commit record
+    UINT16              reserved;
+    UINT32              version;    // Config version at the time of write
+    UINT32              offset;     // Data offset in config (excluding file version)
+    UINT32              size;       // Size of data which follows the record header
+    UINT32              checksum;   // Checksum of record header (with zero checksum) and data
+
+}CONFIG_JOURNAL_REC_t;
+
+typedef struct
+{
+    pthread_mutex_t     lock;
+    pthread_cond_t      signal;
+    INT32               fd;
+    UINT32              fileSize;   // Size of journal records written so far
+    UINT32              commitSize; // Size of journal up to last commit record
+    UINT32              batchSeq;
+    UINT32              batchDepth; // Batches in progress of all threads
+    UINT32              commitFailCnt;
+    UINT64              lastWriteTime;
+    BOOL                restorePendingF;
+    BOOL                uncommittedF[MAX_CONFIG_ID];    // Config has records after last commit record
+    BOOL                restoreF[MAX_CONFIG_ID];        // Records of config dropped by failed commit, master copy to be written again
+
+}CONFIG_JOURNAL_t;
+
 //#################################################################################################
 // @FUNCTION PROTOTYPE
 //#################################################################################################
@@ -96,6 +142,8 @@ static NET_CMD_STATUS_e dfltXXXConfig(UINT8 configId, ...);
 //-------------------------------------------------------------------------------------------------
 static BOOL readXXXConfig(UINT8 configId, VOIDPTR userCopy, ...);
 //-------------------------------------------------------------------------------------------------
+static BOOL readXXXConfigIfChanged(UINT8 configId, VOIDPTR userCopy, UINT32PTR pVersion);
+//-------------------------------------------------------------------------------------------------
 static NET_CMD_STATUS_e writeXXXConfig(UINT8 configId, VOIDPTR userCopy, ...);
 //-------------------------------------------------------------------------------------------------
 static BOOL dfltXXXConfigInternal(UINT8 configId, BOOL systemInit, UINT8 query, UINT8 xIndex, UINT8 yIndex);
@@ -126,6 +174,32 @@ static NET_CMD_STATUS_e validateXXXConfigInternal(UINT8 configId, VOIDPTR newCop
 //-------------------------------------------------------------------------------------------------
 static void notifyXXXConfigInternal(UINT8 configId, VOIDPTR newCopy, VOIDPTR oldCopy,UINT8 xIndex, UINT8 yIndex);
 //-------------------------------------------------------------------------------------------------
+static BOOL writeConfigData(UINT8 configId, VOIDPTR data, UINT32 offset, UINT32 size);
+//-------------------------------------------------------------------------------------------------
+static BOOL writeConfigFile(UINT8 configId, VOIDPTR data, UINT32 offset, UINT32 size);
+//-------------------------------------------------------------------------------------------------
+static UINT32 calcConfigJournalChecksum(UINT32 checksum, const UINT8 *data, UINT32 size);
+//-------------------------------------------------------------------------------------------------
+static BOOL appendConfigJournalRec(UINT16 configId, VOIDPTR data, UINT32 offset, UINT32 size);
+//-------------------------------------------------------------------------------------------------
+static BOOL commitConfigJournal(void);
+//-------------------------------------------------------------------------------------------------
+static BOOL restoreDroppedConfigs(void);
+//-------------------------------------------------------------------------------------------------
+static BOOL applyConfigJournal(UINT8PTR journalBuf, UINT32 journalSize, BOOL masterCopyF, UINT32PTR pCommitSize);
+//-------------------------------------------------------------------------------------------------
+static UINT8PTR readConfigJournal(void);
+//-------------------------------------------------------------------------------------------------
+static BOOL compactConfigJournal(void);
+//-------------------------------------------------------------------------------------------------
+static void recoverConfigJournal(void);
+//-------------------------------------------------------------------------------------------------
+static void replayConfigJournal(void);
+//-------------------------------------------------------------------------------------------------
+static void startConfigJournal(void);
+//-------------------------------------------------------------------------------------------------
+static VOIDPTR configJournalThread(VOIDPTR arg);
+//-------------------------------------------------------------------------------------------------
 //#################################################################################################
 // @GLOBAL VARIABLE
 //#################################################################################################
@@ -189,6 +263,30 @@ STORAGE_ALLOCATION_CONFIG_t     storageAllocationCfg;
 // Configuration Protection Lock for all Configuration
 static pthread_rwlock_t 		rwLock[MAX_CONFIG_ID];
 
+// Version of master copy, incremented on every update of master copy. Read without lock by periodic readers
+static UINT32                   configVersion[MAX_CONFIG_ID];
+
+// Write ahead journal of configuration updates. It is disabled (invalid fd) until all configurations are initialised
+static CONFIG_JOURNAL_t         configJournal =
+{
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .signal = PTHREAD_COND_INITIALIZER,
+    .fd = INVALID_FILE_FD,
+};
+
+// Master copies of dropped journal records are written again one at a time, so a writer sees result of earlier restore
+static pthread_mutex_t          configRestoreLock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Journal which could not be compacted at start-up is kept and replayed in master copies of configs whose files were of
+ * current version, same as compaction would have updated them */
+static BOOL                     replayJournalF = FALSE;
+static BOOL                     replayConfigF[MAX_CONFIG_ID];
+
+/* Batch of calling thread. Updates of thread which is not in batch are committed before write is acknowledged, and
+ * batch fails if any commit has failed during it as failed commit drops all uncommitted records */
+static __thread UINT32          threadBatchDepth = 0;
+static __thread UINT32          threadBatchFailCnt = 0;
+
 static CONFIG_PARAM_t configParam[MAX_CONFIG_ID] =
 {
     // 1 - fileName;
@@ -814,12 +912,21 @@ void InitSysConfig(void)
     /* This should be not modify to any other place */
     DfltGeneralCfg.ipCamNo = getMaxCameraForCurrentVariant();
 
+    /* Apply committed updates of config journal into config files before reading them */
+    recoverConfigJournal();
+
     /* Initialise all configuration */
     for(configId = 0; configId < MAX_CONFIG_ID; configId++)
 	{
         initXXXConfig(configId);
     }
 
+    /* Committed updates which could not be applied in config files are applied in master copies */
+    replayConfigJournal();
+
+    /* All configurations are loaded, now onwards updates will be written into config journal */
+    startConfigJournal();
+
     /* Check if need to default camera configuration */
     for (cameraIndex = 0; cameraIndex < getMaxCameraForCurrentVariant(); cameraIndex++)
     {
@@ -967,6 +1074,125 @@ BOOL RemoveLocalConfigFile(LOCAL_CONFIG_INDEX_e cfgIndex)
     return SUCCESS;
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function gives current version of configuration master copy. Version is changed on
+ *          every update of configuration, hence periodic reader can check change without lock.
+ * @param   cfgIndex
+ * @return  Config version
+ */
+UINT32 GetConfigVersion(CONFIG_INDEX_e cfgIndex)
+{
+    if (cfgIndex >= MAX_CONFIG_ID)
+    {
+        return CONFIG_VERSION_INVALID;
+    }
+
+    return __atomic_load_n(&configVersion[cfgIndex], __ATOMIC_ACQUIRE);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function starts batch of configuration updates. All updates till the end of batch
+ *          of calling thread are committed in config journal with single flash sync. Batches can be
+ *          nested. Updates of other threads are still committed before they are acknowledged.
+ */
+void BeginConfigJournalBatch(void)
+{
+    MUTEX_LOCK(configJournal.lock);
+    configJournal.batchDepth++;
+    if (threadBatchDepth++ == 0)
+    {
+        threadBatchFailCnt = configJournal.commitFailCnt;
+    }
+    MUTEX_UNLOCK(configJournal.lock);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function ends batch of configuration updates and commits it in config journal. Failed
+ *          commit drops all updates of the batch while master copies are already updated, hence master
+ *          copies of dropped configs are written again. If that also fails, caller must report failure
+ *          of the whole batch.
+ * @return  SUCCESS/FAIL
+ */
+BOOL EndConfigJournalBatch(void)
+{
+    BOOL status = SUCCESS;
+
+    MUTEX_LOCK(configJournal.lock);
+    if (threadBatchDepth == 0)
+    {
+        MUTEX_UNLOCK(configJournal.lock);
+        EPRINT(CONFIGURATION, "config journal batch not started");
+        return FAIL;
+    }
+
+    configJournal.batchDepth--;
+    if (--threadBatchDepth != 0)
+    {
+        MUTEX_UNLOCK(configJournal.lock);
+        return SUCCESS;
+    }
+
+    if ((configJournal.fd != INVALID_FILE_FD) && (configJournal.fileSize > configJournal.commitSize))
+    {
+        commitConfigJournal();
+        if (configJournal.commitSize >= CONFIG_JOURNAL_COMPACT_SIZE)
+        {
+            pthread_cond_signal(&configJournal.signal);
+        }
+    }
+
+    /* Records of this batch are dropped if any commit has failed since batch started */
+    if (threadBatchFailCnt == configJournal.commitFailCnt)
+    {
+        MUTEX_UNLOCK(configJournal.lock);
+        return SUCCESS;
+    }
+
+    EPRINT(CONFIGURATION, "config journal batch dropped: [failedCommits=%d]", (configJournal.commitFailCnt - threadBatchFailCnt));
+    MUTEX_UNLOCK(configJournal.lock);
+
+    /* Write master copies of dropped configs again, otherwise they are reverted at next start-up */
+    status = restoreDroppedConfigs();
+    if (status == SUCCESS)
+    {
+        WPRINT(CONFIGURATION, "config journal batch written again from master copies");
+    }
+    return status;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function compacts all committed updates of config journal into config files. It must
+ *          be called before config files are accessed directly, e.g. config backup and shutdown.
+ * @return  SUCCESS/FAIL
+ */
+BOOL FlushConfigJournal(void)
+{
+    BOOL status;
+    BOOL restoreStatus = SUCCESS;
+
+    /* Config files must also get master copies of configs dropped by failed commit */
+    if (threadBatchDepth == 0)
+    {
+        restoreStatus = restoreDroppedConfigs();
+    }
+
+    MUTEX_LOCK(configJournal.lock);
+    if (configJournal.batchDepth != 0)
+    {
+        MUTEX_UNLOCK(configJournal.lock);
+        EPRINT(CONFIGURATION, "config journal batch in progress: [depth=%d]", configJournal.batchDepth);
+        return FAIL;
+    }
+
+    status = compactConfigJournal();
+    MUTEX_UNLOCK(configJournal.lock);
+    return ((status == SUCCESS) && (restoreStatus == SUCCESS)) ? SUCCESS : FAIL;
+}
+
 /** ******************************************************************************************* **/
 /**                                  Config Default APIs                                        **/
 /** ******************************************************************************************* **/
@@ -1250,6 +1476,12 @@ BOOL ReadSingleImageSettingConfig(UINT8 cameraIndex, IMG_SETTING_CONFIG_t *userC
 BOOL ReadSingleFcmPushNotificationConfig(UINT8 deviceIndex, FCM_PUSH_NOTIFY_CONFIG_t *userCopy)         {return readXXXConfig(FCM_PUSH_NOTIFICATION_CONFIG_ID, userCopy, SINGLE_ENTRY, deviceIndex);}
 BOOL ReadSinglePasswordRecoveryConfig(UINT8 userIndex, PASSWORD_RECOVERY_CONFIG_t *userCopy)            {return readXXXConfig(PASSWORD_RECOVERY_CONFIG_ID, userCopy, SINGLE_ENTRY, userIndex);}
 
+/* Read If Changed APIs: User copy is updated only if master copy is changed after version in pVersion */
+BOOL ReadGeneralConfigIfChanged(GENERAL_CONFIG_t *userCopy, UINT32PTR pVersion)         {return readXXXConfigIfChanged(GENERAL_CONFIG_ID, userCopy, pVersion);}
+BOOL ReadHddConfigIfChanged(HDD_CONFIG_t *userCopy, UINT32PTR pVersion)                 {return readXXXConfigIfChanged(HDD_CONFIG_ID, userCopy, pVersion);}
+BOOL ReadCameraConfigIfChanged(CAMERA_CONFIG_t *userCopy, UINT32PTR pVersion)           {return readXXXConfigIfChanged(CAMERA_CONFIG_ID, userCopy, pVersion);}
+BOOL ReadIpCameraConfigIfChanged(IP_CAMERA_CONFIG_t *userCopy, UINT32PTR pVersion)      {return readXXXConfigIfChanged(IP_CAMERA_CONFIG_ID, userCopy, pVersion);}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   This API loads user copy with the content of the master copy. master copy is protected
@@ -1358,6 +1590,7 @@ static BOOL initXXXConfig(UINT8 configId)
 
     /* Init config file read-write lock */
 	pthread_rwlock_init(&rwLock[configId], NULL);
+    configVersion[configId] = CONFIG_VERSION_INVALID + 1;
 
     /* Get config file size and offset */
     getConfigOffsetAndSize(configId, WHOLE_CONFIG, 0, 0, &offset, &configSize);
@@ -2093,6 +2326,46 @@ static BOOL readXXXConfig(UINT8 configId, VOIDPTR userCopy, ...)
     return SUCCESS;
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function gives whole configuration copy only if master copy is changed after the
+ *          version known to caller. Version check is lock free, hence periodic readers don't pay
+ *          for lock and copy when configuration is not changed.
+ * @param   configId
+ * @param   userCopy
+ * @param   pVersion - Version of user copy, updated with version of master copy on copy
+ * @return  TRUE if user copy updated else FALSE
+ */
+static BOOL readXXXConfigIfChanged(UINT8 configId, VOIDPTR userCopy, UINT32PTR pVersion)
+{
+    UINT32  configSize;
+    UINT32  offset;
+
+    if ((userCopy == NULL) || (pVersion == NULL) || (getConfigOffsetAndSize(configId, WHOLE_CONFIG, 0, 0, &offset, &configSize) == FAIL))
+    {
+        EPRINT(CONFIGURATION, "invld input parameter: [configId=%d]", configId);
+        return FALSE;
+    }
+
+    /* Nothing to do if user copy is already latest */
+    if (__atomic_load_n(&configVersion[configId], __ATOMIC_ACQUIRE) == *pVersion)
+    {
+        return FALSE;
+    }
+
+    // LOCK READ access to master copy
+    pthread_rwlock_rdlock(&rwLock[configId]);
+
+    // Update user copy and its version with content of master copy
+    memcpy(userCopy, ((sysConfigParam + configId)->memPtr + offset), configSize);
+    *pVersion = configVersion[configId];
+
+    // UNLOCK READ access to master copy
+    pthread_rwlock_unlock(&rwLock[configId]);
+
+    return TRUE;
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   This function writes the requested configuration.
@@ -2279,9 +2552,7 @@ static NET_CMD_STATUS_e	writeXXXConfigInternal(UINT8 configId, BOOL systemInit,
 {
 	UINT32				configSize;
 	UINT32				offset;
-	INT32 				fd;
     VOIDPTR				oldCopy = NULL;
-	CHAR				filePath[100];
     NET_CMD_STATUS_e	retVal = CMD_PROCESS_ERROR;
     BOOL				notifyModule = FALSE;
 
@@ -2327,41 +2598,27 @@ static NET_CMD_STATUS_e	writeXXXConfigInternal(UINT8 configId, BOOL systemInit,
         {
             retVal = CMD_PROCESS_ERROR;
 
-            snprintf(filePath, sizeof(filePath), APP_CONFIG_DIR_PATH "/%s" CONFIG_FILE_EXT, (sysConfigParam + configId)->fileName);
-
-            // IF failed to open file in read / write mode
-            if ((fd = open(filePath, READ_WRITE_SYNC_MODE)) == INVALID_FILE_FD)
+            // IF failed to write indexed master copy to config journal or file
+            if (writeConfigData(configId, userCopy, offset, configSize) == SUCCESS)
             {
-                EPRINT(CONFIGURATION, "fail to open file: [file=%s], [err=%s]", (sysConfigParam + configId)->fileName, STR_ERR);
-            }
-            else
-            {
-                /* Skip config file version number size (4 bytes) */
-                lseek(fd, (4 + offset), SEEK_SET);
+                // Configuration Successfully written
+                retVal = CMD_SUCCESS;
 
-                // IF failed to write indexed master copy to file
-                if (write(fd, userCopy, configSize) != (INT32)configSize)
+                // In case of System Initialisation, don't notify other modules as they might not be initialised yet.
+                if (systemInit == FALSE)
                 {
-                    EPRINT(CONFIGURATION, "fail to write file: [file=%s], [err=%s]", (sysConfigParam + configId)->fileName, STR_ERR);
+                    // notify respective module
+                    notifyModule = TRUE;
                 }
-                else
-                {
-                    // Configuration Successfully written
-                    retVal = CMD_SUCCESS;
 
-                    // In case of System Initialisation, don't notify other modules as they might not be initialised yet.
-                    if (systemInit == FALSE)
-                    {
-                        // notify respective module
-                        notifyModule = TRUE;
-                    }
+                // Update master copy with the content of user copy
+                memcpy(((sysConfigParam + configId)->memPtr + offset), userCopy, configSize);
 
-                    // Update master copy with the content of user copy
-                    memcpy(((sysConfigParam + configId)->memPtr + offset), userCopy, configSize);
+                // Publish new version of master copy for periodic readers
+                if (__atomic_add_fetch(&configVersion[configId], 1, __ATOMIC_RELEASE) == CONFIG_VERSION_INVALID)
+                {
+                    __atomic_store_n(&configVersion[configId], CONFIG_VERSION_INVALID + 1, __ATOMIC_RELEASE);
                 }
-
-                // Close file
-                close(fd);
             }
         }
         else
@@ -2942,6 +3199,648 @@ static void notifyXXXConfigInternal(UINT8 configId,	VOIDPTR newCopy, VOIDPTR old
 	}
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function writes configuration data in config journal. If journal is not enabled yet
+ *          (system init) then data is written directly into the config file. Data is committed
+ *          immediately if calling thread is not in batch of updates.
+ * @param   configId
+ * @param   data
+ * @param   offset
+ * @param   size
+ * @return  SUCCESS/FAIL
+ */
+static BOOL writeConfigData(UINT8 configId, VOIDPTR data, UINT32 offset, UINT32 size)
+{
+    BOOL status;
+
+    MUTEX_LOCK(configJournal.lock);
+    if (configJournal.fd == INVALID_FILE_FD)
+    {
+        MUTEX_UNLOCK(configJournal.lock);
+        return writeConfigFile(configId, data, offset, size);
+    }
+
+    status = appendConfigJournalRec(configId, data, offset, size);
+    if ((status == SUCCESS) && (threadBatchDepth == 0))
+    {
+        status = commitConfigJournal();
+    }
+
+    configJournal.lastWriteTime = GetMonotonicTimeInSec();
+    if ((threadBatchDepth == 0) && (configJournal.commitSize >= CONFIG_JOURNAL_COMPACT_SIZE))
+    {
+        pthread_cond_signal(&configJournal.signal);
+    }
+    MUTEX_UNLOCK(configJournal.lock);
+    return status;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function writes configuration data directly into the config file
+ * @param   configId
+ * @param   data
+ * @param   offset
+ * @param   size
+ * @return  SUCCESS/FAIL
+ */
+static BOOL writeConfigFile(UINT8 configId, VOIDPTR data, UINT32 offset, UINT32 size)
+{
+    INT32   fd;
+    CHAR    filePath[100];
+
+    snprintf(filePath, sizeof(filePath), APP_CONFIG_DIR_PATH "/%s" CONFIG_FILE_EXT, (sysConfigParam + configId)->fileName);
+
+    // IF failed to open file in read / write mode
+    if ((fd = open(filePath, READ_WRITE_SYNC_MODE)) == INVALID_FILE_FD)
+    {
+        EPRINT(CONFIGURATION, "fail to open file: [file=%s], [err=%s]", (sysConfigParam + configId)->fileName, STR_ERR);
+        return FAIL;
+    }
+
+    /* Skip config file version number size (4 bytes) */
+    lseek(fd, (4 + offset), SEEK_SET);
+
+    // IF failed to write indexed master copy to file
+    if (write(fd, data, size) != (INT32)size)
+    {
+        EPRINT(CONFIGURATION, "fail to write file: [file=%s], [err=%s]", (sysConfigParam + configId)->fileName, STR_ERR);
+        close(fd);
+        return FAIL;
+    }
+
+    // Close file
+    close(fd);
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function calculates FNV-1a checksum of given data
+ * @param   checksum - Checksum of previous data or initial value
+ * @param   data
+ * @param   size
+ * @return  Updated checksum
+ */
+static UINT32 calcConfigJournalChecksum(UINT32 checksum, const UINT8 *data, UINT32 size)
+{
+    while (size--)
+    {
+        checksum ^= *data++;
+        checksum *= CONFIG_JOURNAL_CHECKSUM_PRIME;
+    }
+
+    return checksum;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function appends record in config journal. It must be called with journal lock.
+ * @param   configId - Config id or CONFIG_JOURNAL_COMMIT_ID for commit record
+ * @param   data
+ * @param   offset
+ * @param   size
+ * @return  SUCCESS/FAIL
+ */
+static BOOL appendConfigJournalRec(UINT16 configId, VOIDPTR data, UINT32 offset, UINT32 size)
+{
+    CONFIG_JOURNAL_REC_t    record;
+    struct iovec            iov[2];
+
+    memset(&record, 0, sizeof(record));
+    record.magic = CONFIG_JOURNAL_MAGIC;
+    record.batchSeq = configJournal.batchSeq;
+    record.configId = configId;
+    record.version = (configId < MAX_CONFIG_ID) ? (sysConfigParam + configId)->version : 0;
+    record.offset = offset;
+    record.size = size;
+    record.checksum = calcConfigJournalChecksum(CONFIG_JOURNAL_CHECKSUM_INIT, (UINT8PTR)&record, sizeof(record));
+    record.checksum = calcConfigJournalChecksum(record.checksum, data, size);
+
+    iov[0].iov_base = &record;
+    iov[0].iov_len = sizeof(record);
+    iov[1].iov_base = data;
+    iov[1].iov_len = size;
+
+    if (pwritev(configJournal.fd, iov, (size != 0) ? 2 : 1, configJournal.fileSize) != (ssize_t)(sizeof(record) + size))
+    {
+        EPRINT(CONFIGURATION, "fail to write config journal: [configId=%d], [err=%s]", configId, STR_ERR);
+
+        /* Drop partially written record */
+        if (ftruncate(configJournal.fd, configJournal.fileSize) != STATUS_OK)
+        {
+            EPRINT(CONFIGURATION, "fail to truncate config journal: [err=%s]", STR_ERR);
+        }
+        return FAIL;
+    }
+
+    configJournal.fileSize += (sizeof(record) + size);
+    if (configId < MAX_CONFIG_ID)
+    {
+        configJournal.uncommittedF[configId] = TRUE;
+    }
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function commits all records of current batch with single sync of config journal.
+ *          On failure whole batch is dropped and its configs are marked to write their master copies
+ *          again, as master copies are updated after records are appended. It must be called with
+ *          journal lock.
+ * @return  SUCCESS/FAIL
+ */
+static BOOL commitConfigJournal(void)
+{
+    UINT8 configId;
+
+    if ((appendConfigJournalRec(CONFIG_JOURNAL_COMMIT_ID, NULL, 0, 0) == FAIL) || (fdatasync(configJournal.fd) != STATUS_OK))
+    {
+        EPRINT(CONFIGURATION, "fail to commit config journal: [batchSeq=%d], [err=%s]", configJournal.batchSeq, STR_ERR);
+        configJournal.fileSize = configJournal.commitSize;
+        if (ftruncate(configJournal.fd, configJournal.commitSize) != STATUS_OK)
+        {
+            EPRINT(CONFIGURATION, "fail to truncate config journal: [err=%s]", STR_ERR);
+        }
+        configJournal.batchSeq++;
+        configJournal.commitFailCnt++;
+
+        for (configId = 0; configId < MAX_CONFIG_ID; configId++)
+        {
+            if (configJournal.uncommittedF[configId] == TRUE)
+            {
+                configJournal.uncommittedF[configId] = FALSE;
+                configJournal.restoreF[configId] = TRUE;
+                configJournal.restorePendingF = TRUE;
+            }
+        }
+
+        /* Journal thread writes them if no batch owner does it before */
+        pthread_cond_signal(&configJournal.signal);
+        return FAIL;
+    }
+
+    configJournal.commitSize = configJournal.fileSize;
+    configJournal.batchSeq++;
+    memset(configJournal.uncommittedF, FALSE, sizeof(configJournal.uncommittedF));
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function writes master copies of configs whose journal records were dropped by failed
+ *          commit. Writer of config holds its write lock till master copy is updated, so master copy
+ *          read under config lock has all updates of dropped records. It must be called without
+ *          journal lock and config lock, and outside batch of calling thread.
+ * @return  SUCCESS if all dropped configs are written, FAIL otherwise
+ */
+static BOOL restoreDroppedConfigs(void)
+{
+    BOOL    status = SUCCESS;
+    BOOL    restoreF[MAX_CONFIG_ID];
+    UINT8   configId;
+    UINT32  offset, configSize;
+
+    MUTEX_LOCK(configRestoreLock);
+    MUTEX_LOCK(configJournal.lock);
+    memcpy(restoreF, configJournal.restoreF, sizeof(restoreF));
+    memset(configJournal.restoreF, FALSE, sizeof(configJournal.restoreF));
+    configJournal.restorePendingF = FALSE;
+    MUTEX_UNLOCK(configJournal.lock);
+
+    for (configId = 0; configId < MAX_CONFIG_ID; configId++)
+    {
+        if (restoreF[configId] == FALSE)
+        {
+            continue;
+        }
+
+        getConfigOffsetAndSize(configId, WHOLE_CONFIG, 0, 0, &offset, &configSize);
+        pthread_rwlock_rdlock(&rwLock[configId]);
+        if (writeConfigData(configId, (sysConfigParam + configId)->memPtr, offset, configSize) == SUCCESS)
+        {
+            WPRINT(CONFIGURATION, "dropped config written again: [file=%s]", (sysConfigParam + configId)->fileName);
+        }
+        else
+        {
+            /* Failed commit marks it again but failed append does not */
+            EPRINT(CONFIGURATION, "fail to write dropped config again: [file=%s]", (sysConfigParam + configId)->fileName);
+            MUTEX_LOCK(configJournal.lock);
+            configJournal.restoreF[configId] = TRUE;
+            configJournal.restorePendingF = TRUE;
+            MUTEX_UNLOCK(configJournal.lock);
+            status = FAIL;
+        }
+        pthread_rwlock_unlock(&rwLock[configId]);
+    }
+    MUTEX_UNLOCK(configRestoreLock);
+    return status;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function applies committed records of config journal into config files or into master
+ *          copies of configs to be replayed. Parsing stops at the first invalid record; records of
+ *          uncommitted batch are ignored.
+ * @param   journalBuf
+ * @param   journalSize
+ * @param   masterCopyF - Apply records in master copies instead of config files
+ * @param   pCommitSize - Size of journal up to last valid commit record (optional)
+ * @return  SUCCESS/FAIL
+ */
+static BOOL applyConfigJournal(UINT8PTR journalBuf, UINT32 journalSize, BOOL masterCopyF, UINT32PTR pCommitSize)
+{
+    BOOL                    status = SUCCESS;
+    INT32                   fileFd[MAX_CONFIG_ID];
+    BOOL                    skipFileF[MAX_CONFIG_ID];
+    UINT32                  fileVersion, checksum;
+    UINT32                  configSize, offset;
+    UINT32                  recPos = 0, batchPos = 0, applyPos;
+    UINT8                   configId;
+    CHAR                    filePath[100];
+    CONFIG_JOURNAL_REC_t    record;
+
+    for (configId = 0; configId < MAX_CONFIG_ID; configId++)
+    {
+        fileFd[configId] = INVALID_FILE_FD;
+        skipFileF[configId] = (masterCopyF == TRUE) ? !replayConfigF[configId] : FALSE;
+    }
+
+    while ((status == SUCCESS) && ((recPos + sizeof(record)) <= journalSize))
+    {
+        memcpy(&record, journalBuf + recPos, sizeof(record));
+        if ((record.magic != CONFIG_JOURNAL_MAGIC) || (record.size > (journalSize - recPos - sizeof(record))))
+        {
+            break;
+        }
+
+        checksum = record.checksum;
+        record.checksum = 0;
+        record.checksum = calcConfigJournalChecksum(CONFIG_JOURNAL_CHECKSUM_INIT, (UINT8PTR)&record, sizeof(record));
+        if (calcConfigJournalChecksum(record.checksum, journalBuf + recPos + sizeof(record), record.size) != checksum)
+        {
+            EPRINT(CONFIGURATION, "config journal record corrupted: [pos=%d], [configId=%d]", recPos, record.configId);
+            break;
+        }
+
+        recPos += (sizeof(record) + record.size);
+        if (record.configId != CONFIG_JOURNAL_COMMIT_ID)
+        {
+            continue;
+        }
+
+        /* Batch is committed, apply all its records into config files */
+        for (applyPos = batchPos; applyPos < (recPos - sizeof(record)); applyPos += (sizeof(record) + record.size))
+        {
+            memcpy(&record, journalBuf + applyPos, sizeof(record));
+            configId = (UINT8)record.configId;
+            if ((record.configId >= MAX_CONFIG_ID) || (skipFileF[configId] == TRUE) || (record.version != (sysConfigParam + configId)->version))
+            {
+                continue;
+            }
+
+            /* Data must be within the current config size */
+            getConfigOffsetAndSize(configId, WHOLE_CONFIG, 0, 0, &offset, &configSize);
+            if ((record.offset > configSize) || (record.size > (configSize - record.offset)))
+            {
+                EPRINT(CONFIGURATION, "invld config journal record: [file=%s], [offset=%d], [size=%d]",
+                       (sysConfigParam + configId)->fileName, record.offset, record.size);
+                continue;
+            }
+
+            if (masterCopyF == TRUE)
+            {
+                memcpy(((sysConfigParam + configId)->memPtr + record.offset), journalBuf + applyPos + sizeof(record), record.size);
+                continue;
+            }
+
+            if (fileFd[configId] == INVALID_FILE_FD)
+            {
+                /* Config file which is removed (e.g. factory default) or of other version is not updated */
+                snprintf(filePath, sizeof(filePath), APP_CONFIG_DIR_PATH "/%s" CONFIG_FILE_EXT, (sysConfigParam + configId)->fileName);
+                fileFd[configId] = open(filePath, O_RDWR);
+                if ((fileFd[configId] == INVALID_FILE_FD) || (pread(fileFd[configId], &fileVersion, sizeof(fileVersion), 0) != (ssize_t)sizeof(fileVersion))
+                        || (fileVersion != record.version))
+                {
+                    WPRINT(CONFIGURATION, "config journal record skipped: [file=%s]", (sysConfigParam + configId)->fileName);
+                    skipFileF[configId] = TRUE;
+                    continue;
+                }
+            }
+
+            /* Skip config file version number size (4 bytes) */
+            if (pwrite(fileFd[configId], journalBuf + applyPos + sizeof(record), record.size, 4 + record.offset) != (ssize_t)record.size)
+            {
+                EPRINT(CONFIGURATION, "fail to write file: [file=%s], [err=%s]", (sysConfigParam + configId)->fileName, STR_ERR);
+                status = FAIL;
+                break;
+            }
+        }
+
+        batchPos = recPos;
+    }
+
+    if (pCommitSize != NULL)
+    {
+        *pCommitSize = batchPos;
+    }
+
+    for (configId = 0; configId < MAX_CONFIG_ID; configId++)
+    {
+        if (fileFd[configId] == INVALID_FILE_FD)
+        {
+            continue;
+        }
+
+        if ((skipFileF[configId] == FALSE) && (fsync(fileFd[configId]) != STATUS_OK))
+        {
+            EPRINT(CONFIGURATION, "fail to sync file: [file=%s], [err=%s]", (sysConfigParam + configId)->fileName, STR_ERR);
+            status = FAIL;
+        }
+        close(fileFd[configId]);
+    }
+
+    return status;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function reads whole config journal in allocated buffer. It must be called with
+ *          journal lock and non-empty journal. Caller must free the buffer.
+ * @return  Journal buffer or NULL on failure
+ */
+static UINT8PTR readConfigJournal(void)
+{
+    UINT8PTR journalBuf;
+
+    journalBuf = malloc(configJournal.fileSize);
+    if (journalBuf == NULL)
+    {
+        EPRINT(CONFIGURATION, "fail to alloc memory: [size=%d]", configJournal.fileSize);
+        return NULL;
+    }
+
+    if (pread(configJournal.fd, journalBuf, configJournal.fileSize, 0) != (ssize_t)configJournal.fileSize)
+    {
+        EPRINT(CONFIGURATION, "fail to read config journal: [err=%s]", STR_ERR);
+        free(journalBuf);
+        return NULL;
+    }
+
+    return journalBuf;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function compacts committed records of config journal into config files and then
+ *          truncates the journal. It must be called with journal lock and without batch in progress.
+ * @return  SUCCESS/FAIL
+ */
+static BOOL compactConfigJournal(void)
+{
+    UINT8PTR journalBuf;
+
+    if ((configJournal.fd == INVALID_FILE_FD) || (configJournal.fileSize == 0))
+    {
+        return SUCCESS;
+    }
+
+    journalBuf = readConfigJournal();
+    if (journalBuf == NULL)
+    {
+        return FAIL;
+    }
+
+    if (applyConfigJournal(journalBuf, configJournal.fileSize, FALSE, NULL) == FAIL)
+    {
+        free(journalBuf);
+        return FAIL;
+    }
+    free(journalBuf);
+
+    /* Config files are synced, now journal is not required */
+    if ((ftruncate(configJournal.fd, 0) != STATUS_OK) || (fdatasync(configJournal.fd) != STATUS_OK))
+    {
+        EPRINT(CONFIGURATION, "fail to truncate config journal: [err=%s]", STR_ERR);
+        return FAIL;
+    }
+
+    DPRINT(CONFIGURATION, "config journal compacted: [size=%d]", configJournal.fileSize);
+    configJournal.fileSize = 0;
+    configJournal.commitSize = 0;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function applies committed updates of config journal left by previous run (power
+ *          failure or crash) into config files. It must be called before reading config files. If
+ *          journal can't be applied, it is kept for replay in master copies as its updates are
+ *          already acknowledged.
+ */
+static void recoverConfigJournal(void)
+{
+    struct stat fileInfo;
+    UINT8       retry;
+    UINT8       configId;
+    INT32       fileFd;
+    UINT32      fileVersion;
+    CHAR        filePath[100];
+
+    MUTEX_LOCK(configJournal.lock);
+    configJournal.fd = open(CONFIG_JOURNAL_FILE, O_RDWR);
+    if (configJournal.fd == INVALID_FILE_FD)
+    {
+        MUTEX_UNLOCK(configJournal.lock);
+        return;
+    }
+
+    if (fstat(configJournal.fd, &fileInfo) == STATUS_OK)
+    {
+        configJournal.fileSize = fileInfo.st_size;
+        configJournal.commitSize = fileInfo.st_size;
+    }
+
+    for (retry = 1; retry <= CONFIG_JOURNAL_RECOVER_RETRY; retry++)
+    {
+        if (compactConfigJournal() == SUCCESS)
+        {
+            close(configJournal.fd);
+            configJournal.fd = INVALID_FILE_FD;
+            configJournal.fileSize = 0;
+            configJournal.commitSize = 0;
+            MUTEX_UNLOCK(configJournal.lock);
+            return;
+        }
+
+        EPRINT(CONFIGURATION, "fail to recover config journal: [try=%d]", retry);
+        sleep(1);
+    }
+
+    /* Compaction applies records only in config files of current version, replay does the same in master copies.
+     * Config files of other version are updated by config init, so they are checked before it */
+    for (configId = 0; configId < MAX_CONFIG_ID; configId++)
+    {
+        snprintf(filePath, sizeof(filePath), APP_CONFIG_DIR_PATH "/%s" CONFIG_FILE_EXT, (sysConfigParam + configId)->fileName);
+        fileFd = open(filePath, O_RDONLY);
+        replayConfigF[configId] = (fileFd != INVALID_FILE_FD) && (pread(fileFd, &fileVersion, sizeof(fileVersion), 0) == (ssize_t)sizeof(fileVersion))
+                && (fileVersion == (sysConfigParam + configId)->version);
+        if (fileFd != INVALID_FILE_FD)
+        {
+            close(fileFd);
+        }
+    }
+
+    replayJournalF = TRUE;
+    MUTEX_UNLOCK(configJournal.lock);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function applies committed updates of journal which could not be recovered into master
+ *          copies, after configs are read from files. Journal is kept up to its last commit record, so
+ *          journal thread applies it in config files later or it is recovered again at next start-up.
+ */
+static void replayConfigJournal(void)
+{
+    UINT8PTR journalBuf;
+    UINT32   commitSize = 0;
+
+    MUTEX_LOCK(configJournal.lock);
+    if (replayJournalF == FALSE)
+    {
+        MUTEX_UNLOCK(configJournal.lock);
+        return;
+    }
+    replayJournalF = FALSE;
+
+    journalBuf = readConfigJournal();
+    if (journalBuf == NULL)
+    {
+        /* Updates are going to be written directly in config files and unread journal must not overwrite them at
+         * next start-up. It is moved aside instead of removing its committed records */
+        EPRINT(CONFIGURATION, "fail to replay config journal, move it aside: [file=%s]", CONFIG_JOURNAL_FILE ".old");
+        if (rename(CONFIG_JOURNAL_FILE, CONFIG_JOURNAL_FILE ".old") != STATUS_OK)
+        {
+            EPRINT(CONFIGURATION, "fail to rename config journal: [err=%s]", STR_ERR);
+        }
+
+        close(configJournal.fd);
+        configJournal.fd = INVALID_FILE_FD;
+        configJournal.fileSize = 0;
+        configJournal.commitSize = 0;
+        MUTEX_UNLOCK(configJournal.lock);
+        return;
+    }
+
+    applyConfigJournal(journalBuf, configJournal.fileSize, TRUE, &commitSize);
+    free(journalBuf);
+
+    /* Records of uncommitted batch are dropped, new records are appended after the last commit record */
+    if (ftruncate(configJournal.fd, commitSize) != STATUS_OK)
+    {
+        EPRINT(CONFIGURATION, "fail to truncate config journal: [err=%s]", STR_ERR);
+    }
+
+    configJournal.fileSize = commitSize;
+    configJournal.commitSize = commitSize;
+    WPRINT(CONFIGURATION, "config journal replayed in master copies: [size=%d]", commitSize);
+    MUTEX_UNLOCK(configJournal.lock);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function enables config journal and starts its compaction thread. Journal kept by
+ *          failed recovery is continued, otherwise new journal is created. If journal can't be enabled
+ *          then configuration updates are written directly into config files.
+ */
+static void startConfigJournal(void)
+{
+    INT32 fd;
+
+    MUTEX_LOCK(configJournal.lock);
+    if (configJournal.fd == INVALID_FILE_FD)
+    {
+        fd = open(CONFIG_JOURNAL_FILE, O_RDWR | O_CREAT | O_TRUNC, USR_RW_GRP_R_OTH_R);
+        if (fd == INVALID_FILE_FD)
+        {
+            MUTEX_UNLOCK(configJournal.lock);
+            EPRINT(CONFIGURATION, "fail to open config journal: [err=%s]", STR_ERR);
+            return;
+        }
+
+        configJournal.fd = fd;
+        configJournal.fileSize = 0;
+        configJournal.commitSize = 0;
+    }
+    configJournal.lastWriteTime = GetMonotonicTimeInSec();
+    MUTEX_UNLOCK(configJournal.lock);
+
+    if (FAIL == Utils_CreateThread(NULL, configJournalThread, NULL, DETACHED_THREAD, CONFIG_JOURNAL_THREAD_STACK_SZ))
+    {
+        EPRINT(CONFIGURATION, "fail to create config journal thread");
+
+        /* Journal whose committed records can't be applied stays enabled and is compacted at shutdown */
+        MUTEX_LOCK(configJournal.lock);
+        if (compactConfigJournal() == SUCCESS)
+        {
+            close(configJournal.fd);
+            configJournal.fd = INVALID_FILE_FD;
+            unlink(CONFIG_JOURNAL_FILE);
+        }
+        MUTEX_UNLOCK(configJournal.lock);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This thread compacts config journal into config files when journal grows beyond limit
+ *          or when no configuration update is done for some time. It also writes master copies of
+ *          configs dropped by failed commit, until they are written successfully.
+ * @param   arg
+ * @return
+ */
+static VOIDPTR configJournalThread(VOIDPTR arg)
+{
+    struct timespec ts;
+
+    THREAD_START("CFG_JOURNAL");
+
+    MUTEX_LOCK(configJournal.lock);
+    while (TRUE)
+    {
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_sec += CONFIG_JOURNAL_CHECK_TIME_SEC;
+        pthread_cond_timedwait(&configJournal.signal, &configJournal.lock, &ts);
+
+        /* Config lock is taken before journal lock, hence dropped configs are written without journal lock */
+        if (configJournal.restorePendingF == TRUE)
+        {
+            MUTEX_UNLOCK(configJournal.lock);
+            restoreDroppedConfigs();
+            MUTEX_LOCK(configJournal.lock);
+        }
+
+        /* Compaction is not allowed in middle of batch as it truncates the uncommitted records too */
+        if ((configJournal.batchDepth != 0) || (configJournal.commitSize == 0) || (configJournal.fileSize != configJournal.commitSize))
+        {
+            continue;
+        }
+
+        if ((configJournal.commitSize < CONFIG_JOURNAL_COMPACT_SIZE)
+                && ((GetMonotonicTimeInSec() - configJournal.lastWriteTime) < CONFIG_JOURNAL_IDLE_TIME_SEC))
+        {
+            continue;
+        }
+
+        compactConfigJournal();
+    }
+
+    MUTEX_UNLOCK(configJournal.lock);
+    pthread_exit(NULL);
+}
+
 //#################################################################################################
 // @END OF FILE
 //#################################################################################################
@@ -138,6 +138,7 @@ static LOGIN_RESP_t         loginResp;
 static DI_POLL_MSG_QUE_t    pollMsgQueue;
 static CONFIG_THREAD_INFO_t configThreadInfo;
 static const CHARPTR        diHeaderReq[MAX_DI_HEADER_REQ] = {"ACK_LOG", "ACK_POL"};
+static STR_INDEX_TABLE_t    diHeaderReqIndexTbl = STR_INDEX_TABLE_INIT(diHeaderReq, MAX_DI_HEADER_REQ);
 
 //#################################################################################################
 // @FUNCTIONS
@@ -148,6 +149,7 @@ static const CHARPTR        diHeaderReq[MAX_DI_HEADER_REQ] = {"ACK_LOG", "ACK_PO
  */
 void InitDeviceInitiation(void)
 {
+    InitStrIndexTable(&diHeaderReqIndexTbl);
 	diInitModule();
     MUTEX_INIT(DiMan.diManMutex, NULL);
     MUTEX_INIT(pollMsgQueue.diPollMsgCondMutex, NULL);
@@ -1206,7 +1208,7 @@ NET_CMD_STATUS_e diFindHeaderIndex(CHARPTR *pBufPtr, UINT8PTR pMsgId)
         return CMD_INVALID_SYNTAX;
     }
 
-    *pMsgId = ConvertStringToIndex(buf, diHeaderReq, MAX_DI_HEADER_REQ);
+    *pMsgId = FindStrIndex(&diHeaderReqIndexTbl, buf);
     if(*pMsgId >= MAX_HEADER_REQ)
     {
         return CMD_INVALID_MESSAGE;
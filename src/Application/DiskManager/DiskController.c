@@ -30,6 +30,17 @@
 /* Minimum hard-disk delete size */
 #define MINIMUM_HDD_DEL_SIZE        (20UL * (GIGA_BYTE / KILO_BYTE))
 
+/* Retention index of hour folders of volume */
+#define RETENTION_INDEX_FILE        ".retentionIdx"
+#define RETENTION_INDEX_TEMP_FILE   ".retentionIdx.tmp"
+#define RETENTION_FILE_SIGN         0x0703
+#define RETENTION_FILE_VERSION      0x0001
+#define RETENTION_FILE_HDR_SIZE     sizeof(RETENTION_FILE_HDR_t)
+#define RETENTION_ENTRY_SIZE        sizeof(RETENTION_ENTRY_t)
+#define RETENTION_INDEX_MAX         (MAX_VOLUME + MAX_NW_DRIVE)
+#define RETENTION_HEAP_ALLOC_CNT    1024
+#define RETENTION_RESYNC_HOUR_MAX   24
+
 /* Use Default Stack Size*/
 #define HDD_CONFIG_THREAD_STACK_SZ              (1*MEGA_BYTE)
 #define STORAGE_ALLOC_CONFIG_THREAD_STACK_SZ    (512*KILO_BYTE)
@@ -140,6 +151,34 @@ typedef struct
 
 }UNPLUG_DEV_INFO_t;
 
+typedef struct
+{
+    UINT16                  fileSign;
+    UINT16                  version;
+    UINT32                  reserved;
+
+}RETENTION_FILE_HDR_t;
+
+typedef struct
+{
+    UINT32                  hourSec;
+    UINT8                   cameraIndex;
+    UINT8                   reserved[3];
+
+}RETENTION_ENTRY_t;
+
+typedef struct
+{
+    CHAR                    mntPoint[MOUNT_POINT_SIZE];
+    BOOL                    readyF;         /* All hour folders of volume are present in index */
+    INT32                   fileFd;
+    UINT32                  logEntryCnt;    /* Entries saved in index file including removed */
+    UINT32                  entryCnt;
+    UINT32                  allocCnt;
+    RETENTION_ENTRY_t       *pHeap;         /* Min heap of hour folders, oldest on top */
+
+}RETENTION_INDEX_t;
+
 //#################################################################################################
 // @PROTOTYPES
 //#################################################################################################
@@ -158,6 +197,8 @@ static VOIDPTR recoveryMedia(VOIDPTR threadArg);
 //-------------------------------------------------------------------------------------------------
 static VOIDPTR buildRecIndex(VOIDPTR mntPoint);
 //-------------------------------------------------------------------------------------------------
+static VOIDPTR recoverVolume(VOIDPTR threadArg);
+//-------------------------------------------------------------------------------------------------
 static VOIDPTR remOldestFile(VOIDPTR threadArg);
 //-------------------------------------------------------------------------------------------------
 static VOIDPTR remRecordByDay(VOIDPTR threadArg);
@@ -168,6 +209,36 @@ static BOOL deleteOldestFileBySize(UINT32 deleteVolumeMask, UINT64 deleteSize);
 //-------------------------------------------------------------------------------------------------
 static BOOL getOldestFolder(UINT32 deleteVolumeMask, CHARPTR oldestFolder);
 //-------------------------------------------------------------------------------------------------
+static BOOL scanOldestHour(UINT32 deleteVolumeMask, UINT8 *pOldestDisk, UINT8 *pOldestCameraIndex, time_t *pOldestFolderTime);
+//-------------------------------------------------------------------------------------------------
+static void removeEmptyDateFolder(CHARPTR hourFolder);
+//-------------------------------------------------------------------------------------------------
+static BOOL isRetentionEntryOlder(RETENTION_ENTRY_t *pEntry1, RETENTION_ENTRY_t *pEntry2);
+//-------------------------------------------------------------------------------------------------
+static void siftDownRetentionEntry(RETENTION_INDEX_t *pIndex, UINT32 entryPos);
+//-------------------------------------------------------------------------------------------------
+static BOOL pushRetentionEntry(RETENTION_INDEX_t *pIndex, RETENTION_ENTRY_t *pEntry);
+//-------------------------------------------------------------------------------------------------
+static void popRetentionEntry(RETENTION_INDEX_t *pIndex);
+//-------------------------------------------------------------------------------------------------
+static RETENTION_INDEX_t *getRetentionIndex(CHARPTR mntPoint);
+//-------------------------------------------------------------------------------------------------
+static void getRetentionFolderName(CHARPTR mntPoint, RETENTION_ENTRY_t *pEntry, CHARPTR folderName);
+//-------------------------------------------------------------------------------------------------
+static BOOL addRetentionListEntry(RETENTION_ENTRY_t **ppEntry, UINT32 *pEntryCnt, UINT32 *pAllocCnt, UINT8 cameraIndex, time_t hourSec);
+//-------------------------------------------------------------------------------------------------
+static BOOL readRetentionFile(CHARPTR mntPoint, RETENTION_ENTRY_t **ppEntry, UINT32 *pEntryCnt, UINT32 *pAllocCnt, INT32 *pFileFd);
+//-------------------------------------------------------------------------------------------------
+static BOOL writeRetentionFile(CHARPTR mntPoint, RETENTION_ENTRY_t *pEntry, UINT32 entryCnt, INT32 *pFileFd);
+//-------------------------------------------------------------------------------------------------
+static void scanRetentionHours(CHARPTR mntPoint, RETENTION_ENTRY_t **ppEntry, UINT32 *pEntryCnt, UINT32 *pAllocCnt);
+//-------------------------------------------------------------------------------------------------
+static BOOL resyncRetentionHours(CHARPTR mntPoint, RETENTION_ENTRY_t **ppEntry, UINT32 *pEntryCnt, UINT32 *pAllocCnt);
+//-------------------------------------------------------------------------------------------------
+static BOOL getRetentionOldestHour(UINT32 deleteVolumeMask, UINT8 *pOldestDisk, UINT8 *pOldestCameraIndex, time_t *pOldestFolderTime);
+//-------------------------------------------------------------------------------------------------
+static void removeRetentionHour(CHARPTR mntPoint, UINT8 cameraIndex, time_t hourSec);
+//-------------------------------------------------------------------------------------------------
 static BOOL getFolderOlderThanDay(CHARPTR fromPath, UINT16 olderDay, CHARPTR oldFolder, RECOVERY_INFO_t *recvryInfo);
 //-------------------------------------------------------------------------------------------------
 static void setCleanUpThreadExit(CLEANUP_MODE_e cleanupMode);
@@ -205,7 +276,9 @@ static TIMER_HANDLE					nddPostCfgTmrHdl = INVALID_TIMER_HANDLE;
 static BACKUP_CLEANUP_INFO_t		bkupCleanUp;
 static DISK_ACT_e					storageDriveActionStatus[MAX_RECORDING_MODE];
 static pthread_mutex_t				storageDriveActionStatusMutex;
-static pthread_mutex_t				buildIndexSyncMutex[MAX_RECORDING_MODE];
+static pthread_rwlock_t			buildIndexSyncLock[MAX_RECORDING_MODE];
+static pthread_mutex_t				retentionIndexLock;
+static RETENTION_INDEX_t            retentionIndex[RETENTION_INDEX_MAX];
 static const CHARPTR                levelOneDirectories[MAX_LEVEL_ONE_DIRS] = {"HDD1/", "HDD2/", "HDD3/", "HDD4/", "NDD1/", "NDD2/", "RAID0/", "RAID1/"};
 
 //#################################################################################################
@@ -228,14 +301,21 @@ void InitDiskController(void)
     MUTEX_INIT(storageDriveActionStatusMutex, NULL);
     MUTEX_INIT(hddConfigThreadInfo.configMutex, NULL);
     MUTEX_INIT(storageAllocConfigThreadInfo.configMutex, NULL);
+    MUTEX_INIT(retentionIndexLock, NULL);
     memset(lastStorageStatus, FALSE, sizeof(lastStorageStatus));
 
+    memset(retentionIndex, 0, sizeof(retentionIndex));
+    for(index = 0; index < RETENTION_INDEX_MAX; index++)
+    {
+        retentionIndex[index].fileFd = INVALID_FILE_FD;
+    }
+
     for(index = 0; index < MAX_RECORDING_MODE; index++)
     {
         storageDriveActionStatus[index] = DISK_ACT_NORMAL;
         recoryInfo[index].threadActive = FALSE;
         MUTEX_INIT(recoryInfo[index].recoveryMutex, NULL);
-        MUTEX_INIT(buildIndexSyncMutex[index], NULL);
+        pthread_rwlock_init(&buildIndexSyncLock[index], NULL);
     }
 
     for(index = 0; index < DM_MAX_BACKUP; index++)
@@ -1714,6 +1794,12 @@ static VOIDPTR recoveryMedia(VOIDPTR threadArg)
     CHAR                        recvrFilename[MAX_FILE_NAME_SIZE];
     INT32                       recFileFd;
     BUILD_REC_INDEX_PARAMS_t    *pBuildParams = NULL;
+    UINT8                       volumeCnt = 0, volumeId;
+    BOOL                        volumeRecoveryF[MAX_VOLUME];
+    BOOL                        volumeThreadF[MAX_VOLUME];
+    pthread_t                   volumeThreadId[MAX_VOLUME];
+    BUILD_REC_INDEX_PARAMS_t    volumeInfo[MAX_VOLUME];
+    UINT32                      recoveryStartTick = GetSysTick();
 
     THREAD_START_INDEX("RCVRY_MEDIA", recInfo->mediaType);
     ReadGeneralConfig(&aviRecGenConfig);
@@ -1724,7 +1810,7 @@ static VOIDPTR recoveryMedia(VOIDPTR threadArg)
         totalDiskCnt = GetTotalDiskNumber(hddConfig.mode);
         for(diskCnt = 0; diskCnt < totalDiskCnt; diskCnt++)
         {
-            if(GetMountPointFromLocalDiskId(diskCnt, mntPoint, hddConfig.mode) == FAIL)
+            if((volumeCnt >= MAX_VOLUME) || (GetMountPointFromLocalDiskId(diskCnt, mntPoint, hddConfig.mode) == FAIL))
             {
                 continue;
             }
@@ -1739,8 +1825,10 @@ static VOIDPTR recoveryMedia(VOIDPTR threadArg)
                 recoveryEventLogF = TRUE;
             }
 
+            volumeRecoveryF[volumeCnt] = FALSE;
             if((aviRecGenConfig.recordFormatType == REC_AVI_FORMAT) || (aviRecGenConfig.recordFormatType == REC_BOTH_FORMAT))
             {
+                /* Avi convertor of drive is started per volume, so these volumes are recovered one by one */
                 snprintf(aviConvertInfo[recInfo->mediaType].aviRecMountPoint, MOUNT_POINT_SIZE, "%s", mntPoint);
                 snprintf(recoveryFldr, MAX_FILE_NAME_SIZE, RECOVERY_FOLDER, mntPoint);
                 if(access(recoveryFldr, F_OK) == STATUS_OK)
@@ -1782,24 +1870,57 @@ static VOIDPTR recoveryMedia(VOIDPTR threadArg)
             }
             else
             {
+                /* Volumes are recovered in parallel once all volumes are found */
                 SetStorageDriveStatus(recInfo->mediaType, DISK_ACT_RECOVERY);
-                StartRecovery(mntPoint, recInfo->mediaType);
+                volumeRecoveryF[volumeCnt] = TRUE;
             }
 
-            /* Alloc memory as we have to pass the info to index build thread */
             status = FALSE;
+            snprintf(volumeInfo[volumeCnt].mountPoint, MOUNT_POINT_SIZE, "%s", mntPoint);
+            volumeInfo[volumeCnt].diskId = LOCAL_HARD_DISK;
+            volumeCnt++;
+        }
+
+        for(volumeId = 0; volumeId < volumeCnt; volumeId++)
+        {
+            volumeThreadF[volumeId] = FAIL;
+            if(volumeRecoveryF[volumeId] == TRUE)
+            {
+                volumeThreadF[volumeId] = Utils_CreateThread(&volumeThreadId[volumeId], recoverVolume, &volumeInfo[volumeId],
+                                                             JOINABLE_THREAD, RECOVERY_MEDIA_THREAD_STACK_SZ);
+                if(volumeThreadF[volumeId] == FAIL)
+                {
+                    EPRINT(DISK_MANAGER, "fail to create volume recovery thread: [path=%s]", volumeInfo[volumeId].mountPoint);
+                    StartRecovery(volumeInfo[volumeId].mountPoint, LOCAL_HARD_DISK);
+                }
+            }
+        }
+
+        for(volumeId = 0; volumeId < volumeCnt; volumeId++)
+        {
+            if(volumeThreadF[volumeId] == SUCCESS)
+            {
+                pthread_join(volumeThreadId[volumeId], NULL);
+            }
+        }
+
+        DPRINT(DISK_MANAGER, "recovery of all volumes completed: [volumes=%d], [elapsedMs=%d]",
+               volumeCnt, ElapsedTick(recoveryStartTick) * TIMER_RESOLUTION_MINIMUM_MSEC);
+
+        for(volumeId = 0; volumeId < volumeCnt; volumeId++)
+        {
+            /* Alloc memory as we have to pass the info to index build thread */
             pBuildParams = (BUILD_REC_INDEX_PARAMS_t*)malloc(sizeof(BUILD_REC_INDEX_PARAMS_t));
             if (NULL == pBuildParams)
             {
-                EPRINT(DISK_MANAGER, "fail to alloc memory for record build index thread: [path=%s]", mntPoint);
+                EPRINT(DISK_MANAGER, "fail to alloc memory for record build index thread: [path=%s]", volumeInfo[volumeId].mountPoint);
                 continue;
             }
 
-            snprintf(pBuildParams->mountPoint, MOUNT_POINT_SIZE, "%s", mntPoint);
-            pBuildParams->diskId = LOCAL_HARD_DISK;
+            *pBuildParams = volumeInfo[volumeId];
             if (FAIL == Utils_CreateThread(NULL, buildRecIndex, pBuildParams, DETACHED_THREAD, BUILD_INDEX_THREAD_STACK_SZ))
             {
-                EPRINT(DISK_MANAGER, "fail to create record build index thread: [path=%s]", mntPoint);
+                EPRINT(DISK_MANAGER, "fail to create record build index thread: [path=%s]", volumeInfo[volumeId].mountPoint);
                 FREE_MEMORY(pBuildParams);
             }
         }
@@ -1926,9 +2047,9 @@ static VOIDPTR recoveryMedia(VOIDPTR threadArg)
     }
 
     sleep(1);
-    MUTEX_LOCK(buildIndexSyncMutex[recInfo->mediaType]);
+    pthread_rwlock_wrlock(&buildIndexSyncLock[recInfo->mediaType]);
     GenerateLocalRecDatabase((RECORD_ON_DISK_e)recInfo->mediaType, INVALID_CAMERA_INDEX);
-    MUTEX_UNLOCK(buildIndexSyncMutex[recInfo->mediaType]);
+    pthread_rwlock_unlock(&buildIndexSyncLock[recInfo->mediaType]);
 
     MUTEX_LOCK(recInfo->recoveryMutex);
     recInfo->threadActive = FALSE;
@@ -1936,6 +2057,21 @@ static VOIDPTR recoveryMedia(VOIDPTR threadArg)
     pthread_exit(NULL);
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This thread recovers recording of one volume
+ * @param   threadArg - Volume information
+ * @return
+ */
+static VOIDPTR recoverVolume(VOIDPTR threadArg)
+{
+    BUILD_REC_INDEX_PARAMS_t *volumeInfo = (BUILD_REC_INDEX_PARAMS_t *)threadArg;
+
+    THREAD_START("RCVRY_VOLUME");
+    StartRecovery(volumeInfo->mountPoint, volumeInfo->diskId);
+    pthread_exit(NULL);
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   This thread calls the function which build the recording index map file with prev stored data.
@@ -1947,9 +2083,12 @@ static VOIDPTR buildRecIndex(VOIDPTR threadArg)
     BUILD_REC_INDEX_PARAMS_t *buildParam = (BUILD_REC_INDEX_PARAMS_t *)threadArg;
 
     DPRINT(DISK_MANAGER, "recovery index building started: [path=%s]", buildParam->mountPoint);
-    MUTEX_LOCK(buildIndexSyncMutex[buildParam->diskId]);
+    /* Index of volumes of drive are built in parallel, database of drive is generated exclusively */
+    pthread_rwlock_rdlock(&buildIndexSyncLock[buildParam->diskId]);
     BuildRecIndexFromPrevStoredData(buildParam->mountPoint);
-    MUTEX_UNLOCK(buildIndexSyncMutex[buildParam->diskId]);
+    BuildRecCatalog(buildParam->mountPoint);
+    pthread_rwlock_unlock(&buildIndexSyncLock[buildParam->diskId]);
+    LoadRetentionIndex(buildParam->mountPoint);
     DPRINT(DISK_MANAGER, "recovery index building completed: [path=%s]", buildParam->mountPoint);
     FREE_MEMORY(buildParam);
     pthread_exit(NULL);
@@ -2125,6 +2264,10 @@ static VOIDPTR remOldestFile(VOIDPTR threadArg)
                 sleep(FOLDER_DELETE_TIMEOUT);
                 EntryOldestDeleteFile(oldestFolder);
             }
+            else
+            {
+                removeEmptyDateFolder(oldestFolder);
+            }
         }
         else
         {
@@ -2750,18 +2893,75 @@ static BOOL getFolderOlderThanDay(CHARPTR fromPath, UINT16 olderDay, CHARPTR old
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   This function find out oldest folder with 3 directory depth.
+ * @brief   This function find out oldest folder of given volumes. It is taken from retention index
+ *          and folders are scanned only when index of any volume is not loaded yet.
  * @param   deleteVolumeMask
  * @param   oldestFolder
  * @return  SUCCESS/FAIL
  */
 static BOOL getOldestFolder(UINT32 deleteVolumeMask, CHARPTR oldestFolder)
 {
-    BOOL			hourWasZero;
-    UINT8			cameraIndex;
     UINT8			oldestDisk = HDD1;
     UINT8			oldestCameraIndex = 0;
     CHAR			mntPoint[MOUNT_POINT_SIZE];
+    struct tm 		oldestTime;
+    struct tm 		currTime;
+    time_t 			oldestFolderTime = 0;
+    RECOVERY_INFO_t	recoveryInfo;
+
+    if(getRetentionOldestHour(deleteVolumeMask, &oldestDisk, &oldestCameraIndex, &oldestFolderTime) == FAIL)
+    {
+        scanOldestHour(deleteVolumeMask, &oldestDisk, &oldestCameraIndex, &oldestFolderTime);
+    }
+
+    /* SD-2851: If oldest folder time zero, means there is no recording available. To avoid unnecessary
+     * processing on folder with default time i.e. 1 Jan 1970 when going to convert 0 sec into BrokenTm. */
+    if(oldestFolderTime == 0)
+    {
+        return FAIL;
+    }
+
+    ConvertLocalTimeInBrokenTm(&oldestFolderTime, &oldestTime);
+    GetLocalTimeInBrokenTm(&currTime);
+
+    if((currTime.tm_year != oldestTime.tm_year) || (currTime.tm_mday != oldestTime.tm_mday)
+            || (currTime.tm_mon != oldestTime.tm_mon) || (currTime.tm_hour != oldestTime.tm_hour))
+    {
+        HDD_CONFIG_t hddConfig;
+
+        ReadHddConfig(&hddConfig);
+        GetMountPointFromDiskId(oldestDisk, mntPoint, MAX_RECORDING_MODE);
+        snprintf(oldestFolder, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_FOLDER_DATE_HOUR_FORMAT, mntPoint,
+                 GET_CAMERA_NO(oldestCameraIndex), oldestTime.tm_mday, GetMonthName(oldestTime.tm_mon), oldestTime.tm_year, oldestTime.tm_hour);
+
+        recoveryInfo.date = oldestTime.tm_mday;
+        recoveryInfo.mon = oldestTime.tm_mon;
+        recoveryInfo.year = oldestTime.tm_year;
+        recoveryInfo.hour = oldestTime.tm_hour;
+        RemoveIndexesForFolder(mntPoint, oldestCameraIndex, &recoveryInfo, FALSE);  /* FALSE means remove indexes for overwrite old files */
+        removeRetentionHour(mntPoint, oldestCameraIndex, oldestFolderTime);
+        GenerateLocalRecDatabase(hddConfig.recordDisk, oldestCameraIndex);
+        DPRINT(DISK_MANAGER, "oldest folder found: [path=%s]", oldestFolder);
+        return SUCCESS;
+    }
+
+    return FAIL;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function find out oldest hour folder with 3 directory depth by scanning folders.
+ * @param   deleteVolumeMask
+ * @param   pOldestDisk
+ * @param   pOldestCameraIndex
+ * @param   pOldestFolderTime
+ * @return  SUCCESS/FAIL
+ */
+static BOOL scanOldestHour(UINT32 deleteVolumeMask, UINT8 *pOldestDisk, UINT8 *pOldestCameraIndex, time_t *pOldestFolderTime)
+{
+    BOOL			hourWasZero;
+    UINT8			cameraIndex;
+    CHAR			mntPoint[MOUNT_POINT_SIZE];
     CHAR			channelFolder[MAX_FILE_NAME_SIZE];
     CHAR		 	removeDir[MAX_FILE_NAME_SIZE];
     CHAR			destFolder[MAX_FILE_NAME_SIZE];
@@ -2773,13 +2973,12 @@ static BOOL getOldestFolder(UINT32 deleteVolumeMask, CHARPTR oldestFolder)
     struct tm 		oldestTime;
     struct tm 		currTime;
     time_t 			curSec;
-    time_t 			oldestFolderTime = 0;
     time_t 			oldChannelSec = 0;
     UINT32			diskCnt, totalDisk;
     DIR 			*dir;
     struct dirent	*entry;
-    RECOVERY_INFO_t	recoveryInfo;
 
+    *pOldestFolderTime = 0;
     totalDisk = GetTotalMediaNo(MAX_RECORDING_MODE);
     for(diskCnt = 0; diskCnt < totalDisk; diskCnt++)
     {
@@ -2918,46 +3117,742 @@ static BOOL getOldestFolder(UINT32 deleteVolumeMask, CHARPTR oldestFolder)
             closedir(dir);
 
             ConvertLocalTimeInSec(&oldestTime, &oldChannelSec);
-            if((oldestFolderTime == 0) || (oldestFolderTime > oldChannelSec))
+            if((*pOldestFolderTime == 0) || (*pOldestFolderTime > oldChannelSec))
             {
-                oldestFolderTime = oldChannelSec;
-                oldestCameraIndex = cameraIndex;
-                oldestDisk = diskCnt;
+                *pOldestFolderTime = oldChannelSec;
+                *pOldestCameraIndex = cameraIndex;
+                *pOldestDisk = diskCnt;
             }
         }
     }
 
-    /* SD-2851: If oldest folder time zero, means there is no recording available. To avoid unnecessary
-     * processing on folder with default time i.e. 1 Jan 1970 when going to convert 0 sec into BrokenTm. */
-    if(oldestFolderTime == 0)
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function removes date folder of removed hour folder if it is empty now
+ * @param   hourFolder
+ */
+static void removeEmptyDateFolder(CHARPTR hourFolder)
+{
+    CHAR    dateFolder[MAX_FILE_NAME_SIZE];
+    CHARPTR pFolderEnd;
+
+    snprintf(dateFolder, MAX_FILE_NAME_SIZE, "%s", hourFolder);
+    pFolderEnd = strrchr(dateFolder, '/');
+    if ((pFolderEnd != NULL) && (pFolderEnd[1] == '\0'))
     {
-        return FAIL;
+        *pFolderEnd = '\0';
+        pFolderEnd = strrchr(dateFolder, '/');
     }
 
-    ConvertLocalTimeInBrokenTm(&oldestFolderTime, &oldestTime);
-    GetLocalTimeInBrokenTm(&currTime);
+    if (pFolderEnd == NULL)
+    {
+        return;
+    }
 
-    if((currTime.tm_year != oldestTime.tm_year) || (currTime.tm_mday != oldestTime.tm_mday)
-            || (currTime.tm_mon != oldestTime.tm_mon) || (currTime.tm_hour != oldestTime.tm_hour))
+    /* It fails when other hour folders are present */
+    *pFolderEnd = '\0';
+    rmdir(dateFolder);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function compares two retention entries. Older hour comes first and for same hour
+ *          lower camera comes first.
+ * @param   pEntry1
+ * @param   pEntry2
+ * @return  TRUE if first entry is older than second entry otherwise FALSE
+ */
+static BOOL isRetentionEntryOlder(RETENTION_ENTRY_t *pEntry1, RETENTION_ENTRY_t *pEntry2)
+{
+    if (pEntry1->hourSec != pEntry2->hourSec)
     {
-        HDD_CONFIG_t hddConfig;
+        return (pEntry1->hourSec < pEntry2->hourSec) ? TRUE : FALSE;
+    }
 
-        ReadHddConfig(&hddConfig);
-        GetMountPointFromDiskId(oldestDisk, mntPoint, MAX_RECORDING_MODE);
-        snprintf(oldestFolder, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_FOLDER_DATE_HOUR_FORMAT, mntPoint,
-                 GET_CAMERA_NO(oldestCameraIndex), oldestTime.tm_mday, GetMonthName(oldestTime.tm_mon), oldestTime.tm_year, oldestTime.tm_hour);
+    return (pEntry1->cameraIndex < pEntry2->cameraIndex) ? TRUE : FALSE;
+}
 
-        recoveryInfo.date = oldestTime.tm_mday;
-        recoveryInfo.mon = oldestTime.tm_mon;
-        recoveryInfo.year = oldestTime.tm_year;
-        recoveryInfo.hour = oldestTime.tm_hour;
-        RemoveIndexesForFolder(mntPoint, oldestCameraIndex, &recoveryInfo, FALSE);  /* FALSE means remove indexes for overwrite old files */
-        GenerateLocalRecDatabase(hddConfig.recordDisk, oldestCameraIndex);
-        DPRINT(DISK_MANAGER, "oldest folder found: [path=%s]", oldestFolder);
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function moves heap entry down till heap order is restored
+ * @param   pIndex
+ * @param   entryPos
+ */
+static void siftDownRetentionEntry(RETENTION_INDEX_t *pIndex, UINT32 entryPos)
+{
+    UINT32              childPos;
+    RETENTION_ENTRY_t   tmpEntry;
+
+    while (TRUE)
+    {
+        childPos = (entryPos * 2) + 1;
+        if (childPos >= pIndex->entryCnt)
+        {
+            break;
+        }
+
+        if (((childPos + 1) < pIndex->entryCnt) && (isRetentionEntryOlder(&pIndex->pHeap[childPos + 1], &pIndex->pHeap[childPos]) == TRUE))
+        {
+            childPos++;
+        }
+
+        if (isRetentionEntryOlder(&pIndex->pHeap[childPos], &pIndex->pHeap[entryPos]) == FALSE)
+        {
+            break;
+        }
+
+        tmpEntry = pIndex->pHeap[entryPos];
+        pIndex->pHeap[entryPos] = pIndex->pHeap[childPos];
+        pIndex->pHeap[childPos] = tmpEntry;
+        entryPos = childPos;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function adds entry in heap of retention index
+ * @param   pIndex
+ * @param   pEntry
+ * @return  SUCCESS/FAIL
+ */
+static BOOL pushRetentionEntry(RETENTION_INDEX_t *pIndex, RETENTION_ENTRY_t *pEntry)
+{
+    UINT32              entryPos, parentPos;
+    RETENTION_ENTRY_t   *pNewHeap;
+
+    if (pIndex->entryCnt >= pIndex->allocCnt)
+    {
+        pNewHeap = realloc(pIndex->pHeap, ((pIndex->allocCnt + RETENTION_HEAP_ALLOC_CNT) * RETENTION_ENTRY_SIZE));
+        if (pNewHeap == NULL)
+        {
+            EPRINT(DISK_MANAGER, "memory re-allocation failed: [path=%s]", pIndex->mntPoint);
+            return FAIL;
+        }
+
+        pIndex->pHeap = pNewHeap;
+        pIndex->allocCnt += RETENTION_HEAP_ALLOC_CNT;
+    }
+
+    entryPos = pIndex->entryCnt++;
+    pIndex->pHeap[entryPos] = *pEntry;
+    while (entryPos > 0)
+    {
+        parentPos = (entryPos - 1) / 2;
+        if (isRetentionEntryOlder(&pIndex->pHeap[entryPos], &pIndex->pHeap[parentPos]) == FALSE)
+        {
+            break;
+        }
+
+        pIndex->pHeap[entryPos] = pIndex->pHeap[parentPos];
+        pIndex->pHeap[parentPos] = *pEntry;
+        entryPos = parentPos;
+    }
+
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function removes oldest entry from heap of retention index
+ * @param   pIndex
+ */
+static void popRetentionEntry(RETENTION_INDEX_t *pIndex)
+{
+    if (pIndex->entryCnt == 0)
+    {
+        return;
+    }
+
+    pIndex->entryCnt--;
+    if (pIndex->entryCnt > 0)
+    {
+        pIndex->pHeap[0] = pIndex->pHeap[pIndex->entryCnt];
+        siftDownRetentionEntry(pIndex, 0);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function gives retention index of mount point
+ * @param   mntPoint
+ * @return  Retention index if present otherwise NULL
+ * @note    retentionIndexLock must be acquired by caller
+ */
+static RETENTION_INDEX_t *getRetentionIndex(CHARPTR mntPoint)
+{
+    UINT8 indexId;
+
+    for (indexId = 0; indexId < RETENTION_INDEX_MAX; indexId++)
+    {
+        if ((retentionIndex[indexId].mntPoint[0] != '\0') && (strcmp(retentionIndex[indexId].mntPoint, mntPoint) == STATUS_OK))
+        {
+            return &retentionIndex[indexId];
+        }
+    }
+
+    return NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function gives hour folder path of retention entry
+ * @param   mntPoint
+ * @param   pEntry
+ * @param   folderName
+ */
+static void getRetentionFolderName(CHARPTR mntPoint, RETENTION_ENTRY_t *pEntry, CHARPTR folderName)
+{
+    time_t      hourSec = pEntry->hourSec;
+    struct tm   hourTm;
+
+    ConvertLocalTimeInBrokenTm(&hourSec, &hourTm);
+    snprintf(folderName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_FOLDER_DATE_HOUR_FORMAT, mntPoint,
+             GET_CAMERA_NO(pEntry->cameraIndex), hourTm.tm_mday, GetMonthName(hourTm.tm_mon), hourTm.tm_year, hourTm.tm_hour);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function adds entry in entry list
+ * @param   ppEntry - Entry list, it is re-allocated as required
+ * @param   pEntryCnt
+ * @param   pAllocCnt
+ * @param   cameraIndex
+ * @param   hourSec
+ * @return  SUCCESS/FAIL
+ */
+static BOOL addRetentionListEntry(RETENTION_ENTRY_t **ppEntry, UINT32 *pEntryCnt, UINT32 *pAllocCnt, UINT8 cameraIndex, time_t hourSec)
+{
+    RETENTION_ENTRY_t *pNewEntry;
+
+    if (*pEntryCnt >= *pAllocCnt)
+    {
+        pNewEntry = realloc(*ppEntry, ((*pAllocCnt + RETENTION_HEAP_ALLOC_CNT) * RETENTION_ENTRY_SIZE));
+        if (pNewEntry == NULL)
+        {
+            EPRINT(DISK_MANAGER, "memory re-allocation failed: [camera=%d]", cameraIndex);
+            return FAIL;
+        }
+
+        *ppEntry = pNewEntry;
+        *pAllocCnt += RETENTION_HEAP_ALLOC_CNT;
+    }
+
+    memset(&(*ppEntry)[*pEntryCnt], 0, RETENTION_ENTRY_SIZE);
+    (*ppEntry)[*pEntryCnt].hourSec = (UINT32)hourSec;
+    (*ppEntry)[*pEntryCnt].cameraIndex = cameraIndex;
+    (*pEntryCnt)++;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function reads retention index file of mount point
+ * @param   mntPoint
+ * @param   ppEntry - Entries of file
+ * @param   pEntryCnt
+ * @param   pAllocCnt
+ * @param   pFileFd - Opened index file
+ * @return  SUCCESS if file is valid otherwise FAIL
+ */
+static BOOL readRetentionFile(CHARPTR mntPoint, RETENTION_ENTRY_t **ppEntry, UINT32 *pEntryCnt, UINT32 *pAllocCnt, INT32 *pFileFd)
+{
+    CHAR                fileName[MAX_FILE_NAME_SIZE];
+    UINT32              entryCnt;
+    struct stat         fileInfo;
+    RETENTION_FILE_HDR_t fileHdr;
+
+    snprintf(fileName, MAX_FILE_NAME_SIZE, "%s%s", mntPoint, RETENTION_INDEX_FILE);
+    *pFileFd = open(fileName, READ_WRITE_MODE, FILE_PERMISSION);
+    if (*pFileFd == INVALID_FILE_FD)
+    {
+        return FAIL;
+    }
+
+    if ((fstat(*pFileFd, &fileInfo) != STATUS_OK) || (read(*pFileFd, &fileHdr, RETENTION_FILE_HDR_SIZE) != (ssize_t)RETENTION_FILE_HDR_SIZE)
+            || (fileHdr.fileSign != RETENTION_FILE_SIGN) || (fileHdr.version != RETENTION_FILE_VERSION))
+    {
+        EPRINT(DISK_MANAGER, "invalid retention index file: [path=%s]", fileName);
+        CloseFileFd(pFileFd);
+        return FAIL;
+    }
+
+    /* Partially written last entry is ignored */
+    entryCnt = (fileInfo.st_size - RETENTION_FILE_HDR_SIZE) / RETENTION_ENTRY_SIZE;
+    if (entryCnt == 0)
+    {
         return SUCCESS;
     }
 
-    return FAIL;
+    *ppEntry = malloc(entryCnt * RETENTION_ENTRY_SIZE);
+    if (*ppEntry == NULL)
+    {
+        EPRINT(DISK_MANAGER, "memory allocation failed: [path=%s]", fileName);
+        CloseFileFd(pFileFd);
+        return FAIL;
+    }
+
+    if (read(*pFileFd, *ppEntry, (entryCnt * RETENTION_ENTRY_SIZE)) != (ssize_t)(entryCnt * RETENTION_ENTRY_SIZE))
+    {
+        EPRINT(DISK_MANAGER, "fail to read retention index file: [path=%s], [err=%s]", fileName, STR_ERR);
+        FREE_MEMORY(*ppEntry);
+        CloseFileFd(pFileFd);
+        return FAIL;
+    }
+
+    *pEntryCnt = entryCnt;
+    *pAllocCnt = entryCnt;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function writes retention index file of mount point with given entries. File is
+ *          written in temporary file first and then replaced.
+ * @param   mntPoint
+ * @param   pEntry
+ * @param   entryCnt
+ * @param   pFileFd - Opened index file
+ * @return  SUCCESS/FAIL
+ */
+static BOOL writeRetentionFile(CHARPTR mntPoint, RETENTION_ENTRY_t *pEntry, UINT32 entryCnt, INT32 *pFileFd)
+{
+    CHAR                    fileName[MAX_FILE_NAME_SIZE];
+    CHAR                    tempFileName[MAX_FILE_NAME_SIZE];
+    INT32                   fileFd;
+    RETENTION_FILE_HDR_t    fileHdr;
+
+    snprintf(fileName, MAX_FILE_NAME_SIZE, "%s%s", mntPoint, RETENTION_INDEX_FILE);
+    snprintf(tempFileName, MAX_FILE_NAME_SIZE, "%s%s", mntPoint, RETENTION_INDEX_TEMP_FILE);
+    fileFd = open(tempFileName, CREATE_RDWR_MODE | O_TRUNC, FILE_PERMISSION);
+    if (fileFd == INVALID_FILE_FD)
+    {
+        EPRINT(DISK_MANAGER, "fail to create retention index file: [path=%s], [err=%s]", tempFileName, STR_ERR);
+        return FAIL;
+    }
+
+    memset(&fileHdr, 0, RETENTION_FILE_HDR_SIZE);
+    fileHdr.fileSign = RETENTION_FILE_SIGN;
+    fileHdr.version = RETENTION_FILE_VERSION;
+    if ((write(fileFd, &fileHdr, RETENTION_FILE_HDR_SIZE) != (ssize_t)RETENTION_FILE_HDR_SIZE)
+            || ((entryCnt > 0) && (write(fileFd, pEntry, (entryCnt * RETENTION_ENTRY_SIZE)) != (ssize_t)(entryCnt * RETENTION_ENTRY_SIZE)))
+            || (fsync(fileFd) != STATUS_OK) || (rename(tempFileName, fileName) != STATUS_OK))
+    {
+        EPRINT(DISK_MANAGER, "fail to write retention index file: [path=%s], [err=%s]", tempFileName, STR_ERR);
+        close(fileFd);
+        unlink(tempFileName);
+        return FAIL;
+    }
+
+    CloseFileFd(pFileFd);
+    *pFileFd = fileFd;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function finds all hour folders of mount point to build retention index
+ * @param   mntPoint
+ * @param   ppEntry - Entries of hour folders
+ * @param   pEntryCnt
+ * @param   pAllocCnt
+ */
+static void scanRetentionHours(CHARPTR mntPoint, RETENTION_ENTRY_t **ppEntry, UINT32 *pEntryCnt, UINT32 *pAllocCnt)
+{
+    UINT8           cameraIndex;
+    UINT8           mon;
+    UINT64          date, year, hour;
+    CHAR            channelFolder[MAX_FILE_NAME_SIZE];
+    CHAR            dateFolder[MAX_FILE_NAME_SIZE];
+    CHAR            destFolder[MAX_FILE_NAME_SIZE];
+    CHARPTR         pFolderName;
+    time_t          hourSec;
+    struct tm       hourTm;
+    DIR             *channelDir;
+    DIR             *dateDir;
+    struct dirent   *channelEntry;
+    struct dirent   *dateEntry;
+
+    for (cameraIndex = 0; cameraIndex < getMaxCameraForCurrentVariant(); cameraIndex++)
+    {
+        snprintf(channelFolder, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL, mntPoint, GET_CAMERA_NO(cameraIndex));
+        channelDir = opendir(channelFolder);
+        if (channelDir == NULL)
+        {
+            continue;
+        }
+
+        while ((channelEntry = readdir(channelDir)) != NULL)
+        {
+            pFolderName = channelEntry->d_name;
+            if ((ParseStr(&pFolderName, TFP_CHARACTER, destFolder, MAX_FILE_NAME_SIZE) == FAIL) || (AsciiToInt(destFolder, &date) == FAIL))
+            {
+                continue;
+            }
+
+            if (ParseStr(&pFolderName, TFP_CHARACTER, destFolder, MAX_FILE_NAME_SIZE) == FAIL)
+            {
+                continue;
+            }
+
+            mon = GetMonthNo(destFolder);
+            if ((mon >= MAX_MONTH) || (AsciiToInt(pFolderName, &year) == FAIL))
+            {
+                continue;
+            }
+
+            snprintf(dateFolder, MAX_FILE_NAME_SIZE, "%s%s/", channelFolder, channelEntry->d_name);
+            dateDir = opendir(dateFolder);
+            if (dateDir == NULL)
+            {
+                continue;
+            }
+
+            while ((dateEntry = readdir(dateDir)) != NULL)
+            {
+                if ((AsciiToInt(dateEntry->d_name, &hour) == FAIL) || (hour >= HOUR_IN_ONE_DAY))
+                {
+                    continue;
+                }
+
+                memset(&hourTm, 0, sizeof(struct tm));
+                hourTm.tm_mday = date;
+                hourTm.tm_mon = mon;
+                hourTm.tm_year = year;
+                hourTm.tm_hour = hour;
+                if (ConvertLocalTimeInSec(&hourTm, &hourSec) == FAIL)
+                {
+                    continue;
+                }
+
+                addRetentionListEntry(ppEntry, pEntryCnt, pAllocCnt, cameraIndex, hourSec);
+            }
+            closedir(dateDir);
+        }
+        closedir(channelDir);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function adds hour folders created just before power failure whose entries were not
+ *          saved in retention index file. Only hours after last saved hour of camera are checked.
+ * @param   mntPoint
+ * @param   ppEntry - Entries of retention index file
+ * @param   pEntryCnt
+ * @param   pAllocCnt
+ * @return  TRUE if any entry was added otherwise FALSE
+ */
+static BOOL resyncRetentionHours(CHARPTR mntPoint, RETENTION_ENTRY_t **ppEntry, UINT32 *pEntryCnt, UINT32 *pAllocCnt)
+{
+    BOOL                addedF = FALSE;
+    UINT8               cameraIndex;
+    UINT8               hourCnt;
+    UINT32              entryIdx;
+    UINT32              lastHourSec[MAX_CAMERA];
+    CHAR                folderName[MAX_FILE_NAME_SIZE];
+    time_t              curTimeSec;
+    RETENTION_ENTRY_t   entry;
+
+    if (GetLocalTimeInSec(&curTimeSec) == FAIL)
+    {
+        return FALSE;
+    }
+
+    memset(lastHourSec, 0, sizeof(lastHourSec));
+    for (entryIdx = 0; entryIdx < *pEntryCnt; entryIdx++)
+    {
+        cameraIndex = (*ppEntry)[entryIdx].cameraIndex;
+        if ((cameraIndex < MAX_CAMERA) && (lastHourSec[cameraIndex] < (*ppEntry)[entryIdx].hourSec))
+        {
+            lastHourSec[cameraIndex] = (*ppEntry)[entryIdx].hourSec;
+        }
+    }
+
+    for (cameraIndex = 0; cameraIndex < getMaxCameraForCurrentVariant(); cameraIndex++)
+    {
+        if (lastHourSec[cameraIndex] == 0)
+        {
+            continue;
+        }
+
+        memset(&entry, 0, RETENTION_ENTRY_SIZE);
+        entry.cameraIndex = cameraIndex;
+        for (hourCnt = 1; hourCnt <= RETENTION_RESYNC_HOUR_MAX; hourCnt++)
+        {
+            entry.hourSec = lastHourSec[cameraIndex] + (hourCnt * SEC_IN_ONE_HOUR);
+            if ((time_t)entry.hourSec > curTimeSec)
+            {
+                break;
+            }
+
+            getRetentionFolderName(mntPoint, &entry, folderName);
+            if (access(folderName, F_OK) != STATUS_OK)
+            {
+                continue;
+            }
+
+            if (addRetentionListEntry(ppEntry, pEntryCnt, pAllocCnt, cameraIndex, entry.hourSec) == SUCCESS)
+            {
+                addedF = TRUE;
+            }
+        }
+    }
+
+    return addedF;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function loads retention index of mount point from its index file. Index file is
+ *          built by scanning hour folders when it is not present. Until index is loaded, oldest
+ *          folder of volume is found by scanning folders.
+ * @param   mntPoint
+ */
+void LoadRetentionIndex(CHARPTR mntPoint)
+{
+    BOOL                writeFileF = FALSE;
+    UINT8               indexId;
+    INT32               fileFd = INVALID_FILE_FD;
+    UINT32              entryIdx, entryCnt = 0, allocCnt = 0;
+    RETENTION_ENTRY_t   *pEntry = NULL;
+    RETENTION_INDEX_t   *pIndex;
+
+    MUTEX_LOCK(retentionIndexLock);
+    pIndex = getRetentionIndex(mntPoint);
+    if (pIndex == NULL)
+    {
+        for (indexId = 0; indexId < RETENTION_INDEX_MAX; indexId++)
+        {
+            if (retentionIndex[indexId].mntPoint[0] == '\0')
+            {
+                pIndex = &retentionIndex[indexId];
+                snprintf(pIndex->mntPoint, MOUNT_POINT_SIZE, "%s", mntPoint);
+                break;
+            }
+        }
+
+        if (pIndex == NULL)
+        {
+            MUTEX_UNLOCK(retentionIndexLock);
+            EPRINT(DISK_MANAGER, "no free retention index: [path=%s]", mntPoint);
+            return;
+        }
+    }
+
+    /* Hours added while index is loaded are kept in heap and merged after load */
+    pIndex->readyF = FALSE;
+    pIndex->entryCnt = 0;
+    pIndex->logEntryCnt = 0;
+    CloseFileFd(&pIndex->fileFd);
+    MUTEX_UNLOCK(retentionIndexLock);
+
+    if (readRetentionFile(mntPoint, &pEntry, &entryCnt, &allocCnt, &fileFd) == SUCCESS)
+    {
+        writeFileF = resyncRetentionHours(mntPoint, &pEntry, &entryCnt, &allocCnt);
+    }
+    else
+    {
+        DPRINT(DISK_MANAGER, "retention index building started: [path=%s]", mntPoint);
+        scanRetentionHours(mntPoint, &pEntry, &entryCnt, &allocCnt);
+        writeFileF = TRUE;
+    }
+
+    if ((writeFileF == TRUE) && (writeRetentionFile(mntPoint, pEntry, entryCnt, &fileFd) == FAIL))
+    {
+        FREE_MEMORY(pEntry);
+        CloseFileFd(&fileFd);
+        return;
+    }
+
+    MUTEX_LOCK(retentionIndexLock);
+    pIndex->fileFd = fileFd;
+    pIndex->logEntryCnt = entryCnt;
+    for (entryIdx = 0; entryIdx < pIndex->entryCnt; entryIdx++)
+    {
+        if (Utils_pWrite(pIndex->fileFd, &pIndex->pHeap[entryIdx], RETENTION_ENTRY_SIZE,
+                         RETENTION_FILE_HDR_SIZE + ((off_t)pIndex->logEntryCnt * RETENTION_ENTRY_SIZE), NULL) == (ssize_t)RETENTION_ENTRY_SIZE)
+        {
+            pIndex->logEntryCnt++;
+        }
+    }
+
+    for (entryIdx = 0; entryIdx < entryCnt; entryIdx++)
+    {
+        if (pushRetentionEntry(pIndex, &pEntry[entryIdx]) == FAIL)
+        {
+            break;
+        }
+    }
+
+    pIndex->readyF = (entryIdx == entryCnt) ? TRUE : FALSE;
+    MUTEX_UNLOCK(retentionIndexLock);
+    FREE_MEMORY(pEntry);
+    DPRINT(DISK_MANAGER, "retention index loaded: [path=%s], [hours=%d]", mntPoint, entryCnt);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function adds newly created hour folder in retention index of mount point
+ * @param   mntPoint
+ * @param   cameraIndex
+ * @param   pHourTm - Time of hour folder
+ */
+void AddRetentionHour(CHARPTR mntPoint, UINT8 cameraIndex, struct tm *pHourTm)
+{
+    struct tm           hourTm = *pHourTm;
+    time_t              hourSec;
+    RETENTION_ENTRY_t   entry;
+    RETENTION_INDEX_t   *pIndex;
+
+    hourTm.tm_min = 0;
+    hourTm.tm_sec = 0;
+    if (ConvertLocalTimeInSec(&hourTm, &hourSec) == FAIL)
+    {
+        return;
+    }
+
+    memset(&entry, 0, RETENTION_ENTRY_SIZE);
+    entry.hourSec = (UINT32)hourSec;
+    entry.cameraIndex = cameraIndex;
+
+    MUTEX_LOCK(retentionIndexLock);
+    pIndex = getRetentionIndex(mntPoint);
+    if ((pIndex == NULL) || (pushRetentionEntry(pIndex, &entry) == FAIL))
+    {
+        MUTEX_UNLOCK(retentionIndexLock);
+        return;
+    }
+
+    /* Entry is saved in file when index is loaded otherwise it will be saved at end of load */
+    if ((pIndex->readyF == TRUE) && (pIndex->fileFd != INVALID_FILE_FD))
+    {
+        if (Utils_pWrite(pIndex->fileFd, &entry, RETENTION_ENTRY_SIZE,
+                         RETENTION_FILE_HDR_SIZE + ((off_t)pIndex->logEntryCnt * RETENTION_ENTRY_SIZE), NULL) != (ssize_t)RETENTION_ENTRY_SIZE)
+        {
+            EPRINT(DISK_MANAGER, "fail to write retention index file: [path=%s], [err=%s]", mntPoint, STR_ERR);
+        }
+        else
+        {
+            pIndex->logEntryCnt++;
+        }
+    }
+    MUTEX_UNLOCK(retentionIndexLock);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function gives oldest hour folder of given volumes from retention index. Entries
+ *          of folders which are already removed or must be skipped are dropped from index.
+ * @param   deleteVolumeMask
+ * @param   pOldestDisk
+ * @param   pOldestCameraIndex
+ * @param   pOldestFolderTime
+ * @return  SUCCESS if index of all volumes is loaded otherwise FAIL
+ */
+static BOOL getRetentionOldestHour(UINT32 deleteVolumeMask, UINT8 *pOldestDisk, UINT8 *pOldestCameraIndex, time_t *pOldestFolderTime)
+{
+    UINT32              diskCnt, totalDisk;
+    CHAR                mntPoint[MOUNT_POINT_SIZE];
+    CHAR                folderName[MAX_FILE_NAME_SIZE];
+    CHAR                skipFileName[MAX_FILE_NAME_SIZE];
+    RETENTION_ENTRY_t   *pOldestEntry = NULL;
+    RETENTION_INDEX_t   *pIndex;
+
+    *pOldestFolderTime = 0;
+    totalDisk = GetTotalMediaNo(MAX_RECORDING_MODE);
+
+    MUTEX_LOCK(retentionIndexLock);
+    for (diskCnt = 0; diskCnt < totalDisk; diskCnt++)
+    {
+        /* Skip current volume if it is not part of the current group */
+        if (FALSE == GET_BIT(deleteVolumeMask, diskCnt))
+        {
+            continue;
+        }
+
+        if (GetMountPointFromDiskId(diskCnt, mntPoint, MAX_RECORDING_MODE) == FAIL)
+        {
+            continue;
+        }
+
+        pIndex = getRetentionIndex(mntPoint);
+        if ((pIndex == NULL) || (pIndex->readyF == FALSE))
+        {
+            MUTEX_UNLOCK(retentionIndexLock);
+            return FAIL;
+        }
+
+        while (pIndex->entryCnt > 0)
+        {
+            getRetentionFolderName(mntPoint, &pIndex->pHeap[0], folderName);
+            snprintf(skipFileName, MAX_FILE_NAME_SIZE, "%s%s", folderName, SKIPP_FILE);
+
+            /* PARASOFT : No need to validate file path */
+            if (access(folderName, F_OK) != STATUS_OK)
+            {
+                popRetentionEntry(pIndex);
+                continue;
+            }
+
+            if ((access(skipFileName, F_OK) == STATUS_OK) || (CheckSkipOldestFolder(folderName) == SUCCESS))
+            {
+                EPRINT(DISK_MANAGER, "oldest folder should skip: [path=%s]", folderName);
+                popRetentionEntry(pIndex);
+                continue;
+            }
+
+            break;
+        }
+
+        if ((pIndex->entryCnt > 0) && ((pOldestEntry == NULL) || (isRetentionEntryOlder(&pIndex->pHeap[0], pOldestEntry) == TRUE)))
+        {
+            pOldestEntry = &pIndex->pHeap[0];
+            *pOldestDisk = diskCnt;
+            *pOldestCameraIndex = pOldestEntry->cameraIndex;
+            *pOldestFolderTime = pOldestEntry->hourSec;
+        }
+    }
+    MUTEX_UNLOCK(retentionIndexLock);
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function removes hour folder selected for cleanup from retention index. Index file is
+ *          compacted when it has much more entries than index.
+ * @param   mntPoint
+ * @param   cameraIndex
+ * @param   hourSec
+ */
+static void removeRetentionHour(CHARPTR mntPoint, UINT8 cameraIndex, time_t hourSec)
+{
+    RETENTION_INDEX_t *pIndex;
+
+    MUTEX_LOCK(retentionIndexLock);
+    pIndex = getRetentionIndex(mntPoint);
+    if ((pIndex == NULL) || (pIndex->readyF == FALSE) || (pIndex->entryCnt == 0))
+    {
+        MUTEX_UNLOCK(retentionIndexLock);
+        return;
+    }
+
+    /* Entry which is not on top is dropped when its folder is found removed */
+    if ((pIndex->pHeap[0].cameraIndex == cameraIndex) && ((time_t)pIndex->pHeap[0].hourSec == hourSec))
+    {
+        popRetentionEntry(pIndex);
+    }
+
+    if (pIndex->logEntryCnt > ((pIndex->entryCnt * 2) + RETENTION_HEAP_ALLOC_CNT))
+    {
+        if (writeRetentionFile(mntPoint, pIndex->pHeap, pIndex->entryCnt, &pIndex->fileFd) == SUCCESS)
+        {
+            pIndex->logEntryCnt = pIndex->entryCnt;
+        }
+    }
+    MUTEX_UNLOCK(retentionIndexLock);
 }
 
 //-------------------------------------------------------------------------------------------------
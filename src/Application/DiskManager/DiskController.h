@@ -85,6 +85,10 @@ void UpdateRecordingMedia(UINT8 mediaType);
 //-------------------------------------------------------------------------------------------------
 BOOL CleanupRecordFileByDay(void);
 //-------------------------------------------------------------------------------------------------
+void LoadRetentionIndex(CHARPTR mntPoint);
+//-------------------------------------------------------------------------------------------------
+void AddRetentionHour(CHARPTR mntPoint, UINT8 cameraIndex, struct tm *pHourTm);
+//-------------------------------------------------------------------------------------------------
 BOOL CleanupBkupFileByDay(void);
 //-------------------------------------------------------------------------------------------------
 void StopBackUpCleanUp(void);
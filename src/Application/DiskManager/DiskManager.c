@@ -31,6 +31,8 @@
 #define STREAM_EXTN					".stm"
 #define STREAM_EXTN_OVLP			".ostm"
 #define YEAR_MAP_FILE_EXTN			".yrid"
+#define REC_CATALOG_FILE_EXTN		".ctlg"
+#define REC_CATALOG_TEMP_FILE_EXTN	".ctlg.tmp"
 #define BUILD_INDEX_INFO_FILE_NAME	"buildStatus.info"
 #define STREAM_FILE_NOT_COMPLETE	"~00_00_00"
 
@@ -113,6 +115,34 @@
 // time index file header information size
 #define	TIMEIDX_FILE_HDR_SIZE	(sizeof(METADATA_FILE_HDR_t))
 
+// recording catalog file sign
+#define	REC_CATALOG_FILE_SIGN		(0x0702)
+
+// recording catalog file version
+#define	REC_CATALOG_FILE_VERSION	(0x0001)
+
+// recording catalog header and entry size
+#define	REC_CATALOG_HDR_SIZE		(sizeof(REC_CATALOG_HDR_t))
+#define	REC_CATALOG_ENTRY_SIZE		(sizeof(REC_CATALOG_ENTRY_t))
+
+// catalog index of event which is not placed in catalog yet
+#define	REC_CATALOG_INVALID_IDX		(0xFFFFFFFF)
+
+// no hour was written in catalog since rebuild of catalog was started
+#define	REC_CATALOG_INVALID_HOUR	(0xFFFFFFFF)
+
+// catalog entries read at a time while scanning catalog
+#define	REC_CATALOG_CHUNK_ENTRY_CNT	(256)
+
+// maximum catalog entries loaded for single search, beyond this hour folders are walked
+#define	REC_CATALOG_VIEW_ENTRY_MAX	(65536)
+
+// maximum hours re-read at the end of rebuild for events written by recording meanwhile
+#define	REC_CATALOG_RESYNC_HOUR_MAX	(24)
+
+// start of hour in which event was started
+#define	GET_REC_CATALOG_HOUR(timeSec)	((timeSec) - ((timeSec) % SEC_IN_ONE_HOUR))
+
 // start code of FSH
 #define FSH_START_CODE			(100)
 
@@ -122,6 +152,10 @@
 /* Assigned max memory to avoid memory reallocation during frame read */
 #define DEFUALT_PLAYBACK_SIZE	(MAX_STREAM_FRAME_LENGTH)
 
+// read ahead window of stream file and i-frame file for playback session
+#define PLAYBACK_STRM_READ_AHEAD_SIZE	(512 * KILO_BYTE)
+#define PLAYBACK_IFRM_READ_AHEAD_SIZE	(256 * IFRAME_FIELD_SIZE)
+
 #define AVI_EXTENTION			".avi"
 #define AVI_INCOMP_EXTENTION    "_incomplete.avi"
 #define MAX_AVI_FILE_SIZE		(2000 * MEGA_BYTE)
@@ -154,12 +188,23 @@
 #define BACKUP_TASK_CHUNK_SLEEP_USEC    (5000)
 #endif
 
+/* Channels of volume are recovered in parallel by recovery workers */
+#if defined(RK3588_NVRH)
+#define RECOVERY_WORKER_MAX             4
+#else
+#define RECOVERY_WORKER_MAX             2
+#endif
+
 /* Define different thread stack size */
 #define AVI_CON_THREAD_STACK_SZ         (2*MEGA_BYTE)
+#define RECOVERY_WORKER_THREAD_STACK_SZ (0*MEGA_BYTE)
 #define WRITTER_THREAD_STACK_SZ         (0*MEGA_BYTE)
 #define SRCH_RECORD_THREAD_STACK_SZ     (0*MEGA_BYTE)
 #define BACKUP_THREAD_STACK_SZ          (2*MEGA_BYTE)
 
+/* One writer shard per storage allocation group, so that each volume group is flushed independently */
+#define DM_WRITER_SHARD_MAX             STORAGE_ALLOCATION_GROUP_MAX
+
 //#################################################################################################
 // @DATA TYPES
 //#################################################################################################
@@ -171,6 +216,14 @@ typedef enum
 
 }AVI_CONVERT_TYPE_e;
 
+typedef struct
+{
+    UINT8           shardId;
+    pthread_t       threadId;
+    pthread_cond_t  condSignal;     // Wake up writer shard to flush buffered data of its channels
+
+}DM_WRITER_SHARD_t;
+
 // Buffering of data
 typedef struct
 {
@@ -338,8 +391,85 @@ typedef struct
     UINT32      eventIdx;
     EVNT_INFO_t evntInfo;
 
+    // Position of event in recording catalog
+    UINT32      catalogIdx;
+
 }EVENT_INDEX_HEADER_t;
 
+// Header of recording catalog. Catalog keeps all events of a camera for a year on a volume, so that
+// event search does not need to walk every hour folder.
+typedef struct
+{
+    UINT32 				fileSign : 16;
+    UINT32 				version : 16;
+    UINT32 				entryCnt;
+
+    // catalog has events of all recording of this year (built or created before first recording)
+    UINT32 				completeF : 8;
+
+    // entries are in order of hour and event index (order breaks when system time goes back)
+    UINT32 				sortedF : 8;
+    UINT32				reserved : 16;
+
+}REC_CATALOG_HDR_t;
+
+typedef struct
+{
+    EVNT_INFO_t 		evntInfo;
+
+    // start of hour in which event was started and event index in event file of that hour
+    UINT32 				hourSec;
+    UINT32 				eventIdx;
+
+    // hour folder of this event was removed
+    UINT32 				removedF : 8;
+    UINT32				reserved : 24;
+
+}REC_CATALOG_ENTRY_t;
+
+typedef struct
+{
+    // catalog in which events of recording are placed
+    INT32   fileFd;
+    CHAR    fileName[MAX_FILE_NAME_SIZE];
+
+    // oldest hour written in any catalog of camera since catalog rebuild was started
+    UINT32  dirtyHourSec;
+
+}REC_CATALOG_FILE_INFO_t;
+
+// Catalog entries of one volume which falls in search duration
+typedef struct
+{
+    BOOL                loadedF;
+    BOOL                validF;
+    UINT32              entryCnt;
+    UINT32              entryPos;
+    REC_CATALOG_ENTRY_t *pEntry;
+
+}REC_CATALOG_VIEW_t;
+
+typedef struct
+{
+    UINT8               channelNo;
+    time_t              startHourSec;
+    time_t              stopTimeSec;
+    REC_CATALOG_VIEW_t  view[MAX_RECORDING_MODE][MAX_VOLUME];
+
+}REC_CATALOG_SEARCH_t;
+
+// Events of an hour are read from catalog when it is valid for volume otherwise from event file of hour folder
+typedef struct
+{
+    REC_CATALOG_VIEW_t  *pView;
+    time_t              hourSec;
+    INT32               evntFileFd;
+    UINT32              curEventIdx;
+    UINT32              eventCnt;
+    CHAR                evntFileName[MAX_FILE_NAME_SIZE];
+
+}HOUR_EVENT_READER_t;
+
 // This structure define session of Disk Manager
 typedef struct
 {
@@ -365,6 +495,7 @@ typedef struct
     EVNT_FILE_INFO_t 		evntFileInfo;
     TIME_IDX_FILE_INFO_t 	timeIdxFileInfo;
     YEAR_MAP_FILE_INFO_t	yearMapFileInfo;
+    REC_CATALOG_FILE_INFO_t catalogFileInfo;
 
     /* Disk Manager buffer */
     BUFFER_t                mDmBufferMngr;
@@ -414,6 +545,15 @@ typedef struct
 
 }PLYBACK_BUFFER_t;
 
+typedef struct
+{
+    UINT8PTR    buffPtr;
+    UINT32      buffSize;
+    UINT32      startPos;
+    UINT32      dataLen;
+
+}PLAY_READ_AHEAD_t;
+
 // This structure define session of playback
 typedef struct
 {
@@ -447,6 +587,14 @@ typedef struct
     PLAY_INFO_t 		playInfo;
     PLYBACK_BUFFER_t	playBuff;
 
+    // read ahead window of stream file and i-frame file
+    PLAY_READ_AHEAD_t	strmReadAhead;
+    PLAY_READ_AHEAD_t	iFrmReadAhead;
+
+    // frames given and disk reads done by session
+    UINT32				frameCnt;
+    UINT32				diskReadCnt;
+
 }PLAYBACK_SESSION_t;
 
 // Used for stored and retrive recovery information
@@ -541,6 +689,19 @@ typedef struct
 
 }STORAGE_CALC_INFO_t;
 
+typedef struct
+{
+    CHAR                mntPoint[MOUNT_POINT_SIZE];
+    RECORD_ON_DISK_e    diskId;
+    GENERAL_CONFIG_t    generalCfg;
+    pthread_mutex_t     workMutex;
+    UINT8               nextChannel;        /* Next channel to be taken by worker */
+    UINT8               doneChannelCnt;
+    BOOL                diskFaultF;
+    UINT32              startTick;
+
+}RECOVERY_WORK_t;
+
 typedef struct
 {
     UINT8           recordMap[MAX_RESULT_FOR_HOUR_IN_BYTES];
@@ -627,8 +788,12 @@ static BOOL terMetaDataFiles(UINT8 channelNo, BOOL eventFileTerFlg, BOOL timeIdx
 //-------------------------------------------------------------------------------------------------
 static BOOL enqueFrame(UINT8 channelNo, UINT8PTR streamData, UINT32 streamLen, METADATA_INFO_t *metaData, UINT32PTR pErrorCode);
 //-------------------------------------------------------------------------------------------------
+static BOOL writeMediaFrame(UINT8PTR streamData, UINT32 streamLen, UINT8 channelNo, METADATA_INFO_t *metaData, UINT32PTR pErrorCode);
+//-------------------------------------------------------------------------------------------------
 static VOIDPTR writterThread(VOIDPTR threadParam);
 //-------------------------------------------------------------------------------------------------
+static UINT8 getChannelWriterShard(UINT8 channelNo);
+//-------------------------------------------------------------------------------------------------
 static VOIDPTR aviConverter(VOIDPTR threadParam);
 //-------------------------------------------------------------------------------------------------
 static void closeAllFileOnHddErr(void);
@@ -647,7 +812,7 @@ static BOOL updateStreamFile(BUFFER_t *fileInfo, UINT32PTR pErrorCode);
 //-------------------------------------------------------------------------------------------------
 static BOOL updateIFrameFile(BUFFER_t *fileInfo, UINT32PTR pErrorCode);
 //-------------------------------------------------------------------------------------------------
-static BOOL updateEventFile(EVENT_INDEX_HEADER_t *eventInfo, EVNT_FILE_INFO_t *eventFileInfo, UINT32PTR pErrorCode);
+static BOOL updateEventFile(UINT8 channelNo, EVENT_INDEX_HEADER_t *eventInfo, EVNT_FILE_INFO_t *eventFileInfo, UINT32PTR pErrorCode);
 //-------------------------------------------------------------------------------------------------
 static BOOL updateEventFileHeader(EVNT_FILE_INFO_t *eventFileInfo, UINT32PTR pErrorCode);
 //-------------------------------------------------------------------------------------------------
@@ -679,6 +844,12 @@ static BOOL recoverTimeIdxFile(CHARPTR path, UINT32PTR pErrorCode);
 //-------------------------------------------------------------------------------------------------
 static BOOL recoverStreamFile(CHARPTR fileName, UINT32PTR pErrorCode);
 //-------------------------------------------------------------------------------------------------
+static BOOL recoverChannelFolders(CHARPTR mntPoint, RECORD_ON_DISK_e iDiskId, UINT8 channelCnt, GENERAL_CONFIG_t *pGeneralCfg);
+//-------------------------------------------------------------------------------------------------
+static VOIDPTR recoveryWorkerThread(VOIDPTR threadArg);
+//-------------------------------------------------------------------------------------------------
+static void runRecoveryWork(RECOVERY_WORK_t *pWork);
+//-------------------------------------------------------------------------------------------------
 static void clearRecDataForDrive(RECORD_ON_DISK_e disk, UINT8 camCnt);
 //-------------------------------------------------------------------------------------------------
 static BOOL getLatestHourFolder(CHARPTR mntPoint, UINT8 channelNo, CHARPTR newestFolder, RECOVERY_INFO_t *recoveryInfo, UINT32PTR pErrorCode);
@@ -724,6 +895,11 @@ static void getPlayBackDir(PLAY_SESSION_ID playId, CHARPTR playDir);
 //-------------------------------------------------------------------------------------------------
 static void getPlayBackPosition(PLAY_SESSION_ID playId, UINT8PTR startFile, UINT32PTR startPos);
 //-------------------------------------------------------------------------------------------------
+static BOOL readPlaybackFile(PLAYBACK_SESSION_t *pPlaySession, PLAY_READ_AHEAD_t *pReadAhead, INT32 fileFd,
+                             UINT32 filePos, VOIDPTR pData, UINT32 dataLen, BOOL reverseF);
+//-------------------------------------------------------------------------------------------------
+static void freePlaybackReadAhead(PLAYBACK_SESSION_t *pPlaySession);
+//-------------------------------------------------------------------------------------------------
 static void prepareBackUpFileName(CHARPTR fileName, SEARCH_RESULT_t *record, CHARPTR mountPoint);
 //-------------------------------------------------------------------------------------------------
 static void appendBackUpEndTime(CHARPTR oldfileName, CHARPTR newfileName, struct tm *endTime);
@@ -752,6 +928,51 @@ static BOOL searchSingleChannelPresence(SEARCH_CRITERIA_t *pSeachCriteria);
 //-------------------------------------------------------------------------------------------------
 static time_t searchStartTimePresence(SEARCH_CRITERIA_t *pSeachCriteria);
 //-------------------------------------------------------------------------------------------------
+static BOOL isRecIndexBuildDone(CHARPTR mntPoint);
+//-------------------------------------------------------------------------------------------------
+static BOOL createRecCatalog(CHARPTR fileName, BOOL completeF);
+//-------------------------------------------------------------------------------------------------
+static BOOL readRecCatalogHdr(INT32 fileFd, REC_CATALOG_HDR_t *pCatalogHdr);
+//-------------------------------------------------------------------------------------------------
+static BOOL findRecCatalogHour(INT32 fileFd, UINT32 entryCnt, time_t hourSec, UINT32PTR pEntryIdx);
+//-------------------------------------------------------------------------------------------------
+static BOOL writeRecCatalogEntry(INT32 fileFd, REC_CATALOG_ENTRY_t *pCatalogEntry, UINT32PTR pCatalogIdx);
+//-------------------------------------------------------------------------------------------------
+static void resetRecCatalogIdx(UINT8 channelNo);
+//-------------------------------------------------------------------------------------------------
+static void markRecCatalogDirty(UINT8 channelNo, UINT32 hourSec);
+//-------------------------------------------------------------------------------------------------
+static BOOL openRecCatalog(UINT8 channelNo, UINT32 year);
+//-------------------------------------------------------------------------------------------------
+static void updateRecCatalog(UINT8 channelNo, EVENT_INDEX_HEADER_t *eventInfo);
+//-------------------------------------------------------------------------------------------------
+static void createYearRecCatalog(CHARPTR mntPoint, UINT8 channelNo, UINT32 year);
+//-------------------------------------------------------------------------------------------------
+static void removeRecCatalogHour(CHARPTR mntPoint, UINT8 channelNo, RECOVERY_INFO_t *pRecveryInfo);
+//-------------------------------------------------------------------------------------------------
+static BOOL readRecCatalogHourEntries(CHARPTR hourFolder, REC_CATALOG_ENTRY_t **ppEntry, UINT32PTR pEntryCnt, UINT32PTR pAllocCnt);
+//-------------------------------------------------------------------------------------------------
+static void recoverRecCatalog(CHARPTR mntPoint, CHARPTR path, UINT8 channelNo, RECOVERY_INFO_t *pRecveryInfo);
+//-------------------------------------------------------------------------------------------------
+static int compareRecCatalogEntry(const void *pEntry1, const void *pEntry2);
+//-------------------------------------------------------------------------------------------------
+static BOOL writeRecCatalogFile(INT32 fileFd, REC_CATALOG_ENTRY_t *pEntry, UINT32 startIdx, UINT32 entryCnt);
+//-------------------------------------------------------------------------------------------------
+static BOOL buildYearRecCatalog(CHARPTR mntPoint, UINT8 channelNo, UINT32 year);
+//-------------------------------------------------------------------------------------------------
+static void initRecCatalogSearch(REC_CATALOG_SEARCH_t *pSearch, UINT8 channelNo, time_t startHourSec, time_t stopTimeSec);
+//-------------------------------------------------------------------------------------------------
+static void deInitRecCatalogSearch(REC_CATALOG_SEARCH_t *pSearch);
+//-------------------------------------------------------------------------------------------------
+static BOOL loadRecCatalogView(REC_CATALOG_SEARCH_t *pSearch, RECORD_ON_DISK_e recDrive, UINT8 diskCnt, REC_CATALOG_VIEW_t *pView);
+//-------------------------------------------------------------------------------------------------
+static BOOL openHourEventReader(REC_CATALOG_SEARCH_t *pSearch, UINT8 diskCnt, RECORD_ON_DISK_e recDrive,
+                                struct tm *pHourTm, time_t hourSec, HOUR_EVENT_READER_t *pReader);
+//-------------------------------------------------------------------------------------------------
+static BOOL readHourEvent(HOUR_EVENT_READER_t *pReader, EVNT_INFO_t *pEventInfo);
+//-------------------------------------------------------------------------------------------------
+static void closeHourEventReader(HOUR_EVENT_READER_t *pReader);
+//-------------------------------------------------------------------------------------------------
 //#################################################################################################
 // @STATIC VARIABLES
 //#################################################################################################
@@ -782,8 +1003,17 @@ static pthread_cond_t		testFtpCond = PTHREAD_COND_INITIALIZER;
 //Mutex for conditional variables
 static pthread_mutex_t 		dmCondMutex = PTHREAD_MUTEX_INITIALIZER;
 
-// This signal used to wake up writter thread to flush buffer data into files.
-static pthread_cond_t 		dmCondSignal = PTHREAD_COND_INITIALIZER;
+// Writer shards, each one flushes buffer data of channels mapped to its storage allocation group
+static DM_WRITER_SHARD_t    writerShard[DM_WRITER_SHARD_MAX];
+
+/* Channel file I/O of writer shards and record writers is done under read lock. Disk fault handling takes
+ * write lock, hence all shards are paused while files of all channels are closed on disk fault */
+static pthread_rwlock_t     diskFaultLock = PTHREAD_RWLOCK_WRITER_NONRECURSIVE_INITIALIZER_NP;
+
+/* Fault latch: incremented under write lock when files of all channels are closed on disk fault. Writer thread
+ * takes snapshot when it starts file I/O, error of I/O started before latest fault handling is not a new fault */
+static UINT32               diskFaultEpoch = 0;
+static __thread UINT32      ioDiskFaultEpoch = 0;
 
 static RECORD_DATA_t		recordInfo[MAX_MONTH];
 
@@ -796,20 +1026,24 @@ static DM_SESSION_t 		sessionInfo[MAX_CAMERA];
 static PLAYBACK_SESSION_t 	playSession[MAX_CAMERA + 1];
 static pthread_mutex_t 		playbckSessionMutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t      buildInfoFileLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t      recCatalogBuildLock = PTHREAD_MUTEX_INITIALIZER;
 
 /* this is 64 bit variable which is used for checking which channel has to dump its buffered data into file */
 static BOOL 				channelWriterStatus[MAX_CAMERA];
 static BOOL                 channelHourSlotChange[MAX_CAMERA];
 
+/* Writer shard of channel, it is latched when channel buffer is handed over to writer */
+static UINT8                channelWriterShard[MAX_CAMERA];
+
 // thread terminating flag
 static BOOL 				dmTerminateFlg;
 
-// disk manager thread id
-static pthread_t			dmThreadId;
-
 // recovery status
 static BOOL					recoveryStatus;
 
+// number of volumes whose recovery is running
+static UINT8                recoveryActiveCnt;
+
 // mutex lock for recovery
 static pthread_mutex_t 		recoveryMutex  = PTHREAD_MUTEX_INITIALIZER;
 
@@ -850,6 +1084,7 @@ static BOOL (*searchFuncPtr[]) (SEARCH_THREAD_INFO_t *searchThreadInfo) =
 BOOL InitDiskManager(void)
 {
     UINT8 chnlId;
+    UINT8 shardId;
 
     // First read file duration
     ReadGeneralConfig(&aviRecGenConfig);
@@ -862,14 +1097,13 @@ BOOL InitDiskManager(void)
         MUTEX_INIT(serchThread[chnlId].srchMutex, NULL);
     }
 
-    // Initialise conditional variable for writer thread
-    pthread_cond_init(&dmCondSignal, NULL);
     MUTEX_INIT(recDataMutex, NULL);
 
     for(chnlId = 0; chnlId < MAX_CAMERA; chnlId++)
     {
         channelWriterStatus[chnlId] = FALSE;
         channelHourSlotChange[chnlId] = FALSE;
+        channelWriterShard[chnlId] = 0;
         sessionInfo[chnlId].sessionStatus = OFF;
         sessionInfo[chnlId].firstFrameRec = FALSE;
         sessionInfo[chnlId].overlapFlg = 0;
@@ -884,6 +1118,9 @@ BOOL InitDiskManager(void)
         sessionInfo[chnlId].evntFileInfo.fileFd = INVALID_FILE_FD;
         sessionInfo[chnlId].timeIdxFileInfo.fileFd = INVALID_FILE_FD;
         sessionInfo[chnlId].yearMapFileInfo.mapFileFd = INVALID_FILE_FD;
+        sessionInfo[chnlId].catalogFileInfo.fileFd = INVALID_FILE_FD;
+        sessionInfo[chnlId].catalogFileInfo.fileName[0] = '\0';
+        sessionInfo[chnlId].catalogFileInfo.dirtyHourSec = REC_CATALOG_INVALID_HOUR;
 
         memset(&sessionInfo[chnlId].frameMetaData, 0, sizeof(METADATA_INFO_t));
         sessionInfo[chnlId].frameLen = 0;
@@ -893,12 +1130,19 @@ BOOL InitDiskManager(void)
     MUTEX_INIT(buildInfoFileLock, NULL);
     dmTerminateFlg = FALSE;
 
-    //creates a thread for flushing stream data into corresponding files
-    if (FAIL == Utils_CreateThread(&dmThreadId, writterThread, NULL, JOINABLE_THREAD, WRITTER_THREAD_STACK_SZ))
+    //creates writer shard threads for flushing stream data into corresponding files
+    for(shardId = 0; shardId < DM_WRITER_SHARD_MAX; shardId++)
     {
-        EPRINT(DISK_MANAGER, "fail to create writterThread");
+        writerShard[shardId].shardId = shardId;
+        pthread_cond_init(&writerShard[shardId].condSignal, NULL);
+        if (FAIL == Utils_CreateThread(&writerShard[shardId].threadId, writterThread, &writerShard[shardId], JOINABLE_THREAD, WRITTER_THREAD_STACK_SZ))
+        {
+            EPRINT(DISK_MANAGER, "fail to create writterThread: [shard=%d]", shardId);
+            writerShard[shardId].threadId = 0;
+        }
     }
-    else if ((aviRecGenConfig.recordFormatType == REC_AVI_FORMAT) || (aviRecGenConfig.recordFormatType == REC_BOTH_FORMAT))
+
+    if ((aviRecGenConfig.recordFormatType == REC_AVI_FORMAT) || (aviRecGenConfig.recordFormatType == REC_BOTH_FORMAT))
     {
         MUTEX_INIT(aviConvertParam.aviCnvrtCondMutex, NULL);
         pthread_cond_init(&aviConvertParam.aviCnvrtCondSignal, NULL);
@@ -925,16 +1169,27 @@ BOOL InitDiskManager(void)
  */
 BOOL DeInitDiskManager(void)
 {
+    UINT8 shardId;
+
     /* Deinit all play sessions */
     deInitPlaySession();
 
-    // terminate writterThread
+    // terminate all writer shards
     MUTEX_LOCK(dmCondMutex);
     dmTerminateFlg = TRUE;
-    pthread_cond_signal(&dmCondSignal);
+    for(shardId = 0; shardId < DM_WRITER_SHARD_MAX; shardId++)
+    {
+        pthread_cond_signal(&writerShard[shardId].condSignal);
+    }
     MUTEX_UNLOCK(dmCondMutex);
 
-    pthread_join(dmThreadId, NULL);
+    for(shardId = 0; shardId < DM_WRITER_SHARD_MAX; shardId++)
+    {
+        if (writerShard[shardId].threadId != 0)
+        {
+            pthread_join(writerShard[shardId].threadId, NULL);
+        }
+    }
     DPRINT(DISK_MANAGER, "Disk Manager De-Initialize successfully");
     return SUCCESS;
 }
@@ -1246,6 +1501,7 @@ static BOOL createRecordFolder(UINT8 channelNo, struct tm *curTime, UINT32PTR pE
     else if(aviRecGenConfig.recordFormatType == REC_AVI_FORMAT)
     {
         /* No need to create other metadata files for other than native recordings */
+        AddRetentionHour(mntPoint, channelNo, curTime);
         return SUCCESS;
     }
     else if(createEventFile(curTime, channelNo, pErrorCode) == FAIL)
@@ -1262,6 +1518,7 @@ static BOOL createRecordFolder(UINT8 channelNo, struct tm *curTime, UINT32PTR pE
     }
     else
     {
+        AddRetentionHour(mntPoint, channelNo, curTime);
         return SUCCESS;
     }
 
@@ -1281,6 +1538,8 @@ static BOOL createRecordFolder(UINT8 channelNo, struct tm *curTime, UINT32PTR pE
  */
 static void flushWriteBuff(UINT8 channelNo, BOOL streamTerFlg, BOOL iFrmTerFlg, struct tm *curTime, BOOL hourSlotChng)
 {
+    UINT8 shardId = getChannelWriterShard(channelNo);
+
     sessionInfo[channelNo].mDmBufferMngr.streamFileFd = sessionInfo[channelNo].streamFileInfo.fileFd;
     sessionInfo[channelNo].mDmBufferMngr.prevStreamPos = sessionInfo[channelNo].streamFileInfo.prevFshPos;
     sessionInfo[channelNo].mDmBufferMngr.nextStreamPos = sessionInfo[channelNo].streamFileInfo.nextFshPos;
@@ -1311,15 +1570,43 @@ static void flushWriteBuff(UINT8 channelNo, BOOL streamTerFlg, BOOL iFrmTerFlg,
     MUTEX_UNLOCK(sessionInfo[channelNo].mDmBufferMngr.buffMutex);
 
     MUTEX_LOCK(dmCondMutex);
+    /* Keep the channel on same shard until its pending buffer is flushed */
+    if (FALSE == channelWriterStatus[channelNo])
+    {
+        channelWriterShard[channelNo] = shardId;
+    }
     channelWriterStatus[channelNo] = TRUE;
     if(hourSlotChng == TRUE)
     {
         channelHourSlotChange[channelNo] = TRUE;
     }
-    pthread_cond_signal(&dmCondSignal);
+    pthread_cond_signal(&writerShard[channelWriterShard[channelNo]].condSignal);
     MUTEX_UNLOCK(dmCondMutex);
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Get writer shard of channel. Channels are sharded by storage allocation group of local
+ *          disk, hence slow volume does not stall flushing of channels recording on other volumes.
+ * @param   channelNo
+ * @return  Writer shard id
+ */
+static UINT8 getChannelWriterShard(UINT8 channelNo)
+{
+    UINT8           volGrpId;
+    HDD_CONFIG_t    hddConfig;
+
+    ReadHddConfig(&hddConfig);
+    if (hddConfig.recordDisk != LOCAL_HARD_DISK)
+    {
+        /* All channels are recorded on same network drive */
+        return 0;
+    }
+
+    volGrpId = GetCameraStorageAllocationGroup(channelNo, hddConfig.mode);
+    return (volGrpId < DM_WRITER_SHARD_MAX) ? volGrpId : 0;
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   This function terminates metadata files as per closing state given in input.
@@ -1342,7 +1629,7 @@ static BOOL terMetaDataFiles(UINT8 channelNo, BOOL eventFileTerFlg, BOOL timeIdx
         sessionInfo[channelNo].mScheduleEvent.evntInfo.endTime = sessionInfo[channelNo].streamFileInfo.localTime.totalSec;
         sessionInfo[channelNo].mScheduleEvent.evntInfo.stopFileId = sessionInfo[channelNo].streamFileInfo.streamFileIdx;
         sessionInfo[channelNo].mScheduleEvent.evntInfo.stopStreamPos = sessionInfo[channelNo].streamFileInfo.prevFshPos;
-        if (updateEventFile(&sessionInfo[channelNo].mScheduleEvent, &sessionInfo[channelNo].evntFileInfo, pErrorCode) == FAIL)
+        if (updateEventFile(channelNo, &sessionInfo[channelNo].mScheduleEvent, &sessionInfo[channelNo].evntFileInfo, pErrorCode) == FAIL)
         {
             EPRINT(DISK_MANAGER, "fail to update schedule event: [camera=%d]", channelNo);
             return FAIL;
@@ -1360,7 +1647,7 @@ static BOOL terMetaDataFiles(UINT8 channelNo, BOOL eventFileTerFlg, BOOL timeIdx
         sessionInfo[channelNo].mManualEvent.evntInfo.stopFileId = sessionInfo[channelNo].streamFileInfo.streamFileIdx;
         sessionInfo[channelNo].mManualEvent.evntInfo.stopStreamPos = sessionInfo[channelNo].streamFileInfo.prevFshPos;
 
-        if (updateEventFile(&sessionInfo[channelNo].mManualEvent, &sessionInfo[channelNo].evntFileInfo, pErrorCode) == FAIL)
+        if (updateEventFile(channelNo, &sessionInfo[channelNo].mManualEvent, &sessionInfo[channelNo].evntFileInfo, pErrorCode) == FAIL)
         {
             EPRINT(DISK_MANAGER, "fail to update manual event: [camera=%d]", channelNo);
             return FAIL;
@@ -1378,7 +1665,7 @@ static BOOL terMetaDataFiles(UINT8 channelNo, BOOL eventFileTerFlg, BOOL timeIdx
         sessionInfo[channelNo].mAlarmEvent.evntInfo.stopFileId = sessionInfo[channelNo].streamFileInfo.streamFileIdx;
         sessionInfo[channelNo].mAlarmEvent.evntInfo.stopStreamPos = sessionInfo[channelNo].streamFileInfo.prevFshPos;
 
-        if (updateEventFile(&sessionInfo[channelNo].mAlarmEvent, &sessionInfo[channelNo].evntFileInfo, pErrorCode) == FAIL)
+        if (updateEventFile(channelNo, &sessionInfo[channelNo].mAlarmEvent, &sessionInfo[channelNo].evntFileInfo, pErrorCode) == FAIL)
         {
             EPRINT(DISK_MANAGER, "fail to update alarm event: [camera=%d]", channelNo);
             return FAIL;
@@ -1396,7 +1683,7 @@ static BOOL terMetaDataFiles(UINT8 channelNo, BOOL eventFileTerFlg, BOOL timeIdx
         sessionInfo[channelNo].mCosecEvent.evntInfo.stopFileId = sessionInfo[channelNo].streamFileInfo.streamFileIdx;
         sessionInfo[channelNo].mCosecEvent.evntInfo.stopStreamPos = sessionInfo[channelNo].streamFileInfo.prevFshPos;
 
-        if (updateEventFile(&sessionInfo[channelNo].mCosecEvent, &sessionInfo[channelNo].evntFileInfo, pErrorCode) == FAIL)
+        if (updateEventFile(channelNo, &sessionInfo[channelNo].mCosecEvent, &sessionInfo[channelNo].evntFileInfo, pErrorCode) == FAIL)
         {
             EPRINT(DISK_MANAGER, "fail to update cosec event: [camera=%d]", channelNo);
             return FAIL;
@@ -1599,7 +1886,8 @@ static BOOL enqueFrame(UINT8 channelNo, UINT8PTR streamData, UINT32 streamLen, M
                 sessionInfo[channelNo].mScheduleEvent.evntInfo.stopStreamPos = 0;
                 sessionInfo[channelNo].mScheduleEvent.evntInfo.overLapFlg = sessionInfo[channelNo].overlapFlg;
                 sessionInfo[channelNo].mScheduleEvent.evntInfo.reserved = 0;
-                if (updateEventFile(&sessionInfo[channelNo].mScheduleEvent, evntFileInfo, pErrorCode) == FAIL)
+                sessionInfo[channelNo].mScheduleEvent.catalogIdx = REC_CATALOG_INVALID_IDX;
+                if (updateEventFile(channelNo, &sessionInfo[channelNo].mScheduleEvent, evntFileInfo, pErrorCode) == FAIL)
                 {
                     EPRINT(DISK_MANAGER, "fail to update schedule event: [camera=%d]", channelNo);
                     return FAIL;
@@ -1623,7 +1911,7 @@ static BOOL enqueFrame(UINT8 channelNo, UINT8PTR streamData, UINT32 streamLen, M
             sessionInfo[channelNo].mScheduleEvent.evntInfo.stopStreamPos = strmFileInfo->prevFshPos;
 
             // generate schedule stop event for this recording.
-            if (updateEventFile(&sessionInfo[channelNo].mScheduleEvent, evntFileInfo, pErrorCode) == FAIL)
+            if (updateEventFile(channelNo, &sessionInfo[channelNo].mScheduleEvent, evntFileInfo, pErrorCode) == FAIL)
             {
                 EPRINT(DISK_MANAGER, "fail to update schedule event: [camera=%d]", channelNo);
                 return FAIL;
@@ -1651,7 +1939,8 @@ static BOOL enqueFrame(UINT8 channelNo, UINT8PTR streamData, UINT32 streamLen, M
                 sessionInfo[channelNo].mManualEvent.evntInfo.stopStreamPos = 0;
                 sessionInfo[channelNo].mManualEvent.evntInfo.overLapFlg = sessionInfo[channelNo].overlapFlg;
                 sessionInfo[channelNo].mManualEvent.evntInfo.reserved = 0;
-                if(updateEventFile(&sessionInfo[channelNo].mManualEvent, evntFileInfo, pErrorCode) == FAIL)
+                sessionInfo[channelNo].mManualEvent.catalogIdx = REC_CATALOG_INVALID_IDX;
+                if(updateEventFile(channelNo, &sessionInfo[channelNo].mManualEvent, evntFileInfo, pErrorCode) == FAIL)
                 {
                     EPRINT(DISK_MANAGER, "fail to update manual event: [camera=%d]", channelNo);
                     return FAIL;
@@ -1673,7 +1962,7 @@ static BOOL enqueFrame(UINT8 channelNo, UINT8PTR streamData, UINT32 streamLen, M
             sessionInfo[channelNo].mManualEvent.evntInfo.endTime = metaData->localTime.totalSec;
             sessionInfo[channelNo].mManualEvent.evntInfo.stopFileId = strmFileInfo->streamFileIdx;
             sessionInfo[channelNo].mManualEvent.evntInfo.stopStreamPos = strmFileInfo->prevFshPos;
-            if(updateEventFile(&sessionInfo[channelNo].mManualEvent, evntFileInfo, pErrorCode) == FAIL)
+            if(updateEventFile(channelNo, &sessionInfo[channelNo].mManualEvent, evntFileInfo, pErrorCode) == FAIL)
             {
                 EPRINT(DISK_MANAGER, "fail to update manual event: [camera=%d]", channelNo);
                 return FAIL;
@@ -1701,7 +1990,8 @@ static BOOL enqueFrame(UINT8 channelNo, UINT8PTR streamData, UINT32 streamLen, M
                 sessionInfo[channelNo].mAlarmEvent.evntInfo.stopStreamPos = 0;
                 sessionInfo[channelNo].mAlarmEvent.evntInfo.overLapFlg = sessionInfo[channelNo].overlapFlg;
                 sessionInfo[channelNo].mAlarmEvent.evntInfo.reserved = 0;
-                if(updateEventFile(&sessionInfo[channelNo].mAlarmEvent, evntFileInfo, pErrorCode) == FAIL)
+                sessionInfo[channelNo].mAlarmEvent.catalogIdx = REC_CATALOG_INVALID_IDX;
+                if(updateEventFile(channelNo, &sessionInfo[channelNo].mAlarmEvent, evntFileInfo, pErrorCode) == FAIL)
                 {
                     EPRINT(DISK_MANAGER, "fail to update alarm event: [camera=%d]", channelNo);
                     return FAIL;
@@ -1723,7 +2013,7 @@ static BOOL enqueFrame(UINT8 channelNo, UINT8PTR streamData, UINT32 streamLen, M
             sessionInfo[channelNo].mAlarmEvent.evntInfo.endTime = metaData->localTime.totalSec;
             sessionInfo[channelNo].mAlarmEvent.evntInfo.stopFileId = strmFileInfo->streamFileIdx;
             sessionInfo[channelNo].mAlarmEvent.evntInfo.stopStreamPos = strmFileInfo->prevFshPos;
-            if(updateEventFile(&sessionInfo[channelNo].mAlarmEvent, evntFileInfo, pErrorCode) == FAIL)
+            if(updateEventFile(channelNo, &sessionInfo[channelNo].mAlarmEvent, evntFileInfo, pErrorCode) == FAIL)
             {
                 EPRINT(DISK_MANAGER, "fail to update alarm event: [camera=%d]", channelNo);
                 return FAIL;
@@ -1751,7 +2041,8 @@ static BOOL enqueFrame(UINT8 channelNo, UINT8PTR streamData, UINT32 streamLen, M
                 sessionInfo[channelNo].mCosecEvent.evntInfo.stopStreamPos = 0;
                 sessionInfo[channelNo].mCosecEvent.evntInfo.overLapFlg = sessionInfo[channelNo].overlapFlg;
                 sessionInfo[channelNo].mCosecEvent.evntInfo.reserved = 0;
-                if(updateEventFile(&sessionInfo[channelNo].mCosecEvent, evntFileInfo, pErrorCode) == FAIL)
+                sessionInfo[channelNo].mCosecEvent.catalogIdx = REC_CATALOG_INVALID_IDX;
+                if(updateEventFile(channelNo, &sessionInfo[channelNo].mCosecEvent, evntFileInfo, pErrorCode) == FAIL)
                 {
                     EPRINT(DISK_MANAGER, "fail to update cosec event: [camera=%d]", channelNo);
                     return FAIL;
@@ -1773,7 +2064,7 @@ static BOOL enqueFrame(UINT8 channelNo, UINT8PTR streamData, UINT32 streamLen, M
             sessionInfo[channelNo].mCosecEvent.evntInfo.endTime = metaData->localTime.totalSec;
             sessionInfo[channelNo].mCosecEvent.evntInfo.stopFileId = strmFileInfo->streamFileIdx;
             sessionInfo[channelNo].mCosecEvent.evntInfo.stopStreamPos = strmFileInfo->prevFshPos;
-            if(updateEventFile(&sessionInfo[channelNo].mCosecEvent, evntFileInfo, pErrorCode) == FAIL)
+            if(updateEventFile(channelNo, &sessionInfo[channelNo].mCosecEvent, evntFileInfo, pErrorCode) == FAIL)
             {
                 EPRINT(DISK_MANAGER, "fail to update cosec event: [camera=%d]", channelNo);
                 return FAIL;
@@ -1874,6 +2165,29 @@ BOOL GetDmBufferState(UINT8 channelNo)
  * @return  SUCCESS/FAIL
  */
 BOOL WriteMediaFrame(UINT8PTR streamData, UINT32 streamLen, UINT8 channelNo, METADATA_INFO_t *metaData, UINT32PTR pErrorCode)
+{
+    BOOL retVal;
+
+    /* Frame must not be written while disk fault handler closes files of all channels */
+    pthread_rwlock_rdlock(&diskFaultLock);
+    ioDiskFaultEpoch = diskFaultEpoch;
+    retVal = writeMediaFrame(streamData, streamLen, channelNo, metaData, pErrorCode);
+    pthread_rwlock_unlock(&diskFaultLock);
+    return retVal;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function buffers the stream data with FSH header and dumps buffered data into file.
+ *          It must be called with disk fault read lock.
+ * @param   streamData - Stream data which is to be written into file.
+ * @param   streamLen - Stream Length
+ * @param   channelNo
+ * @param   metaData - Metadata provides information while making FSH for this stream.
+ * @param   pErrorCode - Error code pointer filled with appropiate error code in case of any failure on Disk operation(eg read, write, mkdir etc..)
+ * @return  SUCCESS/FAIL
+ */
+static BOOL writeMediaFrame(UINT8PTR streamData, UINT32 streamLen, UINT8 channelNo, METADATA_INFO_t *metaData, UINT32PTR pErrorCode)
 {
     BOOL					retVal = FAIL;
     BOOL					strFileCloseF;
@@ -2128,6 +2442,7 @@ BOOL WriteMediaFrame(UINT8PTR streamData, UINT32 streamLen, UINT8 channelNo, MET
                     return FAIL;
                 }
 
+                createYearRecCatalog(mntPoint, channelNo, brokenTime.tm_year);
                 CloseFileFd(&dmSession->yearMapFileInfo.mapFileFd);
                 dmSession->yearMapFileInfo.mapFileFd = mapFileFd;
                 dmSession->yearMapFileInfo.lastDateIdx = 0;
@@ -2417,6 +2732,7 @@ BOOL WriteMediaFrame(UINT8PTR streamData, UINT32 streamLen, UINT8 channelNo, MET
                     return FAIL;
                 }
 
+                createYearRecCatalog(mntPoint, channelNo, brokenTime.tm_year);
                 CloseFileFd(&dmSession->yearMapFileInfo.mapFileFd);
                 dmSession->yearMapFileInfo.mapFileFd = mapFileFd;
             }
@@ -3890,6 +4206,8 @@ NET_CMD_STATUS_e OpenPlaySession(PLAY_CNTRL_INFO_t *playInfo, PLAY_TYPE_e playTy
 
         *sessionId = sessionIdx;
         playSess->playBuff.buffSize = DEFUALT_PLAYBACK_SIZE;
+        playSess->frameCnt = 0;
+        playSess->diskReadCnt = 0;
         DPRINT(DISK_MANAGER, "playback session opened: [camera=%d], [session=%d], [startFileId=%d], [stopFileId=%d]",
                camIndex, sessionIdx, playSess->startFileId, playSess->stopFileId);
     } while(0);
@@ -3931,12 +4249,14 @@ BOOL ClosePlaySession(PLAY_SESSION_ID sessionId)
     CloseFileFd(&playSession[sessionId].playInfo.streamFileFd);
     CloseFileFd(&playSession[sessionId].playInfo.iFrmFileFd);
     FREE_MEMORY(playSession[sessionId].playBuff.buffPtr);
+    freePlaybackReadAhead(&playSession[sessionId]);
     playSession[sessionId].playBuff.buffSize = 0;
     playSession[sessionId].playCntrl.recStorageType = MAX_RECORDING_MODE;
     playSession[sessionId].playStatus = OFF;
     MUTEX_UNLOCK(playbckSessionMutex);
 
-    DPRINT(DISK_MANAGER, "playback session closed: [session=%d]", sessionId);
+    DPRINT(DISK_MANAGER, "playback session closed: [session=%d], [frames=%d], [diskReads=%d]",
+           sessionId, playSession[sessionId].frameCnt, playSession[sessionId].diskReadCnt);
     return SUCCESS;
 }
 
@@ -4107,6 +4427,8 @@ BOOL SetPlayPosition(struct tm *playPos, UINT16 mSec, UINT8 audioEnbl, PLAYBACK_
     /* close previously open stream file and i frame file */
     CloseFileFd(&pPlayInfo->streamFileFd);
     CloseFileFd(&pPlayInfo->iFrmFileFd);
+    pPlaySession->strmReadAhead.dataLen = 0;
+    pPlaySession->iFrmReadAhead.dataLen = 0;
 
     /* get information of stream file id, stream position for given position of this record */
     if (getStreamFileName(pPlaySession->playDir, pPlayInfo->streamFileIdx, pPlayInfo->streamFileName, &pPlayInfo->fileEndPos) == FAIL)
@@ -4285,6 +4607,88 @@ static void getPlayBackPosition(PLAY_SESSION_ID playId, UINT8PTR startFile, UINT
     }
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function reads data of playback file through read ahead window of session. Window is
+ *          filled with one large read, so FSH, payload and next FSH of frames (and i-frame fields) are
+ *          mostly given from memory. In reverse play, window is filled around the position so that
+ *          previous i-frames are also covered.
+ * @param   pPlaySession
+ * @param   pReadAhead - Read ahead window of file
+ * @param   fileFd - File descriptor of file
+ * @param   filePos - Position of data in file
+ * @param   pData - Buffer for data
+ * @param   dataLen - Length of data
+ * @param   reverseF - TRUE if file is read in reverse order
+ * @return  SUCCESS if complete data is read otherwise FAIL
+ */
+static BOOL readPlaybackFile(PLAYBACK_SESSION_t *pPlaySession, PLAY_READ_AHEAD_t *pReadAhead, INT32 fileFd,
+                             UINT32 filePos, VOIDPTR pData, UINT32 dataLen, BOOL reverseF)
+{
+    UINT32  fillPos;
+    ssize_t readCnt;
+
+    /* Data is present in read ahead window */
+    if ((pReadAhead->dataLen > 0) && (filePos >= pReadAhead->startPos)
+            && ((filePos + dataLen) <= (pReadAhead->startPos + pReadAhead->dataLen)))
+    {
+        memcpy(pData, pReadAhead->buffPtr + (filePos - pReadAhead->startPos), dataLen);
+        return SUCCESS;
+    }
+
+    if (pReadAhead->buffPtr == NULL)
+    {
+        pReadAhead->buffSize = (pReadAhead == &pPlaySession->iFrmReadAhead) ? PLAYBACK_IFRM_READ_AHEAD_SIZE : PLAYBACK_STRM_READ_AHEAD_SIZE;
+        pReadAhead->buffPtr = malloc(pReadAhead->buffSize);
+        pReadAhead->dataLen = 0;
+    }
+
+    pPlaySession->diskReadCnt++;
+
+    /* Data bigger than window is read directly */
+    if ((pReadAhead->buffPtr == NULL) || (dataLen > (pReadAhead->buffSize / 2)))
+    {
+        return (pread(fileFd, pData, dataLen, filePos) == (ssize_t)dataLen) ? SUCCESS : FAIL;
+    }
+
+    fillPos = filePos;
+    if (reverseF == TRUE)
+    {
+        fillPos = (filePos > (pReadAhead->buffSize / 2)) ? (filePos - (pReadAhead->buffSize / 2)) : 0;
+    }
+
+    pReadAhead->dataLen = 0;
+    readCnt = pread(fileFd, pReadAhead->buffPtr, pReadAhead->buffSize, fillPos);
+    if (readCnt <= 0)
+    {
+        return FAIL;
+    }
+
+    pReadAhead->startPos = fillPos;
+    pReadAhead->dataLen = readCnt;
+    if ((filePos + dataLen) > (pReadAhead->startPos + pReadAhead->dataLen))
+    {
+        /* File is not having complete data */
+        return FAIL;
+    }
+
+    memcpy(pData, pReadAhead->buffPtr + (filePos - pReadAhead->startPos), dataLen);
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function frees read ahead windows of playback session
+ * @param   pPlaySession
+ */
+static void freePlaybackReadAhead(PLAYBACK_SESSION_t *pPlaySession)
+{
+    FREE_MEMORY(pPlaySession->strmReadAhead.buffPtr);
+    pPlaySession->strmReadAhead.dataLen = 0;
+    FREE_MEMORY(pPlaySession->iFrmReadAhead.buffPtr);
+    pPlaySession->iFrmReadAhead.dataLen = 0;
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   This function reads a media frame from current open file at current position and move
@@ -4305,6 +4709,7 @@ BOOL ReadRecordFrame(PLAY_SESSION_ID sessionId, PLAYBACK_CMD_e playCmd, NW_FRAME
     INT32 					payloadSize;
     UINT32 					initFrameLen = 0;
     UINT32 					iFrmOffset;
+    UINT32 					fshPos;
     VOIDPTR					tempPtr;
     PLAYBACK_SESSION_t 		*pPlaySession;
     PLAY_INFO_t 			*playInfo;
@@ -4355,16 +4760,10 @@ BOOL ReadRecordFrame(PLAY_SESSION_ID sessionId, PLAYBACK_CMD_e playCmd, NW_FRAME
                     playInfo->iFrameIdx += 1;
                 }
 
-                iFrmOffset = ((playInfo->iFrameIdx * IFRAME_FIELD_SIZE) + IFRAME_FILE_HDR_SIZE);
-                if (lseek(playInfo->iFrmFileFd, iFrmOffset, SEEK_SET) != iFrmOffset)
-                {
-                    EPRINT(DISK_MANAGER, "fail to seek i-frame file: [session=%d], [err=%s]", sessionId, STR_ERR);
-                    *errorCode = PLAYBACK_FILE_READ_OVER;
-                    return FAIL;
-                }
-
                 /* read i frame information and get stream file index number and stream file position */
-                if (read(playInfo->iFrmFileFd, &iFrmField, sizeof(IFRM_FIELD_INFO_t)) != IFRAME_FIELD_SIZE)
+                iFrmOffset = ((playInfo->iFrameIdx * IFRAME_FIELD_SIZE) + IFRAME_FILE_HDR_SIZE);
+                if (readPlaybackFile(pPlaySession, &pPlaySession->iFrmReadAhead, playInfo->iFrmFileFd,
+                                     iFrmOffset, &iFrmField, IFRAME_FIELD_SIZE, FALSE) == FAIL)
                 {
                     DPRINT(DISK_MANAGER, "i-frame playback over: [session=%d], [iFrmFileFd=%d], [err=%s]", sessionId, playInfo->iFrmFileFd, STR_ERR);
                     *errorCode = PLAYBACK_FILE_READ_OVER;
@@ -4384,6 +4783,7 @@ BOOL ReadRecordFrame(PLAY_SESSION_ID sessionId, PLAYBACK_CMD_e playCmd, NW_FRAME
                 {
                     /* close privously open stream file */
                     CloseFileFd(&playInfo->streamFileFd);
+                    pPlaySession->strmReadAhead.dataLen = 0;
 
                     playInfo->streamFileIdx = iFrmField.strmFileId;
 
@@ -4406,16 +4806,11 @@ BOOL ReadRecordFrame(PLAY_SESSION_ID sessionId, PLAYBACK_CMD_e playCmd, NW_FRAME
                 }
 
                 playInfo->curStreamPos = iFrmField.curStrmPos;
-                /* set stream file position */
-                if(lseek(playInfo->streamFileFd, playInfo->curStreamPos, SEEK_SET) != (playInfo->curStreamPos))
-                {
-                    EPRINT(DISK_MANAGER, "fail to seek stream file: [session=%d], [err=%s]", sessionId, STR_ERR);
-                    *errorCode = PLAYBACK_FILE_READ_ERROR;
-                    return FAIL;
-                }
 
                 /* read FSh from current stream file position */
-                if(read(playInfo->streamFileFd, fshData, MAX_FSH_SIZE) != MAX_FSH_SIZE)
+                fshPos = playInfo->curStreamPos;
+                if (readPlaybackFile(pPlaySession, &pPlaySession->strmReadAhead, playInfo->streamFileFd,
+                                     fshPos, fshData, MAX_FSH_SIZE, FALSE) == FAIL)
                 {
                     EPRINT(DISK_MANAGER, "fail to read stream file: [session=%d], [err=%s]", sessionId, STR_ERR);
                     *errorCode = PLAYBACK_FILE_READ_ERROR;
@@ -4442,6 +4837,7 @@ BOOL ReadRecordFrame(PLAY_SESSION_ID sessionId, PLAYBACK_CMD_e playCmd, NW_FRAME
                         {
                             /* close previously open stream file */
                             CloseFileFd(&playInfo->streamFileFd);
+                            pPlaySession->strmReadAhead.dataLen = 0;
 
                             /* get stream file name and file size */
                             if(getStreamFileName(pPlaySession->playDir, playInfo->streamFileIdx, playInfo->streamFileName, &playInfo->fileEndPos) == FAIL)
@@ -4473,19 +4869,13 @@ BOOL ReadRecordFrame(PLAY_SESSION_ID sessionId, PLAYBACK_CMD_e playCmd, NW_FRAME
                         }
                     }
 
-                    /* set stream file position */
-                    if(lseek(playInfo->streamFileFd, playInfo->curStreamPos, SEEK_SET) != (playInfo->curStreamPos))
-                    {
-                        EPRINT(DISK_MANAGER, "fail to seek stream file: [session=%d], [path=%s], [position=%d], [err=%s]",
-                               sessionId, playInfo->streamFileName, playInfo->curStreamPos, STR_ERR);
-                        *errorCode = PLAYBACK_FILE_READ_ERROR;
-                        return FAIL;
-                    }
-
                     /* read FSH and check this media is type of audio then discard this media and move to next FSH position till video is not detected */
-                    if(read(playInfo->streamFileFd, fshData, MAX_FSH_SIZE) != MAX_FSH_SIZE)
+                    fshPos = playInfo->curStreamPos;
+                    if (readPlaybackFile(pPlaySession, &pPlaySession->strmReadAhead, playInfo->streamFileFd,
+                                         fshPos, fshData, MAX_FSH_SIZE, FALSE) == FAIL)
                     {
-                        EPRINT(DISK_MANAGER, "fail to read stream file: [session=%d], [err=%s]", sessionId, STR_ERR);
+                        EPRINT(DISK_MANAGER, "fail to read stream file: [session=%d], [path=%s], [position=%d], [err=%s]",
+                               sessionId, playInfo->streamFileName, fshPos, STR_ERR);
                         *errorCode = PLAYBACK_FILE_READ_ERROR;
                         return FAIL;
                     }
@@ -4541,7 +4931,8 @@ BOOL ReadRecordFrame(PLAY_SESSION_ID sessionId, PLAYBACK_CMD_e playCmd, NW_FRAME
 
             if (payloadSize > 0)
             {
-                if (read(playInfo->streamFileFd, pPlaySession->playBuff.buffPtr + initFrameLen, payloadSize) != payloadSize)
+                if (readPlaybackFile(pPlaySession, &pPlaySession->strmReadAhead, playInfo->streamFileFd,
+                                     fshPos + MAX_FSH_SIZE, pPlaySession->playBuff.buffPtr + initFrameLen, payloadSize, FALSE) == FAIL)
                 {
                     EPRINT(DISK_MANAGER, "fail to read stream file: [session=%d], [err=%s]", sessionId, STR_ERR);
                     *errorCode = PLAYBACK_FILE_READ_ERROR;
@@ -4551,7 +4942,8 @@ BOOL ReadRecordFrame(PLAY_SESSION_ID sessionId, PLAYBACK_CMD_e playCmd, NW_FRAME
 
             if((playInfo->curStreamPos + MAX_FSH_SIZE) < playInfo->fileEndPos)
             {
-                if (pread(playInfo->streamFileFd, &nextFshInfo, MAX_FSH_SIZE, playInfo->nextFshPos) != (INT32)MAX_FSH_SIZE)
+                if (readPlaybackFile(pPlaySession, &pPlaySession->strmReadAhead, playInfo->streamFileFd,
+                                     playInfo->nextFshPos, &nextFshInfo, MAX_FSH_SIZE, FALSE) == FAIL)
                 {
                     EPRINT(DISK_MANAGER, "fail to pread stream file: [session=%d], [err=%s]", sessionId, STR_ERR);
                     *errorCode = PLAYBACK_FILE_READ_ERROR;
@@ -4567,6 +4959,7 @@ BOOL ReadRecordFrame(PLAY_SESSION_ID sessionId, PLAYBACK_CMD_e playCmd, NW_FRAME
             /* give payload size as output parameter */
             *frameData = pPlaySession->playBuff.buffPtr;
             *frameLen = (payloadSize + initFrameLen);
+            pPlaySession->frameCnt++;
 
             /* Stop the playback if local time is bigger than playback time */
             if ((time_t)fshData->localTime.totalSec > pPlaySession->playStopTime)
@@ -4612,15 +5005,10 @@ BOOL ReadRecordFrame(PLAY_SESSION_ID sessionId, PLAYBACK_CMD_e playCmd, NW_FRAME
 
             /* calculate i frame index position from i frame index number */
             iFrmOffset = ((playInfo->iFrameIdx * IFRAME_FIELD_SIZE) + IFRAME_FILE_HDR_SIZE);
-            if (lseek(playInfo->iFrmFileFd, iFrmOffset, SEEK_SET) != iFrmOffset)
-            {
-                EPRINT(DISK_MANAGER, "fail to seek i-frame file: [session=%d], [err=%s]", sessionId, STR_ERR);
-                *errorCode = PLAYBACK_FILE_READ_OVER;
-                return FAIL;
-            }
 
             /* read i frame information get stream file index number and stream file position */
-            if (read(playInfo->iFrmFileFd, &iFrmField, IFRAME_FIELD_SIZE) != IFRAME_FIELD_SIZE)
+            if (readPlaybackFile(pPlaySession, &pPlaySession->iFrmReadAhead, playInfo->iFrmFileFd,
+                                 iFrmOffset, &iFrmField, IFRAME_FIELD_SIZE, TRUE) == FAIL)
             {
                 EPRINT(DISK_MANAGER, "fail to read i-frame file: [session=%d], [err=%s]", sessionId, STR_ERR);
                 *errorCode = PLAYBACK_FILE_READ_ERROR;
@@ -4639,6 +5027,7 @@ BOOL ReadRecordFrame(PLAY_SESSION_ID sessionId, PLAYBACK_CMD_e playCmd, NW_FRAME
             {
                 /* close privously open stream file */
                 CloseFileFd(&playInfo->streamFileFd);
+                pPlaySession->strmReadAhead.dataLen = 0;
 
                 /* get stream file name */
                 playInfo->streamFileIdx = iFrmField.strmFileId;
@@ -4662,16 +5051,10 @@ BOOL ReadRecordFrame(PLAY_SESSION_ID sessionId, PLAYBACK_CMD_e playCmd, NW_FRAME
             /* update new stream position in stream file */
             playInfo->curStreamPos = iFrmField.curStrmPos;
 
-            /* go to current stream position in stream file set file position */
-            if (lseek(playInfo->streamFileFd, playInfo->curStreamPos, SEEK_SET) != (playInfo->curStreamPos))
-            {
-                EPRINT(DISK_MANAGER, "fail to seek stream file: [session=%d], [err=%s]", sessionId, STR_ERR);
-                *errorCode = PLAYBACK_FILE_READ_ERROR;
-                return FAIL;
-            }
-
             /* read fsh information from current file position */
-            if (read(playInfo->streamFileFd, fshData, MAX_FSH_SIZE) != MAX_FSH_SIZE)
+            fshPos = playInfo->curStreamPos;
+            if (readPlaybackFile(pPlaySession, &pPlaySession->strmReadAhead, playInfo->streamFileFd,
+                                 fshPos, fshData, MAX_FSH_SIZE, TRUE) == FAIL)
             {
                 EPRINT(DISK_MANAGER, "fail to read stream file: [session=%d], [err=%s]", sessionId, STR_ERR);
                 *errorCode = PLAYBACK_FILE_READ_ERROR;
@@ -4724,7 +5107,8 @@ BOOL ReadRecordFrame(PLAY_SESSION_ID sessionId, PLAYBACK_CMD_e playCmd, NW_FRAME
 
             if(payloadSize > 0)
             {
-                if (read(playInfo->streamFileFd, pPlaySession->playBuff.buffPtr + initFrameLen, payloadSize) != (INT32)payloadSize)
+                if (readPlaybackFile(pPlaySession, &pPlaySession->strmReadAhead, playInfo->streamFileFd,
+                                     fshPos + MAX_FSH_SIZE, pPlaySession->playBuff.buffPtr + initFrameLen, payloadSize, TRUE) == FAIL)
                 {
                     EPRINT(DISK_MANAGER, "fail to read stream file: [session=%d], [err=%s]", sessionId, STR_ERR);
                     *errorCode = PLAYBACK_FILE_READ_ERROR;
@@ -4737,6 +5121,7 @@ BOOL ReadRecordFrame(PLAY_SESSION_ID sessionId, PLAYBACK_CMD_e playCmd, NW_FRAME
             /* give payload size as output parameter */
             *frameData = pPlaySession->playBuff.buffPtr;
             *frameLen = payloadSize + initFrameLen;
+            pPlaySession->frameCnt++;
 
             /* Stop the playback if local time is smaller than playback time */
             if((time_t)fshData->localTime.totalSec < pPlaySession->playStartTime)
@@ -4836,13 +5221,15 @@ static void closeChnlFiles(UINT8 iChnlNo)
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   This function was thread call back function for disk manager module. This function writes
- *          data into corresponding file of all channel. After written data thread goes into sleep state.
- * @param   threadParam
+ * @brief   This function was thread call back function for disk manager writer shard. This function
+ *          writes data into corresponding file of all channels of the shard. After written data thread
+ *          goes into sleep state till any channel of the shard is ready for flush.
+ * @param   threadParam - Writer shard info
  * @return  SUCCESS/FAIL
  */
 static VOIDPTR writterThread(VOIDPTR threadParam)
 {
+    DM_WRITER_SHARD_t       *pShard = (DM_WRITER_SHARD_t *)threadParam;
     BOOL					status = FAIL;
     UINT32                  tErrorCode = INVALID_ERROR_CODE;
     UINT8 					channelCnt, volGrpId;
@@ -4851,9 +5238,10 @@ static VOIDPTR writterThread(VOIDPTR threadParam)
     BUFFER_t				*writeChannel;
     AVI_CONVERTER_MSG_t		aviMsg;
     HDD_CONFIG_t			hddConfig;
+    UINT32                  hddConfigVersion = CONFIG_VERSION_INVALID;
     UINT8                   storageUpdateCnt;
 
-    THREAD_START("DM WRITER");
+    THREAD_START_INDEX2("DM WRITER", pShard->shardId);
 
     setpriority(PRIO_PROCESS, PRIO_PROCESS, -1);
     writerChannelMax = getMaxCameraForCurrentVariant();
@@ -4866,7 +5254,7 @@ static VOIDPTR writterThread(VOIDPTR threadParam)
         MUTEX_LOCK(dmCondMutex);
         for(channelCnt = 0; channelCnt < writerChannelMax; channelCnt++)
         {
-            if (TRUE == channelWriterStatus[channelCnt])
+            if ((TRUE == channelWriterStatus[channelCnt]) && (channelWriterShard[channelCnt] == pShard->shardId))
             {
                 break;
             }
@@ -4884,22 +5272,24 @@ static VOIDPTR writterThread(VOIDPTR threadParam)
         {
             // no buffered data is available for write thread goes into sleep state
             /* PARASOFT: BD-TRS-DIFCS: Variable used in multiple critical sections */
-            pthread_cond_wait(&dmCondSignal, &dmCondMutex);
+            pthread_cond_wait(&pShard->condSignal, &dmCondMutex);
         }
         MUTEX_UNLOCK(dmCondMutex);
 
-        ReadHddConfig(&hddConfig);
+        ReadHddConfigIfChanged(&hddConfig, &hddConfigVersion);
         for(channelCnt = 0; channelCnt < writerChannelMax; channelCnt++)
         {
             /* PARASOFT: BD-TRS-DIFCS: Variable used in multiple critical sections */
             MUTEX_LOCK(dmCondMutex);
-            if (FALSE == channelWriterStatus[channelCnt])
+            if ((FALSE == channelWriterStatus[channelCnt]) || (channelWriterShard[channelCnt] != pShard->shardId))
             {
                 MUTEX_UNLOCK(dmCondMutex);
                 continue;
             }
             MUTEX_UNLOCK(dmCondMutex);
 
+            pthread_rwlock_rdlock(&diskFaultLock);
+            ioDiskFaultEpoch = diskFaultEpoch;
             volGrpId = 0;
             writeChannel = &sessionInfo[channelCnt].mDmBufferMngr;
             setStorageCalculationInfo(sessionInfo[channelCnt].elapsedTickCnt, writeChannel->streamOffset, channelCnt);
@@ -4931,6 +5321,7 @@ static VOIDPTR writterThread(VOIDPTR threadParam)
             if (FAIL == status)
             {
                 EPRINT(DISK_MANAGER, "fail to update stream file: [camera=%d], [file=%s]", channelCnt, writeChannel->streamFileName);
+                pthread_rwlock_unlock(&diskFaultLock);
                 HandleDiskError(channelCnt, tErrorCode);
                 break;
             }
@@ -4938,6 +5329,7 @@ static VOIDPTR writterThread(VOIDPTR threadParam)
             // update I frame file data
             if((aviRecGenConfig.recordFormatType != REC_AVI_FORMAT) && (status = updateIFrameFile(writeChannel, &tErrorCode)) == FAIL)
             {
+                pthread_rwlock_unlock(&diskFaultLock);
                 HandleDiskError(channelCnt, tErrorCode);
                 break;
             }
@@ -4951,6 +5343,7 @@ static VOIDPTR writterThread(VOIDPTR threadParam)
                 status = closeStreamFile(writeChannel, &tErrorCode);
                 if(FAIL == status)
                 {
+                    pthread_rwlock_unlock(&diskFaultLock);
                     HandleDiskError(channelCnt, tErrorCode);
                     break;
                 }
@@ -4985,6 +5378,7 @@ static VOIDPTR writterThread(VOIDPTR threadParam)
                     if(FAIL == status)
                     {
                         EPRINT(DISK_MANAGER, "fail to close i-frame file: [camera=%d], [err=%s]", channelCnt, strerror(tErrorCode));
+                        pthread_rwlock_unlock(&diskFaultLock);
                         HandleDiskError(channelCnt, tErrorCode);
                         break;
                     }
@@ -4997,6 +5391,7 @@ static VOIDPTR writterThread(VOIDPTR threadParam)
             {
                 MUTEX_UNLOCK(writeChannel->buffMutex);
             }
+            pthread_rwlock_unlock(&diskFaultLock);
 
             if (status == SUCCESS)
             {
@@ -5023,6 +5418,17 @@ void HandleDiskError(UINT8 channelNo, UINT32 errorCode)
     CHAR            diskName[MOUNT_POINT_SIZE] = {0};
     HDD_CONFIG_t    hddConfig;
 
+    /* Serialize disk error handling of all writer shards and record writers. It waits for channel file I/O
+     * in progress and holds new file I/O till files of faulty disk are closed */
+    pthread_rwlock_wrlock(&diskFaultLock);
+    if (ioDiskFaultEpoch != diskFaultEpoch)
+    {
+        /* Other writer has already handled the disk fault and closed files of all channels */
+        pthread_rwlock_unlock(&diskFaultLock);
+        DPRINT(DISK_MANAGER, "disk fault already handled: [camera=%d], [err=%s]", channelNo, strerror(errorCode));
+        return;
+    }
+
     do
     {
         /* Take drive config from the stream file path first, if it is not available then take from recording path */
@@ -5059,8 +5465,9 @@ void HandleDiskError(UINT8 channelNo, UINT32 errorCode)
             break;
         }
 
-        /* Close all opened file */
+        /* Close all opened file and latch the fault for errors of file I/O in progress of other writers */
         closeAllFileOnHddErr();
+        diskFaultEpoch++;
 
         /* If it is local disk recording then check for other volume. If available then switch recording else reboot the system */
         if(hddConfig.recordDisk == LOCAL_HARD_DISK)
@@ -5070,18 +5477,21 @@ void HandleDiskError(UINT8 channelNo, UINT32 errorCode)
             {
                 /* Update to storage about failure */
                 UpdateCameraStorage(channelNo);
+                pthread_rwlock_unlock(&diskFaultLock);
                 return;
             }
         }
 
         /* Stop all the activity on the disk and take particular action based on the disk type */
         HandleFileIOError(channelNo, &hddConfig);
+        pthread_rwlock_unlock(&diskFaultLock);
         return;
 
     }while(0);
 
     /* close the channel files */
     closeChnlFiles(channelNo);
+    pthread_rwlock_unlock(&diskFaultLock);
 
     /* Particular channel error restart the recording */
     RestartRecSession(channelNo, errorCode);
@@ -5276,6 +5686,10 @@ static BOOL closeTimeIdxFile(UINT8	channelNo, UINT32PTR pErrorCode)
  */
 static BOOL closeMonthDayIdxFiles(UINT8	channelNo)
 {
+    MUTEX_LOCK(sessionInfo[channelNo].yearMapFileLock);
+    CloseFileFd(&sessionInfo[channelNo].catalogFileInfo.fileFd);
+    MUTEX_UNLOCK(sessionInfo[channelNo].yearMapFileLock);
+
     if (sessionInfo[channelNo].yearMapFileInfo.mapFileFd == INVALID_FILE_FD)
     {
         return FAIL;
@@ -5374,12 +5788,14 @@ static BOOL updateIFrameFile(BUFFER_t *fileInfo, UINT32PTR pErrorCode)
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   This function was generates event i frame and write it into event file. It was generate all event stream
+ *          Event is also placed in recording catalog of camera.
+ * @param   channelNo
  * @param   eventInfo
  * @param   eventFileInfo
  * @param   pErrorCode - Error code, set when any I/O operation on disk fails
  * @return  SUCCESS/FAIL
  */
-static BOOL updateEventFile(EVENT_INDEX_HEADER_t *eventInfo, EVNT_FILE_INFO_t *eventFileInfo, UINT32PTR pErrorCode)
+static BOOL updateEventFile(UINT8 channelNo, EVENT_INDEX_HEADER_t *eventInfo, EVNT_FILE_INFO_t *eventFileInfo, UINT32PTR pErrorCode)
 {
     if (-1 == lseek(eventFileInfo->fileFd, ((eventInfo->eventIdx * EVNT_FIELD_SIZE) + EVENT_FILE_HDR_SIZE), SEEK_SET))
     {
@@ -5394,6 +5810,7 @@ static BOOL updateEventFile(EVENT_INDEX_HEADER_t *eventInfo, EVNT_FILE_INFO_t *e
         return FAIL;
     }
 
+    updateRecCatalog(channelNo, eventInfo);
     return SUCCESS;
 }
 
@@ -5423,59 +5840,430 @@ static BOOL updateEventFileHeader(EVNT_FILE_INFO_t *eventFileInfo, UINT32PTR pEr
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   This function was update time index file. It will put information of current minute,
- *          current stream file and current stream position of current file
- * @param   channelNo
- * @param   curTime
- * @param   pErrorCode - Error code, set when any I/O operation on disk fails
- * @return  SUCCESS/FAIL
+ * @brief   This function checks that recording index was built from previously stored data on volume
+ * @param   mntPoint
+ * @return  TRUE if index build was completed otherwise FALSE
  */
-static BOOL updateTimeIdxFile(UINT8 channelNo, struct tm *curTime, UINT32PTR pErrorCode)
+static BOOL isRecIndexBuildDone(CHARPTR mntPoint)
 {
-    TIME_IDX_FILE_INFO_t    *timeIdxFileInfo = &sessionInfo[channelNo].timeIdxFileInfo;
-    TIMEIDX_FIELD_INFO_t 	timeIdxField;
-
-    SET_ERROR_NUMBER(pErrorCode, INVALID_ERROR_CODE);
+    CHAR            fileName[MAX_FILE_NAME_SIZE];
+    INT32           buildInfoFileFd;
+    BUILD_INFO_t    buildInfo;
 
-    if (-1 == lseek(timeIdxFileInfo->fileFd, ((timeIdxFileInfo->timeIdxNo * TIME_INDEX_FIELD_SIZE) + TIMEIDX_FILE_HDR_SIZE), SEEK_SET))
+    snprintf(fileName, MAX_FILE_NAME_SIZE, "%s%s", mntPoint, BUILD_INDEX_INFO_FILE_NAME);
+    MUTEX_LOCK(buildInfoFileLock);
+    buildInfoFileFd = open(fileName, READ_ONLY_MODE);
+    if (buildInfoFileFd == INVALID_FILE_FD)
     {
-        SET_ERROR_NUMBER(pErrorCode, errno);
-        EPRINT(DISK_MANAGER, "fail to seek time-index file: [camera=%d], [err=%s]", channelNo, STR_ERR);
-        return FAIL;
+        MUTEX_UNLOCK(buildInfoFileLock);
+        return FALSE;
     }
 
-    timeIdxField.min = curTime->tm_min;
-    timeIdxField.overlapFlg = sessionInfo[channelNo].overlapFlg;
-    timeIdxField.diskId = sessionInfo[channelNo].streamFileInfo.diskId;
-    timeIdxField.streamFileId = sessionInfo[channelNo].streamFileInfo.streamFileIdx;
-    timeIdxField.fshPos = sessionInfo[channelNo].streamFileInfo.prevFshPos;
-
-    if (Utils_Write(timeIdxFileInfo->fileFd, &timeIdxField, TIME_INDEX_FIELD_SIZE, pErrorCode) != TIME_INDEX_FIELD_SIZE)
+    if (read(buildInfoFileFd, &buildInfo, sizeof(BUILD_INFO_t)) != sizeof(BUILD_INFO_t))
     {
-        EPRINT(DISK_MANAGER, "fail to write time-index file: [camera=%d], [err=%s]", channelNo, strerror(*pErrorCode));
-        return FAIL;
+        close(buildInfoFileFd);
+        MUTEX_UNLOCK(buildInfoFileLock);
+        return FALSE;
     }
 
-    return SUCCESS;
+    close(buildInfoFileFd);
+    MUTEX_UNLOCK(buildInfoFileLock);
+    return (buildInfo.status == SUCCESS) ? TRUE : FALSE;
 }
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   This function was update month and day index file. It will put information of current minute
- * @param   channelNo
- * @param   eventType
- * @param   curTime
- * @param   pErrorCode
+ * @brief   This function creates recording catalog file without any event
+ * @param   fileName
+ * @param   completeF - TRUE when no recording of that year is present on volume
  * @return  SUCCESS/FAIL
  */
-static BOOL updateYearMapFile(UINT8 channelNo, UINT8 eventType, struct tm *curTime, UINT32PTR pErrorCode)
+static BOOL createRecCatalog(CHARPTR fileName, BOOL completeF)
 {
-    YEAR_MAP_FILE_INFO_t    *yearMapFileinfo = &sessionInfo[channelNo].yearMapFileInfo;
-    YEAR_MAP_t				yearRecMap;
-    UINT8					dayIndx, monthIndx, curByte, curBit, evntType;
-    UINT32					totalMin;
-    HDD_CONFIG_t	        hddConfig;
-
+    INT32               fileFd;
+    UINT32              tErrorCode = INVALID_ERROR_CODE;
+    REC_CATALOG_HDR_t   catalogHdr;
+
+    fileFd = open(fileName, CREATE_RDWR_MODE | O_TRUNC, FILE_PERMISSION);
+    if (fileFd == INVALID_FILE_FD)
+    {
+        EPRINT(DISK_MANAGER, "fail to create recording catalog: [path=%s], [err=%s]", fileName, STR_ERR);
+        return FAIL;
+    }
+
+    memset(&catalogHdr, 0, sizeof(REC_CATALOG_HDR_t));
+    catalogHdr.fileSign = REC_CATALOG_FILE_SIGN;
+    catalogHdr.version = REC_CATALOG_FILE_VERSION;
+    catalogHdr.completeF = completeF;
+    catalogHdr.sortedF = TRUE;
+    if (Utils_pWrite(fileFd, &catalogHdr, REC_CATALOG_HDR_SIZE, 0, &tErrorCode) != REC_CATALOG_HDR_SIZE)
+    {
+        EPRINT(DISK_MANAGER, "fail to write recording catalog header: [path=%s], [err=%s]", fileName, strerror(tErrorCode));
+        close(fileFd);
+        unlink(fileName);
+        return FAIL;
+    }
+
+    close(fileFd);
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function reads and validates header of recording catalog
+ * @param   fileFd
+ * @param   pCatalogHdr
+ * @return  SUCCESS/FAIL
+ */
+static BOOL readRecCatalogHdr(INT32 fileFd, REC_CATALOG_HDR_t *pCatalogHdr)
+{
+    if (pread(fileFd, pCatalogHdr, REC_CATALOG_HDR_SIZE, 0) != (ssize_t)REC_CATALOG_HDR_SIZE)
+    {
+        EPRINT(DISK_MANAGER, "fail to read recording catalog header: [err=%s]", STR_ERR);
+        return FAIL;
+    }
+
+    if ((pCatalogHdr->fileSign != REC_CATALOG_FILE_SIGN) || (pCatalogHdr->version != REC_CATALOG_FILE_VERSION))
+    {
+        EPRINT(DISK_MANAGER, "invld recording catalog header: [sign=0x%x], [version=0x%x]", pCatalogHdr->fileSign, pCatalogHdr->version);
+        return FAIL;
+    }
+
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function finds first entry of sorted catalog which is not older than given hour
+ * @param   fileFd
+ * @param   entryCnt
+ * @param   hourSec
+ * @param   pEntryIdx - Index of first entry of given hour or later hour, entryCnt if there is no such entry
+ * @return  SUCCESS/FAIL
+ */
+static BOOL findRecCatalogHour(INT32 fileFd, UINT32 entryCnt, time_t hourSec, UINT32PTR pEntryIdx)
+{
+    UINT32              lowIdx = 0;
+    UINT32              highIdx = entryCnt;
+    UINT32              midIdx;
+    REC_CATALOG_ENTRY_t catalogEntry;
+
+    while (lowIdx < highIdx)
+    {
+        midIdx = lowIdx + ((highIdx - lowIdx) / 2);
+        if (pread(fileFd, &catalogEntry, REC_CATALOG_ENTRY_SIZE, REC_CATALOG_HDR_SIZE + ((off_t)midIdx * REC_CATALOG_ENTRY_SIZE))
+                != (ssize_t)REC_CATALOG_ENTRY_SIZE)
+        {
+            EPRINT(DISK_MANAGER, "fail to read recording catalog: [entry=%d], [err=%s]", midIdx, STR_ERR);
+            return FAIL;
+        }
+
+        if ((time_t)catalogEntry.hourSec < hourSec)
+        {
+            lowIdx = midIdx + 1;
+        }
+        else
+        {
+            highIdx = midIdx;
+        }
+    }
+
+    *pEntryIdx = lowIdx;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function writes event entry in recording catalog. When position of entry is not known, it
+ *          is searched in recent entries of catalog as event always belongs to recent hour. Entry which is
+ *          not found is appended at end of catalog.
+ * @param   fileFd
+ * @param   pCatalogEntry
+ * @param   pCatalogIdx - Position of entry in catalog, updated when entry is placed
+ * @return  SUCCESS/FAIL
+ */
+static BOOL writeRecCatalogEntry(INT32 fileFd, REC_CATALOG_ENTRY_t *pCatalogEntry, UINT32PTR pCatalogIdx)
+{
+    BOOL                appendF = FALSE;
+    UINT32              scanCnt, scanIdx;
+    UINT32              tErrorCode = INVALID_ERROR_CODE;
+    REC_CATALOG_HDR_t   catalogHdr;
+    REC_CATALOG_ENTRY_t tailEntry[REC_CATALOG_CHUNK_ENTRY_CNT];
+
+    if (readRecCatalogHdr(fileFd, &catalogHdr) == FAIL)
+    {
+        return FAIL;
+    }
+
+    if ((*pCatalogIdx == REC_CATALOG_INVALID_IDX) || (*pCatalogIdx >= catalogHdr.entryCnt))
+    {
+        *pCatalogIdx = REC_CATALOG_INVALID_IDX;
+        scanCnt = (catalogHdr.entryCnt < REC_CATALOG_CHUNK_ENTRY_CNT) ? catalogHdr.entryCnt : REC_CATALOG_CHUNK_ENTRY_CNT;
+        if (scanCnt > 0)
+        {
+            if (pread(fileFd, tailEntry, (scanCnt * REC_CATALOG_ENTRY_SIZE),
+                      REC_CATALOG_HDR_SIZE + ((off_t)(catalogHdr.entryCnt - scanCnt) * REC_CATALOG_ENTRY_SIZE)) != (ssize_t)(scanCnt * REC_CATALOG_ENTRY_SIZE))
+            {
+                EPRINT(DISK_MANAGER, "fail to read recording catalog: [err=%s]", STR_ERR);
+                return FAIL;
+            }
+
+            for (scanIdx = scanCnt; scanIdx > 0; scanIdx--)
+            {
+                if ((tailEntry[scanIdx - 1].hourSec == pCatalogEntry->hourSec) && (tailEntry[scanIdx - 1].eventIdx == pCatalogEntry->eventIdx)
+                        && (tailEntry[scanIdx - 1].removedF == FALSE))
+                {
+                    *pCatalogIdx = (catalogHdr.entryCnt - scanCnt + scanIdx - 1);
+                    break;
+                }
+            }
+
+            /* Catalog remains sorted till events are appended in order of hour (system time may go back) */
+            if ((*pCatalogIdx == REC_CATALOG_INVALID_IDX) && ((pCatalogEntry->hourSec < tailEntry[scanCnt - 1].hourSec)
+                    || ((pCatalogEntry->hourSec == tailEntry[scanCnt - 1].hourSec) && (pCatalogEntry->eventIdx < tailEntry[scanCnt - 1].eventIdx))))
+            {
+                catalogHdr.sortedF = FALSE;
+            }
+        }
+
+        if (*pCatalogIdx == REC_CATALOG_INVALID_IDX)
+        {
+            *pCatalogIdx = catalogHdr.entryCnt;
+            catalogHdr.entryCnt++;
+            appendF = TRUE;
+        }
+    }
+
+    if (Utils_pWrite(fileFd, pCatalogEntry, REC_CATALOG_ENTRY_SIZE, REC_CATALOG_HDR_SIZE + ((off_t)*pCatalogIdx * REC_CATALOG_ENTRY_SIZE),
+                     &tErrorCode) != REC_CATALOG_ENTRY_SIZE)
+    {
+        EPRINT(DISK_MANAGER, "fail to write recording catalog: [entry=%d], [err=%s]", *pCatalogIdx, strerror(tErrorCode));
+        *pCatalogIdx = REC_CATALOG_INVALID_IDX;
+        return FAIL;
+    }
+
+    if (appendF == TRUE)
+    {
+        if (Utils_pWrite(fileFd, &catalogHdr, REC_CATALOG_HDR_SIZE, 0, &tErrorCode) != REC_CATALOG_HDR_SIZE)
+        {
+            EPRINT(DISK_MANAGER, "fail to write recording catalog header: [err=%s]", strerror(tErrorCode));
+            *pCatalogIdx = REC_CATALOG_INVALID_IDX;
+            return FAIL;
+        }
+    }
+
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function resets catalog position of running events of camera. Position is valid only for
+ *          the catalog in which event was placed.
+ * @param   channelNo
+ */
+static void resetRecCatalogIdx(UINT8 channelNo)
+{
+    sessionInfo[channelNo].mScheduleEvent.catalogIdx = REC_CATALOG_INVALID_IDX;
+    sessionInfo[channelNo].mManualEvent.catalogIdx = REC_CATALOG_INVALID_IDX;
+    sessionInfo[channelNo].mAlarmEvent.catalogIdx = REC_CATALOG_INVALID_IDX;
+    sessionInfo[channelNo].mCosecEvent.catalogIdx = REC_CATALOG_INVALID_IDX;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function notes oldest hour changed in catalog of camera, so that catalog rebuild running
+ *          in parallel can re-read events of that hour onwards.
+ * @param   channelNo
+ * @param   hourSec
+ * @note    yearMapFileLock must be acquired by caller
+ */
+static void markRecCatalogDirty(UINT8 channelNo, UINT32 hourSec)
+{
+    if (hourSec < sessionInfo[channelNo].catalogFileInfo.dirtyHourSec)
+    {
+        sessionInfo[channelNo].catalogFileInfo.dirtyHourSec = hourSec;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function opens recording catalog of given year on current recording volume of camera.
+ *          Catalog remains open till year map file of recording is closed.
+ * @param   channelNo
+ * @param   year
+ * @return  SUCCESS/FAIL
+ * @note    yearMapFileLock must be acquired by caller
+ */
+static BOOL openRecCatalog(UINT8 channelNo, UINT32 year)
+{
+    CHAR                    mntPoint[MOUNT_POINT_SIZE];
+    CHAR                    fileName[MAX_FILE_NAME_SIZE];
+    REC_CATALOG_FILE_INFO_t *pCatalogInfo = &sessionInfo[channelNo].catalogFileInfo;
+
+    if (GetRecordingPath(channelNo, mntPoint) == FAIL)
+    {
+        return FAIL;
+    }
+
+    snprintf(fileName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_INDEX_FILE_YEAR, mntPoint, GET_CAMERA_NO(channelNo), year, REC_CATALOG_FILE_EXTN);
+    if ((pCatalogInfo->fileFd != INVALID_FILE_FD) && (strcmp(pCatalogInfo->fileName, fileName) == STATUS_OK))
+    {
+        return SUCCESS;
+    }
+
+    CloseFileFd(&pCatalogInfo->fileFd);
+    resetRecCatalogIdx(channelNo);
+
+    /* Catalog is created with year map file. If it is not present then recording of this year was done
+     * without catalog, hence it is marked as incomplete and will be built again on next mount */
+    if (access(fileName, F_OK) != STATUS_OK)
+    {
+        WPRINT(DISK_MANAGER, "recording catalog not present: [camera=%d], [path=%s]", channelNo, fileName);
+        if (createRecCatalog(fileName, FALSE) == FAIL)
+        {
+            return FAIL;
+        }
+    }
+
+    pCatalogInfo->fileFd = open(fileName, READ_WRITE_MODE, FILE_PERMISSION);
+    if (pCatalogInfo->fileFd == INVALID_FILE_FD)
+    {
+        EPRINT(DISK_MANAGER, "fail to open recording catalog: [camera=%d], [path=%s], [err=%s]", channelNo, fileName, STR_ERR);
+        return FAIL;
+    }
+
+    snprintf(pCatalogInfo->fileName, MAX_FILE_NAME_SIZE, "%s", fileName);
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function places event in recording catalog. New event is appended in catalog and later
+ *          updates of same event are written at its position.
+ * @param   channelNo
+ * @param   eventInfo
+ * @note    Catalog is only used to speed up search, so its failure does not stop recording. Catalog
+ *          which could not be updated is marked as incomplete and search walks hour folders for it.
+ */
+static void updateRecCatalog(UINT8 channelNo, EVENT_INDEX_HEADER_t *eventInfo)
+{
+    time_t                  startTime = eventInfo->evntInfo.startTime;
+    struct tm               startTm;
+    REC_CATALOG_HDR_t       catalogHdr;
+    REC_CATALOG_ENTRY_t     catalogEntry;
+    REC_CATALOG_FILE_INFO_t *pCatalogInfo = &sessionInfo[channelNo].catalogFileInfo;
+    UINT32                  tErrorCode = INVALID_ERROR_CODE;
+
+    if (ConvertLocalTimeInBrokenTm(&startTime, &startTm) == FAIL)
+    {
+        return;
+    }
+
+    memset(&catalogEntry, 0, sizeof(REC_CATALOG_ENTRY_t));
+    catalogEntry.evntInfo = eventInfo->evntInfo;
+    catalogEntry.hourSec = GET_REC_CATALOG_HOUR(eventInfo->evntInfo.startTime);
+    catalogEntry.eventIdx = eventInfo->eventIdx;
+
+    MUTEX_LOCK(sessionInfo[channelNo].yearMapFileLock);
+    markRecCatalogDirty(channelNo, catalogEntry.hourSec);
+    if (openRecCatalog(channelNo, startTm.tm_year) == FAIL)
+    {
+        MUTEX_UNLOCK(sessionInfo[channelNo].yearMapFileLock);
+        return;
+    }
+
+    if (writeRecCatalogEntry(pCatalogInfo->fileFd, &catalogEntry, &eventInfo->catalogIdx) == FAIL)
+    {
+        EPRINT(DISK_MANAGER, "fail to update recording catalog: [camera=%d], [path=%s]", channelNo, pCatalogInfo->fileName);
+        if (readRecCatalogHdr(pCatalogInfo->fileFd, &catalogHdr) == SUCCESS)
+        {
+            catalogHdr.completeF = FALSE;
+            Utils_pWrite(pCatalogInfo->fileFd, &catalogHdr, REC_CATALOG_HDR_SIZE, 0, &tErrorCode);
+        }
+        CloseFileFd(&pCatalogInfo->fileFd);
+    }
+    MUTEX_UNLOCK(sessionInfo[channelNo].yearMapFileLock);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function creates recording catalog of year along with year map file. Catalog is complete
+ *          only if index of previously stored data was built on this volume, otherwise it is built later.
+ * @param   mntPoint
+ * @param   channelNo
+ * @param   year
+ */
+static void createYearRecCatalog(CHARPTR mntPoint, UINT8 channelNo, UINT32 year)
+{
+    CHAR fileName[MAX_FILE_NAME_SIZE];
+    BOOL completeF = isRecIndexBuildDone(mntPoint);
+
+    snprintf(fileName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_INDEX_FILE_YEAR, mntPoint, GET_CAMERA_NO(channelNo), year, REC_CATALOG_FILE_EXTN);
+    MUTEX_LOCK(sessionInfo[channelNo].yearMapFileLock);
+    if ((sessionInfo[channelNo].catalogFileInfo.fileFd != INVALID_FILE_FD) && (strcmp(sessionInfo[channelNo].catalogFileInfo.fileName, fileName) == STATUS_OK))
+    {
+        CloseFileFd(&sessionInfo[channelNo].catalogFileInfo.fileFd);
+    }
+
+    createRecCatalog(fileName, completeF);
+    MUTEX_UNLOCK(sessionInfo[channelNo].yearMapFileLock);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function was update time index file. It will put information of current minute,
+ *          current stream file and current stream position of current file
+ * @param   channelNo
+ * @param   curTime
+ * @param   pErrorCode - Error code, set when any I/O operation on disk fails
+ * @return  SUCCESS/FAIL
+ */
+static BOOL updateTimeIdxFile(UINT8 channelNo, struct tm *curTime, UINT32PTR pErrorCode)
+{
+    TIME_IDX_FILE_INFO_t    *timeIdxFileInfo = &sessionInfo[channelNo].timeIdxFileInfo;
+    TIMEIDX_FIELD_INFO_t 	timeIdxField;
+
+    SET_ERROR_NUMBER(pErrorCode, INVALID_ERROR_CODE);
+
+    if (-1 == lseek(timeIdxFileInfo->fileFd, ((timeIdxFileInfo->timeIdxNo * TIME_INDEX_FIELD_SIZE) + TIMEIDX_FILE_HDR_SIZE), SEEK_SET))
+    {
+        SET_ERROR_NUMBER(pErrorCode, errno);
+        EPRINT(DISK_MANAGER, "fail to seek time-index file: [camera=%d], [err=%s]", channelNo, STR_ERR);
+        return FAIL;
+    }
+
+    timeIdxField.min = curTime->tm_min;
+    timeIdxField.overlapFlg = sessionInfo[channelNo].overlapFlg;
+    timeIdxField.diskId = sessionInfo[channelNo].streamFileInfo.diskId;
+    timeIdxField.streamFileId = sessionInfo[channelNo].streamFileInfo.streamFileIdx;
+    timeIdxField.fshPos = sessionInfo[channelNo].streamFileInfo.prevFshPos;
+
+    if (Utils_Write(timeIdxFileInfo->fileFd, &timeIdxField, TIME_INDEX_FIELD_SIZE, pErrorCode) != TIME_INDEX_FIELD_SIZE)
+    {
+        EPRINT(DISK_MANAGER, "fail to write time-index file: [camera=%d], [err=%s]", channelNo, strerror(*pErrorCode));
+        return FAIL;
+    }
+
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function was update month and day index file. It will put information of current minute
+ * @param   channelNo
+ * @param   eventType
+ * @param   curTime
+ * @param   pErrorCode
+ * @return  SUCCESS/FAIL
+ */
+static BOOL updateYearMapFile(UINT8 channelNo, UINT8 eventType, struct tm *curTime, UINT32PTR pErrorCode)
+{
+    YEAR_MAP_FILE_INFO_t    *yearMapFileinfo = &sessionInfo[channelNo].yearMapFileInfo;
+    YEAR_MAP_t				yearRecMap;
+    UINT8					dayIndx, monthIndx, curByte, curBit, evntType;
+    UINT32					totalMin;
+    HDD_CONFIG_t	        hddConfig;
+
     if (-1 == lseek(yearMapFileinfo->mapFileFd, 0, SEEK_SET))
     {
         SET_ERROR_NUMBER(pErrorCode, errno);
@@ -6723,6 +7511,8 @@ static BOOL removeIndexesforGivenHour(CHARPTR mntPoint, UINT8 channelNo, RECOVER
         return SUCCESS;
     }
 
+    removeRecCatalogHour(mntPoint, channelNo, &recveryInfo);
+
     snprintf(fileName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_INDEX_FILE_YEAR, mntPoint, GET_CAMERA_NO(channelNo), recveryInfo.year, YEAR_MAP_FILE_EXTN);
     if(access(fileName, F_OK) != STATUS_OK)
     {
@@ -6943,7 +7733,8 @@ BOOL BuildRecIndexFromPrevStoredData(CHARPTR mntPoint)
 
         while((entry = readdir(dir)) != NULL)
         {
-            if((strstr(entry->d_name, YEAR_MAP_FILE_EXTN)) ||  (strcmp(entry->d_name, ".") == 0) || (strcmp(entry->d_name, "..") == 0))
+            if((strstr(entry->d_name, YEAR_MAP_FILE_EXTN)) || (strstr(entry->d_name, REC_CATALOG_FILE_EXTN))
+                    || (strcmp(entry->d_name, ".") == 0) || (strcmp(entry->d_name, "..") == 0))
             {
                 continue;
             }
@@ -7219,550 +8010,1105 @@ BOOL BuildRecIndexFromPrevStoredData(CHARPTR mntPoint)
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   This function was check that time index information was properly organized or not.
- *          If file was not proper then removes some un useful information from file
- * @param   path
- * @param   pErrorCode
- * @return  SUCCESS/FAIL
+ * @brief   This function marks catalog entries of deleted hour folder as removed
+ * @param   mntPoint
+ * @param   channelNo
+ * @param   pRecveryInfo - Date and hour of deleted folder
  */
-static BOOL recoverTimeIdxFile(CHARPTR path, UINT32PTR pErrorCode)
+static void removeRecCatalogHour(CHARPTR mntPoint, UINT8 channelNo, RECOVERY_INFO_t *pRecveryInfo)
 {
-    UINT8 					bufIdx;
-    CHAR 					timeIdxBuf[2];
-    CHAR 					timeFileName[MAX_FILE_NAME_SIZE];
-    CHAR 					strmFileName[MAX_FILE_NAME_SIZE];
-    INT32 					timeFileFd;
-    UINT32 					fileOffset;
-    UINT32 					strmFileSize;
-    UINT32					strmFileNo;
-    struct stat 			stateInfo;
-    METADATA_FILE_HDR_t 	timeIdxFileInfo;
-    TIMEIDX_FIELD_INFO_t 	timeIdxField;
-    UINT32					curSysTick = GetSysTick();
-
-    SET_ERROR_NUMBER(pErrorCode, INVALID_ERROR_CODE);
+    BOOL                modifiedF, stopF = FALSE;
+    CHAR                fileName[MAX_FILE_NAME_SIZE];
+    INT32               fileFd;
+    UINT32              entryIdx = 0, chunkCnt, chunkIdx;
+    UINT32              tErrorCode = INVALID_ERROR_CODE;
+    time_t              hourSec;
+    struct tm           hourTm = { 0 };
+    REC_CATALOG_HDR_t   catalogHdr;
+    REC_CATALOG_ENTRY_t catalogEntry[REC_CATALOG_CHUNK_ENTRY_CNT];
 
-    // make file name for event file
-    snprintf(timeFileName, MAX_FILE_NAME_SIZE, "%s%s", path, TIMEIDX_FILE_NAME);
+    hourTm.tm_year = pRecveryInfo->year;
+    hourTm.tm_mon = pRecveryInfo->mon;
+    hourTm.tm_mday = pRecveryInfo->date;
+    hourTm.tm_hour = pRecveryInfo->hour;
+    if (ConvertLocalTimeInSec(&hourTm, &hourSec) == FAIL)
+    {
+        return;
+    }
 
-    //Open time index  file
-    timeFileFd = open(timeFileName, READ_WRITE_MODE, FILE_PERMISSION);
-    if(timeFileFd == INVALID_FILE_FD)
+    snprintf(fileName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_INDEX_FILE_YEAR, mntPoint, GET_CAMERA_NO(channelNo), pRecveryInfo->year, REC_CATALOG_FILE_EXTN);
+    MUTEX_LOCK(sessionInfo[channelNo].yearMapFileLock);
+    markRecCatalogDirty(channelNo, hourSec);
+    fileFd = open(fileName, READ_WRITE_MODE, FILE_PERMISSION);
+    if (fileFd == INVALID_FILE_FD)
     {
-        SET_ERROR_NUMBER(pErrorCode, errno);
-        EPRINT(DISK_MANAGER, "fail to open time-index file: [path=%s]", timeFileName);
-        return FAIL;
+        MUTEX_UNLOCK(sessionInfo[channelNo].yearMapFileLock);
+        return;
     }
 
-    // 	Get size of time index into fileSize
-    if(stat(timeFileName, &stateInfo) < STATUS_OK)
+    if (readRecCatalogHdr(fileFd, &catalogHdr) == FAIL)
     {
-        SET_ERROR_NUMBER(pErrorCode, errno);
-        EPRINT(DISK_MANAGER, "fail to stat time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
-        close(timeFileFd);
-        return FAIL;
+        close(fileFd);
+        MUTEX_UNLOCK(sessionInfo[channelNo].yearMapFileLock);
+        return;
     }
 
-    // Read the file header of time index file. Get the next time index number in nextTimeIdxNo
-    if(Utils_Read(timeFileFd, &timeIdxFileInfo, TIMEIDX_FILE_HDR_SIZE, pErrorCode) != TIMEIDX_FILE_HDR_SIZE)
+    /* In sorted catalog entries of hour are together, otherwise whole catalog is scanned */
+    if ((catalogHdr.sortedF == TRUE) && (findRecCatalogHour(fileFd, catalogHdr.entryCnt, hourSec, &entryIdx) == FAIL))
     {
-        EPRINT(DISK_MANAGER, "fail to read time-index file: [path=%s], [err=%s]", timeFileName, strerror(*pErrorCode));
-        close(timeFileFd);
-        return FAIL;
+        close(fileFd);
+        MUTEX_UNLOCK(sessionInfo[channelNo].yearMapFileLock);
+        return;
     }
 
-    // each time index information takes 6 bytes and Calculate offset position in to file for nextTimeIdxNo
-    fileOffset = ((timeIdxFileInfo.nextMetaDataIdx * TIME_INDEX_FIELD_SIZE) + TIMEIDX_FILE_HDR_SIZE);
-    if((INT32)fileOffset < stateInfo.st_size)
+    while ((entryIdx < catalogHdr.entryCnt) && (stopF == FALSE))
     {
-        // when last time index information was written into file but updation of next time index position was not possible.
-        // So correct this condition here
-        timeIdxFileInfo.nextMetaDataIdx += ((stateInfo.st_size - fileOffset) / TIME_INDEX_FIELD_SIZE);
+        chunkCnt = catalogHdr.entryCnt - entryIdx;
+        if (chunkCnt > REC_CATALOG_CHUNK_ENTRY_CNT)
+        {
+            chunkCnt = REC_CATALOG_CHUNK_ENTRY_CNT;
+        }
 
-        //Update nextTimeIdxNo in current event file @ file header @ 6th byte
-        if(Utils_pWrite(timeFileFd, &timeIdxFileInfo, TIMEIDX_FILE_HDR_SIZE, 0, pErrorCode) != TIMEIDX_FILE_HDR_SIZE)
+        if (pread(fileFd, catalogEntry, (chunkCnt * REC_CATALOG_ENTRY_SIZE), REC_CATALOG_HDR_SIZE + ((off_t)entryIdx * REC_CATALOG_ENTRY_SIZE))
+                != (ssize_t)(chunkCnt * REC_CATALOG_ENTRY_SIZE))
         {
-            EPRINT(DISK_MANAGER, "fail to write time-index file: [path=%s], [err=%s]", timeFileName, strerror(*pErrorCode));
-            close(timeFileFd);
-            return FAIL;
+            EPRINT(DISK_MANAGER, "fail to read recording catalog: [camera=%d], [path=%s], [err=%s]", channelNo, fileName, STR_ERR);
+            break;
         }
 
-        // After nextTimeIdxNo, if any data was present that was garbage or incomplete data so remove it from file
-        fileOffset = ((timeIdxFileInfo.nextMetaDataIdx * TIME_INDEX_FIELD_SIZE) + TIMEIDX_FILE_HDR_SIZE);
-        if((stateInfo.st_size - fileOffset) > 0)
+        modifiedF = FALSE;
+        for (chunkIdx = 0; chunkIdx < chunkCnt; chunkIdx++)
         {
-            if(-1 == lseek(timeFileFd, fileOffset, SEEK_SET))
+            if ((time_t)catalogEntry[chunkIdx].hourSec == hourSec)
             {
-                SET_ERROR_NUMBER(pErrorCode, errno);
-                EPRINT(DISK_MANAGER, "fail to seek time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
-                close(timeFileFd);
-                return FAIL;
+                catalogEntry[chunkIdx].removedF = TRUE;
+                modifiedF = TRUE;
             }
-
-            //remove no. of bytes from nextIFrameIdx in current event file
-            if(-1 == ftruncate(timeFileFd, lseek(timeFileFd, 0, SEEK_CUR)))
+            else if ((catalogHdr.sortedF == TRUE) && ((time_t)catalogEntry[chunkIdx].hourSec > hourSec))
             {
-                SET_ERROR_NUMBER(pErrorCode, errno);
-                EPRINT(DISK_MANAGER, "fail to truncate time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
-                close(timeFileFd);
-                return FAIL;
+                stopF = TRUE;
+                break;
             }
         }
-    }
 
-    if(-1 == lseek(timeFileFd, fileOffset, SEEK_SET))
-    {
-        SET_ERROR_NUMBER(pErrorCode, errno);
-        EPRINT(DISK_MANAGER, "fail to seek time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
-        close(timeFileFd);
-        return FAIL;
+        if ((modifiedF == TRUE) && (Utils_pWrite(fileFd, catalogEntry, (chunkCnt * REC_CATALOG_ENTRY_SIZE),
+                                                 REC_CATALOG_HDR_SIZE + ((off_t)entryIdx * REC_CATALOG_ENTRY_SIZE), &tErrorCode) != (ssize_t)(chunkCnt * REC_CATALOG_ENTRY_SIZE)))
+        {
+            EPRINT(DISK_MANAGER, "fail to write recording catalog: [camera=%d], [path=%s], [err=%s]", channelNo, fileName, strerror(tErrorCode));
+            break;
+        }
+
+        entryIdx += chunkCnt;
     }
 
-    bufIdx = 0;
-    timeIdxBuf[bufIdx++] = (UINT8)TIMEINDEX_FILE_EOF;
-    timeIdxBuf[bufIdx++] = TIMEINDEX_FILE_EOF >> 8;
+    close(fileFd);
+    MUTEX_UNLOCK(sessionInfo[channelNo].yearMapFileLock);
+}
 
-    // 	Write end of file indicator of time index file
-    if(Utils_Write(timeFileFd, timeIdxBuf, bufIdx, pErrorCode) != bufIdx)
-    {
-        EPRINT(DISK_MANAGER, "fail to write time-index file: [path=%s], [err=%s]", timeFileName, strerror(*pErrorCode));
-        close(timeFileFd);
-        return FAIL;
-    }
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function reads all events of hour folder as catalog entries and appends them in list
+ * @param   hourFolder
+ * @param   ppEntry - List of entries, grown as required
+ * @param   pEntryCnt - Number of entries in list
+ * @param   pAllocCnt - Number of entries for which list is allocated
+ * @return  SUCCESS/FAIL
+ */
+static BOOL readRecCatalogHourEntries(CHARPTR hourFolder, REC_CATALOG_ENTRY_t **ppEntry, UINT32PTR pEntryCnt, UINT32PTR pAllocCnt)
+{
+    CHAR                evntFileName[MAX_FILE_NAME_SIZE];
+    INT32               evntFileFd;
+    UINT32              curEventIdx;
+    UINT32              allocCnt;
+    METADATA_FILE_HDR_t evntFileInfo;
+    EVNT_INFO_t         eventInfo;
+    REC_CATALOG_ENTRY_t *pNewEntry;
 
-    // Read the file header of time index
-    if(pread(timeFileFd, &timeIdxFileInfo, TIMEIDX_FILE_HDR_SIZE, lseek(timeFileFd, 0, SEEK_SET)) != TIMEIDX_FILE_HDR_SIZE)
+    snprintf(evntFileName, MAX_FILE_NAME_SIZE, "%s%s", hourFolder, EVENT_FILE_NAME);
+    evntFileFd = open(evntFileName, READ_ONLY_MODE);
+    if (evntFileFd == INVALID_FILE_FD)
     {
-        SET_ERROR_NUMBER(pErrorCode, errno);
-        EPRINT(DISK_MANAGER, "fail to read time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
-        close(timeFileFd);
-        return FAIL;
+        /* Hour folder without event file has no recording */
+        return (errno == ENOENT) ? SUCCESS : FAIL;
     }
 
-    if(getAllStreamFileCount(path, &strmFileNo, NULL) == FAIL)
+    if (read(evntFileFd, &evntFileInfo, EVENT_FILE_HDR_SIZE) != (INT32)EVENT_FILE_HDR_SIZE)
     {
-        close(timeFileFd);
-        EPRINT(DISK_MANAGER, "fail to get all stream file count: [path=%s]", path);
+        EPRINT(DISK_MANAGER, "fail to read event file: [path=%s], [err=%s]", evntFileName, STR_ERR);
+        close(evntFileFd);
         return FAIL;
     }
 
-    while(timeIdxFileInfo.nextMetaDataIdx > 0)
+    for (curEventIdx = 0; curEventIdx < evntFileInfo.nextMetaDataIdx; curEventIdx++)
     {
-        if(ElapsedTick(curSysTick) >= CONVERT_SEC_TO_TIMER_COUNT(RECOVERY_TIME_OUT))
-        {
-            close(timeFileFd);
-            EPRINT(DISK_MANAGER, "recovery timeout occurred");
-            return FAIL;
-        }
-
-        // get last time index information position in file
-        fileOffset = (((timeIdxFileInfo.nextMetaDataIdx - 1) * TIME_INDEX_FIELD_SIZE) + TIMEIDX_FILE_HDR_SIZE);
-        if(-1 == lseek(timeFileFd, fileOffset, SEEK_SET))
+        if (read(evntFileFd, &eventInfo, EVNT_FIELD_SIZE) != EVNT_FIELD_SIZE)
         {
-            SET_ERROR_NUMBER(pErrorCode, errno);
-            EPRINT(DISK_MANAGER, "fail to seek time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
-            close(timeFileFd);
-            return FAIL;
+            EPRINT(DISK_MANAGER, "fail to read event file: [path=%s], [err=%s]", evntFileName, STR_ERR);
+            break;
         }
 
-        // Read time index information in readBuff and Get streamFileId, streamFilePos from readBuff (as per time index information)
-        if(Utils_Read(timeFileFd, &timeIdxField, TIME_INDEX_FIELD_SIZE, pErrorCode) != TIME_INDEX_FIELD_SIZE)
+        if (eventInfo.startTime == 0)
         {
-            EPRINT(DISK_MANAGER, "fail to read time-index file: [path=%s], [err=%s]", timeFileName, strerror(*pErrorCode));
-            close(timeFileFd);
-            return FAIL;
+            continue;
         }
 
-        // get current FSH position for last time index information in time index  file
-        if(timeIdxField.streamFileId <= strmFileNo)
+        if (*pEntryCnt >= *pAllocCnt)
         {
-            // Get stream file name from streamFileId in streamFile and Get stream file size in streamFileSize
-            if(getStreamFileName(path, strmFileNo, strmFileName, &strmFileSize) == FAIL)
+            allocCnt = (*pAllocCnt == 0) ? REC_CATALOG_CHUNK_ENTRY_CNT : (*pAllocCnt * 2);
+            pNewEntry = realloc(*ppEntry, (allocCnt * REC_CATALOG_ENTRY_SIZE));
+            if (pNewEntry == NULL)
             {
-                close(timeFileFd);
-                EPRINT(DISK_MANAGER, "fail to get stream file name: [path=%s], [strmFileId=%d]", path, strmFileNo);
+                EPRINT(DISK_MANAGER, "memory re-allocation failed: [entries=%d]", allocCnt);
+                close(evntFileFd);
                 return FAIL;
             }
 
-            // Check that this streamFilePos is valid or not
-            if(strmFileSize >= timeIdxField.fshPos)
-            {
-                // stream file position was properly set as per time index says
-                break;
-            }
+            *ppEntry = pNewEntry;
+            *pAllocCnt = allocCnt;
         }
 
-        // Go to next time index index number
-        if(-1 == ftruncate(timeFileFd, lseek(timeFileFd, fileOffset, SEEK_SET)))
-        {
-            SET_ERROR_NUMBER(pErrorCode, errno);
-            EPRINT(DISK_MANAGER, "fail to truncate time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
-            close(timeFileFd);
-            return FAIL;
-        }
-        timeIdxFileInfo.nextMetaDataIdx--;
+        memset(&(*ppEntry)[*pEntryCnt], 0, REC_CATALOG_ENTRY_SIZE);
+        (*ppEntry)[*pEntryCnt].evntInfo = eventInfo;
+        (*ppEntry)[*pEntryCnt].hourSec = GET_REC_CATALOG_HOUR(eventInfo.startTime);
+        (*ppEntry)[*pEntryCnt].eventIdx = curEventIdx;
+        (*pEntryCnt)++;
     }
 
-    // get last time index information position in file
-    fileOffset = ((timeIdxFileInfo.nextMetaDataIdx * TIME_INDEX_FIELD_SIZE) + TIMEIDX_FILE_HDR_SIZE);
+    close(evntFileFd);
+    return SUCCESS;
+}
 
-    // Go to next time index  index number
-    if(-1 == lseek(timeFileFd, fileOffset, SEEK_SET))
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function places events of recovered hour folder in recording catalog. Events which were
+ *          not placed in catalog due to power failure are appended and rest of events are updated.
+ * @param   mntPoint
+ * @param   path - Recovered hour folder
+ * @param   channelNo
+ * @param   pRecveryInfo
+ */
+static void recoverRecCatalog(CHARPTR mntPoint, CHARPTR path, UINT8 channelNo, RECOVERY_INFO_t *pRecveryInfo)
+{
+    CHAR                fileName[MAX_FILE_NAME_SIZE];
+    INT32               fileFd;
+    UINT32              entryIdx, catalogIdx;
+    UINT32              entryCnt = 0, allocCnt = 0;
+    REC_CATALOG_ENTRY_t *pEntry = NULL;
+
+    if (readRecCatalogHourEntries(path, &pEntry, &entryCnt, &allocCnt) == FAIL)
     {
-        SET_ERROR_NUMBER(pErrorCode, errno);
-        EPRINT(DISK_MANAGER, "fail to seek time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
-        close(timeFileFd);
-        return FAIL;
+        FREE_MEMORY(pEntry);
+        return;
     }
 
-    // Update nextIFrameIdx in current time index  file @ file header @ 5th byte
-    if (Utils_pWrite(timeFileFd, &timeIdxFileInfo, TIMEIDX_FILE_HDR_SIZE, 0, pErrorCode) != TIMEIDX_FILE_HDR_SIZE)
+    snprintf(fileName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_INDEX_FILE_YEAR, mntPoint, GET_CAMERA_NO(channelNo), pRecveryInfo->year, REC_CATALOG_FILE_EXTN);
+    MUTEX_LOCK(sessionInfo[channelNo].yearMapFileLock);
+
+    /* Missing catalog is built after recovery, so nothing to recover in it */
+    fileFd = open(fileName, READ_WRITE_MODE, FILE_PERMISSION);
+    if (fileFd != INVALID_FILE_FD)
     {
-        EPRINT(DISK_MANAGER, "fail to write time-index file: [path=%s], [err=%s]", timeFileName, strerror(*pErrorCode));
-        close(timeFileFd);
-        return FAIL;
+        for (entryIdx = 0; entryIdx < entryCnt; entryIdx++)
+        {
+            markRecCatalogDirty(channelNo, pEntry[entryIdx].hourSec);
+            catalogIdx = REC_CATALOG_INVALID_IDX;
+            if (writeRecCatalogEntry(fileFd, &pEntry[entryIdx], &catalogIdx) == FAIL)
+            {
+                EPRINT(DISK_MANAGER, "fail to recover recording catalog: [camera=%d], [path=%s]", channelNo, fileName);
+                break;
+            }
+        }
+        close(fileFd);
     }
 
-    bufIdx = 0;
-    timeIdxBuf[bufIdx++] = (UINT8)TIMEINDEX_FILE_EOF;
-    timeIdxBuf[bufIdx++] = TIMEINDEX_FILE_EOF >> 8;
+    MUTEX_UNLOCK(sessionInfo[channelNo].yearMapFileLock);
+    FREE_MEMORY(pEntry);
+}
 
-    // Write end of file indicator of time index  file
-    if(Utils_Write(timeFileFd, timeIdxBuf, bufIdx, pErrorCode) != bufIdx)
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Compare function to sort catalog entries in order of hour and event index in hour
+ * @param   pEntry1
+ * @param   pEntry2
+ * @return  Negative, zero or positive as per order of entries
+ */
+static int compareRecCatalogEntry(const void *pEntry1, const void *pEntry2)
+{
+    const REC_CATALOG_ENTRY_t *pCatalogEntry1 = (const REC_CATALOG_ENTRY_t *)pEntry1;
+    const REC_CATALOG_ENTRY_t *pCatalogEntry2 = (const REC_CATALOG_ENTRY_t *)pEntry2;
+
+    if (pCatalogEntry1->hourSec != pCatalogEntry2->hourSec)
     {
-        EPRINT(DISK_MANAGER, "fail to write time-index file: [path=%s], [err=%s]", timeFileName, strerror(*pErrorCode));
-        close(timeFileFd);
-        return FAIL;
+        return (pCatalogEntry1->hourSec < pCatalogEntry2->hourSec) ? -1 : 1;
     }
 
-    close(timeFileFd);
-    return SUCCESS;
+    if (pCatalogEntry1->eventIdx != pCatalogEntry2->eventIdx)
+    {
+        return (pCatalogEntry1->eventIdx < pCatalogEntry2->eventIdx) ? -1 : 1;
+    }
+
+    return 0;
 }
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   This function was updates next stream position in stream file header in case of mis
- *          matching of index and removes garbage data from file
- * @param   fileName
- * @param   pErrorCode
+ * @brief   This function writes sorted entries in catalog file from given entry onwards and updates
+ *          header as complete catalog
+ * @param   fileFd
+ * @param   pEntry
+ * @param   startIdx - First entry to write, earlier entries are already present in file
+ * @param   entryCnt
  * @return  SUCCESS/FAIL
  */
-static BOOL recoverStreamFile(CHARPTR fileName, UINT32PTR pErrorCode)
+static BOOL writeRecCatalogFile(INT32 fileFd, REC_CATALOG_ENTRY_t *pEntry, UINT32 startIdx, UINT32 entryCnt)
 {
-    INT32 				strmFileFd;
-    UINT32 				curStrmPos;
-    CHARPTR 			charSearch;
-    CHAR 				tempName[MAX_FILE_NAME_SIZE];
-    CHAR 				reName[MAX_FILE_NAME_SIZE];
-    struct tm 			localTime;
-    struct stat 		stateInfo;
-    STRM_FILE_HDR_t 	strmFileHdr;
-    STRM_FILE_END_t 	strmFileEnd;
-    FSH_INFO_t 			fshData = { 0 };
-    UINT32				curSysTick = GetSysTick();
+    UINT32              tErrorCode = INVALID_ERROR_CODE;
+    size_t              writeSize = ((size_t)(entryCnt - startIdx) * REC_CATALOG_ENTRY_SIZE);
+    REC_CATALOG_HDR_t   catalogHdr;
 
-    SET_ERROR_NUMBER(pErrorCode, INVALID_ERROR_CODE);
+    memset(&catalogHdr, 0, sizeof(REC_CATALOG_HDR_t));
+    catalogHdr.fileSign = REC_CATALOG_FILE_SIGN;
+    catalogHdr.version = REC_CATALOG_FILE_VERSION;
+    catalogHdr.entryCnt = entryCnt;
+    catalogHdr.completeF = TRUE;
+    catalogHdr.sortedF = TRUE;
 
-    // open stream file
-    strmFileFd = open(fileName, READ_WRITE_MODE, FILE_PERMISSION);
-    if(strmFileFd == INVALID_FILE_FD)
+    if ((writeSize > 0) && (Utils_pWrite(fileFd, &pEntry[startIdx], writeSize, REC_CATALOG_HDR_SIZE + ((off_t)startIdx * REC_CATALOG_ENTRY_SIZE),
+                                         &tErrorCode) != (ssize_t)writeSize))
     {
-        SET_ERROR_NUMBER(pErrorCode, errno);
-        EPRINT(DISK_MANAGER, "fail to open stream file: [path=%s], [err=%s]", fileName, STR_ERR);
+        EPRINT(DISK_MANAGER, "fail to write recording catalog: [err=%s]", strerror(tErrorCode));
         return FAIL;
     }
 
-    //Get file size
-    if(stat(fileName, &stateInfo) < STATUS_OK)
+    if (ftruncate(fileFd, REC_CATALOG_HDR_SIZE + ((off_t)entryCnt * REC_CATALOG_ENTRY_SIZE)) != STATUS_OK)
     {
-        SET_ERROR_NUMBER(pErrorCode, errno);
-        EPRINT(DISK_MANAGER, "fail to stat stream file: [path=%s], [err=%s]", fileName, STR_ERR);
-        close(strmFileFd);
+        EPRINT(DISK_MANAGER, "fail to truncate recording catalog: [err=%s]", STR_ERR);
         return FAIL;
     }
 
-    if (stateInfo.st_size < (INT32)MAX_FSH_SIZE)
+    if (Utils_pWrite(fileFd, &catalogHdr, REC_CATALOG_HDR_SIZE, 0, &tErrorCode) != REC_CATALOG_HDR_SIZE)
     {
-        // file was not proper so remove this file from database
-        if (remove(fileName) != STATUS_OK)
-        {
-            SET_ERROR_NUMBER(pErrorCode, errno);
-            EPRINT(DISK_MANAGER, "fail to remove stream file: [path=%s], [err=%s]", fileName, STR_ERR);
-            close(strmFileFd);
-            return FAIL;
-        }
-
-        close(strmFileFd);
-        return SUCCESS;
+        EPRINT(DISK_MANAGER, "fail to write recording catalog header: [err=%s]", strerror(tErrorCode));
+        return FAIL;
     }
 
-
-    // Read stream file header from starting of file
-    if(Utils_Read(strmFileFd, &strmFileHdr, STREAM_FILE_HDR_SIZE, pErrorCode) != STREAM_FILE_HDR_SIZE)
+    if (fsync(fileFd) != STATUS_OK)
     {
-        EPRINT(DISK_MANAGER, "fail to read stream file: [path=%s], [err=%s]", fileName, strerror(*pErrorCode));
-        close(strmFileFd);
+        EPRINT(DISK_MANAGER, "fail to sync recording catalog: [err=%s]", STR_ERR);
         return FAIL;
     }
 
-    // Checks RUN flag status. IF RUN flag is 1 then recovery of stream file started otherwise stream file has not any problem
-    if (FALSE == strmFileHdr.runFlg)
-    {
-        close(strmFileFd);
-        return SUCCESS;
-    }
+    return SUCCESS;
+}
 
-    curStrmPos = STREAM_FILE_HDR_SIZE;
-    /* PARASOFT : No need to validate tainted data */
-    while(stateInfo.st_size >= (INT32)(curStrmPos + MAX_FSH_SIZE))
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function builds recording catalog of camera for given year from event files of all hour
+ *          folders of that year. Catalog is built in temporary file and replaces old catalog at the end.
+ *          Recording may add events while catalog is built, so hours written meanwhile are read again
+ *          before replacing the catalog.
+ * @param   mntPoint
+ * @param   channelNo
+ * @param   year
+ * @return  SUCCESS/FAIL
+ */
+static BOOL buildYearRecCatalog(CHARPTR mntPoint, UINT8 channelNo, UINT32 year)
+{
+    BOOL                retVal = SUCCESS;
+    CHAR                dirName[MAX_FILE_NAME_SIZE];
+    CHAR                hourFolder[MAX_FILE_NAME_SIZE];
+    CHAR                fileName[MAX_FILE_NAME_SIZE];
+    CHAR                tempFileName[MAX_FILE_NAME_SIZE];
+    CHAR                month[10];
+    INT32               date, folderYear;
+    INT32               fileFd;
+    UINT8               hourCnt;
+    UINT32              entryCnt = 0, allocCnt = 0, resyncIdx;
+    UINT32              dirtyHourSec;
+    time_t              hourSec, lastHourSec;
+    struct tm           hourTm;
+    DIR                 *dir;
+    struct dirent       *entry;
+    REC_CATALOG_ENTRY_t *pEntry = NULL;
+
+    snprintf(dirName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL, mntPoint, GET_CAMERA_NO(channelNo));
+    snprintf(fileName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_INDEX_FILE_YEAR, mntPoint, GET_CAMERA_NO(channelNo), year, REC_CATALOG_FILE_EXTN);
+    snprintf(tempFileName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_INDEX_FILE_YEAR, mntPoint, GET_CAMERA_NO(channelNo), year, REC_CATALOG_TEMP_FILE_EXTN);
+
+    MUTEX_LOCK(sessionInfo[channelNo].yearMapFileLock);
+    sessionInfo[channelNo].catalogFileInfo.dirtyHourSec = REC_CATALOG_INVALID_HOUR;
+    MUTEX_UNLOCK(sessionInfo[channelNo].yearMapFileLock);
+
+    /* PARASOFT : No need to validate file path */
+    dir = opendir(dirName);
+    if (dir == NULL)
     {
-        if(ElapsedTick(curSysTick) >= CONVERT_SEC_TO_TIMER_COUNT(RECOVERY_TIME_OUT))
-        {
-            close(strmFileFd);
-            EPRINT(DISK_MANAGER, "recovery timeout occurred");
-            return FAIL;
-        }
+        EPRINT(DISK_MANAGER, "fail to open recording dir: [camera=%d], [path=%s], [err=%s]", channelNo, dirName, STR_ERR);
+        return FAIL;
+    }
 
-        // Go to currStreamPos in file
-        if(-1 == lseek(strmFileFd, curStrmPos, SEEK_SET))
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if ((strstr(entry->d_name, YEAR_MAP_FILE_EXTN)) || (strstr(entry->d_name, REC_CATALOG_FILE_EXTN))
+                || (strcmp(entry->d_name, ".") == 0) || (strcmp(entry->d_name, "..") == 0))
         {
-            SET_ERROR_NUMBER(pErrorCode, errno);
-            EPRINT(DISK_MANAGER, "fail to seek stream file: [path=%s], [err=%s]", fileName, STR_ERR);
-            close(strmFileFd);
-            return FAIL;
+            continue;
         }
 
-        // read fsh data from file
-        if(Utils_Read(strmFileFd, &fshData, MAX_FSH_SIZE, pErrorCode) != MAX_FSH_SIZE)
+        /* PARASOFT : No need to validate tainted data */
+        if ((sscanf(entry->d_name, "%d_%03s_%d", &date, month, &folderYear) != 3) || ((UINT32)folderYear != year))
         {
-            EPRINT(DISK_MANAGER, "fail to read stream file fsh: [path=%s], [err=%s]", fileName, strerror(*pErrorCode));
-            close(strmFileFd);
-            return FAIL;
+            continue;
         }
 
-        //Check valid FSH present
-        if(fshData.startCode != FSH_START_CODE)
+        for (hourCnt = 0; hourCnt < HOUR_IN_ONE_DAY; hourCnt++)
         {
-            if(STATUS_OK != ftruncate(strmFileFd, curStrmPos))
+            snprintf(hourFolder, MAX_FILE_NAME_SIZE, "%s%s/" REC_FOLDER_HOUR_FORMAT, dirName, entry->d_name, hourCnt);
+            if (readRecCatalogHourEntries(hourFolder, &pEntry, &entryCnt, &allocCnt) == FAIL)
             {
-                SET_ERROR_NUMBER(pErrorCode, errno);
-                EPRINT(DISK_MANAGER, "fail to truncate stream file: [path=%s], [err=%s]", fileName, STR_ERR);
-                close(strmFileFd);
-                return FAIL;
+                retVal = FAIL;
+                break;
             }
-
-            EPRINT(DISK_MANAGER, "valid fsh not found: [path=%s]", fileName);
-            close(strmFileFd);
-            return UNKNOWN;
-        }
-
-        // check that stream file size was more than current FSH + payload size
-        if(stateInfo.st_size >= (INT32)((curStrmPos + fshData.fshLen + MAX_FSH_SIZE)))
-        {
-            // update current stream position
-            curStrmPos = fshData.nextFShPos;
-            continue;
-        }
-
-        // set currrent stream position to previous FSH position
-        curStrmPos = fshData.prevFshPos;
-        if(-1 == lseek(strmFileFd, curStrmPos, SEEK_SET))
-        {
-            SET_ERROR_NUMBER(pErrorCode, errno);
-            EPRINT(DISK_MANAGER, "fail to seek stream file: [path=%s], [err=%s]", fileName, STR_ERR);
-            close(strmFileFd);
-            return FAIL;
-        }
-
-        if(Utils_Read(strmFileFd, &fshData, MAX_FSH_SIZE, pErrorCode) != MAX_FSH_SIZE)
-        {
-            SET_ERROR_NUMBER(pErrorCode, errno);
-            EPRINT(DISK_MANAGER, "fail to read stream file fsh: [path=%s], [err=%s]", fileName, strerror(*pErrorCode));
-            close(strmFileFd);
-            return FAIL;
         }
 
-        /* Truncate stream file */
-        curStrmPos = fshData.nextFShPos;
-        if(-1 == lseek(strmFileFd, curStrmPos, SEEK_SET))
+        if (retVal == FAIL)
         {
-            SET_ERROR_NUMBER(pErrorCode, errno);
-            EPRINT(DISK_MANAGER, "fail to seek stream file: [path=%s], [err=%s]", fileName, STR_ERR);
-            close(strmFileFd);
-            return FAIL;
+            break;
         }
+    }
+    closedir(dir);
 
-        DPRINT(DISK_MANAGER, "current stream file status: [path=%s], [position=%d]", fileName, curStrmPos);
-        if(STATUS_OK != ftruncate(strmFileFd, lseek(strmFileFd, 0, SEEK_CUR)))
-        {
-            SET_ERROR_NUMBER(pErrorCode, errno);
-            EPRINT(DISK_MANAGER, "fail to truncate stream file: [path=%s], [err=%s]", fileName, STR_ERR);
-            close(strmFileFd);
-            return FAIL;
-        }
-        break;
+    if (retVal == FAIL)
+    {
+        FREE_MEMORY(pEntry);
+        return FAIL;
     }
 
-    // Write currStreamPos @ next stream position in stream file header
-    strmFileHdr.nextStreamPos = curStrmPos;
-    strmFileHdr.runFlg = FALSE;
+    if (entryCnt > 1)
+    {
+        qsort(pEntry, entryCnt, REC_CATALOG_ENTRY_SIZE, compareRecCatalogEntry);
+    }
 
-    DPRINT(DISK_MANAGER, "write stream header: [path=%s], [position=%d]", fileName, curStrmPos);
-    if(Utils_pWrite(strmFileFd, &strmFileHdr, STREAM_FILE_HDR_SIZE, 0, pErrorCode) != STREAM_FILE_HDR_SIZE)
+    fileFd = open(tempFileName, CREATE_RDWR_MODE | O_TRUNC, FILE_PERMISSION);
+    if (fileFd == INVALID_FILE_FD)
     {
-        EPRINT(DISK_MANAGER, "fail to read stream file fsh: [path=%s], [err=%s]", fileName, strerror(*pErrorCode));
-        close(strmFileFd);
+        EPRINT(DISK_MANAGER, "fail to create recording catalog: [camera=%d], [path=%s], [err=%s]", channelNo, tempFileName, STR_ERR);
+        FREE_MEMORY(pEntry);
         return FAIL;
     }
 
-    //	Write valid end of file @ currStreamPos
-    strmFileEnd.fileEndIndicator = STRM_EOF_INDICATOR;
-    strmFileEnd.prevFshPos = (fshData.nextFShPos - fshData.fshLen);
-    if(Utils_pWrite(strmFileFd, &strmFileEnd, STREAM_FILE_END_SIZE, lseek(strmFileFd, 0, SEEK_END), pErrorCode) != STREAM_FILE_END_SIZE)
+    if (writeRecCatalogFile(fileFd, pEntry, 0, entryCnt) == FAIL)
     {
-        EPRINT(DISK_MANAGER, "fail to write stream file fsh: [path=%s], [err=%s]", fileName, strerror(*pErrorCode));
-        close(strmFileFd);
+        close(fileFd);
+        unlink(tempFileName);
+        FREE_MEMORY(pEntry);
         return FAIL;
     }
 
-    /* Close the stream file */
-    close(strmFileFd);
-
-    /* Update the stream file name */
-    charSearch = strchr(fileName, '~');
-    if (charSearch == NULL)
+    MUTEX_LOCK(sessionInfo[channelNo].yearMapFileLock);
+    dirtyHourSec = sessionInfo[channelNo].catalogFileInfo.dirtyHourSec;
+    if (dirtyHourSec != REC_CATALOG_INVALID_HOUR)
     {
-        return SUCCESS;
+        /* Read hours again from oldest hour written meanwhile till current hour. Older hour is written only
+         * when folders are removed or system time is changed, so catalog is built again on next mount */
+        GetLocalTimeInSec(&lastHourSec);
+        lastHourSec = GET_REC_CATALOG_HOUR(lastHourSec);
+        if (lastHourSec < (time_t)dirtyHourSec)
+        {
+            lastHourSec = dirtyHourSec;
+        }
+
+        if ((lastHourSec - (time_t)dirtyHourSec) > (REC_CATALOG_RESYNC_HOUR_MAX * SEC_IN_ONE_HOUR))
+        {
+            WPRINT(DISK_MANAGER, "recording catalog changed while building: [camera=%d], [year=%d]", channelNo, year);
+            retVal = FAIL;
+        }
+        else
+        {
+            resyncIdx = entryCnt;
+            while ((resyncIdx > 0) && (pEntry[resyncIdx - 1].hourSec >= dirtyHourSec))
+            {
+                resyncIdx--;
+            }
+
+            entryCnt = resyncIdx;
+            for (hourSec = dirtyHourSec; hourSec <= lastHourSec; hourSec += SEC_IN_ONE_HOUR)
+            {
+                if ((ConvertLocalTimeInBrokenTm(&hourSec, &hourTm) == FAIL) || ((UINT32)hourTm.tm_year != year))
+                {
+                    continue;
+                }
+
+                snprintf(hourFolder, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_FOLDER_DATE_HOUR_FORMAT, mntPoint, GET_CAMERA_NO(channelNo),
+                         hourTm.tm_mday, GetMonthName(hourTm.tm_mon), hourTm.tm_year, hourTm.tm_hour);
+                if (readRecCatalogHourEntries(hourFolder, &pEntry, &entryCnt, &allocCnt) == FAIL)
+                {
+                    retVal = FAIL;
+                    break;
+                }
+            }
+
+            if (retVal == SUCCESS)
+            {
+                retVal = writeRecCatalogFile(fileFd, pEntry, resyncIdx, entryCnt);
+            }
+        }
     }
 
-    /* Get file start time */
-    snprintf(tempName, MIN(MAX_FILE_NAME_SIZE, (strlen(fileName) - strlen(charSearch) + 1)), "%s", fileName);
-    charSearch = strchr(fileName, '.');
-    if(charSearch == NULL)
+    close(fileFd);
+    if ((retVal == SUCCESS) && (rename(tempFileName, fileName) != STATUS_OK))
     {
-        return SUCCESS;
+        EPRINT(DISK_MANAGER, "fail to rename recording catalog: [camera=%d], [path=%s], [err=%s]", channelNo, tempFileName, STR_ERR);
+        retVal = FAIL;
     }
 
-    time_t totalSec = fshData.localTime.totalSec;
-    ConvertLocalTimeInBrokenTm(&totalSec, &localTime);
-    snprintf(reName, MAX_FILE_NAME_SIZE, "%s~"REC_FOLDER_TIME_FORMAT"%s", tempName, localTime.tm_hour, localTime.tm_min, localTime.tm_sec, charSearch);
-    if(rename(fileName, reName) != STATUS_OK)
+    if (retVal == SUCCESS)
     {
-        SET_ERROR_NUMBER(pErrorCode, errno);
-        EPRINT(DISK_MANAGER, "fail to rename stream file: [old=%s], [new=%s], [err=%s]", fileName, reName, STR_ERR);
-        return FAIL;
+        /* Recording reopens the new catalog and places its running events again */
+        if (strcmp(sessionInfo[channelNo].catalogFileInfo.fileName, fileName) == STATUS_OK)
+        {
+            CloseFileFd(&sessionInfo[channelNo].catalogFileInfo.fileFd);
+        }
+    }
+    else
+    {
+        unlink(tempFileName);
     }
+    MUTEX_UNLOCK(sessionInfo[channelNo].yearMapFileLock);
 
-    return SUCCESS;
+    FREE_MEMORY(pEntry);
+    return retVal;
 }
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   This function find out newest folder with 2 directory depth from given base directory and channelNo
+ * @brief   This function builds recording catalog of every camera and year on volume for which catalog
+ *          is not present or is not complete. Catalog is incomplete when recording was stored without it
+ *          (older firmware or index build pending) or when its update failed.
  * @param   mntPoint
- * @param   channelNo
- * @param   newestFolder
- * @param   recoveryInfo
- * @param   pErrorCode
  * @return  SUCCESS/FAIL
  */
-static BOOL getLatestHourFolder(CHARPTR mntPoint, UINT8 channelNo, CHARPTR newestFolder, RECOVERY_INFO_t *recoveryInfo, UINT32PTR pErrorCode)
+BOOL BuildRecCatalog(CHARPTR mntPoint)
 {
-    UINT8           subDir;
-    CHAR            folderName[MAX_FILE_NAME_SIZE];
-    CHAR            channelFolder[MAX_FILE_NAME_SIZE];
-    CHAR            newChannelFolder[MAX_FILE_NAME_SIZE];
-    CHAR            month[10];
-    CHARPTR         tmpPtr = NULL;
-    INT32           channelCnt = 0, date = 0, year = 0, hour = 0;
-    DIR 			*dir;
-    struct dirent 	*entry;
-    struct stat		channelStat;
-    struct stat		newChannelStat;
+    BOOL                retVal = SUCCESS;
+    UINT8               camId;
+    CHAR                dirName[MAX_FILE_NAME_SIZE];
+    CHAR                fileName[MAX_FILE_NAME_SIZE];
+    INT32               year;
+    INT32               fileFd;
+    BOOL                completeF;
+    REC_CATALOG_HDR_t   catalogHdr;
+    DIR                 *dir;
+    struct dirent       *entry;
 
-    SET_ERROR_NUMBER(pErrorCode, INVALID_ERROR_CODE);
-    snprintf(folderName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL, mntPoint, channelNo);
-    snprintf(newChannelFolder, MAX_FILE_NAME_SIZE, "%s", folderName);
+    if (aviRecGenConfig.recordFormatType == REC_AVI_FORMAT)
+    {
+        return SUCCESS;
+    }
 
-    for(subDir = 0; subDir < 2; subDir++)
+    MUTEX_LOCK(recCatalogBuildLock);
+    for (camId = 0; camId < getMaxCameraForCurrentVariant(); camId++)
     {
-        memset(&newChannelStat, 0, sizeof(newChannelStat));
-        snprintf(channelFolder, MAX_FILE_NAME_SIZE, "%s", newChannelFolder);
+        snprintf(dirName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL, mntPoint, GET_CAMERA_NO(camId));
 
-        dir = opendir(channelFolder);
-        if(dir == NULL)
+        /* PARASOFT : No need to validate file path */
+        dir = opendir(dirName);
+        if (dir == NULL)
         {
-            SET_ERROR_NUMBER(pErrorCode, errno);
-            EPRINT(DISK_MANAGER, "fail to open dir: [path=%s], [err=%s]", channelFolder, STR_ERR);
-            newestFolder[0] = '\0';
-            return FAIL;
+            continue;
         }
 
-        while((entry = readdir(dir)) != NULL)
+        /* Every year of recording has year map file */
+        while ((entry = readdir(dir)) != NULL)
         {
-            if(strstr(entry->d_name, YEAR_MAP_FILE_EXTN))
+            if (strstr(entry->d_name, YEAR_MAP_FILE_EXTN) == NULL)
             {
                 continue;
             }
 
-            // check this file was stream file
-            snprintf(folderName, MAX_FILE_NAME_SIZE, "%s%s/", channelFolder, entry->d_name);
-            if (stat(folderName, &channelStat) != STATUS_OK)
+            /* PARASOFT : No need to validate tainted data */
+            if (sscanf(entry->d_name, "REC" TFP "%d", &year) != 1)
             {
-                EPRINT(DISK_MANAGER, "fail to stat channel dir: [path=%s], [err=%s]", folderName, STR_ERR);
-                SET_ERROR_NUMBER(pErrorCode, errno);
-                closedir(dir);
-                newestFolder[0] = '\0';
-                return FAIL;
+                continue;
             }
 
-            if((strcmp(entry->d_name, ".") == 0) || (strcmp(entry->d_name, "..") == 0))
+            completeF = FALSE;
+            snprintf(fileName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_INDEX_FILE_YEAR, mntPoint, GET_CAMERA_NO(camId), year, REC_CATALOG_FILE_EXTN);
+            fileFd = open(fileName, READ_ONLY_MODE);
+            if (fileFd != INVALID_FILE_FD)
+            {
+                if ((readRecCatalogHdr(fileFd, &catalogHdr) == SUCCESS) && (catalogHdr.completeF == TRUE))
+                {
+                    completeF = TRUE;
+                }
+                close(fileFd);
+            }
+
+            if (completeF == TRUE)
             {
                 continue;
             }
 
-            if((channelStat.st_mtime > newChannelStat.st_mtime))
+            DPRINT(DISK_MANAGER, "recording catalog building started: [camera=%d], [year=%d]", camId, year);
+            if (buildYearRecCatalog(mntPoint, camId, year) == FAIL)
             {
-                snprintf(newChannelFolder, MAX_FILE_NAME_SIZE, "%s", folderName);
-                memcpy(&newChannelStat, &channelStat, sizeof(newChannelStat));
+                EPRINT(DISK_MANAGER, "fail to build recording catalog: [camera=%d], [year=%d]", camId, year);
+                retVal = FAIL;
             }
         }
-
-        DPRINT(DISK_MANAGER, "newest folder found: [path=%s]", newChannelFolder);
         closedir(dir);
     }
+    MUTEX_UNLOCK(recCatalogBuildLock);
 
-    snprintf(newestFolder, MAX_FILE_NAME_SIZE, "%s", newChannelFolder);
-    tmpPtr = strstr(newChannelFolder, CHANNEL_NAME_REC);
-    if (NULL == tmpPtr)
-    {
-        return FAIL;
-    }
-
-    sscanf(tmpPtr, CHANNEL_NAME_REC"%02d/%d_%03s_%d/%d/",&channelCnt, &date, month, &year,&hour);
-    recoveryInfo->date = date;
-    recoveryInfo->mon = GetMonthNo(month);
-    recoveryInfo->year = year;
-    recoveryInfo->hour = hour;
-    return SUCCESS;
+    return retVal;
 }
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   This function was read a recovery file from hardisk for each channel and starts recovery
- *          of corrupted files. This function was read last modified date and hour value and performs
- *          recovery for that folder only.
- * @param   mntPoint
- * @param   iDiskId
+ * @brief   This function was check that time index information was properly organized or not.
+ *          If file was not proper then removes some un useful information from file
+ * @param   path
+ * @param   pErrorCode
  * @return  SUCCESS/FAIL
  */
-BOOL StartRecovery(CHARPTR 	mntPoint, RECORD_ON_DISK_e iDiskId)
+static BOOL recoverTimeIdxFile(CHARPTR path, UINT32PTR pErrorCode)
 {
-    BOOL				retVal = FAIL;
-    BOOL				strmRecStatus;
-    BOOL				remFolder = FALSE;
+    UINT8 					bufIdx;
+    CHAR 					timeIdxBuf[2];
+    CHAR 					timeFileName[MAX_FILE_NAME_SIZE];
+    CHAR 					strmFileName[MAX_FILE_NAME_SIZE];
+    INT32 					timeFileFd;
+    UINT32 					fileOffset;
+    UINT32 					strmFileSize;
+    UINT32					strmFileNo;
+    struct stat 			stateInfo;
+    METADATA_FILE_HDR_t 	timeIdxFileInfo;
+    TIMEIDX_FIELD_INFO_t 	timeIdxField;
+    UINT32					curSysTick = GetSysTick();
+
+    SET_ERROR_NUMBER(pErrorCode, INVALID_ERROR_CODE);
+
+    // make file name for event file
+    snprintf(timeFileName, MAX_FILE_NAME_SIZE, "%s%s", path, TIMEIDX_FILE_NAME);
+
+    //Open time index  file
+    timeFileFd = open(timeFileName, READ_WRITE_MODE, FILE_PERMISSION);
+    if(timeFileFd == INVALID_FILE_FD)
+    {
+        SET_ERROR_NUMBER(pErrorCode, errno);
+        EPRINT(DISK_MANAGER, "fail to open time-index file: [path=%s]", timeFileName);
+        return FAIL;
+    }
+
+    // 	Get size of time index into fileSize
+    if(stat(timeFileName, &stateInfo) < STATUS_OK)
+    {
+        SET_ERROR_NUMBER(pErrorCode, errno);
+        EPRINT(DISK_MANAGER, "fail to stat time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
+        close(timeFileFd);
+        return FAIL;
+    }
+
+    // Read the file header of time index file. Get the next time index number in nextTimeIdxNo
+    if(Utils_Read(timeFileFd, &timeIdxFileInfo, TIMEIDX_FILE_HDR_SIZE, pErrorCode) != TIMEIDX_FILE_HDR_SIZE)
+    {
+        EPRINT(DISK_MANAGER, "fail to read time-index file: [path=%s], [err=%s]", timeFileName, strerror(*pErrorCode));
+        close(timeFileFd);
+        return FAIL;
+    }
+
+    // each time index information takes 6 bytes and Calculate offset position in to file for nextTimeIdxNo
+    fileOffset = ((timeIdxFileInfo.nextMetaDataIdx * TIME_INDEX_FIELD_SIZE) + TIMEIDX_FILE_HDR_SIZE);
+    if((INT32)fileOffset < stateInfo.st_size)
+    {
+        // when last time index information was written into file but updation of next time index position was not possible.
+        // So correct this condition here
+        timeIdxFileInfo.nextMetaDataIdx += ((stateInfo.st_size - fileOffset) / TIME_INDEX_FIELD_SIZE);
+
+        //Update nextTimeIdxNo in current event file @ file header @ 6th byte
+        if(Utils_pWrite(timeFileFd, &timeIdxFileInfo, TIMEIDX_FILE_HDR_SIZE, 0, pErrorCode) != TIMEIDX_FILE_HDR_SIZE)
+        {
+            EPRINT(DISK_MANAGER, "fail to write time-index file: [path=%s], [err=%s]", timeFileName, strerror(*pErrorCode));
+            close(timeFileFd);
+            return FAIL;
+        }
+
+        // After nextTimeIdxNo, if any data was present that was garbage or incomplete data so remove it from file
+        fileOffset = ((timeIdxFileInfo.nextMetaDataIdx * TIME_INDEX_FIELD_SIZE) + TIMEIDX_FILE_HDR_SIZE);
+        if((stateInfo.st_size - fileOffset) > 0)
+        {
+            if(-1 == lseek(timeFileFd, fileOffset, SEEK_SET))
+            {
+                SET_ERROR_NUMBER(pErrorCode, errno);
+                EPRINT(DISK_MANAGER, "fail to seek time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
+                close(timeFileFd);
+                return FAIL;
+            }
+
+            //remove no. of bytes from nextIFrameIdx in current event file
+            if(-1 == ftruncate(timeFileFd, lseek(timeFileFd, 0, SEEK_CUR)))
+            {
+                SET_ERROR_NUMBER(pErrorCode, errno);
+                EPRINT(DISK_MANAGER, "fail to truncate time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
+                close(timeFileFd);
+                return FAIL;
+            }
+        }
+    }
+
+    if(-1 == lseek(timeFileFd, fileOffset, SEEK_SET))
+    {
+        SET_ERROR_NUMBER(pErrorCode, errno);
+        EPRINT(DISK_MANAGER, "fail to seek time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
+        close(timeFileFd);
+        return FAIL;
+    }
+
+    bufIdx = 0;
+    timeIdxBuf[bufIdx++] = (UINT8)TIMEINDEX_FILE_EOF;
+    timeIdxBuf[bufIdx++] = TIMEINDEX_FILE_EOF >> 8;
+
+    // 	Write end of file indicator of time index file
+    if(Utils_Write(timeFileFd, timeIdxBuf, bufIdx, pErrorCode) != bufIdx)
+    {
+        EPRINT(DISK_MANAGER, "fail to write time-index file: [path=%s], [err=%s]", timeFileName, strerror(*pErrorCode));
+        close(timeFileFd);
+        return FAIL;
+    }
+
+    // Read the file header of time index
+    if(pread(timeFileFd, &timeIdxFileInfo, TIMEIDX_FILE_HDR_SIZE, lseek(timeFileFd, 0, SEEK_SET)) != TIMEIDX_FILE_HDR_SIZE)
+    {
+        SET_ERROR_NUMBER(pErrorCode, errno);
+        EPRINT(DISK_MANAGER, "fail to read time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
+        close(timeFileFd);
+        return FAIL;
+    }
+
+    if(getAllStreamFileCount(path, &strmFileNo, NULL) == FAIL)
+    {
+        close(timeFileFd);
+        EPRINT(DISK_MANAGER, "fail to get all stream file count: [path=%s]", path);
+        return FAIL;
+    }
+
+    while(timeIdxFileInfo.nextMetaDataIdx > 0)
+    {
+        if(ElapsedTick(curSysTick) >= CONVERT_SEC_TO_TIMER_COUNT(RECOVERY_TIME_OUT))
+        {
+            close(timeFileFd);
+            EPRINT(DISK_MANAGER, "recovery timeout occurred");
+            return FAIL;
+        }
+
+        // get last time index information position in file
+        fileOffset = (((timeIdxFileInfo.nextMetaDataIdx - 1) * TIME_INDEX_FIELD_SIZE) + TIMEIDX_FILE_HDR_SIZE);
+        if(-1 == lseek(timeFileFd, fileOffset, SEEK_SET))
+        {
+            SET_ERROR_NUMBER(pErrorCode, errno);
+            EPRINT(DISK_MANAGER, "fail to seek time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
+            close(timeFileFd);
+            return FAIL;
+        }
+
+        // Read time index information in readBuff and Get streamFileId, streamFilePos from readBuff (as per time index information)
+        if(Utils_Read(timeFileFd, &timeIdxField, TIME_INDEX_FIELD_SIZE, pErrorCode) != TIME_INDEX_FIELD_SIZE)
+        {
+            EPRINT(DISK_MANAGER, "fail to read time-index file: [path=%s], [err=%s]", timeFileName, strerror(*pErrorCode));
+            close(timeFileFd);
+            return FAIL;
+        }
+
+        // get current FSH position for last time index information in time index  file
+        if(timeIdxField.streamFileId <= strmFileNo)
+        {
+            // Get stream file name from streamFileId in streamFile and Get stream file size in streamFileSize
+            if(getStreamFileName(path, strmFileNo, strmFileName, &strmFileSize) == FAIL)
+            {
+                close(timeFileFd);
+                EPRINT(DISK_MANAGER, "fail to get stream file name: [path=%s], [strmFileId=%d]", path, strmFileNo);
+                return FAIL;
+            }
+
+            // Check that this streamFilePos is valid or not
+            if(strmFileSize >= timeIdxField.fshPos)
+            {
+                // stream file position was properly set as per time index says
+                break;
+            }
+        }
+
+        // Go to next time index index number
+        if(-1 == ftruncate(timeFileFd, lseek(timeFileFd, fileOffset, SEEK_SET)))
+        {
+            SET_ERROR_NUMBER(pErrorCode, errno);
+            EPRINT(DISK_MANAGER, "fail to truncate time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
+            close(timeFileFd);
+            return FAIL;
+        }
+        timeIdxFileInfo.nextMetaDataIdx--;
+    }
+
+    // get last time index information position in file
+    fileOffset = ((timeIdxFileInfo.nextMetaDataIdx * TIME_INDEX_FIELD_SIZE) + TIMEIDX_FILE_HDR_SIZE);
+
+    // Go to next time index  index number
+    if(-1 == lseek(timeFileFd, fileOffset, SEEK_SET))
+    {
+        SET_ERROR_NUMBER(pErrorCode, errno);
+        EPRINT(DISK_MANAGER, "fail to seek time-index file: [path=%s], [err=%s]", timeFileName, STR_ERR);
+        close(timeFileFd);
+        return FAIL;
+    }
+
+    // Update nextIFrameIdx in current time index  file @ file header @ 5th byte
+    if (Utils_pWrite(timeFileFd, &timeIdxFileInfo, TIMEIDX_FILE_HDR_SIZE, 0, pErrorCode) != TIMEIDX_FILE_HDR_SIZE)
+    {
+        EPRINT(DISK_MANAGER, "fail to write time-index file: [path=%s], [err=%s]", timeFileName, strerror(*pErrorCode));
+        close(timeFileFd);
+        return FAIL;
+    }
+
+    bufIdx = 0;
+    timeIdxBuf[bufIdx++] = (UINT8)TIMEINDEX_FILE_EOF;
+    timeIdxBuf[bufIdx++] = TIMEINDEX_FILE_EOF >> 8;
+
+    // Write end of file indicator of time index  file
+    if(Utils_Write(timeFileFd, timeIdxBuf, bufIdx, pErrorCode) != bufIdx)
+    {
+        EPRINT(DISK_MANAGER, "fail to write time-index file: [path=%s], [err=%s]", timeFileName, strerror(*pErrorCode));
+        close(timeFileFd);
+        return FAIL;
+    }
+
+    close(timeFileFd);
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function was updates next stream position in stream file header in case of mis
+ *          matching of index and removes garbage data from file
+ * @param   fileName
+ * @param   pErrorCode
+ * @return  SUCCESS/FAIL
+ */
+static BOOL recoverStreamFile(CHARPTR fileName, UINT32PTR pErrorCode)
+{
+    INT32 				strmFileFd;
+    UINT32 				curStrmPos;
+    CHARPTR 			charSearch;
+    CHAR 				tempName[MAX_FILE_NAME_SIZE];
+    CHAR 				reName[MAX_FILE_NAME_SIZE];
+    struct tm 			localTime;
+    struct stat 		stateInfo;
+    STRM_FILE_HDR_t 	strmFileHdr;
+    STRM_FILE_END_t 	strmFileEnd;
+    FSH_INFO_t 			fshData = { 0 };
+    UINT32				curSysTick = GetSysTick();
+
+    SET_ERROR_NUMBER(pErrorCode, INVALID_ERROR_CODE);
+
+    // open stream file
+    strmFileFd = open(fileName, READ_WRITE_MODE, FILE_PERMISSION);
+    if(strmFileFd == INVALID_FILE_FD)
+    {
+        SET_ERROR_NUMBER(pErrorCode, errno);
+        EPRINT(DISK_MANAGER, "fail to open stream file: [path=%s], [err=%s]", fileName, STR_ERR);
+        return FAIL;
+    }
+
+    //Get file size
+    if(stat(fileName, &stateInfo) < STATUS_OK)
+    {
+        SET_ERROR_NUMBER(pErrorCode, errno);
+        EPRINT(DISK_MANAGER, "fail to stat stream file: [path=%s], [err=%s]", fileName, STR_ERR);
+        close(strmFileFd);
+        return FAIL;
+    }
+
+    if (stateInfo.st_size < (INT32)MAX_FSH_SIZE)
+    {
+        // file was not proper so remove this file from database
+        if (remove(fileName) != STATUS_OK)
+        {
+            SET_ERROR_NUMBER(pErrorCode, errno);
+            EPRINT(DISK_MANAGER, "fail to remove stream file: [path=%s], [err=%s]", fileName, STR_ERR);
+            close(strmFileFd);
+            return FAIL;
+        }
+
+        close(strmFileFd);
+        return SUCCESS;
+    }
+
+
+    // Read stream file header from starting of file
+    if(Utils_Read(strmFileFd, &strmFileHdr, STREAM_FILE_HDR_SIZE, pErrorCode) != STREAM_FILE_HDR_SIZE)
+    {
+        EPRINT(DISK_MANAGER, "fail to read stream file: [path=%s], [err=%s]", fileName, strerror(*pErrorCode));
+        close(strmFileFd);
+        return FAIL;
+    }
+
+    // Checks RUN flag status. IF RUN flag is 1 then recovery of stream file started otherwise stream file has not any problem
+    if (FALSE == strmFileHdr.runFlg)
+    {
+        close(strmFileFd);
+        return SUCCESS;
+    }
+
+    /* Frame headers are walked from start to end of file, so let kernel read ahead */
+    posix_fadvise(strmFileFd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    curStrmPos = STREAM_FILE_HDR_SIZE;
+    /* PARASOFT : No need to validate tainted data */
+    while(stateInfo.st_size >= (INT32)(curStrmPos + MAX_FSH_SIZE))
+    {
+        if(ElapsedTick(curSysTick) >= CONVERT_SEC_TO_TIMER_COUNT(RECOVERY_TIME_OUT))
+        {
+            close(strmFileFd);
+            EPRINT(DISK_MANAGER, "recovery timeout occurred");
+            return FAIL;
+        }
+
+        // Go to currStreamPos in file
+        if(-1 == lseek(strmFileFd, curStrmPos, SEEK_SET))
+        {
+            SET_ERROR_NUMBER(pErrorCode, errno);
+            EPRINT(DISK_MANAGER, "fail to seek stream file: [path=%s], [err=%s]", fileName, STR_ERR);
+            close(strmFileFd);
+            return FAIL;
+        }
+
+        // read fsh data from file
+        if(Utils_Read(strmFileFd, &fshData, MAX_FSH_SIZE, pErrorCode) != MAX_FSH_SIZE)
+        {
+            EPRINT(DISK_MANAGER, "fail to read stream file fsh: [path=%s], [err=%s]", fileName, strerror(*pErrorCode));
+            close(strmFileFd);
+            return FAIL;
+        }
+
+        //Check valid FSH present
+        if(fshData.startCode != FSH_START_CODE)
+        {
+            if(STATUS_OK != ftruncate(strmFileFd, curStrmPos))
+            {
+                SET_ERROR_NUMBER(pErrorCode, errno);
+                EPRINT(DISK_MANAGER, "fail to truncate stream file: [path=%s], [err=%s]", fileName, STR_ERR);
+                close(strmFileFd);
+                return FAIL;
+            }
+
+            EPRINT(DISK_MANAGER, "valid fsh not found: [path=%s]", fileName);
+            close(strmFileFd);
+            return UNKNOWN;
+        }
+
+        // check that stream file size was more than current FSH + payload size
+        if(stateInfo.st_size >= (INT32)((curStrmPos + fshData.fshLen + MAX_FSH_SIZE)))
+        {
+            // update current stream position
+            curStrmPos = fshData.nextFShPos;
+            continue;
+        }
+
+        // set currrent stream position to previous FSH position
+        curStrmPos = fshData.prevFshPos;
+        if(-1 == lseek(strmFileFd, curStrmPos, SEEK_SET))
+        {
+            SET_ERROR_NUMBER(pErrorCode, errno);
+            EPRINT(DISK_MANAGER, "fail to seek stream file: [path=%s], [err=%s]", fileName, STR_ERR);
+            close(strmFileFd);
+            return FAIL;
+        }
+
+        if(Utils_Read(strmFileFd, &fshData, MAX_FSH_SIZE, pErrorCode) != MAX_FSH_SIZE)
+        {
+            SET_ERROR_NUMBER(pErrorCode, errno);
+            EPRINT(DISK_MANAGER, "fail to read stream file fsh: [path=%s], [err=%s]", fileName, strerror(*pErrorCode));
+            close(strmFileFd);
+            return FAIL;
+        }
+
+        /* Truncate stream file */
+        curStrmPos = fshData.nextFShPos;
+        if(-1 == lseek(strmFileFd, curStrmPos, SEEK_SET))
+        {
+            SET_ERROR_NUMBER(pErrorCode, errno);
+            EPRINT(DISK_MANAGER, "fail to seek stream file: [path=%s], [err=%s]", fileName, STR_ERR);
+            close(strmFileFd);
+            return FAIL;
+        }
+
+        DPRINT(DISK_MANAGER, "current stream file status: [path=%s], [position=%d]", fileName, curStrmPos);
+        if(STATUS_OK != ftruncate(strmFileFd, lseek(strmFileFd, 0, SEEK_CUR)))
+        {
+            SET_ERROR_NUMBER(pErrorCode, errno);
+            EPRINT(DISK_MANAGER, "fail to truncate stream file: [path=%s], [err=%s]", fileName, STR_ERR);
+            close(strmFileFd);
+            return FAIL;
+        }
+        break;
+    }
+
+    // Write currStreamPos @ next stream position in stream file header
+    strmFileHdr.nextStreamPos = curStrmPos;
+    strmFileHdr.runFlg = FALSE;
+
+    DPRINT(DISK_MANAGER, "write stream header: [path=%s], [position=%d]", fileName, curStrmPos);
+    if(Utils_pWrite(strmFileFd, &strmFileHdr, STREAM_FILE_HDR_SIZE, 0, pErrorCode) != STREAM_FILE_HDR_SIZE)
+    {
+        EPRINT(DISK_MANAGER, "fail to read stream file fsh: [path=%s], [err=%s]", fileName, strerror(*pErrorCode));
+        close(strmFileFd);
+        return FAIL;
+    }
+
+    //	Write valid end of file @ currStreamPos
+    strmFileEnd.fileEndIndicator = STRM_EOF_INDICATOR;
+    strmFileEnd.prevFshPos = (fshData.nextFShPos - fshData.fshLen);
+    if(Utils_pWrite(strmFileFd, &strmFileEnd, STREAM_FILE_END_SIZE, lseek(strmFileFd, 0, SEEK_END), pErrorCode) != STREAM_FILE_END_SIZE)
+    {
+        EPRINT(DISK_MANAGER, "fail to write stream file fsh: [path=%s], [err=%s]", fileName, strerror(*pErrorCode));
+        close(strmFileFd);
+        return FAIL;
+    }
+
+    /* Close the stream file */
+    close(strmFileFd);
+
+    /* Update the stream file name */
+    charSearch = strchr(fileName, '~');
+    if (charSearch == NULL)
+    {
+        return SUCCESS;
+    }
+
+    /* Get file start time */
+    snprintf(tempName, MIN(MAX_FILE_NAME_SIZE, (strlen(fileName) - strlen(charSearch) + 1)), "%s", fileName);
+    charSearch = strchr(fileName, '.');
+    if(charSearch == NULL)
+    {
+        return SUCCESS;
+    }
+
+    time_t totalSec = fshData.localTime.totalSec;
+    ConvertLocalTimeInBrokenTm(&totalSec, &localTime);
+    snprintf(reName, MAX_FILE_NAME_SIZE, "%s~"REC_FOLDER_TIME_FORMAT"%s", tempName, localTime.tm_hour, localTime.tm_min, localTime.tm_sec, charSearch);
+    if(rename(fileName, reName) != STATUS_OK)
+    {
+        SET_ERROR_NUMBER(pErrorCode, errno);
+        EPRINT(DISK_MANAGER, "fail to rename stream file: [old=%s], [new=%s], [err=%s]", fileName, reName, STR_ERR);
+        return FAIL;
+    }
+
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function find out newest folder with 2 directory depth from given base directory and channelNo
+ * @param   mntPoint
+ * @param   channelNo
+ * @param   newestFolder
+ * @param   recoveryInfo
+ * @param   pErrorCode
+ * @return  SUCCESS/FAIL
+ */
+static BOOL getLatestHourFolder(CHARPTR mntPoint, UINT8 channelNo, CHARPTR newestFolder, RECOVERY_INFO_t *recoveryInfo, UINT32PTR pErrorCode)
+{
+    UINT8           subDir;
+    CHAR            folderName[MAX_FILE_NAME_SIZE];
+    CHAR            channelFolder[MAX_FILE_NAME_SIZE];
+    CHAR            newChannelFolder[MAX_FILE_NAME_SIZE];
+    CHAR            month[10];
+    CHARPTR         tmpPtr = NULL;
+    INT32           channelCnt = 0, date = 0, year = 0, hour = 0;
+    DIR 			*dir;
+    struct dirent 	*entry;
+    struct stat		channelStat;
+    struct stat		newChannelStat;
+
+    SET_ERROR_NUMBER(pErrorCode, INVALID_ERROR_CODE);
+    snprintf(folderName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL, mntPoint, channelNo);
+    snprintf(newChannelFolder, MAX_FILE_NAME_SIZE, "%s", folderName);
+
+    for(subDir = 0; subDir < 2; subDir++)
+    {
+        memset(&newChannelStat, 0, sizeof(newChannelStat));
+        snprintf(channelFolder, MAX_FILE_NAME_SIZE, "%s", newChannelFolder);
+
+        dir = opendir(channelFolder);
+        if(dir == NULL)
+        {
+            SET_ERROR_NUMBER(pErrorCode, errno);
+            EPRINT(DISK_MANAGER, "fail to open dir: [path=%s], [err=%s]", channelFolder, STR_ERR);
+            newestFolder[0] = '\0';
+            return FAIL;
+        }
+
+        while((entry = readdir(dir)) != NULL)
+        {
+            if((strstr(entry->d_name, YEAR_MAP_FILE_EXTN)) || (strstr(entry->d_name, REC_CATALOG_FILE_EXTN)))
+            {
+                continue;
+            }
+
+            // check this file was stream file
+            snprintf(folderName, MAX_FILE_NAME_SIZE, "%s%s/", channelFolder, entry->d_name);
+            if (stat(folderName, &channelStat) != STATUS_OK)
+            {
+                EPRINT(DISK_MANAGER, "fail to stat channel dir: [path=%s], [err=%s]", folderName, STR_ERR);
+                SET_ERROR_NUMBER(pErrorCode, errno);
+                closedir(dir);
+                newestFolder[0] = '\0';
+                return FAIL;
+            }
+
+            if((strcmp(entry->d_name, ".") == 0) || (strcmp(entry->d_name, "..") == 0))
+            {
+                continue;
+            }
+
+            if((channelStat.st_mtime > newChannelStat.st_mtime))
+            {
+                snprintf(newChannelFolder, MAX_FILE_NAME_SIZE, "%s", folderName);
+                memcpy(&newChannelStat, &channelStat, sizeof(newChannelStat));
+            }
+        }
+
+        DPRINT(DISK_MANAGER, "newest folder found: [path=%s]", newChannelFolder);
+        closedir(dir);
+    }
+
+    snprintf(newestFolder, MAX_FILE_NAME_SIZE, "%s", newChannelFolder);
+    tmpPtr = strstr(newChannelFolder, CHANNEL_NAME_REC);
+    if (NULL == tmpPtr)
+    {
+        return FAIL;
+    }
+
+    sscanf(tmpPtr, CHANNEL_NAME_REC"%02d/%d_%03s_%d/%d/",&channelCnt, &date, month, &year,&hour);
+    recoveryInfo->date = date;
+    recoveryInfo->mon = GetMonthNo(month);
+    recoveryInfo->year = year;
+    recoveryInfo->hour = hour;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function recovers last recorded hour folders of given channel on given volume
+ * @param   mntPoint
+ * @param   iDiskId
+ * @param   channelCnt
+ * @param   pGeneralCfg
+ * @return  FAIL if disk is in fault otherwise SUCCESS
+ */
+static BOOL recoverChannelFolders(CHARPTR mntPoint, RECORD_ON_DISK_e iDiskId, UINT8 channelCnt, GENERAL_CONFIG_t *pGeneralCfg)
+{
+    BOOL				strmRecStatus;
+    BOOL				remFolder = FALSE;
     BOOL				latestFolderFlg;
-    UINT8 				channelCnt;
     INT32 				recFileFd = INVALID_FILE_FD;
     UINT32				streamFileNo;
     UINT32				aviFileNo;
@@ -7778,330 +9124,447 @@ BOOL StartRecovery(CHARPTR 	mntPoint, RECORD_ON_DISK_e iDiskId)
     DIR 				*dir;
     struct dirent 		*entry;
     UINT32              tErrorCode = INVALID_ERROR_CODE;
-    GENERAL_CONFIG_t	generalCfg;
     CHAR                ifrmFileName[MAX_FILE_NAME_SIZE];
 
-    ReadGeneralConfig(&generalCfg);
-    MUTEX_LOCK(recoveryMutex);
-    recoveryStatus = START;
-    MUTEX_UNLOCK(recoveryMutex);
+    snprintf(recoveryFldr, MAX_FILE_NAME_SIZE, RECOVERY_FOLDER, mntPoint);
+    latestFolderFlg = FALSE;
 
-    do
+    // check channel file was present
+    snprintf(recvrFileName, MAX_FILE_NAME_SIZE, RECOVERY_CHANNEL_FILE, recoveryFldr, GET_CAMERA_NO(channelCnt));
+    if (access(recvrFileName, F_OK) != STATUS_OK)
     {
-        // check that recovery folder was present in specific partition
-        snprintf(recoveryFldr, MAX_FILE_NAME_SIZE, RECOVERY_FOLDER, mntPoint);
-        if (access(recoveryFldr, F_OK) != STATUS_OK)
+        if (isDiskInFault(errno, iDiskId))
+        {
+            return FAIL;
+        }
+
+        /* Check next channel */
+        return SUCCESS;
+    }
+
+    // Open file for channelCnt
+    recFileFd = open(recvrFileName, READ_WRITE_MODE, FILE_PERMISSION);
+    if (recFileFd == INVALID_FILE_FD)
+    {
+        EPRINT(DISK_MANAGER, "fail to open recovery file: [file=%s], [err=%s]", recvrFileName, STR_ERR);
+        if (isDiskInFault(errno, iDiskId))
+        {
+            return FAIL;
+        }
+
+        /* Check next channel */
+        return SUCCESS;
+    }
+
+    /* Read the data from file. Read last modified date and hour from that file */
+    if (Utils_Read(recFileFd, &recveryInfo, RECOVERY_FIELD_SIZE, &tErrorCode) != RECOVERY_FIELD_SIZE)
+    {
+        EPRINT(DISK_MANAGER, "fail to read recovery file: [file=%s], [err=%s]", recvrFileName, strerror(tErrorCode));
+        latestFolderFlg = TRUE;
+        if (isDiskInFault(tErrorCode, iDiskId))
+        {
+            close(recFileFd);
+            return FAIL;
+        }
+    }
+    else
+    {
+        /* Get recovery date and hour. create folder name from where recovery is to be started */
+        snprintf(folderName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_FOLDER_DATE_HOUR_FORMAT, mntPoint,
+                 GET_CAMERA_NO(channelCnt), recveryInfo.date, GetMonthName(recveryInfo.mon), recveryInfo.year, recveryInfo.hour);
+        if(access(folderName, F_OK) != STATUS_OK)
         {
             if (isDiskInFault(errno, iDiskId))
             {
-                break;
+                close(recFileFd);
+                return FAIL;
             }
-
-            retVal = SUCCESS;
-            break;
+            latestFolderFlg = TRUE;
         }
+    }
 
-        // recovery status check because at shutdown no need to recover file further.
-        for (channelCnt = 0; (channelCnt < getMaxCameraForCurrentVariant() && (recoveryStatus == START)); channelCnt++)
-        {
-            latestFolderFlg = FALSE;
+    // closed recovery file
+    close(recFileFd);
 
-            // check channel file was present
-            snprintf(recvrFileName, MAX_FILE_NAME_SIZE, RECOVERY_CHANNEL_FILE, recoveryFldr, GET_CAMERA_NO(channelCnt));
-            if (access(recvrFileName, F_OK) != STATUS_OK)
+    // check recovery information ok !
+    if(latestFolderFlg == TRUE)
+    {
+        if(getLatestHourFolder(mntPoint, GET_CAMERA_NO(channelCnt), folderName, &recveryInfo, &tErrorCode) == FAIL)
+        {
+            if(isDiskInFault(tErrorCode, iDiskId))
             {
-                if (isDiskInFault(errno, iDiskId))
-                {
-                    break;
-                }
-
-                /* Check next channel */
-                continue;
+                return FAIL;
             }
 
-            // Open file for channelCnt
-            recFileFd = open(recvrFileName, READ_WRITE_MODE, FILE_PERMISSION);
-            if (recFileFd == INVALID_FILE_FD)
-            {
-                EPRINT(DISK_MANAGER, "fail to open recovery file: [file=%s], [err=%s]", recvrFileName, STR_ERR);
-                if (isDiskInFault(errno, iDiskId))
-                {
-                    break;
-                }
+            // no folder was found.
+            DPRINT(DISK_MANAGER, "latest hour folder not found: [camera=%d]", channelCnt);
+            return SUCCESS;
+        }
 
-                /* Check next channel */
-                continue;
-            }
+        DPRINT(DISK_MANAGER, "latest hour folder found: [path=%s]", folderName);
+    }
+
+    folderRecCnt = 0;
+    while(folderRecCnt < 2)
+    {
+        folderRecCnt++;
 
-            /* Read the data from file. Read last modified date and hour from that file */
-            if (Utils_Read(recFileFd, &recveryInfo, RECOVERY_FIELD_SIZE, &tErrorCode) != RECOVERY_FIELD_SIZE)
+        // create folder name from where recovery is to be started
+        snprintf(folderName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_FOLDER_DATE_HOUR_FORMAT, mntPoint,
+                 GET_CAMERA_NO(channelCnt), recveryInfo.date, GetMonthName(recveryInfo.mon), recveryInfo.year, recveryInfo.hour);
+        if(access(folderName, F_OK) == STATUS_OK)
+        {
+            /* if i-frame file is present then recover the stream file using i-frame file */
+            snprintf(ifrmFileName, MAX_FILE_NAME_SIZE, "%s%s", folderName, I_FRAME_FILE_NAME);
+            if(STATUS_OK == access(ifrmFileName, F_OK))
             {
-                EPRINT(DISK_MANAGER, "fail to read recovery file: [file=%s], [err=%s]", recvrFileName, strerror(tErrorCode));
-                latestFolderFlg = TRUE;
-                if (isDiskInFault(tErrorCode, iDiskId))
+                /* recover stream file and i-frame file */
+                if(FALSE == recoverStreamAndIFrameFile(folderName, &tErrorCode))
                 {
-                    close(recFileFd);
-                    break;
+                    EPRINT(DISK_MANAGER, "fail to recover stream file and i-frame file: [path=%s]", folderName);
+                    if (isDiskInFault(tErrorCode, iDiskId))
+                    {
+                        break;
+                    }
+
+                    remFolder = TRUE;
                 }
             }
             else
             {
-                /* Get recovery date and hour. create folder name from where recovery is to be started */
-                snprintf(folderName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_FOLDER_DATE_HOUR_FORMAT, mntPoint,
-                         GET_CAMERA_NO(channelCnt), recveryInfo.date, GetMonthName(recveryInfo.mon), recveryInfo.year, recveryInfo.hour);
-                if(access(folderName, F_OK) != STATUS_OK)
+                /* this case happens when recording is done in avi format then there is no i-frame file only stream file is present */
+                dir = opendir(folderName);
+                if (dir == NULL)
                 {
+                    EPRINT(DISK_MANAGER, "fail to open dir: [path=%s]", folderName);
                     if (isDiskInFault(errno, iDiskId))
                     {
-                        close(recFileFd);
                         break;
                     }
-                    latestFolderFlg = TRUE;
-                }
-            }
-
-            // closed recovery file
-            close(recFileFd);
 
-            // check recovery information ok !
-            if(latestFolderFlg == TRUE)
-            {
-                if(getLatestHourFolder(mntPoint, GET_CAMERA_NO(channelCnt), folderName, &recveryInfo, &tErrorCode) == FAIL)
-                {
-                    if(isDiskInFault(tErrorCode, iDiskId))
+                    // Remove whole directory.
+                    if (FAIL == RemoveDirectory(folderName))
                     {
-                        break;
+                        continue;
                     }
 
-                    // no folder was found.
-                    DPRINT(DISK_MANAGER, "latest hour folder not found: [camera=%d]", channelCnt);
+                    if (FAIL == removeIndexesforGivenHour(mntPoint, channelCnt, recveryInfo, &tErrorCode))
+                    {
+                        if (isDiskInFault(tErrorCode, iDiskId))
+                        {
+                            break;
+                        }
+                    }
                     continue;
                 }
 
-                DPRINT(DISK_MANAGER, "latest hour folder found: [path=%s]", folderName);
-            }
-
-            folderRecCnt = 0;
-            while(folderRecCnt < 2)
-            {
-                folderRecCnt++;
-
-                // create folder name from where recovery is to be started
-                snprintf(folderName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_FOLDER_DATE_HOUR_FORMAT, mntPoint,
-                         GET_CAMERA_NO(channelCnt), recveryInfo.date, GetMonthName(recveryInfo.mon), recveryInfo.year, recveryInfo.hour);
-                if(access(folderName, F_OK) == STATUS_OK)
+                // read every file of current directory
+                while ((entry = readdir(dir)) != NULL)
                 {
-                    /* if i-frame file is present then recover the stream file using i-frame file */
-                    snprintf(ifrmFileName, MAX_FILE_NAME_SIZE, "%s%s", folderName, I_FRAME_FILE_NAME);
-                    if(STATUS_OK == access(ifrmFileName, F_OK))
+                    // check this file was stream file
+                    if (((extension = strstr(entry->d_name, STREAM_EXTN)) != NULL) || ((extension = strstr(entry->d_name, STREAM_EXTN_OVLP)) != NULL))
                     {
-                        /* recover stream file and i-frame file */
-                        if(FALSE == recoverStreamAndIFrameFile(folderName, &tErrorCode))
-                        {
-                            EPRINT(DISK_MANAGER, "fail to recover stream file and i-frame file: [path=%s]", folderName);
-                            if (isDiskInFault(tErrorCode, iDiskId))
-                            {
-                                break;
-                            }
+                        // make file name for stream file
+                        snprintf(strmFileName, MAX_FILE_NAME_SIZE, "%s%s", folderName, entry->d_name);
 
+                        // recover stream file
+                        strmRecStatus = recoverStreamFile(strmFileName, &tErrorCode);
+                        if ((strmRecStatus == FAIL)
+                                || ((strmRecStatus == UNKNOWN) && (recoverStreamFile(strmFileName, &tErrorCode) != SUCCESS)))
+                        {
                             remFolder = TRUE;
+                            break;
                         }
                     }
-                    else
-                    {
-                        /* this case happens when recording is done in avi format then there is no i-frame file only stream file is present */
-                        dir = opendir(folderName);
-                        if (dir == NULL)
-                        {
-                            EPRINT(DISK_MANAGER, "fail to open dir: [path=%s]", folderName);
-                            if (isDiskInFault(errno, iDiskId))
-                            {
-                                break;
-                            }
-
-                            // Remove whole directory.
-                            if (FAIL == RemoveDirectory(folderName))
-                            {
-                                continue;
-                            }
-
-                            if (FAIL == removeIndexesforGivenHour(mntPoint, channelCnt, recveryInfo, &tErrorCode))
-                            {
-                                if (isDiskInFault(tErrorCode, iDiskId))
-                                {
-                                    break;
-                                }
-                            }
-                            continue;
-                        }
+                }
 
-                        // read every file of current directory
-                        while ((entry = readdir(dir)) != NULL)
-                        {
-                            // check this file was stream file
-                            if (((extension = strstr(entry->d_name, STREAM_EXTN)) != NULL) || ((extension = strstr(entry->d_name, STREAM_EXTN_OVLP)) != NULL))
-                            {
-                                // make file name for stream file
-                                snprintf(strmFileName, MAX_FILE_NAME_SIZE, "%s%s", folderName, entry->d_name);
+                // closed current open directory
+                closedir(dir);
 
-                                // recover stream file
-                                strmRecStatus = recoverStreamFile(strmFileName, &tErrorCode);
-                                if ((strmRecStatus == FAIL)
-                                        || ((strmRecStatus == UNKNOWN) && (recoverStreamFile(strmFileName, &tErrorCode) != SUCCESS)))
-                                {
-                                    remFolder = TRUE;
-                                    break;
-                                }
-                            }
-                        }
+                if (isDiskInFault(tErrorCode, iDiskId))
+                {
+                    break;
+                }
+            }
 
-                        // closed current open directory
-                        closedir(dir);
+            getAllStreamFileCount(folderName, &streamFileNo, &aviFileNo);
+            if ((aviFileNo == 0) && (streamFileNo == 0))
+            {
+                EPRINT(DISK_MANAGER, "recovery folder is empty: [path=%s]", folderName);
+                remFolder = TRUE;
+            }
 
-                        if (isDiskInFault(tErrorCode, iDiskId))
+            if (remFolder == TRUE)
+            {
+                // Remove whole directory.
+                remFolder = FALSE;
+                if ((RemoveDirectory(folderName) == SUCCESS) && (pGeneralCfg->recordFormatType != REC_AVI_FORMAT))
+                {
+                    if(FAIL == removeIndexesforGivenHour(mntPoint, channelCnt, recveryInfo, &tErrorCode))
+                    {
+                        if(isDiskInFault(tErrorCode, iDiskId))
                         {
                             break;
                         }
                     }
+                }
+
+                EPRINT(DISK_MANAGER, "remove whole folder due to issue in stream file recovery: [path=%s]", folderName);
+                continue;
+            }
 
-                    getAllStreamFileCount(folderName, &streamFileNo, &aviFileNo);
-                    if ((aviFileNo == 0) && (streamFileNo == 0))
+            if (pGeneralCfg->recordFormatType != REC_AVI_FORMAT)
+            {
+                if (recoverEventFile(folderName, &tErrorCode) == FAIL)
+                {
+                    if(isDiskInFault(tErrorCode, iDiskId))
                     {
-                        EPRINT(DISK_MANAGER, "recovery folder is empty: [path=%s]", folderName);
-                        remFolder = TRUE;
+                        break;
                     }
 
-                    if (remFolder == TRUE)
+                    // Remove whole directory.
+                    if(RemoveDirectory(folderName) == SUCCESS)
                     {
-                        // Remove whole directory.
-                        remFolder = FALSE;
-                        if ((RemoveDirectory(folderName) == SUCCESS) && (generalCfg.recordFormatType != REC_AVI_FORMAT))
+                        if(FAIL == removeIndexesforGivenHour(mntPoint, channelCnt, recveryInfo, &tErrorCode))
                         {
-                            if(FAIL == removeIndexesforGivenHour(mntPoint, channelCnt, recveryInfo, &tErrorCode))
+                            if(isDiskInFault(tErrorCode, iDiskId))
                             {
-                                if(isDiskInFault(tErrorCode, iDiskId))
-                                {
-                                    break;
-                                }
+                                break;
                             }
                         }
+                    }
 
-                        EPRINT(DISK_MANAGER, "remove whole folder due to issue in stream file recovery: [path=%s]", folderName);
-                        continue;
+                    EPRINT(DISK_MANAGER, "remove whole folder due to issue in event file recovery: [path=%s]", folderName);
+                    continue;
+                }
+
+                if(FAIL == recoverMonthDayIndxFiles(mntPoint, folderName, channelCnt,recveryInfo,&tErrorCode))
+                {
+                    if(isDiskInFault(tErrorCode, iDiskId))
+                    {
+                        break;
+                    }
+                }
+                else
+                {
+                    recoverRecCatalog(mntPoint, folderName, channelCnt, &recveryInfo);
+                }
+
+                if(recoverTimeIdxFile(folderName, &tErrorCode) == FAIL)
+                {
+                    if(isDiskInFault(tErrorCode, iDiskId))
+                    {
+                        break;
                     }
 
-                    if (generalCfg.recordFormatType != REC_AVI_FORMAT)
+                    // Remove whole directory.
+                    if(RemoveDirectory(folderName) == SUCCESS)
                     {
-                        if (recoverEventFile(folderName, &tErrorCode) == FAIL)
+                        if(FAIL == removeIndexesforGivenHour(mntPoint, channelCnt, recveryInfo, &tErrorCode))
                         {
                             if(isDiskInFault(tErrorCode, iDiskId))
                             {
                                 break;
                             }
-
-                            // Remove whole directory.
-                            if(RemoveDirectory(folderName) == SUCCESS)
-                            {
-                                if(FAIL == removeIndexesforGivenHour(mntPoint, channelCnt, recveryInfo, &tErrorCode))
-                                {
-                                    if(isDiskInFault(tErrorCode, iDiskId))
-                                    {
-                                        break;
-                                    }
-                                }
-                            }
-
-                            EPRINT(DISK_MANAGER, "remove whole folder due to issue in event file recovery: [path=%s]", folderName);
-                            continue;
                         }
+                    }
+
+                    EPRINT(DISK_MANAGER, "remove whole folder due to issue in time index file recovery: [path=%s]", folderName);
+                    continue;
+                }
 
-                        if(FAIL == recoverMonthDayIndxFiles(mntPoint, folderName, channelCnt,recveryInfo,&tErrorCode))
+                getAllStreamFileCount(folderName, &streamFileNo,&aviFileNo);
+                if((aviFileNo == 0) && (streamFileNo == 0))
+                {
+                    // Remove whole directory.
+                    if(RemoveDirectory(folderName) == SUCCESS)
+                    {
+                        if(FAIL == removeIndexesforGivenHour(mntPoint, channelCnt, recveryInfo, &tErrorCode))
                         {
                             if(isDiskInFault(tErrorCode, iDiskId))
                             {
                                 break;
                             }
                         }
+                    }
 
-                        if(recoverTimeIdxFile(folderName, &tErrorCode) == FAIL)
-                        {
-                            if(isDiskInFault(tErrorCode, iDiskId))
-                            {
-                                break;
-                            }
+                    EPRINT(DISK_MANAGER, "folder removed due to no stream file: [path=%s]", folderName);
+                }
+            }
+        }
+        else
+        {
+            if (isDiskInFault(errno, iDiskId))
+            {
+                break;
+            }
+        }
 
-                            // Remove whole directory.
-                            if(RemoveDirectory(folderName) == SUCCESS)
-                            {
-                                if(FAIL == removeIndexesforGivenHour(mntPoint, channelCnt, recveryInfo, &tErrorCode))
-                                {
-                                    if(isDiskInFault(tErrorCode, iDiskId))
-                                    {
-                                        break;
-                                    }
-                                }
-                            }
+        brokenTime.tm_year = recveryInfo.year;
+        brokenTime.tm_mon = recveryInfo.mon;
+        brokenTime.tm_mday = recveryInfo.date;
+        brokenTime.tm_hour = recveryInfo.hour;
+        brokenTime.tm_min = 0;
+        brokenTime.tm_sec = 0;
+        RESET_EXTRA_BORKEN_TIME_VAR(brokenTime);
+        ConvertLocalTimeInSec(&brokenTime, &localTime);
+        localTime += SEC_IN_ONE_HOUR;
+        ConvertLocalTimeInBrokenTm(&localTime, &brokenTime);
+        recveryInfo.year = brokenTime.tm_year;
+        recveryInfo.mon = brokenTime.tm_mon;
+        recveryInfo.date = brokenTime.tm_mday;
+        recveryInfo.hour = brokenTime.tm_hour;
+    }
 
-                            EPRINT(DISK_MANAGER, "remove whole folder due to issue in time index file recovery: [path=%s]", folderName);
-                            continue;
-                        }
+    if (isDiskInFault(tErrorCode, iDiskId))
+    {
+        return FAIL;
+    }
 
-                        getAllStreamFileCount(folderName, &streamFileNo,&aviFileNo);
-                        if((aviFileNo == 0) && (streamFileNo == 0))
-                        {
-                            // Remove whole directory.
-                            if(RemoveDirectory(folderName) == SUCCESS)
-                            {
-                                if(FAIL == removeIndexesforGivenHour(mntPoint, channelCnt, recveryInfo, &tErrorCode))
-                                {
-                                    if(isDiskInFault(tErrorCode, iDiskId))
-                                    {
-                                        break;
-                                    }
-                                }
-                            }
+    return SUCCESS;
+}
 
-                            EPRINT(DISK_MANAGER, "folder removed due to no stream file: [path=%s]", folderName);
-                        }
-                    }
-                }
-                else
-                {
-                    if (isDiskInFault(errno, iDiskId))
-                    {
-                        break;
-                    }
-                }
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This is worker thread of recovery of volume
+ * @param   threadArg - Recovery work of volume
+ * @return
+ */
+static VOIDPTR recoveryWorkerThread(VOIDPTR threadArg)
+{
+    THREAD_START("RCVRY_WORKER");
+    runRecoveryWork((RECOVERY_WORK_t *)threadArg);
+    pthread_exit(NULL);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function takes next channel of volume and recovers its folders till all channels
+ *          are recovered, disk fault is found or recovery is stopped.
+ * @param   pWork - Recovery work of volume
+ */
+static void runRecoveryWork(RECOVERY_WORK_t *pWork)
+{
+    BOOL                status;
+    BOOL                stopF;
+    UINT8               channelCnt;
+
+    while(TRUE)
+    {
+        // recovery status check because at shutdown no need to recover file further.
+        MUTEX_LOCK(recoveryMutex);
+        stopF = (recoveryStatus == START) ? FALSE : TRUE;
+        MUTEX_UNLOCK(recoveryMutex);
+
+        MUTEX_LOCK(pWork->workMutex);
+        if ((pWork->diskFaultF == TRUE) || (pWork->nextChannel >= getMaxCameraForCurrentVariant()) || (stopF == TRUE))
+        {
+            MUTEX_UNLOCK(pWork->workMutex);
+            break;
+        }
+        channelCnt = pWork->nextChannel++;
+        MUTEX_UNLOCK(pWork->workMutex);
+
+        status = recoverChannelFolders(pWork->mntPoint, pWork->diskId, channelCnt, &pWork->generalCfg);
+
+        MUTEX_LOCK(pWork->workMutex);
+        pWork->doneChannelCnt++;
+        if (status == FAIL)
+        {
+            pWork->diskFaultF = TRUE;
+        }
+        DPRINT(DISK_MANAGER, "recovery progress: [path=%s], [camera=%d], [done=%d/%d], [elapsedMs=%d]", pWork->mntPoint, channelCnt,
+               pWork->doneChannelCnt, getMaxCameraForCurrentVariant(), ElapsedTick(pWork->startTick) * TIMER_RESOLUTION_MINIMUM_MSEC);
+        MUTEX_UNLOCK(pWork->workMutex);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function was read a recovery file from hardisk for each channel and starts recovery
+ *          of corrupted files. This function was read last modified date and hour value and performs
+ *          recovery for that folder only. Channels are recovered in parallel by recovery workers.
+ * @param   mntPoint
+ * @param   iDiskId
+ * @return  SUCCESS/FAIL
+ */
+BOOL StartRecovery(CHARPTR 	mntPoint, RECORD_ON_DISK_e iDiskId)
+{
+    BOOL				retVal = FAIL;
+    UINT8               workerCnt, workerId;
+    CHAR 				recoveryFldr[MAX_FILE_NAME_SIZE];
+    pthread_t           workerThreadId[RECOVERY_WORKER_MAX];
+    BOOL                workerStartF[RECOVERY_WORKER_MAX];
+    RECOVERY_WORK_t     recoveryWork;
+
+    memset(&recoveryWork, 0, sizeof(RECOVERY_WORK_t));
+    ReadGeneralConfig(&recoveryWork.generalCfg);
+    MUTEX_LOCK(recoveryMutex);
+    recoveryStatus = START;
+    recoveryActiveCnt++;
+    MUTEX_UNLOCK(recoveryMutex);
+
+    do
+    {
+        // check that recovery folder was present in specific partition
+        snprintf(recoveryFldr, MAX_FILE_NAME_SIZE, RECOVERY_FOLDER, mntPoint);
+        if (access(recoveryFldr, F_OK) != STATUS_OK)
+        {
+            if (isDiskInFault(errno, iDiskId))
+            {
+                break;
+            }
+
+            retVal = SUCCESS;
+            break;
+        }
+
+        snprintf(recoveryWork.mntPoint, MOUNT_POINT_SIZE, "%s", mntPoint);
+        recoveryWork.diskId = iDiskId;
+        recoveryWork.startTick = GetSysTick();
+        MUTEX_INIT(recoveryWork.workMutex, NULL);
 
-                brokenTime.tm_year = recveryInfo.year;
-                brokenTime.tm_mon = recveryInfo.mon;
-                brokenTime.tm_mday = recveryInfo.date;
-                brokenTime.tm_hour = recveryInfo.hour;
-                brokenTime.tm_min = 0;
-                brokenTime.tm_sec = 0;
-                RESET_EXTRA_BORKEN_TIME_VAR(brokenTime);
-                ConvertLocalTimeInSec(&brokenTime, &localTime);
-                localTime += SEC_IN_ONE_HOUR;
-                ConvertLocalTimeInBrokenTm(&localTime, &brokenTime);
-                recveryInfo.year = brokenTime.tm_year;
-                recveryInfo.mon = brokenTime.tm_mon;
-                recveryInfo.date = brokenTime.tm_mday;
-                recveryInfo.hour = brokenTime.tm_hour;
+        workerCnt = (getMaxCameraForCurrentVariant() < RECOVERY_WORKER_MAX) ? getMaxCameraForCurrentVariant() : RECOVERY_WORKER_MAX;
+        for (workerId = 0; workerId < workerCnt; workerId++)
+        {
+            workerStartF[workerId] = Utils_CreateThread(&workerThreadId[workerId], recoveryWorkerThread, &recoveryWork,
+                                                        JOINABLE_THREAD, RECOVERY_WORKER_THREAD_STACK_SZ);
+            if (workerStartF[workerId] == FAIL)
+            {
+                EPRINT(DISK_MANAGER, "fail to create recovery worker thread: [path=%s], [worker=%d]", mntPoint, workerId);
             }
+        }
+
+        /* Caller also works as recovery worker, so that recovery completes even if no worker could be created */
+        runRecoveryWork(&recoveryWork);
 
-            if (isDiskInFault(tErrorCode, iDiskId))
+        for (workerId = 0; workerId < workerCnt; workerId++)
+        {
+            if (workerStartF[workerId] == SUCCESS)
             {
-                break;
+                pthread_join(workerThreadId[workerId], NULL);
             }
         }
 
+        pthread_mutex_destroy(&recoveryWork.workMutex);
+        DPRINT(DISK_MANAGER, "recording recovery completed: [path=%s], [cameras=%d], [workers=%d], [diskFault=%d], [elapsedMs=%d]",
+               mntPoint, recoveryWork.doneChannelCnt, workerCnt + 1, recoveryWork.diskFaultF,
+               ElapsedTick(recoveryWork.startTick) * TIMER_RESOLUTION_MINIMUM_MSEC);
         retVal = SUCCESS;
     }
     while(0);
 
     DPRINT(DISK_MANAGER, "end recording recovery: [path=%s]", mntPoint);
     MUTEX_LOCK(recoveryMutex);
-    recoveryStatus = STOP;
+    if (recoveryActiveCnt > 0)
+    {
+        recoveryActiveCnt--;
+    }
+
+    if (recoveryActiveCnt == 0)
+    {
+        recoveryStatus = STOP;
+    }
     MUTEX_UNLOCK(recoveryMutex);
     return retVal;
 }
@@ -8653,6 +10116,299 @@ static BOOL checkSearchChnlRecordFolder(UINT8 diskCnt, UINT8 channelNo, CHARPTR
     return SUCCESS;
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function initializes catalog views of event search. Views are loaded on first use.
+ * @param   pSearch
+ * @param   channelNo - Camera number (starts from 1)
+ * @param   startHourSec - Start of first hour of search
+ * @param   stopTimeSec - Search stop time
+ */
+static void initRecCatalogSearch(REC_CATALOG_SEARCH_t *pSearch, UINT8 channelNo, time_t startHourSec, time_t stopTimeSec)
+{
+    memset(pSearch, 0, sizeof(REC_CATALOG_SEARCH_t));
+    pSearch->channelNo = channelNo;
+    pSearch->startHourSec = startHourSec;
+    pSearch->stopTimeSec = stopTimeSec;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function frees catalog views of event search
+ * @param   pSearch
+ */
+static void deInitRecCatalogSearch(REC_CATALOG_SEARCH_t *pSearch)
+{
+    UINT8 recDrive, diskCnt;
+
+    for (recDrive = 0; recDrive < MAX_RECORDING_MODE; recDrive++)
+    {
+        for (diskCnt = 0; diskCnt < MAX_VOLUME; diskCnt++)
+        {
+            FREE_MEMORY(pSearch->view[recDrive][diskCnt].pEntry);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function loads catalog entries of search duration from catalogs of all years of search
+ *          on given volume. Removed entries are skipped and entries are kept in order of hour.
+ * @param   pSearch
+ * @param   recDrive
+ * @param   diskCnt
+ * @param   pView
+ * @return  SUCCESS if events of volume can be taken from view otherwise FAIL
+ */
+static BOOL loadRecCatalogView(REC_CATALOG_SEARCH_t *pSearch, RECORD_ON_DISK_e recDrive, UINT8 diskCnt, REC_CATALOG_VIEW_t *pView)
+{
+    BOOL                sortF = FALSE;
+    CHAR                mountPoint[MOUNT_POINT_SIZE];
+    CHAR                fileName[MAX_FILE_NAME_SIZE];
+    INT32               fileFd;
+    UINT32              year;
+    UINT32              firstIdx, lastIdx, readCnt, entryIdx;
+    struct tm           startTm, stopTm;
+    REC_CATALOG_HDR_t   catalogHdr;
+    REC_CATALOG_ENTRY_t *pNewEntry;
+
+    if (GetMountPointFromDiskId(diskCnt, mountPoint, recDrive) == FAIL)
+    {
+        return FAIL;
+    }
+
+    if ((ConvertLocalTimeInBrokenTm(&pSearch->startHourSec, &startTm) == FAIL) || (ConvertLocalTimeInBrokenTm(&pSearch->stopTimeSec, &stopTm) == FAIL))
+    {
+        return FAIL;
+    }
+
+    for (year = startTm.tm_year; year <= (UINT32)stopTm.tm_year; year++)
+    {
+        snprintf(fileName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_INDEX_FILE_YEAR, mountPoint, pSearch->channelNo, year, REC_CATALOG_FILE_EXTN);
+        fileFd = open(fileName, READ_ONLY_MODE);
+        if (fileFd == INVALID_FILE_FD)
+        {
+            /* Year without year map file has no recording, otherwise recording is present without catalog */
+            snprintf(fileName, MAX_FILE_NAME_SIZE, REC_FOLDER_CHNL REC_INDEX_FILE_YEAR, mountPoint, pSearch->channelNo, year, YEAR_MAP_FILE_EXTN);
+            if (access(fileName, F_OK) == STATUS_OK)
+            {
+                return FAIL;
+            }
+            continue;
+        }
+
+        if ((readRecCatalogHdr(fileFd, &catalogHdr) == FAIL) || (catalogHdr.completeF == FALSE))
+        {
+            close(fileFd);
+            return FAIL;
+        }
+
+        firstIdx = 0;
+        lastIdx = catalogHdr.entryCnt;
+        if (catalogHdr.sortedF == TRUE)
+        {
+            if ((findRecCatalogHour(fileFd, catalogHdr.entryCnt, pSearch->startHourSec, &firstIdx) == FAIL)
+                    || (findRecCatalogHour(fileFd, catalogHdr.entryCnt, pSearch->stopTimeSec, &lastIdx) == FAIL))
+            {
+                close(fileFd);
+                return FAIL;
+            }
+        }
+        else
+        {
+            sortF = TRUE;
+        }
+
+        readCnt = (lastIdx > firstIdx) ? (lastIdx - firstIdx) : 0;
+        if (readCnt == 0)
+        {
+            close(fileFd);
+            continue;
+        }
+
+        /* Search of very long duration is served from hour folders to limit memory */
+        if ((pView->entryCnt + readCnt) > REC_CATALOG_VIEW_ENTRY_MAX)
+        {
+            close(fileFd);
+            return FAIL;
+        }
+
+        pNewEntry = realloc(pView->pEntry, ((pView->entryCnt + readCnt) * REC_CATALOG_ENTRY_SIZE));
+        if (pNewEntry == NULL)
+        {
+            EPRINT(DISK_MANAGER, "memory re-allocation failed: [camera=%d]", pSearch->channelNo - 1);
+            close(fileFd);
+            return FAIL;
+        }
+        pView->pEntry = pNewEntry;
+
+        if (pread(fileFd, &pView->pEntry[pView->entryCnt], (readCnt * REC_CATALOG_ENTRY_SIZE), REC_CATALOG_HDR_SIZE + ((off_t)firstIdx * REC_CATALOG_ENTRY_SIZE))
+                != (ssize_t)(readCnt * REC_CATALOG_ENTRY_SIZE))
+        {
+            EPRINT(DISK_MANAGER, "fail to read recording catalog: [camera=%d], [path=%s], [err=%s]", pSearch->channelNo - 1, fileName, STR_ERR);
+            close(fileFd);
+            return FAIL;
+        }
+        close(fileFd);
+
+        for (entryIdx = 0; entryIdx < readCnt; entryIdx++)
+        {
+            if ((pView->pEntry[pView->entryCnt + entryIdx].removedF == TRUE)
+                    || ((time_t)pView->pEntry[pView->entryCnt + entryIdx].hourSec < pSearch->startHourSec)
+                    || ((time_t)pView->pEntry[pView->entryCnt + entryIdx].hourSec >= pSearch->stopTimeSec))
+            {
+                continue;
+            }
+
+            pView->pEntry[pView->entryCnt] = pView->pEntry[pView->entryCnt + entryIdx];
+            pView->entryCnt++;
+        }
+    }
+
+    if ((sortF == TRUE) && (pView->entryCnt > 1))
+    {
+        qsort(pView->pEntry, pView->entryCnt, REC_CATALOG_ENTRY_SIZE, compareRecCatalogEntry);
+    }
+
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function opens events of given hour on given volume. Events are taken from catalog view
+ *          of volume when it is valid, otherwise from event file of hour folder.
+ * @param   pSearch
+ * @param   diskCnt
+ * @param   recDrive
+ * @param   pHourTm - Hour in broken time
+ * @param   hourSec - Hour in seconds
+ * @param   pReader
+ * @return  SUCCESS if recording of hour is present otherwise FAIL
+ * @note    Hours must be opened in increasing order for a volume
+ */
+static BOOL openHourEventReader(REC_CATALOG_SEARCH_t *pSearch, UINT8 diskCnt, RECORD_ON_DISK_e recDrive,
+                                struct tm *pHourTm, time_t hourSec, HOUR_EVENT_READER_t *pReader)
+{
+    CHAR                searchDir[MAX_FILE_NAME_SIZE];
+    METADATA_FILE_HDR_t eventFileInfo;
+    REC_CATALOG_VIEW_t  *pView;
+
+    pReader->pView = NULL;
+    pReader->hourSec = hourSec;
+    pReader->evntFileFd = INVALID_FILE_FD;
+    pReader->curEventIdx = 0;
+    pReader->eventCnt = 0;
+
+    if ((diskCnt < MAX_VOLUME) && (recDrive < MAX_RECORDING_MODE))
+    {
+        pView = &pSearch->view[recDrive][diskCnt];
+        if (pView->loadedF == FALSE)
+        {
+            pView->loadedF = TRUE;
+            if (loadRecCatalogView(pSearch, recDrive, diskCnt, pView) == SUCCESS)
+            {
+                pView->validF = TRUE;
+            }
+            else
+            {
+                FREE_MEMORY(pView->pEntry);
+                pView->entryCnt = 0;
+            }
+        }
+
+        if (pView->validF == TRUE)
+        {
+            while ((pView->entryPos < pView->entryCnt) && ((time_t)pView->pEntry[pView->entryPos].hourSec < hourSec))
+            {
+                pView->entryPos++;
+            }
+
+            if ((pView->entryPos >= pView->entryCnt) || ((time_t)pView->pEntry[pView->entryPos].hourSec != hourSec))
+            {
+                return FAIL;
+            }
+
+            pReader->pView = pView;
+            return SUCCESS;
+        }
+    }
+
+    if (checkSearchRecordFolder(diskCnt, pSearch->channelNo, pHourTm, searchDir, recDrive) == FAIL)
+    {
+        return FAIL;
+    }
+
+    // Open event file
+    snprintf(pReader->evntFileName, MAX_FILE_NAME_SIZE, "%s%s", searchDir, EVENT_FILE_NAME);
+    pReader->evntFileFd = open(pReader->evntFileName, READ_ONLY_MODE);
+    if (pReader->evntFileFd == INVALID_FILE_FD)
+    {
+        EPRINT(DISK_MANAGER, "fail to open event file: [camera=%d], [path=%s], [err=%s]", pSearch->channelNo - 1, pReader->evntFileName, STR_ERR);
+        return FAIL;
+    }
+
+    // Read event file header. Get next event index number
+    if (read(pReader->evntFileFd, &eventFileInfo, EVENT_FILE_HDR_SIZE) != (INT32)EVENT_FILE_HDR_SIZE)
+    {
+        EPRINT(DISK_MANAGER, "fail to read event file: [camera=%d], [path=%s], [err=%s]", pSearch->channelNo - 1, pReader->evntFileName, STR_ERR);
+        CloseFileFd(&pReader->evntFileFd);
+        return FAIL;
+    }
+
+    pReader->eventCnt = eventFileInfo.nextMetaDataIdx;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function gives next event of hour opened in reader, in order of event index
+ * @param   pReader
+ * @param   pEventInfo
+ * @return  SUCCESS if event is given otherwise FAIL
+ */
+static BOOL readHourEvent(HOUR_EVENT_READER_t *pReader, EVNT_INFO_t *pEventInfo)
+{
+    REC_CATALOG_VIEW_t *pView = pReader->pView;
+
+    if (pView != NULL)
+    {
+        if ((pView->entryPos >= pView->entryCnt) || ((time_t)pView->pEntry[pView->entryPos].hourSec != pReader->hourSec))
+        {
+            return FAIL;
+        }
+
+        *pEventInfo = pView->pEntry[pView->entryPos].evntInfo;
+        pView->entryPos++;
+        return SUCCESS;
+    }
+
+    if (pReader->curEventIdx >= pReader->eventCnt)
+    {
+        return FAIL;
+    }
+
+    // Read event index information from current file position
+    if (read(pReader->evntFileFd, pEventInfo, EVNT_FIELD_SIZE) != EVNT_FIELD_SIZE)
+    {
+        EPRINT(DISK_MANAGER, "fail to read event file: [path=%s], [err=%s]", pReader->evntFileName, STR_ERR);
+        return FAIL;
+    }
+
+    pReader->curEventIdx++;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function closes events of hour opened in reader
+ * @param   pReader
+ */
+static void closeHourEventReader(HOUR_EVENT_READER_t *pReader)
+{
+    CloseFileFd(&pReader->evntFileFd);
+    pReader->pView = NULL;
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   This was search recorded file based on particular event of particular camera number
@@ -8668,21 +10424,17 @@ static BOOL searchCamEvent(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *sea
 {
     BOOL                    diskStatus[MAX_RECORDING_MODE];
     UINT8                   recDriveId;
-    CHAR                    searchDir[MAX_FILE_NAME_SIZE];
-    CHAR                    evntFileName[MAX_FILE_NAME_SIZE];
     UINT16                  eventCnt = 0;
-    INT32                   evntFileFd = INVALID_FILE_FD;
-    INT32                   readCnt;
-    UINT32                  curEventIdx = 0;
     UINT8                   diskCnt, totalDiskCnt;
     time_t                  startTimeSec = 0;
     time_t                  stopTimeSec = 0;
     time_t                  timeSec = 0;
     struct tm               evntStartTime;
-    METADATA_FILE_HDR_t		eventFileInfo;
     EVNT_INFO_t 			eventInfo;
     RECORD_ON_DISK_e        recDriveIndx;
     SEARCH_CRITERIA_t       searchForChannelDate = *pSeachCriteria;
+    REC_CATALOG_SEARCH_t    catalogSearch;
+    HOUR_EVENT_READER_t     hourEventReader;
 
     // convert event search criteria start time into time second because of comparing exact start time of event
     ConvertLocalTimeInSec(&pSeachCriteria->startTime, &startTimeSec);
@@ -8706,6 +10458,8 @@ static BOOL searchCamEvent(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *sea
         return SUCCESS;
     }
 
+    // Events are taken from recording catalog of volume and hour folders are walked only when catalog is not usable
+    initRecCatalogSearch(&catalogSearch, pSeachCriteria->channelNo, timeSec, stopTimeSec);
     while(stopTimeSec > timeSec)
     {
         for(recDriveId = 0; recDriveId < MAX_RECORDING_MODE; recDriveId++)
@@ -8735,41 +10489,13 @@ static BOOL searchCamEvent(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *sea
             /* PARASOFT : No need to validate tainted data */
             for(diskCnt = 0; diskCnt < totalDiskCnt; diskCnt++)
             {
-                if(checkSearchRecordFolder(diskCnt, pSeachCriteria->channelNo, &evntStartTime, searchDir, recDriveIndx) == FAIL)
-                {
-                    continue;
-                }
-
-                // Open event file
-                snprintf(evntFileName, MAX_FILE_NAME_SIZE, "%s%s", searchDir, EVENT_FILE_NAME);
-                evntFileFd = open(evntFileName, READ_WRITE_MODE, FILE_PERMISSION);
-                if(evntFileFd == INVALID_FILE_FD)
-                {
-                    EPRINT(DISK_MANAGER, "fail to open event file: [camera=%d], [path=%s], [err=%s]", pSeachCriteria->channelNo-1, evntFileName, STR_ERR);
-                    continue;
-                }
-
-                // Read event file header. Get next event index number
-                readCnt = read(evntFileFd, &eventFileInfo, EVENT_FILE_HDR_SIZE);
-                if(readCnt != (INT32)EVENT_FILE_HDR_SIZE)
+                if(openHourEventReader(&catalogSearch, diskCnt, recDriveIndx, &evntStartTime, timeSec, &hourEventReader) == FAIL)
                 {
-                    EPRINT(DISK_MANAGER, "fail to read event file: [camera=%d], [path=%s], [err=%s]", pSeachCriteria->channelNo-1, evntFileName, STR_ERR);
-                    close(evntFileFd);
                     continue;
                 }
 
-                // loop till end of file not received. here we check curEventPos +2 is greater than or equal to file
-                // size because of end of file indicator takes 2 byte value
-                curEventIdx  = 0;
-                while(curEventIdx < eventFileInfo.nextMetaDataIdx)
+                while(readHourEvent(&hourEventReader, &eventInfo) == SUCCESS)
                 {
-                    // Read event index information from current file position
-                    if (read(evntFileFd, &eventInfo, EVNT_FIELD_SIZE) != EVNT_FIELD_SIZE)
-                    {
-                        EPRINT(DISK_MANAGER, "fail to read event file: [camera=%d], [path=%s], [err=%s]", pSeachCriteria->channelNo-1, evntFileName, STR_ERR);
-                        break;
-                    }
-
                     // Event end time 0 means that record was currently running
                     if(eventInfo.endTime == 0)
                     {
@@ -8787,24 +10513,23 @@ static BOOL searchCamEvent(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *sea
                         if(eventCnt > pSeachCriteria->noOfRecord)
                         {
                             *moreData = TRUE;
-                            close(evntFileFd);
+                            closeHourEventReader(&hourEventReader);
+                            deInitRecCatalogSearch(&catalogSearch);
                             return SUCCESS;
                         }
 
                         // this event falls into search criteria, so we need to give it as output parameter
                         if (genSrchResult(&eventInfo, pSeachCriteria->channelNo, diskCnt, searchData, srchDataLen, recDriveIndx) == FAIL)
                         {
-                            close(evntFileFd);
-                            EPRINT(DISK_MANAGER, "search result not generated: [camera=%d], [path=%s]", pSeachCriteria->channelNo-1, evntFileName);
+                            closeHourEventReader(&hourEventReader);
+                            deInitRecCatalogSearch(&catalogSearch);
+                            EPRINT(DISK_MANAGER, "search result not generated: [camera=%d]", pSeachCriteria->channelNo-1);
                             return FAIL;
                         }
                     }
-
-                    //set current event position
-                    curEventIdx++;
                 }
 
-                close(evntFileFd);
+                closeHourEventReader(&hourEventReader);
             }
 
             if(pSeachCriteria->searchRecStorageType != ALL_DRIVE)
@@ -8823,10 +10548,12 @@ static BOOL searchCamEvent(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *sea
                 && (CheckSocketFdState(searchThreadInfo->clientSocket) == FALSE))
         {
             *srchDataLen = 0;
+            deInitRecCatalogSearch(&catalogSearch);
             return REFUSE;
         }
     }
 
+    deInitRecCatalogSearch(&catalogSearch);
     return SUCCESS;
 }
 
@@ -8940,23 +10667,19 @@ static BOOL searchCamAllEvent(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *
     BOOL                    diskStatus[MAX_RECORDING_MODE];
     UINT8                   index, recDriveId;
     UINT8                   serchEvntNo;
-    CHAR                    searchDir[MAX_FILE_NAME_SIZE];
-    CHAR                    evntFileName[MAX_FILE_NAME_SIZE];
     UINT16                  eventCnt = 0;
-    INT32                   evntFileFd = INVALID_FILE_FD;
-    INT32                   readCnt;
-    UINT32                  curEventIdx = 0;
     RECORD_ON_DISK_e        recDriveIndx;
     time_t                  startTimeSec = 0;
     time_t                  stopTimeSec = 0;
     time_t                  timeSec = 0;
     UINT32                  diskCnt, totalDiskCnt;
     struct tm               evntStartTime;
-    METADATA_FILE_HDR_t		eventFileInfo;
     EVNT_INFO_t 			eventInfo;
     EVNT_INFO_t				*tempSearchData;
     EVNT_INFO_t				*freeSearchData;
     SEARCH_CRITERIA_t 		searchForChannelDate = *pSeachCriteria;
+    REC_CATALOG_SEARCH_t    catalogSearch;
+    HOUR_EVENT_READER_t     hourEventReader;
 
     // convert event search criteria start time into time second because of comparing exact start time of event
     ConvertLocalTimeInSec(&pSeachCriteria->startTime, &startTimeSec);
@@ -8980,6 +10703,8 @@ static BOOL searchCamAllEvent(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *
         return SUCCESS;
     }
 
+    // Events are taken from recording catalog of volume and hour folders are walked only when catalog is not usable
+    initRecCatalogSearch(&catalogSearch, pSeachCriteria->channelNo, timeSec, stopTimeSec);
     while(stopTimeSec > timeSec)
     {
         for(recDriveId = 0; recDriveId < MAX_RECORDING_MODE; recDriveId++)
@@ -9017,52 +10742,25 @@ static BOOL searchCamAllEvent(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *
             totalDiskCnt = GetTotalMediaNo(recDriveIndx);
             for(diskCnt = 0; diskCnt < totalDiskCnt; diskCnt++)
             {
-                if(checkSearchRecordFolder(diskCnt, pSeachCriteria->channelNo, &evntStartTime, searchDir, recDriveIndx) == FAIL)
+                if(openHourEventReader(&catalogSearch, diskCnt, recDriveIndx, &evntStartTime, timeSec, &hourEventReader) == FAIL)
                 {
                     continue;
                 }
 
-                // Open event file
-                snprintf(evntFileName, MAX_FILE_NAME_SIZE, "%s%s", searchDir, EVENT_FILE_NAME);
-                evntFileFd = open(evntFileName, READ_WRITE_MODE, FILE_PERMISSION);
-                if(evntFileFd == INVALID_FILE_FD)
-                {
-                    EPRINT(DISK_MANAGER, "fail to open event file: [camera=%d], [path=%s], [err=%s]", pSeachCriteria->channelNo-1, evntFileName, STR_ERR);
-                    continue;
-                }
-
-                // Read event file header. Get next event index number
-                readCnt = read(evntFileFd, &eventFileInfo, EVENT_FILE_HDR_SIZE);
-                if(readCnt != (INT32)EVENT_FILE_HDR_SIZE)
-                {
-                    EPRINT(DISK_MANAGER, "fail to read event file: [camera=%d], [path=%s], [err=%s]", pSeachCriteria->channelNo-1, evntFileName, STR_ERR);
-                    close(evntFileFd);
-                    continue;
-                }
-
                 tempSearchData = (EVNT_INFO_t *)malloc( sizeof(EVNT_INFO_t));
                 if(tempSearchData == NULL)
                 {
-                    close(evntFileFd);
+                    closeHourEventReader(&hourEventReader);
+                    deInitRecCatalogSearch(&catalogSearch);
                     EPRINT(DISK_MANAGER, "memory allocation failed: [camera=%d]", pSeachCriteria->channelNo-1);
                     return FAIL;
                 }
 
                 index = 0;
-                curEventIdx  = 0;
                 memset(tempSearchData, 0, sizeof(EVNT_INFO_t));
 
-                // loop till end of file not received. here we check curEventPos +2 is greater than or equal to file
-                // size because of end of file indicator takes 2 byte value
-                while(curEventIdx < eventFileInfo.nextMetaDataIdx)
+                while(readHourEvent(&hourEventReader, &eventInfo) == SUCCESS)
                 {
-                    // Read event index information from current file position
-                    if(read(evntFileFd, &eventInfo, EVNT_FIELD_SIZE) != EVNT_FIELD_SIZE)
-                    {
-                        EPRINT(DISK_MANAGER, "fail to read event file: [camera=%d], [path=%s], [err=%s]", pSeachCriteria->channelNo-1, evntFileName, STR_ERR);
-                        break;
-                    }
-
                     // Event end time 0 means that record was currently running
                     if(eventInfo.endTime == 0)
                     {
@@ -9098,13 +10796,10 @@ static BOOL searchCamAllEvent(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *
                             break;
                         }
                     }
-
-                    //set current event position
-                    curEventIdx++;
                 }
 
                 /* Close file */
-                close(evntFileFd);
+                closeHourEventReader(&hourEventReader);
 
                 for(serchEvntNo = 0; serchEvntNo <= index; serchEvntNo++)
                 {
@@ -9127,6 +10822,7 @@ static BOOL searchCamAllEvent(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *
                     {
                         *moreData = TRUE;
                         free(tempSearchData);
+                        deInitRecCatalogSearch(&catalogSearch);
                         return SUCCESS;
                     }
 
@@ -9134,6 +10830,7 @@ static BOOL searchCamAllEvent(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *
                     if(genSrchResult(&tempSearchData[serchEvntNo], pSeachCriteria->channelNo, diskCnt, searchData, srchDataLen, recDriveIndx) == FAIL)
                     {
                         free(tempSearchData);
+                        deInitRecCatalogSearch(&catalogSearch);
                         EPRINT(DISK_MANAGER, "search result not generated: [camera=%d]", pSeachCriteria->channelNo-1);
                         return FAIL;
                     }
@@ -9158,10 +10855,12 @@ static BOOL searchCamAllEvent(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *
                 && (CheckSocketFdState(searchThreadInfo->clientSocket) == FALSE))
         {
             *srchDataLen = 0;
+            deInitRecCatalogSearch(&catalogSearch);
             return REFUSE;
         }
     }
 
+    deInitRecCatalogSearch(&catalogSearch);
     return SUCCESS;
 }
 
@@ -9181,22 +10880,18 @@ BOOL SearchCamAllEventForSync(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *
     BOOL                    diskStatus[MAX_RECORDING_MODE];
     UINT32                  index, recDriveId;
     UINT32                  serchEvntNo;
-    CHAR                    searchDir[MAX_FILE_NAME_SIZE];
-    CHAR                    evntFileName[MAX_FILE_NAME_SIZE];
     UINT16                  eventCnt = 0;
-    INT32                   evntFileFd = INVALID_FILE_FD;
-    INT32                   readCnt;
-    UINT32                  curEventIdx = 0;
     time_t                  startTimeSec = 0;
     time_t                  stopTimeSec = 0;
     time_t                  timeSec = 0;
     UINT32                  diskCnt, totalDiskCnt;
     struct tm               evntStartTime;
     RECORD_ON_DISK_e 		recDriveIndx;
-    METADATA_FILE_HDR_t		eventFileInfo;
     EVNT_INFO_t 			eventInfo;
     EVNT_INFO_t				*tempSearchData;
     EVNT_INFO_t				*freeSearchData;
+    REC_CATALOG_SEARCH_t    catalogSearch;
+    HOUR_EVENT_READER_t     hourEventReader;
 
     if ((pSeachCriteria == NULL) || (searchData == NULL) || (srchDataLen == NULL) || (moreData == NULL))
     {
@@ -9224,6 +10919,9 @@ BOOL SearchCamAllEventForSync(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *
         }
     }
 
+    // Events are taken from recording catalog of volume and hour folders are walked only when catalog is not usable
+    initRecCatalogSearch(&catalogSearch, pSeachCriteria->channelNo, timeSec, stopTimeSec);
+
     // Compare two string till result not get equal to or less than 0
     while(stopTimeSec > timeSec)
     {
@@ -9245,52 +10943,25 @@ BOOL SearchCamAllEventForSync(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *
             totalDiskCnt = GetTotalMediaNo(recDriveIndx);
             for(diskCnt = 0; diskCnt < totalDiskCnt; diskCnt++)
             {
-                if(checkSearchRecordFolder(diskCnt, pSeachCriteria->channelNo, &evntStartTime, searchDir, recDriveIndx) == FAIL)
-                {
-                    continue;
-                }
-
-                // Open event file
-                snprintf(evntFileName, MAX_FILE_NAME_SIZE, "%s%s", searchDir, EVENT_FILE_NAME);
-                evntFileFd = open(evntFileName, READ_WRITE_MODE, FILE_PERMISSION);
-                if(evntFileFd == INVALID_FILE_FD)
+                if(openHourEventReader(&catalogSearch, diskCnt, recDriveIndx, &evntStartTime, timeSec, &hourEventReader) == FAIL)
                 {
-                    EPRINT(DISK_MANAGER, "fail to open event file: [camera=%d], [path=%s], [err=%s]", pSeachCriteria->channelNo-1, evntFileName, STR_ERR);
-                    continue;
-                }
-
-                // Read event file header. Get next event index number
-                readCnt = read(evntFileFd, &eventFileInfo, EVENT_FILE_HDR_SIZE);
-                if(readCnt != (INT32)EVENT_FILE_HDR_SIZE)
-                {
-                    EPRINT(DISK_MANAGER, "fail to read event file: [camera=%d], [path=%s], [err=%s]", pSeachCriteria->channelNo-1, evntFileName, STR_ERR);
-                    close(evntFileFd);
                     continue;
                 }
 
                 tempSearchData = (EVNT_INFO_t *)malloc( sizeof(EVNT_INFO_t));
                 if(tempSearchData == NULL)
                 {
-                    close(evntFileFd);
+                    closeHourEventReader(&hourEventReader);
+                    deInitRecCatalogSearch(&catalogSearch);
                     EPRINT(DISK_MANAGER, "memory allocation failed: [camera=%d]", pSeachCriteria->channelNo-1);
                     return FAIL;
                 }
 
                 index = 0;
-                curEventIdx  = 0;
                 memset(tempSearchData, 0, sizeof(EVNT_INFO_t));
 
-                // loop till end of file not received. here we check curEventPos +2 is greater than or equal to file
-                // size because of end of file indicator takes 2 byte value
-                while(curEventIdx < eventFileInfo.nextMetaDataIdx)
+                while(readHourEvent(&hourEventReader, &eventInfo) == SUCCESS)
                 {
-                    // Read event index information from current file position
-                    if(read(evntFileFd, &eventInfo, EVNT_FIELD_SIZE) != EVNT_FIELD_SIZE)
-                    {
-                        EPRINT(DISK_MANAGER, "fail to read event file: [camera=%d], [path=%s], [err=%s]", pSeachCriteria->channelNo-1, evntFileName, STR_ERR);
-                        break;
-                    }
-
                     // Event end time 0 means that record was currently running
                     if(eventInfo.endTime == 0)
                     {
@@ -9332,13 +11003,10 @@ BOOL SearchCamAllEventForSync(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *
                             break;
                         }
                     }
-
-                    //set current event position
-                    curEventIdx++;
                 }
 
                 /* Close file */
-                close(evntFileFd);
+                closeHourEventReader(&hourEventReader);
 
                 for(serchEvntNo = 0; serchEvntNo <= index; serchEvntNo++)
                 {
@@ -9361,6 +11029,7 @@ BOOL SearchCamAllEventForSync(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *
                     {
                         *moreData = TRUE;
                         free(tempSearchData);
+                        deInitRecCatalogSearch(&catalogSearch);
                         return SUCCESS;
                     }
 
@@ -9368,6 +11037,7 @@ BOOL SearchCamAllEventForSync(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *
                     if(genSrchResult(&tempSearchData[serchEvntNo], pSeachCriteria->channelNo, diskCnt, searchData, srchDataLen, recDriveIndx) == FAIL)
                     {
                         free(tempSearchData);
+                        deInitRecCatalogSearch(&catalogSearch);
                         EPRINT(DISK_MANAGER, "search result not generated: [camera=%d]", pSeachCriteria->channelNo-1);
                         return FAIL;
                     }
@@ -9389,6 +11059,7 @@ BOOL SearchCamAllEventForSync(SEARCH_CRITERIA_t *pSeachCriteria, SEARCH_DATA_t *
         ConvertLocalTimeInBrokenTm(&timeSec, &evntStartTime);
     }
 
+    deInitRecCatalogSearch(&catalogSearch);
     return SUCCESS;
 }
 
@@ -9475,6 +11146,7 @@ static void deInitPlaySession(void)
             playSession[sessionIdx].playStatus = OFF;
             CloseFileFd(&playSession[sessionIdx].playInfo.streamFileFd);
             CloseFileFd(&playSession[sessionIdx].playInfo.iFrmFileFd);
+            freePlaybackReadAhead(&playSession[sessionIdx]);
         }
     }
 }
@@ -9487,7 +11159,7 @@ static void deInitPlaySession(void)
 BOOL GetRecoveryStatus(void)
 {
     MUTEX_LOCK(recoveryMutex);
-    BOOL status = recoveryStatus;
+    BOOL status = (recoveryActiveCnt > 0) ? START : STOP;
     MUTEX_UNLOCK(recoveryMutex);
     return status;
 }
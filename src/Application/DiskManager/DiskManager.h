@@ -267,6 +267,8 @@ BOOL DeInitDiskManager(void);
 //-------------------------------------------------------------------------------------------------
 BOOL BuildRecIndexFromPrevStoredData(CHARPTR mntPoint);
 //-------------------------------------------------------------------------------------------------
+BOOL BuildRecCatalog(CHARPTR mntPoint);
+//-------------------------------------------------------------------------------------------------
 BOOL GenerateLocalRecDatabase(RECORD_ON_DISK_e recDriveIndx, UINT8 camIndex);
 //-------------------------------------------------------------------------------------------------
 BOOL StartRecordSession(UINT8 channelNo);
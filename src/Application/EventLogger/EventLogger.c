@@ -3,11 +3,18 @@
 //#################################################################################################
 /**
 @file		EventLogger.c
-@brief      This module provides event log and event search APIs.
+@brief      This module provides event log and event search APIs. Event log is ring of records in
+            memory mapped file. File starts with two copies of header which are updated alternately
+            with checksum, hence valid header is always available after power failure. Dirty pages are
+            synced in batch. In memory index of event time and type is maintained to search events
+            without accessing the records.
 */
 //#################################################################################################
 // @INCLUDES
 //#################################################################################################
+/* OS Includes */
+#include <sys/mman.h>
+
 /* Application Includes */
 #include "EventLogger.h"
 #include "DateTime.h"
@@ -15,14 +22,35 @@
 #include "Utils.h"
 #include "Config.h"
 #include "NetworkManager.h"
+#include "SysTimer.h"
 
 //#################################################################################################
 // @DEFINES
 //#################################################################################################
 #define MAX_EVENT_LOG			(10000)
-#define EVENT_LOG_VERSION		(2)
+#define EVENT_LOG_VERSION		(3)
 #define EVENT_LOG_FILE			EVENT_DIR_PATH "/eventLog.log"
-#define EVENT_CNT_FILE			EVENT_DIR_PATH "/eventCnt.log"
+#define EVENT_CNT_FILE			EVENT_DIR_PATH "/eventCnt.log"	// Used by older version only, it is migrated on init
+
+/* Event log file version which had separate event count file */
+#define EVENT_LOG_LEGACY_VERSION	(2)
+
+#define EVENT_LOG_MAGIC				(0x4D58454CU)
+#define EVENT_LOG_HDR_COPY_MAX		(2)
+#define EVENT_LOG_HDR_SIZE			(4096)
+#define EVENT_LOG_FILE_SIZE			(EVENT_LOG_HDR_SIZE + (MAX_EVENT_LOG * sizeof(FILE_EVENT_LOG_t)))
+
+/* Dirty pages are synced after these many events or after interval, whichever is earlier. Interval is
+ * checked by timer which runs only while unsynced events are present */
+#define EVENT_LOG_SYNC_BATCH		(32)
+#define EVENT_LOG_SYNC_INTERVAL_SEC	(5)
+
+/* Index entries walked under write lock in one go during search */
+#define EVENT_SEARCH_BATCH			(64)
+
+/* Event sequence number starts from 1 and it is never reset. Zero indicates no event */
+#define EVENT_SEQ_NONE				(0)
+#define EVENT_SEQ_TO_INDEX(seq)		((UINT32)(((seq) - 1) % MAX_EVENT_LOG))
 
 //#################################################################################################
 // @DATA TYPES
@@ -30,11 +58,7 @@
 typedef struct
 {
 	BOOL 				request;
-	BOOL 				eventTypeMatch;
-	BOOL 				startTimeMatch;
-	BOOL 				endTimeMatch;
-	UINT16 				readIndex;
-	UINT16 				count;
+	UINT64				nextSeq;		// Sequence of next event to be checked, search goes from newest to oldest
 	LOG_EVENT_TYPE_e 	eventType;
 	time_t 				startTimeSec;
 	time_t 				endTimeSec;
@@ -59,6 +83,25 @@ typedef struct
 	UINT32 				writeIndex : 16;
 }EVENT_CNT_t;
 
+typedef struct
+{
+	UINT32				magic;
+	UINT32				version;
+	UINT32				recordSize;
+	UINT32				maxRecord;
+	UINT64				updateCnt;		// Incremented on every header update, latest valid copy is used
+	UINT64				writeSeq;		// Sequence of last written event
+	UINT32				checksum;
+	UINT32				reserved;
+}EVENT_LOG_HDR_t;
+
+typedef struct
+{
+	time_t				timeSec;
+	UINT64				prevTypeSeq;	// Sequence of previous event of same type
+	UINT8				type;
+}EVENT_INDEX_t;
+
 typedef struct
 {
 	UINT32 				fileWrite;
@@ -73,12 +116,40 @@ static BOOL getEvtSearchSessState(UINT8 sessionIndex);
 //-------------------------------------------------------------------------------------------------
 static void checkEventWriteStatus(LOG_EVENT_TYPE_e eventType, LOG_EVENT_SUBTYPE_e eventSubtype, UINT8PTR fileWr, UINT8PTR nwWr);
 //-------------------------------------------------------------------------------------------------
-static void printEventInfo(EVENT_CNT_t *eventCnt, EVENT_LOG_t *evPtr, BOOL isLiveEvt, BOOL isFileWrite);
+static void printEventInfo(UINT64 eventSeq, EVENT_LOG_t *evPtr, BOOL isLiveEvt, BOOL isFileWrite);
+//-------------------------------------------------------------------------------------------------
+static BOOL openEventLogFile(void);
+//-------------------------------------------------------------------------------------------------
+static void migrateLegacyEventLog(const EVENT_CNT_t *pLegacyCnt, off_t legacySize);
+//-------------------------------------------------------------------------------------------------
+static BOOL loadEventLogHdr(void);
+//-------------------------------------------------------------------------------------------------
+static void updateEventLogHdr(void);
+//-------------------------------------------------------------------------------------------------
+static UINT32 getEventLogHdrChecksum(const EVENT_LOG_HDR_t *pHdr);
+//-------------------------------------------------------------------------------------------------
+static void buildEventIndex(void);
+//-------------------------------------------------------------------------------------------------
+static void syncEventLog(BOOL forceSyncF);
+//-------------------------------------------------------------------------------------------------
+static UINT64 getOldestEventSeq(void);
+//-------------------------------------------------------------------------------------------------
+static void eventSyncTimerCb(UINT32 data);
 //-------------------------------------------------------------------------------------------------
 //#################################################################################################
 // @STATIC VARIABLES
 //#################################################################################################
-static EVENT_CNT_t			eventCnt;
+static INT32				eventLogFd = INVALID_FILE_FD;
+static UINT8PTR				eventLogBaseAddr = NULL;
+static EVENT_LOG_HDR_t		*eventLogHdr;					// Header copies at start of file
+static FILE_EVENT_LOG_t		*eventLogRecord;				// Event records after header
+static UINT64				eventLogUpdateCnt;
+static UINT64				eventWriteSeq;
+static UINT32				unsyncedEventCnt;
+static UINT64				lastEventSyncTime;
+static TIMER_HANDLE			eventSyncTmrHandle = INVALID_TIMER_HANDLE;
+static EVENT_INDEX_t		eventIndex[MAX_EVENT_LOG];
+static UINT64				lastEventTypeSeq[LOG_MAX_EVENT_TYPE];
 static SEARCH_SESSION_t 	searchSession[MAX_NW_CLIENT];
 static pthread_mutex_t 		sessionListMutex;
 static pthread_mutex_t 		eventWriteMutex;
@@ -255,83 +326,27 @@ static const EVENT_LOG_STATE_t eventLogStatus[LOG_MAX_EVENT_TYPE] =
  */
 void InitEventLogger(void)
 {
-    FILE    *pFileFp;
     UINT8   sessionIndex;
 
-	eventCnt.version = EVENT_LOG_VERSION;
-	eventCnt.rolloverFlag = CLEAR;
-	eventCnt.writeIndex = 0;
+    MUTEX_INIT(sessionListMutex, NULL);
+    MUTEX_INIT(eventWriteMutex, NULL);
 
     if(access(EVENT_DIR_PATH, F_OK) != STATUS_OK)
 	{
         mkdir(EVENT_DIR_PATH, USR_RWE_GRP_RE_OTH_RE);
     }
 
-	if(access(EVENT_CNT_FILE, F_OK) != STATUS_OK)
-	{
-        EPRINT(EVENT_LOGGER, "event file not present");
-        pFileFp = fopen(EVENT_CNT_FILE, "w");
-        if(pFileFp != NULL)
-		{
-            if(fwrite(&eventCnt, sizeof(EVENT_CNT_t), 1, pFileFp) != 1)
-			{
-                EPRINT(EVENT_LOGGER, "fail to write event file: [err=%s]", STR_ERR);
-			}
-            fclose(pFileFp);
-			unlink(EVENT_LOG_FILE);
-		}
-		else
-		{
-            EPRINT(EVENT_LOGGER, "fail to open event file: [err=%s]", STR_ERR);
-		}
-	}
-	else
-	{
-        /* Open file for reading */
-        pFileFp = fopen(EVENT_CNT_FILE, "r");
-        if(pFileFp != NULL)
-		{
-            if(fread(&eventCnt, (sizeof(EVENT_CNT_t)), 1, pFileFp) != 1)
-			{
-                EPRINT(EVENT_LOGGER, "fail to read event file: [err=%s]", STR_ERR);
-			}
-
-            /* Close current file */
-            fclose(pFileFp);
-
-            /* Check file version and if it mismatched then create new one */
-			if(eventCnt.version != EVENT_LOG_VERSION)
-			{
-                /* Create empty fresh file */
-                pFileFp = fopen(EVENT_CNT_FILE, "w");
-                if(pFileFp != NULL)
-                {
-                    eventCnt.version = EVENT_LOG_VERSION;
-                    eventCnt.rolloverFlag = CLEAR;
-                    eventCnt.writeIndex = 0;
-
-                    if(fwrite(&eventCnt, (sizeof(EVENT_CNT_t)), 1, pFileFp) != 1)
-                    {
-                        EPRINT(EVENT_LOGGER, "fail to write event file: [err=%s]", STR_ERR);
-                    }
-
-                    /* Close the file and remove older log file */
-                    fclose(pFileFp);
-                    unlink(EVENT_LOG_FILE);
-                }
-			}
-
-            DPRINT(EVENT_LOGGER, "event file info: [version=%d], [rollover=%d], [writeIndex=%d]",
-                   eventCnt.version, eventCnt.rolloverFlag, eventCnt.writeIndex);
-		}
-		else
-		{
-            EPRINT(EVENT_LOGGER, "fail to read event file: [err=%s]", STR_ERR);
-		}
-	}
-
-    MUTEX_INIT(sessionListMutex, NULL);
-    MUTEX_INIT(eventWriteMutex, NULL);
+    /* Map event log file and build index of available events */
+    if (FAIL == openEventLogFile())
+    {
+        EPRINT(EVENT_LOGGER, "fail to open event log, events will not be stored");
+    }
+    else
+    {
+        buildEventIndex();
+        DPRINT(EVENT_LOGGER, "event file info: [version=%d], [writeSeq=%llu], [writeIndex=%d]",
+               EVENT_LOG_VERSION, eventWriteSeq, (eventWriteSeq == EVENT_SEQ_NONE) ? 0 : (EVENT_SEQ_TO_INDEX(eventWriteSeq) + 1));
+    }
 
 	for(sessionIndex = 0; sessionIndex < MAX_NW_CLIENT; sessionIndex++)
 	{
@@ -339,15 +354,23 @@ void InitEventLogger(void)
 		searchSession[sessionIndex].eventType = LOG_ANY_EVENT;
 		searchSession[sessionIndex].startTimeSec = 0;
 		searchSession[sessionIndex].endTimeSec = 0;
-		searchSession[sessionIndex].eventTypeMatch = CLEAR;
-		searchSession[sessionIndex].startTimeMatch = CLEAR;
-		searchSession[sessionIndex].endTimeMatch = CLEAR;
-		searchSession[sessionIndex].readIndex = 0;
-		searchSession[sessionIndex].count = 0;
+		searchSession[sessionIndex].nextSeq = EVENT_SEQ_NONE;
         MUTEX_INIT(searchSession[sessionIndex].sessionMutex, NULL);
 	}
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This API syncs pending events to storage. Event log remains mapped, hence events which
+ *          are generated by other modules till shutdown are still stored.
+ */
+void DeInitEventLogger(void)
+{
+    MUTEX_LOCK(eventWriteMutex);
+    syncEventLog(TRUE);
+    MUTEX_UNLOCK(eventWriteMutex);
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   This API write the Event to file.
@@ -361,11 +384,18 @@ void InitEventLogger(void)
 BOOL WriteEvent(LOG_EVENT_TYPE_e eventType, LOG_EVENT_SUBTYPE_e eventSubtype, const CHAR *detail, const CHAR *advncDetail, LOG_EVENT_STATE_e eventState)
 {
     UINT8				fileWrite, isLiveEvtOnNw;
-    UINT8               sessionIndex;
-	FILE				*fdCnt, *fdEvt;
-    EVENT_CNT_t			tempEvtCnt = { 0 };
+    UINT32              recordIndex;
+    UINT64              eventSeq = EVENT_SEQ_NONE;
     EVENT_LOG_t 		eventLog = { 0 };
 	FILE_EVENT_LOG_t 	writeEventLog = { 0 };
+    TIMER_INFO_t        timerInfo;
+
+    /* Event type is used as index of type chain and write status */
+    if (eventType >= LOG_MAX_EVENT_TYPE)
+    {
+        EPRINT(EVENT_LOGGER, "invld event type: [type=%d], [subType=%d]", eventType, eventSubtype);
+        return FAIL;
+    }
 
 	writeEventLog.type = eventType;
 	writeEventLog.subtype = eventSubtype;
@@ -390,90 +420,40 @@ BOOL WriteEvent(LOG_EVENT_TYPE_e eventType, LOG_EVENT_SUBTYPE_e eventSubtype, co
 	if(fileWrite == TRUE)
 	{
         MUTEX_LOCK(eventWriteMutex);
-		do
-		{
-			fdEvt = fopen(EVENT_LOG_FILE, "r+");
-			if(fdEvt == NULL)
-			{
-				fdEvt = fopen(EVENT_LOG_FILE, "w");
-				if(fdEvt == NULL)
-				{
-                    EPRINT(EVENT_LOGGER, "fail to open event file: [file=%s], [err=%s]", EVENT_LOG_FILE, STR_ERR);
-					fileWrite = FAIL;
-					break;
-				}
-				eventCnt.writeIndex = 0;
-				eventCnt.rolloverFlag = CLEAR;
-			}
-
-            fseek(fdEvt, (eventCnt.writeIndex * (sizeof(FILE_EVENT_LOG_t))), SEEK_SET);
-			if(fwrite(&writeEventLog, sizeof(FILE_EVENT_LOG_t), 1, fdEvt) != 1)
-			{
-				fclose(fdEvt);
-                EPRINT(EVENT_LOGGER, "fail to write event file: [file=%s], [err=%s]", EVENT_LOG_FILE, STR_ERR);
-				fileWrite = FAIL;
-				break;
-			}
-
-			fflush(fdEvt);
-			fclose(fdEvt);
-
-			memcpy(&tempEvtCnt, &eventCnt, sizeof(EVENT_CNT_t));
-			eventCnt.writeIndex++;
-			if(eventCnt.writeIndex >= MAX_EVENT_LOG)
-			{
-                /* Write index reached to max event log count. Hence set to rollover */
-				eventCnt.writeIndex = 0;
-				eventCnt.rolloverFlag = SET;
-			}
-
-			fdCnt = fopen(EVENT_CNT_FILE, "r+");
-			if(fdCnt == NULL)			//File is not created
-			{
-                EPRINT(EVENT_LOGGER, "fail to open event cnt file: [file=%s], [err=%s]", EVENT_CNT_FILE, STR_ERR);
-				fileWrite = FAIL;
-				break;
-			}
-
-			if(fwrite(&eventCnt, sizeof(EVENT_CNT_t), 1, fdCnt) != 1)
-			{
-                EPRINT(EVENT_LOGGER, "fail to write event cnt file: [file=%s], [err=%s]", EVENT_CNT_FILE, STR_ERR);
-				fileWrite = FAIL;
-			}
-			else
-			{
-				fflush(fdCnt);
-			}
-			fclose(fdCnt);
-		}
-		while(0);
-        MUTEX_UNLOCK(eventWriteMutex);
-
-		for(sessionIndex = 0; sessionIndex < MAX_NW_CLIENT; sessionIndex++)
-		{
-            if (FREE == getEvtSearchSessState(sessionIndex))
-			{
-                continue;
-            }
-
-            MUTEX_LOCK(searchSession[sessionIndex].sessionMutex);
-            if ((tempEvtCnt.rolloverFlag == SET) && (searchSession[sessionIndex].readIndex == tempEvtCnt.writeIndex))
-            {
-                searchSession[sessionIndex].readIndex++;
-                if(searchSession[sessionIndex].readIndex >= MAX_EVENT_LOG)
-                {
-                    searchSession[sessionIndex].readIndex = 0;
-                }
-            }
-            else
+        if (eventLogRecord == NULL)
+        {
+            fileWrite = FAIL;
+        }
+        else
+        {
+            /* Write record first and then publish it in header. Oldest record is overwritten on rollover */
+            eventSeq = eventWriteSeq + 1;
+            recordIndex = EVENT_SEQ_TO_INDEX(eventSeq);
+            memcpy(&eventLogRecord[recordIndex], &writeEventLog, sizeof(FILE_EVENT_LOG_t));
+
+            eventIndex[recordIndex].timeSec = writeEventLog.timeSec;
+            eventIndex[recordIndex].type = writeEventLog.type;
+            eventIndex[recordIndex].prevTypeSeq = lastEventTypeSeq[eventType];
+            lastEventTypeSeq[eventType] = eventSeq;
+
+            eventWriteSeq = eventSeq;
+            updateEventLogHdr();
+            unsyncedEventCnt++;
+            syncEventLog(FALSE);
+
+            /* Start sync timer to sync remaining events on interval even if no more event is written */
+            if ((unsyncedEventCnt != 0) && (eventSyncTmrHandle == INVALID_TIMER_HANDLE))
             {
-                if(searchSession[sessionIndex].count < MAX_EVENT_LOG)
+                timerInfo.count = CONVERT_SEC_TO_TIMER_COUNT(EVENT_LOG_SYNC_INTERVAL_SEC);
+                timerInfo.funcPtr = eventSyncTimerCb;
+                timerInfo.data = 0;
+                if (FAIL == StartTimer(timerInfo, &eventSyncTmrHandle))
                 {
-                    searchSession[sessionIndex].count++;
+                    EPRINT(EVENT_LOGGER, "fail to start event sync timer");
                 }
             }
-            MUTEX_UNLOCK(searchSession[sessionIndex].sessionMutex);
-		}
+        }
+        MUTEX_UNLOCK(eventWriteMutex);
 	}
 
 	eventLog.eventType = writeEventLog.type;
@@ -504,7 +484,7 @@ BOOL WriteEvent(LOG_EVENT_TYPE_e eventType, LOG_EVENT_SUBTYPE_e eventSubtype, co
 		}
 	}
 
-    printEventInfo(&tempEvtCnt, &eventLog, isLiveEvtOnNw, fileWrite);
+    printEventInfo(eventSeq, &eventLog, isLiveEvtOnNw, fileWrite);
 	return SUCCESS;
 }
 
@@ -549,9 +529,9 @@ BOOL SendNwEvent(LOG_EVENT_TYPE_e eventType, LOG_EVENT_SUBTYPE_e eventSubtype, C
  */
 BOOL StartEventSearch(UINT8 sessionIndex, LOG_EVENT_TYPE_e eventType, struct tm *startTime, struct tm *endTime)
 {
-    EVENT_CNT_t tempEvtCnt;
+    UINT64 startSeq;
 
-    if (sessionIndex >= MAX_NW_CLIENT)
+    if ((sessionIndex >= MAX_NW_CLIENT) || (eventType >= LOG_MAX_EVENT_TYPE))
 	{
         return FAIL;
     }
@@ -564,18 +544,14 @@ BOOL StartEventSearch(UINT8 sessionIndex, LOG_EVENT_TYPE_e eventType, struct tm
     ConvertLocalTimeInSec(startTime, &searchSession[sessionIndex].startTimeSec);
     ConvertLocalTimeInSec(endTime, &searchSession[sessionIndex].endTimeSec);
 
+    /* Start from newest event, or from newest event of required type to skip other events */
     MUTEX_LOCK(eventWriteMutex);
-    memcpy(&tempEvtCnt, &eventCnt, sizeof(EVENT_CNT_t));
+    startSeq = (eventType == LOG_ANY_EVENT) ? eventWriteSeq : lastEventTypeSeq[eventType];
     MUTEX_UNLOCK(eventWriteMutex);
 
     /* PARASOFT: BD-TRS-DIFCS: Variable used in multiple critical sections */
     MUTEX_LOCK(searchSession[sessionIndex].sessionMutex);
-
-    /* If rollover set the set max event log else set write index */
-    searchSession[sessionIndex].count = (tempEvtCnt.rolloverFlag == CLEAR) ? tempEvtCnt.writeIndex : MAX_EVENT_LOG;
-
-    /* Start reading from last write index */
-    searchSession[sessionIndex].readIndex = tempEvtCnt.writeIndex-1;
+    searchSession[sessionIndex].nextSeq = startSeq;
     MUTEX_UNLOCK(searchSession[sessionIndex].sessionMutex);
     return SUCCESS;
 }
@@ -601,14 +577,23 @@ BOOL StartMoreEventSearch(UINT8 sessionIndex)
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   This API searches for the matching event in the file and outputs to user
+ * @brief   This API searches for the matching event in the index and outputs to user. Events of
+ *          other type are skipped through type chain of index and time is checked from index, hence
+ *          only matched record is accessed from event log. Index entries are copied in small batch
+ *          under write lock and checked outside it, hence event writers are not blocked by search.
  * @param   sessionIndex
  * @param   eventLogPtr
  * @return
  */
 EVENT_SEARCH_RESULT_e ReadEvent(UINT8 sessionIndex, EVENT_LOG_t *eventLogPtr)
 {
-    FILE                *fdEvt;
+    UINT8               batchCnt, batchIdx;
+    UINT64              eventSeq, oldestSeq;
+    UINT64              batchSeq[EVENT_SEARCH_BATCH];
+    UINT64              batchNextSeq[EVENT_SEARCH_BATCH];
+    time_t              batchTimeSec[EVENT_SEARCH_BATCH];
+    EVENT_INDEX_t       *pIndex;
+    SEARCH_SESSION_t    *pSession;
     FILE_EVENT_LOG_t    readEventLog;
 
     if((sessionIndex >= MAX_NW_CLIENT) || (eventLogPtr == NULL))
@@ -616,73 +601,77 @@ EVENT_SEARCH_RESULT_e ReadEvent(UINT8 sessionIndex, EVENT_LOG_t *eventLogPtr)
         return NO_MORE_EVENT;
     }
 
-    fdEvt = fopen(EVENT_LOG_FILE, "r");
-    if(fdEvt == NULL)
-    {
-        EPRINT(EVENT_LOGGER, "fail to open event file: [file=%s], [err=%s]", EVENT_LOG_FILE, STR_ERR);
-        return EVENT_SEARCH_FAIL;
-    }
-
-    MUTEX_LOCK(searchSession[sessionIndex].sessionMutex);
-    if(searchSession[sessionIndex].readIndex > 0)
+    pSession = &searchSession[sessionIndex];
+    MUTEX_LOCK(pSession->sessionMutex);
+    while (TRUE)
     {
-        // Do fseek first time and then read
-        fseek(fdEvt, (searchSession[sessionIndex].readIndex * (sizeof(FILE_EVENT_LOG_t))), SEEK_SET);
-    }
-
-    while(searchSession[sessionIndex].count > 0)
-    {
-        if(fread(&readEventLog, sizeof(FILE_EVENT_LOG_t), 1, fdEvt) != 1)
+        MUTEX_LOCK(eventWriteMutex);
+        if (eventLogRecord == NULL)
         {
-            MUTEX_UNLOCK(searchSession[sessionIndex].sessionMutex);
-            EPRINT(EVENT_LOGGER, "fail to read event log: [err=%s]", STR_ERR);
-            fclose(fdEvt);
+            MUTEX_UNLOCK(eventWriteMutex);
+            MUTEX_UNLOCK(pSession->sessionMutex);
+            EPRINT(EVENT_LOGGER, "event log not available: [file=%s]", EVENT_LOG_FILE);
             return EVENT_SEARCH_FAIL;
         }
 
-        searchSession[sessionIndex].count--;
-        searchSession[sessionIndex].readIndex = (searchSession[sessionIndex].readIndex > 0) ? (searchSession[sessionIndex].readIndex-1) : (MAX_EVENT_LOG-1);
-        searchSession[sessionIndex].eventTypeMatch = (searchSession[sessionIndex].eventType == LOG_ANY_EVENT) ? SET : CLEAR;
-        searchSession[sessionIndex].startTimeMatch = (searchSession[sessionIndex].startTimeSec == 0) ? SET : CLEAR;
-        searchSession[sessionIndex].endTimeMatch = (searchSession[sessionIndex].endTimeSec == 0) ? SET : CLEAR;
-
-        // IF EVENT TYPE MATCH IS NOT SET AND READ EVENT TYPE MATCHES WITH SEARCH EVENT TYPE
-        if((searchSession[sessionIndex].eventTypeMatch == CLEAR) && (readEventLog.type == searchSession[sessionIndex].eventType))
+        /* Events older than this are overwritten after search was started */
+        oldestSeq = getOldestEventSeq();
+        eventSeq = pSession->nextSeq;
+        batchCnt = 0;
+        while ((batchCnt < EVENT_SEARCH_BATCH) && (eventSeq != EVENT_SEQ_NONE) && (eventSeq >= oldestSeq))
         {
-            searchSession[sessionIndex].eventTypeMatch = SET;
+            pIndex = &eventIndex[EVENT_SEQ_TO_INDEX(eventSeq)];
+            batchSeq[batchCnt] = eventSeq;
+            batchTimeSec[batchCnt] = pIndex->timeSec;
+            eventSeq = (pSession->eventType == LOG_ANY_EVENT) ? (eventSeq - 1) : pIndex->prevTypeSeq;
+            batchNextSeq[batchCnt] = eventSeq;
+            batchCnt++;
         }
+        MUTEX_UNLOCK(eventWriteMutex);
 
-        // IF EVENT START TIME MATCH IS NOT SET AND READ EVENT TIME IS GREATER THAN SEARCH START TIME
-        if((searchSession[sessionIndex].startTimeMatch == CLEAR) && (readEventLog.timeSec >= searchSession[sessionIndex].startTimeSec))
+        if (batchCnt == 0)
         {
-            searchSession[sessionIndex].startTimeMatch = SET;
+            break;
         }
 
-        // IF EVENT END TIME MATCH IS NOT SET AND READ EVENT TIME IS LESSER THAN SEARCH TIME MATCH
-        if((searchSession[sessionIndex].endTimeMatch == CLEAR) && (readEventLog.timeSec <= searchSession[sessionIndex].endTimeSec))
+        for (batchIdx = 0; batchIdx < batchCnt; batchIdx++)
         {
-            searchSession[sessionIndex].endTimeMatch = SET;
-        }
+            if (((pSession->startTimeSec != 0) && (batchTimeSec[batchIdx] < pSession->startTimeSec))
+                    || ((pSession->endTimeSec != 0) && (batchTimeSec[batchIdx] > pSession->endTimeSec)))
+            {
+                continue;
+            }
+
+            /* Record may be overwritten after index was copied */
+            MUTEX_LOCK(eventWriteMutex);
+            if (batchSeq[batchIdx] < getOldestEventSeq())
+            {
+                MUTEX_UNLOCK(eventWriteMutex);
+                pSession->nextSeq = EVENT_SEQ_NONE;
+                MUTEX_UNLOCK(pSession->sessionMutex);
+                return NO_MORE_EVENT;
+            }
+            memcpy(&readEventLog, &eventLogRecord[EVENT_SEQ_TO_INDEX(batchSeq[batchIdx])], sizeof(FILE_EVENT_LOG_t));
+            MUTEX_UNLOCK(eventWriteMutex);
+
+            pSession->nextSeq = batchNextSeq[batchIdx];
+            MUTEX_UNLOCK(pSession->sessionMutex);
 
-        // IF EVENT TYPE MATCH IS SET AND EVENT START TIME IS SET AND EVENT END TIME IS SET
-        if((searchSession[sessionIndex].eventTypeMatch == SET)
-                && (searchSession[sessionIndex].startTimeMatch == SET) && (searchSession[sessionIndex].endTimeMatch == SET))
-        {
             eventLogPtr->eventType = readEventLog.type;
             eventLogPtr->eventSubtype = readEventLog.subtype;
             eventLogPtr->eventState	= readEventLog.state;
             ConvertLocalTimeInBrokenTm(&readEventLog.timeSec, &eventLogPtr->eventTime);
             snprintf(eventLogPtr->detail, MAX_EVENT_DETAIL_SIZE, "%s", readEventLog.detail);
             snprintf(eventLogPtr->advncDetail, MAX_EVENT_ADVANCE_DETAIL_SIZE, "%s", readEventLog.advncdetail);
-            MUTEX_UNLOCK(searchSession[sessionIndex].sessionMutex);
-            fclose(fdEvt);
             return EVENT_FOUND;
         }
 
-        fseek(fdEvt, (searchSession[sessionIndex].readIndex * (sizeof(FILE_EVENT_LOG_t))), SEEK_SET);
+        /* No matching event in this batch, continue with next batch */
+        pSession->nextSeq = eventSeq;
     }
-    fclose(fdEvt);
-    MUTEX_UNLOCK(searchSession[sessionIndex].sessionMutex);
+
+    pSession->nextSeq = EVENT_SEQ_NONE;
+    MUTEX_UNLOCK(pSession->sessionMutex);
     return NO_MORE_EVENT;
 }
 
@@ -739,12 +728,12 @@ static void checkEventWriteStatus(LOG_EVENT_TYPE_e eventType, LOG_EVENT_SUBTYPE_
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   This function prints the event information.
- * @param   eventCnt
+ * @param   eventSeq
  * @param   evPtr
  * @param   isLiveEvt
  * @param   isFileWrite
  */
-static void printEventInfo(EVENT_CNT_t *eventCnt, EVENT_LOG_t *evPtr, BOOL isLiveEvt, BOOL isFileWrite)
+static void printEventInfo(UINT64 eventSeq, EVENT_LOG_t *evPtr, BOOL isLiveEvt, BOOL isFileWrite)
 {
     CHARPTR eventSubString;
 
@@ -791,11 +780,292 @@ static void printEventInfo(EVENT_CNT_t *eventCnt, EVENT_LOG_t *evPtr, BOOL isLiv
 	}
 
     /* Print event information in debug */
-    DPRINT(EVENT_LOGGER, "[writeIndex=%d], [isLiveEvt=%s], [isFileWrite=%s], [type=%s], [subType=%s], [state=%d], [detail=%s], [advance=%s]",
-           eventCnt->writeIndex, isLiveEvt ? "YES" : "NO", isFileWrite ? "YES" : "NO",
+    DPRINT(EVENT_LOGGER, "[eventSeq=%llu], [isLiveEvt=%s], [isFileWrite=%s], [type=%s], [subType=%s], [state=%d], [detail=%s], [advance=%s]",
+           eventSeq, isLiveEvt ? "YES" : "NO", isFileWrite ? "YES" : "NO",
            eventLogTypeStr[evPtr->eventType], eventSubString, evPtr->eventState, evPtr->detail, evPtr->advncDetail);
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Open and map event log file. Event log of older version is migrated, otherwise invalid
+ *          event log is reset.
+ * @return  SUCCESS/FAIL
+ */
+static BOOL openEventLogFile(void)
+{
+    FILE        *pFileFp;
+    struct stat fileInfo;
+    off_t       legacySize = 0;
+    EVENT_CNT_t legacyCnt = { 0 };
+
+    eventLogFd = open(EVENT_LOG_FILE, O_RDWR | O_CREAT | O_CLOEXEC, USR_RW_GRP_R_OTH_R);
+    if (eventLogFd == INVALID_FILE_FD)
+    {
+        EPRINT(EVENT_LOGGER, "fail to open event file: [file=%s], [err=%s]", EVENT_LOG_FILE, STR_ERR);
+        return FAIL;
+    }
+
+    if (fstat(eventLogFd, &fileInfo) != STATUS_OK)
+    {
+        EPRINT(EVENT_LOGGER, "fail to get event file info: [file=%s], [err=%s]", EVENT_LOG_FILE, STR_ERR);
+        close(eventLogFd);
+        eventLogFd = INVALID_FILE_FD;
+        return FAIL;
+    }
+
+    if (fileInfo.st_size != (off_t)EVENT_LOG_FILE_SIZE)
+    {
+        /* Older version has only records in event log file and write index in separate count file */
+        pFileFp = fopen(EVENT_CNT_FILE, "r");
+        if (pFileFp != NULL)
+        {
+            if ((fread(&legacyCnt, sizeof(EVENT_CNT_t), 1, pFileFp) == 1) && (legacyCnt.version == EVENT_LOG_LEGACY_VERSION)
+                    && (fileInfo.st_size <= (off_t)(MAX_EVENT_LOG * sizeof(FILE_EVENT_LOG_t))))
+            {
+                legacySize = fileInfo.st_size;
+            }
+            fclose(pFileFp);
+        }
+
+        /* Legacy records are kept for migration, new file is created otherwise */
+        if (((legacySize == 0) && (ftruncate(eventLogFd, 0) != STATUS_OK)) || (ftruncate(eventLogFd, EVENT_LOG_FILE_SIZE) != STATUS_OK))
+        {
+            EPRINT(EVENT_LOGGER, "fail to resize event file: [file=%s], [err=%s]", EVENT_LOG_FILE, STR_ERR);
+            close(eventLogFd);
+            eventLogFd = INVALID_FILE_FD;
+            return FAIL;
+        }
+    }
+
+    eventLogBaseAddr = (UINT8PTR)mmap(NULL, EVENT_LOG_FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, eventLogFd, 0);
+    if (eventLogBaseAddr == MAP_FAILED)
+    {
+        EPRINT(EVENT_LOGGER, "fail to map event file: [file=%s], [err=%s]", EVENT_LOG_FILE, STR_ERR);
+        eventLogBaseAddr = NULL;
+        close(eventLogFd);
+        eventLogFd = INVALID_FILE_FD;
+        return FAIL;
+    }
+
+    eventLogHdr = (EVENT_LOG_HDR_t *)eventLogBaseAddr;
+    eventLogRecord = (FILE_EVENT_LOG_t *)(eventLogBaseAddr + EVENT_LOG_HDR_SIZE);
+
+    if (legacySize != 0)
+    {
+        migrateLegacyEventLog(&legacyCnt, legacySize);
+    }
+    else if (FAIL == loadEventLogHdr())
+    {
+        WPRINT(EVENT_LOGGER, "valid event log header not found, resetting event log");
+        eventLogUpdateCnt = 0;
+        eventWriteSeq = EVENT_SEQ_NONE;
+        updateEventLogHdr();
+        unsyncedEventCnt++;
+    }
+
+    /* Count file is not required anymore */
+    unlink(EVENT_CNT_FILE);
+    syncEventLog(TRUE);
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Migrate records of older version event log file. Records are moved after header and
+ *          sequence is derived from write index; record index remains same.
+ * @param   pLegacyCnt
+ * @param   legacySize - Size of older event log file
+ */
+static void migrateLegacyEventLog(const EVENT_CNT_t *pLegacyCnt, off_t legacySize)
+{
+    UINT64 recordCnt;
+
+    memmove(eventLogRecord, eventLogBaseAddr, (size_t)legacySize);
+    memset(eventLogBaseAddr, 0, EVENT_LOG_HDR_SIZE);
+
+    eventLogUpdateCnt = 0;
+    eventWriteSeq = (pLegacyCnt->rolloverFlag == SET) ? (MAX_EVENT_LOG + pLegacyCnt->writeIndex) : pLegacyCnt->writeIndex;
+
+    /* Rolled over log has all records and its newest record is just before write index */
+    recordCnt = (eventWriteSeq > MAX_EVENT_LOG) ? MAX_EVENT_LOG : eventWriteSeq;
+    if ((recordCnt * sizeof(FILE_EVENT_LOG_t)) > (UINT64)legacySize)
+    {
+        /* Records are not present as per write index, hence take available records only */
+        eventWriteSeq = (UINT64)legacySize / sizeof(FILE_EVENT_LOG_t);
+    }
+
+    updateEventLogHdr();
+    unsyncedEventCnt++;
+    DPRINT(EVENT_LOGGER, "event log migrated: [rollover=%d], [writeIndex=%d], [writeSeq=%llu]",
+           pLegacyCnt->rolloverFlag, pLegacyCnt->writeIndex, eventWriteSeq);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Load latest valid header copy from event log file
+ * @return  SUCCESS if valid header found else FAIL
+ */
+static BOOL loadEventLogHdr(void)
+{
+    UINT8           hdrCopy;
+    EVENT_LOG_HDR_t *pValidHdr = NULL;
+
+    for (hdrCopy = 0; hdrCopy < EVENT_LOG_HDR_COPY_MAX; hdrCopy++)
+    {
+        if ((eventLogHdr[hdrCopy].magic != EVENT_LOG_MAGIC) || (eventLogHdr[hdrCopy].version != EVENT_LOG_VERSION)
+                || (eventLogHdr[hdrCopy].recordSize != sizeof(FILE_EVENT_LOG_t)) || (eventLogHdr[hdrCopy].maxRecord != MAX_EVENT_LOG)
+                || (eventLogHdr[hdrCopy].checksum != getEventLogHdrChecksum(&eventLogHdr[hdrCopy])))
+        {
+            /* Header copy is not valid, it may be partially written */
+            continue;
+        }
+
+        if ((pValidHdr == NULL) || (eventLogHdr[hdrCopy].updateCnt > pValidHdr->updateCnt))
+        {
+            pValidHdr = &eventLogHdr[hdrCopy];
+        }
+    }
+
+    if (pValidHdr == NULL)
+    {
+        return FAIL;
+    }
+
+    eventLogUpdateCnt = pValidHdr->updateCnt;
+    eventWriteSeq = pValidHdr->writeSeq;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Update header copy which is not latest, hence latest copy remains valid if update is
+ *          interrupted
+ * @note    Caller must hold event write lock
+ */
+static void updateEventLogHdr(void)
+{
+    EVENT_LOG_HDR_t *pHdr;
+
+    eventLogUpdateCnt++;
+    pHdr = &eventLogHdr[eventLogUpdateCnt % EVENT_LOG_HDR_COPY_MAX];
+    pHdr->magic = EVENT_LOG_MAGIC;
+    pHdr->version = EVENT_LOG_VERSION;
+    pHdr->recordSize = sizeof(FILE_EVENT_LOG_t);
+    pHdr->maxRecord = MAX_EVENT_LOG;
+    pHdr->updateCnt = eventLogUpdateCnt;
+    pHdr->writeSeq = eventWriteSeq;
+    pHdr->reserved = 0;
+    pHdr->checksum = getEventLogHdrChecksum(pHdr);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Get checksum of header (FNV-1a), checksum field is excluded
+ * @param   pHdr
+ * @return  Checksum
+ */
+static UINT32 getEventLogHdrChecksum(const EVENT_LOG_HDR_t *pHdr)
+{
+    UINT32          byteCnt;
+    UINT32          checksum = 2166136261U;
+    EVENT_LOG_HDR_t tempHdr = *pHdr;
+    const UINT8     *pByte = (const UINT8 *)&tempHdr;
+
+    tempHdr.checksum = 0;
+    for (byteCnt = 0; byteCnt < sizeof(EVENT_LOG_HDR_t); byteCnt++)
+    {
+        checksum ^= pByte[byteCnt];
+        checksum *= 16777619U;
+    }
+
+    return checksum;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Build time and type index of available events from event log
+ */
+static void buildEventIndex(void)
+{
+    UINT8   eventType;
+    UINT32  recordIndex;
+    UINT64  eventSeq;
+
+    memset(eventIndex, 0, sizeof(eventIndex));
+    memset(lastEventTypeSeq, 0, sizeof(lastEventTypeSeq));
+
+    for (eventSeq = getOldestEventSeq(); (eventSeq != EVENT_SEQ_NONE) && (eventSeq <= eventWriteSeq); eventSeq++)
+    {
+        recordIndex = EVENT_SEQ_TO_INDEX(eventSeq);
+
+        /* Invalid type is kept as any event type, it is never searched through type chain */
+        eventType = (eventLogRecord[recordIndex].type < LOG_MAX_EVENT_TYPE) ? eventLogRecord[recordIndex].type : LOG_ANY_EVENT;
+        eventIndex[recordIndex].timeSec = eventLogRecord[recordIndex].timeSec;
+        eventIndex[recordIndex].type = eventType;
+        eventIndex[recordIndex].prevTypeSeq = lastEventTypeSeq[eventType];
+        lastEventTypeSeq[eventType] = eventSeq;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Sync dirty pages of event log to storage. Sync is started asynchronously in batch of
+ *          events or after interval, it is completed synchronously when forced.
+ * @param   forceSyncF
+ * @note    Caller must hold event write lock
+ */
+static void syncEventLog(BOOL forceSyncF)
+{
+    UINT64 currTimeSec;
+
+    if ((eventLogBaseAddr == NULL) || (unsyncedEventCnt == 0))
+    {
+        return;
+    }
+
+    currTimeSec = GetMonotonicTimeInSec();
+    if ((forceSyncF == FALSE) && (unsyncedEventCnt < EVENT_LOG_SYNC_BATCH) && ((currTimeSec - lastEventSyncTime) < EVENT_LOG_SYNC_INTERVAL_SEC))
+    {
+        return;
+    }
+
+    if (msync(eventLogBaseAddr, EVENT_LOG_FILE_SIZE, (forceSyncF == TRUE) ? MS_SYNC : MS_ASYNC) != STATUS_OK)
+    {
+        EPRINT(EVENT_LOGGER, "fail to sync event file: [file=%s], [err=%s]", EVENT_LOG_FILE, STR_ERR);
+    }
+
+    unsyncedEventCnt = 0;
+    lastEventSyncTime = currTimeSec;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Get sequence of oldest available event
+ * @return  Oldest event sequence
+ * @note    Caller must hold event write lock
+ */
+static UINT64 getOldestEventSeq(void)
+{
+    return (eventWriteSeq > MAX_EVENT_LOG) ? (eventWriteSeq - MAX_EVENT_LOG + 1) : 1;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Sync timer callback. It syncs unsynced events after sync interval and stops itself when
+ *          all events are synced.
+ * @param   data
+ */
+static void eventSyncTimerCb(UINT32 data)
+{
+    MUTEX_LOCK(eventWriteMutex);
+    syncEventLog(FALSE);
+    if (unsyncedEventCnt == 0)
+    {
+        DeleteTimer(&eventSyncTmrHandle);
+    }
+    MUTEX_UNLOCK(eventWriteMutex);
+}
+
 //#################################################################################################
 // @END OF FILE
 //#################################################################################################
@@ -257,6 +257,8 @@ typedef struct
 //-------------------------------------------------------------------------------------------------
 void InitEventLogger(void);
 //-------------------------------------------------------------------------------------------------
+void DeInitEventLogger(void);
+//-------------------------------------------------------------------------------------------------
 BOOL WriteEvent(LOG_EVENT_TYPE_e eventType, LOG_EVENT_SUBTYPE_e eventSubtype, const CHAR *detail, const CHAR *advncDetail, LOG_EVENT_STATE_e eventState);
 //-------------------------------------------------------------------------------------------------
 BOOL SendNwEvent(LOG_EVENT_TYPE_e eventType, LOG_EVENT_SUBTYPE_e eventSubtype, CHARPTR detail, LOG_EVENT_STATE_e eventState);
@@ -9,10 +9,14 @@
 //#################################################################################################
 // @INCLUDES
 //#################################################################################################
+/* OS Includes */
+#include <sys/eventfd.h>
+
 /* Application Includes */
 #include "HttpClient.h"
 #include "DebugLog.h"
 #include "Utils.h"
+#include "SysTimer.h"
 #include "MxHttpParser.h"
 #include "NetworkInterface.h"
 
@@ -23,8 +27,18 @@
 #define MAX_URL_WIDTH				1024
 #define NS_HTTP_USER_AGENT_STR      "NS-HTTP/1.0"
 
-/* Use Default Stack Size*/
-#define HTTP_TRANSFER_STACK_SZ      (1*MEGA_BYTE)
+/* Requests are sharded on engines by camera address, so connections of camera stay on one engine */
+#define HTTP_ENGINE_MAX             (4)
+
+/* Idle curl handles are kept per camera to reuse connection and digest nonce of camera */
+#define HTTP_IDLE_HANDLE_MAX        (MAX_CAMERA / HTTP_ENGINE_MAX + 1)
+#define HTTP_IDLE_HANDLE_TIMEOUT    (60)
+#define HTTP_MAX_CONNECTS           (MAX_CAMERA * 2)
+#define HTTP_ENGINE_WAIT_TIME_MS    (1000)
+
+/* Engine thread runs curl multi and callbacks of all requests sharded on it */
+#define HTTP_ENGINE_STACK_SZ        (1*MEGA_BYTE)
+#define HTTP_RESOLVE_STACK_SZ       (100*KILO_BYTE)
 
 //#################################################################################################
 // @DATA_TYPES
@@ -38,19 +52,70 @@ typedef struct
     CURL 					*curlHandle;
 	HTTP_INFO_t 			httpInfo;			// URL information buffer
 	pthread_mutex_t 		httpReqInfoMutex;	// Stop HTTP lock mutex
+    UINT8                   engineId;           // engine on which request is served
+    BOOL                    transferActive;     // request is added in multi handle of engine
+    FILE                    *putFileFd;
+    struct curl_slist       *httpHeader;
+    BOOL                    resolveRequiredF;   // camera domain is resolved before request is given to engine
+    struct curl_slist       *resolveList;       // resolved address of camera domain for curl
+    CHAR                    absoluteUrl[MAX_URL_WIDTH];
 }HTTP_CLIENT_INFO_t;
 
+typedef struct
+{
+    CURL                    *curlHandle;
+    CHAR                    ipAddress[MAX_CAMERA_ADDRESS_WIDTH];
+    UINT16                  port;
+    UINT32                  idleTick;
+
+}HTTP_IDLE_HANDLE_t;
+
+typedef struct
+{
+    UINT8                   engineId;
+    CURLM                   *multiHandle;
+    INT32                   wakeFd;
+    pthread_mutex_t         engineMutex;
+    UINT16                  pendingCnt;
+    HTTP_HANDLE             pendingHandle[MAX_HTTP_REQUEST];
+    UINT8                   idleCnt;
+    HTTP_IDLE_HANDLE_t      idleHandle[HTTP_IDLE_HANDLE_MAX];
+
+}HTTP_ENGINE_t;
+
 //#################################################################################################
 // @STATIC VARIABLES
 //#################################################################################################
 static pthread_mutex_t      httpReqListMutex;
 static HTTP_CLIENT_INFO_t   httpClientInfo[MAX_HTTP_REQUEST];
+static HTTP_ENGINE_t        httpEngine[HTTP_ENGINE_MAX];
+
+/* Without asynchronous resolver in libcurl, name lookup blocks engine thread and all requests on it */
+static BOOL                 httpAsyncDnsF = FALSE;
 
 //#################################################################################################
 // @PROTOTYPES
 //#################################################################################################
 //-------------------------------------------------------------------------------------------------
-static VOIDPTR httpTransfer(VOIDPTR httpSessionPtr);
+static VOIDPTR httpEngineThread(VOIDPTR threadArg);
+//-------------------------------------------------------------------------------------------------
+static UINT8 getHttpEngineId(HTTP_INFO_t *httpInfo);
+//-------------------------------------------------------------------------------------------------
+static void wakeHttpEngine(HTTP_ENGINE_t *pEngine);
+//-------------------------------------------------------------------------------------------------
+static void queueHttpRequest(HTTP_ENGINE_t *pEngine, HTTP_HANDLE httpHandle);
+//-------------------------------------------------------------------------------------------------
+static VOIDPTR httpResolveThread(VOIDPTR threadArg);
+//-------------------------------------------------------------------------------------------------
+static BOOL startHttpTransfer(HTTP_ENGINE_t *pEngine, HTTP_HANDLE httpHandle);
+//-------------------------------------------------------------------------------------------------
+static void finishHttpTransfer(HTTP_ENGINE_t *pEngine, HTTP_HANDLE httpHandle, CURLcode curlResp);
+//-------------------------------------------------------------------------------------------------
+static CURL *getIdleCurlHandle(HTTP_ENGINE_t *pEngine, HTTP_INFO_t *httpInfo);
+//-------------------------------------------------------------------------------------------------
+static void putIdleCurlHandle(HTTP_ENGINE_t *pEngine, CURL *curlHandle, HTTP_INFO_t *httpInfo);
+//-------------------------------------------------------------------------------------------------
+static void removeIdleCurlHandles(HTTP_ENGINE_t *pEngine);
 //-------------------------------------------------------------------------------------------------
 static size_t httpHeaderRead(VOIDPTR curlBuffer, size_t row, size_t column, VOIDPTR index);
 //-------------------------------------------------------------------------------------------------
@@ -66,6 +131,7 @@ static size_t httpDataRead(VOIDPTR curlBuffer, size_t row, size_t column, VOIDPT
 void InitHttp(void)
 {
     HTTP_HANDLE handle;
+    UINT8       engineId;
 
     MUTEX_INIT(httpReqListMutex, NULL);
 
@@ -74,11 +140,61 @@ void InitHttp(void)
 	{
         httpClientInfo[handle].requestStatus = FREE;
         httpClientInfo[handle].httpHandle = handle;
+        httpClientInfo[handle].transferActive = FALSE;
+        httpClientInfo[handle].putFileFd = NULL;
+        httpClientInfo[handle].httpHeader = NULL;
+        httpClientInfo[handle].resolveRequiredF = FALSE;
+        httpClientInfo[handle].resolveList = NULL;
         MUTEX_INIT(httpClientInfo[handle].httpReqInfoMutex, NULL);
 	}
 
 	// initialize LibCurl
 	curl_global_init(CURL_GLOBAL_ALL);
+
+    /* Curl built with c-ares or threaded resolver resolves names without blocking multi handle */
+    curl_version_info_data *pCurlVersion = curl_version_info(CURLVERSION_NOW);
+    if ((pCurlVersion != NULL) && (pCurlVersion->features & CURL_VERSION_ASYNCHDNS))
+    {
+        httpAsyncDnsF = TRUE;
+        DPRINT(HTTP_CLIENT, "curl resolves names asynchronously: [version=%s]", pCurlVersion->version);
+    }
+    else
+    {
+        httpAsyncDnsF = FALSE;
+        WPRINT(HTTP_CLIENT, "curl resolver is synchronous, camera domains are resolved outside engines: [version=%s]",
+               (pCurlVersion != NULL) ? pCurlVersion->version : "unknown");
+    }
+
+    for(engineId = 0; engineId < HTTP_ENGINE_MAX; engineId++)
+    {
+        httpEngine[engineId].engineId = engineId;
+        httpEngine[engineId].pendingCnt = 0;
+        httpEngine[engineId].idleCnt = 0;
+        httpEngine[engineId].wakeFd = INVALID_FILE_FD;
+        MUTEX_INIT(httpEngine[engineId].engineMutex, NULL);
+
+        /* Multi handle keeps connections and dns cache of all requests of engine */
+        httpEngine[engineId].multiHandle = curl_multi_init();
+        if (NULL == httpEngine[engineId].multiHandle)
+        {
+            EPRINT(HTTP_CLIENT, "failed to init curl multi: [engine=%d]", engineId);
+            continue;
+        }
+        curl_multi_setopt(httpEngine[engineId].multiHandle, CURLMOPT_MAXCONNECTS, (long)HTTP_MAX_CONNECTS);
+
+        httpEngine[engineId].wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (httpEngine[engineId].wakeFd == INVALID_FILE_FD)
+        {
+            EPRINT(HTTP_CLIENT, "failed to create wake event: [engine=%d], [err=%s]", engineId, STR_ERR);
+        }
+
+        if (FAIL == Utils_CreateThread(NULL, httpEngineThread, &httpEngine[engineId], DETACHED_THREAD, HTTP_ENGINE_STACK_SZ))
+        {
+            EPRINT(HTTP_CLIENT, "failed to create http engine thread: [engine=%d]", engineId);
+            curl_multi_cleanup(httpEngine[engineId].multiHandle);
+            httpEngine[engineId].multiHandle = NULL;
+        }
+    }
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -93,7 +209,8 @@ void InitHttp(void)
  */
 BOOL StartHttp(HTTP_REQUEST_e httpRequest, HTTP_INFO_t * httpInfo, HTTP_CALLBACK callback, UINT32 userData, HTTP_HANDLE *handlePtr)
 {
-    HTTP_HANDLE handle;
+    HTTP_HANDLE     handle;
+    HTTP_ENGINE_t   *pEngine;
 
 	// check input/output parameters are not invalid, if any of them is, return fail status
     if ((httpRequest >= MAX_HTTP_REQUEST_TYPE) || (callback == NULL))
@@ -102,6 +219,14 @@ BOOL StartHttp(HTTP_REQUEST_e httpRequest, HTTP_INFO_t * httpInfo, HTTP_CALLBACK
         return FAIL;
     }
 
+    pEngine = &httpEngine[getHttpEngineId(httpInfo)];
+    if (pEngine->multiHandle == NULL)
+    {
+        EPRINT(HTTP_CLIENT, "http engine not available: [engine=%d], [httpRequest=%d]", pEngine->engineId, httpRequest);
+        *handlePtr = INVALID_HTTP_HANDLE;
+        return FAIL;
+    }
+
     /* Check if the space for new request is available or not. lock the request list prior to search operation.
      * so that another thread/process can’t alter content which we are accessing. Check request status from the
      * beginning, until free space is found or end of list is reached */
@@ -126,22 +251,30 @@ BOOL StartHttp(HTTP_REQUEST_e httpRequest, HTTP_INFO_t * httpInfo, HTTP_CALLBACK
     httpClientInfo[handle].httpRequest = httpRequest;
     httpClientInfo[handle].curlHandle = NULL;
     httpClientInfo[handle].httpInfo = *httpInfo;
+    httpClientInfo[handle].engineId = pEngine->engineId;
+    httpClientInfo[handle].putFileFd = NULL;
+    httpClientInfo[handle].httpHeader = NULL;
+    httpClientInfo[handle].resolveList = NULL;
+    httpClientInfo[handle].resolveRequiredF = ((httpAsyncDnsF == FALSE)
+            && (NM_IPADDR_FAMILY_INVALID == NMIpUtil_GetIpAddrFamily(httpInfo->ipAddress))) ? TRUE : FALSE;
+
+    MUTEX_LOCK(httpClientInfo[handle].httpReqInfoMutex);
     httpClientInfo[handle].stopHttp = FALSE;
+    MUTEX_UNLOCK(httpClientInfo[handle].httpReqInfoMutex);
 
     InitHttpParser(handle, callback, userData);
 
-    /* Create HTTP parser thread */
-    if (FALSE == Utils_CreateThread(NULL, httpTransfer, &httpClientInfo[handle], DETACHED_THREAD, HTTP_TRANSFER_STACK_SZ))
+    /* Domain is resolved in separate thread and request is queued to engine after that. If thread is not
+     * created then request is queued as it is and curl resolves domain in engine */
+    if ((httpClientInfo[handle].resolveRequiredF == FALSE)
+            || (FAIL == Utils_CreateThread(NULL, httpResolveThread, &httpClientInfo[handle], DETACHED_THREAD, HTTP_RESOLVE_STACK_SZ)))
     {
-        MUTEX_LOCK(httpReqListMutex);
-        httpClientInfo[handle].requestStatus = FREE;
-        MUTEX_UNLOCK(httpReqListMutex);
-        *handlePtr = INVALID_HTTP_HANDLE;
-        return FAIL;
+        httpClientInfo[handle].resolveRequiredF = FALSE;
+        queueHttpRequest(pEngine, handle);
     }
 
     *handlePtr = handle;
-    DPRINT(HTTP_CLIENT, "http session started: [handle=%d]", handle);
+    DPRINT(HTTP_CLIENT, "http session started: [handle=%d], [engine=%d]", handle, pEngine->engineId);
 
     return SUCCESS;
 }
@@ -173,6 +306,9 @@ BOOL StopHttp(HTTP_HANDLE httpHandle)
     MUTEX_LOCK(httpClientInfo[httpHandle].httpReqInfoMutex);
     httpClientInfo[httpHandle].stopHttp = TRUE;
     MUTEX_UNLOCK(httpClientInfo[httpHandle].httpReqInfoMutex);
+
+    /* Engine removes stopped request without waiting for data from server */
+    wakeHttpEngine(&httpEngine[httpClientInfo[httpHandle].engineId]);
     DPRINT(HTTP_CLIENT, "http session stop: [handle=%d]", httpHandle);
 
     return SUCCESS;
@@ -180,243 +316,576 @@ BOOL StopHttp(HTTP_HANDLE httpHandle)
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   This is a thread function. It performs actual communication with server
- * @param   httpSessionPtr - http handle
- * @return  NULL
+ * @brief   This function gives engine of request. Requests of same camera are always served by same
+ *          engine, so persistent connection and digest nonce of camera can be reused.
+ * @param   httpInfo - url information
+ * @return  Engine id
  */
-static VOIDPTR httpTransfer(VOIDPTR httpSessionPtr)
+static UINT8 getHttpEngineId(HTTP_INFO_t *httpInfo)
 {
-	HTTP_HANDLE 		httpHandle;
-    UINT32				authType;
-	HTTP_RESPONSE_e		httpResp = HTTP_CLOSE_ON_ERROR;
-    CURLcode 			curlResp = CURLE_OK;
-	CHAR 				absoluteUrl[MAX_URL_WIDTH];
-	CHARPTR 			postUrl, postData;
-	FILE 				*putFileFd = NULL;
-    struct curl_slist   *httpHeader = NULL;
-    CHAR                ipAddrForUrl[DOMAIN_NAME_SIZE_MAX] = { 0 };
+    UINT32  hash = httpInfo->port;
+    CHARPTR pAddr = httpInfo->ipAddress;
 
-	httpHandle = ((HTTP_CLIENT_INFO_t *)httpSessionPtr)->httpHandle;
-    if (httpHandle >= MAX_HTTP_REQUEST)
-	{
-        DPRINT(HTTP_CLIENT, "invld http handle: [handle=%d]", httpHandle);
-        pthread_exit(NULL);
+    while (*pAddr != '\0')
+    {
+        hash = (hash * 31) + (UINT8)(*pAddr);
+        pAddr++;
     }
 
-    THREAD_START_INDEX2("HTTP_CLT", httpHandle);
+    return (UINT8)(hash % HTTP_ENGINE_MAX);
+}
 
-    /* Compose URL from the user provided data to be feed to libcurl later */
-    PrepareIpAddressForUrl(httpClientInfo[httpHandle].httpInfo.ipAddress, ipAddrForUrl);
-    snprintf(absoluteUrl, MAX_URL_WIDTH, "%s://%s:%d%s", (httpClientInfo[httpHandle].httpInfo.port == DFLT_HTTPS_PORT) ? "https" : "http",
-             ipAddrForUrl, httpClientInfo[httpHandle].httpInfo.port, httpClientInfo[httpHandle].httpInfo.relativeUrl);
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function wakes up engine thread from wait of socket activity
+ * @param   pEngine
+ */
+static void wakeHttpEngine(HTTP_ENGINE_t *pEngine)
+{
+    UINT64 wakeCnt = 1;
 
-    do
+    if (pEngine->wakeFd == INVALID_FILE_FD)
     {
-        // initialize curl handle, which will be used by LibCurl during communication
-        httpClientInfo[httpHandle].curlHandle = curl_easy_init();
-        if (NULL == httpClientInfo[httpHandle].curlHandle)
-        {
-            EPRINT(HTTP_CLIENT, "failed to init curl: [handle=%d], [url=%s]", httpHandle, absoluteUrl);
-            break;
-        }
+        return;
+    }
+
+    if (write(pEngine->wakeFd, &wakeCnt, sizeof(wakeCnt)) != sizeof(wakeCnt))
+    {
+        /* Counter is already signaled, engine will wake up anyway */
+    }
+}
 
-        // configure behavior option
-        curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_NOPROGRESS, 1L);
-        curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_NOSIGNAL, 1L);
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function queues request to engine, transfer is started by engine thread
+ * @param   pEngine
+ * @param   httpHandle
+ */
+static void queueHttpRequest(HTTP_ENGINE_t *pEngine, HTTP_HANDLE httpHandle)
+{
+    MUTEX_LOCK(pEngine->engineMutex);
+    pEngine->pendingHandle[pEngine->pendingCnt++] = httpHandle;
+    MUTEX_UNLOCK(pEngine->engineMutex);
+    wakeHttpEngine(pEngine);
+}
 
-        // Http version
-        curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_NONE);
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This thread resolves camera domain of request and queues request to its engine. It is used
+ *          when curl resolver is synchronous, so slow name lookup doesn't stall other requests of engine.
+ * @param   threadArg - http client info of request
+ * @return  NULL
+ */
+static VOIDPTR httpResolveThread(VOIDPTR threadArg)
+{
+    HTTP_CLIENT_INFO_t  *pClientInfo = (HTTP_CLIENT_INFO_t *)threadArg;
+    CHAR                resolvedIpAddr[IPV6_ADDR_LEN_MAX] = { 0 };
+    CHAR                ipAddrForUrl[DOMAIN_NAME_SIZE_MAX] = { 0 };
+    CHAR                resolveEntry[MAX_CAMERA_ADDRESS_WIDTH + DOMAIN_NAME_SIZE_MAX + 8];
 
-        // User agent
-        if (httpClientInfo[httpHandle].httpInfo.userAgent == NS_HTTP_USER_AGENT)
-        {
-            curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_USERAGENT, NS_HTTP_USER_AGENT_STR);
-        }
-        else
-        {
-            curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_USERAGENT, curl_version());
-        }
+    THREAD_START("HTTP_RESOLVE");
 
-        // configure callback options
-        curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_HEADERFUNCTION, httpHeaderRead);
-        curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_HEADERDATA, &httpHandle);
+    if (SUCCESS == GetIpAddrFromDomainName(pClientInfo->httpInfo.ipAddress, IP_ADDR_TYPE_MAX, resolvedIpAddr))
+    {
+        /* Entry format is HOST:PORT:ADDRESS, curl uses it in place of name lookup of request */
+        PrepareIpAddressForUrl(resolvedIpAddr, ipAddrForUrl);
+        snprintf(resolveEntry, sizeof(resolveEntry), "%s:%d:%s", pClientInfo->httpInfo.ipAddress, pClientInfo->httpInfo.port, ipAddrForUrl);
+        pClientInfo->resolveList = curl_slist_append(NULL, resolveEntry);
+    }
+    else
+    {
+        EPRINT(HTTP_CLIENT, "fail to resolve camera domain: [handle=%d], [domain=%s]", pClientInfo->httpHandle, pClientInfo->httpInfo.ipAddress);
+    }
 
-        /* SSL options: disable peer verification */
-        curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_SSL_VERIFYPEER, 0L);
-        curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_SSL_VERIFYHOST, 0L);
+    queueHttpRequest(&httpEngine[pClientInfo->engineId], pClientInfo->httpHandle);
+    pthread_exit(NULL);
+}
 
-        if (httpClientInfo[httpHandle].httpRequest == GET_REQUEST || httpClientInfo[httpHandle].httpRequest == POST_REQUEST)
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This is a thread function of http engine. It runs all requests of engine on one curl
+ *          multi handle, so requests of camera reuse connections instead of thread and handshake
+ *          per request.
+ * @param   threadArg - http engine
+ * @return  NULL
+ */
+static VOIDPTR httpEngineThread(VOIDPTR threadArg)
+{
+    HTTP_ENGINE_t       *pEngine = (HTTP_ENGINE_t *)threadArg;
+    HTTP_HANDLE         pendingHandle[MAX_HTTP_REQUEST];
+    HTTP_HANDLE         handle;
+    UINT16              pendingCnt, pendingIdx;
+    INT32               runningCnt, msgCnt, waitFdCnt;
+    UINT64              wakeCnt;
+    UINT32              lastIdleCheckTick;
+    BOOL                stopHttp;
+    CURLMsg             *pCurlMsg;
+    HTTP_CLIENT_INFO_t  *pClientInfo;
+    struct curl_waitfd  wakeWaitFd;
+
+    THREAD_START_INDEX("HTTP_ENGINE", pEngine->engineId);
+
+    lastIdleCheckTick = GetSysTick();
+    while(TRUE)
+    {
+        /* Start newly queued requests */
+        MUTEX_LOCK(pEngine->engineMutex);
+        pendingCnt = pEngine->pendingCnt;
+        memcpy(pendingHandle, pEngine->pendingHandle, (pendingCnt * sizeof(HTTP_HANDLE)));
+        pEngine->pendingCnt = 0;
+        MUTEX_UNLOCK(pEngine->engineMutex);
+
+        for(pendingIdx = 0; pendingIdx < pendingCnt; pendingIdx++)
         {
-            curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_WRITEFUNCTION, httpDataRead);
-            curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_WRITEDATA, &httpHandle);
+            handle = pendingHandle[pendingIdx];
+            if (FAIL == startHttpTransfer(pEngine, handle))
+            {
+                finishHttpTransfer(pEngine, handle, CURLE_FAILED_INIT);
+            }
         }
-        else if(httpClientInfo[httpHandle].httpRequest == PUT_REQUEST)
+
+        /* Remove stopped requests, they may not get any data to notice stop in callback */
+        for(handle = 0; handle < MAX_HTTP_REQUEST; handle++)
         {
-            /* if content type is xml */
-            if (httpClientInfo[httpHandle].httpInfo.contentType == HTTP_CONTENT_TYPE_XML)
+            pClientInfo = &httpClientInfo[handle];
+            if ((pClientInfo->transferActive == FALSE) || (pClientInfo->engineId != pEngine->engineId))
             {
-                /* append content type in http header, added for tiandy camera support */
-                httpHeader = curl_slist_append(httpHeader, "Content-Type: application/xml");
-                curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_HTTPHEADER, httpHeader);
+                continue;
             }
 
-            if(httpClientInfo[httpHandle].httpInfo.sizeOfPutFile == 0)
+            MUTEX_LOCK(pClientInfo->httpReqInfoMutex);
+            stopHttp = pClientInfo->stopHttp;
+            MUTEX_UNLOCK(pClientInfo->httpReqInfoMutex);
+            if (stopHttp == TRUE)
             {
-                curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_INFILESIZE_LARGE, (curl_off_t)(httpClientInfo[httpHandle].httpInfo.sizeOfPutFile));
+                finishHttpTransfer(pEngine, handle, CURLE_WRITE_ERROR);
+            }
+        }
 
-                /* set the METHOD put */
-                curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_PUT, 1L);
-                curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_WRITEFUNCTION, httpDataRead);
-                curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_WRITEDATA, &httpHandle);
+        curl_multi_perform(pEngine->multiHandle, &runningCnt);
+
+        /* Complete finished requests */
+        while ((pCurlMsg = curl_multi_info_read(pEngine->multiHandle, &msgCnt)) != NULL)
+        {
+            if (pCurlMsg->msg != CURLMSG_DONE)
+            {
+                continue;
             }
-            else
+
+            pClientInfo = NULL;
+            curl_easy_getinfo(pCurlMsg->easy_handle, CURLINFO_PRIVATE, (char **)&pClientInfo);
+            if (pClientInfo == NULL)
             {
-                putFileFd = fopen(httpClientInfo[httpHandle].httpInfo.fileForPutReq, "r");
-                if(putFileFd == NULL)
-                {
-                    EPRINT(HTTP_CLIENT, "failed to open file for put request: [handle=%d], [file=%s], [url=%s]",
-                           httpHandle, httpClientInfo[httpHandle].httpInfo.fileForPutReq, absoluteUrl);
-                    break;
-                }
-
-                /* enable uploading */
-                curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_UPLOAD, 1L);
-
-                /* now specify which file to upload */
-                curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_READDATA, putFileFd);
-
-                /* provide the size of the upload, we specicially typecast the value
-                 * to curl_off_t since we must be sure to use the correct data size */
-                curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_INFILESIZE_LARGE, (curl_off_t)(httpClientInfo[httpHandle].httpInfo.sizeOfPutFile));
-
-                /* set the METHOD put */
-                curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_PUT, 1L);
-                curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_WRITEFUNCTION, httpDataRead);
-                curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_WRITEDATA, &httpHandle);
+                continue;
             }
+
+            finishHttpTransfer(pEngine, pClientInfo->httpHandle, pCurlMsg->data.result);
         }
-        /* This type is for REBOOT the camera where we dont require any file to open. hikvision supports reboot of camera
-         * on PUT method where we dont have to give any file and file size */
-        else if(httpClientInfo[httpHandle].httpRequest == PUT_REBOOT_REQUEST)
+
+        if (ElapsedTick(lastIdleCheckTick) >= CONVERT_SEC_TO_TIMER_COUNT(1))
         {
-            curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_CUSTOMREQUEST, "PUT");
-            curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_WRITEFUNCTION, httpDataRead);
-            curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_WRITEDATA, &httpHandle);
+            lastIdleCheckTick = GetSysTick();
+            removeIdleCurlHandles(pEngine);
         }
-        else if(httpClientInfo[httpHandle].httpRequest == DELETE_REQUEST)
+
+        /* Wait for socket activity or new request */
+        waitFdCnt = 0;
+        if (pEngine->wakeFd != INVALID_FILE_FD)
         {
-            curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_CUSTOMREQUEST, "DELETE");
-            curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_WRITEFUNCTION, httpDataRead);
-            curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_WRITEDATA, &httpHandle);
+            wakeWaitFd.fd = pEngine->wakeFd;
+            wakeWaitFd.events = CURL_WAIT_POLLIN;
+            wakeWaitFd.revents = 0;
+            waitFdCnt = 1;
         }
 
-        // configure authentication options
-        curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_USERNAME, httpClientInfo[httpHandle].httpInfo.httpUsrPwd.username);
-        curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_PASSWORD, httpClientInfo[httpHandle].httpInfo.httpUsrPwd.password);
-
-        switch(httpClientInfo[httpHandle].httpInfo.authMethod)
+        curl_multi_wait(pEngine->multiHandle, (waitFdCnt ? &wakeWaitFd : NULL), waitFdCnt, HTTP_ENGINE_WAIT_TIME_MS, NULL);
+        if ((waitFdCnt > 0) && (wakeWaitFd.revents != 0))
         {
-            case AUTH_TYPE_NONE:
-                authType = CURLAUTH_NONE;
-                break;
+            if (read(pEngine->wakeFd, &wakeCnt, sizeof(wakeCnt)) != sizeof(wakeCnt))
+            {
+                /* Nothing to do, counter is already cleared */
+            }
+        }
+    }
 
-            case AUTH_TYPE_BASIC:
-                authType = CURLAUTH_BASIC;
-                break;
+    pthread_exit(NULL);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function configures curl handle of request and adds it to multi handle of engine
+ * @param   pEngine
+ * @param   httpHandle
+ * @return  SUCCESS or FAIL
+ */
+static BOOL startHttpTransfer(HTTP_ENGINE_t *pEngine, HTTP_HANDLE httpHandle)
+{
+    UINT32              authType;
+    CHARPTR             postUrl, postData;
+    CHAR                ipAddrForUrl[DOMAIN_NAME_SIZE_MAX] = { 0 };
+    HTTP_CLIENT_INFO_t  *pClientInfo = &httpClientInfo[httpHandle];
+    CURL                *curlHandle;
 
-            case AUTH_TYPE_DIGEST:
-                authType = CURLAUTH_DIGEST;
-                break;
+    /* Compose URL from the user provided data to be feed to libcurl later */
+    PrepareIpAddressForUrl(pClientInfo->httpInfo.ipAddress, ipAddrForUrl);
+    snprintf(pClientInfo->absoluteUrl, MAX_URL_WIDTH, "%s://%s:%d%s", (pClientInfo->httpInfo.port == DFLT_HTTPS_PORT) ? "https" : "http",
+             ipAddrForUrl, pClientInfo->httpInfo.port, pClientInfo->httpInfo.relativeUrl);
 
-            default:
-                authType = (UINT32)CURLAUTH_ANY;
-                break;
-        }
+    if ((pClientInfo->resolveRequiredF == TRUE) && (pClientInfo->resolveList == NULL))
+    {
+        EPRINT(HTTP_CLIENT, "camera domain not resolved: [handle=%d], [url=%s]", httpHandle, pClientInfo->absoluteUrl);
+        return FAIL;
+    }
 
-        curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_HTTPAUTH, authType);
+    // take idle curl handle of camera or initialize new curl handle, which will be used by LibCurl during communication
+    pClientInfo->curlHandle = getIdleCurlHandle(pEngine, &pClientInfo->httpInfo);
+    if (NULL == pClientInfo->curlHandle)
+    {
+        EPRINT(HTTP_CLIENT, "failed to init curl: [handle=%d], [url=%s]", httpHandle, pClientInfo->absoluteUrl);
+        return FAIL;
+    }
+    curlHandle = pClientInfo->curlHandle;
+
+    /* Reused handle keeps options of previous request, so request specific options are set to default */
+    curl_easy_setopt(curlHandle, CURLOPT_HTTPGET, 1L);
+    curl_easy_setopt(curlHandle, CURLOPT_CUSTOMREQUEST, NULL);
+    curl_easy_setopt(curlHandle, CURLOPT_HTTPHEADER, NULL);
+    curl_easy_setopt(curlHandle, CURLOPT_RESOLVE, pClientInfo->resolveList);
+    curl_easy_setopt(curlHandle, CURLOPT_READDATA, NULL);
+    curl_easy_setopt(curlHandle, CURLOPT_INFILESIZE_LARGE, (curl_off_t)-1);
+    curl_easy_setopt(curlHandle, CURLOPT_INTERFACE, NULL);
+    curl_easy_setopt(curlHandle, CURLOPT_PRIVATE, pClientInfo);
+
+    // configure behavior option
+    curl_easy_setopt(curlHandle, CURLOPT_NOPROGRESS, 1L);
+    curl_easy_setopt(curlHandle, CURLOPT_NOSIGNAL, 1L);
+
+    // Http version
+    curl_easy_setopt(curlHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_NONE);
+
+    // User agent
+    if (pClientInfo->httpInfo.userAgent == NS_HTTP_USER_AGENT)
+    {
+        curl_easy_setopt(curlHandle, CURLOPT_USERAGENT, NS_HTTP_USER_AGENT_STR);
+    }
+    else
+    {
+        curl_easy_setopt(curlHandle, CURLOPT_USERAGENT, curl_version());
+    }
 
-        // configure HTTP options
-        curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_CONNECTTIMEOUT, httpClientInfo[httpHandle].httpInfo.maxConnTime);
-        curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_LOW_SPEED_TIME, httpClientInfo[httpHandle].httpInfo.maxFrameTime);
+    // configure callback options
+    curl_easy_setopt(curlHandle, CURLOPT_HEADERFUNCTION, httpHeaderRead);
+    curl_easy_setopt(curlHandle, CURLOPT_HEADERDATA, &pClientInfo->httpHandle);
 
-        // configure Connection options
-        curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_LOW_SPEED_LIMIT, 1);
+    /* SSL options: disable peer verification */
+    curl_easy_setopt(curlHandle, CURLOPT_SSL_VERIFYPEER, 0L);
+    curl_easy_setopt(curlHandle, CURLOPT_SSL_VERIFYHOST, 0L);
 
-        // configure parameters special to GET request
-        if(httpClientInfo[httpHandle].httpRequest == GET_REQUEST || httpClientInfo[httpHandle].httpRequest == PUT_REQUEST
-                || httpClientInfo[httpHandle].httpRequest == PUT_REBOOT_REQUEST || httpClientInfo[httpHandle].httpRequest == DELETE_REQUEST)
-        {
-            // configure network options
-            curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_URL, absoluteUrl);
-        }
-        // configure parameters special for POST request
-        else
+    if (pClientInfo->httpRequest == GET_REQUEST || pClientInfo->httpRequest == POST_REQUEST)
+    {
+        curl_easy_setopt(curlHandle, CURLOPT_WRITEFUNCTION, httpDataRead);
+        curl_easy_setopt(curlHandle, CURLOPT_WRITEDATA, &pClientInfo->httpHandle);
+    }
+    else if(pClientInfo->httpRequest == PUT_REQUEST)
+    {
+        /* if content type is xml */
+        if (pClientInfo->httpInfo.contentType == HTTP_CONTENT_TYPE_XML)
         {
-            // separate out POST data from URL
-            postUrl = strtok_r(absoluteUrl, POSTDATA_DELIM, &postData);
-            curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_URL, postUrl);
-            curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_POSTFIELDS, postData);
+            /* append content type in http header, added for tiandy camera support */
+            pClientInfo->httpHeader = curl_slist_append(pClientInfo->httpHeader, "Content-Type: application/xml");
+            curl_easy_setopt(curlHandle, CURLOPT_HTTPHEADER, pClientInfo->httpHeader);
         }
 
-        if (httpClientInfo[httpHandle].httpInfo.interface == INTERFACE_USB_MODEM)
+        if(pClientInfo->httpInfo.sizeOfPutFile == 0)
         {
-            CHAR ifaceName[INTERFACE_NAME_LEN_MAX];
+            curl_easy_setopt(curlHandle, CURLOPT_INFILESIZE_LARGE, (curl_off_t)(pClientInfo->httpInfo.sizeOfPutFile));
 
-            GetNetworkPortName(NETWORK_PORT_USB_MODEM, ifaceName);
-            if (ifaceName[0] != '\0')
+            /* set the METHOD put */
+            curl_easy_setopt(curlHandle, CURLOPT_PUT, 1L);
+            curl_easy_setopt(curlHandle, CURLOPT_WRITEFUNCTION, httpDataRead);
+            curl_easy_setopt(curlHandle, CURLOPT_WRITEDATA, &pClientInfo->httpHandle);
+        }
+        else
+        {
+            pClientInfo->putFileFd = fopen(pClientInfo->httpInfo.fileForPutReq, "r");
+            if(pClientInfo->putFileFd == NULL)
             {
-                curl_easy_setopt(httpClientInfo[httpHandle].curlHandle, CURLOPT_INTERFACE, ifaceName);
+                EPRINT(HTTP_CLIENT, "failed to open file for put request: [handle=%d], [file=%s], [url=%s]",
+                       httpHandle, pClientInfo->httpInfo.fileForPutReq, pClientInfo->absoluteUrl);
+                return FAIL;
             }
-        }
 
-        curlResp = curl_easy_perform(httpClientInfo[httpHandle].curlHandle);
+            /* enable uploading */
+            curl_easy_setopt(curlHandle, CURLOPT_UPLOAD, 1L);
 
-        // If curl exit normally or stop is requested, return CLOSE_WITH_SUCCESS status in all other cases
-        MUTEX_LOCK(httpClientInfo[httpHandle].httpReqInfoMutex);
-        if ((curlResp == CURLE_OK) || ((curlResp == CURLE_WRITE_ERROR) && (httpClientInfo[httpHandle].stopHttp == TRUE)))
-        {
-            MUTEX_UNLOCK(httpClientInfo[httpHandle].httpReqInfoMutex);
-            httpResp = HTTP_CLOSE_ON_SUCCESS;
+            /* now specify which file to upload */
+            curl_easy_setopt(curlHandle, CURLOPT_READDATA, pClientInfo->putFileFd);
+
+            /* provide the size of the upload, we specicially typecast the value
+             * to curl_off_t since we must be sure to use the correct data size */
+            curl_easy_setopt(curlHandle, CURLOPT_INFILESIZE_LARGE, (curl_off_t)(pClientInfo->httpInfo.sizeOfPutFile));
+
+            /* set the METHOD put */
+            curl_easy_setopt(curlHandle, CURLOPT_PUT, 1L);
+            curl_easy_setopt(curlHandle, CURLOPT_WRITEFUNCTION, httpDataRead);
+            curl_easy_setopt(curlHandle, CURLOPT_WRITEDATA, &pClientInfo->httpHandle);
         }
-        else
+    }
+    /* This type is for REBOOT the camera where we dont require any file to open. hikvision supports reboot of camera
+     * on PUT method where we dont have to give any file and file size */
+    else if(pClientInfo->httpRequest == PUT_REBOOT_REQUEST)
+    {
+        curl_easy_setopt(curlHandle, CURLOPT_CUSTOMREQUEST, "PUT");
+        curl_easy_setopt(curlHandle, CURLOPT_WRITEFUNCTION, httpDataRead);
+        curl_easy_setopt(curlHandle, CURLOPT_WRITEDATA, &pClientInfo->httpHandle);
+    }
+    else if(pClientInfo->httpRequest == DELETE_REQUEST)
+    {
+        curl_easy_setopt(curlHandle, CURLOPT_CUSTOMREQUEST, "DELETE");
+        curl_easy_setopt(curlHandle, CURLOPT_WRITEFUNCTION, httpDataRead);
+        curl_easy_setopt(curlHandle, CURLOPT_WRITEDATA, &pClientInfo->httpHandle);
+    }
+
+    // configure authentication options
+    curl_easy_setopt(curlHandle, CURLOPT_USERNAME, pClientInfo->httpInfo.httpUsrPwd.username);
+    curl_easy_setopt(curlHandle, CURLOPT_PASSWORD, pClientInfo->httpInfo.httpUsrPwd.password);
+
+    switch(pClientInfo->httpInfo.authMethod)
+    {
+        case AUTH_TYPE_NONE:
+            authType = CURLAUTH_NONE;
+            break;
+
+        case AUTH_TYPE_BASIC:
+            authType = CURLAUTH_BASIC;
+            break;
+
+        case AUTH_TYPE_DIGEST:
+            authType = CURLAUTH_DIGEST;
+            break;
+
+        default:
+            authType = (UINT32)CURLAUTH_ANY;
+            break;
+    }
+
+    curl_easy_setopt(curlHandle, CURLOPT_HTTPAUTH, authType);
+
+    // configure HTTP options
+    curl_easy_setopt(curlHandle, CURLOPT_CONNECTTIMEOUT, pClientInfo->httpInfo.maxConnTime);
+    curl_easy_setopt(curlHandle, CURLOPT_LOW_SPEED_TIME, pClientInfo->httpInfo.maxFrameTime);
+
+    // configure Connection options
+    curl_easy_setopt(curlHandle, CURLOPT_LOW_SPEED_LIMIT, 1);
+
+    // configure parameters special to GET request
+    if(pClientInfo->httpRequest == GET_REQUEST || pClientInfo->httpRequest == PUT_REQUEST
+            || pClientInfo->httpRequest == PUT_REBOOT_REQUEST || pClientInfo->httpRequest == DELETE_REQUEST)
+    {
+        // configure network options
+        curl_easy_setopt(curlHandle, CURLOPT_URL, pClientInfo->absoluteUrl);
+    }
+    // configure parameters special for POST request
+    else
+    {
+        // separate out POST data from URL. POST data is not copied by curl, it stays in url buffer of request
+        postUrl = strtok_r(pClientInfo->absoluteUrl, POSTDATA_DELIM, &postData);
+        curl_easy_setopt(curlHandle, CURLOPT_URL, postUrl);
+        curl_easy_setopt(curlHandle, CURLOPT_POSTFIELDS, postData);
+    }
+
+    if (pClientInfo->httpInfo.interface == INTERFACE_USB_MODEM)
+    {
+        CHAR ifaceName[INTERFACE_NAME_LEN_MAX];
+
+        GetNetworkPortName(NETWORK_PORT_USB_MODEM, ifaceName);
+        if (ifaceName[0] != '\0')
         {
-            MUTEX_UNLOCK(httpClientInfo[httpHandle].httpReqInfoMutex);
-            EPRINT(HTTP_CLIENT, "http failed: [handle=%d], [stopHttp=%d], [curlResp=%d], [url=%s]",
-                   httpHandle, httpClientInfo[httpHandle].stopHttp, curlResp, absoluteUrl);
+            curl_easy_setopt(curlHandle, CURLOPT_INTERFACE, ifaceName);
         }
+    }
+
+    if (curl_multi_add_handle(pEngine->multiHandle, curlHandle) != CURLM_OK)
+    {
+        EPRINT(HTTP_CLIENT, "failed to add curl handle: [handle=%d], [url=%s]", httpHandle, pClientInfo->absoluteUrl);
+        return FAIL;
+    }
+
+    pClientInfo->transferActive = TRUE;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function completes request. It releases resources of request, gives response to
+ *          user and frees the request.
+ * @param   pEngine
+ * @param   httpHandle
+ * @param   curlResp - curl status of transfer
+ */
+static void finishHttpTransfer(HTTP_ENGINE_t *pEngine, HTTP_HANDLE httpHandle, CURLcode curlResp)
+{
+    HTTP_RESPONSE_e     httpResp = HTTP_CLOSE_ON_ERROR;
+    HTTP_CLIENT_INFO_t  *pClientInfo = &httpClientInfo[httpHandle];
+
+    if (pClientInfo->transferActive == TRUE)
+    {
+        curl_multi_remove_handle(pEngine->multiHandle, pClientInfo->curlHandle);
+        pClientInfo->transferActive = FALSE;
+    }
+
+    // If curl exit normally or stop is requested, return CLOSE_WITH_SUCCESS status in all other cases
+    MUTEX_LOCK(pClientInfo->httpReqInfoMutex);
+    if ((curlResp == CURLE_OK) || ((curlResp == CURLE_WRITE_ERROR) && (pClientInfo->stopHttp == TRUE)))
+    {
+        MUTEX_UNLOCK(pClientInfo->httpReqInfoMutex);
+        httpResp = HTTP_CLOSE_ON_SUCCESS;
+    }
+    else
+    {
+        MUTEX_UNLOCK(pClientInfo->httpReqInfoMutex);
+        EPRINT(HTTP_CLIENT, "http failed: [handle=%d], [stopHttp=%d], [curlResp=%d], [url=%s]",
+               httpHandle, pClientInfo->stopHttp, curlResp, pClientInfo->absoluteUrl);
+    }
 
-        if((httpClientInfo[httpHandle].httpRequest == PUT_REQUEST) && (httpClientInfo[httpHandle].httpInfo.sizeOfPutFile != 0) && (putFileFd != NULL))
+    if (pClientInfo->putFileFd != NULL)
+    {
+        fclose(pClientInfo->putFileFd);
+        pClientInfo->putFileFd = NULL;
+        if(unlink(pClientInfo->httpInfo.fileForPutReq) != STATUS_OK)
         {
-            fclose(putFileFd);
-            if(unlink(httpClientInfo[httpHandle].httpInfo.fileForPutReq) != STATUS_OK)
-            {
-                EPRINT(HTTP_CLIENT, "failed to remove put file: [handle=%d], [file=%s], [url=%s], [err=%s]",
-                       httpHandle, httpClientInfo[httpHandle].httpInfo.fileForPutReq, absoluteUrl, STR_ERR);
-            }
+            EPRINT(HTTP_CLIENT, "failed to remove put file: [handle=%d], [file=%s], [url=%s], [err=%s]",
+                   httpHandle, pClientInfo->httpInfo.fileForPutReq, pClientInfo->absoluteUrl, STR_ERR);
         }
-
     }
-    while(0);
 
-    curl_easy_cleanup(httpClientInfo[httpHandle].curlHandle);
+    /* Only handle of completed transfer is kept for reuse, handle of failed transfer may have stale state */
+    if (curlResp == CURLE_OK)
+    {
+        putIdleCurlHandle(pEngine, pClientInfo->curlHandle, &pClientInfo->httpInfo);
+    }
+    else
+    {
+        curl_easy_cleanup(pClientInfo->curlHandle);
+    }
+    pClientInfo->curlHandle = NULL;
 
-    if (httpHeader != NULL)
+    if (pClientInfo->httpHeader != NULL)
     {
         /* free linked list of header strings */
-        curl_slist_free_all(httpHeader);
+        curl_slist_free_all(pClientInfo->httpHeader);
+        pClientInfo->httpHeader = NULL;
+    }
+
+    if (pClientInfo->resolveList != NULL)
+    {
+        curl_slist_free_all(pClientInfo->resolveList);
+        pClientInfo->resolveList = NULL;
     }
 
     CleanupHttpInfo(httpHandle, httpResp);
 
+    if (curlResp == CURLE_OK)
+    {
+        DPRINT(HTTP_CLIENT, "http session done: [handle=%d], [url=%s]", httpHandle, pClientInfo->absoluteUrl);
+    }
+
     // set http request buffer of current request to default
     MUTEX_LOCK(httpReqListMutex);
-    httpClientInfo[httpHandle].requestStatus = FREE;
+    pClientInfo->requestStatus = FREE;
     MUTEX_UNLOCK(httpReqListMutex);
-    if (curlResp == CURLE_OK)
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function gives idle curl handle of camera if available, otherwise new curl handle.
+ *          Idle handle keeps digest nonce of camera, so request is authenticated without extra
+ *          challenge round trip.
+ * @param   pEngine
+ * @param   httpInfo - url information
+ * @return  Curl handle or NULL
+ */
+static CURL *getIdleCurlHandle(HTTP_ENGINE_t *pEngine, HTTP_INFO_t *httpInfo)
+{
+    UINT8   idleIdx;
+    CURL    *curlHandle;
+
+    for(idleIdx = 0; idleIdx < pEngine->idleCnt; idleIdx++)
     {
-        DPRINT(HTTP_CLIENT, "http session done: [handle=%d], [url=%s]", httpHandle, absoluteUrl);
+        if ((pEngine->idleHandle[idleIdx].port != httpInfo->port) || (strcmp(pEngine->idleHandle[idleIdx].ipAddress, httpInfo->ipAddress) != 0))
+        {
+            continue;
+        }
+
+        curlHandle = pEngine->idleHandle[idleIdx].curlHandle;
+        pEngine->idleCnt--;
+        pEngine->idleHandle[idleIdx] = pEngine->idleHandle[pEngine->idleCnt];
+        return curlHandle;
+    }
+
+    return curl_easy_init();
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function keeps curl handle of camera for reuse. Oldest idle handle is freed when
+ *          idle list is full.
+ * @param   pEngine
+ * @param   curlHandle
+ * @param   httpInfo - url information
+ */
+static void putIdleCurlHandle(HTTP_ENGINE_t *pEngine, CURL *curlHandle, HTTP_INFO_t *httpInfo)
+{
+    UINT8 idleIdx, oldestIdx = 0;
+
+    if (curlHandle == NULL)
+    {
+        return;
+    }
+
+    if (pEngine->idleCnt >= HTTP_IDLE_HANDLE_MAX)
+    {
+        for(idleIdx = 1; idleIdx < pEngine->idleCnt; idleIdx++)
+        {
+            if (ElapsedTick(pEngine->idleHandle[idleIdx].idleTick) > ElapsedTick(pEngine->idleHandle[oldestIdx].idleTick))
+            {
+                oldestIdx = idleIdx;
+            }
+        }
+
+        curl_easy_cleanup(pEngine->idleHandle[oldestIdx].curlHandle);
+        pEngine->idleCnt--;
+        pEngine->idleHandle[oldestIdx] = pEngine->idleHandle[pEngine->idleCnt];
+    }
+
+    pEngine->idleHandle[pEngine->idleCnt].curlHandle = curlHandle;
+    snprintf(pEngine->idleHandle[pEngine->idleCnt].ipAddress, MAX_CAMERA_ADDRESS_WIDTH, "%s", httpInfo->ipAddress);
+    pEngine->idleHandle[pEngine->idleCnt].port = httpInfo->port;
+    pEngine->idleHandle[pEngine->idleCnt].idleTick = GetSysTick();
+    pEngine->idleCnt++;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function frees idle curl handles which are not used since idle timeout
+ * @param   pEngine
+ */
+static void removeIdleCurlHandles(HTTP_ENGINE_t *pEngine)
+{
+    UINT8 idleIdx = 0;
+
+    while (idleIdx < pEngine->idleCnt)
+    {
+        if (ElapsedTick(pEngine->idleHandle[idleIdx].idleTick) < CONVERT_SEC_TO_TIMER_COUNT(HTTP_IDLE_HANDLE_TIMEOUT))
+        {
+            idleIdx++;
+            continue;
+        }
+
+        curl_easy_cleanup(pEngine->idleHandle[idleIdx].curlHandle);
+        pEngine->idleCnt--;
+        pEngine->idleHandle[idleIdx] = pEngine->idleHandle[pEngine->idleCnt];
     }
-    pthread_exit(NULL);
 }
 
 //-------------------------------------------------------------------------------------------------
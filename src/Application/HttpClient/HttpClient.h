@@ -130,6 +130,8 @@ typedef struct
 }HTTP_DATA_INFO_t;
 
 //-------------------------------------------------------------------------------------------------
+/* Callback runs on engine thread which is shared by requests of many cameras. It must not block or
+ * wait on other HTTP request, otherwise all requests of that engine are stalled. */
 typedef void (*HTTP_CALLBACK)(HTTP_HANDLE httpHandle, HTTP_DATA_INFO_t *dataInfo);
 //-------------------------------------------------------------------------------------------------
 //#################################################################################################
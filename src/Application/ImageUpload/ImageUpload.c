@@ -228,6 +228,8 @@ BOOL StartImageUpload(UINT8 channelNo)
     MUTEX_UNLOCK(imageUploadPara[channelNo].imgUpldInfMutx);
     ReadSingleImageUploadConfig(channelNo, &imgUpldCfg);
 
+    /* Image callback may come before return of get image request */
+    imageUploadPara[channelNo].imgUpldSysTk = GetSysTick();
     if (GetImage(channelNo, imgUpldCfg.resolution, imageCallBack, CLIENT_CB_TYPE_NATIVE) != CMD_SUCCESS)
     {
         if (imageUploadPara[channelNo].imgTimeHandle == INVALID_TIMER_HANDLE)
@@ -245,7 +247,6 @@ BOOL StartImageUpload(UINT8 channelNo)
         return FAIL;
     }
 
-    imageUploadPara[channelNo].imgUpldSysTk = GetSysTick();
     return SUCCESS;
 }
 
@@ -609,16 +610,18 @@ NET_CMD_STATUS_e UploadSnapshot(UINT8 channelNo, NW_CMD_REPLY_CB callback, INT32
     //Read Image Upload configurations to retrieve image resolution value
     ReadSingleImageUploadConfig(channelNo, &imgUpldCfg);
 
+    /* Image callback may come before return of get image request */
+    snpshotInfo[channelNo].callback = callback;
+    snpshotInfo[channelNo].connFd = connFd;
     if (GetImage(channelNo, imgUpldCfg.resolution, snapshotCiCb, CLIENT_CB_TYPE_NATIVE) != CMD_SUCCESS)
     {
+        snpshotInfo[channelNo].callback = NULL;
         MUTEX_LOCK(snpshotInfo[channelNo].reqStatusLock);
         snpshotInfo[channelNo].reqStatus = FREE;
         MUTEX_UNLOCK(snpshotInfo[channelNo].reqStatusLock);
         return CMD_SNAPSHOT_FAILED;
     }
 
-    snpshotInfo[channelNo].callback = callback;
-    snpshotInfo[channelNo].connFd = connFd;
     DPRINT(IMAGE_UPLOAD, "snapshot started: [camera=%d]", channelNo);
     return CMD_SUCCESS;
 }
@@ -23,6 +23,9 @@
 #define FIRMWARE_FILE           ZIP_DIR_PATH "/NVR_Firmware.zip"
 #define CONFIG_ZIP_FILE         ZIP_DIR_PATH "/NVR_Config.zip"
 
+/* Config journal is kept outside of app config directory, hence it is not part of config backup */
+#define CONFIG_JOURNAL_FILE     CONFIG_DIR_PATH "/appConfigJournal.jrnl"
+
 #if defined(HI3536_NVRL) || defined(RK3568_NVRL)
 #define MAX_CAMERA              16
 #elif defined(HI3536_NVRH)
@@ -542,6 +542,8 @@ typedef BOOL (*SEND_TO_SOCKET_CB)(INT32 connFd, UINT8 *pSendBuff, UINT32 buffLen
 //-------------------------------------------------------------------------------------------------
 typedef INT32 (*SEND_TO_CLIENT_CB)(INT32 connFd, UINT8 *pSendBuff, UINT32 buffLen, UINT32 timeout);
 //-------------------------------------------------------------------------------------------------
+typedef BOOL (*SEND_READY_CB)(INT32 connFd, UINT32 sendLen);
+//-------------------------------------------------------------------------------------------------
 typedef void (*CLOSE_SOCKET_CB)(INT32 *pConnFd);
 //-------------------------------------------------------------------------------------------------
 //#################################################################################################
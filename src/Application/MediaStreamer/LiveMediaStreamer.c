@@ -123,6 +123,7 @@ typedef struct
     pthread_mutex_t 		dataMutex;
     pthread_cond_t 			condSignal;
     CLIENT_CB_TYPE_e        clientCbType;
+    LS_SEND_STATS_t         sendStats[MAX_CAMERA][MAX_STREAM];
 
 }LS_CLIENT_PUBLIC_t;
 
@@ -145,6 +146,9 @@ typedef struct
     UINT8					sendFrameCountMPJPG[MAX_CAMERA][MAX_STREAM];
     BOOL                    localFramePending[MAX_CAMERA][MAX_STREAM];
     BOOL                    firstCallBackGiven[MAX_CAMERA][MAX_STREAM];
+    BOOL                    dropTillIframe[MAX_CAMERA][MAX_STREAM];
+    BOOL                    sendStallF[MAX_CAMERA][MAX_STREAM];
+    UINT32                  sendStallTick[MAX_CAMERA][MAX_STREAM];
 
 }LS_CLIENT_PRIVATE_t;
 
@@ -173,6 +177,10 @@ static BOOL setLiveStreamCnt(BOOL status);
 //-------------------------------------------------------------------------------------------------
 static BOOL isFrameNeedTosend(UINT8 cameraIndex, UINT8 streamType, LS_CLIENT_PRIVATE_t *lsClientData);
 //-------------------------------------------------------------------------------------------------
+static BOOL isLiveFrameDropRequired(UINT8 camIndex, VIDEO_TYPE_e streamType, LS_CLIENT_PRIVATE_t *lsPrivate, LS_CLIENT_PUBLIC_t *lsPublic);
+//-------------------------------------------------------------------------------------------------
+static void resetLiveSendState(UINT8 camIndex, VIDEO_TYPE_e streamType, LS_CLIENT_PRIVATE_t *lsPrivate, LS_CLIENT_PUBLIC_t *lsPublic);
+//-------------------------------------------------------------------------------------------------
 static void cleanupLiveMediaStream(UINT8 camIndex, VIDEO_TYPE_e streamType, LS_CLIENT_PRIVATE_t *lsPrivate, LS_CLIENT_PUBLIC_t *lsPublic);
 //-------------------------------------------------------------------------------------------------
 //#################################################################################################
@@ -458,6 +466,7 @@ static VOIDPTR liveStreamThread(VOIDPTR arg)
     UINT32					totalFrameP;
     UINT32					framePushStartTime;
     GENERAL_CONFIG_t		generalConfig;
+    UINT32                  generalConfigVersion = CONFIG_VERSION_INVALID;
     UINT32                  frameLen;
     UINT8                   frameBuff[MAX_LIVE_STRM_BUFFER_SIZE];
 
@@ -485,6 +494,7 @@ static VOIDPTR liveStreamThread(VOIDPTR arg)
             lsPrivate.sendFrameCountMPJPG[camIndex][streamType] = 0;
             lsPrivate.firstCallBackGiven[camIndex][streamType] = FALSE;
             lsPrivate.localFramePending[camIndex][streamType] = FALSE;
+            resetLiveSendState(camIndex, streamType, &lsPrivate, lsPublic);
         }
     }
 
@@ -558,6 +568,7 @@ static VOIDPTR liveStreamThread(VOIDPTR arg)
                     lsPrivate.reqframeTypeMJPG[camIndex][streamType] = lsTrg->frameTypeMJPG;
                     lsPrivate.reqfpsMJPG[camIndex][streamType] = lsTrg->fpsMJPG;
                     lsPrivate.sendFrameCountMPJPG[camIndex][streamType] = 0;
+                    resetLiveSendState(camIndex, streamType, &lsPrivate, lsPublic);
                 }
                 break;
 
@@ -641,6 +652,7 @@ static VOIDPTR liveStreamThread(VOIDPTR arg)
                     lsPrivate.reqfpsMJPG[camIndex][streamType] = lsTrg->fpsMJPG;
                     lsPrivate.sendFrameCountMPJPG[camIndex][streamType] = 0;
                     lsPrivate.firstCallBackGiven[camIndex][streamType] = TRUE;
+                    resetLiveSendState(camIndex, streamType, &lsPrivate, lsPublic);
                     StopStream(GET_STREAM_MAPPED_CAMERA_ID(camIndex, prevStreamType), clientIdx);
 
                     lsPrivate.connId[camIndex][prevStreamType] = INVALID_CONNECTION;
@@ -729,7 +741,7 @@ static VOIDPTR liveStreamThread(VOIDPTR arg)
         MUTEX_UNLOCK(lsPublic->dataMutex);
 
         framePushStartTime = GetSysTick();
-        ReadGeneralConfig(&generalConfig);
+        ReadGeneralConfigIfChanged(&generalConfig, &generalConfigVersion);
 
         /* Do processing of available frames for all cameras */
         do
@@ -767,6 +779,25 @@ static VOIDPTR liveStreamThread(VOIDPTR arg)
                                 /* Check whether we have to send this frame to client or discard it */
                                 if (isFrameNeedTosend(camIndex, streamType, &lsPrivate) == TRUE)
                                 {
+                                    /* Do not wait for slow client. Drop frames till next i-frame when its socket is full */
+                                    if (TRUE == isLiveFrameDropRequired(camIndex, streamType, &lsPrivate, lsPublic))
+                                    {
+                                        if ((TRUE == lsPrivate.sendStallF[camIndex][streamType])
+                                                && (ElapsedTick(lsPrivate.sendStallTick[camIndex][streamType]) >= CONVERT_SEC_TO_TIMER_COUNT(MAX_LS_FRAME_SEND_TIME)))
+                                        {
+                                            /* Client is not reading since long time, Close The Connection */
+                                            WPRINT(LIVE_MEDIA_STREAMER, "client not reading live frames: [camera=%d], [sessionIdx=%d]", camIndex, lsPublic->clientIdx);
+                                            cleanupLiveMediaStream(camIndex, streamType, &lsPrivate, lsPublic);
+                                            if (lsPrivate.totalCamera == 0)
+                                            {
+                                                /* No camera is there for streaming. Hence frame processing not required */
+                                                frameProcessStopF = TRUE;
+                                                break;
+                                            }
+                                        }
+                                        continue;
+                                    }
+
                                     // Decorate Frame Header !!!!
                                     lsPrivate.frmHeader[camIndex][streamType].streamType = lsPrivate.streamStatusInfo->streamType;
 
@@ -824,10 +855,23 @@ static VOIDPTR liveStreamThread(VOIDPTR arg)
                                         memcpy(frameBuff+FRAME_HEADER_LEN_MAX, lsPrivate.streamBuffPtr, lsPrivate.streamDataLen);
                                     }
 
+                                    /* Frame may be overwritten by camera while copying. Discard it and restart from i-frame */
+                                    if (FAIL == UnpinFrame(GET_STREAM_MAPPED_CAMERA_ID(camIndex, streamType), (CI_STREAM_CLIENT_LIVE_START + lsPublic->clientIdx)))
+                                    {
+                                        WPRINT(LIVE_MEDIA_STREAMER, "frame overwritten while copying, wait for i-frame: [camera=%d], [sessionIdx=%d]",
+                                               camIndex, lsPublic->clientIdx);
+                                        lsPrivate.firstIframeSent[camIndex][streamType] = FALSE;
+                                        continue;
+                                    }
+
                                     /* Send received frame to client */
                                     if (sendDataCb[lsPublic->clientCbType](lsPrivate.connId[camIndex][streamType], frameBuff, frameLen, MAX_LS_FRAME_SEND_TIME) == SUCCESS)
                                     {
                                         lsPrivate.lastFrameTime[camIndex][streamType] = GetSysTick();
+                                        MUTEX_LOCK(lsPublic->dataMutex);
+                                        lsPublic->sendStats[camIndex][streamType].sentFrameCnt++;
+                                        lsPublic->sendStats[camIndex][streamType].sentBytes += frameLen;
+                                        MUTEX_UNLOCK(lsPublic->dataMutex);
                                     }
                                     else
                                     {
@@ -1111,6 +1155,15 @@ static BOOL isFrameAvailableForAnyCamera(BOOL frameStatusBuff[MAX_CAMERA][MAX_ST
 static void cleanupLiveMediaStream(UINT8 camIndex, VIDEO_TYPE_e streamType,
                                    LS_CLIENT_PRIVATE_t *lsPrivate, LS_CLIENT_PUBLIC_t *lsPublic)
 {
+    LS_SEND_STATS_t sendStats;
+
+    MUTEX_LOCK(lsPublic->dataMutex);
+    sendStats = lsPublic->sendStats[camIndex][streamType];
+    MUTEX_UNLOCK(lsPublic->dataMutex);
+    DPRINT(LIVE_MEDIA_STREAMER, "live stream send stats: [camera=%d], [stream=%s], [sessionIdx=%d], [sentFrames=%u], [sentBytes=%llu], "
+           "[droppedFrames=%u], [gopDrops=%u], [stalls=%u]", camIndex, streamTypeStr[streamType], lsPublic->clientIdx, sendStats.sentFrameCnt,
+           sendStats.sentBytes, sendStats.dropFrameCnt, sendStats.gopDropCnt, sendStats.stallCnt);
+
     /* Give trigger to camera interface to stop stream for this client */
     StopStream(GET_STREAM_MAPPED_CAMERA_ID(camIndex, streamType), (CI_STREAM_CLIENT_LIVE_START + lsPublic->clientIdx));
 
@@ -1121,6 +1174,7 @@ static void cleanupLiveMediaStream(UINT8 camIndex, VIDEO_TYPE_e streamType,
     lsPrivate->totalCamera--;
     lsPrivate->firstCallBackGiven[camIndex][streamType] = FALSE;
     lsPrivate->streamSwitch[camIndex][streamType] = FALSE;
+    resetLiveSendState(camIndex, streamType, lsPrivate, lsPublic);
 
     MUTEX_LOCK(lsPublic->dataMutex);
     lsPublic->frameAvailable[camIndex][streamType] = FALSE;
@@ -1143,6 +1197,29 @@ UINT32 GetLiveStreamCnt(void)
     return totalLiveStream;
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function gives send statistics of live stream of client. Statistics are of current
+ *          session of stream and they are cleared when stream is started or stopped.
+ * @param   camIndex - Camera Index
+ * @param   streamType - Stream type: Main or Sub stream
+ * @param   clientIdx - Client index
+ * @param   pSendStats - Frames sent and dropped and stalls of client socket
+ * @return  SUCCESS/FAIL
+ */
+BOOL GetLiveMediaSendStats(UINT8 camIndex, VIDEO_TYPE_e streamType, UINT8 clientIdx, LS_SEND_STATS_t *pSendStats)
+{
+    if ((camIndex >= getMaxCameraForCurrentVariant()) || (streamType >= MAX_STREAM) || (clientIdx >= MAX_NW_CLIENT) || (pSendStats == NULL))
+    {
+        return FAIL;
+    }
+
+    MUTEX_LOCK(lsClientPublic[clientIdx].dataMutex);
+    *pSendStats = lsClientPublic[clientIdx].sendStats[camIndex][streamType];
+    MUTEX_UNLOCK(lsClientPublic[clientIdx].dataMutex);
+    return SUCCESS;
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   Add message in queue
@@ -1201,6 +1278,82 @@ static BOOL setLiveStreamCnt(BOOL addStreamCnt)
     return SUCCESS;
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function decides whether current frame must be dropped for slow client. When socket
+ *          of client is full, frames are dropped till next i-frame so that client resumes on complete
+ *          GOP and other streams of session are not blocked on it.
+ * @param   camIndex
+ * @param   streamType
+ * @param   lsPrivate
+ * @param   lsPublic
+ * @return  TRUE if frame must be dropped; FALSE otherwise
+ */
+static BOOL isLiveFrameDropRequired(UINT8 camIndex, VIDEO_TYPE_e streamType, LS_CLIENT_PRIVATE_t *lsPrivate, LS_CLIENT_PUBLIC_t *lsPublic)
+{
+    LS_SEND_STATS_t *pSendStats = &lsPublic->sendStats[camIndex][streamType];
+
+    if (FALSE == sendDataReadyCb[lsPublic->clientCbType](lsPrivate->connId[camIndex][streamType], (FRAME_HEADER_LEN_MAX + lsPrivate->streamDataLen)))
+    {
+        MUTEX_LOCK(lsPublic->dataMutex);
+        if (FALSE == lsPrivate->sendStallF[camIndex][streamType])
+        {
+            lsPrivate->sendStallF[camIndex][streamType] = TRUE;
+            lsPrivate->sendStallTick[camIndex][streamType] = GetSysTick();
+            pSendStats->stallCnt++;
+        }
+
+        if (FALSE == lsPrivate->dropTillIframe[camIndex][streamType])
+        {
+            lsPrivate->dropTillIframe[camIndex][streamType] = TRUE;
+            pSendStats->gopDropCnt++;
+            WPRINT(LIVE_MEDIA_STREAMER, "client is slow, drop frames till i-frame: [camera=%d], [stream=%s], [sessionIdx=%d], [sentFrames=%u], "
+                   "[droppedFrames=%u], [gopDrops=%u]", camIndex, streamTypeStr[streamType], lsPublic->clientIdx, pSendStats->sentFrameCnt,
+                   pSendStats->dropFrameCnt, pSendStats->gopDropCnt);
+        }
+
+        pSendStats->dropFrameCnt++;
+        MUTEX_UNLOCK(lsPublic->dataMutex);
+        return TRUE;
+    }
+
+    lsPrivate->sendStallF[camIndex][streamType] = FALSE;
+    if (FALSE == lsPrivate->dropTillIframe[camIndex][streamType])
+    {
+        return FALSE;
+    }
+
+    /* Resume only from i-frame to avoid decoding of incomplete GOP at client */
+    if ((lsPrivate->streamStatusInfo->streamType != STREAM_TYPE_VIDEO) || (lsPrivate->streamStatusInfo->streamPara.videoStreamType != I_FRAME))
+    {
+        MUTEX_LOCK(lsPublic->dataMutex);
+        pSendStats->dropFrameCnt++;
+        MUTEX_UNLOCK(lsPublic->dataMutex);
+        return TRUE;
+    }
+
+    lsPrivate->dropTillIframe[camIndex][streamType] = FALSE;
+    return FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function resets frame drop state and send statistics of stream
+ * @param   camIndex
+ * @param   streamType
+ * @param   lsPrivate
+ * @param   lsPublic
+ */
+static void resetLiveSendState(UINT8 camIndex, VIDEO_TYPE_e streamType, LS_CLIENT_PRIVATE_t *lsPrivate, LS_CLIENT_PUBLIC_t *lsPublic)
+{
+    lsPrivate->dropTillIframe[camIndex][streamType] = FALSE;
+    lsPrivate->sendStallF[camIndex][streamType] = FALSE;
+    lsPrivate->sendStallTick[camIndex][streamType] = 0;
+    MUTEX_LOCK(lsPublic->dataMutex);
+    memset(&lsPublic->sendStats[camIndex][streamType], 0, sizeof(LS_SEND_STATS_t));
+    MUTEX_UNLOCK(lsPublic->dataMutex);
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   This function verify whether frame send to client or not depending on parameter requested
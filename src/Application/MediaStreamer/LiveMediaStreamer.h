@@ -13,6 +13,19 @@
 /* Application Includes */
 #include "ConfigApi.h"
 
+//#################################################################################################
+// @DATA TYPES
+//#################################################################################################
+/* Send statistics of live stream of client */
+typedef struct
+{
+    UINT32  sentFrameCnt;   /* Frames sent to client */
+    UINT64  sentBytes;      /* Bytes sent to client */
+    UINT32  dropFrameCnt;   /* Frames dropped as client socket was full */
+    UINT32  gopDropCnt;     /* Times frames were dropped till next i-frame */
+    UINT32  stallCnt;       /* Times client socket became full */
+}LS_SEND_STATS_t;
+
 //#################################################################################################
 // @PROTOTYPES
 //#################################################################################################
@@ -31,6 +44,8 @@ BOOL ChangeLiveMediaStream(UINT8 camIndex, VIDEO_TYPE_e streamType, UINT8 client
 //-------------------------------------------------------------------------------------------------
 UINT32 GetLiveStreamCnt(void);
 //-------------------------------------------------------------------------------------------------
+BOOL GetLiveMediaSendStats(UINT8 camIndex, VIDEO_TYPE_e streamType, UINT8 clientIndex, LS_SEND_STATS_t *pSendStats);
+//-------------------------------------------------------------------------------------------------
 void CamMotionNotify(UINT8 camIndex, BOOL evtState);
 //-------------------------------------------------------------------------------------------------
 //#################################################################################################
@@ -297,6 +297,15 @@ INT32 main(INT32 argc, CHARPTR argv[])
     DeInitNetworkController();
     KickWatchDog();
 
+    DeInitEventLogger();
+    KickWatchDog();
+
+    /* Compact config journal into config files. Journal is recovered at next start-up if it fails */
+    if (FAIL == FlushConfigJournal())
+    {
+        WPRINT(SYS_LOG, "fail to flush config journal before power action");
+    }
+
 	sync();
 
     if (powerAct == REBOOT_DEVICE)
@@ -741,8 +741,9 @@ const CHARPTR headerReq[MAX_HEADER_REQ] =
 //#################################################################################################
 // @STATIC VARIABLES
 //#################################################################################################
-/* 2d array of reply message to use it as thread indepedent for p2p and native commands */
-static CHAR replyMsg[CLIENT_CB_TYPE_MAX][MAX_REPLY_SZ];
+/* Reply buffer of command in process. Commands are processed concurrently by workers of external server,
+ * device initiation and p2p clients, hence buffer is allocated per command for thread in process */
+static __thread CHARPTR pCmdReplyMsg = NULL;
 
 //#################################################################################################
 // @PROTOTYPES
@@ -1200,6 +1201,8 @@ static const CHARPTR netCommandStr[MAX_NET_COMMAND] =
     "VALIDATE_USER_CRED",
 };
 
+static STR_INDEX_TABLE_t netCommandIndexTbl = STR_INDEX_TABLE_INIT(netCommandStr, MAX_NET_COMMAND);
+
 static BOOL (*cmsCommandFuncPtr[MAX_NET_COMMAND])(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT32 clientSocket, UINT8 sessionIndex) =
 {
     StartLiveStreamCmd,             /* CMD_SRT_LV_STRM */
@@ -1444,6 +1447,14 @@ const SEND_TO_SOCKET_CB sendDataCb[CLIENT_CB_TYPE_MAX] =
     P2pDataSendCallback     /* P2P */
 };
 
+//-------------------------------------------------------------------------------------------------
+/* Check frame data can be sent without waiting based on client type */
+const SEND_READY_CB sendDataReadyCb[CLIENT_CB_TYPE_MAX] =
+{
+    IsSocketSendReady,          /* Native TCP */
+    P2pDataSendReadyCallback    /* P2P */
+};
+
 //-------------------------------------------------------------------------------------------------
 /* Send client data on socket based on client type */
 const SEND_TO_CLIENT_CB sendClientDataCb[CLIENT_CB_TYPE_MAX] =
@@ -1474,6 +1485,9 @@ void InitNetworkCommand(void)
 {
     HEALTH_STATUS_REPLY_e hsIdx;
 
+    /* Build command lookup table */
+    InitStrIndexTable(&netCommandIndexTbl);
+
     for (hsIdx = 0 ; hsIdx < HS_MAX_STATUS; hsIdx++)
     {
         if (((hsIdx >= HS_MOTION_DET) && (hsIdx <= HS_PRESET_TOUR)) || ((hsIdx >= HS_COSEC_RECORDING) && (hsIdx <= HS_ADA_RECORDING)))
@@ -1507,7 +1521,7 @@ BOOL ProcessSetCommand(CHARPTR pCmdStr, UINT8 sessionIndex, INT32 clientSocket,
         }
 
         /* Parse command string, If it is valid then call related function */
-        cmdType = ConvertStringToIndex(cmdTypeStr, netCommandStr, MAX_NET_COMMAND);
+        cmdType = FindStrIndex(&netCommandIndexTbl, cmdTypeStr);
         if (cmdType >= MAX_NET_COMMAND)
         {
             break;
@@ -1525,8 +1539,17 @@ BOOL ProcessSetCommand(CHARPTR pCmdStr, UINT8 sessionIndex, INT32 clientSocket,
             }
         }
 
+        pCmdReplyMsg = malloc(MAX_REPLY_SZ);
+        if (pCmdReplyMsg == NULL)
+        {
+            EPRINT(NETWORK_MANAGER, "fail to alloc memory for reply: [cmd=%s]", netCommandStr[cmdType]);
+            clientCmdRespCb[callbackType](CMD_RESOURCE_LIMIT, clientSocket, TRUE);
+            return FAIL;
+        }
+
         /* Call function as per command */
         (*cmsCommandFuncPtr[cmdType])(&pCmdStr, callbackType, clientSocket, sessionIndex);
+        FREE_MEMORY(pCmdReplyMsg);
         return SUCCESS;
 
     }while(0);
@@ -2674,9 +2697,9 @@ static BOOL GetAsyncPlayStreamIdCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbT
         }
 
         /* NOTE: %02d : parsing on CMS side is byte size based and not format based */
-        sizeWritten = snprintf(&replyMsg[clientCbType][0], MAX_REPLY_SZ, "%c%s%c%02d%c%c%d%c%d%c%c%c",
+        sizeWritten = snprintf(pCmdReplyMsg, MAX_REPLY_SZ, "%c%s%c%02d%c%c%d%c%d%c%c%c",
                                SOM, headerReq[RPL_CMD], FSP, cmdResp, FSP, SOI, 1, FSP, playbackId, FSP, EOI, EOM);
-        if (SUCCESS != sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType], sizeWritten, MESSAGE_REPLY_TIMEOUT))
+        if (SUCCESS != sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, sizeWritten, MESSAGE_REPLY_TIMEOUT))
         {
             /* If failed to send data then remove playback stream from session */
             RemovePlaybackStream(playbackId, sessionIndex, NULL, INVALID_CONNECTION);
@@ -3085,7 +3108,7 @@ static BOOL GetOnlineUserCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, IN
     NET_CMD_STATUS_e 		cmdResp = CMD_SUCCESS;
     UINT8					counter, count = 1;
     UINT32 					sizeWritten, resStringSize = MAX_REPLY_SZ;
-    CHARPTR 				resStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR 				resStringPtr = pCmdReplyMsg;
     USER_ACCOUNT_CONFIG_t 	userAccountConfig;
 
     sizeWritten = snprintf(resStringPtr, resStringSize, "%c%s%c%d%c", SOM, headerReq[RPL_CMD], FSP, cmdResp, FSP);
@@ -3122,7 +3145,7 @@ static BOOL GetOnlineUserCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, IN
         }
         else
         {
-            sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], strlen(&replyMsg[clientCbType][0]), MESSAGE_REPLY_TIMEOUT);
+            sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, strlen(pCmdReplyMsg), MESSAGE_REPLY_TIMEOUT);
             closeConnCb[clientCbType](&clientSocket);
             return SUCCESS;
         }
@@ -3211,7 +3234,7 @@ static BOOL ViewBlockedUserCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType,
 {
     USER_ACCOUNT_CONFIG_t 	userAccountConfig;
     UINT8					userIndex;
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     const UINT32            respStringSize = MAX_REPLY_SZ;
     UINT8					writeIndex = 1;
     UINT32                  outLen;
@@ -3245,7 +3268,7 @@ static BOOL ViewBlockedUserCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType,
 
     // Append EOM
     outLen += snprintf(respStringPtr + outLen,  respStringSize - outLen, "%c", EOM);
-    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
     closeConnCb[clientCbType](&clientSocket);
     return SUCCESS;
 }
@@ -3308,7 +3331,7 @@ static BOOL GetPhysicalDiskStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCb
     UINT8 					diskIndex;
     PHYSICAL_DISK_INFO_t 	physicalDiskInfo;
     UINT32 					sizeWritten, resStringSize = MAX_REPLY_SZ;
-    CHARPTR 				resStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR 				resStringPtr = pCmdReplyMsg;
 
     do
     {
@@ -3352,7 +3375,7 @@ static BOOL GetPhysicalDiskStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCb
             break;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], strlen(&replyMsg[clientCbType][0]), MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, strlen(pCmdReplyMsg), MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -3378,7 +3401,7 @@ static BOOL GetLogicalDiskStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbT
     UINT8 					diskIndex;
     DISK_VOLUME_INFO_t 		diskVolumeInfo;
     UINT32 					sizeWritten, resStringSize = MAX_REPLY_SZ;
-    CHARPTR 				resStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR 				resStringPtr = pCmdReplyMsg;
     UINT8					totalVolume, driveType;
     HDD_CONFIG_t		    hddConfig;
 
@@ -3447,7 +3470,7 @@ static BOOL GetLogicalDiskStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbT
             break;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], strlen(&replyMsg[clientCbType][0]), MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, strlen(pCmdReplyMsg), MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -3611,7 +3634,7 @@ static BOOL GetDateTimeCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT3
     NET_CMD_STATUS_e 		cmdResp = CMD_MAX_BUFFER_LIMIT;
     struct tm 				getSetTime;
     UINT32 					sizeWritten;
-    CHARPTR 				resStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR 				resStringPtr = pCmdReplyMsg;
 
     /* Sometimes it gets failed, Hence added retry */
     if ((GetLocalTimeInBrokenTm(&getSetTime) == FAIL) && (GetLocalTimeInBrokenTm(&getSetTime) == FAIL))
@@ -3625,7 +3648,7 @@ static BOOL GetDateTimeCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT3
                                getSetTime.tm_year, getSetTime.tm_hour, getSetTime.tm_min, getSetTime.tm_sec, FSP, EOI, EOM);
         if(sizeWritten < MAX_REPLY_SZ)
         {
-            sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], sizeWritten, MESSAGE_REPLY_TIMEOUT);
+            sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, sizeWritten, MESSAGE_REPLY_TIMEOUT);
             closeConnCb[clientCbType](&clientSocket);
             return SUCCESS;
         }
@@ -4405,7 +4428,7 @@ static BOOL GetUsbStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT
     UINT8               diskIndex;
     USB_DISK_INFO_t     usbDiskInfo;
     UINT32              sizeWritten, resStringSize = MAX_REPLY_SZ;
-    CHARPTR             resStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR             resStringPtr = pCmdReplyMsg;
 
     do
     {
@@ -4450,7 +4473,7 @@ static BOOL GetUsbStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT
             break;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], strlen(&replyMsg[clientCbType][0]), MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, strlen(pCmdReplyMsg), MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -4637,7 +4660,7 @@ static BOOL GetMacAddressCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, IN
     {
         lanPort = (UINT8)(tempData[GET_MAC_LAN_NUM] - 1);
         GetMacAddr(lanPort, macAddrsStr);
-        sizeWritten = snprintf(&replyMsg[clientCbType][0], MAX_REPLY_SZ, "%c%s%c%d%c%c%d%c%s%c%c%c",
+        sizeWritten = snprintf(pCmdReplyMsg, MAX_REPLY_SZ, "%c%s%c%d%c%c%d%c%s%c%c%c",
                 SOM, headerReq[RPL_CMD], FSP, cmdResp, FSP, SOI, 1, FSP, macAddrsStr, FSP, EOI, EOM);
         if(sizeWritten >= MAX_REPLY_SZ)
         {
@@ -4645,7 +4668,7 @@ static BOOL GetMacAddressCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, IN
         }
         else
         {
-            sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], sizeWritten, MESSAGE_REPLY_TIMEOUT);
+            sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, sizeWritten, MESSAGE_REPLY_TIMEOUT);
             closeConnCb[clientCbType](&clientSocket);
             return SUCCESS;
         }
@@ -4677,7 +4700,7 @@ static BOOL RecordRightsStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTyp
         recordRight = DISABLE;
     }
 
-    sizeWritten = snprintf(&replyMsg[clientCbType][0], MAX_REPLY_SZ, "%c%s%c%d%c%c%d%c%d%c%c%c",
+    sizeWritten = snprintf(pCmdReplyMsg, MAX_REPLY_SZ, "%c%s%c%d%c%c%d%c%d%c%c%c",
             SOM, headerReq[RPL_CMD], FSP, cmdResp, FSP, SOI, 1,  FSP, recordRight, FSP, EOI, EOM);
     if (sizeWritten >= MAX_REPLY_SZ)
     {
@@ -4685,7 +4708,7 @@ static BOOL RecordRightsStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTyp
     }
     else
     {
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], sizeWritten, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, sizeWritten, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
     }
@@ -4708,7 +4731,7 @@ static BOOL BackupRightsStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTyp
     NET_CMD_STATUS_e 		cmdResp = CMD_SUCCESS;
     BOOL 					backupRights = ENABLE;
     UINT32 					sizeWritten, resStringSize = MAX_REPLY_SZ;
-    CHARPTR 				resStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR 				resStringPtr = pCmdReplyMsg;
     USER_ACCOUNT_CONFIG_t 	userAccountConfig;
 
     ReadSingleUserAccountConfig(GetUserAccountIndex(sessionIndex), &userAccountConfig);
@@ -4725,7 +4748,7 @@ static BOOL BackupRightsStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTyp
     }
     else
     {
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], sizeWritten, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, sizeWritten, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
     }
@@ -4750,7 +4773,7 @@ static BOOL GetHelthStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, I
     HEALTH_STATUS_REPLY_e  	helthStatus;
     UINT8					majorIdx;
     UINT32 					sizeWritten, resStringSize = MAX_REPLY_SZ;
-    CHARPTR 				resStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR 				resStringPtr = pCmdReplyMsg;
 
     do
     {
@@ -4806,7 +4829,7 @@ static BOOL GetHelthStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, I
             break;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], strlen(&replyMsg[clientCbType][0]), MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, strlen(pCmdReplyMsg), MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -4990,7 +5013,7 @@ static BOOL GetModemStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, I
     NET_CMD_STATUS_e 		cmdResp = CMD_SUCCESS;
     UINT32 					sizeWritten;
     LAN_CONFIG_t            networkInfo = {0};
-    CHARPTR 				resStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR 				resStringPtr = pCmdReplyMsg;
 
     do
     {
@@ -5007,7 +5030,7 @@ static BOOL GetModemStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, I
             break;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], sizeWritten, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, sizeWritten, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -5094,7 +5117,7 @@ static BOOL ChangeUserPasswordCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTyp
     USER_ACCOUNT_CONFIG_t 	userAccountConfig;
     LOGIN_POLICY_CONFIG_t	loginPolicyCfg;
     UINT8					minCharReq = 0;
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     UINT32                  outLen;
     const UINT32            respStringSize = MAX_REPLY_SZ;
 
@@ -5138,7 +5161,7 @@ static BOOL ChangeUserPasswordCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTyp
         outLen = respStringSize;
     }
 
-    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
     closeConnCb[clientCbType](&clientSocket);
     return SUCCESS;
 }
@@ -5167,7 +5190,7 @@ static BOOL ChangeUserSessionCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType
     USER_SESSION_FILE_INFO_t    viewerUserSessInfo;
     UINT32                      tempSysTick;
     VIDEO_TYPE_e                streamType;
-    CHARPTR                     respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR                     respStringPtr = pCmdReplyMsg;
     UINT32                      outLen;
     const UINT32                respStringSize = MAX_REPLY_SZ;
     UINT8                       indexId = 0;
@@ -5424,7 +5447,7 @@ static BOOL ChangeUserSessionCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType
         outLen = respStringSize;
     }
 
-    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
     closeConnCb[clientCbType](&clientSocket);
 
     if(cmdResp == CMD_SUCCESS)
@@ -5448,7 +5471,7 @@ static BOOL GetBrandNameCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT
     CHARPTR					cameraBrandStr[MAX_CAMERA_BRAND];
     UINT8					indexId;
     UINT8 					noOfBrand = 0;
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     UINT32                  outLen;
     NET_CMD_STATUS_e		cmdResp;
     USER_ACCOUNT_CONFIG_t 	userAccountConfig;
@@ -5497,7 +5520,7 @@ static BOOL GetBrandNameCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT
             outLen = respStringSize;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -5523,7 +5546,7 @@ static BOOL GetModelNameCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT
     UINT8					noOfModels = 0;
     CHAR					brandNameStr[MAX_BRAND_NAME_LEN];
     CHARPTR					camModelStr[CAMERA_BRAND_MODEL_MAX];
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     UINT32                  outLen;
     USER_ACCOUNT_CONFIG_t 	userAccountConfig;
     const UINT32            respStringSize = MAX_REPLY_SZ;
@@ -5578,7 +5601,7 @@ static BOOL GetModelNameCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT
             outLen = respStringSize;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -5603,7 +5626,7 @@ static BOOL GetSupportedProfileCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTy
     UINT8 					indexId = 1;
     UINT8					noOfProfileSupported = 0;
     UINT64 					tempData[MAX_PROFILE_SUP];
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     USER_ACCOUNT_CONFIG_t 	userAccountConfig;
     UINT32					outLen;
     const UINT32            respStringSize = MAX_REPLY_SZ;
@@ -5651,7 +5674,7 @@ static BOOL GetSupportedProfileCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTy
             outLen = respStringSize;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -5735,7 +5758,7 @@ static BOOL GetSupportedEncoderCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTy
     UINT8 					indexId, noOfCodecs = 0;
     UINT64 					tempData[MAX_ENCDR_SUP];
     CHARPTR					camEncoderStr[MAX_VIDEO_CODEC];
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     USER_ACCOUNT_CONFIG_t 	userAccountConfig;
     UINT32					outLen;
     const UINT32            respStringSize = MAX_REPLY_SZ;
@@ -5790,7 +5813,7 @@ static BOOL GetSupportedEncoderCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTy
             outLen = respStringSize;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -5816,7 +5839,7 @@ static BOOL GetSupportedResolutionCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientC
     UINT64 					tempData[MAX_RES_SUP];
     CHAR					camEncoderStr[MAX_ENCODER_NAME_LEN];
     CHARPTR					camResoltn[MAX_RESOLUTION];
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     USER_ACCOUNT_CONFIG_t 	userAccountConfig;
     UINT32					outLen;
     const UINT32            respStringSize = MAX_REPLY_SZ;
@@ -5876,7 +5899,7 @@ static BOOL GetSupportedResolutionCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientC
             outLen = respStringSize;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -5902,7 +5925,7 @@ static BOOL GetSupportedFrameRateCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCb
     UINT64 					tempData[MAX_FR_SUP];
     CHAR					camEncoderStr[MAX_ENCODER_NAME_LEN];
     CHAR 					camResln[MAX_RESOLUTION_NAME_LEN];
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     USER_ACCOUNT_CONFIG_t 	userAccountConfig;
     const UINT32            respStringSize = MAX_REPLY_SZ;
     UINT32					outLen;
@@ -5942,7 +5965,7 @@ static BOOL GetSupportedFrameRateCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCb
         // {RPL_CMD&0& (1&1073741823&)}
         outLen = snprintf(respStringPtr, respStringSize, "%c%s%c%d%c%c%d%c%llu%c%c%c",
                           SOM, headerReq[RPL_CMD], FSP, cmdResp, FSP, SOI, 1, FSP, camFps, FSP, EOI, EOM);
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -5967,7 +5990,7 @@ static BOOL GetSupportedBitRateCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTy
     UINT64 					tempData[MAX_BITRATE_SUP];
     CHAR					camEncoderStr[MAX_ENCODER_NAME_LEN];
     CHARPTR					bitRateSupStr[MAX_BITRATE_VALUE];
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     USER_ACCOUNT_CONFIG_t 	userAccountConfig;
     UINT8					maxSupportedBitrate = 0;
     BITRATE_VALUE_e         minBitrateIndex, maxBitrateIndex;
@@ -6029,7 +6052,7 @@ static BOOL GetSupportedBitRateCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTy
             outLen = respStringSize;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -6054,7 +6077,7 @@ static BOOL GetSupportedVideoQualityCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clien
     UINT8					maxVideoQlty;
     UINT64 					tempData[MAX_QLT_SUP];
     CHAR					camEncoderStr[MAX_ENCODER_NAME_LEN];
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     USER_ACCOUNT_CONFIG_t 	userAccountConfig;
     const UINT32            respStringSize = MAX_REPLY_SZ;
 
@@ -6086,7 +6109,7 @@ static BOOL GetSupportedVideoQualityCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clien
         // {RPL_CMD&0& (1&100&)}
         snprintf(respStringPtr, respStringSize, "%c%s%c%d%c%c%d%c%d%c%c%c",
                  SOM, headerReq[RPL_CMD], FSP, cmdResp, FSP, SOI, 1, FSP, maxVideoQlty, FSP, EOI, EOM);
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], strlen(&replyMsg[clientCbType][0]), MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, strlen(pCmdReplyMsg), MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -6413,7 +6436,7 @@ static BOOL GetOtherSupportedFeaturesCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clie
     NET_CMD_STATUS_e 			cmdResp = CMD_SUCCESS;
     UINT8						camIndex;
     UINT64 						tempData;
-    CHARPTR						respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR						respStringPtr = pCmdReplyMsg;
     CAMERA_CAPABILTY_INFO_t 	camCapability;
     const UINT32                respStringSize = MAX_REPLY_SZ;
 
@@ -6441,7 +6464,7 @@ static BOOL GetOtherSupportedFeaturesCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clie
                     camCapability.loiteringSupport, FSP, camCapability.objectCounting, FSP,
                     camCapability.noMotionDetectionSupport, FSP, EOI, EOM);
 
-            sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], strlen(&replyMsg[clientCbType][0]), MESSAGE_REPLY_TIMEOUT);
+            sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, strlen(pCmdReplyMsg), MESSAGE_REPLY_TIMEOUT);
             closeConnCb[clientCbType](&clientSocket);
             return SUCCESS;
         }
@@ -6548,13 +6571,13 @@ static BOOL CheckUserCameraPrivilegeCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clien
         camIndex = (UINT8)GET_CAMERA_INDEX(tempData);
         ReadSingleStreamConfig(camIndex, &streamCfg);
 
-        snprintf(&replyMsg[clientCbType][0], respStringSize, "%c%s%c%d%c%c%d%c%d%c%d%c%d%c%c%c", SOM,
+        snprintf(pCmdReplyMsg, respStringSize, "%c%s%c%d%c%c%d%c%d%c%d%c%d%c%c%c", SOM,
                 headerReq[RPL_CMD], FSP, CMD_SUCCESS, FSP, SOI, 1, FSP,
                 userAccountConfig.userPrivilege[camIndex].privilegeBitField.monitor, FSP,
                 userAccountConfig.userPrivilege[camIndex].privilegeBitField.audio, FSP,
                 streamCfg.enableAudio, FSP, EOI, EOM);
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], strlen(&replyMsg[clientCbType][0]), MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, strlen(pCmdReplyMsg), MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
     }
     else
@@ -6577,7 +6600,7 @@ static BOOL GetAdvanceStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType,
 {
     NET_INTERFACE_LOAD_PARAM_t	netIfLoad;
     LAN_CONFIG_t				networkInfo = {0};
-    CHARPTR						pRespStr = &replyMsg[clientCbType][0];
+    CHARPTR						pRespStr = pCmdReplyMsg;
     UINT8						portType, majorIdx;
     UINT32						outLen;
     UINT64 						timeTakeToFullVolume = 0;
@@ -6731,7 +6754,7 @@ static BOOL GetAdvanceStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType,
     }
 
     outLen += snprintf(pRespStr + outLen, respStrLen - outLen, "%c%c", EOI, EOM);
-    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
     closeConnCb[clientCbType](&clientSocket);
     return SUCCESS;
 }
@@ -6749,7 +6772,7 @@ static BOOL GetAdvanceCameraStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientC
 {
     UINT8           fps[MAX_STREAM][MAX_CAMERA_CONFIG];
     UINT8           gop[MAX_STREAM][MAX_CAMERA_CONFIG];
-    CHARPTR         respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR         respStringPtr = pCmdReplyMsg;
     UINT8           cameraIndex;
     UINT32          outLen;
     VIDEO_TYPE_e    streamType;
@@ -6821,7 +6844,7 @@ static BOOL GetAdvanceCameraStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientC
     }
 
     outLen += snprintf(respStringPtr + outLen, respStringSize - outLen, "%c%c", EOI, EOM);
-    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
     closeConnCb[clientCbType](&clientSocket);
     return SUCCESS;
 }
@@ -6837,7 +6860,7 @@ static BOOL GetAdvanceCameraStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientC
  */
 static BOOL GetCosecVideoPopUpDetailCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT32 clientSocket, UINT8 sessionIndex)
 {
-    CHARPTR         respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR         respStringPtr = pCmdReplyMsg;
     time_t          dateTimeSec = cosecInfoVideoPopup.dateTimeSec;
     struct tm       brokenTime = { 0 };
     const UINT32    respStringSize = MAX_REPLY_SZ;
@@ -6852,7 +6875,7 @@ static BOOL GetCosecVideoPopUpDetailCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clien
              FSP, cosecInfoVideoPopup.eventCode, FSP, cosecInfoVideoPopup.doorName, FSP, cosecInfoVideoPopup.doorDid,
              FSP, brokenTime.tm_mday, GetMonthName(brokenTime.tm_mon), brokenTime.tm_year,
              FSP, brokenTime.tm_hour, brokenTime.tm_min, brokenTime.tm_sec, FSP, EOI, EOM);
-    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], strlen(&replyMsg[clientCbType][0]), MESSAGE_REPLY_TIMEOUT);
+    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, strlen(pCmdReplyMsg), MESSAGE_REPLY_TIMEOUT);
     closeConnCb[clientCbType](&clientSocket);
     return SUCCESS;
 }
@@ -7048,7 +7071,7 @@ static BOOL AddCamerasCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT32
         }
 
         /* Make initial Buffer */
-        outLen = snprintf(&replyMsg[clientCbType][0], MAX_REPLY_SZ, "%c%s%c%d%c%c%d%c%d%c%c%c",
+        outLen = snprintf(pCmdReplyMsg, MAX_REPLY_SZ, "%c%s%c%d%c%c%d%c%d%c%c%c",
                 SOM, headerReq[RPL_CMD], FSP, cmdResp, FSP, SOI, 1, FSP, GET_CAMERA_NO(freeCamIndex), FSP, EOI, EOM);
         if(outLen > MAX_REPLY_SZ)
         {
@@ -7057,7 +7080,7 @@ static BOOL AddCamerasCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT32
             break;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
 
         /* Adding entry in Event Log */
@@ -7111,8 +7134,11 @@ static void ciTestCamCb(UINT8 channelNo, NET_CMD_STATUS_e cmdStat, CHARPTR image
 {
     CHAR	respString[128];
     UINT16	outLen;
+    INT32   connFd;
 
-    if (testCamConnFd[channelNo] == INVALID_CONNECTION)
+    /* Slot of camera stays owned by this request till reply is sent and connection is closed */
+    connFd = __atomic_load_n(&testCamConnFd[channelNo], __ATOMIC_ACQUIRE);
+    if (connFd == INVALID_CONNECTION)
     {
         return;
     }
@@ -7132,21 +7158,22 @@ static void ciTestCamCb(UINT8 channelNo, NET_CMD_STATUS_e cmdStat, CHARPTR image
     respString[outLen++] = ((imageSize >> 24) & 0xFF);
     respString[outLen++] = FSP;
 
-    if (sendCmdCb[clientCbType](testCamConnFd[channelNo], (UINT8PTR)respString, outLen, MESSAGE_REPLY_TIMEOUT) == SUCCESS)
+    if (sendCmdCb[clientCbType](connFd, (UINT8PTR)respString, outLen, MESSAGE_REPLY_TIMEOUT) == SUCCESS)
     {
         if (cmdStat == CMD_SUCCESS)
         {
-            if (sendCmdCb[clientCbType](testCamConnFd[channelNo], (UINT8PTR)imageBuff, imageSize, MESSAGE_REPLY_TIMEOUT) == SUCCESS)
+            if (sendCmdCb[clientCbType](connFd, (UINT8PTR)imageBuff, imageSize, MESSAGE_REPLY_TIMEOUT) == SUCCESS)
             {
                 respString[0] = FSP;
                 respString[1] = EOI;
                 respString[2] = EOM;
-                sendCmdCb[clientCbType](testCamConnFd[channelNo], (UINT8PTR)respString, 3, MESSAGE_REPLY_TIMEOUT);
+                sendCmdCb[clientCbType](connFd, (UINT8PTR)respString, 3, MESSAGE_REPLY_TIMEOUT);
             }
         }
     }
 
-    closeConnCb[clientCbType](&testCamConnFd[channelNo]);
+    closeConnCb[clientCbType](&connFd);
+    __atomic_store_n(&testCamConnFd[channelNo], INVALID_CONNECTION, __ATOMIC_RELEASE);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -7164,6 +7191,7 @@ static BOOL TestCameraCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT32
     UINT64              tempData;
     UINT8               camIndex;
     UINT32              outLen;
+    INT32               freeConnFd = INVALID_CONNECTION;
     const UINT32        respStringSize = MAX_REPLY_SZ - 6;
 
     do
@@ -7174,26 +7202,26 @@ static BOOL TestCameraCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT32
             break;
         }
 
+        /* Commands run on worker threads, so only one request can take free slot of camera */
         camIndex = (UINT8)GET_CAMERA_INDEX(tempData);
-        if (testCamConnFd[camIndex] != INVALID_CONNECTION)
+        if (FALSE == __atomic_compare_exchange_n(&testCamConnFd[camIndex], &freeConnFd, clientSocket, FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
         {
             cmdResp = CMD_REQUEST_IN_PROGRESS;
             break;
         }
 
-        testCamConnFd[camIndex] = clientSocket;
         cmdResp = GetImage(camIndex, NULL, ciTestCamCb, clientCbType);
         if (cmdResp == CMD_SUCCESS)
         {
             return SUCCESS;
         }
 
-        testCamConnFd[camIndex] = INVALID_CONNECTION;
+        __atomic_store_n(&testCamConnFd[camIndex], INVALID_CONNECTION, __ATOMIC_RELEASE);
 
     }while(0);
 
     // Make initial Buffer
-    outLen = snprintf(&replyMsg[clientCbType][0], respStringSize, "%c%s%c%03d%c%c%d%c", SOM, headerReq[RPL_CMD], FSP, cmdResp, FSP, SOI, 1, FSP);
+    outLen = snprintf(pCmdReplyMsg, respStringSize, "%c%s%c%03d%c%c%d%c", SOM, headerReq[RPL_CMD], FSP, cmdResp, FSP, SOI, 1, FSP);
     if(outLen > respStringSize)
     {
         EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
@@ -7201,12 +7229,12 @@ static BOOL TestCameraCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT32
     }
 
     // Append 4 Byte Image Size
-    replyMsg[clientCbType][outLen++] = 0;
-    replyMsg[clientCbType][outLen++] = 0;
-    replyMsg[clientCbType][outLen++] = 0;
-    replyMsg[clientCbType][outLen++] = 0;
-    replyMsg[clientCbType][outLen++] = FSP;
-    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+    pCmdReplyMsg[outLen++] = 0;
+    pCmdReplyMsg[outLen++] = 0;
+    pCmdReplyMsg[outLen++] = 0;
+    pCmdReplyMsg[outLen++] = 0;
+    pCmdReplyMsg[outLen++] = FSP;
+    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
     closeConnCb[clientCbType](&clientSocket);
     return SUCCESS;
 }
@@ -7714,7 +7742,7 @@ static BOOL GetCameraMobileNumberCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCb
     NET_CMD_STATUS_e		cmdResp = CMD_SUCCESS;
     UINT64 					tempData[MAX_GET_MOB_NUM_ARG];
     CAMERA_CONFIG_t			camConfig;
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     UINT32					outLen;
     const UINT32            respStringSize = MAX_REPLY_SZ;
 
@@ -7767,7 +7795,7 @@ static BOOL GetCameraUserDetailCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTy
     CHAR					brandNameStr[MAX_BRAND_NAME_LEN];
     CHAR					username[MAX_CAMERADETAIL_USERNAME_WIDTH];
     CHAR					password[MAX_CAMERADETAIL_PASSWORD_WIDTH];
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     USER_ACCOUNT_CONFIG_t 	userAccountConfig;
     UINT32					outLen;
     const UINT32            respStringSize = MAX_REPLY_SZ;
@@ -7825,7 +7853,7 @@ static BOOL GetCameraUserDetailCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTy
             outLen = respStringSize;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -7847,13 +7875,13 @@ static BOOL GetCameraUserDetailCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTy
 static BOOL GetSystemBuildDateCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT32 clientSocket, UINT8 sessionIndex)
 {
     NET_CMD_STATUS_e		cmdResp = CMD_SUCCESS;
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     UINT32					outLen;
 
     outLen = snprintf(respStringPtr, MAX_REPLY_SZ, "%c%s%c%d%c%c%d%c%s%c%c%c",
                       SOM, headerReq[RPL_CMD], FSP, cmdResp, FSP, SOI, 1, FSP, GetBuildDateTimeStr(), FSP, EOI, EOM);
 
-    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
     closeConnCb[clientCbType](&clientSocket);
     return SUCCESS;
 }
@@ -7876,7 +7904,7 @@ static BOOL GetCameraInfoCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, IN
     UINT8				    index = 1;
     UINT32					outLen;
     CHAR 					ipAddress[MAX_CAMERA_ADDRESS_WIDTH];
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     const UINT32            respStringSize = MAX_REPLY_SZ;
 
     // Read User Config For Rights
@@ -8330,7 +8358,7 @@ static BOOL GetPtzTourStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType,
     UINT64          cameraNumber;
     BOOL            tourStatus;
     UINT32          outLen = 0;
-    CHARPTR         respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR         respStringPtr = pCmdReplyMsg;
     const UINT32    respStringSize = MAX_REPLY_SZ;
 
     if(ParseStringGetVal(pCmdStr, &cameraNumber, 1, FSP) == SUCCESS)
@@ -8386,7 +8414,7 @@ static BOOL GetConfiguredCameraCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTy
     NET_CMD_STATUS_e		cmdResp = CMD_SUCCESS;
     IP_CAMERA_CONFIG_t		ipCameraCfg[MAX_CAMERA];
     UINT32					outLen = 0;
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     const UINT32            respStringSize = MAX_REPLY_SZ;
 
     ReadIpCameraConfig(ipCameraCfg);
@@ -8526,7 +8554,7 @@ static BOOL GetAcquiredCameraListCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCb
     IP_CAM_SEARCH_RESULT_t	searchResult[MAX_CAM_SEARCH_IN_ONE_SHOT];
     UINT8					resultCnt = 0, index = 0;
     UINT32					outLen = 0;
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     const UINT32            respStringSize = MAX_REPLY_SZ;
     CHARPTR                 ipv6Addr;
 
@@ -8599,9 +8627,9 @@ static BOOL GetAcquiredCameraListCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCb
 static BOOL GetCpuLoadCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT32 clientSocket, UINT8 sessionIndex)
 {
     // Make initial Buffer
-    UINT32 outLen = snprintf(&replyMsg[clientCbType][0], MAX_REPLY_SZ, "%c%s%c%d%c%c%d%c%d%c%c%c",
+    UINT32 outLen = snprintf(pCmdReplyMsg, MAX_REPLY_SZ, "%c%s%c%d%c%c%d%c%d%c%c%c",
             SOM, headerReq[RPL_CMD], FSP, CMD_SUCCESS, FSP, SOI, 1, FSP, GetCurrCpuUsage(), FSP, EOI, EOM);
-    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], outLen, MESSAGE_REPLY_TIMEOUT);
+    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
     closeConnCb[clientCbType](&clientSocket);
     return SUCCESS;
 }
@@ -8621,7 +8649,7 @@ static BOOL GetUserRightsCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, IN
     UINT8					cameraIndex;
     USER_ACCOUNT_CONFIG_t 	userAccountConfig;
     UINT32 					sizeWritten, resStringSize = MAX_REPLY_SZ;
-    CHARPTR 				resStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR 				resStringPtr = pCmdReplyMsg;
 
     do
     {
@@ -8659,7 +8687,7 @@ static BOOL GetUserRightsCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, IN
             break;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], strlen(&replyMsg[clientCbType][0]), MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, strlen(pCmdReplyMsg), MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -8683,7 +8711,7 @@ static BOOL GetRegionalSettingsCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTy
     NET_CMD_STATUS_e 		cmdResp = CMD_SUCCESS;
     USER_ACCOUNT_CONFIG_t 	userAccountConfig;
     UINT32 					sizeWritten, resStringSize = MAX_REPLY_SZ;
-    CHARPTR 				resStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR 				resStringPtr = pCmdReplyMsg;
     UINT64 					tempData;
 
     do
@@ -8731,7 +8759,7 @@ static BOOL GetRegionalSettingsCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbTy
             break;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], strlen(&replyMsg[clientCbType][0]), MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, strlen(pCmdReplyMsg), MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -8815,7 +8843,7 @@ static BOOL ReceiveLayoutFileCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType
         }
         fclose(fp);
 
-        resStringPtr  = &replyMsg[clientCbType][0];
+        resStringPtr  = pCmdReplyMsg;
         resStringSize = MAX_REPLY_SZ;
         sizeWritten = snprintf(resStringPtr, resStringSize, "%c%s%c%d%c%c%d%c", SOM, headerReq[RPL_CMD], FSP, cmdResp,FSP, SOI, 1, FSP);
         if(sizeWritten >= resStringSize)
@@ -8840,7 +8868,7 @@ static BOOL ReceiveLayoutFileCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType
             break;
         }
 
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], strlen(&replyMsg[clientCbType][0]), MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, strlen(pCmdReplyMsg), MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -8864,7 +8892,7 @@ static BOOL AutoConfigStatusReportCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientC
     AUTO_CONFIG_STATUS_LIST_t   *autoConfigStatusList;
     UINT8                       index;
     UINT32                      outLen;
-    CHARPTR                     respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR                     respStringPtr = pCmdReplyMsg;
     const UINT32                respStringSize = MAX_REPLY_SZ;
 
     autoConfigStatusList = GetAutoConfigStatusReportData(sessionIndex);
@@ -9124,7 +9152,7 @@ static BOOL GetCameraInitiatedListCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientC
     UINT8					index = 0;
     UINT8					resultCnt = 0;
     UINT32					outLen;
-    CHARPTR					respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR					respStringPtr = pCmdReplyMsg;
     const UINT32            respStringSize = MAX_REPLY_SZ;
 
     cmdResp = GetCamInitList(searchResult, &resultCnt);
@@ -9322,7 +9350,7 @@ static BOOL GetLanguageCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT3
 {
     UINT8           indexId = 0;
     UINT32          outLen;
-    CHARPTR         respStringPtr = &replyMsg[clientCbType][0];
+    CHARPTR         respStringPtr = pCmdReplyMsg;
     DIR             *dir;
     struct dirent   *entry;
     CHAR            languageList[MAX_LANGUAGE][MAX_LANGUAGE_FILE_NAME_LEN];
@@ -9409,10 +9437,10 @@ static BOOL GetUserLanguageCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType,
 
     /* Read user's configuration for current configured language */
     ReadSingleUserAccountConfig(GetUserAccountIndex(sessionIndex), &userAccountConfig);
-    outLen = snprintf(&replyMsg[clientCbType][0], MAX_REPLY_SZ, "%c%s%c%d%c%c%d%c%s%c%c%c",
+    outLen = snprintf(pCmdReplyMsg, MAX_REPLY_SZ, "%c%s%c%d%c%c%d%c%s%c%c%c",
                       SOM, headerReq[RPL_CMD], FSP, CMD_SUCCESS, FSP, SOI, 1, FSP, userAccountConfig.preferredLanguage, FSP, EOI, EOM);
 
-    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType], outLen, MESSAGE_REPLY_TIMEOUT);
+    sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
     closeConnCb[clientCbType](&clientSocket);
     return SUCCESS;
 }
@@ -9502,11 +9530,11 @@ static BOOL GetStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT32
         }
 
         /* Prepare response string */
-        outLen = snprintf(&replyMsg[clientCbType][0], MAX_REPLY_SZ, "%c%s%c%d%c%c%d%c%d%c%d%c%c%c",
+        outLen = snprintf(pCmdReplyMsg, MAX_REPLY_SZ, "%c%s%c%d%c%c%d%c%d%c%d%c%c%c",
                 SOM, headerReq[RPL_CMD], FSP, cmdResp, FSP, SOI, 1, FSP, reqStatusCmd, FSP, status, FSP, EOI, EOM);
 
         /* send reply to client */
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType], outLen, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -9594,7 +9622,7 @@ static BOOL GetDhcpLeaseCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT
 {
     UINT16                      leaseCnt;
     UINT16                      totalLeaseEntry;
-    CHARPTR                     pRespStr = &replyMsg[clientCbType][0];;
+    CHARPTR                     pRespStr = pCmdReplyMsg;;
     UINT32                      sizeWritten;
     DHCP_SERVER_LEASE_STATUS_t  leaseInfo[DHCP_SERVER_LEASE_CLIENT_MAX];
 
@@ -9639,7 +9667,7 @@ static BOOL GetDhcpLeaseCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT
         }
 
         /* Send positive reply to client */
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType], sizeWritten, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, sizeWritten, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -9729,7 +9757,7 @@ static BOOL GetCapabilityCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, IN
         }
 
         /* Prepare response string */
-        sizeWritten = snprintf(&replyMsg[clientCbType][0], MAX_REPLY_SZ, "%c%s%c%d%c%c%d%c%d%c%d%c%c%c",
+        sizeWritten = snprintf(pCmdReplyMsg, MAX_REPLY_SZ, "%c%s%c%d%c%c%d%c%d%c%d%c%c%c",
                 SOM, headerReq[RPL_CMD], FSP, cmdResp, FSP, SOI, 1, FSP, reqCapCmd, FSP, capability, FSP, EOI, EOM);
         if (sizeWritten >= MAX_REPLY_SZ)
         {
@@ -9738,7 +9766,7 @@ static BOOL GetCapabilityCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, IN
         }
 
         /* Send response string and close socket */
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType][0], sizeWritten, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, sizeWritten, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -9862,7 +9890,7 @@ static BOOL GetPushNotificationStatusCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clie
 static BOOL GetPushNotificationDevListCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT32 clientSocket, UINT8 sessionIndex)
 {
     UINT8                       deviceCnt;
-    CHARPTR                     pRespStr = &replyMsg[clientCbType][0];
+    CHARPTR                     pRespStr = pCmdReplyMsg;
     UINT32                      sizeWritten;
     PUSH_NOTIFY_DEVICE_STS_LIST_t deviceList[FCM_PUSH_NOTIFY_DEVICES_MAX];
 
@@ -9910,7 +9938,7 @@ static BOOL GetPushNotificationDevListCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e cli
         }
 
         /* Send positive reply to client */
-        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)&replyMsg[clientCbType], sizeWritten, MESSAGE_REPLY_TIMEOUT);
+        sendCmdCb[clientCbType](clientSocket, (UINT8PTR)pCmdReplyMsg, sizeWritten, MESSAGE_REPLY_TIMEOUT);
         closeConnCb[clientCbType](&clientSocket);
         return SUCCESS;
 
@@ -10025,7 +10053,7 @@ static BOOL TestEmailIdCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT3
 static BOOL GetPasswordResetInfoCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT32 clientSocket, UINT8 sessionIndex)
 {
     UINT32                      outLen;
-    CHARPTR                     pRespStr = &replyMsg[clientCbType][0];
+    CHARPTR                     pRespStr = pCmdReplyMsg;
     PASSWORD_RECOVERY_CONFIG_t 	pwdRecoveryCfg;
 
     do
@@ -10144,7 +10172,7 @@ static BOOL SetPasswordResetInfoCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbT
 static BOOL GetManualBackupLocationCmd(CHARPTR *pCmdStr, CLIENT_CB_TYPE_e clientCbType, INT32 clientSocket, UINT8 sessionIndex)
 {
     UINT32                      outLen;
-    CHARPTR                     pRespStr = &replyMsg[clientCbType][0];
+    CHARPTR                     pRespStr = pCmdReplyMsg;
     MANUAL_BACKUP_CONFIG_t      manualBackupCfg;
 
     do
@@ -63,6 +63,7 @@ extern const SEND_TO_SOCKET_CB sendCmdCb[CLIENT_CB_TYPE_MAX];
 
 /* Send frame data on socket */
 extern const SEND_TO_SOCKET_CB sendDataCb[CLIENT_CB_TYPE_MAX];
+extern const SEND_READY_CB sendDataReadyCb[CLIENT_CB_TYPE_MAX];
 extern const SEND_TO_CLIENT_CB sendClientDataCb[CLIENT_CB_TYPE_MAX];
 
 /* Close client socket */
@@ -80,12 +80,26 @@
 #define MAX_STORAGE_ALLOCATION_INDEX        1
 #define GET_MAX_INDEX(maxIdx, maxSubIdx)	(maxIdx * maxSubIdx)
 
-#define PRINT_INT(value) 	outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%d%c%u%c", OUR_TO_CLIENT_INDEX(fieldLoop), FVS, value, FSP);
-#define PRINT_INT64(value) 	outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%d%c%llu%c", OUR_TO_CLIENT_INDEX(fieldLoop), FVS, value, FSP);
-#define PRINT_CHAR(value) 	outLen += sprintf(respStringPtr + outLen, "%d%c%c%c", OUR_TO_CLIENT_INDEX(fieldLoop), FVS, value, FSP);
-#define PRINT_STRING(value) outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%d%c%s%c", OUR_TO_CLIENT_INDEX(fieldLoop), FVS, value, FSP);
-#define PRINT_TIME(value)	outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%d%c%02d%02d%c", OUR_TO_CLIENT_INDEX(fieldLoop), FVS, value.hour, value.minute, FSP);
-#define PRINT_EOI 			outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
+/* Space left in response buffer. Output is truncated (not overflowed) when buffer is full */
+#define RESP_SPACE_LEFT		((outLen < respStrLen) ? (respStrLen - outLen) : 0)
+#define PRINT_INT(value) 	outLen += snprintf(respStringPtr + outLen, RESP_SPACE_LEFT, "%d%c%u%c", OUR_TO_CLIENT_INDEX(fieldLoop), FVS, value, FSP);
+#define PRINT_INT64(value) 	outLen += snprintf(respStringPtr + outLen, RESP_SPACE_LEFT, "%d%c%llu%c", OUR_TO_CLIENT_INDEX(fieldLoop), FVS, value, FSP);
+#define PRINT_CHAR(value) 	outLen += snprintf(respStringPtr + outLen, RESP_SPACE_LEFT, "%d%c%c%c", OUR_TO_CLIENT_INDEX(fieldLoop), FVS, value, FSP);
+#define PRINT_STRING(value) outLen += snprintf(respStringPtr + outLen, RESP_SPACE_LEFT, "%d%c%s%c", OUR_TO_CLIENT_INDEX(fieldLoop), FVS, value, FSP);
+#define PRINT_TIME(value)	outLen += snprintf(respStringPtr + outLen, RESP_SPACE_LEFT, "%d%c%02d%02d%c", OUR_TO_CLIENT_INDEX(fieldLoop), FVS, value.hour, value.minute, FSP);
+#define PRINT_EOI 			outLen += snprintf(respStringPtr + outLen, RESP_SPACE_LEFT, "%c", EOI);
+
+/* Tables requested in one get config request */
+#define MAX_GET_CFG_TABLE_REQ               (MAX_TBL_CFG)
+
+/* Space kept free in reply for EOT, EOM and null. Table which reaches in it is taken as truncated */
+#define GET_CFG_REPLY_TAIL_LEN              (4)
+
+/* Native client receives get config reply in buffer of this size (MAX_RECEIVE_BUFFER_SIZE of GUI) */
+#define GET_CFG_NATIVE_REPLY_SZ             (128 * KILO_BYTE)
+
+/* Memory limit of composed table replies kept for repeated get config requests */
+#define GET_CFG_CACHE_SIZE_MAX              (1 * MEGA_BYTE)
 
 //#################################################################################################
 // @DATA TYPES
@@ -1007,6 +1021,30 @@ typedef enum
 
 }STORAGE_ALLOCATION_CFG_FIELD_e;
 
+typedef struct
+{
+    UINT16  tableId;
+    UINT16  fromIndex;
+    UINT16  toIndex;
+    UINT16  fromField;
+    UINT16  toField;
+}GET_CFG_TABLE_REQ_t;
+
+typedef struct
+{
+    GET_CFG_TABLE_REQ_t tableReq;
+    UINT32              configVersion;
+    UINT32              textLen;
+    CHARPTR             pText;
+}GET_CFG_CACHE_ENTRY_t;
+
+typedef struct
+{
+    pthread_mutex_t         cacheLock;
+    UINT32                  cacheSize;
+    GET_CFG_CACHE_ENTRY_t   entry[MAX_TBL_CFG];
+}GET_CFG_CACHE_t;
+
 //#################################################################################################
 // @PROTOTYPE
 //#################################################################################################
@@ -1019,6 +1057,8 @@ static BOOL fillBitField(BOOL *array, UINT8 maxIdx, UINT64PTR bitField);
 //-------------------------------------------------------------------------------------------------
 static BOOL fillArrayFrmBitField(BOOL *array, UINT8 maxIdx, UINT64 bitField);
 //-------------------------------------------------------------------------------------------------
+static NET_CMD_STATUS_e getCfgTableReply(const GET_CFG_TABLE_REQ_t *pTableReq, CHARPTR respStr, const UINT32 respStrLen);
+//-------------------------------------------------------------------------------------------------
 static NET_CMD_STATUS_e getGeneralCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fromField, UINT16 toField, CHARPTR respStringPtr,  const UINT32 respStrLen);
 static NET_CMD_STATUS_e setGeneralCfg(CHARPTR *reqStr);
 static NET_CMD_STATUS_e defGeneralCfg(UINT16 fromIndex, UINT16 toIndex);
@@ -1585,12 +1625,83 @@ static NET_CMD_STATUS_e (*setCfgFuncPtr[MAX_TBL_CFG])(CHARPTR *reqStr) =
     setStorageAllocationCfg,        // tableId 62
 };
 
+/* Configuration from which reply of table is composed. Reply of table composed from runtime
+ * information is not cached, hence MAX_CONFIG_ID is given for such table */
+static const CONFIG_INDEX_e getCfgTableConfigId[MAX_TBL_CFG] =
+{
+    GENERAL_CONFIG_ID,              // tableId 01
+    DATE_TIME_CONFIG_ID,            // tableId 02
+    DST_CONFIG_ID,                  // tableId 03
+    MAX_CONFIG_ID,                  // tableId 04
+    MAX_CONFIG_ID,                  // tableId 05
+    MAX_CONFIG_ID,                  // tableId 06
+    IP_FILTER_CONFIG_ID,            // tableId 07
+    IP_FILTER_CONFIG_ID,            // tableId 08
+    DDNS_CONFIG_ID,                 // tableId 09
+    SMTP_CONFIG_ID,                 // tableId 10
+    FTP_UPLOAD_CONFIG_ID,           // tableId 11
+    TCP_NOTIFY_CONFIG_ID,           // tableId 12
+    FILE_ACCESS_CONFIG_ID,          // tableId 13
+    HDD_CONFIG_ID,                  // tableId 14
+    MATRIX_DNS_SERVER_CONFIG_ID,    // tableId 15
+    USER_ACCOUNT_CONFIG_ID,         // tableId 16
+    CAMERA_CONFIG_ID,               // tableId 17
+    STREAM_CONFIG_ID,               // tableId 18
+    SCHEDULE_RECORD_CONFIG_ID,      // tableId 19
+    SCHEDULE_RECORD_CONFIG_ID,      // tableId 20
+    ALARM_RECORD_CONFIG_ID,         // tableId 21
+    PTZ_PRESET_CONFIG_ID,           // tableId 22
+    PRESET_TOUR_CONFIG_ID,          // tableId 23
+    PRESET_TOUR_CONFIG_ID,          // tableId 24
+    TOUR_SCHEDULE_CONFIG_ID,        // tableId 25
+    SENSOR_CONFIG_ID,               // tableId 26
+    ALARM_CONFIG_ID,                // tableId 27
+    IMAGE_UPLOAD_CONFIG_ID,         // tableId 28
+    STORAGE_CONFIG_ID,              // tableId 29
+    SCHEDULE_BACKUP_CONFIG_ID,      // tableId 30
+    MANUAL_BACKUP_CONFIG_ID,        // tableId 31
+    CAMERA_EVENT_ACTION_CONFIG_ID,  // tableId 32
+    CAMERA_EVENT_ACTION_CONFIG_ID,  // tableId 33
+    SENSOR_EVENT_ACTION_CONFIG_ID,  // tableId 34
+    SENSOR_EVENT_ACTION_CONFIG_ID,  // tableId 35
+    SYSTEM_EVENT_ACTION_CONFIG_ID,  // tableId 36
+    COSEC_PRE_RECORD_SETTINGS,      // tableId 37
+    CAMERA_ALARM_CONFIG_ID,         // tableId 38
+    STATIC_ROUTING_CONFIG_ID,       // tableID 39
+    STATIC_ROUTING_CONFIG_ID,       // tableID 40
+    BROAD_BAND_CONFIG_ID,           // tableID 41
+    BROAD_BAND_CONFIG_ID,           // tableID 42
+    SMS_CONFIG_ID,                  // tableID 43
+    MANUAL_RECORD_CONFIG_ID,        // tableID 44
+    NETWORK_DRIVE_SETTINGS,         // tableID 45
+    IP_CAMERA_CONFIG_ID,            // tableID 46
+    MAX_CONFIG_ID,                  // tableID 47
+    MAX_CONFIG_ID,                  // tableID 48
+    MAX_CONFIG_ID,                  // tableID 49
+    MAX_CONFIG_ID,                  // tableID 50
+    NETWORK_DEVICES_CONFIG_ID,      // tableID 51
+    SNAPSHOT_CONFIG_ID,             // tableId 52
+    SNAPSHOT_SCHEDULE_CONFIG_ID,    // tableId 53
+    LOGIN_POLICY_CONFIG_ID,         // tableId 54
+    AUDIO_OUT_CONFIG_ID,            // tableId 55
+    P2P_CONFIG_ID,                  // tableId 56
+    IMG_SETTING_CONFIG_ID,          // tableId 57
+    DHCP_SERVER_CONFIG_ID,          // tableId 58
+    FIRMWARE_MANAGEMENT_CONFIG_ID,  // tableId 59
+    FCM_PUSH_NOTIFICATION_CONFIG_ID,// tableId 60
+    PASSWORD_RECOVERY_CONFIG_ID,    // tableId 61
+    STORAGE_ALLOCATION_CONFIG_ID,   // tableId 62
+};
+
 //#################################################################################################
 // @GLOBAL VARIABLES
 //#################################################################################################
 // This pointer is constant and used in evry require Table Index comparision
 static const UINT16 *const totalIndexPerEveryTable = (UINT16*)maxIndexPerTable;
 
+// Composed table replies of get config
+static GET_CFG_CACHE_t getCfgCache = { .cacheLock = PTHREAD_MUTEX_INITIALIZER };
+
 //#################################################################################################
 // @DEFINATION
 //#################################################################################################
@@ -1749,164 +1860,267 @@ BOOL fillArrayFrmBitField(BOOL *array, UINT8 maxIdx, UINT64 bitField)
  * @param   connFd
  * @param   callbackType
  * @return  SUCCESS/FAIL
+ * @note    All tables are parsed and validated before reply is composed. Whole reply is composed
+ *          before it is sent, hence status in header is always status of reply. For native TCP client,
+ *          reply which does not fit in reply buffer is composed in larger buffer of size which client
+ *          receives. Reply of table is taken from cache when its configuration is not changed after
+ *          reply was composed.
  */
 BOOL ProcessGetConfig(CHARPTR source, INT32 connFd, CLIENT_CB_TYPE_e callbackType)
 {
 	UINT64 				getCfgParam[MAX_GET_CMD_PARAM];
 	UINT32				outLen;
+    UINT32              tableStartLen = 0;
 	NET_CMD_STATUS_e	respStatus = CMD_SUCCESS;
     UINT32 				tableId = 0;
+    UINT16              tableCnt = 0;
+    UINT16              tableIdx;
+    UINT32              replySize = MAX_REPLY_SZ;
+    GET_CFG_TABLE_REQ_t tableReq[MAX_GET_CFG_TABLE_REQ];
     CHAR                replyMsg[MAX_REPLY_SZ];
+    CHARPTR             pReplyMsg = replyMsg;
 
-	// compose get configuration reply header SOM HEADER FSP
-    outLen = snprintf(replyMsg, MAX_REPLY_SZ, "%c%s%c", SOM, headerReq[RPL_CFG], FSP);
-    if(outLen > MAX_REPLY_SZ - 2)
+    // parse the source string till EOM is not reached
+    while ((source != NULL) && (*source != EOM))
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
-        outLen = MAX_REPLY_SZ - 2;
-    }
+        // check for the presence of SOT
+        if(*source != SOT)
+        {
+            respStatus = CMD_INVALID_SYNTAX;
+            break;
+        }
 
-	// check for the validation of input/output parameter
-	if (source != NULL)
-	{
-		// by default compose SUCCESS response
-        outLen += snprintf(replyMsg + outLen, MAX_REPLY_SZ - outLen, "%d%c", CMD_SUCCESS, FSP);
-        if(outLen > MAX_REPLY_SZ)
+        // start parsing source string for individual fields like tableId, from-to index, from-to field
+        source++;
+        if (ParseStringGetVal(&source, getCfgParam, MAX_GET_CMD_PARAM, FSP) == FAIL)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
-            outLen = MAX_REPLY_SZ;
+            respStatus = CMD_INVALID_SYNTAX;
+            break;
         }
 
-		// parse the source string till EOM is not reached
-		while(*source != EOM)
-		{
-			// check for the presence of SOT
-			if(*source != SOT)
-			{
-				respStatus = CMD_INVALID_SYNTAX;
-				break;
-			}
+        // check for the presence of EOT
+        if (*source != EOT)
+        {
+            respStatus = CMD_INVALID_SYNTAX;
+            break;
+        }
 
-            // start parsing source string for individual fields like tableId, from-to index, from-to field
-            source++;
-            if (ParseStringGetVal(&source, getCfgParam, MAX_GET_CMD_PARAM, FSP) == FAIL)
-            {
-                respStatus = CMD_INVALID_SYNTAX;
-                break;
-            }
+        // validate the converted tableId, indexId and fieldId and their range if any of validation fails, send appropriate error response
+        tableId = CLIENT_TO_OUR_INDEX(getCfgParam[GET_TABLE_ID]);
+        if ((tableId >= MAX_TBL_CFG) || (getCfgParam[GET_TABLE_ID] == 0))
+        {
+            respStatus = CMD_INVALID_TABLE_ID;
+            EPRINT(NETWORK_MANAGER, "invld table id: [tableId=%d]", tableId);
+            break;
+        }
 
-            // check for the presence of EOT
-            if (*source != EOT)
-            {
-                respStatus = CMD_INVALID_SYNTAX;
-                break;
-            }
+        if ((getCfgParam[GET_FROM_INDEX_ID] == 0) || (getCfgParam[GET_TO_INDEX_ID] == 0)
+                || (getCfgParam[GET_FROM_INDEX_ID] > (UINT64)totalIndexPerEveryTable[tableId])
+                || (getCfgParam[GET_TO_INDEX_ID] > (UINT64)totalIndexPerEveryTable[tableId])
+                || (getCfgParam[GET_FROM_INDEX_ID] > getCfgParam[GET_TO_INDEX_ID]))
+        {
+            respStatus = CMD_INVALID_INDEX_ID;
+            EPRINT(NETWORK_MANAGER, "invld index id: [tableId=%d], [fromIndex=%lld], [toIndex=%lld]",
+                   tableId, CLIENT_TO_OUR_INDEX(getCfgParam[GET_FROM_INDEX_ID]), CLIENT_TO_OUR_INDEX(getCfgParam[GET_TO_INDEX_ID]));
+            break;
+        }
 
-            // validate the converted tableId, indexId and fieldId and their range if any of validation fails, send appropriate error response
-            tableId = CLIENT_TO_OUR_INDEX(getCfgParam[GET_TABLE_ID]);
-            if ((tableId >= MAX_TBL_CFG) || (getCfgParam[GET_TABLE_ID] == 0))
-            {
-                respStatus = CMD_INVALID_TABLE_ID;
-                EPRINT(NETWORK_MANAGER, "invld table id: [tableId=%d]", tableId);
-                break;
-            }
+        if ((getCfgParam[GET_FROM_FIELD_ID] == 0) || (getCfgParam[GET_TO_FIELD_ID] == 0)
+                || (getCfgParam[GET_FROM_FIELD_ID] > maxFieldPerTable[tableId])
+                || (getCfgParam[GET_TO_FIELD_ID] > maxFieldPerTable[tableId])
+                || (getCfgParam[GET_FROM_FIELD_ID] > getCfgParam[GET_TO_FIELD_ID]))
+        {
+            respStatus = CMD_INVALID_FIELD_ID;
+            EPRINT(NETWORK_MANAGER, "invld field id: [tableId=%d], [fromField=%lld], [toField=%lld]",
+                   tableId, CLIENT_TO_OUR_INDEX(getCfgParam[GET_FROM_FIELD_ID]), CLIENT_TO_OUR_INDEX(getCfgParam[GET_TO_FIELD_ID]));
+            break;
+        }
 
-            if ((getCfgParam[GET_FROM_INDEX_ID] == 0) || (getCfgParam[GET_TO_INDEX_ID] == 0)
-                    || (getCfgParam[GET_FROM_INDEX_ID] > (UINT64)totalIndexPerEveryTable[tableId])
-                    || (getCfgParam[GET_TO_INDEX_ID] > (UINT64)totalIndexPerEveryTable[tableId])
-                    || (getCfgParam[GET_FROM_INDEX_ID] > getCfgParam[GET_TO_INDEX_ID]))
-            {
-                respStatus = CMD_INVALID_INDEX_ID;
-                EPRINT(NETWORK_MANAGER, "invld index id: [tableId=%d], [fromIndex=%lld], [toIndex=%lld]",
-                       tableId, CLIENT_TO_OUR_INDEX(getCfgParam[GET_FROM_INDEX_ID]), CLIENT_TO_OUR_INDEX(getCfgParam[GET_TO_INDEX_ID]));
-                break;
-            }
+        if (getCfgFuncPtr[tableId] == NULL)
+        {
+            respStatus = CMD_PROCESS_ERROR;
+            break;
+        }
 
-            if ((getCfgParam[GET_FROM_FIELD_ID] == 0) || (getCfgParam[GET_TO_FIELD_ID] == 0)
-                    || (getCfgParam[GET_FROM_FIELD_ID] > maxFieldPerTable[tableId])
-                    || (getCfgParam[GET_TO_FIELD_ID] > maxFieldPerTable[tableId])
-                    || (getCfgParam[GET_FROM_FIELD_ID] > getCfgParam[GET_TO_FIELD_ID]))
-            {
-                respStatus = CMD_INVALID_FIELD_ID;
-                EPRINT(NETWORK_MANAGER, "invld field id: [tableId=%d], [fromField=%lld], [toField=%lld]",
-                       tableId, CLIENT_TO_OUR_INDEX(getCfgParam[GET_FROM_FIELD_ID]), CLIENT_TO_OUR_INDEX(getCfgParam[GET_TO_FIELD_ID]));
-                break;
-            }
+        if (tableCnt >= MAX_GET_CFG_TABLE_REQ)
+        {
+            respStatus = CMD_RESOURCE_LIMIT;
+            EPRINT(NETWORK_MANAGER, "too many tables in request: [tableCnt=%d]", tableCnt);
+            break;
+        }
 
-            // Adjust index
-            getCfgParam[GET_TABLE_ID] = tableId;
-            getCfgParam[GET_FROM_INDEX_ID] = CLIENT_TO_OUR_INDEX(getCfgParam[GET_FROM_INDEX_ID]);
-            getCfgParam[GET_TO_INDEX_ID] = CLIENT_TO_OUR_INDEX(getCfgParam[GET_TO_INDEX_ID]);
-            getCfgParam[GET_FROM_FIELD_ID] = CLIENT_TO_OUR_INDEX(getCfgParam[GET_FROM_FIELD_ID]);
-            getCfgParam[GET_TO_FIELD_ID] = CLIENT_TO_OUR_INDEX(getCfgParam[GET_TO_FIELD_ID]);
+        // Adjust index
+        tableReq[tableCnt].tableId = tableId;
+        tableReq[tableCnt].fromIndex = CLIENT_TO_OUR_INDEX(getCfgParam[GET_FROM_INDEX_ID]);
+        tableReq[tableCnt].toIndex = CLIENT_TO_OUR_INDEX(getCfgParam[GET_TO_INDEX_ID]);
+        tableReq[tableCnt].fromField = CLIENT_TO_OUR_INDEX(getCfgParam[GET_FROM_FIELD_ID]);
+        tableReq[tableCnt].toField = CLIENT_TO_OUR_INDEX(getCfgParam[GET_TO_FIELD_ID]);
 
-            DPRINT(NETWORK_MANAGER, "[table=%lld], [index=%lld -> %lld], [field=%lld -> %lld]",
-                   getCfgParam[GET_TABLE_ID], getCfgParam[GET_FROM_INDEX_ID],
-                   getCfgParam[GET_TO_INDEX_ID], getCfgParam[GET_FROM_FIELD_ID], getCfgParam[GET_TO_FIELD_ID]);
+        DPRINT(NETWORK_MANAGER, "[table=%d], [index=%d -> %d], [field=%d -> %d]", tableReq[tableCnt].tableId,
+               tableReq[tableCnt].fromIndex, tableReq[tableCnt].toIndex, tableReq[tableCnt].fromField, tableReq[tableCnt].toField);
+        tableCnt++;
 
-            // append SOT and tableId at beginning of single table response
-            outLen += snprintf(replyMsg + outLen, MAX_REPLY_SZ - outLen, "%c%d%c", SOT, (UINT32)(getCfgParam[GET_TABLE_ID] + 1), FSP);
-            if(outLen > MAX_REPLY_SZ)
-            {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
-                outLen = MAX_REPLY_SZ;
-                break;
-            }
+        // increment source pointer to next table request, if any, or EOM
+        source++;
+    }
 
-            if (getCfgFuncPtr[getCfgParam[GET_TABLE_ID]] == NULL)
-            {
-                respStatus = CMD_PROCESS_ERROR;
-                break;
-            }
+	// compose get configuration reply header SOM HEADER FSP
+    outLen = snprintf(pReplyMsg, replySize, "%c%s%c", SOM, headerReq[RPL_CFG], FSP);
 
-            respStatus = getCfgFuncPtr[getCfgParam[GET_TABLE_ID]](getCfgParam[GET_FROM_INDEX_ID], getCfgParam[GET_TO_INDEX_ID],
-                                                                  getCfgParam[GET_FROM_FIELD_ID], getCfgParam[GET_TO_FIELD_ID],
-                                                                  (replyMsg + outLen), MAX_REPLY_SZ - outLen);
+	// by default compose SUCCESS response
+    if ((source != NULL) && (respStatus == CMD_SUCCESS))
+    {
+        outLen += snprintf(pReplyMsg + outLen, replySize - outLen, "%d%c", CMD_SUCCESS, FSP);
+    }
+
+    for (tableIdx = 0; (tableIdx < tableCnt) && (respStatus == CMD_SUCCESS); tableIdx++)
+    {
+        tableStartLen = outLen;
+        while (TRUE)
+        {
+            // append SOT and tableId at beginning of single table response
+            outLen = tableStartLen + snprintf(pReplyMsg + tableStartLen, replySize - tableStartLen, "%c%d%c", SOT, tableReq[tableIdx].tableId + 1, FSP);
+            respStatus = getCfgTableReply(&tableReq[tableIdx], (pReplyMsg + outLen), replySize - outLen);
             if (respStatus != CMD_SUCCESS)
             {
                 // Error occurred in constructing response
                 break;
             }
 
-            outLen = strlen(replyMsg);
-            if(outLen > MAX_REPLY_SZ - 2)
+            // Only response of this table is scanned for its length
+            outLen += strlen(pReplyMsg + outLen);
+            if (outLen < (replySize - GET_CFG_REPLY_TAIL_LEN))
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
-                outLen = MAX_REPLY_SZ - 2;
+                // append EOT at the end of single table response
+                pReplyMsg[outLen++] = EOT;
+                pReplyMsg[outLen] = '\0';
                 break;
             }
 
-            // append EOT at the end of single table response
-            outLen += snprintf(replyMsg + outLen, MAX_REPLY_SZ - outLen, "%c", EOT);
+            // Table does not fit in reply buffer. Native client can receive larger reply, hence compose table again in larger buffer
+            if ((callbackType != CLIENT_CB_TYPE_NATIVE) || (pReplyMsg != replyMsg)
+                    || ((pReplyMsg = malloc(GET_CFG_NATIVE_REPLY_SZ)) == NULL))
+            {
+                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [tableId=%d], [outLen=%d]", tableReq[tableIdx].tableId, outLen);
+                respStatus = CMD_RESOURCE_LIMIT;
+                break;
+            }
 
-            // increment source pointer to next table request, if any, or EOM
-            source++;
-		}
-	}
+            memcpy(pReplyMsg, replyMsg, tableStartLen);
+            replySize = GET_CFG_NATIVE_REPLY_SZ;
+        }
+    }
 
+    // Nothing is sent before all tables are composed, hence error is always given in header of reply
 	if (respStatus != CMD_SUCCESS)
 	{
-        outLen = snprintf(replyMsg, MAX_REPLY_SZ, "%c%s%c%d%c", SOM, headerReq[RPL_CFG], FSP, respStatus, FSP);
+        if (pReplyMsg != replyMsg)
+        {
+            free(pReplyMsg);
+            pReplyMsg = replyMsg;
+            replySize = MAX_REPLY_SZ;
+        }
+
+        outLen = snprintf(pReplyMsg, replySize, "%c%s%c%d%c", SOM, headerReq[RPL_CFG], FSP, respStatus, FSP);
 	}
 
-    if(outLen > MAX_REPLY_SZ - 2)
+	// append EOM at end the string, and send it to client
+    outLen += snprintf(pReplyMsg + outLen, replySize - outLen, "%c", EOM);
+
+	// send reply to client
+    sendCmdCb[callbackType](connFd, (UINT8PTR)pReplyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
+    if (pReplyMsg != replyMsg)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
-        outLen = MAX_REPLY_SZ - 2;
+        free(pReplyMsg);
     }
+    return SUCCESS;
+}
 
-	// append EOM at end the string, and send it to client
-    outLen += snprintf(replyMsg + outLen, MAX_REPLY_SZ - outLen, "%c", EOM);
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function composes reply of single table of get config. Reply composed from configuration
+ *          is cached with version of configuration. Cached reply is given till configuration is changed,
+ *          as every configuration write changes its version.
+ * @param   pTableReq
+ * @param   respStr
+ * @param   respStrLen
+ * @return  Status of reply
+ * @note    Reply is cached only when it fits in given buffer. Cached reply which does not fit in given
+ *          buffer is given truncated as table function gives it. Version is read before configuration is
+ *          read by table function, hence cached reply is never older than its version.
+ */
+static NET_CMD_STATUS_e getCfgTableReply(const GET_CFG_TABLE_REQ_t *pTableReq, CHARPTR respStr, const UINT32 respStrLen)
+{
+    CONFIG_INDEX_e          configId = getCfgTableConfigId[pTableReq->tableId];
+    UINT32                  configVersion;
+    UINT32                  textLen;
+    CHARPTR                 pText;
+    NET_CMD_STATUS_e        respStatus;
+    GET_CFG_CACHE_ENTRY_t   *pEntry = &getCfgCache.entry[pTableReq->tableId];
 
-    if(outLen > MAX_REPLY_SZ)
+    if ((configId >= MAX_CONFIG_ID) || (respStrLen <= GET_CFG_REPLY_TAIL_LEN))
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
-        outLen = MAX_REPLY_SZ;
+        return getCfgFuncPtr[pTableReq->tableId](pTableReq->fromIndex, pTableReq->toIndex,
+                                                 pTableReq->fromField, pTableReq->toField, respStr, respStrLen);
     }
 
-	// send reply to client
-    sendCmdCb[callbackType](connFd, (UINT8PTR)replyMsg, outLen, MESSAGE_REPLY_TIMEOUT);
-    return SUCCESS;
+    configVersion = GetConfigVersion(configId);
+
+    MUTEX_LOCK(getCfgCache.cacheLock);
+    if ((pEntry->pText != NULL) && (pEntry->configVersion == configVersion)
+            && (memcmp(&pEntry->tableReq, pTableReq, sizeof(GET_CFG_TABLE_REQ_t)) == 0))
+    {
+        if (pEntry->textLen < (respStrLen - GET_CFG_REPLY_TAIL_LEN))
+        {
+            memcpy(respStr, pEntry->pText, pEntry->textLen + 1);
+        }
+        else
+        {
+            // Caller takes reply which reaches in tail as truncated and composes table again in next part
+            memcpy(respStr, pEntry->pText, respStrLen - 1);
+            respStr[respStrLen - 1] = '\0';
+        }
+        MUTEX_UNLOCK(getCfgCache.cacheLock);
+        return CMD_SUCCESS;
+    }
+    MUTEX_UNLOCK(getCfgCache.cacheLock);
+
+    respStatus = getCfgFuncPtr[pTableReq->tableId](pTableReq->fromIndex, pTableReq->toIndex,
+                                                   pTableReq->fromField, pTableReq->toField, respStr, respStrLen);
+    if (respStatus != CMD_SUCCESS)
+    {
+        return respStatus;
+    }
+
+    // Truncated reply is not cached
+    textLen = strlen(respStr);
+    if (textLen >= (respStrLen - GET_CFG_REPLY_TAIL_LEN))
+    {
+        return CMD_SUCCESS;
+    }
+
+    MUTEX_LOCK(getCfgCache.cacheLock);
+    if (pEntry->pText != NULL)
+    {
+        getCfgCache.cacheSize -= (pEntry->textLen + 1);
+        FREE_MEMORY(pEntry->pText);
+    }
+
+    if ((getCfgCache.cacheSize + textLen + 1) <= GET_CFG_CACHE_SIZE_MAX)
+    {
+        pText = malloc(textLen + 1);
+        if (pText != NULL)
+        {
+            memcpy(pText, respStr, textLen + 1);
+            pEntry->tableReq = *pTableReq;
+            pEntry->configVersion = configVersion;
+            pEntry->textLen = textLen;
+            pEntry->pText = pText;
+            getCfgCache.cacheSize += (textLen + 1);
+        }
+    }
+    MUTEX_UNLOCK(getCfgCache.cacheLock);
+    return CMD_SUCCESS;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -2099,7 +2313,7 @@ static NET_CMD_STATUS_e getGeneralCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 f
 {
 	UINT16				fieldLoop;
 	GENERAL_CONFIG_t 	generalCfg;
-    UINT16				outLen;
+    UINT32				outLen;
 
 	ReadGeneralConfig(&generalCfg);
 
@@ -2107,7 +2321,7 @@ static NET_CMD_STATUS_e getGeneralCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 f
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -2334,7 +2548,7 @@ static NET_CMD_STATUS_e getGeneralCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 f
         //Validate buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -2371,7 +2585,7 @@ static NET_CMD_STATUS_e setGeneralCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_GENERAL_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_GENERAL_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -2668,7 +2882,7 @@ static NET_CMD_STATUS_e getDateTimeCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
 {
 	UINT16				fieldLoop;
 	DATE_TIME_CONFIG_t 	dateTimeCfg;
-    UINT16				outLen;
+    UINT32				outLen;
 
 	ReadDateTimeConfig(&dateTimeCfg);
 
@@ -2676,7 +2890,7 @@ static NET_CMD_STATUS_e getDateTimeCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -2723,7 +2937,7 @@ static NET_CMD_STATUS_e getDateTimeCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -2763,7 +2977,7 @@ static NET_CMD_STATUS_e setDateTimeCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_DATE_TIME_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_DATE_TIME_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -2867,7 +3081,7 @@ static NET_CMD_STATUS_e getDstCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fromF
 {
     UINT16          fieldLoop;
     DST_CONFIG_t    dstCfg;
-    UINT16          outLen;
+    UINT32          outLen;
 
 	ReadDstConfig(&dstCfg);
 
@@ -2875,7 +3089,7 @@ static NET_CMD_STATUS_e getDstCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fromF
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -2930,7 +3144,7 @@ static NET_CMD_STATUS_e getDstCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fromF
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -2970,7 +3184,7 @@ static NET_CMD_STATUS_e setDstCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_DST_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_DST_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -3089,7 +3303,7 @@ static NET_CMD_STATUS_e getLan1Cfg(UINT16 fromIndex, UINT16 toIndex, UINT16 from
 {
     UINT16          fieldLoop;
     LAN_CONFIG_t    lan1Cfg = { 0 };
-    UINT16          outLen;
+    UINT32          outLen;
 
     if(SUCCESS != ReadLan1ConfigCms(&lan1Cfg))
     {
@@ -3100,7 +3314,7 @@ static NET_CMD_STATUS_e getLan1Cfg(UINT16 fromIndex, UINT16 toIndex, UINT16 from
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -3182,7 +3396,7 @@ static NET_CMD_STATUS_e getLan1Cfg(UINT16 fromIndex, UINT16 toIndex, UINT16 from
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -3222,7 +3436,7 @@ static NET_CMD_STATUS_e setLan1Cfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_LAN1_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_LAN1_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -3362,7 +3576,7 @@ static NET_CMD_STATUS_e getLan2Cfg(UINT16 fromIndex, UINT16 toIndex, UINT16 from
 {
     UINT16          fieldLoop;
     LAN_CONFIG_t    lan2Cfg = {0};
-    UINT16          outLen;
+    UINT32          outLen;
 
     ReadLan2ConfigCms(&lan2Cfg);
 
@@ -3370,7 +3584,7 @@ static NET_CMD_STATUS_e getLan2Cfg(UINT16 fromIndex, UINT16 toIndex, UINT16 from
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -3413,7 +3627,7 @@ static NET_CMD_STATUS_e getLan2Cfg(UINT16 fromIndex, UINT16 toIndex, UINT16 from
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -3453,7 +3667,7 @@ static NET_CMD_STATUS_e setLan2Cfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_LAN2_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_LAN2_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -3549,7 +3763,7 @@ static NET_CMD_STATUS_e getIPFilterEnableCfg(UINT16 fromIndex, UINT16 toIndex, U
 {
 	UINT16				fieldLoop;
 	IP_FILTER_CONFIG_t	ipFilterCfg;
-    UINT16				outLen;
+    UINT32				outLen;
 
     ReadIpFilterConfig(&ipFilterCfg);
 
@@ -3557,7 +3771,7 @@ static NET_CMD_STATUS_e getIPFilterEnableCfg(UINT16 fromIndex, UINT16 toIndex, U
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -3580,7 +3794,7 @@ static NET_CMD_STATUS_e getIPFilterEnableCfg(UINT16 fromIndex, UINT16 toIndex, U
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -3620,7 +3834,7 @@ static NET_CMD_STATUS_e setIPFilterEnableCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_IP_FILTER_ENABLE_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_IP_FILTER_ENABLE_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -3694,7 +3908,7 @@ static NET_CMD_STATUS_e getIPFilterCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
 	UINT16				fieldLoop;
 	UINT16				indexLoop;
 	IP_FILTER_CONFIG_t	ipFilterCfg;
-	UINT16				outLen = 0;
+	UINT32				outLen = 0;
 
 	ReadIpFilterConfig(&ipFilterCfg);
 	for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -3703,7 +3917,7 @@ static NET_CMD_STATUS_e getIPFilterCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -3726,7 +3940,7 @@ static NET_CMD_STATUS_e getIPFilterCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -3737,7 +3951,7 @@ static NET_CMD_STATUS_e getIPFilterCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         //Validate Buffer size
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -3777,7 +3991,7 @@ static NET_CMD_STATUS_e setIPFilterCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_IP_FILTER_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_IP_FILTER_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -3853,7 +4067,7 @@ static NET_CMD_STATUS_e getDdnsCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 from
 {
 	UINT16				fieldLoop;
 	DDNS_CONFIG_t		ddnsCfg;
-    UINT16				outLen;
+    UINT32				outLen;
 
 	ReadDdnsConfig(&ddnsCfg);
 
@@ -3861,7 +4075,7 @@ static NET_CMD_STATUS_e getDdnsCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 from
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -3900,7 +4114,7 @@ static NET_CMD_STATUS_e getDdnsCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 from
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -3940,7 +4154,7 @@ static NET_CMD_STATUS_e setDdnsCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_DDNS_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_DDNS_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -4033,7 +4247,7 @@ static NET_CMD_STATUS_e getSmtpCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 from
 {
     UINT16          fieldLoop;
     SMTP_CONFIG_t   smtpCfg;
-    UINT16          outLen;
+    UINT32          outLen;
 
 	ReadSmtpConfig(&smtpCfg);
 
@@ -4041,7 +4255,7 @@ static NET_CMD_STATUS_e getSmtpCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 from
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -4084,7 +4298,7 @@ static NET_CMD_STATUS_e getSmtpCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 from
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -4124,7 +4338,7 @@ static NET_CMD_STATUS_e setSmtpCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_SMTP_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_SMTP_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -4223,7 +4437,7 @@ static NET_CMD_STATUS_e getFtpUploadCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
 	UINT16				fieldLoop;
 	UINT16				indexLoop;
 	FTP_UPLOAD_CONFIG_t	ftpUploadCfg;
-	UINT16				outLen = 0;
+	UINT32				outLen = 0;
 
 	for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
 	{
@@ -4231,7 +4445,7 @@ static NET_CMD_STATUS_e getFtpUploadCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -4268,7 +4482,7 @@ static NET_CMD_STATUS_e getFtpUploadCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -4278,7 +4492,7 @@ static NET_CMD_STATUS_e getFtpUploadCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         //Validate Buffer size
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -4313,7 +4527,7 @@ static NET_CMD_STATUS_e setFtpUploadCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_FTP_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_FTP_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -4415,7 +4629,7 @@ static NET_CMD_STATUS_e getTcpNotifyCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
 {
 	UINT16				fieldLoop;
 	TCP_NOTIFY_CONFIG_t	tcpNotifyCfg;
-    UINT16				outLen;
+    UINT32				outLen;
 
 	ReadTcpNotifyConfig(&tcpNotifyCfg);
 
@@ -4423,7 +4637,7 @@ static NET_CMD_STATUS_e getTcpNotifyCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -4450,7 +4664,7 @@ static NET_CMD_STATUS_e getTcpNotifyCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -4490,7 +4704,7 @@ static NET_CMD_STATUS_e setTcpNotifyCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_TCP_NOTIFY_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_TCP_NOTIFY_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -4570,7 +4784,7 @@ static NET_CMD_STATUS_e getFileAccessCfg(UINT16 fromIndex, UINT16 toIndex, UINT1
 {
 	UINT16					fieldLoop;
 	FILE_ACCESS_CONFIG_t	fileAccessCfg;
-	UINT16					outLen;
+	UINT32					outLen;
 
 	ReadFileAccessConfig(&fileAccessCfg);
 
@@ -4578,7 +4792,7 @@ static NET_CMD_STATUS_e getFileAccessCfg(UINT16 fromIndex, UINT16 toIndex, UINT1
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -4601,7 +4815,7 @@ static NET_CMD_STATUS_e getFileAccessCfg(UINT16 fromIndex, UINT16 toIndex, UINT1
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -4641,7 +4855,7 @@ static NET_CMD_STATUS_e setFileAccessCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_FILE_ACCESS_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_FILE_ACCESS_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -4717,7 +4931,7 @@ static NET_CMD_STATUS_e getHddCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fromF
 {
 	UINT16				fieldLoop;
 	HDD_CONFIG_t		hddCfg;
-    UINT16				outLen;
+    UINT32				outLen;
 	NET_CMD_STATUS_e	retVal = CMD_SUCCESS;
 
 	ReadHddConfig(&hddCfg);
@@ -4726,7 +4940,7 @@ static NET_CMD_STATUS_e getHddCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fromF
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -4749,7 +4963,7 @@ static NET_CMD_STATUS_e getHddCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fromF
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -4789,7 +5003,7 @@ static NET_CMD_STATUS_e setHddCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_HDD_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_HDD_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -4866,7 +5080,7 @@ static NET_CMD_STATUS_e getMatrixDnsServerCfg(UINT16 fromIndex, UINT16 toIndex,
 {
 	UINT16						fieldLoop;
 	MATRIX_DNS_SERVER_CONFIG_t	matrixDnsServerCfg;
-    UINT16						outLen;
+    UINT32						outLen;
 
 	ReadMatrixDnsServerConfig(&matrixDnsServerCfg);
 
@@ -4874,7 +5088,7 @@ static NET_CMD_STATUS_e getMatrixDnsServerCfg(UINT16 fromIndex, UINT16 toIndex,
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -4901,7 +5115,7 @@ static NET_CMD_STATUS_e getMatrixDnsServerCfg(UINT16 fromIndex, UINT16 toIndex,
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -4941,7 +5155,7 @@ static NET_CMD_STATUS_e setMatrixDnsServerCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_MATRIX_DNS_SERVER_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_MATRIX_DNS_SERVER_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -5023,7 +5237,7 @@ static NET_CMD_STATUS_e getUserAccountCfg(UINT16 fromIndex, UINT16 toIndex, UINT
 	UINT16					fieldLoop;
 	UINT16					indexLoop;
 	USER_ACCOUNT_CONFIG_t	userAccontCfg;
-	UINT16					outLen = 0;
+	UINT32					outLen = 0;
 
 	for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
 	{
@@ -5031,7 +5245,7 @@ static NET_CMD_STATUS_e getUserAccountCfg(UINT16 fromIndex, UINT16 toIndex, UINT
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -5084,7 +5298,7 @@ static NET_CMD_STATUS_e getUserAccountCfg(UINT16 fromIndex, UINT16 toIndex, UINT
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -5094,7 +5308,7 @@ static NET_CMD_STATUS_e getUserAccountCfg(UINT16 fromIndex, UINT16 toIndex, UINT
         //Validate Buffer size
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -5130,7 +5344,7 @@ static NET_CMD_STATUS_e setUserAccountCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_USER_ACCOUNT_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_USER_ACCOUNT_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -5254,7 +5468,7 @@ static NET_CMD_STATUS_e getCameraCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fr
 	UINT16				fieldLoop;
 	UINT16				indexLoop;
 	CAMERA_CONFIG_t 	cameraCfg;
-	UINT16				outLen = 0;
+	UINT32				outLen = 0;
 
 	for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
 	{
@@ -5262,7 +5476,7 @@ static NET_CMD_STATUS_e getCameraCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fr
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -5387,7 +5601,7 @@ static NET_CMD_STATUS_e getCameraCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fr
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -5397,7 +5611,7 @@ static NET_CMD_STATUS_e getCameraCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fr
         //Validate Buffer size
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen ;
             break;
         }
@@ -5435,7 +5649,7 @@ static NET_CMD_STATUS_e setCameraCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_CAMERA_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_CAMERA_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -5583,6 +5797,11 @@ static NET_CMD_STATUS_e setCameraCfg(CHARPTR *reqStr)
                     cameraCfg.channelNamePos[5] = fieldVal;
                     break;
 
+                /* Unused config field id list */
+                case (CAMERA_CFG_DUMMY_FIELD)...(MAX_CAMERA_CFG_FIELD):
+                    writeStatus = ParseStringGetVal(reqStr, &fieldVal, 1, FSP);
+                    break;
+
                 default:
                     retVal = CMD_INVALID_FIELD_ID;
                     writeStatus = FAIL;
@@ -5649,7 +5868,7 @@ static NET_CMD_STATUS_e getStreamCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fr
 	UINT16				fieldLoop;
 	UINT16				indexLoop;
 	STREAM_CONFIG_t 	streamCfg;
-	UINT16				outLen = 0;
+	UINT32				outLen = 0;
 
 	for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
 	{
@@ -5657,7 +5876,7 @@ static NET_CMD_STATUS_e getStreamCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fr
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -5750,7 +5969,7 @@ static NET_CMD_STATUS_e getStreamCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fr
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -5760,7 +5979,7 @@ static NET_CMD_STATUS_e getStreamCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fr
         //Validate Buffer size
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -5798,7 +6017,7 @@ static NET_CMD_STATUS_e setStreamCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_STREAM_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_STREAM_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -5983,7 +6202,7 @@ static NET_CMD_STATUS_e getAlarmRecordCfg(UINT16 fromIndex, UINT16 toIndex, UINT
 	UINT16					fieldLoop;
 	UINT16					indexLoop;
 	ALARM_RECORD_CONFIG_t	alarmRecordCfg;
-	UINT16					outLen = 0;
+	UINT32					outLen = 0;
 
 	for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
 	{
@@ -5991,7 +6210,7 @@ static NET_CMD_STATUS_e getAlarmRecordCfg(UINT16 fromIndex, UINT16 toIndex, UINT
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -6019,7 +6238,7 @@ static NET_CMD_STATUS_e getAlarmRecordCfg(UINT16 fromIndex, UINT16 toIndex, UINT
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -6030,7 +6249,7 @@ static NET_CMD_STATUS_e getAlarmRecordCfg(UINT16 fromIndex, UINT16 toIndex, UINT
         //Validate Buffer size
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -6069,7 +6288,7 @@ static NET_CMD_STATUS_e setAlarmRecordCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_ALARM_RECORD_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_ALARM_RECORD_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -6172,7 +6391,7 @@ static NET_CMD_STATUS_e getPresetPositionCfg(UINT16 fromIndex, UINT16 toIndex, U
     UINT16              fieldLoop;
     UINT16              indexLoop;
     PTZ_PRESET_CONFIG_t ptzPresetCfg;
-    UINT16              outLen = 0;
+    UINT32              outLen = 0;
     UINT16              camIndex;
     UINT16              presetIndex;
 
@@ -6182,7 +6401,7 @@ static NET_CMD_STATUS_e getPresetPositionCfg(UINT16 fromIndex, UINT16 toIndex, U
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -6200,7 +6419,7 @@ static NET_CMD_STATUS_e getPresetPositionCfg(UINT16 fromIndex, UINT16 toIndex, U
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -6211,7 +6430,7 @@ static NET_CMD_STATUS_e getPresetPositionCfg(UINT16 fromIndex, UINT16 toIndex, U
         //Validate Buffer size
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -6248,7 +6467,7 @@ static NET_CMD_STATUS_e setPresetPositionCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_PRESET_POSITION_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_PRESET_POSITION_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -6331,7 +6550,7 @@ static NET_CMD_STATUS_e getRecordingScheduleCfg1(UINT16 fromIndex, UINT16 toInde
 	UINT16			  	 	 fieldLoop;
 	UINT16					 indexLoop;
 	SCHEDULE_RECORD_CONFIG_t shedRecdCfg;
-	UINT16					 outLen = 0;
+	UINT32					 outLen = 0;
 	NET_CMD_STATUS_e		 retVal = CMD_SUCCESS;
 
 	for(indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -6346,7 +6565,7 @@ static NET_CMD_STATUS_e getRecordingScheduleCfg1(UINT16 fromIndex, UINT16 toInde
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -6375,7 +6594,7 @@ static NET_CMD_STATUS_e getRecordingScheduleCfg1(UINT16 fromIndex, UINT16 toInde
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -6385,7 +6604,7 @@ static NET_CMD_STATUS_e getRecordingScheduleCfg1(UINT16 fromIndex, UINT16 toInde
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -6432,7 +6651,7 @@ static NET_CMD_STATUS_e setRecordingScheduleCfg1(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_ENABLE_SCHEDULE_RECORD_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_ENABLE_SCHEDULE_RECORD_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -6527,7 +6746,7 @@ static NET_CMD_STATUS_e getRecordingScheduleCfg2(UINT16 fromIndex, UINT16 toInde
 {
 	UINT16					 fieldLoop;
 	SCHEDULE_RECORD_CONFIG_t shedRecdCfg = { 0 };
-	UINT16					 outLen = 0;
+	UINT32					 outLen = 0;
 	UINT16 					 startIdx, temp, weekDaysIdx, camIdx;
 	NET_CMD_STATUS_e		 retVal = CMD_SUCCESS;
 
@@ -6549,7 +6768,7 @@ static NET_CMD_STATUS_e getRecordingScheduleCfg2(UINT16 fromIndex, UINT16 toInde
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(startIdx), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -6621,7 +6840,7 @@ static NET_CMD_STATUS_e getRecordingScheduleCfg2(UINT16 fromIndex, UINT16 toInde
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -6636,7 +6855,7 @@ static NET_CMD_STATUS_e getRecordingScheduleCfg2(UINT16 fromIndex, UINT16 toInde
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -6685,7 +6904,7 @@ static NET_CMD_STATUS_e setRecordingScheduleCfg2(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_SCHEDULE_RECORD_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_SCHEDULE_RECORD_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -6860,7 +7079,7 @@ static NET_CMD_STATUS_e getPresetTourCfg1(UINT16 fromIndex, UINT16 toIndex, UINT
 	UINT16					fieldLoop;
 	UINT16					indexLoop;
 	PRESET_TOUR_CONFIG_t 	presetTourCfg;
-	UINT16					outLen = 0;
+	UINT32					outLen = 0;
 	NET_CMD_STATUS_e		status = CMD_SUCCESS;
 
 	for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -6869,7 +7088,7 @@ static NET_CMD_STATUS_e getPresetTourCfg1(UINT16 fromIndex, UINT16 toIndex, UINT
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -6898,7 +7117,7 @@ static NET_CMD_STATUS_e getPresetTourCfg1(UINT16 fromIndex, UINT16 toIndex, UINT
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -6913,7 +7132,7 @@ static NET_CMD_STATUS_e getPresetTourCfg1(UINT16 fromIndex, UINT16 toIndex, UINT
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -6957,7 +7176,7 @@ static NET_CMD_STATUS_e setPresetTourCfg1(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_MANUAL_PRESET_TOUR_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_MANUAL_PRESET_TOUR_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -7045,7 +7264,7 @@ static NET_CMD_STATUS_e getPresetTourCfg2(UINT16 fromIndex, UINT16 toIndex, UINT
 {
 	UINT16					 fieldLoop;
 	PRESET_TOUR_CONFIG_t 	 presetTourCfg = { 0 };
-	UINT16					 outLen = 0;
+	UINT32					 outLen = 0;
 	UINT16 					 startIdx, temp;
 	UINT16 					 tourIdx;
 	UINT16 					 camIdx;
@@ -7069,7 +7288,7 @@ static NET_CMD_STATUS_e getPresetTourCfg2(UINT16 fromIndex, UINT16 toIndex, UINT
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(startIdx), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -7417,7 +7636,7 @@ static NET_CMD_STATUS_e getPresetTourCfg2(UINT16 fromIndex, UINT16 toIndex, UINT
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -7432,7 +7651,7 @@ static NET_CMD_STATUS_e getPresetTourCfg2(UINT16 fromIndex, UINT16 toIndex, UINT
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -7486,7 +7705,7 @@ static NET_CMD_STATUS_e setPresetTourCfg2(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_AUTO_PRESET_TOUR_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_AUTO_PRESET_TOUR_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -7993,7 +8212,7 @@ static NET_CMD_STATUS_e getPresetTourSchedCfg(UINT16 fromIndex, UINT16 toIndex,
 	UINT16					fieldLoop;
 	UINT16					indexLoop;
 	TOUR_SCHEDULE_CONFIG_t 	tourSchedCfg;
-	UINT16					outLen = 0;
+	UINT32					outLen = 0;
 	UINT16 					weekDaysIdx;
 	UINT16 					camIdx, tmp;
 	NET_CMD_STATUS_e		retVal = CMD_SUCCESS;
@@ -8006,7 +8225,7 @@ static NET_CMD_STATUS_e getPresetTourSchedCfg(UINT16 fromIndex, UINT16 toIndex,
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -8065,7 +8284,7 @@ static NET_CMD_STATUS_e getPresetTourSchedCfg(UINT16 fromIndex, UINT16 toIndex,
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -8080,7 +8299,7 @@ static NET_CMD_STATUS_e getPresetTourSchedCfg(UINT16 fromIndex, UINT16 toIndex,
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -8130,7 +8349,7 @@ static NET_CMD_STATUS_e setPresetTourSchedCfg(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_PRESET_TOUR_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_PRESET_TOUR_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -8144,8 +8363,11 @@ static NET_CMD_STATUS_e setPresetTourSchedCfg(CHARPTR *reqStr)
 		{
 			ReadSingleTourScheduleConfig(camIdx, &tourSchedCfg[camIdx]);
 			prevIndex = camIdx;
-			availableChannel[channelCnt] = camIdx;
-			channelCnt++;
+			if(channelCnt < MAX_CAMERA)
+			{
+				availableChannel[channelCnt] = camIdx;
+				channelCnt++;
+			}
 		}
 
 		while(**reqStr != EOI)
@@ -8231,7 +8453,7 @@ static NET_CMD_STATUS_e setPresetTourSchedCfg(CHARPTR *reqStr)
 
 	if(writeStatus == SUCCESS)
 	{
-		for(channelCnt = 0 ; availableChannel[channelCnt] < getMaxCameraForCurrentVariant(); channelCnt++)
+		for(channelCnt = 0 ; (channelCnt < MAX_CAMERA) && (availableChannel[channelCnt] < getMaxCameraForCurrentVariant()); channelCnt++)
 		{
             retVal = WriteSingleTourScheduleConfig(availableChannel[channelCnt], &tourSchedCfg[availableChannel[channelCnt]]);
             if(retVal != CMD_SUCCESS)
@@ -8269,7 +8491,7 @@ static NET_CMD_STATUS_e getSensorCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fr
 	UINT16					fieldLoop;
 	UINT16					indexLoop;
 	SENSOR_CONFIG_t 		sensorCfg;
-	UINT16					outLen = 0;
+	UINT32					outLen = 0;
 	NET_CMD_STATUS_e		retVal = CMD_SUCCESS;
 
 	for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -8278,7 +8500,7 @@ static NET_CMD_STATUS_e getSensorCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fr
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -8311,7 +8533,7 @@ static NET_CMD_STATUS_e getSensorCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fr
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -8326,7 +8548,7 @@ static NET_CMD_STATUS_e getSensorCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fr
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -8368,7 +8590,7 @@ static NET_CMD_STATUS_e setSensorCnfg(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_SYS_SENOR_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_SYS_SENOR_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -8460,7 +8682,7 @@ static NET_CMD_STATUS_e getSystemAlmCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
 	UINT16					fieldLoop;
 	UINT16					indexLoop;
 	ALARM_CONFIG_t	 		sysAlmCfg;
-	UINT16					outLen = 0;
+	UINT32					outLen = 0;
 	NET_CMD_STATUS_e	    retVal = CMD_SUCCESS;
 
 	for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -8469,7 +8691,7 @@ static NET_CMD_STATUS_e getSystemAlmCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -8502,7 +8724,7 @@ static NET_CMD_STATUS_e getSystemAlmCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -8517,7 +8739,7 @@ static NET_CMD_STATUS_e getSystemAlmCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -8560,7 +8782,7 @@ static NET_CMD_STATUS_e setSysAlmCfg(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_SYS_ALARM_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_SYS_ALARM_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -8656,7 +8878,7 @@ static NET_CMD_STATUS_e getImgUpldCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 f
 	UINT16					fieldLoop;
 	UINT16					indexLoop;
 	IMAGE_UPLOAD_CONFIG_t	imgUpldCfg;
-	UINT16					outLen = 0;
+	UINT32					outLen = 0;
 	NET_CMD_STATUS_e	    retVal = CMD_SUCCESS;
 
 	for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -8665,7 +8887,7 @@ static NET_CMD_STATUS_e getImgUpldCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 f
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -8706,7 +8928,7 @@ static NET_CMD_STATUS_e getImgUpldCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 f
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -8721,7 +8943,7 @@ static NET_CMD_STATUS_e getImgUpldCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 f
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -8771,7 +8993,7 @@ static NET_CMD_STATUS_e setImgUpldCfg(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_UPLOAD_IMAGE_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_UPLOAD_IMAGE_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -8880,7 +9102,7 @@ static NET_CMD_STATUS_e getStorageConfig(UINT16 fromIndex, UINT16 toIndex, UINT1
 	UINT16					fieldLoop;
 	UINT16					indexLoop;
 	STORAGE_CONFIG_t		storageCfg;
-	UINT16					outLen = 0;
+	UINT32					outLen = 0;
 	NET_CMD_STATUS_e	    retVal = CMD_SUCCESS;
 
 	for(indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -8889,7 +9111,7 @@ static NET_CMD_STATUS_e getStorageConfig(UINT16 fromIndex, UINT16 toIndex, UINT1
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -8946,7 +9168,7 @@ static NET_CMD_STATUS_e getStorageConfig(UINT16 fromIndex, UINT16 toIndex, UINT1
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -8961,7 +9183,7 @@ static NET_CMD_STATUS_e getStorageConfig(UINT16 fromIndex, UINT16 toIndex, UINT1
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -9012,7 +9234,7 @@ static NET_CMD_STATUS_e setStorageConfig(CHARPTR *reqStr)
 		}
 
 		//check invalid index id
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_STORAGE_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_STORAGE_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -9133,7 +9355,7 @@ static NET_CMD_STATUS_e getSchedBackUpCfg(UINT16 fromIndex, UINT16 toIndex, UINT
 	UINT16					 fieldLoop;
 	UINT16					 indexLoop;
 	SCHEDULE_BACKUP_CONFIG_t schedBackUpCfg;
-	UINT16					 outLen = 0;
+	UINT32					 outLen = 0;
 	NET_CMD_STATUS_e	     retVal = CMD_SUCCESS;
 
 	for(indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -9142,7 +9364,7 @@ static NET_CMD_STATUS_e getSchedBackUpCfg(UINT16 fromIndex, UINT16 toIndex, UINT
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -9191,7 +9413,7 @@ static NET_CMD_STATUS_e getSchedBackUpCfg(UINT16 fromIndex, UINT16 toIndex, UINT
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -9206,7 +9428,7 @@ static NET_CMD_STATUS_e getSchedBackUpCfg(UINT16 fromIndex, UINT16 toIndex, UINT
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -9250,7 +9472,7 @@ static NET_CMD_STATUS_e setSchedBackUpCfg(CHARPTR *reqStr)
 		}
 
 		//check invalid index id
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_SCHEDULE_BACKUP_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_SCHEDULE_BACKUP_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -9357,7 +9579,7 @@ static NET_CMD_STATUS_e getManBackUpCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
 	UINT16					 fieldLoop;
 	UINT16					 indexLoop;
 	MANUAL_BACKUP_CONFIG_t 	 manBackUpCfg;
-	UINT16					 outLen = 0;
+	UINT32					 outLen = 0;
 	NET_CMD_STATUS_e	     retVal = CMD_SUCCESS;
 
 	for(indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -9366,7 +9588,7 @@ static NET_CMD_STATUS_e getManBackUpCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -9399,7 +9621,7 @@ static NET_CMD_STATUS_e getManBackUpCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -9414,7 +9636,7 @@ static NET_CMD_STATUS_e getManBackUpCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -9458,7 +9680,7 @@ static NET_CMD_STATUS_e setManBackUpCfg(CHARPTR *reqStr)
 		}
 
 		//check invalid index id
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_MANUAL_BACKUP_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_MANUAL_BACKUP_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -9541,7 +9763,7 @@ static NET_CMD_STATUS_e defaultManBackUpCfg(UINT16 fromIndex, UINT16 toIndex)
 
 UINT16 getEvtActfield1(UINT16 fromField, UINT16 toField, BOOL action, ACTION_PARAMETERS_t *actionParam,UINT16PTR actionBits, CHARPTR respStringPtr, CAMERA_BIT_MASK_t *copyToCam, const UINT32 respStrLen)
 {
-    UINT16              outLen = 0;
+    UINT32              outLen = 0;
     UINT16              fieldLoop;
     UINT64              bitField = 0;
     UINT8               maskId, totalCamera;
@@ -9679,7 +9901,7 @@ UINT16 getEvtActfield1(UINT16 fromField, UINT16 toField, BOOL action, ACTION_PAR
         //Validate Buffer size
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -9696,7 +9918,7 @@ UINT16 getEvtActfield1(UINT16 fromField, UINT16 toField, BOOL action, ACTION_PAR
 static NET_CMD_STATUS_e getCameraEACfg1(UINT16 fromIndex, UINT16 toIndex, UINT16 fromField, UINT16 toField, CHARPTR respStringPtr, const UINT32 respStrLen)
 {
 	CAMERA_EVENT_CONFIG_t 	 camEvtCfg;
-	UINT16					 outLen = 0, fieldStrLen = 0;
+	UINT32					 outLen = 0, fieldStrLen = 0;
 	UINT16 					 startIdx;
 	UINT16 					 camEvtIdx;
 	UINT16 					 camIdx;
@@ -9712,10 +9934,11 @@ static NET_CMD_STATUS_e getCameraEACfg1(UINT16 fromIndex, UINT16 toIndex, UINT16
 
         //Validate Buffer size for add last two character including NULL
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(startIdx), FSP);
-        if(outLen > respStrLen)
+        if(outLen >= respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
+            break;
         }
 
         if((fieldStrLen = getEvtActfield1(fromField, toField, camEvtCfg.action, &(camEvtCfg.actionParam),
@@ -9729,7 +9952,7 @@ static NET_CMD_STATUS_e getCameraEACfg1(UINT16 fromIndex, UINT16 toIndex, UINT16
 		outLen += fieldStrLen;
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -9737,7 +9960,7 @@ static NET_CMD_STATUS_e getCameraEACfg1(UINT16 fromIndex, UINT16 toIndex, UINT16
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -9922,7 +10145,7 @@ static NET_CMD_STATUS_e setCameraEACfg1(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_CAMERA_EVENT_ACTION_PARAM_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_CAMERA_EVENT_ACTION_PARAM_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -9988,7 +10211,7 @@ static NET_CMD_STATUS_e defaultCameraEACfg1(UINT16 fromIndex, UINT16 toIndex)
 
 static UINT16 getEvtActfield2(UINT16 fromField, UINT16 toField, WEEKLY_ACTION_SCHEDULE_t *weeklySchedule,CHARPTR respStringPtr, const UINT32 respStrLen)
 {
-    UINT16  outLen = 0;
+    UINT32  outLen = 0;
     UINT16  fieldLoop;
 
 	for (fieldLoop = fromField; fieldLoop <= toField; fieldLoop++)
@@ -10083,7 +10306,7 @@ static UINT16 getEvtActfield2(UINT16 fromField, UINT16 toField, WEEKLY_ACTION_SC
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -10100,7 +10323,7 @@ static UINT16 getEvtActfield2(UINT16 fromField, UINT16 toField, WEEKLY_ACTION_SC
 static NET_CMD_STATUS_e getCameraEACfg2(UINT16 fromIndex, UINT16 toIndex, UINT16 fromField, UINT16 toField, CHARPTR respStringPtr, const UINT32 respStrLen)
 {
 	CAMERA_EVENT_CONFIG_t 	 camEvtCfg;
-	UINT16					 outLen = 0, fieldStrLen = 0;
+	UINT32					 outLen = 0, fieldStrLen = 0;
 	UINT16 					 startIdx;
 	UINT16 					 camEvtIdx, tmp;
 	UINT32 					 camIdx;
@@ -10121,10 +10344,11 @@ static NET_CMD_STATUS_e getCameraEACfg2(UINT16 fromIndex, UINT16 toIndex, UINT16
 
         //Validate Buffer size for add last two character including NULL
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(startIdx), FSP);
-        if(outLen > respStrLen)
+        if(outLen >= respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
+            break;
         }
 
         if((fieldStrLen = getEvtActfield2(fromField, toField,&(camEvtCfg.weeklySchedule[weekDaysIdx]), (respStringPtr + outLen), respStrLen - outLen)) == 0)
@@ -10137,7 +10361,7 @@ static NET_CMD_STATUS_e getCameraEACfg2(UINT16 fromIndex, UINT16 toIndex, UINT16
 		outLen += fieldStrLen;
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -10145,7 +10369,7 @@ static NET_CMD_STATUS_e getCameraEACfg2(UINT16 fromIndex, UINT16 toIndex, UINT16
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -10311,7 +10535,7 @@ static NET_CMD_STATUS_e setCameraEACfg2(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_CAMERA_EVENT_SCHEDUL_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_CAMERA_EVENT_SCHEDUL_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -10456,7 +10680,7 @@ static NET_CMD_STATUS_e defaultCameraEACfg2(UINT16 fromIndex, UINT16 toIndex)
 static NET_CMD_STATUS_e getSensorEaParamCfg1(UINT16 fromIndex, UINT16 toIndex, UINT16 fromField, UINT16 toField, CHARPTR respStringPtr, const UINT32 respStrLen)
 {
 	SENSOR_EVENT_CONFIG_t 	 sensorEvtCfg;
-	UINT16					 outLen = 0, fieldStrLen = 0;
+	UINT32					 outLen = 0, fieldStrLen = 0;
 	UINT16 					 startIdx;
 	NET_CMD_STATUS_e         retVal = CMD_SUCCESS;
 
@@ -10467,10 +10691,11 @@ static NET_CMD_STATUS_e getSensorEaParamCfg1(UINT16 fromIndex, UINT16 toIndex, U
 
         //Validate Buffer size for add last two character including NULL
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(startIdx), FSP);
-        if(outLen > respStrLen)
+        if(outLen >= respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
+            break;
         }
 
         if((fieldStrLen = getEvtActfield1(fromField, toField, sensorEvtCfg.action, &(sensorEvtCfg.actionParam), NULL, respStringPtr + outLen,NULL, respStrLen - outLen)) == 0)
@@ -10483,7 +10708,7 @@ static NET_CMD_STATUS_e getSensorEaParamCfg1(UINT16 fromIndex, UINT16 toIndex, U
 		outLen += fieldStrLen;
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -10491,7 +10716,7 @@ static NET_CMD_STATUS_e getSensorEaParamCfg1(UINT16 fromIndex, UINT16 toIndex, U
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -10527,7 +10752,7 @@ static NET_CMD_STATUS_e setSensorEaParamCfg1(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_SENSOR_EVENT_ACTION_PARAM_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_SENSOR_EVENT_ACTION_PARAM_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -10592,7 +10817,7 @@ static NET_CMD_STATUS_e defaultSensorEaParamCfg1(UINT16 fromIndex, UINT16 toInde
 static NET_CMD_STATUS_e getSensorEaParamCfg2(UINT16 fromIndex, UINT16 toIndex, UINT16 fromField, UINT16 toField, CHARPTR respStringPtr, const UINT32 respStrLen)
 {
 	SENSOR_EVENT_CONFIG_t 	 sensorEvtCfg;
-	UINT16					 outLen = 0, fieldStrLen = 0;
+	UINT32					 outLen = 0, fieldStrLen = 0;
 	UINT32 					 startIdx;
 	UINT16 					 tmp;
 	UINT16 					 sensorIdx, weekDaysIdx;
@@ -10612,10 +10837,11 @@ static NET_CMD_STATUS_e getSensorEaParamCfg2(UINT16 fromIndex, UINT16 toIndex, U
 
         //Validate Buffer size for add last two character including NULL
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(startIdx), FSP);
-        if(outLen > respStrLen)
+        if(outLen >= respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
+            break;
         }
 
         if((fieldStrLen = getEvtActfield2(fromField, toField, &(sensorEvtCfg.weeklySchedule[weekDaysIdx]), (respStringPtr + outLen), respStrLen - outLen)) == 0)
@@ -10628,7 +10854,7 @@ static NET_CMD_STATUS_e getSensorEaParamCfg2(UINT16 fromIndex, UINT16 toIndex, U
 		outLen += fieldStrLen;
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -10636,7 +10862,7 @@ static NET_CMD_STATUS_e getSensorEaParamCfg2(UINT16 fromIndex, UINT16 toIndex, U
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -10678,7 +10904,7 @@ static NET_CMD_STATUS_e setSensorEaParamCfg2(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_SENSOR_EVENT_SCHEDULE_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_SENSOR_EVENT_SCHEDULE_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -10757,7 +10983,7 @@ static NET_CMD_STATUS_e defaultSensorEaParamCfg2(UINT16 fromIndex, UINT16 toInde
 static NET_CMD_STATUS_e getSystemEaParamCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fromField, UINT16 toField, CHARPTR respStringPtr, const UINT32 respStrLen)
 {
 	SYSTEM_EVENT_CONFIG_t 	 systemEvtCfg;
-	UINT16					 outLen = 0, fieldStrLen = 0;
+	UINT32					 outLen = 0, fieldStrLen = 0;
 	UINT32 					 startIdx;
 	NET_CMD_STATUS_e         retVal = CMD_SUCCESS;
 
@@ -10767,10 +10993,11 @@ static NET_CMD_STATUS_e getSystemEaParamCfg(UINT16 fromIndex, UINT16 toIndex, UI
 
         //Validate Buffer size for add last two character including NULL
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(startIdx), FSP);
-        if(outLen > respStrLen)
+        if(outLen >= respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
+            break;
         }
 
         fieldStrLen = getEvtActfield1(fromField, toField, systemEvtCfg.action, &systemEvtCfg.actionParam, &systemEvtCfg.actionBits.actionBitGroup, respStringPtr + outLen, NULL, respStrLen - outLen);
@@ -10784,7 +11011,7 @@ static NET_CMD_STATUS_e getSystemEaParamCfg(UINT16 fromIndex, UINT16 toIndex, UI
 		outLen += fieldStrLen;
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -10792,7 +11019,7 @@ static NET_CMD_STATUS_e getSystemEaParamCfg(UINT16 fromIndex, UINT16 toIndex, UI
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -10828,7 +11055,7 @@ static NET_CMD_STATUS_e setSystemEaParamCfg(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_SYSTEM_EVENT_ACTION_PARAM_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_SYSTEM_EVENT_ACTION_PARAM_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -10898,7 +11125,7 @@ static NET_CMD_STATUS_e getCosecRecordCfg(UINT16 fromIndex, UINT16 toIndex, UINT
 	COSEC_REC_PARAM_CONFIG_t	cosecRecCfg;
 	UINT16						fieldLoop;
 	UINT16						indexLoop;
-	UINT16						outLen = 0;
+	UINT32						outLen = 0;
 	NET_CMD_STATUS_e			retVal = CMD_SUCCESS;
 
 	for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -10907,7 +11134,7 @@ static NET_CMD_STATUS_e getCosecRecordCfg(UINT16 fromIndex, UINT16 toIndex, UINT
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -10935,7 +11162,7 @@ static NET_CMD_STATUS_e getCosecRecordCfg(UINT16 fromIndex, UINT16 toIndex, UINT
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -10946,7 +11173,7 @@ static NET_CMD_STATUS_e getCosecRecordCfg(UINT16 fromIndex, UINT16 toIndex, UINT
         //Validate Buffer size
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -10985,7 +11212,7 @@ static NET_CMD_STATUS_e setCosecRecordCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_COSEC_RECORD_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_COSEC_RECORD_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -11089,7 +11316,8 @@ static NET_CMD_STATUS_e getCameraAlmCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
 	UINT16					fieldLoop;
 	UINT16					indexLoop;
 	CAMERA_ALARM_CONFIG_t 	camAlmCfg;
-	UINT16					outLen = 0, almIdx, camIdx;
+	UINT32					outLen = 0;
+	UINT16					almIdx, camIdx;
 	NET_CMD_STATUS_e		retVal = CMD_SUCCESS;
 
 	for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -11098,7 +11326,7 @@ static NET_CMD_STATUS_e getCameraAlmCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -11124,7 +11352,7 @@ static NET_CMD_STATUS_e getCameraAlmCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -11133,7 +11361,7 @@ static NET_CMD_STATUS_e getCameraAlmCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -11176,7 +11404,7 @@ static NET_CMD_STATUS_e setCameraAlmCfg(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_CAMERA_ALARM_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_CAMERA_ALARM_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -11266,7 +11494,7 @@ static NET_CMD_STATUS_e getDfltRoutingCfg(UINT16 fromIndex, UINT16 toIndex, UINT
 	UINT16					fieldLoop;
 	UINT16					indexLoop;
 	STATIC_ROUTING_CONFIG_t	dflRoutingCfg;
-	UINT16					outLen = 0;
+	UINT32					outLen = 0;
 	NET_CMD_STATUS_e	    retVal = CMD_SUCCESS;
 
 	for(indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -11275,7 +11503,7 @@ static NET_CMD_STATUS_e getDfltRoutingCfg(UINT16 fromIndex, UINT16 toIndex, UINT
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -11296,7 +11524,7 @@ static NET_CMD_STATUS_e getDfltRoutingCfg(UINT16 fromIndex, UINT16 toIndex, UINT
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -11311,7 +11539,7 @@ static NET_CMD_STATUS_e getDfltRoutingCfg(UINT16 fromIndex, UINT16 toIndex, UINT
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -11355,7 +11583,7 @@ static NET_CMD_STATUS_e setDfltRoutingCfg(CHARPTR *reqStr)
 		}
 
 		//check invalid index id
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_DEFAULT_ROUTING_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_DEFAULT_ROUTING_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -11423,7 +11651,7 @@ static NET_CMD_STATUS_e getStaticRoutingCfg(UINT16 fromIndex, UINT16 toIndex, UI
 	UINT16					fieldLoop;
 	UINT16					indexLoop;
 	STATIC_ROUTING_CONFIG_t	staticRoute;
-	UINT16					outLen = 0;
+	UINT32					outLen = 0;
 	NET_CMD_STATUS_e	    retVal = CMD_SUCCESS;
 
 	ReadStaticRoutingConfig(&staticRoute);
@@ -11433,7 +11661,7 @@ static NET_CMD_STATUS_e getStaticRoutingCfg(UINT16 fromIndex, UINT16 toIndex, UI
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -11461,7 +11689,7 @@ static NET_CMD_STATUS_e getStaticRoutingCfg(UINT16 fromIndex, UINT16 toIndex, UI
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -11476,7 +11704,7 @@ static NET_CMD_STATUS_e getStaticRoutingCfg(UINT16 fromIndex, UINT16 toIndex, UI
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -11519,7 +11747,7 @@ static NET_CMD_STATUS_e setStaticRoutingCfg(CHARPTR *reqStr)
 		routingIdx = CLIENT_TO_OUR_INDEX(idxId);
 
 		//check invalid index id
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_STATIC_ROUTING_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_STATIC_ROUTING_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -11597,7 +11825,7 @@ static NET_CMD_STATUS_e getBroadBandCfg1(UINT16 fromIndex, UINT16 toIndex, UINT1
     UINT16              fieldLoop;
     UINT16              indexLoop;
     BROAD_BAND_CONFIG_t brdBndCfg;
-    UINT16              outLen = 0;
+    UINT32              outLen = 0;
     NET_CMD_STATUS_e    retVal = CMD_SUCCESS;
 
 	for(indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -11606,7 +11834,7 @@ static NET_CMD_STATUS_e getBroadBandCfg1(UINT16 fromIndex, UINT16 toIndex, UINT1
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -11629,7 +11857,7 @@ static NET_CMD_STATUS_e getBroadBandCfg1(UINT16 fromIndex, UINT16 toIndex, UINT1
                 //Validate Buffer size for add last two character including NULL
                 if(outLen > respStrLen - 2)
                 {
-                    EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                    DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                     outLen = respStrLen - 2;
                     break;
                 }
@@ -11645,7 +11873,7 @@ static NET_CMD_STATUS_e getBroadBandCfg1(UINT16 fromIndex, UINT16 toIndex, UINT1
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -11689,7 +11917,7 @@ static NET_CMD_STATUS_e setBroadBandCfg1(CHARPTR *reqStr)
 		}
 
 		//check invalid index id
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_BROADBAND_PROFILE_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_BROADBAND_PROFILE_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -11755,7 +11983,7 @@ static NET_CMD_STATUS_e getBroadBandCfg2(UINT16 fromIndex, UINT16 toIndex, UINT1
     UINT16              fieldLoop;
     UINT16              indexLoop;
     BROAD_BAND_CONFIG_t brdBndCfg;
-    UINT16              outLen = 0;
+    UINT32              outLen = 0;
     NET_CMD_STATUS_e    retVal = CMD_SUCCESS;
 
 	ReadBroadBandConfig(&brdBndCfg);
@@ -11765,7 +11993,7 @@ static NET_CMD_STATUS_e getBroadBandCfg2(UINT16 fromIndex, UINT16 toIndex, UINT1
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -11801,7 +12029,7 @@ static NET_CMD_STATUS_e getBroadBandCfg2(UINT16 fromIndex, UINT16 toIndex, UINT1
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -11816,7 +12044,7 @@ static NET_CMD_STATUS_e getBroadBandCfg2(UINT16 fromIndex, UINT16 toIndex, UINT1
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -11856,7 +12084,7 @@ static NET_CMD_STATUS_e setBroadBandCfg2(CHARPTR *reqStr)
 		}
 
 		//check invalid index id
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_BROADBAND_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_BROADBAND_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -11941,7 +12169,7 @@ static NET_CMD_STATUS_e getSmsCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fromF
 	UINT16					fieldLoop;
 	UINT16					indexLoop;
 	SMS_CONFIG_t			smsCfg;
-	UINT16					outLen = 0;
+	UINT32					outLen = 0;
 	NET_CMD_STATUS_e	    retVal = CMD_SUCCESS;
 
 	for(indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -11950,7 +12178,7 @@ static NET_CMD_STATUS_e getSmsCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fromF
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -11991,7 +12219,7 @@ static NET_CMD_STATUS_e getSmsCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fromF
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -12006,7 +12234,7 @@ static NET_CMD_STATUS_e getSmsCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fromF
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -12052,7 +12280,7 @@ static NET_CMD_STATUS_e setSmsCfg(CHARPTR *reqStr)
 		}
 
 		//check invalid index id
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_SMS_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_SMS_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -12142,7 +12370,7 @@ static NET_CMD_STATUS_e getManualRecordCfg(UINT16 fromIndex, UINT16 toIndex, UIN
 {
 	UINT16					fieldLoop;
 	UINT16					indexLoop;
-	UINT16					outLen = 0;
+	UINT32					outLen = 0;
 	MANUAL_RECORD_CONFIG_t	manRecCfg;
 	NET_CMD_STATUS_e	    retVal = CMD_SUCCESS;
 
@@ -12152,7 +12380,7 @@ static NET_CMD_STATUS_e getManualRecordCfg(UINT16 fromIndex, UINT16 toIndex, UIN
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -12177,7 +12405,7 @@ static NET_CMD_STATUS_e getManualRecordCfg(UINT16 fromIndex, UINT16 toIndex, UIN
             /* Validate Buffer size for add last two character including NULL */
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -12192,7 +12420,7 @@ static NET_CMD_STATUS_e getManualRecordCfg(UINT16 fromIndex, UINT16 toIndex, UIN
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -12234,7 +12462,7 @@ static NET_CMD_STATUS_e setManualRecordCfg(CHARPTR *reqStr)
 		}
 
         /* Check invalid index id */
-        if(indexId > (UINT64)totalIndexPerEveryTable[TBL_MANUAL_RECORD_CFG])
+        if((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_MANUAL_RECORD_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -12333,7 +12561,7 @@ static NET_CMD_STATUS_e getNwDriveCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 f
 	UINT16					fieldLoop;
 	UINT16					indexLoop;
 	NETWORK_DRIVE_CONFIG_t	nwDrvCfg;
-	UINT16					outLen = 0;
+	UINT32					outLen = 0;
 	NET_CMD_STATUS_e	    retVal = CMD_SUCCESS;
 
 	for(indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -12344,7 +12572,7 @@ static NET_CMD_STATUS_e getNwDriveCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 f
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -12388,7 +12616,7 @@ static NET_CMD_STATUS_e getNwDriveCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 f
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -12402,7 +12630,7 @@ static NET_CMD_STATUS_e getNwDriveCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 f
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -12446,7 +12674,7 @@ static NET_CMD_STATUS_e setNwDriveCfg(CHARPTR *reqStr)
 		}
 
 		//check invalid index id
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_NW_DRIVE_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_NW_DRIVE_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -12552,7 +12780,7 @@ static NET_CMD_STATUS_e getIpCameraCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
 	UINT16				fieldLoop;
 	UINT16				indexLoop;
 	IP_CAMERA_CONFIG_t 	ipCameraCfg;
-	UINT16				outLen = 0;
+	UINT32				outLen = 0;
 
 	for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
 	{
@@ -12560,7 +12788,7 @@ static NET_CMD_STATUS_e getIpCameraCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -12622,7 +12850,7 @@ static NET_CMD_STATUS_e getIpCameraCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -12632,7 +12860,7 @@ static NET_CMD_STATUS_e getIpCameraCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         //Validate Buffer size
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -12669,7 +12897,7 @@ static NET_CMD_STATUS_e setIpCameraCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_IP_CAMERA_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_IP_CAMERA_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             writeStatus = FAIL;
@@ -12800,7 +13028,7 @@ static NET_CMD_STATUS_e getNetworkDeviceCfg(UINT16 fromIndex, UINT16 toIndex, UI
 {
     UINT16                  fieldLoop;
     UINT16                  indexLoop;
-    UINT16                  outLen = 0;
+    UINT32                  outLen = 0;
     NETWORK_DEVICE_CONFIG_t networkDeviceCfg;
 
 	for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -12809,7 +13037,7 @@ static NET_CMD_STATUS_e getNetworkDeviceCfg(UINT16 fromIndex, UINT16 toIndex, UI
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -12866,7 +13094,7 @@ static NET_CMD_STATUS_e getNetworkDeviceCfg(UINT16 fromIndex, UINT16 toIndex, UI
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -12876,7 +13104,7 @@ static NET_CMD_STATUS_e getNetworkDeviceCfg(UINT16 fromIndex, UINT16 toIndex, UI
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -12914,7 +13142,7 @@ static NET_CMD_STATUS_e setNetworkDeviceCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_NETWORK_DEVICE_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_NETWORK_DEVICE_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             writeStatus = FAIL;
@@ -13043,7 +13271,7 @@ static NET_CMD_STATUS_e getSnapshotCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
 	UINT16					fieldLoop;
 	UINT8					indexLoop;
 	SNAPSHOT_CONFIG_t		snapshotCfg;
-	UINT16					outLen = 0;
+	UINT32					outLen = 0;
 	NET_CMD_STATUS_e	    retVal = CMD_SUCCESS;
 
 	for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -13052,7 +13280,7 @@ static NET_CMD_STATUS_e getSnapshotCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -13097,7 +13325,7 @@ static NET_CMD_STATUS_e getSnapshotCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -13112,7 +13340,7 @@ static NET_CMD_STATUS_e getSnapshotCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -13163,7 +13391,7 @@ static NET_CMD_STATUS_e setSnapshotCfg(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_SNAPSHOT_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_SNAPSHOT_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -13276,7 +13504,7 @@ static NET_CMD_STATUS_e getSnapshotSchdCfg(UINT16 fromIndex, UINT16 toIndex, UIN
 {
 	UINT16					 	fieldLoop;
 	SNAPSHOT_SCHEDULE_CONFIG_t 	snpShtSchdCfg;
-	UINT16					 	outLen = 0;
+	UINT32					 	outLen = 0;
 	UINT16 						startIdx;
 	NET_CMD_STATUS_e		 	retVal = CMD_SUCCESS;
 
@@ -13286,7 +13514,7 @@ static NET_CMD_STATUS_e getSnapshotSchdCfg(UINT16 fromIndex, UINT16 toIndex, UIN
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(startIdx), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -13363,7 +13591,7 @@ static NET_CMD_STATUS_e getSnapshotSchdCfg(UINT16 fromIndex, UINT16 toIndex, UIN
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -13378,7 +13606,7 @@ static NET_CMD_STATUS_e getSnapshotSchdCfg(UINT16 fromIndex, UINT16 toIndex, UIN
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c", EOI);
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -13424,7 +13652,7 @@ static NET_CMD_STATUS_e setSnapshotSchdCfg(CHARPTR *reqStr)
 			break;
 		}
 
-        if(idxId > (UINT64)totalIndexPerEveryTable[TBL_SNAPSHOT_SCHEDULE_CFG])
+        if((idxId == 0) || (idxId > (UINT64)totalIndexPerEveryTable[TBL_SNAPSHOT_SCHEDULE_CFG]))
 		{
 			retVal = CMD_INVALID_INDEX_ID;
 			break;
@@ -13592,7 +13820,7 @@ static NET_CMD_STATUS_e getLoginPolicyCfg(UINT16 fromIndex, UINT16 toIndex, UINT
 {
 	UINT16					fieldLoop;
 	LOGIN_POLICY_CONFIG_t 	loginPolicyCfg;
-	UINT16					outLen = 0;
+	UINT32					outLen = 0;
 	NET_CMD_STATUS_e		retVal = CMD_SUCCESS;
 
 	ReadLoginPolicyConfig(&loginPolicyCfg);
@@ -13601,7 +13829,7 @@ static NET_CMD_STATUS_e getLoginPolicyCfg(UINT16 fromIndex, UINT16 toIndex, UINT
     outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -13640,7 +13868,7 @@ static NET_CMD_STATUS_e getLoginPolicyCfg(UINT16 fromIndex, UINT16 toIndex, UINT
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -13678,7 +13906,7 @@ static NET_CMD_STATUS_e setLoginPolicyCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_LOGIN_POLICY_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_LOGIN_POLICY_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             writeStatus = FAIL;
@@ -13775,13 +14003,13 @@ static NET_CMD_STATUS_e getAudioOutCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
 {
 	UINT16				fieldLoop;
 	AUDIO_OUT_CONFIG_t	audioOutCfg;
-    UINT16				outLen;
+    UINT32				outLen;
 
     //Validate Buffer size for add last two character including NULL
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -13798,7 +14026,7 @@ static NET_CMD_STATUS_e getAudioOutCfg(UINT16 fromIndex, UINT16 toIndex, UINT16
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -13836,7 +14064,7 @@ static NET_CMD_STATUS_e setAudioOutCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_AUDIO_OUT_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_AUDIO_OUT_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             writeStatus = FAIL;
@@ -13907,13 +14135,13 @@ static NET_CMD_STATUS_e getP2PCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fromF
 {
     UINT16				fieldLoop;
     P2P_CONFIG_t        p2pCfg;
-    UINT16				outLen;
+    UINT32				outLen;
 
     //Validate Buffer size for add last two character including NULL
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -13934,7 +14162,7 @@ static NET_CMD_STATUS_e getP2PCfg(UINT16 fromIndex, UINT16 toIndex, UINT16 fromF
         //Validate Buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -13972,7 +14200,7 @@ static NET_CMD_STATUS_e setP2PCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_P2P_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_P2P_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             writeStatus = FAIL;
@@ -14048,7 +14276,7 @@ static NET_CMD_STATUS_e getImgSettingCfg(UINT16 fromIndex, UINT16 toIndex, UINT1
 {
     UINT16                  fieldLoop;
     UINT16                  indexLoop;
-    UINT16                  outLen = 0;
+    UINT32                  outLen = 0;
     IMG_SETTING_CONFIG_t    imgSettingCfg;
 
     for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
@@ -14057,7 +14285,7 @@ static NET_CMD_STATUS_e getImgSettingCfg(UINT16 fromIndex, UINT16 toIndex, UINT1
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -14165,7 +14393,7 @@ static NET_CMD_STATUS_e getImgSettingCfg(UINT16 fromIndex, UINT16 toIndex, UINT1
             //Validate Buffer size for add last two character including NULL
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -14175,7 +14403,7 @@ static NET_CMD_STATUS_e getImgSettingCfg(UINT16 fromIndex, UINT16 toIndex, UINT1
         //Validate Buffer size
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -14213,7 +14441,7 @@ static NET_CMD_STATUS_e setImgSettingCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_IMG_SETTING_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_IMG_SETTING_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -14406,13 +14634,13 @@ static NET_CMD_STATUS_e getDhcpServerCfg(UINT16 fromIndex, UINT16 toIndex, UINT1
 {
     DHCP_SERVER_CONFIG_t    dhcpServerCfg;
     UINT16                  fieldLoop;
-    UINT16                  outLen;
+    UINT32                  outLen;
 
     //Validate Buffer size for add last two character including NULL
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -14456,7 +14684,7 @@ static NET_CMD_STATUS_e getDhcpServerCfg(UINT16 fromIndex, UINT16 toIndex, UINT1
         //Validate buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -14494,7 +14722,7 @@ static NET_CMD_STATUS_e setDhcpServerCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_DHCP_SERVER_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_DHCP_SERVER_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -14592,13 +14820,13 @@ static NET_CMD_STATUS_e getFirmwareManagementCfg(UINT16 fromIndex, UINT16 toInde
 {
     FIRMWARE_MANAGEMENT_CONFIG_t 	firmwareManagementCfg;
     UINT16                          fieldLoop;
-    UINT16                          outLen;
+    UINT32                          outLen;
 
     //Validate Buffer size for add last two character including NULL
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if(outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -14646,7 +14874,7 @@ static NET_CMD_STATUS_e getFirmwareManagementCfg(UINT16 fromIndex, UINT16 toInde
         //Validate buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -14684,7 +14912,7 @@ static NET_CMD_STATUS_e setFirmwareManagementCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_FIRMWARE_MANAGEMENT_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_FIRMWARE_MANAGEMENT_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -14791,18 +15019,18 @@ static NET_CMD_STATUS_e getFcmPushNotificationCfg(UINT16 fromIndex, UINT16 toInd
 {
     FCM_PUSH_NOTIFY_CONFIG_t    fcmPushNotifyCfg;
     UINT16                      fieldLoop;
-    UINT16                      outLen;
+    UINT32                      outLen;
 
     //Validate Buffer size for add last two character including NULL
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
 
     if (outLen > respStrLen - 2)
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
-    ReadFcmPushNotifyConfig(&fcmPushNotifyCfg);
+    ReadSingleFcmPushNotificationConfig(fromIndex, &fcmPushNotifyCfg);
 
     for (fieldLoop = fromField; fieldLoop <= toField; fieldLoop++)
     {
@@ -14827,7 +15055,7 @@ static NET_CMD_STATUS_e getFcmPushNotificationCfg(UINT16 fromIndex, UINT16 toInd
         //Validate buffer size for add last two character including NULL
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -14864,7 +15092,7 @@ static NET_CMD_STATUS_e setFcmPushNotificationCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_FCM_PUSH_NOTIFICATION_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_FCM_PUSH_NOTIFICATION_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             writeStatus = FAIL;
@@ -14955,7 +15183,7 @@ static NET_CMD_STATUS_e getPasswordRecoveryCfg(UINT16 fromIndex, UINT16 toIndex,
     UINT16                      fieldLoop;
     UINT16                      indexLoop;
     PASSWORD_RECOVERY_CONFIG_t	pwdRecoveryCfg;
-    UINT16                      outLen = 0;
+    UINT32                      outLen = 0;
 
     for (indexLoop = fromIndex; indexLoop <= toIndex; indexLoop++)
     {
@@ -14963,7 +15191,7 @@ static NET_CMD_STATUS_e getPasswordRecoveryCfg(UINT16 fromIndex, UINT16 toIndex,
         outLen += snprintf(respStringPtr + outLen, respStrLen - outLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(indexLoop), FSP);
         if(outLen > respStrLen - 2)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
         }
 
@@ -15007,7 +15235,7 @@ static NET_CMD_STATUS_e getPasswordRecoveryCfg(UINT16 fromIndex, UINT16 toIndex,
             /* Validate Buffer size for add last two character including NULL */
             if(outLen > respStrLen - 2)
             {
-                EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+                DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
                 outLen = respStrLen - 2;
                 break;
             }
@@ -15017,7 +15245,7 @@ static NET_CMD_STATUS_e getPasswordRecoveryCfg(UINT16 fromIndex, UINT16 toIndex,
         /* Validate Buffer size */
         if(outLen > respStrLen)
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen;
             break;
         }
@@ -15052,7 +15280,7 @@ static NET_CMD_STATUS_e setPasswordRecoveryCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_PASSWORD_RECOVERY_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_PASSWORD_RECOVERY_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -15159,7 +15387,7 @@ static NET_CMD_STATUS_e getStorageAllocationCfg(UINT16 fromIndex, UINT16 toIndex
 {
     UINT8                       maskId;
     UINT8                       volGrpId;
-    UINT16                      outLen;
+    UINT32                      outLen;
     UINT16                      fieldLoop;
     STORAGE_ALLOCATION_CONFIG_t storageAllocationCfg;
 
@@ -15167,7 +15395,7 @@ static NET_CMD_STATUS_e getStorageAllocationCfg(UINT16 fromIndex, UINT16 toIndex
     outLen = snprintf(respStringPtr, respStrLen, "%c%d%c", SOI, OUR_TO_CLIENT_INDEX(fromIndex), FSP);
     if (outLen > (respStrLen - 2))
     {
-        EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+        DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
         outLen = respStrLen - 2;
     }
 
@@ -15193,7 +15421,7 @@ static NET_CMD_STATUS_e getStorageAllocationCfg(UINT16 fromIndex, UINT16 toIndex
         /* Validate buffer size for add last two character including NULL */
         if (outLen > (respStrLen - 2))
         {
-            EPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
+            DPRINT(NETWORK_MANAGER, "length is greater than buffer: [outLen=%d]", outLen);
             outLen = respStrLen - 2;
             break;
         }
@@ -15233,7 +15461,7 @@ static NET_CMD_STATUS_e setStorageAllocationCfg(CHARPTR *reqStr)
             break;
         }
 
-        if (indexId > (UINT64)totalIndexPerEveryTable[TBL_STORAGE_ALLOCATION_CFG])
+        if ((indexId == 0) || (indexId > (UINT64)totalIndexPerEveryTable[TBL_STORAGE_ALLOCATION_CFG]))
         {
             retVal = CMD_INVALID_INDEX_ID;
             break;
@@ -547,6 +547,13 @@ static BOOL openFileXferSession(FILE_XFER_SESSION_t *sessionPtr)
         {
             snprintf(sessionPtr->fileName, sizeof(sessionPtr->fileName), CONFIG_BACKUP_FILE_NAME, SOFTWARE_VERSION, SOFTWARE_REVISION);
             snprintf(sessionPtr->absoluteFilePath, MAX_FILE_PATH_LENGTH, RAMFS_DIR_PATH"%s", sessionPtr->fileName);
+
+            /* Config files must have all committed updates of config journal before taking backup */
+            if (FAIL == FlushConfigJournal())
+            {
+                WPRINT(NETWORK_MANAGER, "fail to flush config journal before backup");
+            }
+
             snprintf(cmdBuff, sizeof(cmdBuff), "zip -r %s %s %s -x %s",
                     sessionPtr->absoluteFilePath, APP_CONFIG_DIR_PATH, LANGUAGES_DIR_PATH, SAMPLE_LANGUAGE_FILE); // include language file excluding sample file.
             if(FAIL == ExeSysCmd(TRUE, cmdBuff))
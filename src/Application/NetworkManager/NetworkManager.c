@@ -11,6 +11,9 @@
 //#################################################################################################
 // @INCLUDES
 //#################################################################################################
+/* OS Includes */
+#include <sys/epoll.h>
+
 /* Library Includes */
 #include <jansson.h>
 
@@ -63,6 +66,14 @@
 /* Stack Size for threads */
 #define INT_NW_MNGR_THREAD_STACK_SZ     (1*MEGA_BYTE)
 #define EXT_NW_MNGR_THREAD_STACK_SZ     (0*MEGA_BYTE)
+#define EXT_NW_WORKER_THREAD_STACK_SZ   (0*MEGA_BYTE)
+
+/* External server connections and message processing */
+#define EXT_NW_RECV_CONN_MAX            (MAX_CONCURRANT_REQ * 2)
+#define EXT_NW_MSG_QUEUE_MAX            (MAX_CONCURRANT_REQ)
+#define EXT_NW_WORKER_THREAD_MAX        4
+#define EXT_NW_EPOLL_EVENT_MAX          16
+#define EXT_NW_SERVER_EPOLL_ID          0xFFFFFFFF
 
 //#################################################################################################
 // @DATA TYPES
@@ -84,14 +95,39 @@ typedef struct
 
 }NETWORK_MANAGER_SERVER_PARA_t;
 
+typedef struct
+{
+    INT32               sockFd;
+    SOCK_ADDR_INFO_u    sockAddr;
+    UINT64              acceptTimeInSec;
+    UINT32              recvLen;
+    CHARPTR             pRecvMsg;
+
+}EXT_NW_CONN_t;
+
+typedef struct
+{
+    pthread_mutex_t     queueLock;
+    pthread_cond_t      queueSignal;
+    UINT32              readIdx;
+    UINT32              writeIdx;
+    UINT32              msgCnt;
+    EXT_NW_CONN_t       msg[EXT_NW_MSG_QUEUE_MAX];
+
+}EXT_NW_MSG_QUEUE_t;
+
 //#################################################################################################
 // @STATIC VARIABLES
 //#################################################################################################
 static INT32                            internalServerSockFd = INVALID_CONNECTION;
 static NETWORK_MANAGER_SERVER_PARA_t    networkManagerInfo;
+static EXT_NW_CONN_t                    extNwRecvConn[EXT_NW_RECV_CONN_MAX];
+static EXT_NW_MSG_QUEUE_t               extNwMsgQueue;
+static pthread_mutex_t                  extNwSessionLock = PTHREAD_MUTEX_INITIALIZER;
 
 static const CHARPTR    deviceSubsystemStr[DEVICE_SUBSYSTEM_MAX] ={"block", "usb", "tty", "net", "input"};
 static const UINT8      deviceSubsystemArgs[DEVICE_SUBSYSTEM_MAX] = {4, 14, 3, 2, 1};
+static STR_INDEX_TABLE_t headerReqIndexTbl = STR_INDEX_TABLE_INIT(headerReq, MAX_HEADER_REQ);
 
 //#################################################################################################
 // @PROTOTYPES
@@ -103,6 +139,20 @@ static VOIDPTR runNetworkManagerMain(VOIDPTR arg);
 //-------------------------------------------------------------------------------------------------
 static BOOL initExternalNw(void);
 //-------------------------------------------------------------------------------------------------
+static void acceptExtNwConn(INT32 epollFd);
+//-------------------------------------------------------------------------------------------------
+static void recvExtNwConnMsg(INT32 epollFd, UINT32 connIdx);
+//-------------------------------------------------------------------------------------------------
+static void closeExtNwConn(INT32 epollFd, UINT32 connIdx);
+//-------------------------------------------------------------------------------------------------
+static void checkExtNwConnTimeout(INT32 epollFd, UINT64 currTimeInSec);
+//-------------------------------------------------------------------------------------------------
+static BOOL startExtNwWorkers(void);
+//-------------------------------------------------------------------------------------------------
+static VOIDPTR extNwWorkerThread(VOIDPTR arg);
+//-------------------------------------------------------------------------------------------------
+static void processExtNwMsg(EXT_NW_CONN_t *pConn);
+//-------------------------------------------------------------------------------------------------
 static BOOL initInternalNw(void);
 //-------------------------------------------------------------------------------------------------
 static void sendWebStatusRespMsg(INT32 sockFd, UINT32 status);
@@ -130,12 +180,21 @@ BOOL InitNetworkManager(void)
 {
     GENERAL_CONFIG_t generalConfig;
 
+    /* Build message header lookup table */
+    InitStrIndexTable(&headerReqIndexTbl);
+
     /* Read general configuration */
     ReadGeneralConfig(&generalConfig);
 
     /* Start web server */
     WebServerServiceStartStop(START, generalConfig.httpPort);
 
+    /* Start workers which process messages of external network clients */
+    if (startExtNwWorkers() == FAIL)
+    {
+        return FAIL;
+    }
+
     /* Initialization of external network communication socket for local, device and mobile client */
     if (initExternalNw() == FAIL)
     {
@@ -200,7 +259,7 @@ NET_CMD_STATUS_e FindHeaderIndex(CHARPTR *pMsgBuff, UINT8 *pMsgId)
         return CMD_INVALID_SYNTAX;
     }
 
-    *pMsgId = ConvertStringToIndex(buf, headerReq, MAX_HEADER_REQ);
+    *pMsgId = FindStrIndex(&headerReqIndexTbl, buf);
     if(*pMsgId < MAX_HEADER_REQ)
     {
         return CMD_SUCCESS;
@@ -591,35 +650,57 @@ static VOIDPTR internalMsgServerLoop(VOIDPTR arg)
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   This is thread function.This function manages network connection. It sends and receives
- *          command from CMS/Web. It process message and send acknowledge to client. According Client
- *          it manages the session.
+ * @brief   This is thread function.This function manages network connection. It accepts connections
+ *          from CMS/Web and receives messages of all the connections concurrently using epoll. Complete
+ *          message is given to worker threads for processing, hence slow client can't block others.
+ *          It also manages keep alive and polling timers of sessions.
  * @param   arg
  */
 VOIDPTR runNetworkManagerMain(VOIDPTR arg)
 {
-    INT32                   clientSockFd = INVALID_CONNECTION;
-    SOCK_ADDR_INFO_u        clientSockAddr;
-    socklen_t               clientSockSize = sizeof(clientSockAddr);
-    UINT8                   msgId;
-    CHARPTR 				msgPtr;
-    CHAR                    clientAddrStr[IPV6_ADDR_LEN_MAX];
-    UINT16                  clientPort;
-    USER_ACCOUNT_CONFIG_t	userAccountConfig;
+    INT32                   epollFd;
+    INT32                   eventCnt, eventIdx;
+    struct epoll_event      epollEvent;
+    struct epoll_event      epollEventList[EXT_NW_EPOLL_EVENT_MAX];
     INT16 					curEventWriteIndex = 0;
     UINT64                  prevTimeInSec;
     UINT64                  currTimeInSec;
     UINT8                   sessionIdx;
+    UINT32                  connIdx;
     NET_CMD_STATUS_e        respStatus;
-    CHAR                    recvMsg[MAX_RCV_SZ];
-    UINT32                  recvMsgLen;
+    UINT8                   pollRespCnt, pollRespIdx;
+    INT32                   pollRespFd[MAX_NW_CLIENT];
+    NET_CMD_STATUS_e        pollRespStatus[MAX_NW_CLIENT];
     CHAR                    replyMsg[MAX_REPLY_SZ];
-    CHAR                    advncdetail[MAX_EVENT_ADVANCE_DETAIL_SIZE];
-    UINT8                   pollSts;
-    INT16                   pollRevent;
 
     THREAD_START("EXT_NW");
 
+    for (connIdx = 0; connIdx < EXT_NW_RECV_CONN_MAX; connIdx++)
+    {
+        extNwRecvConn[connIdx].sockFd = INVALID_CONNECTION;
+        extNwRecvConn[connIdx].pRecvMsg = NULL;
+    }
+
+    /* Create epoll and add server socket in it to get connection requests */
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd == INVALID_CONNECTION)
+    {
+        EPRINT(NETWORK_MANAGER, "fail to create epoll: [err=%s]", STR_ERR);
+        CloseSocket(&networkManagerInfo.nvrServerSockFd);
+        pthread_exit(NULL);
+    }
+
+    memset(&epollEvent, 0, sizeof(epollEvent));
+    epollEvent.events = EPOLLIN;
+    epollEvent.data.u32 = EXT_NW_SERVER_EPOLL_ID;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, networkManagerInfo.nvrServerSockFd, &epollEvent) != STATUS_OK)
+    {
+        EPRINT(NETWORK_MANAGER, "fail to add server socket in epoll: [err=%s]", STR_ERR);
+        close(epollFd);
+        CloseSocket(&networkManagerInfo.nvrServerSockFd);
+        pthread_exit(NULL);
+    }
+
     /* Initializa previous time variable for future reference */
     prevTimeInSec = GetMonotonicTimeInSec();
 
@@ -627,11 +708,6 @@ VOIDPTR runNetworkManagerMain(VOIDPTR arg)
     networkManagerInfo.terminateFlg = START;
     while(networkManagerInfo.terminateFlg == START)
     {
-        /* Separate 1 second timer managed for keepalive and polling timer counter because if any remote device is
-         * doing TCP flooding on server socket without any data then we will accept connection and will wait for
-         * 1 second for data from that connection and data is not available then we again wait for new connection.
-         * So that, select() API time out occures after ~1000 second (becases 1 sec wait in data receive). */
-
         /* Get current monotonic time */
         currTimeInSec = GetMonotonicTimeInSec();
 
@@ -641,9 +717,16 @@ VOIDPTR runNetworkManagerMain(VOIDPTR arg)
             /* Update previous monotonic time for future reference */
             prevTimeInSec = currTimeInSec;
 
+            /* Close connections which have not sent complete message in time */
+            checkExtNwConnTimeout(epollFd, currTimeInSec);
+
             /* Take a local copy of current event write index */
             curEventWriteIndex = GetCurrentEventWriteIndex();
 
+            /* Session timers and polling fd are also accessed by worker threads. Poll responses are sent after lock is released */
+            pollRespCnt = 0;
+            MUTEX_LOCK(extNwSessionLock);
+
             /* Check for all the active network sessions */
             for (sessionIdx = 0; sessionIdx < (MAX_NW_CLIENT - 1); sessionIdx++)
             {
@@ -697,409 +780,703 @@ VOIDPTR runNetworkManagerMain(VOIDPTR arg)
                 /* Polling timer is not expired and we don't have any event to send back then nothing to do */
                 if (respStatus != CMD_SUCCESS)
                 {
-                    INT32 pollFd = GetUserPollFd(sessionIdx);
-
-                    /* Check socket status, Send data only if it is active */
-                    if (TRUE == CheckSocketFdState(pollFd))
-                    {
-                        /* Prepare reply message with either event(s) available or no events available */
-                        snprintf(replyMsg, MAX_REPLY_SZ, "%c%s%c%d%c%c", SOM, headerReq[RSP_POL], FSP, respStatus, FSP, EOM);
+                    /* Take polling fd from session for response */
+                    pollRespFd[pollRespCnt] = GetUserPollFd(sessionIdx);
+                    pollRespStatus[pollRespCnt] = respStatus;
+                    pollRespCnt++;
+                    SetUserPollFd(sessionIdx, INVALID_CONNECTION);
+                }
+            }
+            MUTEX_UNLOCK(extNwSessionLock);
 
-                        /* Send replay message */
-                        SendToSocket(pollFd, (UINT8PTR)replyMsg, strlen(replyMsg), MESSAGE_REPLY_TIMEOUT);
-                    }
+            for (pollRespIdx = 0; pollRespIdx < pollRespCnt; pollRespIdx++)
+            {
+                /* Check socket status, Send data only if it is active */
+                if (TRUE == CheckSocketFdState(pollRespFd[pollRespIdx]))
+                {
+                    /* Prepare reply message with either event(s) available or no events available */
+                    snprintf(replyMsg, MAX_REPLY_SZ, "%c%s%c%d%c%c", SOM, headerReq[RSP_POL], FSP, pollRespStatus[pollRespIdx], FSP, EOM);
 
-                    /* Now close socket */
-                    close(pollFd);
-                    SetUserPollFd(sessionIdx, INVALID_CONNECTION);
+                    /* Send replay message */
+                    SendToSocket(pollRespFd[pollRespIdx], (UINT8PTR)replyMsg, strlen(replyMsg), MESSAGE_REPLY_TIMEOUT);
                 }
+
+                /* Now close socket */
+                close(pollRespFd[pollRespIdx]);
             }
 
             /* Check all password reset sessions timer */
             CheckPasswordResetSession();
         }
 
-        /* Is any event available on server socket? */
-        pollSts = GetSocketPollEvent(networkManagerInfo.nvrServerSockFd, (POLLRDNORM | POLLRDHUP), 1000, &pollRevent);
-
-        /* Check for event on FD with timeout */
-        if (TIMEOUT == pollSts)
+        /* Wait for connection request or data on connections */
+        eventCnt = epoll_wait(epollFd, epollEventList, EXT_NW_EPOLL_EVENT_MAX, 1000);
+        if (eventCnt < 0)
         {
-            /* It is timed-out. Hence again wait for new event */
+            if (errno != EINTR)
+            {
+                EPRINT(NETWORK_MANAGER, "epoll wait failed: [err=%s]", STR_ERR);
+            }
             continue;
         }
 
-        if (FAIL == pollSts)
+        for (eventIdx = 0; eventIdx < eventCnt; eventIdx++)
         {
-            /* Error in poll */
-            EPRINT(NETWORK_MANAGER, "poll failed");
-            continue;
+            if (epollEventList[eventIdx].data.u32 == EXT_NW_SERVER_EPOLL_ID)
+            {
+                /* There is a connection request */
+                acceptExtNwConn(epollFd);
+            }
+            else
+            {
+                /* Data or hangup on connection */
+                recvExtNwConnMsg(epollFd, epollEventList[eventIdx].data.u32);
+            }
         }
+    }
 
-        /* There is a connection request. So, Wait for client to connect */
-        clientSockFd = accept(networkManagerInfo.nvrServerSockFd, &clientSockAddr.sockAddr, &clientSockSize);
-        if(clientSockFd < 0)
+    /* Close connections which are receiving message */
+    for (connIdx = 0; connIdx < EXT_NW_RECV_CONN_MAX; connIdx++)
+    {
+        closeExtNwConn(epollFd, connIdx);
+    }
+    close(epollFd);
+
+    /* Now logout all users */
+    MUTEX_LOCK(extNwSessionLock);
+    for(sessionIdx = 0; sessionIdx < (MAX_NW_CLIENT - 1); sessionIdx++)
+    {
+        /* check if user session is assigned or not */
+        if (GetUserClientType(sessionIdx) >= NW_CLIENT_TYPE_P2P_MOBILE)
         {
-            /* Accept failed to try again */
-            EPRINT(NETWORK_MANAGER, "fail to accept connection: [err=%s]", STR_ERR);
+            /* session is not assigned to network manager */
             continue;
         }
 
-        /* We need to convert socket address from ipv6 to ipv4 if client is ipv4 */
-        ConvertIpv4MappedIpv6SockAddr(&clientSockAddr);
+        UserLogout(sessionIdx);
+    }
+    MUTEX_UNLOCK(extNwSessionLock);
+
+    /* Clear all password reset sessions */
+    for(sessionIdx = 0; sessionIdx < PWD_RST_SESSION_MAX; sessionIdx++)
+    {
+        DeallocPasswordResetSession(sessionIdx);
+    }
+
+    /* close server socket */
+    CloseSocket(&networkManagerInfo.nvrServerSockFd);
+
+    // Reinit network manager if restart
+    if(networkManagerInfo.terminateFlg == RESTART)
+    {
+        DPRINT(NETWORK_MANAGER, "network manager restarting...");
+
+        do
+        {
+            sleep(2);
+
+        } while(initExternalNw() == FAIL);
+    }
+
+    pthread_exit(NULL);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Accept connection request on external server socket and add connection in epoll to
+ *          receive message
+ * @param   epollFd
+ */
+static void acceptExtNwConn(INT32 epollFd)
+{
+    INT32               clientSockFd;
+    UINT32              connIdx;
+    SOCK_ADDR_INFO_u    clientSockAddr;
+    socklen_t           clientSockSize = sizeof(clientSockAddr);
+    CHAR                clientAddrStr[IPV6_ADDR_LEN_MAX];
+    struct epoll_event  epollEvent;
+
+    clientSockFd = accept(networkManagerInfo.nvrServerSockFd, &clientSockAddr.sockAddr, &clientSockSize);
+    if(clientSockFd < 0)
+    {
+        /* Accept failed to try again */
+        EPRINT(NETWORK_MANAGER, "fail to accept connection: [err=%s]", STR_ERR);
+        return;
+    }
+
+    /* We need to convert socket address from ipv6 to ipv4 if client is ipv4 */
+    ConvertIpv4MappedIpv6SockAddr(&clientSockAddr);
+
+    /* Make this connection as nonblocking */
+    if (FALSE == SetSockFdOption(clientSockFd))
+    {
         GetIpAddrStrFromSockAddr(&clientSockAddr, clientAddrStr, sizeof(clientAddrStr));
-        clientPort = GetHostPortFromSockAddr(&clientSockAddr);
+        EPRINT(NETWORK_MANAGER, "fail to set sock options: [fd=%d], [addr=%s:%d]", clientSockFd, clientAddrStr, GetHostPortFromSockAddr(&clientSockAddr));
+        CloseSocket(&clientSockFd);
+        return;
+    }
 
-        /* Make this connection as nonblocking */
-        if (FALSE == SetSockFdOption(clientSockFd))
+    /* Get free connection entry */
+    for (connIdx = 0; connIdx < EXT_NW_RECV_CONN_MAX; connIdx++)
+    {
+        if (extNwRecvConn[connIdx].sockFd == INVALID_CONNECTION)
         {
-            EPRINT(NETWORK_MANAGER, "fail to set sock options: [fd=%d], [addr=%s:%d]", clientSockFd, clientAddrStr, clientPort);
-            CloseSocket(&clientSockFd);
-            continue;
+            break;
         }
+    }
+
+    if (connIdx >= EXT_NW_RECV_CONN_MAX)
+    {
+        GetIpAddrStrFromSockAddr(&clientSockAddr, clientAddrStr, sizeof(clientAddrStr));
+        EPRINT(NETWORK_MANAGER, "max connections are receiving msg: [addr=%s:%d]", clientAddrStr, GetHostPortFromSockAddr(&clientSockAddr));
+        CloseSocket(&clientSockFd);
+        return;
+    }
+
+    extNwRecvConn[connIdx].pRecvMsg = malloc(MAX_RCV_SZ);
+    if (extNwRecvConn[connIdx].pRecvMsg == NULL)
+    {
+        EPRINT(NETWORK_MANAGER, "fail to alloc memory for msg: [fd=%d]", clientSockFd);
+        CloseSocket(&clientSockFd);
+        return;
+    }
+
+    memset(&epollEvent, 0, sizeof(epollEvent));
+    epollEvent.events = (EPOLLIN | EPOLLRDHUP);
+    epollEvent.data.u32 = connIdx;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, clientSockFd, &epollEvent) != STATUS_OK)
+    {
+        EPRINT(NETWORK_MANAGER, "fail to add connection in epoll: [fd=%d], [err=%s]", clientSockFd, STR_ERR);
+        FREE_MEMORY(extNwRecvConn[connIdx].pRecvMsg);
+        CloseSocket(&clientSockFd);
+        return;
+    }
+
+    extNwRecvConn[connIdx].sockFd = clientSockFd;
+    extNwRecvConn[connIdx].sockAddr = clientSockAddr;
+    extNwRecvConn[connIdx].acceptTimeInSec = GetMonotonicTimeInSec();
+    extNwRecvConn[connIdx].recvLen = 0;
+}
 
-        /* Receive message from socket */
-        memset(recvMsg, 0, sizeof(recvMsg));
-        if (RecvMessage(clientSockFd, recvMsg, &recvMsgLen, SOM, EOM, MAX_RCV_SZ-1, MAX_FRAME_WAIT_TIME) != SUCCESS)
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Receive available data of connection. Message must start with SOM and it is complete
+ *          when received data ends with EOM. Complete message is queued for worker threads.
+ * @param   epollFd
+ * @param   connIdx
+ */
+static void recvExtNwConnMsg(INT32 epollFd, UINT32 connIdx)
+{
+    INT32           recvCnt;
+    EXT_NW_CONN_t   *pConn;
+
+    if (connIdx >= EXT_NW_RECV_CONN_MAX)
+    {
+        return;
+    }
+
+    pConn = &extNwRecvConn[connIdx];
+    if (pConn->sockFd == INVALID_CONNECTION)
+    {
+        return;
+    }
+
+    /* Keep one byte for null termination */
+    recvCnt = recv(pConn->sockFd, (pConn->pRecvMsg + pConn->recvLen), ((MAX_RCV_SZ - 1) - pConn->recvLen), MSG_DONTWAIT);
+    if (recvCnt < 0)
+    {
+        if ((errno == EINTR) || (errno == EWOULDBLOCK) || (errno == EAGAIN))
         {
-            EPRINT(NETWORK_MANAGER, "external msg recv timeout or connection closed: [addr=%s:%d]", clientAddrStr, clientPort);
-            CloseSocket(&clientSockFd);
-            continue;
+            return;
         }
 
-        /* Add null in received message */
-        recvMsg[recvMsgLen] = '\0';
+        EPRINT(NETWORK_MANAGER, "external msg recv failed: [fd=%d], [err=%s]", pConn->sockFd, STR_ERR);
+        closeExtNwConn(epollFd, connIdx);
+        return;
+    }
 
-        /* Remove SOM from received data */
-        msgPtr = (recvMsg + 1);
+    if (recvCnt == 0)
+    {
+        EPRINT(NETWORK_MANAGER, "external msg connection closed: [fd=%d]", pConn->sockFd);
+        closeExtNwConn(epollFd, connIdx);
+        return;
+    }
 
-        //Get header
-        if(FindHeaderIndex(&msgPtr, &msgId) != CMD_SUCCESS)
+    pConn->recvLen += recvCnt;
+    if (pConn->pRecvMsg[0] != SOM)
+    {
+        EPRINT(NETWORK_MANAGER, "invld SOM found: [SOM=%x], [fd=%d]", pConn->pRecvMsg[0], pConn->sockFd);
+        closeExtNwConn(epollFd, connIdx);
+        return;
+    }
+
+    if (pConn->pRecvMsg[pConn->recvLen - 1] != EOM)
+    {
+        if (pConn->recvLen >= (MAX_RCV_SZ - 1))
         {
-            EPRINT(NETWORK_MANAGER, "fail to parse header index: [msg=%s], [addr=%s:%d]", msgPtr, clientAddrStr, clientPort);
-            CloseSocket(&clientSockFd);
-            continue;
+            EPRINT(NETWORK_MANAGER, "EOM not found: [fd=%d], [recv_len=%d]", pConn->sockFd, pConn->recvLen);
+            closeExtNwConn(epollFd, connIdx);
         }
+        return;
+    }
 
-        /* Check for request type */
-        switch(msgId)
-        {
-            case REQ_LOG:
-            {
-                /* process client's login request, validations and appropriate response */
-                ProcessClientLoginRequest(msgPtr, &clientSockAddr, clientSockFd, CLIENT_CB_TYPE_NATIVE, NW_CLIENT_TYPE_MAX, &sessionIdx);
-            }
-            break;
+    /* Message is complete, remove connection from epoll and give it to worker */
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, pConn->sockFd, NULL);
+    MUTEX_LOCK(extNwMsgQueue.queueLock);
+    if (extNwMsgQueue.msgCnt >= EXT_NW_MSG_QUEUE_MAX)
+    {
+        MUTEX_UNLOCK(extNwMsgQueue.queueLock);
+        EPRINT(NETWORK_MANAGER, "external msg queue full: [fd=%d]", pConn->sockFd);
+        CloseSocket(&pConn->sockFd);
+        FREE_MEMORY(pConn->pRecvMsg);
+        return;
+    }
 
-            case REQ_POL:
-            {
-                /* find session index from session id */
-                if (FindSessionIndex(&msgPtr, &sessionIdx) != CMD_SUCCESS)
-                {
-                    EPRINT(NETWORK_MANAGER, "invld session id found: [msg=%s], [addr=%s:%d]", headerReq[msgId], clientAddrStr, clientPort);
-                    break;
-                }
+    extNwMsgQueue.msg[extNwMsgQueue.writeIdx] = *pConn;
+    extNwMsgQueue.writeIdx = (extNwMsgQueue.writeIdx + 1) % EXT_NW_MSG_QUEUE_MAX;
+    extNwMsgQueue.msgCnt++;
+    pthread_cond_signal(&extNwMsgQueue.queueSignal);
+    MUTEX_UNLOCK(extNwMsgQueue.queueLock);
 
-                /* if session is not active or polling is already on */
-                if ((FALSE == IsUserSessionActive(sessionIdx)) || (INVALID_CONNECTION != GetUserPollFd(sessionIdx)))
-                {
-                    break;
-                }
+    /* Message buffer and socket are owned by worker now */
+    pConn->sockFd = INVALID_CONNECTION;
+    pConn->pRecvMsg = NULL;
+}
 
-                /* reload keep alive */
-                ReloadUserKeepAlive(sessionIdx);
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Remove connection from epoll and close it
+ * @param   epollFd
+ * @param   connIdx
+ */
+static void closeExtNwConn(INT32 epollFd, UINT32 connIdx)
+{
+    if (extNwRecvConn[connIdx].sockFd == INVALID_CONNECTION)
+    {
+        return;
+    }
 
-                /* take local copy of event write index */
-                curEventWriteIndex = GetCurrentEventWriteIndex();
-                if (curEventWriteIndex != GetUserEventReadIndex(sessionIdx))
-                {
-                    /* event available */
-                    snprintf(replyMsg, MAX_REPLY_SZ, "%c%s%c%02d%c%c", SOM, headerReq[RSP_POL], FSP, CMD_EVENT_AVAILABLE, FSP, EOM);
-                    SendToSocket(clientSockFd, (UINT8PTR)replyMsg, strlen(replyMsg),MESSAGE_REPLY_TIMEOUT);
-                }
-                else
-                {
-                    /* event not available, store client polling fd and wait for event to be available */
-                    SetUserPollFd(sessionIdx, clientSockFd);
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, extNwRecvConn[connIdx].sockFd, NULL);
+    CloseSocket(&extNwRecvConn[connIdx].sockFd);
+    FREE_MEMORY(extNwRecvConn[connIdx].pRecvMsg);
+}
 
-                    /* re-load poll timer */
-                    ReloadUserPollTimer(sessionIdx);
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Close connections which have not sent complete message within timeout
+ * @param   epollFd
+ * @param   currTimeInSec
+ */
+static void checkExtNwConnTimeout(INT32 epollFd, UINT64 currTimeInSec)
+{
+    UINT32  connIdx;
+    CHAR    clientAddrStr[IPV6_ADDR_LEN_MAX];
 
-                    /* Don't close this connection as we have stored fd */
-                    clientSockFd = INVALID_CONNECTION;
-                }
-            }
-            break;
+    for (connIdx = 0; connIdx < EXT_NW_RECV_CONN_MAX; connIdx++)
+    {
+        if ((extNwRecvConn[connIdx].sockFd == INVALID_CONNECTION)
+                || ((currTimeInSec - extNwRecvConn[connIdx].acceptTimeInSec) <= MAX_FRAME_WAIT_TIME))
+        {
+            continue;
+        }
 
-            case GET_CFG:
-            {
-                /* find session index from session id */
-                if (FindSessionIndex(&msgPtr, &sessionIdx) != CMD_SUCCESS)
-                {
-                    EPRINT(NETWORK_MANAGER, "invld session id found: [msg=%s], [addr=%s:%d]", headerReq[msgId], clientAddrStr, clientPort);
-                    break;
-                }
+        GetIpAddrStrFromSockAddr(&extNwRecvConn[connIdx].sockAddr, clientAddrStr, sizeof(clientAddrStr));
+        EPRINT(NETWORK_MANAGER, "external msg recv timeout: [addr=%s:%d], [recv_len=%d]", clientAddrStr,
+               GetHostPortFromSockAddr(&extNwRecvConn[connIdx].sockAddr), extNwRecvConn[connIdx].recvLen);
+        closeExtNwConn(epollFd, connIdx);
+    }
+}
 
-                /* check if user is active */
-                if (FALSE == IsUserSessionActive(sessionIdx))
-                {
-                    EPRINT(NETWORK_MANAGER, "user session is not active: [msg=%s], [sessionIdx=%d], [addr=%s:%d]", headerReq[msgId], sessionIdx,
-                           clientAddrStr, clientPort);
-                    break;
-                }
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Start worker threads which process messages received on external server
+ * @return  SUCCESS/FAIL
+ */
+static BOOL startExtNwWorkers(void)
+{
+    UINT8 workerIdx;
 
-                /* reload keep alive timer */
-                ReloadUserKeepAlive(sessionIdx);
+    MUTEX_INIT(extNwMsgQueue.queueLock, NULL);
+    pthread_cond_init(&extNwMsgQueue.queueSignal, NULL);
+    extNwMsgQueue.readIdx = 0;
+    extNwMsgQueue.writeIdx = 0;
+    extNwMsgQueue.msgCnt = 0;
 
-                /* process config request */
-                ProcessGetConfig(msgPtr, clientSockFd, CLIENT_CB_TYPE_NATIVE);
-            }
-            break;
+    for (workerIdx = 0; workerIdx < EXT_NW_WORKER_THREAD_MAX; workerIdx++)
+    {
+        if (FALSE == Utils_CreateThread(NULL, extNwWorkerThread, NULL, DETACHED_THREAD, EXT_NW_WORKER_THREAD_STACK_SZ))
+        {
+            EPRINT(NETWORK_MANAGER, "fail to create external msg worker thread: [workerIdx=%d]", workerIdx);
+            return (workerIdx == 0) ? FAIL : SUCCESS;
+        }
+    }
 
-            case SET_CFG:
-            {
-                /* find session index from session id */
-                if (FindSessionIndex(&msgPtr, &sessionIdx) != CMD_SUCCESS)
-                {
-                    EPRINT(NETWORK_MANAGER, "invld session id found: [msg=%s], [addr=%s:%d]", headerReq[msgId], clientAddrStr, clientPort);
-                    break;
-                }
+    return SUCCESS;
+}
 
-                /* check if user is active */
-                if (FALSE == IsUserSessionActive(sessionIdx))
-                {
-                    EPRINT(NETWORK_MANAGER, "user session is not active: [msg=%s], [sessionIdx=%d], [addr=%s:%d]", headerReq[msgId], sessionIdx,
-                           clientAddrStr, clientPort);
-                    break;
-                }
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Worker thread function. It processes queued messages of external server.
+ * @param   arg
+ */
+static VOIDPTR extNwWorkerThread(VOIDPTR arg)
+{
+    EXT_NW_CONN_t conn;
 
-                /* reload keep alive timer */
-                ReloadUserKeepAlive(sessionIdx);
-                ReadSingleUserAccountConfig(GetUserAccountIndex(sessionIdx), &userAccountConfig);
+    THREAD_START("EXT_NW_WORKER");
 
-                /* check user rights */
-                if (userAccountConfig.userGroup != ADMIN)
-                {
-                    /* Config change not allowed to other than admin group */
-                    snprintf(replyMsg, MAX_REPLY_SZ, "%c%s%c%d%c%c", SOM, headerReq[RPL_CFG], FSP, CMD_NO_PRIVILEGE, FSP, EOM);
-                    SendToSocket(clientSockFd, (UINT8PTR)replyMsg, strlen(replyMsg), MESSAGE_REPLY_TIMEOUT);
-                    break;
-                }
+    while (TRUE)
+    {
+        MUTEX_LOCK(extNwMsgQueue.queueLock);
+        while (extNwMsgQueue.msgCnt == 0)
+        {
+            pthread_cond_wait(&extNwMsgQueue.queueSignal, &extNwMsgQueue.queueLock);
+        }
 
-                /* Check from where request has been received. If IP is local host than it is local client */
-                if ((clientSockAddr.sockAddr.sa_family == AF_INET) && (clientSockAddr.sockAddr4.sin_addr.s_addr == LOCAL_USER_IP))
-                {
-                    /* Add user name and local client string in advance details of event log */
-                    snprintf(advncdetail, MAX_EVENT_ADVANCE_DETAIL_SIZE, "%s | "LOCAL_CLIENT_EVT_STR, userAccountConfig.username);
-                }
-                else
-                {
-                    /* Now either it is device client or it is mobile client. Add user name, device client or mobile client stirng,
-                     * and add its IP address in event log for better identification */
-                    snprintf(advncdetail, MAX_EVENT_ADVANCE_DETAIL_SIZE, "%s | %s | %s", userAccountConfig.username,
-                             (NW_CLIENT_TYPE_WEB == GetUserClientType(sessionIdx)) ? DEVICE_CLIENT_EVT_STR : MOBILE_CLIENT_EVT_STR, clientAddrStr);
-                }
+        conn = extNwMsgQueue.msg[extNwMsgQueue.readIdx];
+        extNwMsgQueue.readIdx = (extNwMsgQueue.readIdx + 1) % EXT_NW_MSG_QUEUE_MAX;
+        extNwMsgQueue.msgCnt--;
+        MUTEX_UNLOCK(extNwMsgQueue.queueLock);
 
-                /* Start processing the SET_CFG request */
-                ProcessSetConfig(msgPtr, clientSockFd, advncdetail, CLIENT_CB_TYPE_NATIVE);
-            }
-            break;
+        processExtNwMsg(&conn);
+        FREE_MEMORY(conn.pRecvMsg);
+    }
 
-            case DEF_CFG:
-            {
-                /* find session index from session id */
-                if (FindSessionIndex(&msgPtr, &sessionIdx) != CMD_SUCCESS)
-                {
-                    EPRINT(NETWORK_MANAGER, "invld session id found: [msg=%s], [addr=%s:%d]", headerReq[msgId], clientAddrStr, clientPort);
-                    break;
-                }
+    return NULL;
+}
 
-                /* check if user is active */
-                if (FALSE == IsUserSessionActive(sessionIdx))
-                {
-                    EPRINT(NETWORK_MANAGER, "user session is not active: [msg=%s], [sessionIdx=%d], [addr=%s:%d]", headerReq[msgId], sessionIdx,
-                           clientAddrStr, clientPort);
-                    break;
-                }
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Process message received on external server and send response to client
+ * @param   pConn - Connection with received message
+ */
+static void processExtNwMsg(EXT_NW_CONN_t *pConn)
+{
+    INT32                   clientSockFd = pConn->sockFd;
+    SOCK_ADDR_INFO_u        clientSockAddr = pConn->sockAddr;
+    UINT8                   msgId;
+    CHARPTR 				msgPtr;
+    CHARPTR                 recvMsg = pConn->pRecvMsg;
+    UINT32                  recvMsgLen = pConn->recvLen;
+    CHAR                    clientAddrStr[IPV6_ADDR_LEN_MAX];
+    UINT16                  clientPort;
+    USER_ACCOUNT_CONFIG_t	userAccountConfig;
+    INT16 					curEventWriteIndex;
+    UINT8                   sessionIdx;
+    CHAR                    replyMsg[MAX_REPLY_SZ];
+    CHAR                    advncdetail[MAX_EVENT_ADVANCE_DETAIL_SIZE];
+    BOOL                    pollRespF;
 
-                /* reload keep alive timer */
-                ReloadUserKeepAlive(sessionIdx);
-                ReadSingleUserAccountConfig(GetUserAccountIndex(sessionIdx), &userAccountConfig);
+    GetIpAddrStrFromSockAddr(&clientSockAddr, clientAddrStr, sizeof(clientAddrStr));
+    clientPort = GetHostPortFromSockAddr(&clientSockAddr);
 
-                /* check user rights */
-                if (userAccountConfig.userGroup != ADMIN)
-                {
-                    /* Config change not allowed to other than admin group */
-                    snprintf(replyMsg, MAX_REPLY_SZ, "%c%s%c%d%c%c", SOM, headerReq[RPL_CFG], FSP, CMD_NO_PRIVILEGE, FSP, EOM);
-                    SendToSocket(clientSockFd, (UINT8PTR)replyMsg, strlen(replyMsg), MESSAGE_REPLY_TIMEOUT);
-                    break;
-                }
+    /* Add null in received message */
+    recvMsg[recvMsgLen] = '\0';
 
-                /* Check from where request has been received. If IP is local host than it is local client */
-                if ((clientSockAddr.sockAddr.sa_family == AF_INET) && (clientSockAddr.sockAddr4.sin_addr.s_addr == LOCAL_USER_IP))
-                {
-                    /* Add user name and local client string in advance details of event log */
-                    snprintf(advncdetail, MAX_EVENT_ADVANCE_DETAIL_SIZE, "%s | "LOCAL_CLIENT_EVT_STR, userAccountConfig.username);
-                }
-                else
-                {
-                    /* Now either it is device client or it is mobile client. Add user name, device client or mobile client stirng,
-                     * and add its IP address in event log for better identification */
-                    snprintf(advncdetail, MAX_EVENT_ADVANCE_DETAIL_SIZE, "%s | %s | %s", userAccountConfig.username,
-                             (NW_CLIENT_TYPE_WEB == GetUserClientType(sessionIdx)) ? DEVICE_CLIENT_EVT_STR : MOBILE_CLIENT_EVT_STR, clientAddrStr);
-                }
+    /* Remove SOM from received data */
+    msgPtr = (recvMsg + 1);
 
-                /* process default config request */
-                ProcessDefConfig(msgPtr, clientSockFd, advncdetail, CLIENT_CB_TYPE_NATIVE);
+    //Get header
+    if(FindHeaderIndex(&msgPtr, &msgId) != CMD_SUCCESS)
+    {
+        EPRINT(NETWORK_MANAGER, "fail to parse header index: [msg=%s], [addr=%s:%d]", msgPtr, clientAddrStr, clientPort);
+        CloseSocket(&clientSockFd);
+        return;
+    }
+
+    /* Check for request type */
+    switch(msgId)
+    {
+        case REQ_LOG:
+        {
+            /* process client's login request, validations and appropriate response */
+            ProcessClientLoginRequest(msgPtr, &clientSockAddr, clientSockFd, CLIENT_CB_TYPE_NATIVE, NW_CLIENT_TYPE_MAX, &sessionIdx);
+        }
+        break;
+
+        case REQ_POL:
+        {
+            /* find session index from session id */
+            if (FindSessionIndex(&msgPtr, &sessionIdx) != CMD_SUCCESS)
+            {
+                EPRINT(NETWORK_MANAGER, "invld session id found: [msg=%s], [addr=%s:%d]", headerReq[msgId], clientAddrStr, clientPort);
+                break;
             }
-            break;
 
-            case SET_CMD:
+            /* Poll fd and session timers are also handled by timer of main thread. Response is sent after lock is released */
+            pollRespF = FALSE;
+            MUTEX_LOCK(extNwSessionLock);
+
+            /* if session is not active or polling is already on */
+            if ((FALSE == IsUserSessionActive(sessionIdx)) || (INVALID_CONNECTION != GetUserPollFd(sessionIdx)))
             {
-                /* find session index from session id */
-                if (FindSessionIndex(&msgPtr, &sessionIdx) != CMD_SUCCESS)
-                {
-                    EPRINT(NETWORK_MANAGER, "invld session id found: [msg=%s], [addr=%s:%d]", headerReq[msgId], clientAddrStr, clientPort);
-                    break;
-                }
+                MUTEX_UNLOCK(extNwSessionLock);
+                break;
+            }
 
-                /* check if user is active */
-                if (FALSE == IsUserSessionActive(sessionIdx))
-                {
-                    EPRINT(NETWORK_MANAGER, "user session is not active: [msg=%s], [sessionIdx=%d], [addr=%s:%d]", headerReq[msgId], sessionIdx,
-                           clientAddrStr, clientPort);
-                    break;
-                }
+            /* reload keep alive */
+            ReloadUserKeepAlive(sessionIdx);
 
-                /* reload keep alive timer */
-                ReloadUserKeepAlive(sessionIdx);
+            /* take local copy of event write index */
+            curEventWriteIndex = GetCurrentEventWriteIndex();
+            if (curEventWriteIndex != GetUserEventReadIndex(sessionIdx))
+            {
+                /* event available */
+                pollRespF = TRUE;
+            }
+            else
+            {
+                /* event not available, store client polling fd and wait for event to be available */
+                SetUserPollFd(sessionIdx, clientSockFd);
 
-                /* Process set command request and provide the response to the client */
-                ProcessSetCommand(msgPtr, sessionIdx, clientSockFd, CLIENT_CB_TYPE_NATIVE);
+                /* re-load poll timer */
+                ReloadUserPollTimer(sessionIdx);
 
-                /* Don't close this connection as we have passed fd for further action */
+                /* Don't close this connection as we have stored fd */
                 clientSockFd = INVALID_CONNECTION;
             }
-            break;
+            MUTEX_UNLOCK(extNwSessionLock);
 
-            case REQ_EVT:
+            if (TRUE == pollRespF)
             {
-                /* find session index from session id */
-                if (FindSessionIndex(&msgPtr, &sessionIdx) != CMD_SUCCESS)
-                {
-                    EPRINT(NETWORK_MANAGER, "invld session id found: [msg=%s], [addr=%s:%d]", headerReq[msgId], clientAddrStr, clientPort);
-                    break;
-                }
+                snprintf(replyMsg, MAX_REPLY_SZ, "%c%s%c%02d%c%c", SOM, headerReq[RSP_POL], FSP, CMD_EVENT_AVAILABLE, FSP, EOM);
+                SendToSocket(clientSockFd, (UINT8PTR)replyMsg, strlen(replyMsg),MESSAGE_REPLY_TIMEOUT);
+            }
+        }
+        break;
 
-                /* check if user is active */
-                if (FALSE == IsUserSessionActive(sessionIdx))
-                {
-                    EPRINT(NETWORK_MANAGER, "user session is not active: [msg=%s], [sessionIdx=%d], [addr=%s:%d]", headerReq[msgId], sessionIdx,
-                           clientAddrStr, clientPort);
-                    break;
-                }
+        case GET_CFG:
+        {
+            /* find session index from session id */
+            if (FindSessionIndex(&msgPtr, &sessionIdx) != CMD_SUCCESS)
+            {
+                EPRINT(NETWORK_MANAGER, "invld session id found: [msg=%s], [addr=%s:%d]", headerReq[msgId], clientAddrStr, clientPort);
+                break;
+            }
 
-                /* reload keep alive timer */
-                ReloadUserKeepAlive(sessionIdx);
+            /* check if user is active */
+            if (FALSE == IsUserSessionActive(sessionIdx))
+            {
+                EPRINT(NETWORK_MANAGER, "user session is not active: [msg=%s], [sessionIdx=%d], [addr=%s:%d]", headerReq[msgId], sessionIdx,
+                       clientAddrStr, clientPort);
+                break;
+            }
 
-                /* Get and send live events to client */
-                GetLiveEvents(sessionIdx, clientSockFd, CLIENT_CB_TYPE_NATIVE);
+            /* reload keep alive timer */
+            ReloadUserKeepAlive(sessionIdx);
 
-                /* Don't close this connection as we have already closed */
-                clientSockFd = INVALID_CONNECTION;
+            /* process config request */
+            ProcessGetConfig(msgPtr, clientSockFd, CLIENT_CB_TYPE_NATIVE);
+        }
+        break;
+
+        case SET_CFG:
+        {
+            /* find session index from session id */
+            if (FindSessionIndex(&msgPtr, &sessionIdx) != CMD_SUCCESS)
+            {
+                EPRINT(NETWORK_MANAGER, "invld session id found: [msg=%s], [addr=%s:%d]", headerReq[msgId], clientAddrStr, clientPort);
+                break;
             }
-            break;
 
-            case REQ_FTS:
+            /* check if user is active */
+            if (FALSE == IsUserSessionActive(sessionIdx))
             {
-                /* find session index from session id */
-                if (FindSessionIndex(&msgPtr, &sessionIdx) != CMD_SUCCESS)
-                {
-                    snprintf(replyMsg, MAX_REPLY_SZ, "%c%s%c%d%c%c", SOM, headerReq[RPL_FTS], FSP, CMD_INVALID_SESSION, FSP, EOM);
-                    SendToSocket(clientSockFd, (UINT8PTR)replyMsg, strlen(replyMsg), MESSAGE_REPLY_TIMEOUT);
-                    break;
-                }
+                EPRINT(NETWORK_MANAGER, "user session is not active: [msg=%s], [sessionIdx=%d], [addr=%s:%d]", headerReq[msgId], sessionIdx,
+                       clientAddrStr, clientPort);
+                break;
+            }
 
-                /* check if user is active */
-                if (FALSE == IsUserSessionActive(sessionIdx))
-                {
-                    EPRINT(NETWORK_MANAGER, "user session is not active: [msg=%s], [sessionIdx=%d], [addr=%s:%d]", headerReq[msgId], sessionIdx,
-                           clientAddrStr, clientPort);
-                    break;
-                }
+            /* reload keep alive timer */
+            ReloadUserKeepAlive(sessionIdx);
+            ReadSingleUserAccountConfig(GetUserAccountIndex(sessionIdx), &userAccountConfig);
 
-                /* Process file transfer request */
-                ProcessFileTransferReq(&msgPtr, clientSockFd, sessionIdx);
+            /* check user rights */
+            if (userAccountConfig.userGroup != ADMIN)
+            {
+                /* Config change not allowed to other than admin group */
+                snprintf(replyMsg, MAX_REPLY_SZ, "%c%s%c%d%c%c", SOM, headerReq[RPL_CFG], FSP, CMD_NO_PRIVILEGE, FSP, EOM);
+                SendToSocket(clientSockFd, (UINT8PTR)replyMsg, strlen(replyMsg), MESSAGE_REPLY_TIMEOUT);
+                break;
+            }
 
-                /* Don't close this connection because we passed it for further action */
-                clientSockFd = INVALID_CONNECTION;
+            /* Check from where request has been received. If IP is local host than it is local client */
+            if ((clientSockAddr.sockAddr.sa_family == AF_INET) && (clientSockAddr.sockAddr4.sin_addr.s_addr == LOCAL_USER_IP))
+            {
+                /* Add user name and local client string in advance details of event log */
+                snprintf(advncdetail, MAX_EVENT_ADVANCE_DETAIL_SIZE, "%s | "LOCAL_CLIENT_EVT_STR, userAccountConfig.username);
             }
-            break;
+            else
+            {
+                /* Now either it is device client or it is mobile client. Add user name, device client or mobile client stirng,
+                 * and add its IP address in event log for better identification */
+                snprintf(advncdetail, MAX_EVENT_ADVANCE_DETAIL_SIZE, "%s | %s | %s", userAccountConfig.username,
+                         (NW_CLIENT_TYPE_WEB == GetUserClientType(sessionIdx)) ? DEVICE_CLIENT_EVT_STR : MOBILE_CLIENT_EVT_STR, clientAddrStr);
+            }
+
+            /* Start processing the SET_CFG request */
+            ProcessSetConfig(msgPtr, clientSockFd, advncdetail, CLIENT_CB_TYPE_NATIVE);
+        }
+        break;
 
-            case DOR_CMD:
+        case DEF_CFG:
+        {
+            /* find session index from session id */
+            if (FindSessionIndex(&msgPtr, &sessionIdx) != CMD_SUCCESS)
             {
-                /* Process door command request */
-                ProcessDoorCommand(msgPtr);
+                EPRINT(NETWORK_MANAGER, "invld session id found: [msg=%s], [addr=%s:%d]", headerReq[msgId], clientAddrStr, clientPort);
+                break;
             }
-            break;
 
-            case PWD_RST:
+            /* check if user is active */
+            if (FALSE == IsUserSessionActive(sessionIdx))
             {
-                /* Process Password Reset Command */
-                ProcessPasswordResetCmd(&msgPtr, &clientSockAddr, clientSockFd, CLIENT_CB_TYPE_NATIVE);
+                EPRINT(NETWORK_MANAGER, "user session is not active: [msg=%s], [sessionIdx=%d], [addr=%s:%d]", headerReq[msgId], sessionIdx,
+                       clientAddrStr, clientPort);
+                break;
+            }
 
-                /* Don't close this connection as we have passed fd for further action */
-                clientSockFd = INVALID_CONNECTION;
+            /* reload keep alive timer */
+            ReloadUserKeepAlive(sessionIdx);
+            ReadSingleUserAccountConfig(GetUserAccountIndex(sessionIdx), &userAccountConfig);
+
+            /* check user rights */
+            if (userAccountConfig.userGroup != ADMIN)
+            {
+                /* Config change not allowed to other than admin group */
+                snprintf(replyMsg, MAX_REPLY_SZ, "%c%s%c%d%c%c", SOM, headerReq[RPL_CFG], FSP, CMD_NO_PRIVILEGE, FSP, EOM);
+                SendToSocket(clientSockFd, (UINT8PTR)replyMsg, strlen(replyMsg), MESSAGE_REPLY_TIMEOUT);
+                break;
             }
-            break;
 
-            default:
+            /* Check from where request has been received. If IP is local host than it is local client */
+            if ((clientSockAddr.sockAddr.sa_family == AF_INET) && (clientSockAddr.sockAddr4.sin_addr.s_addr == LOCAL_USER_IP))
             {
-                /* Nothing to do */
-                EPRINT(NETWORK_MANAGER, "invld msg id recvd: [msgId=%d]", msgId);
+                /* Add user name and local client string in advance details of event log */
+                snprintf(advncdetail, MAX_EVENT_ADVANCE_DETAIL_SIZE, "%s | "LOCAL_CLIENT_EVT_STR, userAccountConfig.username);
             }
-            break;
+            else
+            {
+                /* Now either it is device client or it is mobile client. Add user name, device client or mobile client stirng,
+                 * and add its IP address in event log for better identification */
+                snprintf(advncdetail, MAX_EVENT_ADVANCE_DETAIL_SIZE, "%s | %s | %s", userAccountConfig.username,
+                         (NW_CLIENT_TYPE_WEB == GetUserClientType(sessionIdx)) ? DEVICE_CLIENT_EVT_STR : MOBILE_CLIENT_EVT_STR, clientAddrStr);
+            }
+
+            /* process default config request */
+            ProcessDefConfig(msgPtr, clientSockFd, advncdetail, CLIENT_CB_TYPE_NATIVE);
         }
+        break;
 
-        /* Close the connection if fd is valid */
-        CloseSocket(&clientSockFd);
-    }
+        case SET_CMD:
+        {
+            /* find session index from session id */
+            if (FindSessionIndex(&msgPtr, &sessionIdx) != CMD_SUCCESS)
+            {
+                EPRINT(NETWORK_MANAGER, "invld session id found: [msg=%s], [addr=%s:%d]", headerReq[msgId], clientAddrStr, clientPort);
+                break;
+            }
 
-    /* Now logout all users */
-    for(sessionIdx = 0; sessionIdx < (MAX_NW_CLIENT - 1); sessionIdx++)
-    {
-        /* check if user session is assigned or not */
-        if (GetUserClientType(sessionIdx) >= NW_CLIENT_TYPE_P2P_MOBILE)
+            /* check if user is active */
+            if (FALSE == IsUserSessionActive(sessionIdx))
+            {
+                EPRINT(NETWORK_MANAGER, "user session is not active: [msg=%s], [sessionIdx=%d], [addr=%s:%d]", headerReq[msgId], sessionIdx,
+                       clientAddrStr, clientPort);
+                break;
+            }
+
+            /* reload keep alive timer */
+            ReloadUserKeepAlive(sessionIdx);
+
+            /* Process set command request and provide the response to the client */
+            ProcessSetCommand(msgPtr, sessionIdx, clientSockFd, CLIENT_CB_TYPE_NATIVE);
+
+            /* Don't close this connection as we have passed fd for further action */
+            clientSockFd = INVALID_CONNECTION;
+        }
+        break;
+
+        case REQ_EVT:
         {
-            /* session is not assigned to network manager */
-            continue;
+            /* find session index from session id */
+            if (FindSessionIndex(&msgPtr, &sessionIdx) != CMD_SUCCESS)
+            {
+                EPRINT(NETWORK_MANAGER, "invld session id found: [msg=%s], [addr=%s:%d]", headerReq[msgId], clientAddrStr, clientPort);
+                break;
+            }
+
+            /* check if user is active */
+            if (FALSE == IsUserSessionActive(sessionIdx))
+            {
+                EPRINT(NETWORK_MANAGER, "user session is not active: [msg=%s], [sessionIdx=%d], [addr=%s:%d]", headerReq[msgId], sessionIdx,
+                       clientAddrStr, clientPort);
+                break;
+            }
+
+            /* reload keep alive timer */
+            ReloadUserKeepAlive(sessionIdx);
+
+            /* Get and send live events to client */
+            GetLiveEvents(sessionIdx, clientSockFd, CLIENT_CB_TYPE_NATIVE);
+
+            /* Don't close this connection as we have already closed */
+            clientSockFd = INVALID_CONNECTION;
         }
+        break;
 
-        UserLogout(sessionIdx);
-    }
+        case REQ_FTS:
+        {
+            /* find session index from session id */
+            if (FindSessionIndex(&msgPtr, &sessionIdx) != CMD_SUCCESS)
+            {
+                snprintf(replyMsg, MAX_REPLY_SZ, "%c%s%c%d%c%c", SOM, headerReq[RPL_FTS], FSP, CMD_INVALID_SESSION, FSP, EOM);
+                SendToSocket(clientSockFd, (UINT8PTR)replyMsg, strlen(replyMsg), MESSAGE_REPLY_TIMEOUT);
+                break;
+            }
 
-    /* Clear all password reset sessions */
-    for(sessionIdx = 0; sessionIdx < PWD_RST_SESSION_MAX; sessionIdx++)
-    {
-        DeallocPasswordResetSession(sessionIdx);
-    }
+            /* check if user is active */
+            if (FALSE == IsUserSessionActive(sessionIdx))
+            {
+                EPRINT(NETWORK_MANAGER, "user session is not active: [msg=%s], [sessionIdx=%d], [addr=%s:%d]", headerReq[msgId], sessionIdx,
+                       clientAddrStr, clientPort);
+                break;
+            }
 
-    /* close server socket */
-    CloseSocket(&networkManagerInfo.nvrServerSockFd);
+            /* Process file transfer request */
+            ProcessFileTransferReq(&msgPtr, clientSockFd, sessionIdx);
 
-    // Reinit network manager if restart
-    if(networkManagerInfo.terminateFlg == RESTART)
-    {
-        DPRINT(NETWORK_MANAGER, "network manager restarting...");
+            /* Don't close this connection because we passed it for further action */
+            clientSockFd = INVALID_CONNECTION;
+        }
+        break;
 
-        do
+        case DOR_CMD:
         {
-            sleep(2);
+            /* Process door command request */
+            ProcessDoorCommand(msgPtr);
+        }
+        break;
 
-        } while(initExternalNw() == FAIL);
+        case PWD_RST:
+        {
+            /* Process Password Reset Command */
+            ProcessPasswordResetCmd(&msgPtr, &clientSockAddr, clientSockFd, CLIENT_CB_TYPE_NATIVE);
+
+            /* Don't close this connection as we have passed fd for further action */
+            clientSockFd = INVALID_CONNECTION;
+        }
+        break;
+
+        default:
+        {
+            /* Nothing to do */
+            EPRINT(NETWORK_MANAGER, "invld msg id recvd: [msgId=%d]", msgId);
+        }
+        break;
     }
 
-    pthread_exit(NULL);
+    /* Close the connection if fd is valid */
+    CloseSocket(&clientSockFd);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -45,8 +45,6 @@ static void setNewPasswordCmd(CHARPTR *pCmdStr, UINT8 sessionIdx, INT32 clientSo
 //#################################################################################################
 // @STATIC VARIABLES
 //#################################################################################################
-static CHAR replyMsg[CLIENT_CB_TYPE_MAX][MAX_REPLY_SZ];
-
 static const CHARPTR pwdRstCmdStr[MAX_PWD_RST_CMD] =
 {
     "REQ_PWD_RST_SESSION",
@@ -177,7 +175,7 @@ static BOOL parsePasswordResetCmd(CHARPTR cmdStr, PWD_RST_CMD_TYPE_e *pCmdValue)
 static void sendPasswordResetResp(INT32 clientSocket, CLIENT_CB_TYPE_e clientCbType, NET_CMD_STATUS_e cmdResp, UINT32 payload)
 {
     UINT32  outLen;
-    CHARPTR respStringPtr = &replyMsg[clientCbType][0];
+    CHAR    respStringPtr[128];
 
     switch(cmdResp)
     {
@@ -187,14 +185,14 @@ static void sendPasswordResetResp(INT32 clientSocket, CLIENT_CB_TYPE_e clientCbT
         case CMD_MISMATCH_OTP:
         {
             /* Prepare message with one payload value */
-            outLen = snprintf(respStringPtr, MAX_REPLY_SZ, "%c%s%c%d%c%d%c%c", SOM, headerReq[RPL_PWD], FSP, cmdResp, FSP, payload, FSP, EOM);
+            outLen = snprintf(respStringPtr, sizeof(respStringPtr), "%c%s%c%d%c%d%c%c", SOM, headerReq[RPL_PWD], FSP, cmdResp, FSP, payload, FSP, EOM);
         }
         break;
 
         default:
         {
             /* Prepare message only with response code */
-            outLen = snprintf(respStringPtr, MAX_REPLY_SZ, "%c%s%c%d%c%c", SOM, headerReq[RPL_PWD], FSP, cmdResp, FSP, EOM);
+            outLen = snprintf(respStringPtr, sizeof(respStringPtr), "%c%s%c%d%c%c", SOM, headerReq[RPL_PWD], FSP, cmdResp, FSP, EOM);
         }
         break;
     }
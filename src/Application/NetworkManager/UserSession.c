@@ -1982,22 +1982,31 @@ BOOL IsPasswordResetSessionValid(INT32 sessionId, UINT8 *pSessionIdx)
  */
 void CheckPasswordResetSession(void)
 {
-    UINT8 index;
+    UINT8   index;
+    BOOL    expiredF;
+
     for (index = 0; index < PWD_RST_SESSION_MAX; index++)
     {
+        /* Sessions are also reloaded and freed by command processing threads */
+        MUTEX_LOCK(userPwdRstInfo[index].sessionLock);
         if (userPwdRstInfo[index].isSessionActive == FALSE)
         {
+            MUTEX_UNLOCK(userPwdRstInfo[index].sessionLock);
             continue;
         }
 
+        /* Timer is not started till session allocation is completed */
+        expiredF = FALSE;
         if (userPwdRstInfo[index].sessionTmrCnt)
         {
             /* decrement the timer counter */
             userPwdRstInfo[index].sessionTmrCnt--;
+            expiredF = (userPwdRstInfo[index].sessionTmrCnt == 0) ? TRUE : FALSE;
         }
+        MUTEX_UNLOCK(userPwdRstInfo[index].sessionLock);
 
         /* If timer expired */
-        if (userPwdRstInfo[index].sessionTmrCnt == 0)
+        if (TRUE == expiredF)
         {
             DeallocPasswordResetSession(index);
         }
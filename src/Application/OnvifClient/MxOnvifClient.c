@@ -14,6 +14,7 @@
 /* Application Includes */
 #include "DebugLog.h"
 #include "Utils.h"
+#include "SysTimer.h"
 #include "OnvifUtils.h"
 #include "MxOnvifClient.h"
 #include "OnvifCommand.h"
@@ -76,6 +77,21 @@
 /* Set approx stack size. It is tunable based on requirement */
 #define ONVIF_THRD_STACK_SIZE               (1*MEGA_BYTE)
 
+/* Workers are created on demand and parked after request. Workers above minimum exit after idle timeout */
+#define ONVIF_WORKER_MIN                    (4)
+#define ONVIF_WORKER_MAX                    (MAX_ONVIF_SESSION)
+#define ONVIF_WORKER_IDLE_TIMEOUT           (60)
+
+/* Soap contexts are kept per camera to reuse keep-alive connection of camera */
+#define ONVIF_SOAP_CACHE_MAX                (MAX_CAMERA * 2)
+#define ONVIF_SOAP_IDLE_TIMEOUT             (30)
+
+/* Capabilities of camera are kept on flash to start stream without full onvif sequence after reboot */
+#define ONVIF_CAM_CACHE_DIR                 CONFIG_DIR_PATH "/onvifCache"
+#define ONVIF_CAM_CACHE_FILE                ONVIF_CAM_CACHE_DIR "/OnvifCam%02d.cache"
+#define ONVIF_CAM_CACHE_VERSION             (1)
+#define ONVIF_CAM_CACHE_ID_LEN              (64)
+
 //#################################################################################################
 // @ENUMERATOR
 //#################################################################################################
@@ -218,6 +234,13 @@ typedef struct
     ONVIF_REQ_PARA_t 			onvifReqPara;
 }ONVIF_CLIENT_INFO_t;
 
+typedef struct
+{
+    SOAP_t                      *soap;
+    UINT8                       camIndex;
+    UINT32                      idleTick;
+}ONVIF_SOAP_CACHE_t;
+
 typedef struct
 {
     STREAM_CODEC_TYPE_e 		codec;
@@ -236,12 +259,96 @@ typedef struct
     ONVIF_CAMERA_CB				callBack;
 }ONVIF_DEVICE_DISCOVERY_INFO_t;
 
+typedef struct
+{
+    CHAR                        brand[MAX_BRAND_NAME_LEN];
+    CHAR                        model[MAX_MODEL_NAME_LEN];
+    CHAR                        serialNum[ONVIF_CAM_CACHE_ID_LEN];
+    CHAR                        firmwareVer[ONVIF_CAM_CACHE_ID_LEN];
+    CHAR                        ipAddr[IPV6_ADDR_LEN_MAX];
+    UINT16                      port;
+}ONVIF_CAM_CACHE_KEY_t;
+
+typedef struct
+{
+    BOOL                        validF;
+    UINT8                       codecSupported;
+    UINT8                       qualitySupported[MAX_VIDEO_CODEC - 1];
+    UINT16                      maxBitRateSupport[MAX_VIDEO_CODEC - 1];
+    UINT16                      minBitRateSupport[MAX_VIDEO_CODEC - 1];
+    UINT64                      framerateAvailable[MAX_VIDEO_CODEC - 1];
+    UINT8                       resolutionAvailable[MAX_VIDEO_CODEC - 1][MAX_RESOLUTION + 1];
+    UINT8                       profileSupported[MAX_VIDEO_CODEC - 1];  /* Index in mediaProfileStr */
+}ONVIF_CACHE_PROFILE_PARAM_t;
+
+typedef struct
+{
+    CHAR                        relativeUrl[MAX_CAMERA_URI_WIDTH];
+    TRANSPORT_TYPE_e            rtspTransportType;
+    RTSP_PROTOCOL_e             rtspProtocol;
+}ONVIF_CACHE_STREAM_URL_t;
+
+typedef struct
+{
+    UINT32                      version;
+    UINT32                      size;
+    ONVIF_CAM_CACHE_KEY_t       key;
+    CAPABILITY_TYPE             capabilitySupported;
+    ONVIF_CAMERA_INFO_t         camInfo;
+    ONVIF_CACHE_PROFILE_PARAM_t profileParam[MAX_PROFILE_SUPPORT];
+    ONVIF_CACHE_STREAM_URL_t    streamUrl[MAX_PROFILE_SUPPORT];
+}ONVIF_CAM_CACHE_FILE_t;
+
+/* Media profiles received from camera. These are applied on camera only after all profiles are received */
+typedef struct
+{
+    UINT8                       profileCnt;
+    ONVIF_MEDIA_PROFILE_INFO_t  mediaProfile[MAX_PROFILE_SUPPORT];
+    PROFILE_WISE_OPTION_PARAM_t *pProfileParam[MAX_PROFILE_SUPPORT];
+    MPEG4_PROFILE_e             mpeg4SupportedProfile;
+    H264_PROFILE_e              h264SupportedProfile;
+    BOOL                        ptzProfileAvailable;
+    CHAR                        ptzProfileToken[MAX_TOKEN_SIZE];
+    CHAR                        ptzConfigurationToken[MAX_TOKEN_SIZE];
+}ONVIF_MEDIA_PROFILE_SET_t;
+
+typedef struct
+{
+    pthread_mutex_t             cacheLock;
+    BOOL                        validF;         /* Capabilities are available for current camera session */
+    BOOL                        revalidateF;    /* Capabilities are restored from cache and not yet revalidated */
+    ONVIF_CAM_CACHE_KEY_t       key;            /* Identity reported by camera in current session */
+    CAPABILITY_TYPE             capabilitySupported;
+    ONVIF_CACHE_PROFILE_PARAM_t profileParam[MAX_PROFILE_SUPPORT];
+    ONVIF_CACHE_STREAM_URL_t    streamUrl[MAX_PROFILE_SUPPORT];
+    BOOL                        streamUrlUseF[MAX_PROFILE_SUPPORT];
+    ONVIF_MEDIA_PROFILE_SET_t   *pRevalidatedSet;   /* Changed profiles found in revalidation, not yet applied */
+    UINT32                      changedProfileMask; /* Profiles whose stream must be restarted after apply */
+}ONVIF_CAM_CACHE_t;
+
 //#################################################################################################
 // @STATIC_VARIABLES
 //#################################################################################################
 static ONVIF_CLIENT_INFO_t	onvifClientInfo[MAX_ONVIF_SESSION];
 static pthread_mutex_t		onvifStatusLock;
 static ONVIF_CAMERA_INFO_t	onvifCamInfo[MAX_CAMERA];
+static pthread_mutex_t		onvifWorkerLock;
+static pthread_cond_t		onvifWorkerSignal;
+static UINT16				onvifWorkerCnt;
+static UINT16				onvifIdleWorkerCnt;
+static UINT16				onvifReqQueueHead;
+static UINT16				onvifReqQueueCnt;
+static ONVIF_HANDLE			onvifReqQueue[MAX_ONVIF_SESSION];
+static pthread_mutex_t		onvifSoapCacheLock;
+static UINT16				onvifSoapCacheCnt;
+static ONVIF_SOAP_CACHE_t	onvifSoapCache[ONVIF_SOAP_CACHE_MAX];
+static ONVIF_CAM_CACHE_t	onvifCamCache[MAX_CAMERA];
+
+/* Media profile strings are stored as index in capability cache */
+static const CHARPTR mediaProfileStr[] =
+{
+    "", MEDIA_BASELINE_PROFILE, MEDIA_MAIN_PROFILE, MEDIA_EXTENDED_PROFILE, MEDIA_HIGH_PROFILE, MEDIA_MAIN10_PROFILE
+};
 
 /* NONE, LEFT, RIGHT, STOP */
 static const float panMultiplier[MAX_PTZ_PAN_OPTION] = {-1, 1};
@@ -390,7 +497,46 @@ static UINT8 OnvifIrLedModesMap[LED_MODE_MAX][2] =
 // @PROTOTYPES
 //#################################################################################################
 //-------------------------------------------------------------------------------------------------
-static void *onvifClientThread(void *data);
+static void *onvifWorkerThread(void *data);
+//-------------------------------------------------------------------------------------------------
+static void processOnvifRequest(UINT16 sessionIndex);
+//-------------------------------------------------------------------------------------------------
+static BOOL isOnvifPtzReqStale(UINT16 sessionIndex);
+//-------------------------------------------------------------------------------------------------
+static void dropOnvifPtzRequest(UINT16 sessionIndex);
+//-------------------------------------------------------------------------------------------------
+static SOAP_t *getOnvifSoap(UINT8 camIndex);
+//-------------------------------------------------------------------------------------------------
+static void putOnvifSoap(UINT8 camIndex, SOAP_t *soap, ONVIF_RESP_STATUS_e response);
+//-------------------------------------------------------------------------------------------------
+static void setOnvifCamCacheKey(UINT8 camIndex, SOAP_USER_DETAIL_t *user, CHARPTR brandName, CHARPTR modelName,
+                                CHARPTR serialNum, CHARPTR firmwareVer);
+//-------------------------------------------------------------------------------------------------
+static void fillOnvifCacheProfileParam(ONVIF_CACHE_PROFILE_PARAM_t *pCacheParam, PROFILE_WISE_OPTION_PARAM_t *pProfileParam);
+//-------------------------------------------------------------------------------------------------
+static void updateOnvifCamCacheProfile(UINT8 camIndex, UINT8 profileNum, PROFILE_WISE_OPTION_PARAM_t *pProfileParam);
+//-------------------------------------------------------------------------------------------------
+static PROFILE_WISE_OPTION_PARAM_t *getProfileParamFromCache(ONVIF_CACHE_PROFILE_PARAM_t *pCacheParam);
+//-------------------------------------------------------------------------------------------------
+static void saveOnvifCamCache(UINT8 camIndex, CAPABILITY_TYPE capabilitySupported);
+//-------------------------------------------------------------------------------------------------
+static BOOL writeOnvifCamCacheFile(UINT8 camIndex);
+//-------------------------------------------------------------------------------------------------
+static BOOL getOnvifCamCacheStreamUrl(UINT8 camIndex, UINT8 profileNum, URL_REQUEST_t *urlReq);
+//-------------------------------------------------------------------------------------------------
+static void updateOnvifCamCacheStreamUrl(UINT8 camIndex, UINT8 profileNum, URL_REQUEST_t *urlReq);
+//-------------------------------------------------------------------------------------------------
+static void initOnvifMediaProfileSet(UINT8 camIndex, ONVIF_MEDIA_PROFILE_SET_t *pProfileSet);
+//-------------------------------------------------------------------------------------------------
+static void freeOnvifMediaProfileSet(ONVIF_MEDIA_PROFILE_SET_t *pProfileSet);
+//-------------------------------------------------------------------------------------------------
+static void applyOnvifMediaProfileSet(UINT8 camIndex, ONVIF_MEDIA_PROFILE_SET_t *pProfileSet);
+//-------------------------------------------------------------------------------------------------
+static void discardOnvifRevalidatedSet(UINT8 camIndex);
+//-------------------------------------------------------------------------------------------------
+static BOOL isOnvifCamCacheRevalidation(UINT8 camIndex);
+//-------------------------------------------------------------------------------------------------
+static ONVIF_RESP_STATUS_e revalidateOnvifCamCache(SOAP_t *soap, SOAP_USER_DETAIL_t *user, UINT8 camIndex);
 //-------------------------------------------------------------------------------------------------
 static ONVIF_RESP_STATUS_e getEntryPointFromUnicastReq(CHARPTR deviceIpAddr, UINT8 camIndex);
 //-------------------------------------------------------------------------------------------------
@@ -419,16 +565,20 @@ static BOOL addResolutionToCamCapability2(VIDEO_RESOLUTION2_t *resolutionAvailab
                                           UINT8PTR resolutionVal, UINT8 alreadyStored);
 //-------------------------------------------------------------------------------------------------
 static BOOL prepareMediaCapabilityFromEncoderConfigOptions(UINT8 camIndex, UINT8 profileNum,
-                                                           GET_VIDEO_ENCODER_CONFIGURATION_OPTIONS_RESPONSE_t *videoEncoderConfigOptions);
+                                                           GET_VIDEO_ENCODER_CONFIGURATION_OPTIONS_RESPONSE_t *videoEncoderConfigOptions,
+                                                           PROFILE_WISE_OPTION_PARAM_t **pProfileParam);
 //-------------------------------------------------------------------------------------------------
 static BOOL prepareMedia2CapabilityFromEncoderConfigOptions(UINT8 camIndex, UINT8 profileNum,
-                                                            GET_VIDEO_ENCODER_CONFIGURATION_OPTIONS_RESPONSE2_t *videoEncoderConfigOptions);
+                                                            GET_VIDEO_ENCODER_CONFIGURATION_OPTIONS_RESPONSE2_t *videoEncoderConfigOptions,
+                                                            PROFILE_WISE_OPTION_PARAM_t **pProfileParam);
 //-------------------------------------------------------------------------------------------------
 static void fillOtherSupportedCapabiltyToCamera(CAPABILITY_TYPE *camCapability, GET_CAPABILITIES_RESPONSE_t *getCapabilitiesResponse);
 //-------------------------------------------------------------------------------------------------
-static ONVIF_RESP_STATUS_e selectProfileForMediaService(SOAP_t *soap, SOAP_USER_DETAIL_t *user, BOOL ptzSupported, UINT8 camIndex);
+static ONVIF_RESP_STATUS_e selectProfileForMediaService(SOAP_t *soap, SOAP_USER_DETAIL_t *user, BOOL ptzSupported, UINT8 camIndex,
+                                                        ONVIF_MEDIA_PROFILE_SET_t *pProfileSet);
 //-------------------------------------------------------------------------------------------------
-static ONVIF_RESP_STATUS_e selectProfileForMedia2Service(SOAP_t *soap, SOAP_USER_DETAIL_t *user, BOOL ptzSupported, UINT8 camIndex);
+static ONVIF_RESP_STATUS_e selectProfileForMedia2Service(SOAP_t *soap, SOAP_USER_DETAIL_t *user, BOOL ptzSupported, UINT8 camIndex,
+                                                         ONVIF_MEDIA_PROFILE_SET_t *pProfileSet);
 //-------------------------------------------------------------------------------------------------
 static ONVIF_RESP_STATUS_e getOnvifProfileParam(SOAP_t *soap, SOAP_USER_DETAIL_t *user, UINT8 profileNum,
                                                 UINT8 camIndex, ONVIF_PROFILE_STREAM_INFO_t *profStreamInfo);
@@ -534,149 +684,1231 @@ static void freeSoapObject(SOAP_t *soap);
 //-------------------------------------------------------------------------------------------------
 static const CHARPTR GetOnvifRespName(ONVIF_RESP_STATUS_e onvifReqStatus);
 //-------------------------------------------------------------------------------------------------
-static ONVIF_RESP_STATUS_e getImagingCapability(SOAP_t *soap, SOAP_USER_DETAIL_t *user, UINT8 camIndex, IMAGE_CAPABILITY_INFO_t *pImgCapsInfo);
+static ONVIF_RESP_STATUS_e getImagingCapability(SOAP_t *soap, SOAP_USER_DETAIL_t *user, UINT8 camIndex, IMAGE_CAPABILITY_INFO_t *pImgCapsInfo);
+//-------------------------------------------------------------------------------------------------
+static ONVIF_RESP_STATUS_e getImagingSetting(SOAP_t *soap, SOAP_USER_DETAIL_t *user, UINT8 camIndex, IMAGE_CAPABILITY_INFO_t *pImgCapsInfo);
+//-------------------------------------------------------------------------------------------------
+static ONVIF_RESP_STATUS_e setImagingSetting(SOAP_t *soap, SOAP_USER_DETAIL_t *user, UINT8 camIndex, IMAGE_CAPABILITY_INFO_t *pImgCapsInfo);
+//-------------------------------------------------------------------------------------------------
+//#################################################################################################
+// @FUNCTION POINTER
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+static ONVIF_RESP_STATUS_e (*ptzFuncPtr[MAX_PTZ_SUPPORT_OPTIONS])(SOAP_t *soapPtr, SOAP_USER_DETAIL_t *userDeatil, UINT16 sessionIndex, PTZ_OPERATION_e moveType) =
+{
+    NULL,
+    ptzRelativeMove,
+    ptzAbsoluteMove,
+    ptzContinuousMove
+};
+//-------------------------------------------------------------------------------------------------
+static ONVIF_RESP_STATUS_e (*focusFuncPtr[MAX_PTZ_SUPPORT_OPTIONS])(SOAP_t *soapPtr, SOAP_USER_DETAIL_t *userDeatil, UINT16 sessionIndex) =
+{
+    NULL,
+    focusRelativeMove,
+    focusAbsoluteMove,
+    focusContinuousMove
+};
+//-------------------------------------------------------------------------------------------------
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+/**
+ * @brief InitOnvifClient - called by Main.c,will init all data varibles to their default values
+ */
+void InitOnvifClient(void)
+{
+    ONVIF_HANDLE    hOnvif;
+    UINT8           camIndex;
+    UINT8           profileIndex;
+
+    MUTEX_INIT(onvifStatusLock, NULL);
+    MUTEX_INIT(onvifWorkerLock, NULL);
+    pthread_cond_init(&onvifWorkerSignal, NULL);
+    MUTEX_INIT(onvifSoapCacheLock, NULL);
+    onvifWorkerCnt = 0;
+    onvifIdleWorkerCnt = 0;
+    onvifReqQueueHead = 0;
+    onvifReqQueueCnt = 0;
+    onvifSoapCacheCnt = 0;
+
+    if ((mkdir(ONVIF_CAM_CACHE_DIR, USR_RWE_GRP_RE_OTH_RE) != STATUS_OK) && (errno != EEXIST))
+    {
+        EPRINT(ONVIF_CLIENT, "fail to create capability cache dir: [path=%s], [err=%s]", ONVIF_CAM_CACHE_DIR, STR_ERR);
+    }
+
+    // Initialize all the ONVIF session as FREE
+    for (hOnvif = 0; hOnvif < MAX_ONVIF_SESSION; hOnvif++)
+    {
+        onvifClientInfo[hOnvif].onvifSessionStatus = FREE;
+    }
+
+    // Initialize ONVIF model info
+    for (camIndex = 0; camIndex < getMaxCameraForCurrentVariant(); camIndex++)
+    {
+        memset(&onvifCamInfo[camIndex].timeDifference, 0, sizeof(onvifCamInfo[camIndex].timeDifference));
+        onvifCamInfo[camIndex].maxSupportedProfile = 0;
+
+        snprintf(onvifCamInfo[camIndex].realtiveEntryPt, MAX_RELATIVE_ADDR_LEN, "/onvif/device_service");
+        snprintf(onvifCamInfo[camIndex].mediaServiceInfo.relativeMediaServiceAddr, MAX_RELATIVE_ADDR_LEN, "/onvif/media_service");
+        snprintf(onvifCamInfo[camIndex].mediaServiceInfo.relativeAnalyticsServiceAddr, MAX_RELATIVE_ADDR_LEN, "/onvif/analytics");
+        snprintf(onvifCamInfo[camIndex].ptzServiceInfo.relativePtzServiceAddr, MAX_RELATIVE_ADDR_LEN, "/onvif/ptz_service");
+        snprintf(onvifCamInfo[camIndex].imagingServiceInfo.relativeImagingServiceAddr, MAX_RELATIVE_ADDR_LEN, "/onvif/imaging_service");
+
+        for (profileIndex = 0; profileIndex < MAX_PROFILE_SUPPORT; profileIndex++)
+        {
+            RESET_STR_BUFF(onvifCamInfo[camIndex].mediaServiceInfo.mediaProfile[profileIndex].profileToken);
+            RESET_STR_BUFF(onvifCamInfo[camIndex].mediaServiceInfo.mediaProfile[profileIndex].videoEncoderConfigurationToken);
+            RESET_STR_BUFF(onvifCamInfo[camIndex].mediaServiceInfo.mediaProfile[profileIndex].videoSourceToken);
+        }
+
+        onvifCamInfo[camIndex].mediaServiceInfo.media2Support = NO;
+        onvifCamInfo[camIndex].mediaServiceInfo.analytics2Support = NO;
+
+        onvifCamInfo[camIndex].imagingServiceInfo.isImgSettingSupport = NO;
+        onvifCamInfo[camIndex].ptzServiceInfo.panTiltSupport = NO_FUNCTION_SUPPORT;
+        onvifCamInfo[camIndex].imagingServiceInfo.focusInfo.focusSupport = NO_FUNCTION_SUPPORT;
+        onvifCamInfo[camIndex].imagingServiceInfo.irisInfo.irisSupport = NO_FUNCTION_SUPPORT;
+        RESET_STR_BUFF(onvifCamInfo[camIndex].ptzServiceInfo.profileToken);
+        RESET_STR_BUFF(onvifCamInfo[camIndex].analyticsServiceInfo.videoAnalticsToken);
+        onvifCamInfo[camIndex].audioAvailable = NO;
+
+        //Events related initialization
+        RESET_STR_BUFF(onvifCamInfo[camIndex].eventServiceInfo.eventServiceUri);
+        RESET_STR_BUFF(onvifCamInfo[camIndex].eventServiceInfo.evSubscribeRef);
+        RESET_STR_BUFF(onvifCamInfo[camIndex].eventServiceInfo.additionalInfo);
+
+        memset(&onvifCamCache[camIndex], 0, sizeof(ONVIF_CAM_CACHE_t));
+        MUTEX_INIT(onvifCamCache[camIndex].cacheLock, NULL);
+    }
+
+    /* Migrate preset token configuration from local copy to system configuration */
+    MigratePtzPresetOnvifTokenConfig();
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief StartOnvifClient  - will queue request to onvif workers that will handle req/resp with camera.
+ *                            New worker is created only when no idle worker is available.
+ * @param onvifReqPara      - contains camera request information
+ * @param handlePtr         - free session will be assigned
+ * @return Fail             - if no free session present or failed to create thread
+ */
+BOOL StartOnvifClient(ONVIF_REQ_PARA_t *onvifReqPara, ONVIF_HANDLE *handlePtr)
+{
+    ONVIF_HANDLE sessionIndex;
+
+    /* find first free session */
+    MUTEX_LOCK(onvifStatusLock);
+    for(sessionIndex = 0 ; sessionIndex < MAX_ONVIF_SESSION ; sessionIndex++)
+    {
+        if(onvifClientInfo[sessionIndex].onvifSessionStatus == FREE)
+        {
+            onvifClientInfo[sessionIndex].onvifSessionStatus = BUSY;
+            break;
+        }
+    }
+    MUTEX_UNLOCK(onvifStatusLock);
+
+    if(sessionIndex >= MAX_ONVIF_SESSION)
+    {
+        EPRINT(ONVIF_CLIENT, "onvif free session not available: [camera=%d], [onvifReq=%s]", onvifReqPara->camIndex, GetOnvifReqName(onvifReqPara->onvifReq));
+        return FAIL;
+    }
+
+    onvifClientInfo[sessionIndex].onvifReqPara = *onvifReqPara;
+    onvifClientInfo[sessionIndex].onvifReqPara.sessionIndex = sessionIndex;
+
+    MUTEX_LOCK(onvifWorkerLock);
+    onvifReqQueue[(onvifReqQueueHead + onvifReqQueueCnt) % MAX_ONVIF_SESSION] = sessionIndex;
+    onvifReqQueueCnt++;
+
+    /* Create new worker only if queued requests are more than idle workers */
+    if ((onvifReqQueueCnt > onvifIdleWorkerCnt) && (onvifWorkerCnt < ONVIF_WORKER_MAX))
+    {
+        if (FAIL == Utils_CreateThread(NULL, onvifWorkerThread, NULL, DETACHED_THREAD, ONVIF_THRD_STACK_SIZE))
+        {
+            if (onvifWorkerCnt == 0)
+            {
+                /* No worker is available to serve the request */
+                onvifReqQueueCnt--;
+                MUTEX_UNLOCK(onvifWorkerLock);
+                EPRINT(ONVIF_CLIENT, "onvif free session not available: [camera=%d], [session=%d], [onvifReq=%s]",
+                       onvifReqPara->camIndex, sessionIndex, GetOnvifReqName(onvifReqPara->onvifReq));
+                MUTEX_LOCK(onvifStatusLock);
+                onvifClientInfo[sessionIndex].onvifSessionStatus = FREE;
+                MUTEX_UNLOCK(onvifStatusLock);
+                return FAIL;
+            }
+        }
+        else
+        {
+            onvifWorkerCnt++;
+        }
+    }
+    pthread_cond_signal(&onvifWorkerSignal);
+    MUTEX_UNLOCK(onvifWorkerLock);
+
+    /* Provide onvif handle */
+    *handlePtr = sessionIndex;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief onvifWorkerThread : will serve queued onvif requests one by one. Worker waits for new request
+ *                            after serving queue and exits when it remains idle above minimum workers.
+ * @param data              : Thread argument(Not used)
+ * @return
+ */
+static void *onvifWorkerThread(void *data)
+{
+    UINT16          sessionIndex;
+    BOOL            staleF;
+    INT32           waitStatus;
+    struct timespec ts;
+
+    THREAD_START("ONVIF_WORKER");
+
+    MUTEX_LOCK(onvifWorkerLock);
+    while(TRUE)
+    {
+        if (onvifReqQueueCnt == 0)
+        {
+            clock_gettime(CLOCK_REALTIME, &ts);
+            ts.tv_sec += ONVIF_WORKER_IDLE_TIMEOUT;
+
+            onvifIdleWorkerCnt++;
+            waitStatus = pthread_cond_timedwait(&onvifWorkerSignal, &onvifWorkerLock, &ts);
+            onvifIdleWorkerCnt--;
+
+            if ((onvifReqQueueCnt == 0) && (waitStatus == ETIMEDOUT) && (onvifWorkerCnt > ONVIF_WORKER_MIN))
+            {
+                break;
+            }
+            continue;
+        }
+
+        sessionIndex = onvifReqQueue[onvifReqQueueHead];
+        onvifReqQueueHead = (onvifReqQueueHead + 1) % MAX_ONVIF_SESSION;
+        onvifReqQueueCnt--;
+        staleF = isOnvifPtzReqStale(sessionIndex);
+        MUTEX_UNLOCK(onvifWorkerLock);
+
+        if (staleF == TRUE)
+        {
+            dropOnvifPtzRequest(sessionIndex);
+        }
+        else
+        {
+            processOnvifRequest(sessionIndex);
+        }
+
+        MUTEX_LOCK(onvifWorkerLock);
+    }
+
+    onvifWorkerCnt--;
+    MUTEX_UNLOCK(onvifWorkerLock);
+    pthread_exit(NULL);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief isOnvifPtzReqStale    : checks whether newer move of same type is queued for camera of ptz request.
+ *                                Such a move makes this move stale. It must be called with worker lock.
+ * @param sessionIndex          : Session of request
+ * @return TRUE if request is stale otherwise FALSE
+ */
+static BOOL isOnvifPtzReqStale(UINT16 sessionIndex)
+{
+    UINT16              queueIdx;
+    ONVIF_REQ_PARA_t    *pReqPara = &onvifClientInfo[sessionIndex].onvifReqPara;
+    ONVIF_REQ_PARA_t    *pQueuedReqPara;
+
+    if (pReqPara->onvifReq != ONVIF_SET_PTZ)
+    {
+        return FALSE;
+    }
+
+    for (queueIdx = 0; queueIdx < onvifReqQueueCnt; queueIdx++)
+    {
+        pQueuedReqPara = &onvifClientInfo[onvifReqQueue[(onvifReqQueueHead + queueIdx) % MAX_ONVIF_SESSION]].onvifReqPara;
+        if ((pQueuedReqPara->onvifReq == ONVIF_SET_PTZ) && (pQueuedReqPara->camIndex == pReqPara->camIndex)
+                && ((pQueuedReqPara->ptzInfo.zoom == MAX_PTZ_ZOOM_OPTION) == (pReqPara->ptzInfo.zoom == MAX_PTZ_ZOOM_OPTION)))
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief dropOnvifPtzRequest   : completes stale ptz request without sending it to camera. Newer move
+ *                                of camera supersedes it, so success is given to caller.
+ * @param sessionIndex          : Session of request
+ */
+static void dropOnvifPtzRequest(UINT16 sessionIndex)
+{
+    ONVIF_RESPONSE_PARA_t responseData;
+
+    DPRINT(ONVIF_CLIENT, "stale ptz request dropped: [camera=%d], [session=%d]", onvifClientInfo[sessionIndex].onvifReqPara.camIndex, sessionIndex);
+    if (onvifClientInfo[sessionIndex].onvifReqPara.onvifCallback != NULL)
+    {
+        responseData.response = ONVIF_CMD_SUCCESS;
+        responseData.data = NULL;
+        responseData.cameraIndex = onvifClientInfo[sessionIndex].onvifReqPara.camIndex;
+        responseData.requestType = onvifClientInfo[sessionIndex].onvifReqPara.onvifReq;
+        onvifClientInfo[sessionIndex].onvifReqPara.onvifCallback(&responseData);
+    }
+
+    MUTEX_LOCK(onvifStatusLock);
+    onvifClientInfo[sessionIndex].onvifSessionStatus = FREE;
+    MUTEX_UNLOCK(onvifStatusLock);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief getOnvifSoap  : gives idle soap context of camera if available otherwise new soap context.
+ *                        Idle context keeps keep-alive connection with camera.
+ * @param camIndex      : Camera index
+ * @return Soap context
+ */
+static SOAP_t *getOnvifSoap(UINT8 camIndex)
+{
+    UINT16  cacheIdx;
+    SOAP_t  *soap;
+
+    MUTEX_LOCK(onvifSoapCacheLock);
+    for (cacheIdx = 0; cacheIdx < onvifSoapCacheCnt; cacheIdx++)
+    {
+        if (onvifSoapCache[cacheIdx].camIndex != camIndex)
+        {
+            continue;
+        }
+
+        soap = onvifSoapCache[cacheIdx].soap;
+        onvifSoapCacheCnt--;
+        onvifSoapCache[cacheIdx] = onvifSoapCache[onvifSoapCacheCnt];
+        MUTEX_UNLOCK(onvifSoapCacheLock);
+        return soap;
+    }
+    MUTEX_UNLOCK(onvifSoapCacheLock);
+
+    /* All internal dynamic memory allocation will be handled by SOAP library itself. Use of soap_init() prone to memory leaks */
+    return soap_new1(SOAP_IO_KEEPALIVE);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief putOnvifSoap  : keeps soap context of camera for next request. Context of failed request is
+ *                        freed as its connection may not be usable. Contexts idle since timeout are freed.
+ * @param camIndex      : Camera index
+ * @param soap          : Soap context
+ * @param response      : Response of request
+ */
+static void putOnvifSoap(UINT8 camIndex, SOAP_t *soap, ONVIF_RESP_STATUS_e response)
+{
+    UINT16          cacheIdx = 0;
+    UINT16          freeCnt = 0;
+    SOAP_t          *freeSoap[ONVIF_SOAP_CACHE_MAX + 1];
+
+    if (soap == NULL)
+    {
+        return;
+    }
+
+    /* Free request data but keep context and connection */
+    soap_destroy(soap);
+    soap_end(soap);
+
+    MUTEX_LOCK(onvifSoapCacheLock);
+    while (cacheIdx < onvifSoapCacheCnt)
+    {
+        if ((onvifSoapCacheCnt < ONVIF_SOAP_CACHE_MAX)
+                && (ElapsedTick(onvifSoapCache[cacheIdx].idleTick) < CONVERT_SEC_TO_TIMER_COUNT(ONVIF_SOAP_IDLE_TIMEOUT)))
+        {
+            cacheIdx++;
+            continue;
+        }
+
+        freeSoap[freeCnt++] = onvifSoapCache[cacheIdx].soap;
+        onvifSoapCacheCnt--;
+        onvifSoapCache[cacheIdx] = onvifSoapCache[onvifSoapCacheCnt];
+    }
+
+    if (response == ONVIF_CMD_SUCCESS)
+    {
+        onvifSoapCache[onvifSoapCacheCnt].soap = soap;
+        onvifSoapCache[onvifSoapCacheCnt].camIndex = camIndex;
+        onvifSoapCache[onvifSoapCacheCnt].idleTick = GetSysTick();
+        onvifSoapCacheCnt++;
+    }
+    else
+    {
+        freeSoap[freeCnt++] = soap;
+    }
+    MUTEX_UNLOCK(onvifSoapCacheLock);
+
+    /* Close connections outside the lock */
+    for (cacheIdx = 0; cacheIdx < freeCnt; cacheIdx++)
+    {
+        freeSoapObject(freeSoap[cacheIdx]);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief setOnvifCamCacheKey   : stores identity of camera reported in current session. Capability cache
+ *                                of camera is valid only for same identity.
+ * @param camIndex              : Camera index
+ * @param user                  : Address of camera
+ * @param brandName             : Brand of camera
+ * @param modelName             : Model of camera
+ * @param serialNum             : Serial number of camera
+ * @param firmwareVer           : Firmware version of camera
+ */
+static void setOnvifCamCacheKey(UINT8 camIndex, SOAP_USER_DETAIL_t *user, CHARPTR brandName, CHARPTR modelName,
+                                CHARPTR serialNum, CHARPTR firmwareVer)
+{
+    ONVIF_CAM_CACHE_KEY_t key;
+
+    if (camIndex >= getMaxCameraForCurrentVariant())
+    {
+        return;
+    }
+
+    memset(&key, 0, sizeof(key));
+    snprintf(key.brand, sizeof(key.brand), "%s", brandName);
+    snprintf(key.model, sizeof(key.model), "%s", modelName);
+    snprintf(key.serialNum, sizeof(key.serialNum), "%s", (serialNum != NULL) ? serialNum : "");
+    snprintf(key.firmwareVer, sizeof(key.firmwareVer), "%s", (firmwareVer != NULL) ? firmwareVer : "");
+    snprintf(key.ipAddr, sizeof(key.ipAddr), "%s", user->ipAddr);
+    key.port = user->port;
+
+    MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+    if (memcmp(&onvifCamCache[camIndex].key, &key, sizeof(key)) != 0)
+    {
+        /* Camera is changed or upgraded. Capabilities must be taken from camera */
+        onvifCamCache[camIndex].key = key;
+        onvifCamCache[camIndex].validF = FALSE;
+        onvifCamCache[camIndex].revalidateF = FALSE;
+        discardOnvifRevalidatedSet(camIndex);
+        memset(onvifCamCache[camIndex].streamUrlUseF, FALSE, sizeof(onvifCamCache[camIndex].streamUrlUseF));
+        memset(onvifCamCache[camIndex].streamUrl, 0, sizeof(onvifCamCache[camIndex].streamUrl));
+    }
+    MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief fillOnvifCacheProfileParam    : converts profile wise capability in format of cache
+ * @param pCacheParam                   : Cached profile wise capability
+ * @param pProfileParam                 : Profile wise capability
+ */
+static void fillOnvifCacheProfileParam(ONVIF_CACHE_PROFILE_PARAM_t *pCacheParam, PROFILE_WISE_OPTION_PARAM_t *pProfileParam)
+{
+    UINT8       codecIdx, resIdx, strIdx;
+    UINT8PTR    pResolution;
+
+    memset(pCacheParam, 0, sizeof(ONVIF_CACHE_PROFILE_PARAM_t));
+    pCacheParam->codecSupported = pProfileParam->codecSupported;
+
+    for (codecIdx = 0; codecIdx < (MAX_VIDEO_CODEC - 1); codecIdx++)
+    {
+        pCacheParam->qualitySupported[codecIdx] = pProfileParam->qualitySupported[codecIdx];
+        pCacheParam->maxBitRateSupport[codecIdx] = pProfileParam->maxBitRateSupport[codecIdx];
+        pCacheParam->minBitRateSupport[codecIdx] = pProfileParam->minBitRateSupport[codecIdx];
+        pCacheParam->framerateAvailable[codecIdx] = pProfileParam->framerateSupported.framerateAvailable[codecIdx];
+
+        pCacheParam->resolutionAvailable[codecIdx][0] = MAX_RESOLUTION;
+        pResolution = ((UINT8PTR *)(pProfileParam->resolutionSupported.resolutionAvailable))[codecIdx];
+        if (pResolution != NULL)
+        {
+            for (resIdx = 0; (resIdx < MAX_RESOLUTION) && (pResolution[resIdx] != MAX_RESOLUTION); resIdx++)
+            {
+                pCacheParam->resolutionAvailable[codecIdx][resIdx] = pResolution[resIdx];
+            }
+            pCacheParam->resolutionAvailable[codecIdx][resIdx] = MAX_RESOLUTION;
+        }
+
+        if (pProfileParam->profileSupported[codecIdx] != NULL)
+        {
+            for (strIdx = 1; strIdx < (sizeof(mediaProfileStr) / sizeof(mediaProfileStr[0])); strIdx++)
+            {
+                if (strcmp(pProfileParam->profileSupported[codecIdx], mediaProfileStr[strIdx]) == STATUS_OK)
+                {
+                    pCacheParam->profileSupported[codecIdx] = strIdx;
+                    break;
+                }
+            }
+        }
+    }
+
+    pCacheParam->validF = TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief updateOnvifCamCacheProfile    : stores profile wise capability in cache of camera
+ * @param camIndex                      : Camera index
+ * @param profileNum                    : Profile index
+ * @param pProfileParam                 : Profile wise capability
+ */
+static void updateOnvifCamCacheProfile(UINT8 camIndex, UINT8 profileNum, PROFILE_WISE_OPTION_PARAM_t *pProfileParam)
+{
+    if ((camIndex >= getMaxCameraForCurrentVariant()) || (profileNum >= MAX_PROFILE_SUPPORT))
+    {
+        return;
+    }
+
+    MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+    fillOnvifCacheProfileParam(&onvifCamCache[camIndex].profileParam[profileNum], pProfileParam);
+    MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief getProfileParamFromCache  : prepares profile wise capability from cache
+ * @param pCacheParam               : Cached profile wise capability
+ * @return Profile wise capability (Memory deallocated at other place (FreeCameraCapability)) or NULL
+ */
+static PROFILE_WISE_OPTION_PARAM_t *getProfileParamFromCache(ONVIF_CACHE_PROFILE_PARAM_t *pCacheParam)
+{
+    UINT8                       codecIdx, resCnt;
+    UINT8PTR                    *pRes;
+    PROFILE_WISE_OPTION_PARAM_t *pProfileParam;
+
+    pProfileParam = calloc(1, sizeof(PROFILE_WISE_OPTION_PARAM_t));
+    if (pProfileParam == NULL)
+    {
+        return NULL;
+    }
+
+    pProfileParam->resolutionSupported.isResolutionCodecDependent = YES;
+    pProfileParam->resolutionSupported.resolutionAvailable = calloc(MAX_VIDEO_CODEC - 1, sizeof(UINT8PTR));
+    pProfileParam->framerateSupported.isFramerateCodecDependent = YES;
+    pProfileParam->framerateSupported.isFramerateResolutionDependent = NO;
+    pProfileParam->framerateSupported.framerateAvailable = calloc(MAX_VIDEO_CODEC - 1, sizeof(UINT64));
+    if ((pProfileParam->resolutionSupported.resolutionAvailable == NULL) || (pProfileParam->framerateSupported.framerateAvailable == NULL))
+    {
+        FREE_MEMORY(pProfileParam->resolutionSupported.resolutionAvailable);
+        FREE_MEMORY(pProfileParam->framerateSupported.framerateAvailable);
+        free(pProfileParam);
+        return NULL;
+    }
+
+    pProfileParam->codecSupported = pCacheParam->codecSupported;
+    pRes = (UINT8PTR *)pProfileParam->resolutionSupported.resolutionAvailable;
+    for (codecIdx = 0; codecIdx < (MAX_VIDEO_CODEC - 1); codecIdx++)
+    {
+        pProfileParam->qualitySupported[codecIdx] = pCacheParam->qualitySupported[codecIdx];
+        pProfileParam->maxBitRateSupport[codecIdx] = pCacheParam->maxBitRateSupport[codecIdx];
+        pProfileParam->minBitRateSupport[codecIdx] = pCacheParam->minBitRateSupport[codecIdx];
+        pProfileParam->framerateSupported.framerateAvailable[codecIdx] = pCacheParam->framerateAvailable[codecIdx];
+
+        if (pCacheParam->profileSupported[codecIdx] < (sizeof(mediaProfileStr) / sizeof(mediaProfileStr[0])))
+        {
+            pProfileParam->profileSupported[codecIdx] = (pCacheParam->profileSupported[codecIdx] == 0) ?
+                        NULL : mediaProfileStr[pCacheParam->profileSupported[codecIdx]];
+        }
+
+        for (resCnt = 0; (resCnt < MAX_RESOLUTION) && (pCacheParam->resolutionAvailable[codecIdx][resCnt] != MAX_RESOLUTION); resCnt++)
+        {
+            /* Nothing to do */
+        }
+
+        if (resCnt == 0)
+        {
+            continue;
+        }
+
+        /* Memory deallocated at other place (FreeCameraCapability) */
+        pRes[codecIdx] = malloc(resCnt + 1);
+        if (pRes[codecIdx] != NULL)
+        {
+            memcpy(pRes[codecIdx], pCacheParam->resolutionAvailable[codecIdx], resCnt);
+            pRes[codecIdx][resCnt] = MAX_RESOLUTION;
+        }
+    }
+
+    return pProfileParam;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief saveOnvifCamCache     : stores capabilities of camera in cache and on flash after capabilities
+ *                                are received from camera
+ * @param camIndex              : Camera index
+ * @param capabilitySupported   : Camera capabilities
+ */
+static void saveOnvifCamCache(UINT8 camIndex, CAPABILITY_TYPE capabilitySupported)
+{
+    MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+    if (onvifCamCache[camIndex].key.brand[0] == '\0')
+    {
+        MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+        return;
+    }
+
+    onvifCamCache[camIndex].capabilitySupported = capabilitySupported;
+    onvifCamCache[camIndex].validF = TRUE;
+    writeOnvifCamCacheFile(camIndex);
+    MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief writeOnvifCamCacheFile    : writes capability cache of camera on flash. File is replaced
+ *                                    atomically to avoid partial cache on power failure.
+ * @param camIndex                  : Camera index
+ * @return SUCCESS/FAIL
+ * @note Cache lock of camera must be acquired by caller
+ */
+static BOOL writeOnvifCamCacheFile(UINT8 camIndex)
+{
+    INT32                   fileFd;
+    BOOL                    retVal = SUCCESS;
+    CHAR                    fileName[PATH_MAX];
+    CHAR                    tempFileName[PATH_MAX];
+    ONVIF_CAM_CACHE_FILE_t  *pCacheFile;
+
+    pCacheFile = calloc(1, sizeof(ONVIF_CAM_CACHE_FILE_t));
+    if (pCacheFile == NULL)
+    {
+        EPRINT(ONVIF_CLIENT, "fail to alloc memory for capability cache: [camera=%d]", camIndex);
+        return FAIL;
+    }
+
+    pCacheFile->version = ONVIF_CAM_CACHE_VERSION;
+    pCacheFile->size = sizeof(ONVIF_CAM_CACHE_FILE_t);
+    pCacheFile->key = onvifCamCache[camIndex].key;
+    pCacheFile->capabilitySupported = onvifCamCache[camIndex].capabilitySupported;
+    pCacheFile->camInfo = onvifCamInfo[camIndex];
+    memset(&pCacheFile->camInfo.timeDifference, 0, sizeof(pCacheFile->camInfo.timeDifference));
+    RESET_STR_BUFF(pCacheFile->camInfo.eventServiceInfo.evSubscribeRef);
+    memcpy(pCacheFile->profileParam, onvifCamCache[camIndex].profileParam, sizeof(pCacheFile->profileParam));
+    memcpy(pCacheFile->streamUrl, onvifCamCache[camIndex].streamUrl, sizeof(pCacheFile->streamUrl));
+
+    snprintf(fileName, sizeof(fileName), ONVIF_CAM_CACHE_FILE, camIndex);
+    snprintf(tempFileName, sizeof(tempFileName), "%s.tmp", fileName);
+    fileFd = open(tempFileName, CREATE_WRITE_MODE | O_TRUNC, USR_RW_GRP_R_OTH_R);
+    if (fileFd == INVALID_FILE_FD)
+    {
+        EPRINT(ONVIF_CLIENT, "fail to open capability cache: [camera=%d], [path=%s], [err=%s]", camIndex, tempFileName, STR_ERR);
+        free(pCacheFile);
+        return FAIL;
+    }
+
+    if ((write(fileFd, pCacheFile, sizeof(ONVIF_CAM_CACHE_FILE_t)) != (ssize_t)sizeof(ONVIF_CAM_CACHE_FILE_t)) || (fsync(fileFd) != STATUS_OK))
+    {
+        EPRINT(ONVIF_CLIENT, "fail to write capability cache: [camera=%d], [path=%s], [err=%s]", camIndex, tempFileName, STR_ERR);
+        retVal = FAIL;
+    }
+
+    close(fileFd);
+    free(pCacheFile);
+
+    if ((retVal == SUCCESS) && (rename(tempFileName, fileName) != STATUS_OK))
+    {
+        EPRINT(ONVIF_CLIENT, "fail to rename capability cache: [camera=%d], [path=%s], [err=%s]", camIndex, tempFileName, STR_ERR);
+        retVal = FAIL;
+    }
+
+    if (retVal == FAIL)
+    {
+        unlink(tempFileName);
+        return FAIL;
+    }
+
+    DPRINT(ONVIF_CLIENT, "capability cache saved: [camera=%d], [serial=%s], [firmware=%s]",
+           camIndex, onvifCamCache[camIndex].key.serialNum, onvifCamCache[camIndex].key.firmwareVer);
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief getOnvifCamCacheStreamUrl : gives stream url from cache once after capabilities are restored from
+ *                                    cache. Next request of stream url is sent to camera.
+ * @param camIndex                  : Camera index
+ * @param profileNum                : Profile number (starts from 1)
+ * @param urlReq                    : Stream url
+ * @return SUCCESS if url is given from cache otherwise FAIL
+ */
+static BOOL getOnvifCamCacheStreamUrl(UINT8 camIndex, UINT8 profileNum, URL_REQUEST_t *urlReq)
+{
+    IP_CAMERA_CONFIG_t          ipCamCfg;
+    ONVIF_CACHE_STREAM_URL_t    *pStreamUrl;
+
+    if ((camIndex >= getMaxCameraForCurrentVariant()) || (profileNum == 0) || (profileNum > MAX_PROFILE_SUPPORT))
+    {
+        return FAIL;
+    }
+
+    ReadSingleIpCameraConfig(camIndex, &ipCamCfg);
+    MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+    pStreamUrl = &onvifCamCache[camIndex].streamUrl[profileNum - 1];
+    if ((onvifCamCache[camIndex].streamUrlUseF[profileNum - 1] == FALSE) || (pStreamUrl->relativeUrl[0] == '\0')
+            || (pStreamUrl->rtspProtocol != ipCamCfg.rtspProtocol))
+    {
+        MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+        return FAIL;
+    }
+
+    onvifCamCache[camIndex].streamUrlUseF[profileNum - 1] = FALSE;
+    memset(urlReq, 0, sizeof(URL_REQUEST_t));
+    snprintf(urlReq->relativeUrl, sizeof(urlReq->relativeUrl), "%s", pStreamUrl->relativeUrl);
+    urlReq->rtspTransportType = pStreamUrl->rtspTransportType;
+    MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+
+    urlReq->protocolType = CAM_RTSP_PROTOCOL;
+    urlReq->requestType = CAM_REQ_MEDIA;
+    DPRINT(ONVIF_CLIENT, "media uri taken from cache: [camera=%d], [profile=%d], [url=%s]", camIndex, profileNum, urlReq->relativeUrl);
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief updateOnvifCamCacheStreamUrl  : stores stream url received from camera in cache. Cache file is
+ *                                        updated only when url is changed.
+ * @param camIndex                      : Camera index
+ * @param profileNum                    : Profile number (starts from 1)
+ * @param urlReq                        : Stream url
+ */
+static void updateOnvifCamCacheStreamUrl(UINT8 camIndex, UINT8 profileNum, URL_REQUEST_t *urlReq)
+{
+    IP_CAMERA_CONFIG_t          ipCamCfg;
+    ONVIF_CACHE_STREAM_URL_t    *pStreamUrl;
+
+    if ((camIndex >= getMaxCameraForCurrentVariant()) || (profileNum == 0) || (profileNum > MAX_PROFILE_SUPPORT))
+    {
+        return;
+    }
+
+    ReadSingleIpCameraConfig(camIndex, &ipCamCfg);
+    MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+    pStreamUrl = &onvifCamCache[camIndex].streamUrl[profileNum - 1];
+    if ((strcmp(pStreamUrl->relativeUrl, urlReq->relativeUrl) == STATUS_OK)
+            && (pStreamUrl->rtspTransportType == urlReq->rtspTransportType) && (pStreamUrl->rtspProtocol == ipCamCfg.rtspProtocol))
+    {
+        MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+        return;
+    }
+
+    snprintf(pStreamUrl->relativeUrl, sizeof(pStreamUrl->relativeUrl), "%s", urlReq->relativeUrl);
+    pStreamUrl->rtspTransportType = urlReq->rtspTransportType;
+    pStreamUrl->rtspProtocol = ipCamCfg.rtspProtocol;
+
+    /* Cache file is written only when capabilities of current camera are known */
+    if (onvifCamCache[camIndex].validF == TRUE)
+    {
+        writeOnvifCamCacheFile(camIndex);
+    }
+    MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief RestoreOnvifCameraCache   : restores capabilities, profile tokens and stream urls of camera from
+ *                                    flash. Cache is used only if identity of camera reported in brand-model
+ *                                    request matches with cache.
+ * @param camIndex                  : Camera index
+ * @return SUCCESS if capabilities are restored otherwise FAIL
+ */
+BOOL RestoreOnvifCameraCache(UINT8 camIndex)
+{
+    INT32                       fileFd;
+    UINT8                       profileIdx;
+    CHAR                        fileName[PATH_MAX];
+    TIME_DIFF_t                 timeDifference;
+    ONVIF_CAM_CACHE_FILE_t      *pCacheFile;
+    PROFILE_WISE_OPTION_PARAM_t *pProfileParam[MAX_PROFILE_SUPPORT] = {NULL};
+
+    if (camIndex >= getMaxCameraForCurrentVariant())
+    {
+        return FAIL;
+    }
+
+    snprintf(fileName, sizeof(fileName), ONVIF_CAM_CACHE_FILE, camIndex);
+    fileFd = open(fileName, READ_ONLY_MODE);
+    if (fileFd == INVALID_FILE_FD)
+    {
+        return FAIL;
+    }
+
+    pCacheFile = malloc(sizeof(ONVIF_CAM_CACHE_FILE_t));
+    if (pCacheFile == NULL)
+    {
+        close(fileFd);
+        return FAIL;
+    }
+
+    if (read(fileFd, pCacheFile, sizeof(ONVIF_CAM_CACHE_FILE_t)) != (ssize_t)sizeof(ONVIF_CAM_CACHE_FILE_t))
+    {
+        EPRINT(ONVIF_CLIENT, "fail to read capability cache: [camera=%d], [path=%s], [err=%s]", camIndex, fileName, STR_ERR);
+        close(fileFd);
+        free(pCacheFile);
+        unlink(fileName);
+        return FAIL;
+    }
+    close(fileFd);
+
+    MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+    if ((pCacheFile->version != ONVIF_CAM_CACHE_VERSION) || (pCacheFile->size != sizeof(ONVIF_CAM_CACHE_FILE_t))
+            || (memcmp(&pCacheFile->key, &onvifCamCache[camIndex].key, sizeof(ONVIF_CAM_CACHE_KEY_t)) != 0)
+            || (pCacheFile->camInfo.maxSupportedProfile == 0) || (pCacheFile->camInfo.maxSupportedProfile > MAX_PROFILE_SUPPORT))
+    {
+        MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+        WPRINT(ONVIF_CLIENT, "capability cache not matched with camera: [camera=%d], [version=%d]", camIndex, pCacheFile->version);
+        free(pCacheFile);
+        return FAIL;
+    }
+
+    /* Prepare all profiles before applying cache. Capabilities are taken from camera on failure */
+    for (profileIdx = 0; profileIdx < pCacheFile->camInfo.maxSupportedProfile; profileIdx++)
+    {
+        if ((pCacheFile->profileParam[profileIdx].validF == FALSE)
+                || ((pProfileParam[profileIdx] = getProfileParamFromCache(&pCacheFile->profileParam[profileIdx])) == NULL))
+        {
+            break;
+        }
+    }
+
+    if (profileIdx < pCacheFile->camInfo.maxSupportedProfile)
+    {
+        MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+        EPRINT(ONVIF_CLIENT, "fail to prepare profile from capability cache: [camera=%d], [profile=%d]", camIndex, profileIdx);
+        for (profileIdx = 0; profileIdx < MAX_PROFILE_SUPPORT; profileIdx++)
+        {
+            if (pProfileParam[profileIdx] != NULL)
+            {
+                SaveOnvifCameraCapabiltyProfileWise(camIndex, profileIdx, pProfileParam[profileIdx]);
+            }
+        }
+        FreeCameraCapability(camIndex);
+        free(pCacheFile);
+        return FAIL;
+    }
+
+    /* Time difference is of current session and event subscription is not valid after reboot */
+    timeDifference = onvifCamInfo[camIndex].timeDifference;
+    onvifCamInfo[camIndex] = pCacheFile->camInfo;
+    onvifCamInfo[camIndex].timeDifference = timeDifference;
+    RESET_STR_BUFF(onvifCamInfo[camIndex].eventServiceInfo.evSubscribeRef);
+
+    FreeCameraCapability(camIndex);
+    for (profileIdx = 0; profileIdx < pCacheFile->camInfo.maxSupportedProfile; profileIdx++)
+    {
+        SaveOnvifCameraCapabiltyProfileWise(camIndex, profileIdx, pProfileParam[profileIdx]);
+    }
+    SaveOnvifCameraCapabilty(camIndex, pCacheFile->capabilitySupported);
+
+    onvifCamCache[camIndex].validF = TRUE;
+    onvifCamCache[camIndex].revalidateF = TRUE;
+    discardOnvifRevalidatedSet(camIndex);
+    onvifCamCache[camIndex].capabilitySupported = pCacheFile->capabilitySupported;
+    memcpy(onvifCamCache[camIndex].profileParam, pCacheFile->profileParam, sizeof(onvifCamCache[camIndex].profileParam));
+    memcpy(onvifCamCache[camIndex].streamUrl, pCacheFile->streamUrl, sizeof(onvifCamCache[camIndex].streamUrl));
+    for (profileIdx = 0; profileIdx < MAX_PROFILE_SUPPORT; profileIdx++)
+    {
+        onvifCamCache[camIndex].streamUrlUseF[profileIdx] = (onvifCamCache[camIndex].streamUrl[profileIdx].relativeUrl[0] != '\0') ? TRUE : FALSE;
+    }
+    MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+
+    DPRINT(ONVIF_CLIENT, "capability cache restored: [camera=%d], [profiles=%d], [serial=%s], [firmware=%s]", camIndex,
+           pCacheFile->camInfo.maxSupportedProfile, pCacheFile->key.serialNum, pCacheFile->key.firmwareVer);
+    free(pCacheFile);
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief RemoveOnvifCameraCache    : removes capability cache of camera when capabilities are not valid
+ * @param camIndex                  : Camera index
+ */
+void RemoveOnvifCameraCache(UINT8 camIndex)
+{
+    CHAR fileName[PATH_MAX];
+
+    if (camIndex >= getMaxCameraForCurrentVariant())
+    {
+        return;
+    }
+
+    MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+    onvifCamCache[camIndex].validF = FALSE;
+    onvifCamCache[camIndex].revalidateF = FALSE;
+    discardOnvifRevalidatedSet(camIndex);
+    memset(onvifCamCache[camIndex].streamUrlUseF, FALSE, sizeof(onvifCamCache[camIndex].streamUrlUseF));
+    memset(onvifCamCache[camIndex].streamUrl, 0, sizeof(onvifCamCache[camIndex].streamUrl));
+    snprintf(fileName, sizeof(fileName), ONVIF_CAM_CACHE_FILE, camIndex);
+    if ((unlink(fileName) != STATUS_OK) && (errno != ENOENT))
+    {
+        EPRINT(ONVIF_CLIENT, "fail to remove capability cache: [camera=%d], [path=%s], [err=%s]", camIndex, fileName, STR_ERR);
+    }
+    MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+}
+
 //-------------------------------------------------------------------------------------------------
-static ONVIF_RESP_STATUS_e getImagingSetting(SOAP_t *soap, SOAP_USER_DETAIL_t *user, UINT8 camIndex, IMAGE_CAPABILITY_INFO_t *pImgCapsInfo);
+/**
+ * @brief initOnvifMediaProfileSet  : prepares empty set of media profiles to be received from camera
+ * @param camIndex                  : Camera index
+ * @param pProfileSet               : Media profiles
+ */
+static void initOnvifMediaProfileSet(UINT8 camIndex, ONVIF_MEDIA_PROFILE_SET_t *pProfileSet)
+{
+    memset(pProfileSet, 0, sizeof(ONVIF_MEDIA_PROFILE_SET_t));
+
+    /* Codec profiles are changed only when camera gives them */
+    pProfileSet->mpeg4SupportedProfile = onvifCamInfo[camIndex].mediaServiceInfo.mpeg4SupportedProfile;
+    pProfileSet->h264SupportedProfile = onvifCamInfo[camIndex].mediaServiceInfo.h264SupportedProfile;
+}
+
 //-------------------------------------------------------------------------------------------------
-static ONVIF_RESP_STATUS_e setImagingSetting(SOAP_t *soap, SOAP_USER_DETAIL_t *user, UINT8 camIndex, IMAGE_CAPABILITY_INFO_t *pImgCapsInfo);
+/**
+ * @brief freeOnvifMediaProfileSet  : frees profile wise capabilities of set which is not applied on camera
+ * @param pProfileSet               : Media profiles
+ */
+static void freeOnvifMediaProfileSet(ONVIF_MEDIA_PROFILE_SET_t *pProfileSet)
+{
+    UINT8                       profileIdx, codecIdx;
+    PROFILE_WISE_OPTION_PARAM_t *pProfileParam;
+
+    for (profileIdx = 0; profileIdx < MAX_PROFILE_SUPPORT; profileIdx++)
+    {
+        pProfileParam = pProfileSet->pProfileParam[profileIdx];
+        if (pProfileParam == NULL)
+        {
+            continue;
+        }
+
+        if (pProfileParam->resolutionSupported.resolutionAvailable != NULL)
+        {
+            for (codecIdx = 0; codecIdx < (MAX_VIDEO_CODEC - 1); codecIdx++)
+            {
+                FREE_MEMORY(((UINT8PTR *)(pProfileParam->resolutionSupported.resolutionAvailable))[codecIdx]);
+            }
+        }
+
+        FREE_MEMORY(pProfileParam->resolutionSupported.resolutionAvailable);
+        FREE_MEMORY(pProfileParam->framerateSupported.framerateAvailable);
+        FREE_MEMORY(pProfileSet->pProfileParam[profileIdx]);
+    }
+}
+
 //-------------------------------------------------------------------------------------------------
-//#################################################################################################
-// @FUNCTION POINTER
-//#################################################################################################
+/**
+ * @brief applyOnvifMediaProfileSet : replaces media profiles and profile wise capabilities of camera with
+ *                                    profiles received from camera. Profile wise capabilities are owned by
+ *                                    camera database after this.
+ * @param camIndex                  : Camera index
+ * @param pProfileSet               : Media profiles
+ */
+static void applyOnvifMediaProfileSet(UINT8 camIndex, ONVIF_MEDIA_PROFILE_SET_t *pProfileSet)
+{
+    UINT8                       profileIdx;
+    ONVIF_MEDIA_SERVICE_INFO_t  *pMediaService = &onvifCamInfo[camIndex].mediaServiceInfo;
+
+    for (profileIdx = 0; profileIdx < MAX_PROFILE_SUPPORT; profileIdx++)
+    {
+        if ((profileIdx >= pProfileSet->profileCnt) && (profileIdx >= onvifCamInfo[camIndex].maxSupportedProfile))
+        {
+            break;
+        }
+
+        FreeCameraCapabilityProfileWise(camIndex, profileIdx);
+        if (profileIdx >= pProfileSet->profileCnt)
+        {
+            /* Profile is removed from camera */
+            memset(&pMediaService->mediaProfile[profileIdx], 0, sizeof(ONVIF_MEDIA_PROFILE_INFO_t));
+            MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+            onvifCamCache[camIndex].profileParam[profileIdx].validF = FALSE;
+            MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+            continue;
+        }
+
+        pMediaService->mediaProfile[profileIdx] = pProfileSet->mediaProfile[profileIdx];
+        updateOnvifCamCacheProfile(camIndex, profileIdx, pProfileSet->pProfileParam[profileIdx]);
+
+        /* Memory deallocated at other place (FreeCameraCapability) */
+        SaveOnvifCameraCapabiltyProfileWise(camIndex, profileIdx, pProfileSet->pProfileParam[profileIdx]);
+        pProfileSet->pProfileParam[profileIdx] = NULL;
+    }
+
+    pMediaService->mpeg4SupportedProfile = pProfileSet->mpeg4SupportedProfile;
+    pMediaService->h264SupportedProfile = pProfileSet->h264SupportedProfile;
+    if (pProfileSet->ptzProfileAvailable == YES)
+    {
+        snprintf(onvifCamInfo[camIndex].ptzServiceInfo.profileToken, MAX_TOKEN_SIZE, "%s", pProfileSet->ptzProfileToken);
+        snprintf(onvifCamInfo[camIndex].ptzServiceInfo.ptzConfigurationToken, MAX_TOKEN_SIZE, "%s", pProfileSet->ptzConfigurationToken);
+    }
+    onvifCamInfo[camIndex].maxSupportedProfile = pProfileSet->profileCnt;
+}
+
 //-------------------------------------------------------------------------------------------------
-static ONVIF_RESP_STATUS_e (*ptzFuncPtr[MAX_PTZ_SUPPORT_OPTIONS])(SOAP_t *soapPtr, SOAP_USER_DETAIL_t *userDeatil, UINT16 sessionIndex, PTZ_OPERATION_e moveType) =
+/**
+ * @brief discardOnvifRevalidatedSet    : frees media profiles found in revalidation which are not applied
+ * @param camIndex                      : Camera index
+ * @note Cache lock of camera must be acquired by caller
+ */
+static void discardOnvifRevalidatedSet(UINT8 camIndex)
 {
-    NULL,
-    ptzRelativeMove,
-    ptzAbsoluteMove,
-    ptzContinuousMove
-};
+    if (onvifCamCache[camIndex].pRevalidatedSet == NULL)
+    {
+        return;
+    }
+
+    freeOnvifMediaProfileSet(onvifCamCache[camIndex].pRevalidatedSet);
+    FREE_MEMORY(onvifCamCache[camIndex].pRevalidatedSet);
+    onvifCamCache[camIndex].changedProfileMask = 0;
+}
+
 //-------------------------------------------------------------------------------------------------
-static ONVIF_RESP_STATUS_e (*focusFuncPtr[MAX_PTZ_SUPPORT_OPTIONS])(SOAP_t *soapPtr, SOAP_USER_DETAIL_t *userDeatil, UINT16 sessionIndex) =
+/**
+ * @brief isOnvifCamCacheRevalidation   : checks whether capabilities of camera are restored from cache and
+ *                                        must be revalidated
+ * @param camIndex                      : Camera index
+ * @return TRUE if capabilities must be revalidated otherwise FALSE
+ */
+static BOOL isOnvifCamCacheRevalidation(UINT8 camIndex)
 {
-    NULL,
-    focusRelativeMove,
-    focusAbsoluteMove,
-    focusContinuousMove
-};
+    BOOL revalidateF;
+
+    if (camIndex >= getMaxCameraForCurrentVariant())
+    {
+        return FALSE;
+    }
+
+    MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+    revalidateF = onvifCamCache[camIndex].revalidateF;
+    MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+    return revalidateF;
+}
+
 //-------------------------------------------------------------------------------------------------
-//#################################################################################################
-// @FUNCTIONS
-//#################################################################################################
 /**
- * @brief InitOnvifClient - called by Main.c,will init all data varibles to their default values
+ * @brief revalidateOnvifCamCache   : takes media profiles and stream urls from camera and compares them with
+ *                                    capabilities restored from cache. Streams are already running on restored
+ *                                    capabilities, hence nothing is changed here. Changed profiles are kept
+ *                                    till camera interface applies them with ApplyOnvifCameraRevalidation.
+ * @param soap                      : SOAP instance
+ * @param user                      : User information
+ * @param camIndex                  : Camera index
+ * @return Status
  */
-void InitOnvifClient(void)
+static ONVIF_RESP_STATUS_e revalidateOnvifCamCache(SOAP_t *soap, SOAP_USER_DETAIL_t *user, UINT8 camIndex)
 {
-    ONVIF_HANDLE    hOnvif;
-    UINT8           camIndex;
-    UINT8           profileIndex;
+    ONVIF_RESP_STATUS_e         status;
+    UINT8                       profileIdx;
+    UINT32                      changedProfileMask = 0;
+    BOOL                        changeF;
+    BOOL                        ptzSupport;
+    BOOL                        media2Support = onvifCamInfo[camIndex].mediaServiceInfo.media2Support;
+    ONVIF_MEDIA_PROFILE_INFO_t  *pMediaProfile;
+    ONVIF_MEDIA_PROFILE_SET_t   profileSet;
+    ONVIF_MEDIA_PROFILE_SET_t   *pRevalidatedSet;
+    ONVIF_CACHE_PROFILE_PARAM_t cacheParam;
+    ONVIF_CACHE_STREAM_URL_t    cacheStreamUrl;
+    URL_REQUEST_t               urlReq;
 
-    MUTEX_INIT(onvifStatusLock, NULL);
+    MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+    ptzSupport = (onvifCamCache[camIndex].capabilitySupported & MX_ADD(PTZ_SUPPORT)) ? YES : NO;
+    MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
 
-    // Initialize all the ONVIF session as FREE
-    for (hOnvif = 0; hOnvif < MAX_ONVIF_SESSION; hOnvif++)
+    user->timeDiff = &onvifCamInfo[camIndex].timeDifference;
+    if (media2Support == YES)
     {
-        onvifClientInfo[hOnvif].onvifSessionStatus = FREE;
+        status = selectProfileForMedia2Service(soap, user, ptzSupport, camIndex, &profileSet);
+    }
+    else
+    {
+        status = selectProfileForMediaService(soap, user, ptzSupport, camIndex, &profileSet);
     }
 
-    // Initialize ONVIF model info
-    for (camIndex = 0; camIndex < getMaxCameraForCurrentVariant(); camIndex++)
+    if (status != ONVIF_CMD_SUCCESS)
     {
-        memset(&onvifCamInfo[camIndex].timeDifference, 0, sizeof(onvifCamInfo[camIndex].timeDifference));
-        onvifCamInfo[camIndex].maxSupportedProfile = 0;
+        freeOnvifMediaProfileSet(&profileSet);
+        EPRINT(ONVIF_CLIENT, "fail to revalidate capability cache: [camera=%d], [status=%d]", camIndex, status);
+        if (status != ONVIF_CMD_TIMEOUT)
+        {
+            /* Capabilities will be taken from camera */
+            MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+            onvifCamCache[camIndex].revalidateF = FALSE;
+            MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+        }
+        return status;
+    }
 
-        snprintf(onvifCamInfo[camIndex].realtiveEntryPt, MAX_RELATIVE_ADDR_LEN, "/onvif/device_service");
-        snprintf(onvifCamInfo[camIndex].mediaServiceInfo.relativeMediaServiceAddr, MAX_RELATIVE_ADDR_LEN, "/onvif/media_service");
-        snprintf(onvifCamInfo[camIndex].mediaServiceInfo.relativeAnalyticsServiceAddr, MAX_RELATIVE_ADDR_LEN, "/onvif/analytics");
-        snprintf(onvifCamInfo[camIndex].ptzServiceInfo.relativePtzServiceAddr, MAX_RELATIVE_ADDR_LEN, "/onvif/ptz_service");
-        snprintf(onvifCamInfo[camIndex].imagingServiceInfo.relativeImagingServiceAddr, MAX_RELATIVE_ADDR_LEN, "/onvif/imaging_service");
+    changeF = ((profileSet.mpeg4SupportedProfile != onvifCamInfo[camIndex].mediaServiceInfo.mpeg4SupportedProfile)
+               || (profileSet.h264SupportedProfile != onvifCamInfo[camIndex].mediaServiceInfo.h264SupportedProfile)) ? TRUE : FALSE;
+    if ((profileSet.ptzProfileAvailable == YES)
+            && ((strcmp(profileSet.ptzProfileToken, onvifCamInfo[camIndex].ptzServiceInfo.profileToken) != STATUS_OK)
+                || (strcmp(profileSet.ptzConfigurationToken, onvifCamInfo[camIndex].ptzServiceInfo.ptzConfigurationToken) != STATUS_OK)))
+    {
+        changeF = TRUE;
+    }
 
-        for (profileIndex = 0; profileIndex < MAX_PROFILE_SUPPORT; profileIndex++)
+    /* Profile is changed if its tokens or capabilities are changed */
+    MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+    for (profileIdx = 0; profileIdx < MAX_PROFILE_SUPPORT; profileIdx++)
+    {
+        if ((profileIdx >= profileSet.profileCnt) && (profileIdx >= onvifCamInfo[camIndex].maxSupportedProfile))
         {
-            RESET_STR_BUFF(onvifCamInfo[camIndex].mediaServiceInfo.mediaProfile[profileIndex].profileToken);
-            RESET_STR_BUFF(onvifCamInfo[camIndex].mediaServiceInfo.mediaProfile[profileIndex].videoEncoderConfigurationToken);
-            RESET_STR_BUFF(onvifCamInfo[camIndex].mediaServiceInfo.mediaProfile[profileIndex].videoSourceToken);
+            break;
         }
 
-        onvifCamInfo[camIndex].mediaServiceInfo.media2Support = NO;
-        onvifCamInfo[camIndex].mediaServiceInfo.analytics2Support = NO;
+        if ((profileIdx >= profileSet.profileCnt) || (profileIdx >= onvifCamInfo[camIndex].maxSupportedProfile))
+        {
+            changedProfileMask |= (1 << profileIdx);
+            continue;
+        }
 
-        onvifCamInfo[camIndex].imagingServiceInfo.isImgSettingSupport = NO;
-        onvifCamInfo[camIndex].ptzServiceInfo.panTiltSupport = NO_FUNCTION_SUPPORT;
-        onvifCamInfo[camIndex].imagingServiceInfo.focusInfo.focusSupport = NO_FUNCTION_SUPPORT;
-        onvifCamInfo[camIndex].imagingServiceInfo.irisInfo.irisSupport = NO_FUNCTION_SUPPORT;
-        RESET_STR_BUFF(onvifCamInfo[camIndex].ptzServiceInfo.profileToken);
-        RESET_STR_BUFF(onvifCamInfo[camIndex].analyticsServiceInfo.videoAnalticsToken);
-        onvifCamInfo[camIndex].audioAvailable = NO;
+        pMediaProfile = &onvifCamInfo[camIndex].mediaServiceInfo.mediaProfile[profileIdx];
+        fillOnvifCacheProfileParam(&cacheParam, profileSet.pProfileParam[profileIdx]);
+        if ((strcmp(pMediaProfile->profileToken, profileSet.mediaProfile[profileIdx].profileToken) != STATUS_OK)
+                || (strcmp(pMediaProfile->videoSourceToken, profileSet.mediaProfile[profileIdx].videoSourceToken) != STATUS_OK)
+                || (strcmp(pMediaProfile->videoEncoderConfigurationToken, profileSet.mediaProfile[profileIdx].videoEncoderConfigurationToken) != STATUS_OK)
+                || (memcmp(pMediaProfile->defaultEncodingInterval, profileSet.mediaProfile[profileIdx].defaultEncodingInterval,
+                           sizeof(pMediaProfile->defaultEncodingInterval)) != 0)
+                || (memcmp(&cacheParam, &onvifCamCache[camIndex].profileParam[profileIdx], sizeof(ONVIF_CACHE_PROFILE_PARAM_t)) != 0))
+        {
+            changedProfileMask |= (1 << profileIdx);
+        }
+    }
+    MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
 
-        //Events related initialization
-        RESET_STR_BUFF(onvifCamInfo[camIndex].eventServiceInfo.eventServiceUri);
-        RESET_STR_BUFF(onvifCamInfo[camIndex].eventServiceInfo.evSubscribeRef);
-        RESET_STR_BUFF(onvifCamInfo[camIndex].eventServiceInfo.additionalInfo);
+    /* Stream url of unchanged profile is taken with current token. Cached url is kept if camera does not give it */
+    for (profileIdx = 0; profileIdx < profileSet.profileCnt; profileIdx++)
+    {
+        if (changedProfileMask & (1 << profileIdx))
+        {
+            continue;
+        }
+
+        MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+        cacheStreamUrl = onvifCamCache[camIndex].streamUrl[profileIdx];
+        MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+        if (cacheStreamUrl.relativeUrl[0] == '\0')
+        {
+            continue;
+        }
+
+        memset(&urlReq, 0, sizeof(urlReq));
+        if (media2Support == YES)
+        {
+            status = getMedia2Url(soap, user, MAIN_STREAM, NULL, &urlReq, camIndex, FALSE, profileIdx + 1);
+        }
+        else
+        {
+            status = getMediaUrl(soap, user, MAIN_STREAM, NULL, &urlReq, camIndex, FALSE, profileIdx + 1);
+        }
+
+        if (status != ONVIF_CMD_SUCCESS)
+        {
+            WPRINT(ONVIF_CLIENT, "fail to revalidate cached media uri: [camera=%d], [profile=%d], [status=%d]", camIndex, profileIdx, status);
+            continue;
+        }
+
+        if ((strcmp(urlReq.relativeUrl, cacheStreamUrl.relativeUrl) != STATUS_OK) || (urlReq.rtspTransportType != cacheStreamUrl.rtspTransportType))
+        {
+            changedProfileMask |= (1 << profileIdx);
+        }
     }
 
-    /* Migrate preset token configuration from local copy to system configuration */
-    MigratePtzPresetOnvifTokenConfig();
+    if ((changeF == FALSE) && (changedProfileMask == 0))
+    {
+        freeOnvifMediaProfileSet(&profileSet);
+        MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+        onvifCamCache[camIndex].revalidateF = FALSE;
+        MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+        DPRINT(ONVIF_CLIENT, "capability cache revalidated: [camera=%d]", camIndex);
+        return ONVIF_CMD_SUCCESS;
+    }
+
+    pRevalidatedSet = malloc(sizeof(ONVIF_MEDIA_PROFILE_SET_t));
+    if (pRevalidatedSet == NULL)
+    {
+        EPRINT(ONVIF_CLIENT, "fail to alloc memory for revalidated profiles: [camera=%d]", camIndex);
+        freeOnvifMediaProfileSet(&profileSet);
+        return ONVIF_CMD_TIMEOUT;
+    }
+
+    *pRevalidatedSet = profileSet;
+    MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+    discardOnvifRevalidatedSet(camIndex);
+    onvifCamCache[camIndex].pRevalidatedSet = pRevalidatedSet;
+    onvifCamCache[camIndex].changedProfileMask = changedProfileMask;
+    onvifCamCache[camIndex].revalidateF = FALSE;
+    MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+
+    WPRINT(ONVIF_CLIENT, "capability cache changed: [camera=%d], [profiles=%d-->%d], [changedProfileMask=0x%x]",
+           camIndex, onvifCamInfo[camIndex].maxSupportedProfile, profileSet.profileCnt, changedProfileMask);
+    return ONVIF_CMD_SUCCESS;
 }
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief StartOnvifClient  - will create onvif thread that will handle req/resp with camera.
- * @param onvifReqPara      - contains camera request information
- * @param handlePtr         - free session will be assigned
- * @return Fail             - if no free session present or failed to create thread
+ * @brief ApplyOnvifCameraRevalidation  : applies media profiles changed in revalidation of capability cache.
+ *                                        Cached urls of changed profiles are removed, so restarted stream takes
+ *                                        url from camera.
+ * @param camIndex                      : Camera index
+ * @return Mask of changed profiles (bit 0 for profile 1) whose streams must be restarted
+ * @note ONVIF access lock of camera must be acquired by caller
  */
-BOOL StartOnvifClient(ONVIF_REQ_PARA_t *onvifReqPara, ONVIF_HANDLE *handlePtr)
+UINT32 ApplyOnvifCameraRevalidation(UINT8 camIndex)
 {
-    ONVIF_HANDLE sessionIndex;
+    UINT8                       profileIdx;
+    UINT32                      changedProfileMask;
+    ONVIF_MEDIA_PROFILE_SET_t   *pRevalidatedSet;
 
-    /* find first free session */
-    MUTEX_LOCK(onvifStatusLock);
-    for(sessionIndex = 0 ; sessionIndex < MAX_ONVIF_SESSION ; sessionIndex++)
+    if (camIndex >= getMaxCameraForCurrentVariant())
     {
-        if(onvifClientInfo[sessionIndex].onvifSessionStatus == FREE)
-        {
-            onvifClientInfo[sessionIndex].onvifSessionStatus = BUSY;
-            break;
-        }
+        return 0;
     }
-    MUTEX_UNLOCK(onvifStatusLock);
 
-    if(sessionIndex >= MAX_ONVIF_SESSION)
+    MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+    pRevalidatedSet = onvifCamCache[camIndex].pRevalidatedSet;
+    changedProfileMask = onvifCamCache[camIndex].changedProfileMask;
+    onvifCamCache[camIndex].pRevalidatedSet = NULL;
+    onvifCamCache[camIndex].changedProfileMask = 0;
+    MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+
+    if (pRevalidatedSet == NULL)
     {
-        EPRINT(ONVIF_CLIENT, "onvif free session not available: [camera=%d], [onvifReq=%s]", onvifReqPara->camIndex, GetOnvifReqName(onvifReqPara->onvifReq));
-        return FAIL;
+        return 0;
     }
 
-    onvifClientInfo[sessionIndex].onvifReqPara = *onvifReqPara;
-    onvifClientInfo[sessionIndex].onvifReqPara.sessionIndex = sessionIndex;
+    applyOnvifMediaProfileSet(camIndex, pRevalidatedSet);
+    free(pRevalidatedSet);
 
-    if (FAIL == Utils_CreateThread(NULL, onvifClientThread, &onvifClientInfo[sessionIndex].onvifReqPara.sessionIndex,
-                                   DETACHED_THREAD, ONVIF_THRD_STACK_SIZE))
+    MUTEX_LOCK(onvifCamCache[camIndex].cacheLock);
+    for (profileIdx = 0; profileIdx < MAX_PROFILE_SUPPORT; profileIdx++)
     {
-        EPRINT(ONVIF_CLIENT, "onvif free session not available: [camera=%d], [session=%d], [onvifReq=%s]",
-               onvifReqPara->camIndex, sessionIndex, GetOnvifReqName(onvifReqPara->onvifReq));
-        MUTEX_LOCK(onvifStatusLock);
-        onvifClientInfo[sessionIndex].onvifSessionStatus = FREE;
-        MUTEX_UNLOCK(onvifStatusLock);
-        return FAIL;
+        if (changedProfileMask & (1 << profileIdx))
+        {
+            memset(&onvifCamCache[camIndex].streamUrl[profileIdx], 0, sizeof(ONVIF_CACHE_STREAM_URL_t));
+            onvifCamCache[camIndex].streamUrlUseF[profileIdx] = FALSE;
+        }
     }
 
-    /* Provide onvif handle */
-    *handlePtr = sessionIndex;
-    return SUCCESS;
+    if (onvifCamCache[camIndex].validF == TRUE)
+    {
+        writeOnvifCamCacheFile(camIndex);
+    }
+    MUTEX_UNLOCK(onvifCamCache[camIndex].cacheLock);
+
+    DPRINT(ONVIF_CLIENT, "revalidated profiles applied: [camera=%d], [changedProfileMask=0x%x]", camIndex, changedProfileMask);
+    return changedProfileMask;
 }
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief onvifClientThread : will handle onvif req and send response via callback
- * @param data              : Thread argument(Onvif request info)
- * @return
+ * @brief processOnvifRequest   : will handle onvif req and send response via callback
+ * @param sessionIndex          : Session of request
  */
-static void *onvifClientThread(void *data)
+static void processOnvifRequest(UINT16 sessionIndex)
 {
-    UINT16                      sessionIndex = *(UINT16PTR)data;
     SOAP_USER_DETAIL_t          user;
     ONVIF_RESPONSE_PARA_t       responseData;
     CHAR                        ipAddrForUrl[DOMAIN_NAME_SIZE_MAX];
@@ -690,8 +1922,7 @@ static void *onvifClientThread(void *data)
     UINT16                      complexCamIndex;
     UINT8                       realCamIndex;
     ONVIF_PROFILE_STREAM_INFO_t profileParam;
-
-    THREAD_START_INDEX2("ONVIF_CLT", sessionIndex);
+    ONVIF_MEDIA_PROFILE_SET_t   profileSet;
 
     complexCamIndex = onvifClientInfo[sessionIndex].onvifReqPara.camIndex;
     realCamIndex = GET_STREAM_INDEX(complexCamIndex);
@@ -718,8 +1949,7 @@ static void *onvifClientThread(void *data)
         snprintf(onvifCamInfo[realCamIndex].imagingServiceInfo.imagingServiceAddr, MAX_SERVICE_ADDR_LEN, HTTP_REQUEST_URL,
                  ipAddrForUrl, user.port, onvifCamInfo[realCamIndex].imagingServiceInfo.relativeImagingServiceAddr);
 
-        /* All internal dynamic memory allocation will be handled by SOAP library itself. Use of soap_init() prone to memory leaks */
-        soap = soap_new();
+        soap = getOnvifSoap(realCamIndex);
     }
 
     switch(onvifClientInfo[sessionIndex].onvifReqPara.onvifReq)
@@ -739,7 +1969,15 @@ static void *onvifClientThread(void *data)
             break;
 
         case ONVIF_GET_CAPABILITY:
-            responseData.response =	getOnvifCameraCapability(realCamIndex, &user, soap);
+            /* Capabilities restored from cache are revalidated without changing them for running streams */
+            if (isOnvifCamCacheRevalidation(realCamIndex) == TRUE)
+            {
+                responseData.response = revalidateOnvifCamCache(soap, &user, realCamIndex);
+            }
+            else
+            {
+                responseData.response =	getOnvifCameraCapability(realCamIndex, &user, soap);
+            }
             break;
 
         case ONVIF_SET_DATE_TIME:
@@ -747,7 +1985,12 @@ static void *onvifClientThread(void *data)
             break;
 
         case ONVIF_GET_MEDIA_URL:
-            if (onvifCamInfo[realCamIndex].mediaServiceInfo.media2Support == NO)
+            if ((onvifClientInfo[sessionIndex].onvifReqPara.forceConfigOnCamera == FALSE)
+                    && (getOnvifCamCacheStreamUrl(realCamIndex, onvifClientInfo[sessionIndex].onvifReqPara.profileNum, &urlReq) == SUCCESS))
+            {
+                responseData.response = ONVIF_CMD_SUCCESS;
+            }
+            else if (onvifCamInfo[realCamIndex].mediaServiceInfo.media2Support == NO)
             {
                 responseData.response =	getMediaUrl(soap, &user, GET_STREAM_TYPE(complexCamIndex), &onvifClientInfo[sessionIndex].onvifReqPara.strmConfig,
                                                     &urlReq, realCamIndex, onvifClientInfo[sessionIndex].onvifReqPara.forceConfigOnCamera,
@@ -759,6 +2002,11 @@ static void *onvifClientThread(void *data)
                                                      &urlReq, realCamIndex, onvifClientInfo[sessionIndex].onvifReqPara.forceConfigOnCamera,
                                                      onvifClientInfo[sessionIndex].onvifReqPara.profileNum);
             }
+
+            if ((responseData.response == ONVIF_CMD_SUCCESS) && (onvifClientInfo[sessionIndex].onvifReqPara.forceConfigOnCamera == FALSE))
+            {
+                updateOnvifCamCacheStreamUrl(realCamIndex, onvifClientInfo[sessionIndex].onvifReqPara.profileNum, &urlReq);
+            }
             responseData.data = (VOIDPTR)(&urlReq);
             break;
 
@@ -923,11 +2171,20 @@ static void *onvifClientThread(void *data)
         case ONVIF_MEDIA_PROFILES_UPDATE:
             if(onvifCamInfo[realCamIndex].mediaServiceInfo.media2Support == NO)
             {
-                responseData.response = selectProfileForMediaService(soap, &user, NO, realCamIndex);
+                responseData.response = selectProfileForMediaService(soap, &user, NO, realCamIndex, &profileSet);
+            }
+            else
+            {
+                responseData.response = selectProfileForMedia2Service(soap, &user, NO, realCamIndex, &profileSet);
+            }
+
+            if (responseData.response == ONVIF_CMD_SUCCESS)
+            {
+                applyOnvifMediaProfileSet(realCamIndex, &profileSet);
             }
             else
             {
-                responseData.response = selectProfileForMedia2Service(soap, &user, NO, realCamIndex);
+                freeOnvifMediaProfileSet(&profileSet);
             }
             break;
 
@@ -949,8 +2206,8 @@ static void *onvifClientThread(void *data)
 
     if (onvifClientInfo[sessionIndex].onvifReqPara.onvifReq != ONVIF_SEARCH_DEVICES)
     {
-        /* Free soap object memory */
-        freeSoapObject(soap);
+        /* Keep soap object for next request of camera */
+        putOnvifSoap(realCamIndex, soap, responseData.response);
     }
 
     if (onvifClientInfo[sessionIndex].onvifReqPara.onvifReq < ONVIF_REQUEST_MAX)
@@ -975,7 +2232,6 @@ static void *onvifClientThread(void *data)
     MUTEX_LOCK(onvifStatusLock);
     onvifClientInfo[sessionIndex].onvifSessionStatus = FREE;
     MUTEX_UNLOCK(onvifStatusLock);
-    pthread_exit(NULL);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -1721,6 +2977,7 @@ static ONVIF_RESP_STATUS_e getOnvifCameraCapability(UINT8 camIndex, SOAP_USER_DE
     BOOL                                                analytics2Support = NO;
     CHAR                                                ipAddrForUrl[DOMAIN_NAME_SIZE_MAX];
     CHAR                                                realtiveEntryPoint[MAX_RELATIVE_ADDR_LEN];
+    ONVIF_MEDIA_PROFILE_SET_t                           profileSet;
 
     //--------------------------------------------------------------------------------
     // Get Services
@@ -1837,9 +3094,10 @@ static ONVIF_RESP_STATUS_e getOnvifCameraCapability(UINT8 camIndex, SOAP_USER_DE
         user->addr = onvifCamInfo[camIndex].mediaServiceInfo.mediaServiceAddr;
         if (media2Support == YES)
         {
-            if ((status = selectProfileForMedia2Service(soap, user, ptzSupport, camIndex)) != ONVIF_CMD_SUCCESS)
+            if ((status = selectProfileForMedia2Service(soap, user, ptzSupport, camIndex, &profileSet)) != ONVIF_CMD_SUCCESS)
             {
                 /* If camera doesn't support media2 then ideally should not use analytics2. Hence withdraw support of it also */
+                freeOnvifMediaProfileSet(&profileSet);
                 media2Support = NO;
                 analytics2Support = NO;
                 WPRINT(ONVIF_CLIENT, "fail to get media2 profile, trying for media1: [camera=%d], [status=%d]", camIndex, status);
@@ -1848,12 +3106,14 @@ static ONVIF_RESP_STATUS_e getOnvifCameraCapability(UINT8 camIndex, SOAP_USER_DE
 
         if (media2Support == NO)
         {
-            if ((status = selectProfileForMediaService(soap, user,ptzSupport, camIndex)) != ONVIF_CMD_SUCCESS)
+            if ((status = selectProfileForMediaService(soap, user,ptzSupport, camIndex, &profileSet)) != ONVIF_CMD_SUCCESS)
             {
+                freeOnvifMediaProfileSet(&profileSet);
                 EPRINT(ONVIF_CLIENT, "fail to get media1 profile: [camera=%d], [status=%d]", camIndex, status);
                 break;
             }
         }
+        applyOnvifMediaProfileSet(camIndex, &profileSet);
 
         if (media2Support == NO)
         {
@@ -2090,6 +3350,7 @@ static ONVIF_RESP_STATUS_e getOnvifCameraCapability(UINT8 camIndex, SOAP_USER_DE
 
         /* save camera capabilities */
         SaveOnvifCameraCapabilty(camIndex, capabilitySupported);
+        saveOnvifCamCache(camIndex, capabilitySupported);
         status = ONVIF_CMD_SUCCESS;
     }
     while(0);
@@ -2192,14 +3453,16 @@ static BOOL addResolutionToCamCapability2(VIDEO_RESOLUTION2_t *resolutionAvailab
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief prepareMediaCapabilityFromEncoderConfigOptions    : Parse steam configuration and save to NVR
+ * @brief prepareMediaCapabilityFromEncoderConfigOptions    : Parse steam configuration of profile
  * @param camIndex                                          : Camera index
  * @param profileNum                                        : Profile Index
  * @param videoEncoderConfigOptions                         : received from camera
+ * @param pProfileParam                                     : Prepared profile wise capability
  * @return
  */
 static BOOL prepareMediaCapabilityFromEncoderConfigOptions(UINT8 camIndex, UINT8 profileNum,
-                                                           GET_VIDEO_ENCODER_CONFIGURATION_OPTIONS_RESPONSE_t *videoEncoderConfigOptions)
+                                                           GET_VIDEO_ENCODER_CONFIGURATION_OPTIONS_RESPONSE_t *videoEncoderConfigOptions,
+                                                           PROFILE_WISE_OPTION_PARAM_t **pProfileParam)
 {
     UINT8                       maxResolutionAvailable;
     VIDEO_RESOLUTION_t          *resoultionAvailable = NULL;
@@ -2368,20 +3631,22 @@ static BOOL prepareMediaCapabilityFromEncoderConfigOptions(UINT8 camIndex, UINT8
     }
 
     /* Memory deallocated at other place (FreeCameraCapability) */
-    SaveOnvifCameraCapabiltyProfileWise(camIndex, profileNum, tempProfileParam);
+    *pProfileParam = tempProfileParam;
     return SUCCESS;
 }
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief prepareMedia2CapabilityFromEncoderConfigOptions   : Parse steam configuration and save to NVR
+ * @brief prepareMedia2CapabilityFromEncoderConfigOptions   : Parse steam configuration of profile
  * @param camIndex                                          : Camera Index
  * @param profileNum                                        : Profile Number
  * @param videoEncoderConfigOptions                         : Received from camera
+ * @param pProfileParam                                     : Prepared profile wise capability
  * @return
  */
 static BOOL prepareMedia2CapabilityFromEncoderConfigOptions(UINT8 camIndex, UINT8 profileNum,
-                                                            GET_VIDEO_ENCODER_CONFIGURATION_OPTIONS_RESPONSE2_t *videoEncoderConfigOptions)
+                                                            GET_VIDEO_ENCODER_CONFIGURATION_OPTIONS_RESPONSE2_t *videoEncoderConfigOptions,
+                                                            PROFILE_WISE_OPTION_PARAM_t **pProfileParam)
 {
     UINT8                       maxResolutionAvailable;
     VIDEO_RESOLUTION2_t         *resoultionAvailable2;
@@ -2582,7 +3847,7 @@ static BOOL prepareMedia2CapabilityFromEncoderConfigOptions(UINT8 camIndex, UINT
     }
 
     /* Memory deallocated at other place (FreeCameraCapability) */
-    SaveOnvifCameraCapabiltyProfileWise(camIndex, profileNum, tempProfileParam);
+    *pProfileParam = tempProfileParam;
     return SUCCESS;
 }
 
@@ -2671,9 +3936,11 @@ static void fillOtherSupportedCapabiltyToCamera(CAPABILITY_TYPE *camCapability,
  * @param user                          : User information
  * @param ptzSupported                  : if PTZ support or not
  * @param camIndex                      : Camera index
+ * @param pProfileSet                   : Profiles received from camera
  * @return
  */
-static ONVIF_RESP_STATUS_e selectProfileForMediaService(SOAP_t *soap, SOAP_USER_DETAIL_t *user, BOOL ptzSupported, UINT8 camIndex)
+static ONVIF_RESP_STATUS_e selectProfileForMediaService(SOAP_t *soap, SOAP_USER_DETAIL_t *user, BOOL ptzSupported, UINT8 camIndex,
+                                                        ONVIF_MEDIA_PROFILE_SET_t *pProfileSet)
 {
     GET_PROFILES_t                                          getProfiles;
     GET_PROFILES_RESPONSE_t                                 getProfilesResponse;
@@ -2686,14 +3953,13 @@ static ONVIF_RESP_STATUS_e selectProfileForMediaService(SOAP_t *soap, SOAP_USER_
     INT16                                                   soapResp;
     UINT8                                                   profileIndex;
     UINT8                                                   profileCnt = 0;
-    BOOL                                                    ptzProfileAvailable = NO;
     ONVIF_RESP_STATUS_e                                     status = ONVIF_CMD_FAIL;
     UINT8                                                   supportedProfileCount = 0;
     CHARPTR                                                 profileToken;
     CHARPTR                                                 vdoSrcCfgToken;
     CHARPTR                                                 vdoEncCfgToken;
-    ONVIF_MEDIA_SERVICE_INFO_t                              *pMediaService = &(onvifCamInfo[camIndex].mediaServiceInfo);
 
+    initOnvifMediaProfileSet(camIndex, pProfileSet);
     user->addr = onvifCamInfo[camIndex].mediaServiceInfo.mediaServiceAddr;
     soapResp = GetProfiles(soap, &getProfiles, &getProfilesResponse, user);
     if (soapResp != SOAP_OK)
@@ -2728,15 +3994,15 @@ static ONVIF_RESP_STATUS_e selectProfileForMediaService(SOAP_t *soap, SOAP_USER_
         }
 
         //Set the PTZ Profile for PTZ operation
-        if ((ptzProfileAvailable == NO) && (ptzSupported == YES))
+        if ((pProfileSet->ptzProfileAvailable == NO) && (ptzSupported == YES))
         {
             if((getProfilesResponse.Profiles[profileIndex].PTZConfiguration != NULL)
                     && (getProfilesResponse.Profiles[profileIndex].PTZConfiguration->token != NULL))
             {
-                StringNCopy(onvifCamInfo[camIndex].ptzServiceInfo.profileToken, profileToken, MAX_TOKEN_SIZE);
-                StringNCopy(onvifCamInfo[camIndex].ptzServiceInfo.ptzConfigurationToken,
+                StringNCopy(pProfileSet->ptzProfileToken, profileToken, MAX_TOKEN_SIZE);
+                StringNCopy(pProfileSet->ptzConfigurationToken,
                             getProfilesResponse.Profiles[profileIndex].PTZConfiguration->token, MAX_TOKEN_SIZE);
-                ptzProfileAvailable = YES;
+                pProfileSet->ptzProfileAvailable = YES;
             }
         }
 
@@ -2794,17 +4060,17 @@ static ONVIF_RESP_STATUS_e selectProfileForMediaService(SOAP_t *soap, SOAP_USER_
         // if profile support one or more codec then select that profile for that codec streaming
         if(getVideoEncoderConfigurationOptionsResponse.Options->JPEG != NULL)
         {
-            pMediaService->mediaProfile[profileCnt].defaultEncodingInterval[GET_VALID_CODEC_NUM(VIDEO_MJPG)] = 0;
+            pProfileSet->mediaProfile[profileCnt].defaultEncodingInterval[GET_VALID_CODEC_NUM(VIDEO_MJPG)] = 0;
             if(getVideoEncoderConfigurationOptionsResponse.Options->JPEG->EncodingIntervalRange != NULL)
             {
-                pMediaService->mediaProfile[profileCnt].defaultEncodingInterval[GET_VALID_CODEC_NUM(VIDEO_MJPG)] =
+                pProfileSet->mediaProfile[profileCnt].defaultEncodingInterval[GET_VALID_CODEC_NUM(VIDEO_MJPG)] =
                         getVideoEncoderConfigurationOptionsResponse.Options->JPEG->EncodingIntervalRange->Min;
             }
         }
 
         if(getVideoEncoderConfigurationOptionsResponse.Options->H264 != NULL)
         {
-            pMediaService->h264SupportedProfile = H264_HIGH_PROFILE;
+            pProfileSet->h264SupportedProfile = H264_HIGH_PROFILE;
 
             if (getVideoEncoderConfigurationOptionsResponse.Options->H264->__sizeH264ProfilesSupported > 0)
             {
@@ -2813,19 +4079,19 @@ static ONVIF_RESP_STATUS_e selectProfileForMediaService(SOAP_t *soap, SOAP_USER_
                 while (supportedProfileCount != getVideoEncoderConfigurationOptionsResponse.Options->H264->__sizeH264ProfilesSupported)
                 {
                     if(*(getVideoEncoderConfigurationOptionsResponse.Options->H264->H264ProfilesSupported + supportedProfileCount)
-                            < pMediaService->h264SupportedProfile)
+                            < pProfileSet->h264SupportedProfile)
                     {
-                        pMediaService->h264SupportedProfile =
+                        pProfileSet->h264SupportedProfile =
                                 *(getVideoEncoderConfigurationOptionsResponse.Options->H264->H264ProfilesSupported+supportedProfileCount);
                     }
                     supportedProfileCount++;
                 }
             }
 
-            pMediaService->mediaProfile[profileCnt].defaultEncodingInterval[GET_VALID_CODEC_NUM(VIDEO_H264)] = 0;
+            pProfileSet->mediaProfile[profileCnt].defaultEncodingInterval[GET_VALID_CODEC_NUM(VIDEO_H264)] = 0;
             if(getVideoEncoderConfigurationOptionsResponse.Options->H264->EncodingIntervalRange != NULL)
             {
-                pMediaService->mediaProfile[profileCnt].defaultEncodingInterval[GET_VALID_CODEC_NUM(VIDEO_H264)] =
+                pProfileSet->mediaProfile[profileCnt].defaultEncodingInterval[GET_VALID_CODEC_NUM(VIDEO_H264)] =
                         getVideoEncoderConfigurationOptionsResponse.Options->H264->EncodingIntervalRange->Min;
             }
         }
@@ -2833,46 +4099,41 @@ static ONVIF_RESP_STATUS_e selectProfileForMediaService(SOAP_t *soap, SOAP_USER_
         if (getVideoEncoderConfigurationOptionsResponse.Options->MPEG4 != NULL)
         {
             supportedProfileCount = 0;
-            pMediaService->mpeg4SupportedProfile = MPEG4_ASP_PROFILE;
+            pProfileSet->mpeg4SupportedProfile = MPEG4_ASP_PROFILE;
 
             if(getVideoEncoderConfigurationOptionsResponse.Options->MPEG4->__sizeMpeg4ProfilesSupported > 0)
             {
                 while(supportedProfileCount != getVideoEncoderConfigurationOptionsResponse.Options->MPEG4->__sizeMpeg4ProfilesSupported)
                 {
                     if(*(getVideoEncoderConfigurationOptionsResponse.Options->MPEG4->Mpeg4ProfilesSupported+supportedProfileCount)
-                            < pMediaService->mpeg4SupportedProfile)
+                            < pProfileSet->mpeg4SupportedProfile)
                     {
-                        pMediaService->mpeg4SupportedProfile =
+                        pProfileSet->mpeg4SupportedProfile =
                                 *(getVideoEncoderConfigurationOptionsResponse.Options->MPEG4->Mpeg4ProfilesSupported+supportedProfileCount);
                     }
                     supportedProfileCount++;
                 }
             }
 
-            pMediaService->mediaProfile[profileCnt].defaultEncodingInterval[GET_VALID_CODEC_NUM(VIDEO_MPEG4)] = 0;
+            pProfileSet->mediaProfile[profileCnt].defaultEncodingInterval[GET_VALID_CODEC_NUM(VIDEO_MPEG4)] = 0;
             if(getVideoEncoderConfigurationOptionsResponse.Options->MPEG4->EncodingIntervalRange != NULL)
             {
-                pMediaService->mediaProfile[profileCnt].defaultEncodingInterval[GET_VALID_CODEC_NUM(VIDEO_MPEG4)] =
+                pProfileSet->mediaProfile[profileCnt].defaultEncodingInterval[GET_VALID_CODEC_NUM(VIDEO_MPEG4)] =
                         getVideoEncoderConfigurationOptionsResponse.Options->MPEG4->EncodingIntervalRange->Min;
             }
         }
 
-        /* Reset all data of current profile */
-        pMediaService->mediaProfile[profileCnt].profileToken[0] = '\0';
-        pMediaService->mediaProfile[profileCnt].videoSourceToken[0] = '\0';
-        pMediaService->mediaProfile[profileCnt].videoEncoderConfigurationToken[0] = '\0';
-        FreeCameraCapabilityProfileWise(camIndex, profileCnt);
-
-        if (FAIL == prepareMediaCapabilityFromEncoderConfigOptions(camIndex, profileCnt, &getVideoEncoderConfigurationOptionsResponse))
+        if (FAIL == prepareMediaCapabilityFromEncoderConfigOptions(camIndex, profileCnt, &getVideoEncoderConfigurationOptionsResponse,
+                                                                   &pProfileSet->pProfileParam[profileCnt]))
         {
             EPRINT(ONVIF_CLIENT, "fail to store video encoder config: [camera=%d], [profile=%d], [profileToken=%s], [vdoSrcCfgToken=%s], [vdoEncCfgToken=%s]",
                    camIndex, profileIndex, profileToken, vdoSrcCfgToken, vdoEncCfgToken);
             continue;
         }
 
-        StringNCopy(pMediaService->mediaProfile[profileCnt].profileToken, profileToken, MAX_TOKEN_SIZE);
-        StringNCopy(pMediaService->mediaProfile[profileCnt].videoSourceToken, vdoSrcCfgToken, MAX_TOKEN_SIZE);
-        StringNCopy(pMediaService->mediaProfile[profileCnt].videoEncoderConfigurationToken, vdoEncCfgToken, MAX_TOKEN_SIZE);
+        StringNCopy(pProfileSet->mediaProfile[profileCnt].profileToken, profileToken, MAX_TOKEN_SIZE);
+        StringNCopy(pProfileSet->mediaProfile[profileCnt].videoSourceToken, vdoSrcCfgToken, MAX_TOKEN_SIZE);
+        StringNCopy(pProfileSet->mediaProfile[profileCnt].videoEncoderConfigurationToken, vdoEncCfgToken, MAX_TOKEN_SIZE);
 
         DPRINT(ONVIF_CLIENT, "video encoder config stored: [camera=%d], profile: [nvr=%d], [cam=%d], [token=%s]",
                camIndex, profileCnt, profileIndex, profileToken);
@@ -2886,7 +4147,7 @@ static ONVIF_RESP_STATUS_e selectProfileForMediaService(SOAP_t *soap, SOAP_USER_
             break;
         }
     }
-    onvifCamInfo[camIndex].maxSupportedProfile = profileCnt;
+    pProfileSet->profileCnt = profileCnt;
 
     if ((soapResp == SOAP_ERR) || (soapResp == SOAP_TCP_ERROR))
     {
@@ -2903,25 +4164,26 @@ static ONVIF_RESP_STATUS_e selectProfileForMediaService(SOAP_t *soap, SOAP_USER_
  * @param user                          : User Information
  * @param ptzSupported                  : if PTZ support or not
  * @param camIndex                      : Camera Index
+ * @param pProfileSet                   : Profiles received from camera
  * @return
  */
-static ONVIF_RESP_STATUS_e selectProfileForMedia2Service(SOAP_t *soap, SOAP_USER_DETAIL_t *user, BOOL ptzSupported, UINT8 camIndex)
+static ONVIF_RESP_STATUS_e selectProfileForMedia2Service(SOAP_t *soap, SOAP_USER_DETAIL_t *user, BOOL ptzSupported, UINT8 camIndex,
+                                                         ONVIF_MEDIA_PROFILE_SET_t *pProfileSet)
 {
     GET_PROFILES2_t                                         getProfiles;
     GET_PROFILES_RESPONSE2_t                                getProfilesResponse;
     GET_VIDEO_ENCODER_CONFIGURATION_OPTIONS2_t              getVideoEncoderConfigurationOptions2;
     GET_VIDEO_ENCODER_CONFIGURATION_OPTIONS_RESPONSE2_t     getVideoEncoderConfigurationOptionsResponse2;
     INT16                                                   soapResp;
-    BOOL                                                    ptzProfileAvailable = NO;
     ONVIF_RESP_STATUS_e                                     status = ONVIF_CMD_FAIL;
     CHARPTR                                                 profileToken;
     CHARPTR                                                 vdoSrcCfgToken;
     CHARPTR                                                 vdoEncCfgToken;
-    ONVIF_MEDIA_SERVICE_INFO_t                              *pMediaService = &(onvifCamInfo[camIndex].mediaServiceInfo);
     UINT8                                                   profileIndex;
     UINT8                                                   profileCnt = 0;
     CHAR                                                    *pProfileTypes= "All";
 
+    initOnvifMediaProfileSet(camIndex, pProfileSet);
     user->addr = onvifCamInfo[camIndex].mediaServiceInfo.mediaServiceAddr;
     getProfiles.Token      = NULL;
     getProfiles.__sizeType = 1;
@@ -2965,15 +4227,15 @@ static ONVIF_RESP_STATUS_e selectProfileForMedia2Service(SOAP_t *soap, SOAP_USER
         }
 
         //Set the PTZ Profile for PTZ operation
-        if ((ptzProfileAvailable == NO) && (ptzSupported == YES))
+        if ((pProfileSet->ptzProfileAvailable == NO) && (ptzSupported == YES))
         {
             if((getProfilesResponse.Profiles[profileIndex].Configurations->PTZ != NULL) &&
                     getProfilesResponse.Profiles[profileIndex].Configurations->PTZ->token != NULL)
             {
-                StringNCopy(onvifCamInfo[camIndex].ptzServiceInfo.profileToken,profileToken,MAX_TOKEN_SIZE);
-                StringNCopy(onvifCamInfo[camIndex].ptzServiceInfo.ptzConfigurationToken,
+                StringNCopy(pProfileSet->ptzProfileToken,profileToken,MAX_TOKEN_SIZE);
+                StringNCopy(pProfileSet->ptzConfigurationToken,
                             getProfilesResponse.Profiles[profileIndex].Configurations->PTZ->token,MAX_TOKEN_SIZE);
-                ptzProfileAvailable = YES;
+                pProfileSet->ptzProfileAvailable = YES;
             }
         }
 
@@ -3011,22 +4273,17 @@ static ONVIF_RESP_STATUS_e selectProfileForMedia2Service(SOAP_t *soap, SOAP_USER
             continue;
         }
 
-        /* Reset all data of current profile */
-        pMediaService->mediaProfile[profileCnt].profileToken[0] = '\0';
-        pMediaService->mediaProfile[profileCnt].videoSourceToken[0] = '\0';
-        pMediaService->mediaProfile[profileCnt].videoEncoderConfigurationToken[0] = '\0';
-        FreeCameraCapabilityProfileWise(camIndex, profileCnt);
-
-        if (FAIL == prepareMedia2CapabilityFromEncoderConfigOptions(camIndex, profileCnt, &getVideoEncoderConfigurationOptionsResponse2))
+        if (FAIL == prepareMedia2CapabilityFromEncoderConfigOptions(camIndex, profileCnt, &getVideoEncoderConfigurationOptionsResponse2,
+                                                                    &pProfileSet->pProfileParam[profileCnt]))
         {
             EPRINT(ONVIF_CLIENT, "fail to store video encoder config: [camera=%d], [profile=%d], [profileToken=%s], [vdoSrcCfgToken=%s], [vdoEncCfgToken=%s]",
                    camIndex, profileIndex, profileToken, vdoSrcCfgToken, vdoEncCfgToken);
             continue;
         }
 
-        StringNCopy(pMediaService->mediaProfile[profileCnt].profileToken, profileToken, MAX_TOKEN_SIZE);
-        StringNCopy(pMediaService->mediaProfile[profileCnt].videoSourceToken, vdoSrcCfgToken, MAX_TOKEN_SIZE);
-        StringNCopy(pMediaService->mediaProfile[profileCnt].videoEncoderConfigurationToken, vdoEncCfgToken, MAX_TOKEN_SIZE);
+        StringNCopy(pProfileSet->mediaProfile[profileCnt].profileToken, profileToken, MAX_TOKEN_SIZE);
+        StringNCopy(pProfileSet->mediaProfile[profileCnt].videoSourceToken, vdoSrcCfgToken, MAX_TOKEN_SIZE);
+        StringNCopy(pProfileSet->mediaProfile[profileCnt].videoEncoderConfigurationToken, vdoEncCfgToken, MAX_TOKEN_SIZE);
 
         DPRINT(ONVIF_CLIENT, "video encoder config stored: [camera=%d], profile: [nvr=%d], [cam=%d], [token=%s]",
                camIndex, profileCnt, profileIndex, profileToken);
@@ -3040,7 +4297,7 @@ static ONVIF_RESP_STATUS_e selectProfileForMedia2Service(SOAP_t *soap, SOAP_USER
             break;
         }
     }
-    onvifCamInfo[camIndex].maxSupportedProfile = profileCnt;
+    pProfileSet->profileCnt = profileCnt;
 
     if((soapResp == SOAP_ERR) || (soapResp == SOAP_TCP_ERROR))
     {
@@ -4457,6 +5714,9 @@ static ONVIF_RESP_STATUS_e getBrandModel(SOAP_t *soap, SOAP_USER_DETAIL_t *user,
 
     /* Store model name */
     snprintf(modelName, MAX_MODEL_NAME_LEN, "%s", getDeviceInformationResponse.Model);
+
+    /* Identity of camera is used to validate capability cache */
+    setOnvifCamCacheKey(camIndex, user, brandName, modelName, getDeviceInformationResponse.SerialNumber, getDeviceInformationResponse.FirmwareVersion);
     return ONVIF_CMD_SUCCESS;
 }
 
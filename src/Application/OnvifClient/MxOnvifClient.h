@@ -201,6 +201,12 @@ BOOL GetOnvifMedia2Support(UINT8 camIndex);
 //-------------------------------------------------------------------------------------------------
 BOOL ValidatePtzFuncForOnvif(UINT8 camIndex, PTZ_FUNCTION_e ptzFunction);
 //-------------------------------------------------------------------------------------------------
+BOOL RestoreOnvifCameraCache(UINT8 camIndex);
+//-------------------------------------------------------------------------------------------------
+void RemoveOnvifCameraCache(UINT8 camIndex);
+//-------------------------------------------------------------------------------------------------
+UINT32 ApplyOnvifCameraRevalidation(UINT8 camIndex);
+//-------------------------------------------------------------------------------------------------
 //#################################################################################################
 // @END OF FILE
 //#################################################################################################
@@ -3281,6 +3281,7 @@ BOOL SendP2pClientFrameData(INT32 localMsgUid, UINT8 *pSendMsg, UINT32 sendMsgLe
     UINT8                   clientIdx;
     UINT16                  msgIdx;
     P2P_CLIENT_MSG_HEADER_t msgHeader;
+    struct iovec            msgIov[2];
 
     /* Validate length of stream. It should atleast frame header size */
     if (sendMsgLen < FRAME_HEADER_LEN_MAX)
@@ -3310,9 +3311,12 @@ BOOL SendP2pClientFrameData(INT32 localMsgUid, UINT8 *pSendMsg, UINT32 sendMsgLe
     MUTEX_LOCK(pP2pClientProc->socketLock);
     prepareMsgHeader(&msgHeader, P2P_MSG_TYPE_DATA, pP2pClientProc->p2pMsgUid[msgIdx].clientMsgUid, sendMsgLen);
 
-    /* Send control message */
-    if (((SUCCESS != SendP2pMsg(pP2pClientProc->pConnInfo->sockFd, (CHAR *)&msgHeader, P2P_CLIENT_MSG_HEADER_LEN, timeout)))
-            || (SUCCESS != SendP2pMsg(pP2pClientProc->pConnInfo->sockFd, (CHAR *)pSendMsg, sendMsgLen, timeout)))
+    /* Send message header and frame in single call */
+    msgIov[0].iov_base = &msgHeader;
+    msgIov[0].iov_len = P2P_CLIENT_MSG_HEADER_LEN;
+    msgIov[1].iov_base = pSendMsg;
+    msgIov[1].iov_len = sendMsgLen;
+    if (SUCCESS != SendP2pMsgIov(pP2pClientProc->pConnInfo->sockFd, msgIov, 2, timeout))
     {
         MUTEX_UNLOCK(pP2pClientProc->socketLock);
         EPRINT(P2P_MODULE, "fail to send frame msg: [client=%d], [model=%s]", pP2pClientProc->pConnInfo->clientIdx, pP2pClientProc->pConnInfo->model);
@@ -3324,6 +3328,35 @@ BOOL SendP2pClientFrameData(INT32 localMsgUid, UINT8 *pSendMsg, UINT32 sendMsgLe
     return TRUE;
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check whether client socket can accept new frame without waiting
+ * @param   localMsgUid
+ * @param   sendLen - Length of frame to send
+ * @return  TRUE if frame can be sent or client is on hold; FALSE otherwise
+ * @note    Frame send is not blocked for invalid client. Send will report the failure.
+ */
+BOOL IsP2pClientFrameSendReady(INT32 localMsgUid, UINT32 sendLen)
+{
+    UINT8   clientIdx;
+    UINT16  msgIdx;
+
+    /* Get client index and message index */
+    if (FALSE == getClientMsgIdxFromLocalMsgUid(localMsgUid, &clientIdx, &msgIdx))
+    {
+        return TRUE;
+    }
+
+    /* Frames are discarded silently while client is on hold */
+    if (TRUE == p2pClientProc[clientIdx].isP2pClientHold)
+    {
+        return TRUE;
+    }
+
+    /* Frame is sent with P2P message header */
+    return IsSocketSendReady(p2pClientProc[clientIdx].pConnInfo->sockFd, (P2P_CLIENT_MSG_HEADER_LEN + sendLen));
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   Client Message Close Callback (Equivalent to CloseSocket)
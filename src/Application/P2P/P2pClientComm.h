@@ -131,6 +131,8 @@ BOOL SendP2pClientControlData(INT32 localMsgUid, UINT8 *pSendMsg, UINT32 sendMsg
 //-------------------------------------------------------------------------------------------------
 BOOL SendP2pClientFrameData(INT32 localMsgUid, UINT8 *pSendMsg, UINT32 sendMsgLen, UINT32 timeout);
 //-------------------------------------------------------------------------------------------------
+BOOL IsP2pClientFrameSendReady(INT32 localMsgUid, UINT32 sendLen);
+//-------------------------------------------------------------------------------------------------
 void CloseP2pClientConn(INT32 *pLocalMsgUid);
 //-------------------------------------------------------------------------------------------------
 BOOL GetP2pClientDataXferFd(P2P_CLIENT_FD_TYPE_e fdType, INT32 localMsgUid, INT32 *pDataRecvFd);
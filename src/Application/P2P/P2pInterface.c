@@ -298,6 +298,19 @@ BOOL P2pDataSendCallback(INT32 connFd, UINT8 *pSendBuff, UINT32 sendLen, UINT32
     return SendP2pClientFrameData(connFd, pSendBuff, sendLen, timeout);
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check client can accept frame data without waiting (Equivalent to IsSocketSendReady)
+ * @param   connFd
+ * @param   sendLen
+ * @return  TRUE if ready; FALSE otherwise
+ */
+BOOL P2pDataSendReadyCallback(INT32 connFd, UINT32 sendLen)
+{
+    /* Provide to P2P client communication module */
+    return IsP2pClientFrameSendReady(connFd, sendLen);
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   P2P Client Message Close Callback (Equivalent to CloseSocket)
@@ -59,6 +59,8 @@ BOOL P2pCmdSendCallback(INT32 connFd, UINT8 *pSendBuff, UINT32 sendLen, UINT32 t
 //-------------------------------------------------------------------------------------------------
 BOOL P2pDataSendCallback(INT32 connFd, UINT8 *pSendBuff, UINT32 sendLen, UINT32 timeout);
 //-------------------------------------------------------------------------------------------------
+BOOL P2pDataSendReadyCallback(INT32 connFd, UINT32 sendLen);
+//-------------------------------------------------------------------------------------------------
 void P2pCloseConnCallback(INT32 *pConnFd);
 //-------------------------------------------------------------------------------------------------
 BOOL GetP2pDataXferFd(P2P_CLIENT_FD_TYPE_e fdType, INT32 localMsgUid, INT32 *pDataRecvFd);
@@ -1041,6 +1041,92 @@ BOOL SendP2pMsg(INT32 sockFd, CHAR *pMsgBuff, UINT32 msgLen, UINT32 timeout)
     return SUCCESS;
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Send P2P message scattered in multiple buffers on connected socket in single call
+ * @param   sockFd
+ * @param   pIov
+ * @param   iovCnt
+ * @param   timeout
+ * @return  Returns: SUCCESS-->Data sent, IN_PROGRESS-->No space on socket, REFUSE --> Conn closed or Bad FD else FAIL
+ */
+BOOL SendP2pMsgIov(INT32 sockFd, struct iovec *pIov, UINT8 iovCnt, UINT32 timeout)
+{
+    UINT8           iovIdx;
+    INT32           sentLen;
+    UINT32          msgLen = 0;
+    struct msghdr   msgHdr;
+
+    /* Use regular data send function id timeout specified */
+    if (timeout)
+    {
+        /* Send data on socket */
+        return SendIovToSocket(sockFd, pIov, iovCnt, timeout);
+    }
+
+    /* Check FD is valid or not */
+    if (sockFd == INVALID_CONNECTION)
+    {
+        EPRINT(P2P_MODULE, "invld fd found");
+        return REFUSE;
+    }
+
+    for (iovIdx = 0; iovIdx < iovCnt; iovIdx++)
+    {
+        msgLen += pIov[iovIdx].iov_len;
+    }
+
+    /* Send message on socket. Retry if interrupted by signal before any data sent */
+    memset(&msgHdr, 0, sizeof(msgHdr));
+    msgHdr.msg_iov = pIov;
+    msgHdr.msg_iovlen = iovCnt;
+    do
+    {
+        sentLen = sendmsg(sockFd, &msgHdr, MSG_DONTWAIT | MSG_NOSIGNAL);
+
+    } while ((sentLen == -1) && (errno == EINTR));
+
+    if (sentLen == -1)
+    {
+        switch(errno)
+        {
+            case EAGAIN:
+            #if (EWOULDBLOCK != EAGAIN)
+            case EWOULDBLOCK:
+            #endif
+            {
+                /* No space available on socket */
+            }
+            return IN_PROGRESS;
+
+            case EBADF:
+            case EPIPE:
+            case ECONNRESET:
+            case ECONNREFUSED:
+            {
+                EPRINT(P2P_MODULE, "connection closed: [fd=%d], [err=%s]", sockFd, STR_ERR);
+            }
+            return REFUSE;
+
+            default:
+            {
+                EPRINT(P2P_MODULE, "unhandled socket error: [err=%s]", STR_ERR);
+            }
+            return FAIL;
+        }
+    }
+
+    /* Sanity check */
+    if (sentLen != (INT32)msgLen)
+    {
+        EPRINT(P2P_MODULE, "truncated msg sent: [msgLen=%d], [sentLen=%d]", msgLen, sentLen);
+        return FAIL;
+    }
+
+    /* Message sent successfully */
+    return SUCCESS;
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   Receive P2P message from connected socket
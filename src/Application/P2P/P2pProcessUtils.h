@@ -79,6 +79,8 @@ BOOL IsP2pConnectionEstablished(INT32 sockFd);
 //-------------------------------------------------------------------------------------------------
 BOOL SendP2pMsg(INT32 sockFd, CHAR *pMsgBuff, UINT32 msgLen, UINT32 timeout);
 //-------------------------------------------------------------------------------------------------
+BOOL SendP2pMsgIov(INT32 sockFd, struct iovec *pIov, UINT8 iovCnt, UINT32 timeout);
+//-------------------------------------------------------------------------------------------------
 BOOL RecvP2pMsg(INT32 sockFd, CHAR *pMsgBuff, UINT32 buffSize, UINT32 *pMsgLen);
 //-------------------------------------------------------------------------------------------------
 INT32 GetAvailableBytesOnSocket(INT32 sockFd);
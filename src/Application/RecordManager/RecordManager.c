@@ -26,6 +26,10 @@
 /* Use Default Stack Size*/
 #define WRITE_FRAME_THREAD_STACK_SZ (0*MEGA_BYTE)
 
+/* Channels are sharded on frame writer threads, hence frame burst of one camera does not delay other cameras */
+#define REC_WRITER_SHARD_MAX        (4)
+#define REC_WRITER_SHARD_ID(ch)     ((ch) % recWriterShardCnt)
+
 #define STATE_OVERRIDE_PRINT(camera, oldStateStr, newStateStr) \
     WPRINT(RECORD_MANAGER, "state override: [camera=%d], [old=%s], [new=%s]", camera, oldStateStr, newStateStr)
 
@@ -101,6 +105,17 @@ typedef struct
 
 }RECORD_SESSION_t;
 
+typedef struct
+{
+    UINT8               shardId;
+    pthread_t           threadId;
+    pthread_cond_t      condSignal;                 // Wake up writer shard when any channel of shard is ready
+    UINT16              readIdx;
+    UINT16              readyCnt;
+    UINT8               readyChannel[MAX_CAMERA];   // Channels of shard which are ready for frame writing
+
+}REC_WRITER_SHARD_t;
+
 //#################################################################################################
 // @FUNCTION PROTOTYPE
 //#################################################################################################
@@ -129,6 +144,10 @@ static void stopCosecRec(UINT32 data);
 //-------------------------------------------------------------------------------------------------
 static VOIDPTR writeFrame(VOIDPTR threadArg);
 //-------------------------------------------------------------------------------------------------
+static void setRecordWriterReady(UINT8 channelNo);
+//-------------------------------------------------------------------------------------------------
+static BOOL getNextReadyChannel(REC_WRITER_SHARD_t *pShard, UINT8PTR pChannelNo);
+//-------------------------------------------------------------------------------------------------
 static void checkTimeSlotForRecording(UINT32 data);
 //-------------------------------------------------------------------------------------------------
 static BOOL valSchdlRecordTime(UINT8 channelNo, struct tm *brokenTime);
@@ -154,11 +173,10 @@ static BOOL 						recTerminateFlg;
 /** Note below mutex is recursive in nature , so it is possible to take lock over a lock */
 static pthread_mutex_t 				frameWrCondMutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
 
-// Conditional signal for recorder thread
-static pthread_cond_t 				frameWrCondSignal;
-
-// Recorder thread ID
-static pthread_t 					recThreadId;
+// Frame writer shards and channels queued on them
+static REC_WRITER_SHARD_t           recWriterShard[REC_WRITER_SHARD_MAX];
+static UINT8                        recWriterShardCnt;
+static BOOL                         recordWriterQueuedF[MAX_CAMERA];
 
 static BOOL							isRecInitDone = FALSE;
 static BOOL                         recordWriterStatus[MAX_CAMERA];
@@ -208,6 +226,7 @@ BOOL InitRecordManager(void)
 {
     UINT8           channelCnt;
     UINT8           recType;
+    UINT8           shardId;
     TIMER_INFO_t    timerInfo;
 
     /* Init of all session of record manager */
@@ -219,6 +238,7 @@ BOOL InitRecordManager(void)
         postAlarmRecTimerHandle[channelCnt] = INVALID_TIMER_HANDLE;
         postCosecRecTimerHandle[channelCnt] = INVALID_TIMER_HANDLE;
         recordWriterStatus[channelCnt] = FALSE;
+        recordWriterQueuedF[channelCnt] = FALSE;
         recordRestartWaitStatus[channelCnt] = FALSE;
         recordOnWaitStatus[channelCnt] = FALSE;
         recordOffWaitStatus[channelCnt] = FALSE;
@@ -229,7 +249,15 @@ BOOL InitRecordManager(void)
     }
 
     recTerminateFlg = FALSE;
-    pthread_cond_init(&frameWrCondSignal, NULL);
+    recWriterShardCnt = MIN(REC_WRITER_SHARD_MAX, getMaxCameraForCurrentVariant());
+    for (shardId = 0; shardId < recWriterShardCnt; shardId++)
+    {
+        recWriterShard[shardId].shardId = shardId;
+        recWriterShard[shardId].threadId = 0;
+        recWriterShard[shardId].readIdx = 0;
+        recWriterShard[shardId].readyCnt = 0;
+        pthread_cond_init(&recWriterShard[shardId].condSignal, NULL);
+    }
 
     /* Registered for schedule recording to execute at every 10 sec */
     timerInfo.funcPtr = checkTimeSlotForRecording;
@@ -238,10 +266,14 @@ BOOL InitRecordManager(void)
 
     if(StartTimer(timerInfo, &recTimerHandle) == SUCCESS)
     {
-        if (FAIL == Utils_CreateThread(&recThreadId, &writeFrame, NULL, JOINABLE_THREAD, WRITE_FRAME_THREAD_STACK_SZ))
+        for (shardId = 0; shardId < recWriterShardCnt; shardId++)
         {
-            recTerminateFlg = TRUE;
-            EPRINT(RECORD_MANAGER, "fail to create recorder thread");
+            if (FAIL == Utils_CreateThread(&recWriterShard[shardId].threadId, &writeFrame, &recWriterShard[shardId],
+                                           JOINABLE_THREAD, WRITE_FRAME_THREAD_STACK_SZ))
+            {
+                EPRINT(RECORD_MANAGER, "fail to create recorder thread: [shard=%d]", shardId);
+                recWriterShard[shardId].threadId = 0;
+            }
         }
     }
     else
@@ -270,6 +302,7 @@ BOOL InitRecordManager(void)
 BOOL DeInitRecordManager(void)
 {
     UINT8 channelCnt;
+    UINT8 shardId;
 
     /* closed all recording session */
     for (channelCnt = 0; channelCnt < getMaxCameraForCurrentVariant(); channelCnt++)
@@ -294,10 +327,19 @@ BOOL DeInitRecordManager(void)
         recordOffWaitStatus[channelCnt] = FALSE;
     }
     recTerminateFlg = TRUE;
-    pthread_cond_signal(&frameWrCondSignal);
+    for (shardId = 0; shardId < recWriterShardCnt; shardId++)
+    {
+        pthread_cond_signal(&recWriterShard[shardId].condSignal);
+    }
     MUTEX_UNLOCK(frameWrCondMutex);
 
-    pthread_join(recThreadId, NULL);
+    for (shardId = 0; shardId < recWriterShardCnt; shardId++)
+    {
+        if (recWriterShard[shardId].threadId != 0)
+        {
+            pthread_join(recWriterShard[shardId].threadId, NULL);
+        }
+    }
     DPRINT(SYS_LOG, "record manager deinit successfully");
     return SUCCESS;
 }
@@ -516,7 +558,6 @@ static BOOL exitPreCosecRecStrm(UINT8 channelNo)
  */
 BOOL StartRecordOnHddEvent(void)
 {
-    BOOL sendSingalF = FALSE;
     UINT8 channelNo;
 
     MUTEX_LOCK(frameWrCondMutex);
@@ -531,8 +572,7 @@ BOOL StartRecordOnHddEvent(void)
 
             // recording was going on for this channel then it must be stopped because of hard disk event.
             recordSession[channelNo].recordStatus = RECORD_RESTART_INIT;
-            recordWriterStatus[channelNo] = TRUE;
-            sendSingalF = TRUE;
+            setRecordWriterReady(channelNo);
             DPRINT(RECORD_MANAGER, "record session state: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_RESTART_INIT]);
         }
         else if(recordSession[channelNo].recordStatus == RECORD_OFF)
@@ -545,10 +585,6 @@ BOOL StartRecordOnHddEvent(void)
         }
     }
 
-    if (sendSingalF == TRUE)
-    {
-        pthread_cond_signal(&frameWrCondSignal);
-    }
     MUTEX_UNLOCK(frameWrCondMutex);
 
     return SUCCESS;
@@ -562,7 +598,6 @@ BOOL StartRecordOnHddEvent(void)
  */
 BOOL StopRecordOnHddEvent(void)
 {
-    BOOL sendSingalF = FALSE;
     UINT8 channelNo;
 
     MUTEX_LOCK(frameWrCondMutex);
@@ -578,17 +613,11 @@ BOOL StopRecordOnHddEvent(void)
             }
 
             recordSession[channelNo].recordStatus = RECORD_RESTART_CLEANUP;
-            recordWriterStatus[channelNo] = TRUE;
-            sendSingalF = TRUE;
+            setRecordWriterReady(channelNo);
             DPRINT(RECORD_MANAGER, "record session state: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_RESTART_CLEANUP]);
         }
     }
 
-    if (sendSingalF == TRUE)
-    {
-        pthread_cond_signal(&frameWrCondSignal);
-    }
-
     MUTEX_UNLOCK(frameWrCondMutex);
 
     return SUCCESS;
@@ -602,7 +631,6 @@ BOOL StopRecordOnHddEvent(void)
  */
 BOOL SwitchRecordSession(CAMERA_BIT_MASK_t cameraMask)
 {
-    BOOL sendSingalF = FALSE;
     UINT8 channelNo;
 
     MUTEX_LOCK(frameWrCondMutex);
@@ -620,16 +648,10 @@ BOOL SwitchRecordSession(CAMERA_BIT_MASK_t cameraMask)
         }
 
         recordSession[channelNo].recordStatus = RECORD_DRIVE_SWITCH;
-        recordWriterStatus[channelNo] = TRUE;
-        sendSingalF = TRUE;
+        setRecordWriterReady(channelNo);
         DPRINT(RECORD_MANAGER, "record session state: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_DRIVE_SWITCH]);
     }
 
-    if (sendSingalF == TRUE)
-    {
-        pthread_cond_signal(&frameWrCondSignal);
-    }
-
     MUTEX_UNLOCK(frameWrCondMutex);
 
     return SUCCESS;
@@ -953,8 +975,7 @@ static void startStreamCallback(const CI_STREAM_RESP_PARAM_t *respParam)
                         CameraEventNotify(channelNo, RECORDING_FAIL, INACTIVE);
                     }
 
-                    recordWriterStatus[channelNo] = TRUE;
-                    pthread_cond_signal(&frameWrCondSignal);
+                    setRecordWriterReady(channelNo);
                     MUTEX_UNLOCK(frameWrCondMutex);
                 }
                 else
@@ -985,8 +1006,7 @@ static void startStreamCallback(const CI_STREAM_RESP_PARAM_t *respParam)
                         MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
                     }
 
-                    recordWriterStatus[channelNo] = TRUE;
-                    pthread_cond_signal(&frameWrCondSignal);
+                    setRecordWriterReady(channelNo);
                     MUTEX_UNLOCK(frameWrCondMutex);
 
                     //NOTE: Cosec timer not operate in lock
@@ -1007,8 +1027,7 @@ static void startStreamCallback(const CI_STREAM_RESP_PARAM_t *respParam)
                     else
                     {
                         recordSession[channelNo].recordStatus = RECORD_RESTART_INIT;
-                        recordWriterStatus[channelNo] = TRUE;
-                        pthread_cond_signal(&frameWrCondSignal);
+                        setRecordWriterReady(channelNo);
                         DPRINT(RECORD_MANAGER, "record session state changed: [camera=%d], [state=%s --> %s]",
                                channelNo, recordStateStr[RECORD_RESTART_CLEANUP], recordStateStr[RECORD_RESTART_INIT]);
                     }
@@ -1023,8 +1042,7 @@ static void startStreamCallback(const CI_STREAM_RESP_PARAM_t *respParam)
                     if(recordSession[channelNo].recordStatus != RECORD_OFF)
                     {
                         recordSession[channelNo].recordStatus = RECORD_OFF_WAIT;
-                        recordWriterStatus[channelNo] = TRUE;
-                        pthread_cond_signal(&frameWrCondSignal);
+                        setRecordWriterReady(channelNo);
                         DPRINT(RECORD_MANAGER, "record session state: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_OFF_WAIT]);
                     }
 
@@ -1048,8 +1066,7 @@ static void startStreamCallback(const CI_STREAM_RESP_PARAM_t *respParam)
             }
             else if(recordSession[channelNo].recordStatus == RECORD_ON)
             {
-                recordWriterStatus[channelNo] = TRUE;
-                pthread_cond_signal(&frameWrCondSignal);
+                setRecordWriterReady(channelNo);
                 MUTEX_UNLOCK(frameWrCondMutex);
             }
             else
@@ -1066,8 +1083,7 @@ static void startStreamCallback(const CI_STREAM_RESP_PARAM_t *respParam)
             MUTEX_LOCK(frameWrCondMutex);
             if(recordSession[channelNo].recordStatus == RECORD_ON)
             {
-                recordWriterStatus[channelNo] = TRUE;
-                pthread_cond_signal(&frameWrCondSignal);
+                setRecordWriterReady(channelNo);
             }
             MUTEX_UNLOCK(frameWrCondMutex);
         }
@@ -1086,8 +1102,7 @@ static void startStreamCallback(const CI_STREAM_RESP_PARAM_t *respParam)
 
                 recordSession[channelNo].recordStatus = RECORD_RESTART_CLEANUP;
                 recordSession[channelNo].recordFailReason = EVNT_REC_STOP_VIDEO_LOSS;
-                recordWriterStatus[channelNo] = TRUE;
-                pthread_cond_signal(&frameWrCondSignal);
+                setRecordWriterReady(channelNo);
                 DPRINT(RECORD_MANAGER, "record session state: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_RESTART_CLEANUP]);
             }
             else
@@ -1422,8 +1437,7 @@ static NET_CMD_STATUS_e startInternalRecord(UINT8 channelNo, RECORD_TYPE_e recTy
         }
 
         recordSession[channelNo].recordStatus = RECORD_ON_WAIT;
-        recordWriterStatus[channelNo] = TRUE;
-        pthread_cond_signal(&frameWrCondSignal);
+        setRecordWriterReady(channelNo);
     }
     else
     {
@@ -1691,14 +1705,13 @@ static BOOL stopInternalRecord(UINT8 channelNo, RECORD_TYPE_e recordType, BOOL f
         {
             STATE_OVERRIDE_PRINT(channelNo, recordStateStr[recordSession[channelNo].recordStatus], recordStateStr[RECORD_OFF_WAIT]);
             recordOffWaitStatus[channelNo] = TRUE;
-            pthread_cond_signal(&frameWrCondSignal);
+            setRecordWriterReady(channelNo);
         }
         else
         {
             recordSession[channelNo].recordStatus = RECORD_OFF_WAIT;
             DPRINT(RECORD_MANAGER, "record session state: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_OFF_WAIT]);
-            recordWriterStatus[channelNo] = TRUE;
-            pthread_cond_signal(&frameWrCondSignal);
+            setRecordWriterReady(channelNo);
         }
 
         DPRINT(RECORD_MANAGER, "all recording stopped: [camera=%d]", channelNo);
@@ -1710,13 +1723,15 @@ static BOOL stopInternalRecord(UINT8 channelNo, RECORD_TYPE_e recordType, BOOL f
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   This is threading function for individual camera. It will received frame from camera
- *          interface and passes to disk manager for further process (Write into hard disk).
- * @param   threadArg
+ * @brief   This is threading function of frame writer shard. It will received frame from camera
+ *          interface and passes to disk manager for further process (Write into hard disk). Only ready
+ *          channels of the shard are processed in round robin manner, one frame or state per turn.
+ * @param   threadArg - Writer shard info
  * @return
  */
 static VOIDPTR writeFrame(VOIDPTR threadArg)
 {
+    REC_WRITER_SHARD_t          *pShard = (REC_WRITER_SHARD_t *)threadArg;
     BOOL                        writeFrame;
     UINT8                       channelNo;
     UINT8                       recordChannelMax;
@@ -1742,556 +1757,542 @@ static VOIDPTR writeFrame(VOIDPTR threadArg)
     RECORD_TYPE_e               record;
     UINT32                      errorCode = INVALID_ERROR_CODE;
 
-    THREAD_START("REC_MANAGER");
+    THREAD_START_INDEX2("REC_MANAGER", pShard->shardId);
 
     setpriority(PRIO_PROCESS, PRIO_PROCESS, -1);
     recordChannelMax = getMaxCameraForCurrentVariant();
 
     while(TRUE)
     {
+        /* Get frame from camera interface. camera interface was buffering the media dat. here we are making loop till
+         * end of media frame buffer. Do not Open this lock in between any operation in any state untill the end of that state */
         /* PARASOFT: BD-TRS-DIFCS: Variable used in multiple critical sections */
         MUTEX_LOCK(frameWrCondMutex);
-        if(recTerminateFlg == TRUE)
+        if (FALSE == getNextReadyChannel(pShard, &channelNo))
         {
             MUTEX_UNLOCK(frameWrCondMutex);
             break;
         }
 
-        /* Is recording on for any cameras? */
-        for (channelNo = 0; channelNo < recordChannelMax; channelNo++)
-        {
-            if (TRUE == recordWriterStatus[channelNo])
-            {
-                break;
-            }
-        }
-
-        /* Recording is not running for any camera */
-        if (channelNo >= recordChannelMax)
+        if (FALSE == recordWriterStatus[channelNo])
         {
-            /* PARASOFT: BD-TRS-DIFCS: Variable used in multiple critical sections */
-            pthread_cond_wait(&frameWrCondSignal, &frameWrCondMutex);
+            MUTEX_UNLOCK(frameWrCondMutex);
+            continue;
         }
-        MUTEX_UNLOCK(frameWrCondMutex);
 
-        for (channelNo = 0; channelNo < recordChannelMax; channelNo++)
+        /* PARASOFT: BD-TRS-DIFCS: Variable used in multiple critical sections */
+        switch(recordSession[channelNo].recordStatus)
         {
-            /* Get frame from camera interface. camera interface was buffering the media dat. here we are making loop till
-             * end of media frame buffer. Do not Open this lock in between any operation in any state untill the end of that state */
-            /* PARASOFT: BD-TRS-DIFCS: Variable used in multiple critical sections */
-            MUTEX_LOCK(frameWrCondMutex);
-            if (FALSE == recordWriterStatus[channelNo])
+            case RECORD_ON_WAIT:
             {
-                MUTEX_UNLOCK(frameWrCondMutex);
-                continue;
-            }
-
-            /* PARASOFT: BD-TRS-DIFCS: Variable used in multiple critical sections */
-            switch(recordSession[channelNo].recordStatus)
-            {
-                case RECORD_ON_WAIT:
+                /** Start DiskManager session */
+                if(StartRecordSession(channelNo) == FAIL)
                 {
-                    /** Start DiskManager session */
-                    if(StartRecordSession(channelNo) == FAIL)
-                    {
-                        MUTEX_LOCK(recordSession[channelNo].dataMutex);
-                        recordType = recordSession[channelNo].recordType;
-                        recordSession[channelNo].recordType = 0;
-                        recordSession[channelNo].alrmRecordCnt = 0;
-                        MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
+                    MUTEX_LOCK(recordSession[channelNo].dataMutex);
+                    recordType = recordSession[channelNo].recordType;
+                    recordSession[channelNo].recordType = 0;
+                    recordSession[channelNo].alrmRecordCnt = 0;
+                    MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
 
-                        recordSession[channelNo].recordStatus = RECORD_OFF;
+                    recordSession[channelNo].recordStatus = RECORD_OFF;
 
-                        /* Do not give disconnection log when drive is in recovery mode */
-                        if(DISK_ACT_RECOVERY != GetStorageDriveStatus(MAX_RECORDING_MODE))
+                    /* Do not give disconnection log when drive is in recovery mode */
+                    if(DISK_ACT_RECOVERY != GetStorageDriveStatus(MAX_RECORDING_MODE))
+                    {
+                        ReadHddConfig(&storageConfig);
+                        if ((storageConfig.recordDisk == REMOTE_NAS1) || (storageConfig.recordDisk == REMOTE_NAS2))
                         {
-                            ReadHddConfig(&storageConfig);
-                            if ((storageConfig.recordDisk == REMOTE_NAS1) || (storageConfig.recordDisk == REMOTE_NAS2))
+                            recStopRes = (storageConfig.recordDisk - REMOTE_NAS1) + EVNT_REC_STOP_NDD1_DISCONNECT;
+                        }
+                        else
+                        {
+                            diskStatus = GetCameraVolumeHealthStatus(channelNo, storageConfig.recordDisk);
+                            if ((diskStatus == STRG_HLT_NO_DISK) || (diskStatus == STRG_HLT_MAX))
                             {
-                                recStopRes = (storageConfig.recordDisk - REMOTE_NAS1) + EVNT_REC_STOP_NDD1_DISCONNECT;
+                                recStopRes = MAX_EVNT_REC_STOP;
                             }
-                            else
+                            else if (diskStatus == STRG_HLT_DISK_FULL)
                             {
-                                diskStatus = GetCameraVolumeHealthStatus(channelNo, storageConfig.recordDisk);
-                                if ((diskStatus == STRG_HLT_NO_DISK) || (diskStatus == STRG_HLT_MAX))
-                                {
-                                    recStopRes = MAX_EVNT_REC_STOP;
-                                }
-                                else if (diskStatus == STRG_HLT_DISK_FULL)
-                                {
-                                    recStopRes = EVNT_REC_STOP_DISK_FULL;
-                                }
-                                else
-                                {
-                                    recStopRes = EVNT_REC_STOP_DISK_FAULT;
-                                }
-                            }
-
-                            MUTEX_LOCK(recordSession[channelNo].dataMutex);
-                            if(recordSession[channelNo].recordFailReason != recStopRes)
-                            {
-                                recordSession[channelNo].recordFailReason = recStopRes;
-                                MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
-
-                                writeRecordingEvent(channelNo, recordType, REC_FAIL, recStopRes);
-                                CameraEventNotify(channelNo, RECORDING_FAIL, ACTIVE);
+                                recStopRes = EVNT_REC_STOP_DISK_FULL;
                             }
                             else
                             {
-                                MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
-                                for(record = 0; record < MAX_RECORD; record++)
-                                {
-                                    if (GET_BIT(recordType, record))
-                                    {
-                                        recordSession[channelNo].recordHeathState[record] = REC_FAIL;
-                                    }
-                                }
+                                recStopRes = EVNT_REC_STOP_DISK_FAULT;
                             }
                         }
 
-                        if (GET_BIT(recordType, COSEC_RECORD))
-                        {
-                            //NOTE : Cosec timer not operate in lock
-                            MUTEX_UNLOCK(frameWrCondMutex);
-                            DeleteTimer(&postCosecRecTimerHandle[channelNo]);
-                            MUTEX_LOCK(frameWrCondMutex);
-                        }
-                    }
-                    else
-                    {
-                        /** For Main stream 0-63 index is used and for sub stream 64-127 index is used */
-                        tmpCamIdx = getRecordChannelNo(channelNo);
                         MUTEX_LOCK(recordSession[channelNo].dataMutex);
-                        recordSession[channelNo].streamType = GET_STREAM_TYPE(tmpCamIdx);
-                        readPos = (recordSession[channelNo].preAlrmRcrdStrm == FALSE) ? CI_READ_LATEST_FRAME : CI_READ_OLDEST_FRAME;
-                        MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
-
-                        //Init session with camera interface
-                        InitStreamSession(tmpCamIdx, CI_STREAM_CLIENT_RECORD,readPos);
-
-                        // start Record stream from camera interface
-                        if (StartStream(tmpCamIdx, startStreamCallback, CI_STREAM_CLIENT_RECORD) != CMD_SUCCESS)
+                        if(recordSession[channelNo].recordFailReason != recStopRes)
                         {
-                            if(recordSession[channelNo].recordStatus != RECORD_OFF)
-                            {
-                                recordSession[channelNo].recordStatus = RECORD_OFF_WAIT;
-                            }
+                            recordSession[channelNo].recordFailReason = recStopRes;
+                            MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
 
-                            MUTEX_LOCK(recordSession[channelNo].dataMutex);
-                            recordType = recordSession[channelNo].recordType;
-                            if(recordSession[channelNo].recordFailReason != EVNT_REC_STOP_VIDEO_LOSS)
-                            {
-                                recordSession[channelNo].recordFailReason = EVNT_REC_STOP_VIDEO_LOSS;
-                                MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
-                                writeRecordingEvent(channelNo, recordType, REC_FAIL, EVNT_REC_STOP_VIDEO_LOSS);
-                                CameraEventNotify(channelNo, RECORDING_FAIL, ACTIVE);
-                            }
-                            else
+                            writeRecordingEvent(channelNo, recordType, REC_FAIL, recStopRes);
+                            CameraEventNotify(channelNo, RECORDING_FAIL, ACTIVE);
+                        }
+                        else
+                        {
+                            MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
+                            for(record = 0; record < MAX_RECORD; record++)
                             {
-                                MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
-                                for(record = 0; record < MAX_RECORD; record++)
+                                if (GET_BIT(recordType, record))
                                 {
-                                    if (GET_BIT(recordType, record))
-                                    {
-                                        recordSession[channelNo].recordHeathState[record] = REC_FAIL;
-                                    }
+                                    recordSession[channelNo].recordHeathState[record] = REC_FAIL;
                                 }
                             }
                         }
                     }
 
-                    if(recordSession[channelNo].recordStatus == RECORD_ON_WAIT)
+                    if (GET_BIT(recordType, COSEC_RECORD))
                     {
-                        if (TRUE == recordOnWaitStatus[channelNo])
+                        //NOTE : Cosec timer not operate in lock
+                        MUTEX_UNLOCK(frameWrCondMutex);
+                        DeleteTimer(&postCosecRecTimerHandle[channelNo]);
+                        MUTEX_LOCK(frameWrCondMutex);
+                    }
+                }
+                else
+                {
+                    /** For Main stream 0-63 index is used and for sub stream 64-127 index is used */
+                    tmpCamIdx = getRecordChannelNo(channelNo);
+                    MUTEX_LOCK(recordSession[channelNo].dataMutex);
+                    recordSession[channelNo].streamType = GET_STREAM_TYPE(tmpCamIdx);
+                    readPos = (recordSession[channelNo].preAlrmRcrdStrm == FALSE) ? CI_READ_LATEST_FRAME : CI_READ_OLDEST_FRAME;
+                    MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
+
+                    //Init session with camera interface
+                    InitStreamSession(tmpCamIdx, CI_STREAM_CLIENT_RECORD,readPos);
+
+                    // start Record stream from camera interface
+                    if (StartStream(tmpCamIdx, startStreamCallback, CI_STREAM_CLIENT_RECORD) != CMD_SUCCESS)
+                    {
+                        if(recordSession[channelNo].recordStatus != RECORD_OFF)
                         {
-                            recordSession[channelNo].recordStatus = RECORD_ON;
-                            recordSession[channelNo].recordFailReason = MAX_EVNT_REC_STOP;
-                            DPRINT(RECORD_MANAGER, "record fsm: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_ON]);
+                            recordSession[channelNo].recordStatus = RECORD_OFF_WAIT;
+                        }
 
-                            MUTEX_LOCK(recordSession[channelNo].dataMutex);
-                            recordType = recordSession[channelNo].recordType;
-                            recordSession[channelNo].recordFailReason = MAX_EVNT_REC_STOP;
+                        MUTEX_LOCK(recordSession[channelNo].dataMutex);
+                        recordType = recordSession[channelNo].recordType;
+                        if(recordSession[channelNo].recordFailReason != EVNT_REC_STOP_VIDEO_LOSS)
+                        {
+                            recordSession[channelNo].recordFailReason = EVNT_REC_STOP_VIDEO_LOSS;
                             MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
-
-                            writeRecordingEvent(channelNo, recordType, REC_START, MAX_EVNT_REC_STOP);
-                            CameraEventNotify(channelNo, RECORDING_FAIL, INACTIVE);
-                            recordOnWaitStatus[channelNo] = FALSE;
+                            writeRecordingEvent(channelNo, recordType, REC_FAIL, EVNT_REC_STOP_VIDEO_LOSS);
+                            CameraEventNotify(channelNo, RECORDING_FAIL, ACTIVE);
                         }
                         else
                         {
-                            recordWriterStatus[channelNo] = FALSE;
+                            MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
+                            for(record = 0; record < MAX_RECORD; record++)
+                            {
+                                if (GET_BIT(recordType, record))
+                                {
+                                    recordSession[channelNo].recordHeathState[record] = REC_FAIL;
+                                }
+                            }
                         }
                     }
-                    MUTEX_UNLOCK(frameWrCondMutex);
+                }
 
-                    if(recordSession[channelNo].recordStatus == RECORD_ON)
+                if(recordSession[channelNo].recordStatus == RECORD_ON_WAIT)
+                {
+                    if (TRUE == recordOnWaitStatus[channelNo])
                     {
-                        EventDetectFunc(channelNo, RECORDING_START, ACTIVE);
+                        recordSession[channelNo].recordStatus = RECORD_ON;
+                        recordSession[channelNo].recordFailReason = MAX_EVNT_REC_STOP;
+                        DPRINT(RECORD_MANAGER, "record fsm: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_ON]);
+
+                        MUTEX_LOCK(recordSession[channelNo].dataMutex);
+                        recordType = recordSession[channelNo].recordType;
+                        recordSession[channelNo].recordFailReason = MAX_EVNT_REC_STOP;
+                        MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
+
+                        writeRecordingEvent(channelNo, recordType, REC_START, MAX_EVNT_REC_STOP);
+                        CameraEventNotify(channelNo, RECORDING_FAIL, INACTIVE);
+                        recordOnWaitStatus[channelNo] = FALSE;
+                    }
+                    else
+                    {
+                        recordWriterStatus[channelNo] = FALSE;
                     }
                 }
-                break;
+                MUTEX_UNLOCK(frameWrCondMutex);
 
-                case RECORD_ON:
+                if(recordSession[channelNo].recordStatus == RECORD_ON)
                 {
-                    writeFrame = FALSE;
-                    MUTEX_LOCK(recordSession[channelNo].dataMutex);
-                    recordType = recordSession[channelNo].recordType;
-                    /** Create Index for main string or sub string based on the configuration */
-                    tmpCamIdx = (channelNo + (recordChannelMax * recordSession[channelNo].streamType));
-                    adaptiveRecordingF = recordSession[channelNo].adaptiveRecF;
-                    MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
-                    MUTEX_UNLOCK(frameWrCondMutex);
+                    EventDetectFunc(channelNo, RECORDING_START, ACTIVE);
+                }
+            }
+            break;
 
-                    if (FAIL == GetDmBufferState(channelNo))
+            case RECORD_ON:
+            {
+                writeFrame = FALSE;
+                MUTEX_LOCK(recordSession[channelNo].dataMutex);
+                recordType = recordSession[channelNo].recordType;
+                /** Create Index for main string or sub string based on the configuration */
+                tmpCamIdx = (channelNo + (recordChannelMax * recordSession[channelNo].streamType));
+                adaptiveRecordingF = recordSession[channelNo].adaptiveRecF;
+                MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
+                MUTEX_UNLOCK(frameWrCondMutex);
+
+                if (FAIL == GetDmBufferState(channelNo))
+                {
+                    MUTEX_LOCK(frameWrCondMutex);
+                    if (TRUE == recordOffWaitStatus[channelNo])
                     {
-                        MUTEX_LOCK(frameWrCondMutex);
-                        if (TRUE == recordOffWaitStatus[channelNo])
-                        {
-                            recordSession[channelNo].recordStatus = RECORD_OFF_WAIT;
-                            recordOffWaitStatus[channelNo] = FALSE;
-                        }
-                        else
+                        recordSession[channelNo].recordStatus = RECORD_OFF_WAIT;
+                        recordOffWaitStatus[channelNo] = FALSE;
+                    }
+                    else
+                    {
+                        if(recordSession[channelNo].recordStatus == RECORD_ON)
                         {
-                            if(recordSession[channelNo].recordStatus == RECORD_ON)
-                            {
-                                recordWriterStatus[channelNo] = FALSE;
-                            }
+                            recordWriterStatus[channelNo] = FALSE;
                         }
-                        MUTEX_UNLOCK(frameWrCondMutex);
-                        break;
                     }
+                    MUTEX_UNLOCK(frameWrCondMutex);
+                    break;
+                }
 
-                    pendFrame = GetNextFrame(tmpCamIdx, CI_STREAM_CLIENT_RECORD, &streamInfo, &streadmDataPtr, &streamLen);
-                    if(pendFrame >= 1)
+                pendFrame = GetNextFrame(tmpCamIdx, CI_STREAM_CLIENT_RECORD, &streamInfo, &streadmDataPtr, &streamLen);
+                if(pendFrame >= 1)
+                {
+                    /** Alarm record flag present in record type when Alarm recording is enabled and any motion event is occured */
+                    frameSkipF = FALSE;
+                    if((GET_BIT(recordType, ALARM_RECORD) == 0) && (GET_BIT(recordType, COSEC_RECORD) == 0))
                     {
-                        /** Alarm record flag present in record type when Alarm recording is enabled and any motion event is occured */
-                        frameSkipF = FALSE;
-                        if((GET_BIT(recordType, ALARM_RECORD) == 0) && (GET_BIT(recordType, COSEC_RECORD) == 0))
+                        if (adaptiveRecordingF == TRUE)
                         {
-                            if (adaptiveRecordingF == TRUE)
+                            if (streamInfo->streamType == STREAM_TYPE_VIDEO)
                             {
-                                if (streamInfo->streamType == STREAM_TYPE_VIDEO)
-                                {
-                                    if (streamInfo->streamPara.videoStreamType != I_FRAME)
-                                    {
-                                        frameSkipF = TRUE;
-                                    }
-                                }
-                                else
+                                if (streamInfo->streamPara.videoStreamType != I_FRAME)
                                 {
                                     frameSkipF = TRUE;
                                 }
                             }
+                            else
+                            {
+                                frameSkipF = TRUE;
+                            }
                         }
+                    }
 
-                        if(frameSkipF == FALSE)
+                    if(frameSkipF == FALSE)
+                    {
+                        prevFrameTime = recordSession[channelNo].localTime.totalSec;
+                        timeDiff = ((INT32)(prevFrameTime - streamInfo->localTime.totalSec));
+
+                        if((recordSession[channelNo].preRecdStrmSkip == YES) && ((timeDiff >= 5) || (timeDiff <= TWO_FRAME_TIME_DIFF)))
                         {
-                            prevFrameTime = recordSession[channelNo].localTime.totalSec;
-                            timeDiff = ((INT32)(prevFrameTime - streamInfo->localTime.totalSec));
+                            EPRINT(RECORD_MANAGER, "frame time was updated: [camera=%d], [prev=%d], [cur=%d], [diff=%d]",
+                                   channelNo, prevFrameTime, streamInfo->localTime.totalSec, timeDiff);
 
-                            if((recordSession[channelNo].preRecdStrmSkip == YES) && ((timeDiff >= 5) || (timeDiff <= TWO_FRAME_TIME_DIFF)))
+                            /* Time of current frame was older than previous frame. so here we should
+                             * stop the current working file and start recording into new file */
+                            StopRecordSession(channelNo);
+                            if (StartRecordSession(channelNo) == FAIL)
                             {
-                                EPRINT(RECORD_MANAGER, "frame time was updated: [camera=%d], [prev=%d], [cur=%d], [diff=%d]",
-                                       channelNo, prevFrameTime, streamInfo->localTime.totalSec, timeDiff);
-
-                                /* Time of current frame was older than previous frame. so here we should
-                                 * stop the current working file and start recording into new file */
-                                StopRecordSession(channelNo);
-                                if (StartRecordSession(channelNo) == FAIL)
-                                {
-                                    EPRINT(RECORD_MANAGER, "fail to start record session: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_ON]);
-                                }
+                                EPRINT(RECORD_MANAGER, "fail to start record session: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_ON]);
+                            }
 
-                                if(GetDmBufferState(channelNo) == SUCCESS)
+                            if(GetDmBufferState(channelNo) == SUCCESS)
+                            {
+                                writeFrame = TRUE;
+                            }
+                            else
+                            {
+                                recordSession[channelNo].localTime.totalSec = streamInfo->localTime.totalSec;
+                            }
+                        }
+                        else
+                        {
+                            writeFrame = TRUE;
+                            if(recordSession[channelNo].preRecdStrmSkip == NO)
+                            {
+                                preRecordTime = 0;
+                                if (GET_BIT(recordType, ALARM_RECORD))
                                 {
-                                    writeFrame = TRUE;
+                                    ReadSingleAlarmRecordConfig(channelNo, &alarmRecordCfg);
+                                    preRecordTime = alarmRecordCfg.preRecordTime;
                                 }
-                                else
+                                else if (GET_BIT(recordType, COSEC_RECORD))
                                 {
-                                    recordSession[channelNo].localTime.totalSec = streamInfo->localTime.totalSec;
+                                    ReadSingleCosecPreRecConfig(channelNo, &cosecRecParam);
+                                    preRecordTime = (cosecRecParam.enable == ENABLE) ? cosecRecParam.preRecDuration : 0;
                                 }
-                            }
-                            else
-                            {
-                                writeFrame = TRUE;
-                                if(recordSession[channelNo].preRecdStrmSkip == NO)
+
+                                if (preRecordTime > 0)
                                 {
-                                    preRecordTime = 0;
-                                    if (GET_BIT(recordType, ALARM_RECORD))
+                                    timeDiff = ((INT32)(prevFrameTime - streamInfo->localTime.totalSec));
+                                    if(timeDiff <= (INT32)preRecordTime)
                                     {
-                                        ReadSingleAlarmRecordConfig(channelNo, &alarmRecordCfg);
-                                        preRecordTime = alarmRecordCfg.preRecordTime;
+                                        recordSession[channelNo].preRecdStrmSkip = YES;
+                                        DPRINT(RECORD_MANAGER, "pre-record frame skip: [camera=%d], [prev=%d], [cur=%d], [diff=%dsec]",
+                                               channelNo, prevFrameTime, streamInfo->localTime.totalSec, timeDiff);
                                     }
-                                    else if (GET_BIT(recordType, COSEC_RECORD))
+                                    else
                                     {
-                                        ReadSingleCosecPreRecConfig(channelNo, &cosecRecParam);
-                                        preRecordTime = (cosecRecParam.enable == ENABLE) ? cosecRecParam.preRecDuration : 0;
+                                        writeFrame = FALSE;
                                     }
-
-                                    if (preRecordTime > 0)
+                                }
+                                else
+                                {
+                                    if(prevFrameTime <= streamInfo->localTime.totalSec)
                                     {
-                                        timeDiff = ((INT32)(prevFrameTime - streamInfo->localTime.totalSec));
-                                        if(timeDiff <= (INT32)preRecordTime)
-                                        {
-                                            recordSession[channelNo].preRecdStrmSkip = YES;
-                                            DPRINT(RECORD_MANAGER, "pre-record frame skip: [camera=%d], [prev=%d], [cur=%d], [diff=%dsec]",
-                                                   channelNo, prevFrameTime, streamInfo->localTime.totalSec, timeDiff);
-                                        }
-                                        else
-                                        {
-                                            writeFrame = FALSE;
-                                        }
+                                        recordSession[channelNo].preRecdStrmSkip = YES;
+                                        DPRINT(RECORD_MANAGER, "pre-record frame skip: [camera=%d], [prev=%d], [cur=%d], [diff=%dsec]",
+                                               channelNo, prevFrameTime, streamInfo->localTime.totalSec, (prevFrameTime - streamInfo->localTime.totalSec));
                                     }
                                     else
                                     {
-                                        if(prevFrameTime <= streamInfo->localTime.totalSec)
-                                        {
-                                            recordSession[channelNo].preRecdStrmSkip = YES;
-                                            DPRINT(RECORD_MANAGER, "pre-record frame skip: [camera=%d], [prev=%d], [cur=%d], [diff=%dsec]",
-                                                   channelNo, prevFrameTime, streamInfo->localTime.totalSec, (prevFrameTime - streamInfo->localTime.totalSec));
-                                        }
-                                        else
-                                        {
-                                            writeFrame = FALSE;
-                                        }
+                                        writeFrame = FALSE;
                                     }
                                 }
                             }
-
-                            if(writeFrame == TRUE)
-                            {
-                                metaDataInfo.channelNo = channelNo;
-                                metaDataInfo.mediaType = streamInfo->streamType;
-                                metaDataInfo.eventType = recordType;
-                                metaDataInfo.localTime.totalSec = streamInfo->localTime.totalSec;
-                                metaDataInfo.localTime.mSec = streamInfo->localTime.mSec;
-                                metaDataInfo.fps = (UINT16)streamInfo->streamPara.sampleRate;
-                                metaDataInfo.codecType = streamInfo->streamPara.streamCodecType;
-                                metaDataInfo.resolution = streamInfo->streamPara.resolution;
-                                metaDataInfo.vop = streamInfo->streamPara.videoStreamType;
-                                metaDataInfo.noOfRefFrame = streamInfo->streamPara.noOfRefFrame;
-
-                                //write media data as well as metadata information
-                                if(WriteMediaFrame(streadmDataPtr, streamLen, channelNo, &metaDataInfo, &errorCode) == FAIL)
-                                {
-                                    HandleDiskError(channelNo, errorCode);
-
-                                    /** Clear error code after processing error */
-                                    errorCode = INVALID_ERROR_CODE;
-                                }
-
-                                // Update prevFrmTime from current frame time
-                                recordSession[channelNo].localTime.totalSec = streamInfo->localTime.totalSec;
-                                recordSession[channelNo].localTime.mSec = streamInfo->localTime.mSec;
-                            }
                         }
-                    }
 
-                    MUTEX_LOCK(frameWrCondMutex);
-                    if (TRUE == recordOffWaitStatus[channelNo])
-                    {
-                        recordSession[channelNo].recordStatus = RECORD_OFF_WAIT;
-                        recordOffWaitStatus[channelNo] = FALSE;
-                        MUTEX_UNLOCK(frameWrCondMutex);
-                    }
-                    else
-                    {
-                        MUTEX_UNLOCK(frameWrCondMutex);
-                        if(pendFrame < 2)
+                        if(writeFrame == TRUE)
                         {
-                            MUTEX_LOCK(frameWrCondMutex);
-                            if(recordSession[channelNo].recordStatus == RECORD_ON)
+                            metaDataInfo.channelNo = channelNo;
+                            metaDataInfo.mediaType = streamInfo->streamType;
+                            metaDataInfo.eventType = recordType;
+                            metaDataInfo.localTime.totalSec = streamInfo->localTime.totalSec;
+                            metaDataInfo.localTime.mSec = streamInfo->localTime.mSec;
+                            metaDataInfo.fps = (UINT16)streamInfo->streamPara.sampleRate;
+                            metaDataInfo.codecType = streamInfo->streamPara.streamCodecType;
+                            metaDataInfo.resolution = streamInfo->streamPara.resolution;
+                            metaDataInfo.vop = streamInfo->streamPara.videoStreamType;
+                            metaDataInfo.noOfRefFrame = streamInfo->streamPara.noOfRefFrame;
+
+                            //write media data as well as metadata information
+                            if(WriteMediaFrame(streadmDataPtr, streamLen, channelNo, &metaDataInfo, &errorCode) == FAIL)
                             {
-                                recordWriterStatus[channelNo] = FALSE;
+                                HandleDiskError(channelNo, errorCode);
+
+                                /** Clear error code after processing error */
+                                errorCode = INVALID_ERROR_CODE;
                             }
-                            MUTEX_UNLOCK(frameWrCondMutex);
+
+                            // Update prevFrmTime from current frame time
+                            recordSession[channelNo].localTime.totalSec = streamInfo->localTime.totalSec;
+                            recordSession[channelNo].localTime.mSec = streamInfo->localTime.mSec;
                         }
                     }
                 }
-                break;
 
-                case RECORD_OFF_WAIT:
+                MUTEX_LOCK(frameWrCondMutex);
+                if (TRUE == recordOffWaitStatus[channelNo])
                 {
-                    MUTEX_UNLOCK(frameWrCondMutex);
-                    DPRINT(RECORD_MANAGER, "record fsm: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_OFF_WAIT]);
-
-                    StopRecordSession(channelNo);
-                    StopStream(getRecordChannelNo(channelNo), CI_STREAM_CLIENT_RECORD);
-
-                    MUTEX_LOCK(frameWrCondMutex);
-                    MUTEX_LOCK(recordSession[channelNo].dataMutex);
-                    recordSession[channelNo].alrmRecordCnt = 0;
-                    recordSession[channelNo].recordType = 0;
-                    MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
-                    recordSession[channelNo].recordStatus = RECORD_OFF;
-                    recordWriterStatus[channelNo] = FALSE;
+                    recordSession[channelNo].recordStatus = RECORD_OFF_WAIT;
+                    recordOffWaitStatus[channelNo] = FALSE;
                     MUTEX_UNLOCK(frameWrCondMutex);
                 }
-                break;
-
-                case RECORD_RESTART_CLEANUP:
+                else
                 {
-                    MUTEX_LOCK(recordSession[channelNo].dataMutex);
-                    recordType = recordSession[channelNo].recordType;
-                    recStopRes = recordSession[channelNo].recordFailReason;
-                    MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
                     MUTEX_UNLOCK(frameWrCondMutex);
-                    DPRINT(RECORD_MANAGER, "record fsm: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_RESTART_CLEANUP]);
-
-                    if(StopRecordSession(channelNo) == SUCCESS)
-                    {
-                        MUTEX_LOCK(frameWrCondMutex);
-                        writeRecordingEvent(channelNo, recordType, REC_FAIL, recStopRes);
-                        CameraEventNotify(channelNo, RECORDING_FAIL, ACTIVE);
-                    }
-                    else
+                    if(pendFrame < 2)
                     {
-                        EPRINT(RECORD_MANAGER, "fail to stop record session: [camera=%d]", channelNo);
                         MUTEX_LOCK(frameWrCondMutex);
-                    }
-
-                    /* If record state change during stop record session */
-                    if (recordSession[channelNo].recordStatus != RECORD_RESTART_CLEANUP)
-                    {
-                        WPRINT(RECORD_MANAGER, "intermediate state changed in record restart cleanup: [camera=%d], [state=%s]",
-                               channelNo, recordStateStr[recordSession[channelNo].recordStatus]);
-                    }
-                    else
-                    {
-                        recordWriterStatus[channelNo] = FALSE;
-                        if (TRUE == recordRestartWaitStatus[channelNo])
+                        if(recordSession[channelNo].recordStatus == RECORD_ON)
                         {
-                            recordRestartWaitStatus[channelNo] = FALSE;
-                            recordSession[channelNo].recordStatus = RECORD_RESTART_INIT;
-                            recordWriterStatus[channelNo] = TRUE;
+                            recordWriterStatus[channelNo] = FALSE;
                         }
+                        MUTEX_UNLOCK(frameWrCondMutex);
                     }
-                    MUTEX_UNLOCK(frameWrCondMutex);
                 }
-                break;
+            }
+            break;
+
+            case RECORD_OFF_WAIT:
+            {
+                MUTEX_UNLOCK(frameWrCondMutex);
+                DPRINT(RECORD_MANAGER, "record fsm: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_OFF_WAIT]);
+
+                StopRecordSession(channelNo);
+                StopStream(getRecordChannelNo(channelNo), CI_STREAM_CLIENT_RECORD);
+
+                MUTEX_LOCK(frameWrCondMutex);
+                MUTEX_LOCK(recordSession[channelNo].dataMutex);
+                recordSession[channelNo].alrmRecordCnt = 0;
+                recordSession[channelNo].recordType = 0;
+                MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
+                recordSession[channelNo].recordStatus = RECORD_OFF;
+                recordWriterStatus[channelNo] = FALSE;
+                MUTEX_UNLOCK(frameWrCondMutex);
+            }
+            break;
+
+            case RECORD_RESTART_CLEANUP:
+            {
+                MUTEX_LOCK(recordSession[channelNo].dataMutex);
+                recordType = recordSession[channelNo].recordType;
+                recStopRes = recordSession[channelNo].recordFailReason;
+                MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
+                MUTEX_UNLOCK(frameWrCondMutex);
+                DPRINT(RECORD_MANAGER, "record fsm: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_RESTART_CLEANUP]);
 
-                case RECORD_RESTART_INIT:
+                if(StopRecordSession(channelNo) == SUCCESS)
                 {
-                    MUTEX_LOCK(recordSession[channelNo].dataMutex);
-                    recordType = recordSession[channelNo].recordType;
-                    MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
-                    DPRINT(RECORD_MANAGER, "record fsm: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_RESTART_INIT]);
+                    MUTEX_LOCK(frameWrCondMutex);
+                    writeRecordingEvent(channelNo, recordType, REC_FAIL, recStopRes);
+                    CameraEventNotify(channelNo, RECORDING_FAIL, ACTIVE);
+                }
+                else
+                {
+                    EPRINT(RECORD_MANAGER, "fail to stop record session: [camera=%d]", channelNo);
+                    MUTEX_LOCK(frameWrCondMutex);
+                }
 
-                    if(StartRecordSession(channelNo) == SUCCESS)
-                    {
-                        recordSession[channelNo].recordFailReason = MAX_EVNT_REC_STOP;
-                        writeRecordingEvent(channelNo, recordType, REC_START, MAX_EVNT_REC_STOP);
-                        EventDetectFunc(channelNo, RECORDING_START, ACTIVE);
-                        CameraEventNotify(channelNo, RECORDING_FAIL, INACTIVE);
-                        recordSession[channelNo].recordStatus = RECORD_ON;
-                    }
-                    else
+                /* If record state change during stop record session */
+                if (recordSession[channelNo].recordStatus != RECORD_RESTART_CLEANUP)
+                {
+                    WPRINT(RECORD_MANAGER, "intermediate state changed in record restart cleanup: [camera=%d], [state=%s]",
+                           channelNo, recordStateStr[recordSession[channelNo].recordStatus]);
+                }
+                else
+                {
+                    recordWriterStatus[channelNo] = FALSE;
+                    if (TRUE == recordRestartWaitStatus[channelNo])
                     {
-                        EPRINT(RECORD_MANAGER, "fail to restart record session: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_RESTART_INIT]);
-                        recordSession[channelNo].recordStatus = RECORD_RESTART_CLEANUP;
+                        recordRestartWaitStatus[channelNo] = FALSE;
+                        recordSession[channelNo].recordStatus = RECORD_RESTART_INIT;
+                        setRecordWriterReady(channelNo);
                     }
-                    recordWriterStatus[channelNo] = FALSE;
-                    MUTEX_UNLOCK(frameWrCondMutex);
                 }
-                break;
+                MUTEX_UNLOCK(frameWrCondMutex);
+            }
+            break;
 
-                case RECORD_DRIVE_SWITCH:
+            case RECORD_RESTART_INIT:
+            {
+                MUTEX_LOCK(recordSession[channelNo].dataMutex);
+                recordType = recordSession[channelNo].recordType;
+                MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
+                DPRINT(RECORD_MANAGER, "record fsm: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_RESTART_INIT]);
+
+                if(StartRecordSession(channelNo) == SUCCESS)
                 {
-                    MUTEX_LOCK(recordSession[channelNo].dataMutex);
-                    recordType = recordSession[channelNo].recordType;
-                    MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
-                    DPRINT(RECORD_MANAGER, "record fsm: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_DRIVE_SWITCH]);
+                    recordSession[channelNo].recordFailReason = MAX_EVNT_REC_STOP;
+                    writeRecordingEvent(channelNo, recordType, REC_START, MAX_EVNT_REC_STOP);
+                    EventDetectFunc(channelNo, RECORDING_START, ACTIVE);
+                    CameraEventNotify(channelNo, RECORDING_FAIL, INACTIVE);
+                    recordSession[channelNo].recordStatus = RECORD_ON;
+                }
+                else
+                {
+                    EPRINT(RECORD_MANAGER, "fail to restart record session: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_RESTART_INIT]);
+                    recordSession[channelNo].recordStatus = RECORD_RESTART_CLEANUP;
+                }
+                recordWriterStatus[channelNo] = FALSE;
+                MUTEX_UNLOCK(frameWrCondMutex);
+            }
+            break;
 
-                    StopRecordSession(channelNo);
-                    if (StartRecordSession(channelNo) == FAIL)
-                    {
-                        EPRINT(RECORD_MANAGER, "fail to start record session: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_DRIVE_SWITCH]);
-                    }
+            case RECORD_DRIVE_SWITCH:
+            {
+                MUTEX_LOCK(recordSession[channelNo].dataMutex);
+                recordType = recordSession[channelNo].recordType;
+                MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
+                DPRINT(RECORD_MANAGER, "record fsm: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_DRIVE_SWITCH]);
 
-                    if(recordSession[channelNo].recordStatus == RECORD_DRIVE_SWITCH)
-                    {
-                        recordWriterStatus[channelNo] = FALSE;
-                        recordSession[channelNo].recordStatus = RECORD_ON;
-                    }
-                    MUTEX_UNLOCK(frameWrCondMutex);
+                StopRecordSession(channelNo);
+                if (StartRecordSession(channelNo) == FAIL)
+                {
+                    EPRINT(RECORD_MANAGER, "fail to start record session: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_DRIVE_SWITCH]);
                 }
-                break;
 
-                case RECORD_STREAM_SWITCH:
+                if(recordSession[channelNo].recordStatus == RECORD_DRIVE_SWITCH)
                 {
-                    MUTEX_LOCK(recordSession[channelNo].dataMutex);
-                    recordType = recordSession[channelNo].recordType;
-                    if(recordSession[channelNo].preAlrmRcrdStrm == FALSE)
-                    {
-                        readPos = CI_READ_LATEST_FRAME;
-                    }
-                    else
-                    {
-                        readPos = CI_READ_OLDEST_FRAME;
-                    }
-                    MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
+                    recordWriterStatus[channelNo] = FALSE;
+                    recordSession[channelNo].recordStatus = RECORD_ON;
+                }
+                MUTEX_UNLOCK(frameWrCondMutex);
+            }
+            break;
+
+            case RECORD_STREAM_SWITCH:
+            {
+                MUTEX_LOCK(recordSession[channelNo].dataMutex);
+                recordType = recordSession[channelNo].recordType;
+                if(recordSession[channelNo].preAlrmRcrdStrm == FALSE)
+                {
+                    readPos = CI_READ_LATEST_FRAME;
+                }
+                else
+                {
+                    readPos = CI_READ_OLDEST_FRAME;
+                }
+                MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
 
-                    /* Get previous camera index to stop previous stream type */
-                    tmpCamIdx = getPrevStreamRecordChannelNo(channelNo);
-                    DPRINT(RECORD_MANAGER, "record fsm: [camera=%d], [state=%s], [streamType=%d]",
-                           channelNo, recordStateStr[RECORD_STREAM_SWITCH], GET_STREAM_TYPE(tmpCamIdx));
-                    StopRecordSession(channelNo);
-                    StopStream(tmpCamIdx, CI_STREAM_CLIENT_RECORD);
+                /* Get previous camera index to stop previous stream type */
+                tmpCamIdx = getPrevStreamRecordChannelNo(channelNo);
+                DPRINT(RECORD_MANAGER, "record fsm: [camera=%d], [state=%s], [streamType=%d]",
+                       channelNo, recordStateStr[RECORD_STREAM_SWITCH], GET_STREAM_TYPE(tmpCamIdx));
+                StopRecordSession(channelNo);
+                StopStream(tmpCamIdx, CI_STREAM_CLIENT_RECORD);
 
-                    if(StartRecordSession(channelNo) == SUCCESS)
-                    {
-                        /* Get camera index to start with new stream type */
-                        tmpCamIdx = getRecordChannelNo(channelNo);
-                        DPRINT(RECORD_MANAGER, "record stream switch success: [camera=%d], [streamType=%d]", channelNo, GET_STREAM_TYPE(tmpCamIdx));
-                        InitStreamSession(tmpCamIdx, CI_STREAM_CLIENT_RECORD, readPos);
-                        recordSession[channelNo].recordStatus = RECORD_ON_WAIT;
+                if(StartRecordSession(channelNo) == SUCCESS)
+                {
+                    /* Get camera index to start with new stream type */
+                    tmpCamIdx = getRecordChannelNo(channelNo);
+                    DPRINT(RECORD_MANAGER, "record stream switch success: [camera=%d], [streamType=%d]", channelNo, GET_STREAM_TYPE(tmpCamIdx));
+                    InitStreamSession(tmpCamIdx, CI_STREAM_CLIENT_RECORD, readPos);
+                    recordSession[channelNo].recordStatus = RECORD_ON_WAIT;
 
-                        MUTEX_LOCK(recordSession[channelNo].dataMutex);
-                        recordSession[channelNo].streamType = GET_STREAM_TYPE(tmpCamIdx);
-                        MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
+                    MUTEX_LOCK(recordSession[channelNo].dataMutex);
+                    recordSession[channelNo].streamType = GET_STREAM_TYPE(tmpCamIdx);
+                    MUTEX_UNLOCK(recordSession[channelNo].dataMutex);
 
-                        recordWriterStatus[channelNo] = FALSE;
-                        // start Record stream from camera interface
-                        if (StartStream(tmpCamIdx, startStreamCallback, CI_STREAM_CLIENT_RECORD) != CMD_SUCCESS)
-                        {
-                            stopAllRecording = TRUE;
-                        }
-                    }
-                    else
+                    recordWriterStatus[channelNo] = FALSE;
+                    // start Record stream from camera interface
+                    if (StartStream(tmpCamIdx, startStreamCallback, CI_STREAM_CLIENT_RECORD) != CMD_SUCCESS)
                     {
-                        EPRINT(RECORD_MANAGER, "fail to start record session: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_STREAM_SWITCH]);
-                        recordWriterStatus[channelNo] = FALSE;
                         stopAllRecording = TRUE;
                     }
-
-                    if(stopAllRecording == TRUE)
-                    {
-                        stopAllRecording = FALSE;
-                        for(recType = MANUAL_RECORD; recType < MAX_RECORD; recType++)
-                        {
-                            stopInternalRecord(channelNo, recType, FALSE);
-                        }
-                    }
-                    MUTEX_UNLOCK(frameWrCondMutex);
                 }
-                break;
-
-                default:
+                else
                 {
-                    EPRINT(RECORD_MANAGER, "unhandle state: [camera=%d], [state=%d]", channelNo, recordSession[channelNo].recordStatus);
+                    EPRINT(RECORD_MANAGER, "fail to start record session: [camera=%d], [state=%s]", channelNo, recordStateStr[RECORD_STREAM_SWITCH]);
+                    recordWriterStatus[channelNo] = FALSE;
+                    stopAllRecording = TRUE;
                 }
-                /* FALLS THROUGH */
-                case RECORD_OFF:
+
+                if(stopAllRecording == TRUE)
                 {
-                    recordWriterStatus[channelNo] = FALSE;
-                    MUTEX_UNLOCK(frameWrCondMutex);
+                    stopAllRecording = FALSE;
+                    for(recType = MANUAL_RECORD; recType < MAX_RECORD; recType++)
+                    {
+                        stopInternalRecord(channelNo, recType, FALSE);
+                    }
                 }
-                break;
+                MUTEX_UNLOCK(frameWrCondMutex);
             }
+            break;
+
+            default:
+            {
+                EPRINT(RECORD_MANAGER, "unhandle state: [camera=%d], [state=%d]", channelNo, recordSession[channelNo].recordStatus);
+            }
+            /* FALLS THROUGH */
+            case RECORD_OFF:
+            {
+                recordWriterStatus[channelNo] = FALSE;
+                MUTEX_UNLOCK(frameWrCondMutex);
+            }
+            break;
         }
+
+        /* Channel still has pending work, give turn to other ready channels of shard first */
+        MUTEX_LOCK(frameWrCondMutex);
+        if (TRUE == recordWriterStatus[channelNo])
+        {
+            setRecordWriterReady(channelNo);
+        }
+        MUTEX_UNLOCK(frameWrCondMutex);
     }
 
-    for(channelNo = 0; channelNo < recordChannelMax; channelNo++)
+    for(channelNo = pShard->shardId; channelNo < recordChannelMax; channelNo += recWriterShardCnt)
     {
         MUTEX_LOCK(recordSession[channelNo].dataMutex);
         StopRecordSession(channelNo);
@@ -2302,6 +2303,58 @@ static VOIDPTR writeFrame(VOIDPTR threadArg)
     pthread_exit(NULL);
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Mark channel ready for frame writer and queue it on its writer shard if not queued already.
+ *          Caller must hold frameWrCondMutex.
+ * @param   channelNo
+ */
+static void setRecordWriterReady(UINT8 channelNo)
+{
+    REC_WRITER_SHARD_t *pShard = &recWriterShard[REC_WRITER_SHARD_ID(channelNo)];
+
+    recordWriterStatus[channelNo] = TRUE;
+    if (TRUE == recordWriterQueuedF[channelNo])
+    {
+        return;
+    }
+
+    /* Each channel is queued only once, hence queue never overflows */
+    pShard->readyChannel[(pShard->readIdx + pShard->readyCnt) % MAX_CAMERA] = channelNo;
+    pShard->readyCnt++;
+    recordWriterQueuedF[channelNo] = TRUE;
+    pthread_cond_signal(&pShard->condSignal);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Wait for any channel of writer shard to be ready and dequeue it. Caller must hold
+ *          frameWrCondMutex.
+ * @param   pShard - Writer shard info
+ * @param   pChannelNo - Ready channel
+ * @return  FALSE if record manager is terminated else TRUE
+ */
+static BOOL getNextReadyChannel(REC_WRITER_SHARD_t *pShard, UINT8PTR pChannelNo)
+{
+    /* PARASOFT: BD-TRS-DIFCS: Variable used in multiple critical sections */
+    while ((recTerminateFlg == FALSE) && (pShard->readyCnt == 0))
+    {
+        /* Recording is not running for any camera of shard */
+        pthread_cond_wait(&pShard->condSignal, &frameWrCondMutex);
+    }
+
+    if (recTerminateFlg == TRUE)
+    {
+        return FALSE;
+    }
+
+    *pChannelNo = pShard->readyChannel[pShard->readIdx];
+    pShard->readIdx = (pShard->readIdx + 1) % MAX_CAMERA;
+    pShard->readyCnt--;
+    recordWriterQueuedF[*pChannelNo] = FALSE;
+    return TRUE;
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   This is timer callback function. It will execute every second and wakeup the recordScheduler
@@ -2599,8 +2652,7 @@ void RMConfigNotify(CAMERA_CONFIG_t newCameraConfig, CAMERA_CONFIG_t *oldCameraC
     }
 
     recordSession[cameraIndex].recordStatus = RECORD_STREAM_SWITCH;
-    recordWriterStatus[cameraIndex] = TRUE;
-    pthread_cond_signal(&frameWrCondSignal);
+    setRecordWriterReady(cameraIndex);
     MUTEX_UNLOCK(frameWrCondMutex);
     DPRINT(RECORD_MANAGER, "record session state: [camera=%d], [state=%s]", cameraIndex, recordStateStr[RECORD_STREAM_SWITCH]);
 }
@@ -2643,11 +2695,8 @@ void RestartRecSession(UINT8 channelNo, UINT32 errorCode)
     /** set recording state to record switch to restart the recording session */
     recordSession[channelNo].recordStatus = RECORD_DRIVE_SWITCH;
 
-    /** set channel writer processing */
-    recordWriterStatus[channelNo] = TRUE;
-
-    /** give signal to record manager thread */
-    pthread_cond_signal(&frameWrCondSignal);
+    /** set channel writer processing and give signal to its writer thread */
+    setRecordWriterReady(channelNo);
 
     snprintf(eventDetail, MAX_EVENT_DETAIL_SIZE, "Camera %02d", GET_CAMERA_NO(channelNo));
     if (INVALID_ERROR_CODE == errorCode)
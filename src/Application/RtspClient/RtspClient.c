@@ -12,6 +12,7 @@
 /* Application Includes */
 #include "UtilCommon.h"
 #include "RtspClient.h"
+#include "RtspFrameRing.h"
 
 //#################################################################################################
 // @DEFINES
@@ -25,6 +26,17 @@
 static INT32 rtspClientMediaFd  = INVALID_CONNECTION;
 static UINT8 clientId           = RTSP_CLIENT_APPL_COUNT;
 
+/* Frame ring to deliver frames to RTSP client interface. Mutex protects ring re-initialization on
+ * re-registration against media thread, it is never contended while frames are flowing. */
+static RTSP_FRAME_RING_t    frameRing;
+static pthread_mutex_t      frameRingMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Shared memory buffer of media sessions in which Live555 sinks store the frames */
+static UINT8PTR             mediaShmBaseAddr[MEDIA_SESSION_PER_RTSP_APPL][MAX_STREAM_TYPE];
+
+/* Video frames are dropped till next I-frame when frame ring is full */
+static BOOL                 waitForIFrame[MEDIA_SESSION_PER_RTSP_APPL];
+
 //#################################################################################################
 // @PROTOTYPES
 //#################################################################################################
@@ -44,6 +56,11 @@ static void MediaFrameCb(MediaFrameResp_e mediaResp, RTSP_HANDLE mediaHandle,
 //-------------------------------------------------------------------------------------------------
 static BOOL RecvMsgResp(INT32 connFd, RtspClientMsgId_e msgId, UINT8 camIndex, void *pData, UINT32 dataLenMax);
 //-------------------------------------------------------------------------------------------------
+static UINT8PTR getMediaFrameData(MediaFrameResp_e mediaResp, RTSP_HANDLE mediaHandle, MEDIA_FRAME_INFO_t *frameInfo,
+                                  UINT32 headSize, UINT32 offset);
+//-------------------------------------------------------------------------------------------------
+static void sendFrameRingDoorbell(void);
+//-------------------------------------------------------------------------------------------------
 //#################################################################################################
 // @FUNCTIONS
 //#################################################################################################
@@ -83,6 +100,8 @@ int main (int argc, char **argv)
 
     DPRINT(RTSP_CLIENT, "rtsp client started: [client=%d]", clientId);
 
+    RtspFrameRingInit(&frameRing);
+
     InitRtspClient();
 
     if (FALSE == CreateServerSocket(&serverFd))
@@ -146,6 +165,7 @@ int main (int argc, char **argv)
     }
 
     CloseSocket(&rtspClientMediaFd);
+    RtspFrameRingClose(clientId, &frameRing);
     return 0;
 }
 
@@ -255,7 +275,14 @@ BOOL CreateSharedMemory(RTSP_HANDLE mediaHandle, INT32PTR shmFd, UINT8PTR *shmBa
     }
 
     /* open shared memory in read/write mode */
-    return Utils_OpenSharedMemory(name, memorySize, shmFd, shmBaseAddr, FALSE);
+    if (FALSE == Utils_OpenSharedMemory(name, memorySize, shmFd, shmBaseAddr, FALSE))
+    {
+        return FALSE;
+    }
+
+    /* Frames are copied from this buffer to frame ring */
+    mediaShmBaseAddr[mediaHandle][streamType] = *shmBaseAddr;
+    return TRUE;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -289,6 +316,7 @@ BOOL DestroySharedMemory(RTSP_HANDLE mediaHandle, INT32PTR shmFd, UINT8PTR *shmB
     }
 
     /* open shared memory in read/write mode */
+    mediaShmBaseAddr[mediaHandle][streamType] = NULL;
     Utils_DestroySharedMemory(name, memorySize, shmFd, shmBaseAddr);
 
     *shmBaseAddr = NULL;
@@ -353,8 +381,18 @@ static void ProcessRegisterMsg(INT32 connFd, RtspClientMsgInfo_t *pRtspClientMsg
     CloseSocket(&rtspClientMediaFd);
     rtspClientMediaFd = connFd;
 
+    /* Frame ring is re-initialized on every registration, interface opens it after response */
+    MUTEX_LOCK(frameRingMutex);
+    pRtspClientMsg->header.status = RtspFrameRingOpen(clientId, TRUE, &frameRing) ? CMD_SUCCESS : CMD_PROCESS_ERROR;
+    memset(waitForIFrame, FALSE, sizeof(waitForIFrame));
+    MUTEX_UNLOCK(frameRingMutex);
+
+    if (pRtspClientMsg->header.status != CMD_SUCCESS)
+    {
+        EPRINT(RTSP_CLIENT, "fail to create frame ring: [client=%d]", clientId);
+    }
+
     pRtspClientMsg->header.msgType = MSG_TYPE_RESPONSE;
-    pRtspClientMsg->header.status = CMD_SUCCESS;
     dataLen = sizeof(RtspClientHeader_t);
 
     if (SUCCESS != SendToSocket(connFd, (UINT8PTR)pRtspClientMsg, dataLen, UNIX_SOCK_TIMEOUT_IN_SEC))
@@ -439,7 +477,9 @@ static void ProcessStopStreamMsg(INT32 connFd, RtspClientMsgInfo_t *pRtspClientM
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   MediaFrameCb
+ * @brief   MediaFrameCb: Frame is copied in frame ring and interface is notified only if it is waiting
+ *          for frames. It never waits for interface, if ring is full then frame is dropped and video
+ *          of that session is resumed from next I-frame.
  * @param   mediaResp
  * @param   mediaHandle
  * @param   frameInfo
@@ -451,8 +491,10 @@ static void ProcessStopStreamMsg(INT32 connFd, RtspClientMsgInfo_t *pRtspClientM
 static void MediaFrameCb(MediaFrameResp_e mediaResp, RTSP_HANDLE mediaHandle, MEDIA_FRAME_INFO_t *frameInfo,
                          UINT8 camIndex, UINT32 headSize, UINT32 offset)
 {
-    UINT32              dataLen;
-    RtspClientMsgInfo_t rtspClientMsg;
+    BOOL                    isVideoFrame = FALSE;
+    UINT8PTR                pFrameData = NULL;
+    UINT32                  reserveLen = 0;
+    RTSP_FRAME_RING_ENTRY_t ringEntry;
 
     if (rtspClientMediaFd == INVALID_CONNECTION)
     {
@@ -461,30 +503,133 @@ static void MediaFrameCb(MediaFrameResp_e mediaResp, RTSP_HANDLE mediaHandle, ME
         return;
     }
 
-    rtspClientMsg.header.msgId = RTSP_CLIENT_MSG_ID_MEDIA_FRAME;
-    rtspClientMsg.header.msgType = MSG_TYPE_REQUEST;
-    rtspClientMsg.header.status = CMD_SUCCESS;
-    rtspClientMsg.payload.mediaFrameInfo.response = mediaResp;
-    rtspClientMsg.payload.mediaFrameInfo.camIndex = camIndex;
-    rtspClientMsg.payload.mediaFrameInfo.mediaHandle = mediaHandle;
-    rtspClientMsg.payload.mediaFrameInfo.headSize = headSize;
-    rtspClientMsg.payload.mediaFrameInfo.offset = offset;
+    if (mediaHandle >= MEDIA_SESSION_PER_RTSP_APPL)
+    {
+        EPRINT(RTSP_CLIENT, "invld media handle: [client=%d], [camera=%d], [handle=%d]", clientId, camIndex, mediaHandle);
+        return;
+    }
 
-    dataLen = sizeof(RtspClientHeader_t) + sizeof(rtspClientMsg.payload.mediaFrameInfo);
+    memset(&ringEntry, 0, sizeof(ringEntry));
+    ringEntry.response = mediaResp;
+    ringEntry.camIndex = camIndex;
+    ringEntry.mediaHandle = mediaHandle;
 
-    if (SUCCESS != SendToSocket(rtspClientMediaFd, (UINT8PTR)&rtspClientMsg, dataLen, UNIX_SOCK_TIMEOUT_IN_SEC))
+    if ((mediaResp >= RTSP_RESP_CODE_CONFIG_VIDEO_DATA) && (mediaResp <= RTSP_RESP_CODE_AUDIO_DATA))
     {
-        EPRINT(RTSP_CLIENT, "fail to send media frame request: [client=%d], [camera=%d]", clientId, camIndex);
-        return;
+        if (frameInfo == NULL)
+        {
+            return;
+        }
+
+        pFrameData = getMediaFrameData(mediaResp, mediaHandle, frameInfo, headSize, offset);
+        if (pFrameData == NULL)
+        {
+            EPRINT(RTSP_CLIENT, "invld media frame: [client=%d], [camera=%d], [resp=%d], [len=%d]", clientId, camIndex, mediaResp, frameInfo->len);
+            return;
+        }
+
+        isVideoFrame = ((mediaResp == RTSP_RESP_CODE_CONFIG_VIDEO_DATA) || (mediaResp == RTSP_RESP_CODE_VIDEO_DATA)) ? TRUE : FALSE;
+        if ((TRUE == isVideoFrame) && (TRUE == waitForIFrame[mediaHandle]))
+        {
+            if ((mediaResp == RTSP_RESP_CODE_VIDEO_DATA) && (frameInfo->videoInfo.frameType != I_FRAME))
+            {
+                return;
+            }
+
+            DPRINT(RTSP_CLIENT, "video resumed on frame ring: [client=%d], [camera=%d]", clientId, camIndex);
+            waitForIFrame[mediaHandle] = FALSE;
+        }
+
+        ringEntry.dataLen = frameInfo->len;
+        ringEntry.frameInfo = *frameInfo;
+
+        /* Keep space for control responses */
+        reserveLen = RTSP_FRAME_RING_CTRL_RESERVE;
     }
 
-    /* Receive required message response */
-    if (SUCCESS != RecvMsgResp(rtspClientMediaFd, RTSP_CLIENT_MSG_ID_MEDIA_FRAME, camIndex, &rtspClientMsg, sizeof(RtspClientMsgInfo_t)))
+    MUTEX_LOCK(frameRingMutex);
+    if (FAIL == RtspFrameRingPush(&frameRing, &ringEntry, pFrameData, reserveLen))
     {
-        EPRINT(RTSP_CLIENT, "negative media frame resp: [client=%d], [camera=%d], [status=%d]",
-               clientId, camIndex, rtspClientMsg.header.status);
+        MUTEX_UNLOCK(frameRingMutex);
+        if ((TRUE == isVideoFrame) && (FALSE == waitForIFrame[mediaHandle]))
+        {
+            WPRINT(RTSP_CLIENT, "frame ring full, video dropped till next I-frame: [client=%d], [camera=%d]", clientId, camIndex);
+            waitForIFrame[mediaHandle] = TRUE;
+        }
+        else if (FALSE == isVideoFrame)
+        {
+            EPRINT(RTSP_CLIENT, "fail to push media frame in ring: [client=%d], [camera=%d], [resp=%d]", clientId, camIndex, mediaResp);
+        }
         return;
     }
+
+    if (TRUE == RtspFrameRingIsNotifyRequired(&frameRing))
+    {
+        sendFrameRingDoorbell();
+    }
+    MUTEX_UNLOCK(frameRingMutex);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Get frame data from shared memory buffer of media session where Live555 sink stored it
+ * @param   mediaResp
+ * @param   mediaHandle
+ * @param   frameInfo
+ * @param   headSize
+ * @param   offset
+ * @return  Frame data pointer or NULL if frame is not within buffer
+ */
+static UINT8PTR getMediaFrameData(MediaFrameResp_e mediaResp, RTSP_HANDLE mediaHandle, MEDIA_FRAME_INFO_t *frameInfo,
+                                  UINT32 headSize, UINT32 offset)
+{
+    UINT8PTR    pShmBase;
+    UINT32      bufSize;
+
+    if ((mediaResp == RTSP_RESP_CODE_CONFIG_VIDEO_DATA) || (mediaResp == RTSP_RESP_CODE_VIDEO_DATA))
+    {
+        pShmBase = mediaShmBaseAddr[mediaHandle][STREAM_TYPE_VIDEO];
+        bufSize = VIDEO_BUF_SIZE_MEDIA;
+
+        /* Config header is kept before frame and it is part of I-frame only */
+        if (frameInfo->videoInfo.frameType != I_FRAME)
+        {
+            offset += headSize;
+        }
+    }
+    else
+    {
+        pShmBase = mediaShmBaseAddr[mediaHandle][STREAM_TYPE_AUDIO];
+        bufSize = AUDIO_BUF_SIZE_MEDIA;
+        offset += headSize;
+    }
+
+    if ((pShmBase == NULL) || (offset > bufSize) || (frameInfo->len > (bufSize - offset)))
+    {
+        return NULL;
+    }
+
+    return (pShmBase + sizeof(MEDIA_FRAME_INFO_t) + offset);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Notify waiting interface about new entries in frame ring. Header only media frame message
+ *          is used as doorbell and it is not responded by interface.
+ */
+static void sendFrameRingDoorbell(void)
+{
+    RtspClientHeader_t doorbellMsg;
+
+    doorbellMsg.msgId = RTSP_CLIENT_MSG_ID_MEDIA_FRAME;
+    doorbellMsg.msgType = MSG_TYPE_REQUEST;
+    doorbellMsg.status = CMD_SUCCESS;
+
+    /* Doorbell must not block media thread, interface will find the entries on next timeout anyway */
+    if (send(rtspClientMediaFd, &doorbellMsg, sizeof(doorbellMsg), MSG_DONTWAIT | MSG_NOSIGNAL) != (ssize_t)sizeof(doorbellMsg))
+    {
+        EPRINT(RTSP_CLIENT, "fail to send frame ring doorbell: [client=%d], [err=%s]", clientId, strerror(errno));
+    }
 }
 
 //-------------------------------------------------------------------------------------------------
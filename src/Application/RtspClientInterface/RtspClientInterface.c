@@ -12,6 +12,7 @@
 // @INCLUDES
 //#################################################################################################
 #include "RtspClientInterface.h"
+#include "RtspFrameRing.h"
 
 //#################################################################################################
 // @DEFINES
@@ -22,26 +23,17 @@
 /* Stack size for media process thread */
 #define MEDIA_PRO_THRD_STACK_SIZE   (1 * MEGA_BYTE)
 
-/* Maximum file name of size of shared memory */
-#define SHM_MEM_FILE_NAME_MAX       20
-
 //#################################################################################################
 // @STRUCT
 //#################################################################################################
 typedef struct
 {
-    INT32       shmFd;
-    UINT8PTR    shmBaseAddr;
-}SharedMemInfo_t;
-
-typedef struct
-{
-    UINT8           clientId;
-    BOOL            runFlag;
-    INT32           connFd;
-    pthread_t       threadId;
-    RTSP_CALLBACK   rtspCb;
-    SharedMemInfo_t shmInfo[MEDIA_SESSION_PER_RTSP_APPL][MAX_STREAM_TYPE];
+    UINT8               clientId;
+    BOOL                runFlag;
+    INT32               connFd;
+    pthread_t           threadId;
+    RTSP_CALLBACK       rtspCb;
+    RTSP_FRAME_RING_t   frameRing;
 }RtspClientInfo_t;
 
 //#################################################################################################
@@ -66,7 +58,9 @@ static void stopRtspClientAppl(UINT8 clientId);
 //-------------------------------------------------------------------------------------------------
 static void restartRtspClientConnection(RtspClientInfo_t *pRtspClientInfo);
 //-------------------------------------------------------------------------------------------------
-static void ProcessMediaFrameMsg(RtspClientInfo_t *pRtspClientInfo, RtspClientMsgInfo_t *pRtspClientMsg);
+static void processFrameRing(RtspClientInfo_t *pRtspClientInfo);
+//-------------------------------------------------------------------------------------------------
+static void processFrameRingEntry(RtspClientInfo_t *pRtspClientInfo, RTSP_FRAME_RING_ENTRY_t *pEntry);
 //-------------------------------------------------------------------------------------------------
 static void ProcessAllocRtpPortMsg(RtspClientInfo_t *pRtspClientInfo, RtspClientMsgInfo_t *pRtspClientMsg);
 //-------------------------------------------------------------------------------------------------
@@ -76,10 +70,6 @@ static BOOL connectToRtspClient(UINT8 clientId, INT32PTR connFd);
 //-------------------------------------------------------------------------------------------------
 static BOOL RegisterToRtspClient(RtspClientInfo_t *pRtspClientInfo);
 //-------------------------------------------------------------------------------------------------
-static BOOL createSharedMemory(RTSP_HANDLE mediaHandle, STREAM_TYPE_e streamType, RtspClientInfo_t *pRtspClientInfo);
-//-------------------------------------------------------------------------------------------------
-static BOOL destroySharedMemory(RTSP_HANDLE mediaHandle, STREAM_TYPE_e streamType, RtspClientInfo_t *pRtspClientInfo);
-//-------------------------------------------------------------------------------------------------
 
 //#################################################################################################
 // @FUNCTION DEFINATIONS
@@ -379,9 +369,26 @@ static void *mediaProcessThread(void *threadInfo)
             continue;
         }
 
+        /* Frame ring is created by RTSP client on registration */
+        if (FAIL == RtspFrameRingOpen(pRtspClientInfo->clientId, FALSE, &pRtspClientInfo->frameRing))
+        {
+            EPRINT(RTSP_IFACE, "fail to open frame ring of rtsp client: [client=%d]", pRtspClientInfo->clientId);
+            CloseSocket(&pRtspClientInfo->connFd);
+            sleep(1);
+            continue;
+        }
+
         while (pRtspClientInfo->runFlag)
         {
+            /* Process all available frames and wait for doorbell or message only when ring is empty */
+            processFrameRing(pRtspClientInfo);
+            if (FALSE == RtspFrameRingPrepareWait(&pRtspClientInfo->frameRing))
+            {
+                continue;
+            }
+
             retVal = RecvUnixSockSeqPkt(pRtspClientInfo->connFd, &rtspClientMsg, sizeof(RtspClientMsgInfo_t), UNIX_SOCK_TIMEOUT_IN_SEC, &dataLen);
+            RtspFrameRingWaitDone(&pRtspClientInfo->frameRing);
             if (retVal == FAIL)
             {
                 // receive message timeout
@@ -399,7 +406,7 @@ static void *mediaProcessThread(void *threadInfo)
             {
                 case RTSP_CLIENT_MSG_ID_MEDIA_FRAME:
                 {
-                    ProcessMediaFrameMsg(pRtspClientInfo, &rtspClientMsg);
+                    /* Doorbell of frame ring, frames are processed at start of loop */
                 }
                 break;
 
@@ -442,21 +449,9 @@ static void *mediaProcessThread(void *threadInfo)
  */
 static void initRtspClientInfo(RtspClientInfo_t *pRtspClientInfo)
 {
-    RTSP_HANDLE mediaHandle;
-
     pRtspClientInfo->connFd = INVALID_CONNECTION;
     pRtspClientInfo->rtspCb = NULL;
-
-    for (mediaHandle = 0; mediaHandle < MEDIA_SESSION_PER_RTSP_APPL; mediaHandle++)
-    {
-        /* shared memory for video stream */
-        pRtspClientInfo->shmInfo[mediaHandle][STREAM_TYPE_VIDEO].shmBaseAddr = NULL;
-        pRtspClientInfo->shmInfo[mediaHandle][STREAM_TYPE_VIDEO].shmFd = INVALID_CONNECTION;
-
-        /* shared memory for audio stream */
-        pRtspClientInfo->shmInfo[mediaHandle][STREAM_TYPE_AUDIO].shmBaseAddr = NULL;
-        pRtspClientInfo->shmInfo[mediaHandle][STREAM_TYPE_AUDIO].shmFd = INVALID_CONNECTION;
-    }
+    RtspFrameRingInit(&pRtspClientInfo->frameRing);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -472,19 +467,11 @@ static void deinitRtspClientInfo(RtspClientInfo_t *pRtspClientInfo)
     /* close UNIX socket for client */
     CloseSocket(&pRtspClientInfo->connFd);
 
-    /* Unlink shared memory */
+    /* Unlink frame ring shared memory */
+    RtspFrameRingClose(pRtspClientInfo->clientId, &pRtspClientInfo->frameRing);
+
     for (mediaHandle = 0; mediaHandle < MEDIA_SESSION_PER_RTSP_APPL; mediaHandle++)
     {
-        if (pRtspClientInfo->shmInfo[mediaHandle][STREAM_TYPE_VIDEO].shmBaseAddr != NULL)
-        {
-            destroySharedMemory(mediaHandle, STREAM_TYPE_VIDEO, pRtspClientInfo);
-        }
-
-        if (pRtspClientInfo->shmInfo[mediaHandle][STREAM_TYPE_AUDIO].shmBaseAddr != NULL)
-        {
-            destroySharedMemory(mediaHandle, STREAM_TYPE_AUDIO, pRtspClientInfo);
-        }
-
         /* give rtsp callback to camera interface */
         if (pRtspClientInfo->rtspCb != NULL)
         {
@@ -551,80 +538,6 @@ static void restartRtspClientConnection(RtspClientInfo_t *pRtspClientInfo)
     startRtspClientAppl(pRtspClientInfo->clientId);
 }
 
-//-------------------------------------------------------------------------------------------------
-/**
- * @brief createSharedMemory
- * @param mediaIndex
- * @param streamType
- * @param pRtspClientInfo
- * @return
- */
-static BOOL createSharedMemory(RTSP_HANDLE mediaHandle, STREAM_TYPE_e streamType, RtspClientInfo_t *pRtspClientInfo)
-{
-    UINT8   shmMemId;
-    CHAR    shmName[NAME_MAX];
-    size_t  memorySize;
-
-    /* Get shared memory index for client */
-    shmMemId = pRtspClientInfo->clientId + (mediaHandle * RTSP_CLIENT_APPL_COUNT);
-
-    /* set memory size according to stream type */
-    if (STREAM_TYPE_VIDEO == streamType)
-    {
-        snprintf(shmName, sizeof(shmName), SHM_NAME_VIDEO"_%d", shmMemId);
-        memorySize = VIDEO_BUF_SIZE;
-    }
-    else
-    {
-        snprintf(shmName, sizeof(shmName), SHM_NAME_AUDIO"_%d", shmMemId);
-        memorySize = AUDIO_BUF_SIZE;
-    }
-
-    /* open shared memory */
-    return Utils_OpenSharedMemory(shmName, memorySize, &pRtspClientInfo->shmInfo[mediaHandle][streamType].shmFd,
-                                  &pRtspClientInfo->shmInfo[mediaHandle][streamType].shmBaseAddr, TRUE);
-}
-
-//-------------------------------------------------------------------------------------------------
-/**
- * @brief destroySharedMemory
- * @param mediaIndex
- * @param streamType
- * @param pRtspClientInfo
- * @return
- */
-static BOOL destroySharedMemory(RTSP_HANDLE mediaHandle, STREAM_TYPE_e streamType, RtspClientInfo_t *pRtspClientInfo)
-{
-    UINT8   shmMemId;
-    CHAR    shmName[NAME_MAX];
-    size_t  memorySize;
-
-    /* Get shared memory index for client */
-    shmMemId = pRtspClientInfo->clientId + (mediaHandle * RTSP_CLIENT_APPL_COUNT);
-
-    /* set memory size according to stream type */
-    if (STREAM_TYPE_VIDEO == streamType)
-    {
-        snprintf(shmName, sizeof(shmName), SHM_NAME_VIDEO"_%d", shmMemId);
-        memorySize = VIDEO_BUF_SIZE;
-    }
-    else
-    {
-        snprintf(shmName, sizeof(shmName), SHM_NAME_AUDIO"_%d", shmMemId);
-        memorySize = AUDIO_BUF_SIZE;
-    }
-
-    /* open shared memory */
-    Utils_DestroySharedMemory(shmName, memorySize, &pRtspClientInfo->shmInfo[mediaHandle][streamType].shmFd,
-                              &pRtspClientInfo->shmInfo[mediaHandle][streamType].shmBaseAddr);
-
-    /* reset shared memory fd & address */
-    pRtspClientInfo->shmInfo[mediaHandle][streamType].shmBaseAddr = NULL;
-    pRtspClientInfo->shmInfo[mediaHandle][streamType].shmFd = INVALID_CONNECTION;
-
-    return TRUE;
-}
-
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief connectToRtspClient
@@ -706,95 +619,64 @@ static BOOL RegisterToRtspClient(RtspClientInfo_t *pRtspClientInfo)
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief ProcessMediaFrameMsg
- * @param msgPtr
- * @param threadDesc
+ * @brief Process all available entries of frame ring. Entries are processed in place and released
+ *        after callback, hence frame data is not copied between RTSP client and camera interface.
+ * @param pRtspClientInfo
  */
-static void ProcessMediaFrameMsg(RtspClientInfo_t *pRtspClientInfo, RtspClientMsgInfo_t *pRtspClientMsg)
+static void processFrameRing(RtspClientInfo_t *pRtspClientInfo)
 {
-    UINT32              dataLen;
-    UINT32              offset;
-    MEDIA_FRAME_INFO_t  *pMediaFrameInfo;
-    UINT8               camIndex = pRtspClientMsg->payload.mediaFrameInfo.camIndex;
-    RTSP_HANDLE         mediaHandle = pRtspClientMsg->payload.mediaFrameInfo.mediaHandle;
+    RTSP_FRAME_RING_ENTRY_t *pEntry;
 
-    pRtspClientMsg->header.msgType = MSG_TYPE_RESPONSE;
-    pRtspClientMsg->header.status = CMD_PROCESS_ERROR;
-    dataLen = sizeof(RtspClientHeader_t);
+    while ((pEntry = RtspFrameRingPeek(&pRtspClientInfo->frameRing)) != NULL)
+    {
+        processFrameRingEntry(pRtspClientInfo, pEntry);
+        RtspFrameRingRelease(&pRtspClientInfo->frameRing, pEntry);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief processFrameRingEntry
+ * @param pRtspClientInfo
+ * @param pEntry
+ */
+static void processFrameRingEntry(RtspClientInfo_t *pRtspClientInfo, RTSP_FRAME_RING_ENTRY_t *pEntry)
+{
+    UINT8PTR pFrameData = ((UINT8PTR)pEntry + sizeof(RTSP_FRAME_RING_ENTRY_t));
 
     /* validate media handle */
-    if (mediaHandle >= MEDIA_SESSION_PER_RTSP_APPL)
+    if (pEntry->mediaHandle >= MEDIA_SESSION_PER_RTSP_APPL)
     {
-        EPRINT(RTSP_IFACE, "invalid media handle: [client=%d], [camera=%d], [handle=%d]", pRtspClientInfo->clientId, camIndex, mediaHandle);
+        EPRINT(RTSP_IFACE, "invalid media handle: [client=%d], [camera=%d], [handle=%d]", pRtspClientInfo->clientId, pEntry->camIndex, pEntry->mediaHandle);
         return;
     }
 
-    switch (pRtspClientMsg->payload.mediaFrameInfo.response)
+    if (pRtspClientInfo->rtspCb == NULL)
     {
-        case RTSP_RESP_CODE_CONFIG_VIDEO_DATA:
-        {
-            if (createSharedMemory(mediaHandle, STREAM_TYPE_VIDEO, pRtspClientInfo) == FAIL)
-            {
-                EPRINT(RTSP_IFACE, "creating video shared memory failed: [client=%d], [camera=%d]", pRtspClientInfo->clientId, camIndex);
-                break;
-            }
-        }
+        return;
+    }
 
-        /* FALL THROUGH */
+    switch (pEntry->response)
+    {
+        case RTSP_RESP_CODE_CONFIG_VIDEO_DATA:
         case RTSP_RESP_CODE_VIDEO_DATA:
         {
-            /* check if shared memory is available or not */
-            pMediaFrameInfo = (MEDIA_FRAME_INFO_t *)pRtspClientInfo->shmInfo[mediaHandle][STREAM_TYPE_VIDEO].shmBaseAddr;
-            if (pMediaFrameInfo == NULL)
-            {
-                break;
-            }
-
             /* Only pass other than I-Frame and P-Frame to camera interface */
-            if ((pMediaFrameInfo->videoInfo.frameType != I_FRAME) && (pMediaFrameInfo->videoInfo.frameType != P_FRAME))
+            if ((pEntry->frameInfo.videoInfo.frameType != I_FRAME) && (pEntry->frameInfo.videoInfo.frameType != P_FRAME))
             {
                 WPRINT(RTSP_IFACE, "invld frame type received: [client=%d], [camera=%d], [frameType=%d], [codecType=%d]",
-                       pRtspClientInfo->clientId, camIndex, pMediaFrameInfo->videoInfo.frameType, pMediaFrameInfo->codecType);
-                pRtspClientMsg->header.status = CMD_SUCCESS;
+                       pRtspClientInfo->clientId, pEntry->camIndex, pEntry->frameInfo.videoInfo.frameType, pEntry->frameInfo.codecType);
                 break;
             }
 
-            offset = sizeof(MEDIA_FRAME_INFO_t) + pRtspClientMsg->payload.mediaFrameInfo.offset;
-            if (pMediaFrameInfo->videoInfo.frameType != I_FRAME)
-            {
-                /* If frame type is I-frame then include header also [FRAME_INFO|SPS|PPS|FRAME] otherwise exclude it */
-                offset += pRtspClientMsg->payload.mediaFrameInfo.headSize;
-            }
-
-            pRtspClientInfo->rtspCb(pRtspClientMsg->payload.mediaFrameInfo.response, ((UINT8PTR)pMediaFrameInfo + offset),
-                                    pMediaFrameInfo, camIndex);
-            pRtspClientMsg->header.status = CMD_SUCCESS;
+            pRtspClientInfo->rtspCb(pEntry->response, pFrameData, &pEntry->frameInfo, pEntry->camIndex);
         }
         break;
 
         case RTSP_RESP_CODE_CONFIG_AUDIO_DATA:
-        {
-            if (createSharedMemory(mediaHandle, STREAM_TYPE_AUDIO, pRtspClientInfo) == FAIL)
-            {
-                EPRINT(RTSP_IFACE, "creating audio shared memory failed: [client=%d], [camera=%d]", pRtspClientInfo->clientId, camIndex);
-                break;
-            }
-        }
-
-        /*fall through*/
         case RTSP_RESP_CODE_AUDIO_DATA:
         {
-            /*check if shared memory is available or not*/
-            pMediaFrameInfo = (MEDIA_FRAME_INFO_t *)pRtspClientInfo->shmInfo[mediaHandle][STREAM_TYPE_AUDIO].shmBaseAddr;
-            if (pMediaFrameInfo == NULL)
-            {
-                break;
-            }
-
-            pRtspClientInfo->rtspCb(pRtspClientMsg->payload.mediaFrameInfo.response, ((UINT8PTR)pMediaFrameInfo + sizeof(MEDIA_FRAME_INFO_t) +
-                                    pRtspClientMsg->payload.mediaFrameInfo.headSize + pRtspClientMsg->payload.mediaFrameInfo.offset),
-                                    pMediaFrameInfo, camIndex);
-            pRtspClientMsg->header.status = CMD_SUCCESS;
+            pRtspClientInfo->rtspCb(pEntry->response, pFrameData, &pEntry->frameInfo, pEntry->camIndex);
         }
         break;
 
@@ -802,18 +684,7 @@ static void ProcessMediaFrameMsg(RtspClientInfo_t *pRtspClientInfo, RtspClientMs
         case RTSP_RESP_CODE_CONN_CLOSE:
         case RTSP_RESP_CODE_FRAME_TIMEOUT:
         {
-            pRtspClientInfo->rtspCb(pRtspClientMsg->payload.mediaFrameInfo.response, NULL, NULL, camIndex);
-
-            if (pRtspClientInfo->shmInfo[mediaHandle][STREAM_TYPE_VIDEO].shmBaseAddr != NULL)
-            {
-                destroySharedMemory(mediaHandle, STREAM_TYPE_VIDEO, pRtspClientInfo);
-            }
-
-            if (pRtspClientInfo->shmInfo[mediaHandle][STREAM_TYPE_AUDIO].shmBaseAddr != NULL)
-            {
-                destroySharedMemory(mediaHandle, STREAM_TYPE_AUDIO, pRtspClientInfo);
-            }
-            pRtspClientMsg->header.status = CMD_SUCCESS;
+            pRtspClientInfo->rtspCb(pEntry->response, NULL, NULL, pEntry->camIndex);
         }
         break;
 
@@ -822,15 +693,7 @@ static void ProcessMediaFrameMsg(RtspClientInfo_t *pRtspClientInfo, RtspClientMs
             /* Nothing to do */
         }
         break;
-
     }
-
-    if (SUCCESS != SendToSocket(pRtspClientInfo->connFd, (UINT8PTR)pRtspClientMsg, dataLen, UNIX_SOCK_TIMEOUT_IN_SEC))
-    {
-        EPRINT(RTSP_IFACE, "fail to send media frame resp: [client=%d], [camera=%d]", pRtspClientInfo->clientId, camIndex);
-    }
-
-    return;
 }
 
 //-------------------------------------------------------------------------------------------------
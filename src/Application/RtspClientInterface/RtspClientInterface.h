@@ -123,15 +123,6 @@ typedef struct
     RtspStreamInfo_t    rtspStreamInfo;
 }StartStreamInfo_t;
 
-typedef struct
-{
-    MediaFrameResp_e    response;
-    UINT8               camIndex;
-    RTSP_HANDLE         mediaHandle;
-    UINT32              headSize;
-    UINT32              offset;
-}MediaFrameInfo_t;
-
 typedef struct
 {
     RtspClientMsgId_e   msgId;
@@ -144,7 +135,6 @@ typedef union
     RTSP_HANDLE         mediaHandle;
     UINT16              rtpPort;
     StartStreamInfo_t   startStreamInfo;
-    MediaFrameInfo_t    mediaFrameInfo;
 }RtspClientPayload_u;
 
 typedef struct
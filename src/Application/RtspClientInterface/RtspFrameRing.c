@@ -0,0 +1,278 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file		RtspFrameRing.c
+@brief      Single producer single consumer frame ring in shared memory between RTSP client
+            application (producer) and RTSP client interface of NVR application (consumer). Producer
+            copies completed frame in ring and publishes write index. Consumer processes frames in
+            place and publishes read index after processing. No locks are used, only producer updates
+            write index and only consumer updates read index.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Application Includes */
+#include "RtspFrameRing.h"
+
+//#################################################################################################
+// @DEFINES
+//#################################################################################################
+/* Entry length marker to indicate that remaining space till end of ring is unused */
+#define RTSP_FRAME_RING_WRAP_MARKER     (0)
+
+/* All entries are kept aligned to 8 bytes */
+#define RTSP_FRAME_RING_ALIGN(len)      (((len) + 7) & ~((UINT32)7))
+
+/* Total shared memory size of frame ring */
+#define RTSP_FRAME_RING_SHM_SIZE        (sizeof(RTSP_FRAME_RING_HDR_t) + RTSP_FRAME_RING_DATA_SIZE)
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Initialize frame ring information
+ * @param   pRing
+ */
+void RtspFrameRingInit(RTSP_FRAME_RING_t *pRing)
+{
+    pRing->shmFd = INVALID_FILE_FD;
+    pRing->shmBaseAddr = NULL;
+    pRing->pHdr = NULL;
+    pRing->pData = NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Open frame ring shared memory of RTSP client. Producer resets the ring on open, hence it
+ *          must be opened by producer before consumer.
+ * @param   clientId
+ * @param   isProducer
+ * @param   pRing
+ * @return  SUCCESS/FAIL
+ */
+BOOL RtspFrameRingOpen(UINT8 clientId, BOOL isProducer, RTSP_FRAME_RING_t *pRing)
+{
+    CHAR shmName[NAME_MAX];
+
+    /* Close previous ring if it is opened */
+    RtspFrameRingClose(clientId, pRing);
+
+    snprintf(shmName, sizeof(shmName), SHM_NAME_FRAME_RING"_%d", clientId);
+    if (FALSE == Utils_OpenSharedMemory(shmName, RTSP_FRAME_RING_SHM_SIZE, &pRing->shmFd, &pRing->shmBaseAddr, FALSE))
+    {
+        RtspFrameRingInit(pRing);
+        return FAIL;
+    }
+
+    pRing->pHdr = (RTSP_FRAME_RING_HDR_t *)pRing->shmBaseAddr;
+    pRing->pData = pRing->shmBaseAddr + sizeof(RTSP_FRAME_RING_HDR_t);
+
+    if (TRUE == isProducer)
+    {
+        memset(pRing->pHdr, 0, sizeof(RTSP_FRAME_RING_HDR_t));
+        pRing->pHdr->ringSize = RTSP_FRAME_RING_DATA_SIZE;
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    }
+    else if (pRing->pHdr->ringSize != RTSP_FRAME_RING_DATA_SIZE)
+    {
+        /* Producer has not initialized the ring */
+        RtspFrameRingClose(clientId, pRing);
+        return FAIL;
+    }
+
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Close frame ring shared memory
+ * @param   clientId
+ * @param   pRing
+ */
+void RtspFrameRingClose(UINT8 clientId, RTSP_FRAME_RING_t *pRing)
+{
+    CHAR shmName[NAME_MAX];
+
+    if (pRing->shmBaseAddr == NULL)
+    {
+        return;
+    }
+
+    snprintf(shmName, sizeof(shmName), SHM_NAME_FRAME_RING"_%d", clientId);
+    Utils_DestroySharedMemory(shmName, RTSP_FRAME_RING_SHM_SIZE, &pRing->shmFd, &pRing->shmBaseAddr);
+    RtspFrameRingInit(pRing);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Push entry with frame data in ring. It never waits for consumer, if enough space is not
+ *          available then it fails and frame has to be dropped by caller.
+ * @param   pRing
+ * @param   pEntry - Entry header, entry length is updated by this function
+ * @param   pFrameData - Frame data of pEntry->dataLen bytes
+ * @param   reserveLen - Space which must remain free after pushing the entry
+ * @return  SUCCESS/FAIL
+ */
+BOOL RtspFrameRingPush(RTSP_FRAME_RING_t *pRing, RTSP_FRAME_RING_ENTRY_t *pEntry, const UINT8 *pFrameData, UINT32 reserveLen)
+{
+    UINT64 writeIdx, readIdx;
+    UINT32 ringPos, padLen = 0;
+
+    if (pRing->pHdr == NULL)
+    {
+        return FAIL;
+    }
+
+    pEntry->entryLen = RTSP_FRAME_RING_ALIGN(sizeof(RTSP_FRAME_RING_ENTRY_t) + pEntry->dataLen);
+    writeIdx = pRing->pHdr->writeIdx;
+    readIdx = __atomic_load_n(&pRing->pHdr->readIdx, __ATOMIC_ACQUIRE);
+    ringPos = (UINT32)(writeIdx % RTSP_FRAME_RING_DATA_SIZE);
+
+    /* Entry must be contiguous, skip remaining space of ring if entry does not fit in it */
+    if ((RTSP_FRAME_RING_DATA_SIZE - ringPos) < pEntry->entryLen)
+    {
+        padLen = (RTSP_FRAME_RING_DATA_SIZE - ringPos);
+    }
+
+    if (((UINT64)padLen + pEntry->entryLen + reserveLen) > (RTSP_FRAME_RING_DATA_SIZE - (writeIdx - readIdx)))
+    {
+        return FAIL;
+    }
+
+    if (padLen != 0)
+    {
+        *(UINT32PTR)(pRing->pData + ringPos) = RTSP_FRAME_RING_WRAP_MARKER;
+        writeIdx += padLen;
+        ringPos = 0;
+    }
+
+    memcpy(pRing->pData + ringPos, pEntry, sizeof(RTSP_FRAME_RING_ENTRY_t));
+    if (pEntry->dataLen != 0)
+    {
+        memcpy(pRing->pData + ringPos + sizeof(RTSP_FRAME_RING_ENTRY_t), pFrameData, pEntry->dataLen);
+    }
+
+    /* Publish entry to consumer */
+    __atomic_store_n(&pRing->pHdr->writeIdx, writeIdx + pEntry->entryLen, __ATOMIC_SEQ_CST);
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check whether consumer has to be notified after pushing entries. Consumer is notified only
+ *          when it is waiting, and only once till it starts waiting again.
+ * @param   pRing
+ * @return  TRUE if doorbell is required else FALSE
+ */
+BOOL RtspFrameRingIsNotifyRequired(RTSP_FRAME_RING_t *pRing)
+{
+    if (pRing->pHdr == NULL)
+    {
+        return FALSE;
+    }
+
+    return (__atomic_exchange_n(&pRing->pHdr->consumerWaiting, FALSE, __ATOMIC_SEQ_CST) == TRUE) ? TRUE : FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Get oldest entry from ring. Entry remains valid till it is released.
+ * @param   pRing
+ * @return  Entry pointer or NULL if ring is empty
+ */
+RTSP_FRAME_RING_ENTRY_t *RtspFrameRingPeek(RTSP_FRAME_RING_t *pRing)
+{
+    UINT64                  writeIdx, readIdx;
+    UINT32                  ringPos;
+    RTSP_FRAME_RING_ENTRY_t *pEntry;
+
+    if (pRing->pHdr == NULL)
+    {
+        return NULL;
+    }
+
+    readIdx = pRing->pHdr->readIdx;
+    writeIdx = __atomic_load_n(&pRing->pHdr->writeIdx, __ATOMIC_ACQUIRE);
+
+    while (readIdx != writeIdx)
+    {
+        ringPos = (UINT32)(readIdx % RTSP_FRAME_RING_DATA_SIZE);
+        pEntry = (RTSP_FRAME_RING_ENTRY_t *)(pRing->pData + ringPos);
+        if (pEntry->entryLen == RTSP_FRAME_RING_WRAP_MARKER)
+        {
+            /* Remaining space of ring is skipped by producer */
+            readIdx += (RTSP_FRAME_RING_DATA_SIZE - ringPos);
+            __atomic_store_n(&pRing->pHdr->readIdx, readIdx, __ATOMIC_RELEASE);
+            continue;
+        }
+
+        if ((pEntry->entryLen > (RTSP_FRAME_RING_DATA_SIZE - ringPos)) || (pEntry->entryLen > (writeIdx - readIdx))
+                || ((sizeof(RTSP_FRAME_RING_ENTRY_t) + pEntry->dataLen) > pEntry->entryLen))
+        {
+            /* Ring is corrupted, discard all pending entries */
+            EPRINT(RTSP_IFACE, "invld frame ring entry, discarding ring: [entryLen=%d], [dataLen=%d]", pEntry->entryLen, pEntry->dataLen);
+            __atomic_store_n(&pRing->pHdr->readIdx, writeIdx, __ATOMIC_RELEASE);
+            return NULL;
+        }
+
+        return pEntry;
+    }
+
+    return NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Release the entry got from peek, its space can be reused by producer after that
+ * @param   pRing
+ * @param   pEntry
+ */
+void RtspFrameRingRelease(RTSP_FRAME_RING_t *pRing, RTSP_FRAME_RING_ENTRY_t *pEntry)
+{
+    __atomic_store_n(&pRing->pHdr->readIdx, pRing->pHdr->readIdx + pEntry->entryLen, __ATOMIC_RELEASE);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Consumer marks itself waiting before sleeping for doorbell. Ring is checked again after
+ *          marking to avoid missing the entry pushed just before marking.
+ * @param   pRing
+ * @return  TRUE if consumer can wait for doorbell, FALSE if entries are available
+ */
+BOOL RtspFrameRingPrepareWait(RTSP_FRAME_RING_t *pRing)
+{
+    if (pRing->pHdr == NULL)
+    {
+        return TRUE;
+    }
+
+    __atomic_store_n(&pRing->pHdr->consumerWaiting, TRUE, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&pRing->pHdr->writeIdx, __ATOMIC_SEQ_CST) != pRing->pHdr->readIdx)
+    {
+        __atomic_store_n(&pRing->pHdr->consumerWaiting, FALSE, __ATOMIC_SEQ_CST);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Consumer is no more waiting for doorbell
+ * @param   pRing
+ */
+void RtspFrameRingWaitDone(RTSP_FRAME_RING_t *pRing)
+{
+    if (pRing->pHdr == NULL)
+    {
+        return;
+    }
+
+    __atomic_store_n(&pRing->pHdr->consumerWaiting, FALSE, __ATOMIC_SEQ_CST);
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
@@ -0,0 +1,101 @@
+#if !defined RTSP_FRAME_RING_H
+#define RTSP_FRAME_RING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file		RtspFrameRing.h
+@brief      Single producer single consumer frame ring in shared memory between RTSP client
+            application (producer) and RTSP client interface of NVR application (consumer). Producer
+            never waits for consumer. Consumer is notified through a doorbell only when it is sleeping,
+            hence notifications are batched when frames are flowing continuously.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Application Includes */
+#include "RtspClientInterface.h"
+
+//#################################################################################################
+// @DEFINES
+//#################################################################################################
+/* Shared memory name of frame ring, RTSP client id is appended to it */
+#define SHM_NAME_FRAME_RING             "/shmFrameRing"
+
+/* Frame ring data area size. It can hold few video frames of all media sessions of RTSP client */
+#define RTSP_FRAME_RING_DATA_SIZE       (8 * MEGA_BYTE)
+
+/* Space kept free for control entries (connect fail, close etc) when ring is loaded with frames */
+#define RTSP_FRAME_RING_CTRL_RESERVE    (64 * KILO_BYTE)
+
+//#################################################################################################
+// @DATA TYPES
+//#################################################################################################
+/* Frame ring entry, it is followed by frame data in ring */
+typedef struct
+{
+    UINT32              entryLen;       // Entry length including header and padding
+    MediaFrameResp_e    response;
+    UINT8               camIndex;
+    RTSP_HANDLE         mediaHandle;
+    UINT32              dataLen;
+    MEDIA_FRAME_INFO_t  frameInfo;
+
+}RTSP_FRAME_RING_ENTRY_t;
+
+/* Frame ring header at start of shared memory. Write and read index are total bytes produced and
+ * consumed respectively and they are kept on separate cache lines */
+typedef struct
+{
+    UINT32              ringSize;
+    UINT32              reserved1;
+    UINT64              writeIdx;
+    UINT8               reserved2[48];
+    UINT64              readIdx;
+    UINT32              consumerWaiting;
+    UINT8               reserved3[52];
+
+}RTSP_FRAME_RING_HDR_t;
+
+typedef struct
+{
+    INT32                   shmFd;
+    UINT8PTR                shmBaseAddr;
+    RTSP_FRAME_RING_HDR_t   *pHdr;
+    UINT8PTR                pData;
+
+}RTSP_FRAME_RING_t;
+
+//#################################################################################################
+// @PROTOTYPES
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+void RtspFrameRingInit(RTSP_FRAME_RING_t *pRing);
+//-------------------------------------------------------------------------------------------------
+BOOL RtspFrameRingOpen(UINT8 clientId, BOOL isProducer, RTSP_FRAME_RING_t *pRing);
+//-------------------------------------------------------------------------------------------------
+void RtspFrameRingClose(UINT8 clientId, RTSP_FRAME_RING_t *pRing);
+//-------------------------------------------------------------------------------------------------
+BOOL RtspFrameRingPush(RTSP_FRAME_RING_t *pRing, RTSP_FRAME_RING_ENTRY_t *pEntry, const UINT8 *pFrameData, UINT32 reserveLen);
+//-------------------------------------------------------------------------------------------------
+BOOL RtspFrameRingIsNotifyRequired(RTSP_FRAME_RING_t *pRing);
+//-------------------------------------------------------------------------------------------------
+RTSP_FRAME_RING_ENTRY_t *RtspFrameRingPeek(RTSP_FRAME_RING_t *pRing);
+//-------------------------------------------------------------------------------------------------
+void RtspFrameRingRelease(RTSP_FRAME_RING_t *pRing, RTSP_FRAME_RING_ENTRY_t *pEntry);
+//-------------------------------------------------------------------------------------------------
+BOOL RtspFrameRingPrepareWait(RTSP_FRAME_RING_t *pRing);
+//-------------------------------------------------------------------------------------------------
+void RtspFrameRingWaitDone(RTSP_FRAME_RING_t *pRing);
+//-------------------------------------------------------------------------------------------------
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
+#ifdef __cplusplus
+}
+#endif
+#endif  // RTSP_FRAME_RING_H
@@ -329,6 +329,8 @@ static BOOL startSnapshotUpload(UINT8 channelNo)
     snapShotUploadPara[channelNo].startImgUpldStatus = ON;
     MUTEX_UNLOCK(snapShotUploadPara[channelNo].imgUpldInfMutx);
 
+    /* Image callback may come before return of get image request */
+    snapShotUploadPara[channelNo].imgUpldSysTk = GetSysTick();
     if(GetImage(channelNo, NULL, imageCallBack, CLIENT_CB_TYPE_NATIVE) != CMD_SUCCESS)
     {
         upldRateCnt = (SEC_IN_ONE_MIN / snpshtUpldCfg.snapShotuploadImageRate);
@@ -365,7 +367,6 @@ static BOOL startSnapshotUpload(UINT8 channelNo)
         return FAIL;
     }
 
-    snapShotUploadPara[channelNo].imgUpldSysTk = GetSysTick();
     DPRINT(SNAPSHOT_SCHEDULE, "get image ok: [camera=%d]", channelNo);
     return SUCCESS;
 }
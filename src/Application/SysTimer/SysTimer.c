@@ -10,6 +10,11 @@
             can be reloaded to new count without deleting or restarting the timer. Also there are
             functions which can provide system ticks and the ticks elapsed from the specific point.
             Concept of this module is based on the ACS system timer.
+            Timers are kept in hierarchical timing wheel. Root wheel has one slot per tick and each
+            upper level wheel slot covers complete lower level wheel. On every tick only expired slot
+            of root wheel is processed and upper level slot is cascaded in lower level when lower
+            level wheel completes its round. Timer nodes are taken from pool and callbacks are
+            invoked without holding the timer list lock.
 */
 //#################################################################################################
 // @INCLUDES
@@ -27,27 +32,97 @@
 //#################################################################################################
 #define MAX_ONE_MIN_FUNC	(7)
 
+/* Root wheel has 256 slots and 4 upper level wheels have 64 slots each to cover 32 bit timer count */
+#define TIMER_WHEEL_ROOT_BITS       (8)
+#define TIMER_WHEEL_ROOT_SIZE       (1 << TIMER_WHEEL_ROOT_BITS)
+#define TIMER_WHEEL_ROOT_MASK       (TIMER_WHEEL_ROOT_SIZE - 1)
+#define TIMER_WHEEL_LEVEL_BITS      (6)
+#define TIMER_WHEEL_LEVEL_SIZE      (1 << TIMER_WHEEL_LEVEL_BITS)
+#define TIMER_WHEEL_LEVEL_MASK      (TIMER_WHEEL_LEVEL_SIZE - 1)
+#define TIMER_WHEEL_LEVEL_MAX       (4)
+
+/* Slot index of upper level wheel for given tick */
+#define TIMER_WHEEL_LEVEL_INDEX(tick, level) \
+    ((UINT32)(((tick) >> (TIMER_WHEEL_ROOT_BITS + ((level) * TIMER_WHEEL_LEVEL_BITS))) & TIMER_WHEEL_LEVEL_MASK))
+
+/* Timer nodes are allocated in chunks and never freed, deleted nodes are reused */
+#define TIMER_POOL_CHUNK_SIZE       (64)
+
+/* Initial size of expired timer list, it grows when more timers expire on same tick */
+#define TIMER_EXPIRY_LIST_SIZE      (64)
+
+/* Timer statistics are printed and reset at this interval */
+#define TIMER_STATS_LOG_INTERVAL_MIN (10)
+
+//#################################################################################################
+// @DATA TYPES
+//#################################################################################################
+/* Expired timer whose callback is pending */
+typedef struct
+{
+    SYS_TIMER_LIST_t    *pNode;
+    UINT32              generation;
+
+}TIMER_EXPIRY_t;
+
 //#################################################################################################
 // @STATIC VARIABLES
 //#################################################################################################
 static UINT32 				sysTick;			// keeps count of system ticks @ 100 mSec
 static pthread_rwlock_t 	sysTickMutex;
 
-static SYS_TIMER_LIST_t     *sysTimerListHead;	// start node address of timer list
-static SYS_TIMER_LIST_t     *sysTimerListTail;	// end node address of timer list
-
 static pthread_mutex_t 		resourceMutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
 
 static UINT8				oneMinFunCnt;
 static ONE_MIN_NOTIFY_t		oneMinNotify[MAX_ONE_MIN_FUNC];
 
-static SYS_TIMER_LIST_t     *nextNodePtr;			// next node in list after current node
-static BOOL				 	sysTmrCallBackActiveF;	// indicates if call back process is active
+static UINT64               wheelTick;                                                      // next tick to be processed by timer wheel
+static SYS_TIMER_LIST_t     *timerWheelRoot[TIMER_WHEEL_ROOT_SIZE];                         // root wheel slots
+static SYS_TIMER_LIST_t     *timerWheelLevel[TIMER_WHEEL_LEVEL_MAX][TIMER_WHEEL_LEVEL_SIZE]; // upper level wheel slots
+static SYS_TIMER_LIST_t     *timerFreeList;                                                 // free nodes of pool
+
+static TIMER_EXPIRY_t       *timerExpiryList;
+static UINT32               timerExpiryListSize;
+
+static pthread_t            timerThreadId;
+static pthread_cond_t       callbackDoneCond = PTHREAD_COND_INITIALIZER;
+static SYS_TIMER_LIST_t     *runningNode;       // node whose callback is running
+static UINT32               runningGeneration;
+
+static UINT64               lastTickTime;
+static SYS_TIMER_STATS_t    timerStats;
 
 //#################################################################################################
 // @PROTOTYPES
 //#################################################################################################
 //-------------------------------------------------------------------------------------------------
+static SYS_TIMER_LIST_t *allocTimerNode(void);
+//-------------------------------------------------------------------------------------------------
+static void freeTimerNode(SYS_TIMER_LIST_t *pNode);
+//-------------------------------------------------------------------------------------------------
+static void addTimerNode(SYS_TIMER_LIST_t *pNode);
+//-------------------------------------------------------------------------------------------------
+static void removeTimerNode(SYS_TIMER_LIST_t *pNode);
+//-------------------------------------------------------------------------------------------------
+static void armTimerNode(SYS_TIMER_LIST_t *pNode);
+//-------------------------------------------------------------------------------------------------
+static UINT32 cascadeTimers(UINT8 level, UINT32 slot);
+//-------------------------------------------------------------------------------------------------
+static UINT32 collectExpiredTimers(void);
+//-------------------------------------------------------------------------------------------------
+static void dispatchExpiredTimers(UINT32 expiryCnt);
+//-------------------------------------------------------------------------------------------------
+static void updateTickJitter(void);
+//-------------------------------------------------------------------------------------------------
+static BOOL isTimerHandleValid(TIMER_HANDLE handle);
+//-------------------------------------------------------------------------------------------------
+static void logTimerStats(void);
+//-------------------------------------------------------------------------------------------------
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
 /**
  * @brief   This function initializes all system timer related parameters. It needs to be called
  *          during start-up of the program.
@@ -60,13 +135,26 @@ void InitSysTimer(void)
 	sysTick = 0;
 	pthread_rwlock_init(&sysTickMutex, NULL);
 
-	// reset all link list node pointers
-	sysTimerListHead = NULL;
-	sysTimerListTail = NULL;
-	nextNodePtr = NULL;
-	sysTmrCallBackActiveF = FALSE;
+	// reset timer wheel
+	wheelTick = 0;
+	memset(timerWheelRoot, 0, sizeof(timerWheelRoot));
+	memset(timerWheelLevel, 0, sizeof(timerWheelLevel));
+	timerFreeList = NULL;
+	runningNode = NULL;
 	oneMinFunCnt = 0;
 
+	// allocate initial expired timer list
+	timerExpiryListSize = TIMER_EXPIRY_LIST_SIZE;
+	timerExpiryList = malloc(sizeof(TIMER_EXPIRY_t) * timerExpiryListSize);
+	if (timerExpiryList == NULL)
+	{
+	    timerExpiryListSize = 0;
+	    EPRINT(SYS_LOG, "fail to alloc memory for expired timer list");
+	}
+
+	lastTickTime = 0;
+	memset(&timerStats, 0, sizeof(timerStats));
+
 	for(cnt = 0; cnt < MAX_ONE_MIN_FUNC; cnt++)
 	{
 		oneMinNotify[cnt].funcPtr = NULL;
@@ -76,48 +164,28 @@ void InitSysTimer(void)
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   This function traverses through timer lists and updates counts of the active timers.
- *          If any of the timers from the list expires, it calls the callback function registered
- *          with that timer. This function is called upon the receipt of SIG_ALRM at interval of 50mSec.
+ * @brief   This function advances timer wheel by one tick. Timers of expired slot are reloaded and
+ *          their callback functions are invoked after releasing the timer list lock. Hence other
+ *          threads can start, delete and reload timers while callbacks are running.
  * @note    This function needs to run in super-loop. so accuracy varies with the execution time of the loop.
  */
 void RunSysTimer(void)
 {
-    static UINT8        prevMin = SEC_IN_ONE_MIN;
-    SYS_TIMER_LIST_t    *currNodePtr;
-	
-	// set node pointer to beginning of list and set active call-back flag
-	currNodePtr = sysTimerListHead;
-
-	// lock the node, in order to prevent multiple simultaneous access to timer list.
-    MUTEX_LOCK(resourceMutex);
+    static UINT8    prevMin = SEC_IN_ONE_MIN;
+    static UINT8    statsLogMinCnt = 0;
+    UINT32          expiryCnt;
 
-	sysTmrCallBackActiveF = TRUE;
+    updateTickJitter();
 
-	// traverse through the list until end of the list is reached
-	while(currNodePtr != NULL)
-	{
-        // Store next node pointer first since it can be deleted by callback function of current node.
-		nextNodePtr = currNodePtr->next;
-
-		// increment current count of timer, if it is greater than or equal to user count,
-		// reset current count, invoke the call-back function and pass the data to it
-        currNodePtr->sysTimer.currCount++;
-        if(currNodePtr->sysTimer.currCount >= currNodePtr->sysTimer.timerInfo.count)
-		{
-			currNodePtr->sysTimer.currCount = 0;
-            (*(currNodePtr->sysTimer.timerInfo.funcPtr)) (currNodePtr->sysTimer.timerInfo.data);
-		}
-
-		// point address to next node
-		currNodePtr = nextNodePtr;
-	}
-
-	sysTmrCallBackActiveF = FALSE;
-
-	// unlock the resource
+	// lock the timer wheel, in order to prevent multiple simultaneous access
+    MUTEX_LOCK(resourceMutex);
+    timerThreadId = pthread_self();
+    expiryCnt = collectExpiredTimers();
     MUTEX_UNLOCK(resourceMutex);
 
+    // invoke callbacks of expired timers
+    dispatchExpiredTimers(expiryCnt);
+
 	pthread_rwlock_wrlock(&sysTickMutex);
 	sysTick++;
     if (sysTick % 10)
@@ -148,23 +216,27 @@ void RunSysTimer(void)
             oneMinNotify[cnt].funcPtr(oneMinNotify[cnt].userData);
         }
     }
+
+    if (++statsLogMinCnt >= TIMER_STATS_LOG_INTERVAL_MIN)
+    {
+        statsLogMinCnt = 0;
+        logTimerStats();
+    }
 }
 
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   This function starts a new timer with specified timer count and register callback function
- *          by adding a node in timer list. On expiry of the timer, user supplied callback function
+ *          by adding a node in timer wheel. On expiry of the timer, user supplied callback function
  *          will be invoked along with data supplied. Timer handle returned to caller is nothing but
- *          address of timer node in the list.
+ *          address of timer node.
  * @param   timerInfo
  * @param   handle
  * @return  Returns SUCCESS on creation else return FAIL
  */
 BOOL StartTimer(TIMER_INFO_t timerInfo, TIMER_HANDLE *handle)
 {
-    SYS_TIMER_LIST_t	*newNode;
-	SYS_TIMER_LIST_t	**head;
-	SYS_TIMER_LIST_t	**tail;
+    SYS_TIMER_LIST_t *newNode;
 
 	// Make sure pointer where we return handle is not NULL
     if(handle == INVALID_TIMER_HANDLE)
@@ -172,43 +244,24 @@ BOOL StartTimer(TIMER_INFO_t timerInfo, TIMER_HANDLE *handle)
         return FAIL;
     }
 
-    // get memory from the pool for new timer to be created, store its address in new node pointer
-    newNode = (SYS_TIMER_LIST_t *)malloc(sizeof(SYS_TIMER_LIST_t));
+    // lock the resource to avoid simultaneous access
+    MUTEX_LOCK(resourceMutex);
+
+    // get node from the pool for new timer to be created
+    newNode = allocTimerNode();
 
     // if no memory is available, NULL the timer handle and return fail status
     if(newNode == NULL)
     {
+        MUTEX_UNLOCK(resourceMutex);
         *handle = INVALID_TIMER_HANDLE;
         EPRINT(SYS_LOG, "fail to alloc memory");
         return FAIL;
     }
 
-    // if memory is available, load user data to timer buffer
-    newNode->sysTimer.currCount = 0;
-    newNode->sysTimer.timerInfo.count = timerInfo.count;
-    newNode->sysTimer.timerInfo.data = timerInfo.data;
-    newNode->sysTimer.timerInfo.funcPtr = timerInfo.funcPtr;
-
-    // initialize timer list pointers
-    head = &sysTimerListHead;
-    tail = &sysTimerListTail;
-
-    // lock the resource to avoid simultaneous access
-    MUTEX_LOCK(resourceMutex);
-
-    // if this is a first entry in list, insert it at beginning otherwise insert it at the end of the list
-    if(*head == INVALID_TIMER_HANDLE)
-    {
-        (*head) = newNode;
-    }
-    else
-    {
-        (*tail)->next = newNode;
-    }
-
-    newNode->next = NULL;
-    newNode->prev = (*tail);
-    (*tail) = newNode;
+    // load user data to timer node and add it in timer wheel
+    newNode->sysTimer.timerInfo = timerInfo;
+    armTimerNode(newNode);
 
     // unlock the resource
     MUTEX_UNLOCK(resourceMutex);
@@ -220,12 +273,14 @@ BOOL StartTimer(TIMER_INFO_t timerInfo, TIMER_HANDLE *handle)
 
 //-------------------------------------------------------------------------------------------------
 /**
- * @brief   This function marks the timer to be deleted from the list.
+ * @brief   This function deletes the timer. If callback of the timer is running in timer thread then
+ *          it waits till callback completes, hence callback is never invoked after this function.
  * @param   handlePtr
  */
 void DeleteTimer(TIMER_HANDLE *	handlePtr)
 {
-	SYS_TIMER_LIST_t * tempNodePtr;
+    SYS_TIMER_LIST_t    *pNode;
+    UINT32              generation;
 
 	// check if the handle pointer is invalid or not
     if(handlePtr == INVALID_TIMER_HANDLE)
@@ -239,65 +294,25 @@ void DeleteTimer(TIMER_HANDLE *	handlePtr)
         return;
     }
 
-    // lock the timer list prior to search operation
     MUTEX_LOCK(resourceMutex);
-
-    // Start searching specified handle from head
-    tempNodePtr = sysTimerListHead;
-
-    // Traverse through the entire list
-    while(tempNodePtr != NULL)
+    pNode = *handlePtr;
+    if (FALSE == isTimerHandleValid(pNode))
     {
-        // if specified timer found then mark the delete flag, else point to next timer
-        if(tempNodePtr != *handlePtr)
-        {
-            // fetch next timer
-            tempNodePtr = tempNodePtr->next;
-            continue;
-        }
-
-        // if head is deleted then update head
-        if(tempNodePtr == sysTimerListHead)
-        {
-            sysTimerListHead = tempNodePtr->next;
-            if(sysTimerListHead != NULL)
-            {
-                sysTimerListHead->prev = NULL;
-            }
-        }
-        // if tail is deleted then update tail
-        else if(tempNodePtr == sysTimerListTail)
-        {
-            sysTimerListTail = tempNodePtr->prev;
-            sysTimerListTail->next = NULL;
-        }
-        else // deleting node other than head & tail
-        {
-            if(tempNodePtr->prev != NULL)
-            {
-                tempNodePtr->prev->next = tempNodePtr->next;
-            }
-
-            if(tempNodePtr->next != NULL)
-            {
-                tempNodePtr->next->prev = tempNodePtr->prev;
-            }
-        }
+        MUTEX_UNLOCK(resourceMutex);
+        return;
+    }
 
-        // While timer task processes current node, it backs up for next node that is to be processed after the current node has been processed.
-        // So, if we needs to delete next node of current node then we need to update next node.
-        if((tempNodePtr == nextNodePtr) && (sysTmrCallBackActiveF == TRUE))
-        {
-            nextNodePtr = tempNodePtr->next;
-        }
+    // remove timer from wheel and give node back to pool. Pending expiry of this timer is discarded on generation change
+    generation = pNode->generation;
+    removeTimerNode(pNode);
+    freeTimerNode(pNode);
+    *handlePtr = INVALID_TIMER_HANDLE;
 
-        free(tempNodePtr);
-        tempNodePtr = NULL;
-        *handlePtr = INVALID_TIMER_HANDLE;
-        break;
+    // wait for running callback of this timer if timer is deleted from other thread
+    while ((runningNode == pNode) && (runningGeneration == generation) && (FALSE == pthread_equal(pthread_self(), timerThreadId)))
+    {
+        pthread_cond_wait(&callbackDoneCond, &resourceMutex);
     }
-
-    // unlock timer list at end of search
     MUTEX_UNLOCK(resourceMutex);
 }
 
@@ -310,8 +325,6 @@ void DeleteTimer(TIMER_HANDLE *	handlePtr)
  */
 BOOL ReloadTimer(TIMER_HANDLE handle, UINT32 count)
 {
-    SYS_TIMER_LIST_t *tempNodePtr;
-
 	// check handle is not invalid, if it is then return with fail status
     if(handle == INVALID_TIMER_HANDLE)
 	{
@@ -319,28 +332,18 @@ BOOL ReloadTimer(TIMER_HANDLE handle, UINT32 count)
     }
 
     MUTEX_LOCK(resourceMutex);
-    // traverse through the timer list from the beginning,
-    tempNodePtr = sysTimerListHead;
-    while(tempNodePtr != NULL)
+    if (FALSE == isTimerHandleValid(handle))
     {
-        // find out the node specified by handle
-        if(tempNodePtr != handle)
-        {
-            // fetch next node
-            tempNodePtr = tempNodePtr->next;
-            continue;
-        }
-
-        // load reload count to timer; reset current count to zero and return success
-        handle->sysTimer.timerInfo.count = count;
-        handle->sysTimer.currCount = 0;
         MUTEX_UNLOCK(resourceMutex);
-        return SUCCESS;
+        return FAIL;
     }
-    MUTEX_UNLOCK(resourceMutex);
 
-	// if handle is invalid return with fail status
-    return FAIL;
+    // load reload count to timer and restart it from current tick
+    removeTimerNode(handle);
+    handle->sysTimer.timerInfo.count = count;
+    armTimerNode(handle);
+    MUTEX_UNLOCK(resourceMutex);
+    return SUCCESS;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -352,7 +355,7 @@ BOOL ReloadTimer(TIMER_HANDLE handle, UINT32 count)
  */
 BOOL GetElapsedTime(TIMER_HANDLE handle, UINT32PTR timeCnt)
 {
-    SYS_TIMER_LIST_t *tempNodePtr;
+    UINT32 remainingCnt;
 
 	// check handle is not invalid, if it is then return with fail status
     if(handle == INVALID_TIMER_HANDLE)
@@ -361,27 +364,17 @@ BOOL GetElapsedTime(TIMER_HANDLE handle, UINT32PTR timeCnt)
     }
 
     MUTEX_LOCK(resourceMutex);
-    // traverse through the timer list from the beginning,
-    tempNodePtr = sysTimerListHead;
-    while(tempNodePtr != NULL)
+    if (FALSE == isTimerHandleValid(handle))
     {
-        // find out the node specified by handle
-        if(tempNodePtr != handle)
-        {
-            // fetch next node
-            tempNodePtr = tempNodePtr->next;
-            continue;
-        }
-
-        // load reload count to timer; reset current count to zero and return success
-        *timeCnt = handle->sysTimer.currCount;
         MUTEX_UNLOCK(resourceMutex);
-        return SUCCESS;
+        return FAIL;
     }
-    MUTEX_UNLOCK(resourceMutex);
 
-	// if handle is invalid return with fail status
-    return FAIL;
+    // elapsed count is reload count minus remaining ticks
+    remainingCnt = (UINT32)(handle->sysTimer.expireTick - wheelTick + 1);
+    *timeCnt = (handle->sysTimer.timerInfo.count > remainingCnt) ? (handle->sysTimer.timerInfo.count - remainingCnt) : 0;
+    MUTEX_UNLOCK(resourceMutex);
+    return SUCCESS;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -393,8 +386,6 @@ BOOL GetElapsedTime(TIMER_HANDLE handle, UINT32PTR timeCnt)
  */
 BOOL GetRemainingTime(TIMER_HANDLE handle, UINT32PTR timeCnt)
 {
-    SYS_TIMER_LIST_t *tempNodePtr;
-
 	// check handle is not invalid, if it is then return with fail status
     if(handle == INVALID_TIMER_HANDLE)
 	{
@@ -402,36 +393,16 @@ BOOL GetRemainingTime(TIMER_HANDLE handle, UINT32PTR timeCnt)
     }
 
     MUTEX_LOCK(resourceMutex);
-    // traverse through the timer list from the beginning,
-    tempNodePtr = sysTimerListHead;
-    while(tempNodePtr != NULL)
+    if (FALSE == isTimerHandleValid(handle))
     {
-        // find out the node specified by handle
-        if(tempNodePtr != handle)
-        {
-            // fetch next node
-            tempNodePtr = tempNodePtr->next;
-            continue;
-        }
-
-        if(handle->sysTimer.timerInfo.count >= handle->sysTimer.currCount)
-        {
-            // load reload count to timer; reset current count to zero and return success
-            *timeCnt = (handle->sysTimer.timerInfo.count - handle->sysTimer.currCount);
-            MUTEX_UNLOCK(resourceMutex);
-            return SUCCESS;
-        }
-        else
-        {
-            *timeCnt = 0;
-            MUTEX_UNLOCK(resourceMutex);
-            return FAIL;
-        }
+        MUTEX_UNLOCK(resourceMutex);
+        return FAIL;
     }
-    MUTEX_UNLOCK(resourceMutex);
 
-	// if handle is invalid return with fail status
-    return FAIL;
+    // remaining ticks including the tick on which timer expires
+    *timeCnt = (UINT32)(handle->sysTimer.expireTick - wheelTick + 1);
+    MUTEX_UNLOCK(resourceMutex);
+    return SUCCESS;
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -517,6 +488,368 @@ void SleepNanoSec(UINT64 ns)
     }
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Get system timer statistics
+ * @param   pStats
+ * @param   resetF - Reset the statistics after reading
+ */
+void GetSysTimerStats(SYS_TIMER_STATS_t *pStats, BOOL resetF)
+{
+    MUTEX_LOCK(resourceMutex);
+    *pStats = timerStats;
+    if (TRUE == resetF)
+    {
+        timerStats.tickCnt = 0;
+        timerStats.lastTickJitter = 0;
+        timerStats.maxTickJitter = 0;
+        timerStats.callbackCnt = 0;
+        timerStats.slowCallbackCnt = 0;
+        timerStats.maxCallbackTime = 0;
+        timerStats.maxCallbackFuncPtr = NULL;
+    }
+    MUTEX_UNLOCK(resourceMutex);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Get free timer node from pool. Pool is extended by a chunk of nodes when it is empty.
+ * @return  Timer node or NULL if memory is not available
+ * @note    Caller must hold resource lock
+ */
+static SYS_TIMER_LIST_t *allocTimerNode(void)
+{
+    UINT32              nodeCnt;
+    SYS_TIMER_LIST_t    *pNode;
+
+    if (timerFreeList == NULL)
+    {
+        pNode = calloc(TIMER_POOL_CHUNK_SIZE, sizeof(SYS_TIMER_LIST_t));
+        if (pNode == NULL)
+        {
+            return NULL;
+        }
+
+        for (nodeCnt = 0; nodeCnt < TIMER_POOL_CHUNK_SIZE; nodeCnt++)
+        {
+            pNode[nodeCnt].next = timerFreeList;
+            timerFreeList = &pNode[nodeCnt];
+        }
+
+        timerStats.poolNodes += TIMER_POOL_CHUNK_SIZE;
+    }
+
+    pNode = timerFreeList;
+    timerFreeList = pNode->next;
+    pNode->next = NULL;
+    pNode->pprev = NULL;
+    pNode->activeF = TRUE;
+    timerStats.activeTimers++;
+    return pNode;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Give timer node back to pool
+ * @param   pNode
+ * @note    Caller must hold resource lock
+ */
+static void freeTimerNode(SYS_TIMER_LIST_t *pNode)
+{
+    pNode->activeF = FALSE;
+    pNode->generation++;
+    pNode->next = timerFreeList;
+    pNode->pprev = NULL;
+    timerFreeList = pNode;
+    timerStats.activeTimers--;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Add timer node in wheel slot as per its expiry tick
+ * @param   pNode
+ * @note    Caller must hold resource lock
+ */
+static void addTimerNode(SYS_TIMER_LIST_t *pNode)
+{
+    UINT8               level;
+    UINT64              expireTick = pNode->sysTimer.expireTick;
+    UINT64              deltaTick = (expireTick - wheelTick);
+    SYS_TIMER_LIST_t    **pSlot;
+
+    if (deltaTick < TIMER_WHEEL_ROOT_SIZE)
+    {
+        pSlot = &timerWheelRoot[expireTick & TIMER_WHEEL_ROOT_MASK];
+    }
+    else
+    {
+        // find upper level wheel which covers the expiry, last level covers complete 32 bit count
+        for (level = 0; level < (TIMER_WHEEL_LEVEL_MAX - 1); level++)
+        {
+            if (deltaTick < (1ULL << (TIMER_WHEEL_ROOT_BITS + ((level + 1) * TIMER_WHEEL_LEVEL_BITS))))
+            {
+                break;
+            }
+        }
+
+        pSlot = &timerWheelLevel[level][TIMER_WHEEL_LEVEL_INDEX(expireTick, level)];
+    }
+
+    pNode->next = *pSlot;
+    if (pNode->next != NULL)
+    {
+        pNode->next->pprev = &pNode->next;
+    }
+
+    pNode->pprev = pSlot;
+    *pSlot = pNode;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Remove timer node from its wheel slot
+ * @param   pNode
+ * @note    Caller must hold resource lock
+ */
+static void removeTimerNode(SYS_TIMER_LIST_t *pNode)
+{
+    if (pNode->pprev == NULL)
+    {
+        // node is not in wheel; it is in expired list of current tick
+        return;
+    }
+
+    *pNode->pprev = pNode->next;
+    if (pNode->next != NULL)
+    {
+        pNode->next->pprev = pNode->pprev;
+    }
+
+    pNode->next = NULL;
+    pNode->pprev = NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Set expiry of timer from its reload count and add it in wheel. Timer expires after count
+ *          number of ticks from now; zero count is considered as one tick.
+ * @param   pNode
+ * @note    Caller must hold resource lock
+ */
+static void armTimerNode(SYS_TIMER_LIST_t *pNode)
+{
+    pNode->sysTimer.expireTick = wheelTick + ((pNode->sysTimer.timerInfo.count == 0) ? 0 : (pNode->sysTimer.timerInfo.count - 1));
+    addTimerNode(pNode);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Move timers of upper level wheel slot to lower level wheels
+ * @param   level
+ * @param   slot
+ * @return  Slot index, cascading of next level is required when it is zero
+ * @note    Caller must hold resource lock
+ */
+static UINT32 cascadeTimers(UINT8 level, UINT32 slot)
+{
+    SYS_TIMER_LIST_t *pNode, *pNextNode;
+
+    pNode = timerWheelLevel[level][slot];
+    timerWheelLevel[level][slot] = NULL;
+
+    while (pNode != NULL)
+    {
+        pNextNode = pNode->next;
+        addTimerNode(pNode);
+        pNode = pNextNode;
+    }
+
+    return slot;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Advance timer wheel by one tick and collect expired timers in expired timer list. Expired
+ *          timers are reloaded before their callbacks are invoked.
+ * @return  Number of expired timers
+ * @note    Caller must hold resource lock
+ */
+static UINT32 collectExpiredTimers(void)
+{
+    UINT8               level;
+    UINT32              expiryCnt = 0;
+    UINT32              rootSlot = (UINT32)(wheelTick & TIMER_WHEEL_ROOT_MASK);
+    SYS_TIMER_LIST_t    *pNode, *pNextNode;
+    TIMER_EXPIRY_t      *pExpiryList;
+
+    // cascade upper level slot when lower level wheel completes its round
+    if (rootSlot == 0)
+    {
+        for (level = 0; level < TIMER_WHEEL_LEVEL_MAX; level++)
+        {
+            if (cascadeTimers(level, TIMER_WHEEL_LEVEL_INDEX(wheelTick, level)) != 0)
+            {
+                break;
+            }
+        }
+    }
+
+    pNode = timerWheelRoot[rootSlot];
+    timerWheelRoot[rootSlot] = NULL;
+    wheelTick++;
+
+    while (pNode != NULL)
+    {
+        if (expiryCnt >= timerExpiryListSize)
+        {
+            pExpiryList = realloc(timerExpiryList, sizeof(TIMER_EXPIRY_t) * (timerExpiryListSize + TIMER_EXPIRY_LIST_SIZE));
+            if (pExpiryList == NULL)
+            {
+                // expire remaining timers on next tick
+                EPRINT(SYS_LOG, "fail to alloc memory for expired timer list: [expired=%d]", expiryCnt);
+                while (pNode != NULL)
+                {
+                    pNextNode = pNode->next;
+                    pNode->sysTimer.expireTick = wheelTick;
+                    addTimerNode(pNode);
+                    pNode = pNextNode;
+                }
+                break;
+            }
+
+            timerExpiryList = pExpiryList;
+            timerExpiryListSize += TIMER_EXPIRY_LIST_SIZE;
+        }
+
+        pNextNode = pNode->next;
+        pNode->next = NULL;
+        pNode->pprev = NULL;
+
+        // reload the timer and keep it for callback
+        timerExpiryList[expiryCnt].pNode = pNode;
+        timerExpiryList[expiryCnt].generation = pNode->generation;
+        expiryCnt++;
+        armTimerNode(pNode);
+        pNode = pNextNode;
+    }
+
+    return expiryCnt;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Invoke callbacks of expired timers without holding the resource lock. Timer which is
+ *          deleted by earlier callback or other thread is skipped.
+ * @param   expiryCnt
+ */
+static void dispatchExpiredTimers(UINT32 expiryCnt)
+{
+    UINT32              expiryIdx;
+    UINT32              callbackTime;
+    UINT64              startTime;
+    SYS_TIMER_LIST_t    *pNode;
+    TIMER_INFO_t        timerInfo;
+
+    for (expiryIdx = 0; expiryIdx < expiryCnt; expiryIdx++)
+    {
+        MUTEX_LOCK(resourceMutex);
+        pNode = timerExpiryList[expiryIdx].pNode;
+        if ((pNode->activeF == FALSE) || (pNode->generation != timerExpiryList[expiryIdx].generation))
+        {
+            MUTEX_UNLOCK(resourceMutex);
+            continue;
+        }
+
+        timerInfo = pNode->sysTimer.timerInfo;
+        runningNode = pNode;
+        runningGeneration = pNode->generation;
+        MUTEX_UNLOCK(resourceMutex);
+
+        startTime = GetMonotonicTimeInMilliSec();
+        (*(timerInfo.funcPtr))(timerInfo.data);
+        callbackTime = (UINT32)(GetMonotonicTimeInMilliSec() - startTime);
+
+        MUTEX_LOCK(resourceMutex);
+        runningNode = NULL;
+        pthread_cond_broadcast(&callbackDoneCond);
+
+        timerStats.callbackCnt++;
+        if (callbackTime > TIMER_RESOLUTION_MINIMUM_MSEC)
+        {
+            timerStats.slowCallbackCnt++;
+        }
+
+        if (callbackTime > timerStats.maxCallbackTime)
+        {
+            timerStats.maxCallbackTime = callbackTime;
+            timerStats.maxCallbackFuncPtr = timerInfo.funcPtr;
+        }
+        MUTEX_UNLOCK(resourceMutex);
+
+        if (callbackTime > TIMER_RESOLUTION_MINIMUM_MSEC)
+        {
+            WPRINT(SYS_LOG, "timer callback took more time: [func=%p], [data=%d], [time=%dms]", timerInfo.funcPtr, timerInfo.data, callbackTime);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Update tick jitter statistics from interval between consecutive ticks
+ */
+static void updateTickJitter(void)
+{
+    UINT64 currTime = GetMonotonicTimeInMilliSec();
+    UINT64 tickInterval;
+    UINT32 tickJitter;
+
+    if (lastTickTime == 0)
+    {
+        lastTickTime = currTime;
+        return;
+    }
+
+    tickInterval = currTime - lastTickTime;
+    lastTickTime = currTime;
+    tickJitter = (UINT32)((tickInterval > TIMER_RESOLUTION_MINIMUM_MSEC) ?
+                              (tickInterval - TIMER_RESOLUTION_MINIMUM_MSEC) : (TIMER_RESOLUTION_MINIMUM_MSEC - tickInterval));
+
+    MUTEX_LOCK(resourceMutex);
+    timerStats.tickCnt++;
+    timerStats.lastTickJitter = tickJitter;
+    if (tickJitter > timerStats.maxTickJitter)
+    {
+        timerStats.maxTickJitter = tickJitter;
+    }
+    MUTEX_UNLOCK(resourceMutex);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check timer handle refers to running timer
+ * @param   handle
+ * @return  TRUE if valid else FALSE
+ * @note    Caller must hold resource lock
+ */
+static BOOL isTimerHandleValid(TIMER_HANDLE handle)
+{
+    return handle->activeF;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Print timer statistics of last interval and reset them
+ */
+static void logTimerStats(void)
+{
+    SYS_TIMER_STATS_t stats;
+
+    GetSysTimerStats(&stats, TRUE);
+    DPRINT(SYS_LOG, "timer stats: [activeTimers=%u], [poolNodes=%u], [ticks=%u], [maxJitter=%ums], [callbacks=%u], [slowCallbacks=%u], "
+           "[maxCallbackTime=%ums], [maxCallbackFunc=%p]", stats.activeTimers, stats.poolNodes, stats.tickCnt, stats.maxTickJitter,
+           stats.callbackCnt, stats.slowCallbackCnt, stats.maxCallbackTime, stats.maxCallbackFuncPtr);
+}
+
 //#################################################################################################
 // @END OF FILE
 //#################################################################################################
@@ -15,7 +15,8 @@ extern "C" {
             reloaded with same timer count and hence it keeps on running until it is deleted. Timer
             can be reloaded to new count without deleting or restarting the timer. Also there are
             functions which can provide system ticks and the ticks elapsed from the specific point.
-            Concept of this module is based on the ACS system timer.
+            Concept of this module is based on the ACS system timer. Timers are kept in hierarchical
+            timing wheel, hence start, delete and reload are independent of number of timers.
 */
 //#################################################################################################
 // @INCLUDES
@@ -46,18 +47,35 @@ typedef struct
 typedef struct
 {
     TIMER_INFO_t    timerInfo;              // timer information structure
-    UINT32          currCount;              // current count of timer
+    UINT64          expireTick;             // timer wheel tick on which timer expires
 
 }SYS_TIMER_INFO_t;
 
 typedef struct TIMER_LIST_NODE
 {
     struct TIMER_LIST_NODE	*next;			// next node pointer
-    struct TIMER_LIST_NODE	*prev;			// previous node pointer
+    struct TIMER_LIST_NODE	**pprev;		// address of previous node's next pointer or wheel slot
     SYS_TIMER_INFO_t		sysTimer;		// system timer structure
+    UINT32                  generation;     // changed on every delete to detect stale expiry
+    BOOL                    activeF;        // node is in use by a timer
 
 }SYS_TIMER_LIST_t;
 
+/* System timer statistics, time values are in milli seconds */
+typedef struct
+{
+    UINT32  activeTimers;                   // number of running timers
+    UINT32  poolNodes;                      // number of timer nodes allocated in pool
+    UINT32  tickCnt;                        // ticks since last reset
+    UINT32  lastTickJitter;                 // difference of last tick interval from tick resolution
+    UINT32  maxTickJitter;                  // maximum tick jitter
+    UINT32  callbackCnt;                    // callbacks invoked since last reset
+    UINT32  slowCallbackCnt;                // callbacks which took more than tick resolution
+    UINT32  maxCallbackTime;                // maximum time taken by callback
+    void    (*maxCallbackFuncPtr)(UINT32);  // callback which took maximum time
+
+}SYS_TIMER_STATS_t;
+
 typedef struct
 {
     BOOL    (*funcPtr)(UINT32 userData);
@@ -93,6 +111,8 @@ BOOL RegisterOnMinFun(ONE_MIN_NOTIFY_t * oneMinFun);
 //-------------------------------------------------------------------------------------------------
 void SleepNanoSec(UINT64 ns);
 //-------------------------------------------------------------------------------------------------
+void GetSysTimerStats(SYS_TIMER_STATS_t *pStats, BOOL resetF);
+//-------------------------------------------------------------------------------------------------
 //#################################################################################################
 // @END OF FILE
 //#################################################################################################
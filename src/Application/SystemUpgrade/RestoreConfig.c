@@ -177,6 +177,12 @@ static void procBeforeConfigRestore(void)
 
     /* Notify config restore action to DHCP server */
     DhcpServerConfigRestoreNotify();
+
+    /* Pending updates of config journal must not be applied on restored config files */
+    if (FAIL == FlushConfigJournal())
+    {
+        WPRINT(SYSTEM_UPGRADE, "fail to flush config journal before config restore");
+    }
 }
 
 //#################################################################################################
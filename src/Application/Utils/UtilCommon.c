@@ -12,6 +12,8 @@
 #include <time.h>
 #include <sys/shm.h>
 #include <sys/mman.h>
+#include <sys/ioctl.h>
+#include <linux/sockios.h>
 
 /* Application Includes */
 #include "ConfigApi.h"
@@ -279,6 +281,155 @@ BOOL SendToSocket(INT32 connFd, UINT8 *pSendBuff, UINT32 buffLen, UINT32 timeout
     return FAIL;
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function send scattered message to client in single message. All buffers are
+ *          given to socket in one call and remaining part is sent on partial write.
+ * @param   connFd - Fd of client
+ * @param   pIov - Buffers to send. It is updated on partial write
+ * @param   iovCnt - Number of buffers
+ * @param   timeoutSec - Timeout for poll
+ * @return  Returns SUCCESS/FAIL
+ */
+BOOL SendIovToSocket(INT32 connFd, struct iovec *pIov, UINT8 iovCnt, UINT32 timeoutSec)
+{
+    INT32 			sendCnt;
+    INT16           pollEvent = (POLLWRNORM | POLLRDHUP);
+    INT16           recvEvent;
+    UINT64          prevTimeMs = 0;
+    UINT8           pollSts;
+    struct msghdr   msgHdr;
+
+    /* Validate socket fd */
+    if (connFd == INVALID_CONNECTION)
+    {
+        /* Invalid FD found */
+        EPRINT(UTILS, "Invld fd found");
+        return FAIL;
+    }
+
+    memset(&msgHdr, 0, sizeof(msgHdr));
+    msgHdr.msg_iov = pIov;
+    msgHdr.msg_iovlen = iovCnt;
+
+    while(TRUE)
+    {
+        /* Skip buffers which are sent completely */
+        while ((msgHdr.msg_iovlen > 0) && (msgHdr.msg_iov->iov_len == 0))
+        {
+            msgHdr.msg_iov++;
+            msgHdr.msg_iovlen--;
+        }
+
+        if (msgHdr.msg_iovlen == 0)
+        {
+            /* Required data sent */
+            return SUCCESS;
+        }
+
+        /* Poll for fd till event or timeout */
+        pollSts = GetSocketPollEvent(connFd, pollEvent, GetRemainingPollTime(&prevTimeMs, timeoutSec*1000), &recvEvent);
+        if (FAIL == pollSts)
+        {
+            EPRINT(UTILS, "socket event poll fail: [fd=%d]", connFd);
+            break;
+        }
+
+        if (TIMEOUT == pollSts)
+        {
+            EPRINT(UTILS, "send timeout: [fd=%d], [pendingIov=%d]", connFd, (INT32)msgHdr.msg_iovlen);
+            break;
+        }
+
+        /* Is remote connection closed event? */
+        if ((recvEvent & POLLRDHUP) == POLLRDHUP)
+        {
+            EPRINT(UTILS, "remote connection closed: [fd=%d]", connFd);
+            break;
+        }
+
+        /* Is other than write event? */
+        if ((recvEvent & POLLWRNORM) != POLLWRNORM)
+        {
+            EPRINT(UTILS, "invld event: [fd=%d], [revents=0x%x]", connFd, recvEvent);
+            break;
+        }
+
+        /* Send all pending buffers on socket */
+        sendCnt = sendmsg(connFd, &msgHdr, MSG_NOSIGNAL);
+        if (sendCnt > 0)
+        {
+            /* Move buffers ahead by sent data */
+            while ((sendCnt > 0) && (msgHdr.msg_iovlen > 0))
+            {
+                if ((size_t)sendCnt < msgHdr.msg_iov->iov_len)
+                {
+                    msgHdr.msg_iov->iov_base = (UINT8 *)msgHdr.msg_iov->iov_base + sendCnt;
+                    msgHdr.msg_iov->iov_len -= sendCnt;
+                    break;
+                }
+
+                sendCnt -= msgHdr.msg_iov->iov_len;
+                msgHdr.msg_iov->iov_len = 0;
+            }
+        }
+        else
+        {
+            /* Is other than resource unavailable error? */
+            if (!(errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS))
+            {
+                EPRINT(UTILS, "send failed: [fd=%d], [err=%s]", connFd, STR_ERR);
+                return FAIL;
+            }
+        }
+    }
+
+    return FAIL;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function checks whether socket can accept more data without waiting. Write event only
+ *          tells that some space is free, hence unsent data of socket is compared with high water mark.
+ *          Kernel reports double of send buffer size to keep space for its bookkeeping, hence half of
+ *          it is taken as high water mark. Send buffer works as bounded queue of connection.
+ * @param   connFd - Fd of client
+ * @param   sendLen - Length of data to send. Data is taken by socket even above high water mark, hence
+ *          it is not used in check. It is kept for send ready callbacks of other clients.
+ * @return  Returns TRUE if data can be sent or socket has error otherwise FALSE
+ */
+BOOL IsSocketSendReady(INT32 connFd, UINT32 sendLen)
+{
+    INT16       recvEvent = 0;
+    INT32       sendBuffSize = 0;
+    INT32       pendingLen = 0;
+    socklen_t   optLen = sizeof(sendBuffSize);
+
+    if (SUCCESS != GetSocketPollEvent(connFd, POLLOUT, 0, &recvEvent))
+    {
+        return FALSE;
+    }
+
+    /* Error on socket is reported as ready to let send detect it without waiting */
+    if (recvEvent & (POLLERR | POLLHUP))
+    {
+        return TRUE;
+    }
+
+    if ((recvEvent & POLLOUT) == 0)
+    {
+        return FALSE;
+    }
+
+    if ((getsockopt(connFd, SOL_SOCKET, SO_SNDBUF, &sendBuffSize, &optLen) != STATUS_OK) || (ioctl(connFd, SIOCOUTQ, &pendingLen) != STATUS_OK))
+    {
+        /* Fallback on write event if socket queue info is not available */
+        return TRUE;
+    }
+
+    return (pendingLen < (sendBuffSize / 2)) ? TRUE : FALSE;
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   This function received data from TCP socket and gives into output parameter
@@ -16,6 +16,7 @@ extern "C" {
 //#################################################################################################
 /* OS Includes */
 #include <poll.h>
+#include <sys/uio.h>
 
 /* Application Includes */
 #include "Config.h"
@@ -39,6 +40,10 @@ INT32 SendToClient(INT32 connFd, UINT8 *pSendBuff, UINT32 buffLen, UINT32 timeou
 //-------------------------------------------------------------------------------------------------
 BOOL SendToSocket(INT32 connFd, UINT8 *pSendBuff, UINT32 buffLen, UINT32 timeoutSec);
 //-------------------------------------------------------------------------------------------------
+BOOL SendIovToSocket(INT32 connFd, struct iovec *pIov, UINT8 iovCnt, UINT32 timeoutSec);
+//-------------------------------------------------------------------------------------------------
+BOOL IsSocketSendReady(INT32 connFd, UINT32 sendLen);
+//-------------------------------------------------------------------------------------------------
 UINT8 RecvMessage(INT32 connFd, CHARPTR rcvMsg, UINT32PTR rcvLen, UINT8 startOfData, UINT8 endOfData, UINT32 maxData, UINT32 timeoutSec);
 //-------------------------------------------------------------------------------------------------
 BOOL RecvFrame(INT32 connFd, CHARPTR rcvMsg, UINT32PTR rcvLen,UINT32 maxData, UINT32 timeoutSec, UINT32 timeoutUs);
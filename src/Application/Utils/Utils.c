@@ -9,6 +9,7 @@
 // @INCLUDES
 //#################################################################################################
 /* OS Includes */
+#include <ctype.h>
 #include <signal.h>
 #include <netdb.h>
 #include <dirent.h>
@@ -87,6 +88,7 @@
 #define PROC_UPTIME_FILE 			"/proc/uptime"
 
 #define ALPHA_NUM_STR_LEN_MAX       63
+#define PARSE_STR_VAL_LEN_MAX       255
 #define CHAR64(c)                   (((c) < 0 || (c) > 127) ? -1 : index_64[(c)])
 
 //#################################################################################################
@@ -2133,6 +2135,124 @@ UINT8 ConvertStringToIndex(CHARPTR strPtr, const CHARPTR *strBuffPtr, UINT8 maxI
     return index;
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function gives case insensitive hash of string for string index table
+ * @param   strPtr - string
+ * @return  hash of string
+ */
+static UINT32 getStrIndexHash(const CHAR *strPtr)
+{
+    UINT32 hash = 2166136261U;
+
+    /* FNV-1a hash of lower case string */
+    while (*strPtr != '\0')
+    {
+        hash ^= (UINT8)tolower((UINT8)*strPtr);
+        hash *= 16777619U;
+        strPtr++;
+    }
+
+    return hash;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function builds hash table of string table of string index table to find index of string
+ *          without comparing it with all strings. Index of first string is kept if string is repeated in table.
+ * @param   pIndexTbl - string index table defined with STR_INDEX_TABLE_INIT()
+ * @return  SUCCESS/FAIL
+ * @note    String lookup is done by linear search till table is built
+ */
+BOOL InitStrIndexTable(STR_INDEX_TABLE_t *pIndexTbl)
+{
+    UINT8           index;
+    UINT8           maxIndex = pIndexTbl->maxIndex;
+    UINT16          bucketCnt = 8;
+    UINT16          bucketIdx;
+    UINT8PTR        pBucket;
+    const CHARPTR   *strBuffPtr = pIndexTbl->pStrTbl;
+
+    if (pIndexTbl->pBucket != NULL)
+    {
+        /* Table is already built */
+        return SUCCESS;
+    }
+
+    /* Keep table at most half filled for short probe */
+    while (bucketCnt < ((UINT16)maxIndex * 2))
+    {
+        bucketCnt <<= 1;
+    }
+
+    /* Empty bucket has invalid index */
+    pBucket = malloc(bucketCnt);
+    if (pBucket == NULL)
+    {
+        EPRINT(UTILS, "fail to alloc string index table: [maxIndex=%d]", maxIndex);
+        return FAIL;
+    }
+    memset(pBucket, UINT8_MAX, bucketCnt);
+
+    for (index = 0; index < maxIndex; index++)
+    {
+        bucketIdx = getStrIndexHash(strBuffPtr[index]) & (bucketCnt - 1);
+        while (pBucket[bucketIdx] != UINT8_MAX)
+        {
+            /* Repeated string resolves to its first index */
+            if (strcasecmp(strBuffPtr[index], strBuffPtr[pBucket[bucketIdx]]) == 0)
+            {
+                break;
+            }
+            bucketIdx = (bucketIdx + 1) & (bucketCnt - 1);
+        }
+
+        if (pBucket[bucketIdx] == UINT8_MAX)
+        {
+            pBucket[bucketIdx] = index;
+        }
+    }
+
+    pIndexTbl->bucketMask = bucketCnt - 1;
+
+    /* Table must be visible completely before it is used */
+    __sync_synchronize();
+    pIndexTbl->pBucket = pBucket;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   This function gives index of string from string index table. It gives same index as
+ *          ConvertStringToIndex() for same string table.
+ * @param   pIndexTbl - string index table
+ * @param   strPtr - string ptr which is to be find in table
+ * @return  index of match string from string table, max index if not found
+ */
+UINT8 FindStrIndex(STR_INDEX_TABLE_t *pIndexTbl, CHARPTR strPtr)
+{
+    UINT16      bucketIdx;
+    UINT8PTR    pBucket = pIndexTbl->pBucket;
+
+    if (pBucket == NULL)
+    {
+        /* Table is not built */
+        return ConvertStringToIndex(strPtr, pIndexTbl->pStrTbl, pIndexTbl->maxIndex);
+    }
+
+    bucketIdx = getStrIndexHash(strPtr) & pIndexTbl->bucketMask;
+    while (pBucket[bucketIdx] != UINT8_MAX)
+    {
+        if (strcasecmp(strPtr, pIndexTbl->pStrTbl[pBucket[bucketIdx]]) == 0)
+        {
+            return pBucket[bucketIdx];
+        }
+        bucketIdx = (bucketIdx + 1) & pIndexTbl->bucketMask;
+    }
+
+    return pIndexTbl->maxIndex;
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   This function will parse string from source buffer at current pointer till FSP and copy
@@ -2248,23 +2368,32 @@ BOOL AsciiToInt(CHARPTR ascii, UINT64PTR integer)
  * @param   maxCmdArg
  * @param   seperator
  * @return  Returns SUCCESS/FAIL
+ * @note    Digits of argument are converted while it is scanned for seperator, hence argument is not
+ *          copied. Argument has same limit of length as it had when it was parsed by ParseStr().
  */
 BOOL ParseStringGetVal(CHARPTR *commandStrPtr, UINT64PTR tempDataPtr, UINT8 maxCmdArg, UINT8 seperator)
 {
     UINT8   tempArg;
-    CHAR    commandArg[255];
+    UINT32  argLen;
+    CHARPTR pArg;
 
     for(tempArg = 0; tempArg < maxCmdArg; tempArg++)
     {
-        if(ParseStr(commandStrPtr, seperator, commandArg, 255) == FAIL)
+        pArg = *commandStrPtr;
+        tempDataPtr[tempArg] = 0;
+        for(argLen = 0; pArg[argLen] != (CHAR)seperator; argLen++)
         {
-            return FAIL;
-        }
+            // Non digit or too long argument ends parsing
+            if((pArg[argLen] < '0') || (pArg[argLen] > '9') || (argLen >= (PARSE_STR_VAL_LEN_MAX - 1)))
+            {
+                tempDataPtr[tempArg] = 0;
+                return FAIL;
+            }
 
-        if(AsciiToInt(commandArg, &tempDataPtr[tempArg]) == FAIL)
-        {
-            return FAIL;
+            tempDataPtr[tempArg] = (tempDataPtr[tempArg] * 10) + (pArg[argLen] - '0');
         }
+
+        *commandStrPtr += (argLen + 1);
     }
 
     return SUCCESS;
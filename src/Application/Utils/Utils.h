@@ -59,6 +59,9 @@
 
 #define SOCK_ADDR_SIZE(s)               ((s.sockAddr.sa_family == AF_INET) ? sizeof(struct sockaddr_in) : sizeof(struct sockaddr_in6))
 
+/* String index table of given string table. Hash table is built by InitStrIndexTable() */
+#define STR_INDEX_TABLE_INIT(strTbl, maxIdx)    {(strTbl), (maxIdx), 0, NULL}
+
 //#################################################################################################
 // @DATA_TYPES
 //#################################################################################################
@@ -96,6 +99,15 @@ typedef struct
     CHAR 	cmdData[SYS_CMD_MSG_LEN_MAX];
 }SYS_CMD_MSG_INFO_t;
 
+/* Hash table to find index of string in string table (e.g. message headers and commands) */
+typedef struct
+{
+    const CHARPTR   *pStrTbl;
+    UINT8           maxIndex;
+    UINT16          bucketMask;
+    UINT8PTR        pBucket;
+}STR_INDEX_TABLE_t;
+
 //-------------------------------------------------------------------------------------------------
 typedef BOOL (*COPY_ABORT_CB)(UINT32 userData);
 //-------------------------------------------------------------------------------------------------
@@ -187,6 +199,10 @@ BOOL ValidateIpSubnetWithLan1(CHARPTR startIp, CHARPTR endIp);
 //-------------------------------------------------------------------------------------------------
 UINT8 ConvertStringToIndex(CHARPTR strPtr, const CHARPTR *strBuffPtr, UINT8 maxIndex);
 //-------------------------------------------------------------------------------------------------
+BOOL InitStrIndexTable(STR_INDEX_TABLE_t *pIndexTbl);
+//-------------------------------------------------------------------------------------------------
+UINT8 FindStrIndex(STR_INDEX_TABLE_t *pIndexTbl, CHARPTR strPtr);
+//-------------------------------------------------------------------------------------------------
 BOOL ParseStr(CHARPTR *src, UINT8 delim, CHARPTR dest, UINT16 maxDestSize);
 //-------------------------------------------------------------------------------------------------
 BOOL ParseNStr(CHARPTR *src, UINT8 delim, CHARPTR dest, UINT16 maxDestSize);
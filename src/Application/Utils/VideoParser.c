@@ -8,6 +8,13 @@
 //#################################################################################################
 // @INCLUDES
 //#################################################################################################
+/* OS Includes */
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 /* Application Includes */
 #include "DebugLog.h"
 #include "VideoParser.h"
@@ -45,7 +52,8 @@ typedef struct
 	UINT8PTR 	start;
 	UINT8PTR 	priv;
 	UINT8PTR 	end;
-	UINT32	 	bitsLeft;
+    UINT64      cache;          /* Bits loaded from stream, next bit is MSB */
+    UINT32      cacheBits;      /* Number of valid bits in cache */
     BOOL        isEpbIdEnabled; /* Emulation prevention byte identification status (Enable or Disable) */
     UINT8	 	epbIdCnt;       /* EPB is start code sequence breaker byte for NAL header data */
 
@@ -260,12 +268,6 @@ typedef struct
 
 }VIDEO_OBJET_LAYER_t;
 
-//#################################################################################################
-// @STATIC VARIABLES
-//#################################################################################################
-static const UINT8 h264_h265_StartCode[H264_H265_START_CODE_LEN] = {0x00, 0x00, 0x00, 0x01};
-static const UINT8 mpeg4StartCode[MPEG4_START_CODE_LEN] = {0x00, 0x00, 0x01};
-
 //#################################################################################################
 // @PROTOTYPES
 //#################################################################################################
@@ -278,10 +280,18 @@ static void readScalingList(BIT_STREAM_t *bs, INT32PTR scalingList, UINT32 sizeO
 //-------------------------------------------------------------------------------------------------
 static INT32 bsReadSe(BIT_STREAM_t *bs);
 //-------------------------------------------------------------------------------------------------
+static UINT32 findStartCode(const UINT8 *buf, UINT32 pos, UINT32 size, UINT32 startCodeLen);
+//-------------------------------------------------------------------------------------------------
+static BOOL isStartCodeAt(const UINT8 *buf, UINT32 endPos, UINT32 startCodeLen);
+//-------------------------------------------------------------------------------------------------
 static void bsInit(BIT_STREAM_t *bs, UINT8PTR buf, UINT32 size, BOOL isEpbIdEnabled);
 //-------------------------------------------------------------------------------------------------
+static void bsRefill(BIT_STREAM_t *bs);
+//-------------------------------------------------------------------------------------------------
 static UINT32 bsReadU(BIT_STREAM_t *bs, INT32 n);
 //-------------------------------------------------------------------------------------------------
+static void bsSkipU(BIT_STREAM_t *bs, UINT32 n);
+//-------------------------------------------------------------------------------------------------
 static BOOL bsEof(BIT_STREAM_t *bs);
 //-------------------------------------------------------------------------------------------------
 static UINT32 bsReadU1(BIT_STREAM_t *bs);
@@ -399,12 +409,11 @@ BOOL GetH264Info(UINT8PTR frameBuf, UINT32 frameSize, VIDEO_INFO_t *videoInfo, U
 
     while((count + H264_H265_START_CODE_LEN) < frameSize)
     {
-        /* Check for H264 start code pattern */
-        if ((frameBuf[count] != h264_h265_StartCode[0]) || (frameBuf[count+1] != h264_h265_StartCode[1]) ||
-                (frameBuf[count+2] != h264_h265_StartCode[2]) || (frameBuf[count+3] != h264_h265_StartCode[3]))
+        /* Find next H264 start code pattern */
+        count = findStartCode(frameBuf, count, frameSize, H264_H265_START_CODE_LEN);
+        if (count >= frameSize)
         {
-            count++;
-            continue;
+            break;
         }
 
         /* Skip start code */
@@ -506,12 +515,11 @@ BOOL GetH265Info(UINT8PTR frameBuf, UINT32 frameSize, VIDEO_INFO_t *videoInfo, U
      * NALU TYPE    : VPS:32, SPS:33, PPP:34, P:01, I:19, SEI:39 (Ref H265 RFC for more info,rfc7798) */
     while ((count + H264_H265_START_CODE_LEN) < frameSize)
     {
-        /* Check for H265 start code pattern */
-        if ((frameBuf[count] != h264_h265_StartCode[0]) || (frameBuf[count+1] != h264_h265_StartCode[1]) ||
-                (frameBuf[count+2] != h264_h265_StartCode[2]) || (frameBuf[count+3] != h264_h265_StartCode[3]))
+        /* Find next H265 start code pattern */
+        count = findStartCode(frameBuf, count, frameSize, H264_H265_START_CODE_LEN);
+        if (count >= frameSize)
         {
-            count++;
-            continue;
+            break;
         }
 
         /* Skip start code */
@@ -612,10 +620,10 @@ BOOL GetMpeg4Info(UINT8PTR frameBuf, UINT32 frameSize, VIDEO_INFO_t *videoInfo,
 
     while ((count + MPEG4_START_CODE_LEN) < frameSize)
     {
-        if ((frameBuf[count] != mpeg4StartCode[0]) || (frameBuf[count+1] != mpeg4StartCode[1]) || (frameBuf[count+2] != mpeg4StartCode[2]))
+        count = findStartCode(frameBuf, count, frameSize, MPEG4_START_CODE_LEN);
+        if (count >= frameSize)
         {
-            count++;
-            continue;
+            break;
         }
 
         count += MPEG4_START_CODE_LEN;
@@ -650,6 +658,115 @@ BOOL GetMpeg4Info(UINT8PTR frameBuf, UINT32 frameSize, VIDEO_INFO_t *videoInfo,
 	return retVal;
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Find start code in bit stream. Start code ends with 0x01 byte which is rare in coded
+ *          data, hence 0x01 is searched in vector of bytes and preceding zero bytes are verified
+ *          only for the matched positions.
+ * @param   buf
+ * @param   pos - Position from where search starts
+ * @param   size - Size of buffer
+ * @param   startCodeLen - Start code length with trailing 0x01 byte (3 or 4)
+ * @return  Position of start code or size if start code not found
+ * @note    Start code is accepted only if at least one byte is present after it
+ */
+static UINT32 findStartCode(const UINT8 *buf, UINT32 pos, UINT32 size, UINT32 startCodeLen)
+{
+    UINT32 idx = pos + startCodeLen - 1;
+    UINT32 limit = size - 1;
+
+    if ((pos + startCodeLen) >= size)
+    {
+        return size;
+    }
+
+#if defined(__SSE2__)
+    const __m128i startCodeEnd = _mm_set1_epi8(0x01);
+    UINT32 matchMask;
+
+    while ((idx + 16) <= limit)
+    {
+        matchMask = (UINT32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(buf + idx)), startCodeEnd));
+        while (matchMask != 0)
+        {
+            if (TRUE == isStartCodeAt(buf, idx + (UINT32)__builtin_ctz(matchMask), startCodeLen))
+            {
+                return (idx + (UINT32)__builtin_ctz(matchMask) - (startCodeLen - 1));
+            }
+            matchMask &= (matchMask - 1);
+        }
+        idx += 16;
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    const uint8x16_t startCodeEnd = vdupq_n_u8(0x01);
+    uint64x2_t matchVect;
+    UINT32 byteIdx;
+
+    while ((idx + 16) <= limit)
+    {
+        matchVect = vreinterpretq_u64_u8(vceqq_u8(vld1q_u8(buf + idx), startCodeEnd));
+        if ((vgetq_lane_u64(matchVect, 0) | vgetq_lane_u64(matchVect, 1)) != 0)
+        {
+            for (byteIdx = idx; byteIdx < (idx + 16); byteIdx++)
+            {
+                if ((buf[byteIdx] == 0x01) && (TRUE == isStartCodeAt(buf, byteIdx, startCodeLen)))
+                {
+                    return (byteIdx - (startCodeLen - 1));
+                }
+            }
+        }
+        idx += 16;
+    }
+#else
+    UINT64 word;
+
+    /* Check 8 bytes at a time for 0x01 byte */
+    while ((idx + 8) <= limit)
+    {
+        memcpy(&word, buf + idx, sizeof(word));
+        word ^= 0x0101010101010101ULL;
+        if (((word - 0x0101010101010101ULL) & ~word & 0x8080808080808080ULL) != 0)
+        {
+            break;
+        }
+        idx += 8;
+    }
+#endif
+
+    for (; idx < limit; idx++)
+    {
+        if ((buf[idx] == 0x01) && (TRUE == isStartCodeAt(buf, idx, startCodeLen)))
+        {
+            return (idx - (startCodeLen - 1));
+        }
+    }
+
+    return size;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check zero bytes of start code before 0x01 byte
+ * @param   buf
+ * @param   endPos - Position of 0x01 byte
+ * @param   startCodeLen
+ * @return  TRUE if start code present else FALSE
+ */
+static BOOL isStartCodeAt(const UINT8 *buf, UINT32 endPos, UINT32 startCodeLen)
+{
+    if ((buf[endPos - 1] != 0x00) || (buf[endPos - 2] != 0x00))
+    {
+        return FALSE;
+    }
+
+    if ((startCodeLen == H264_H265_START_CODE_LEN) && (buf[endPos - 3] != 0x00))
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   Initialise bit-stream data structure it input frame and frame size
@@ -664,14 +781,76 @@ static void bsInit(BIT_STREAM_t *bs, UINT8PTR buf, UINT32 size, BOOL isEpbIdEnab
     bs->start = buf;
     bs->priv = buf;
     bs->end = buf + size;
-    bs->bitsLeft = 8;
+    bs->cache = 0;
+    bs->cacheBits = 0;
     bs->isEpbIdEnabled = isEpbIdEnabled;
     bs->epbIdCnt = 0;
+    bsRefill(bs);
+}
 
-    /* Confirm whether 1st byte is 0 or not */
-    if ((TRUE == bs->isEpbIdEnabled) && (bs->priv[0] == 0x00))
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Load bytes from bit stream in cache till cache is full or stream ends. Eight bytes are
+ *          loaded in one go when they don't need EPB check, otherwise byte by byte.
+ * @param   bs
+ */
+static void bsRefill(BIT_STREAM_t *bs)
+{
+    UINT64 word;
+    UINT32 byteCnt;
+    UINT8  byte;
+
+    while ((bs->cacheBits <= 56) && (bs->priv < bs->end))
     {
-        bs->epbIdCnt++;
+        if ((bs->end - bs->priv) >= 8)
+        {
+            memcpy(&word, bs->priv, sizeof(word));
+
+            /* Without EPB check or when no zero byte is there, EPB can't be present in these bytes */
+            if ((FALSE == bs->isEpbIdEnabled) || ((bs->epbIdCnt < 2)
+                    && (((word - 0x0101010101010101ULL) & ~word & 0x8080808080808080ULL) == 0)))
+            {
+                #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+                word = __builtin_bswap64(word);
+                #endif
+                byteCnt = (64 - bs->cacheBits) >> 3;
+                bs->cache |= (word >> bs->cacheBits);
+                bs->cacheBits += (byteCnt << 3);
+                if (bs->cacheBits < 64)
+                {
+                    /* Remove bits of partially loaded byte */
+                    bs->cache &= ~(~0ULL >> bs->cacheBits);
+                }
+                bs->priv += byteCnt;
+                if (TRUE == bs->isEpbIdEnabled)
+                {
+                    bs->epbIdCnt = 0;
+                }
+                continue;
+            }
+        }
+
+        byte = *bs->priv++;
+        if (TRUE == bs->isEpbIdEnabled)
+        {
+            if (bs->epbIdCnt >= 2)
+            {
+                /* Reset EPB identifier and skip EPB after 2 consecutive 0x00 bytes */
+                bs->epbIdCnt = 0;
+                if (byte == EMULATION_PREVENTION_BYTE)
+                {
+                    continue;
+                }
+            }
+            else
+            {
+                /* Wait for EPB on 0x00 byte */
+                bs->epbIdCnt = (byte == 0x00) ? (bs->epbIdCnt + 1) : 0;
+            }
+        }
+
+        bs->cache |= ((UINT64)byte << (56 - bs->cacheBits));
+        bs->cacheBits += 8;
     }
 }
 
@@ -679,22 +858,47 @@ static void bsInit(BIT_STREAM_t *bs, UINT8PTR buf, UINT32 size, BOOL isEpbIdEnab
 /**
  * @brief   Gives no of bit as an integer form from current position of bit stream
  * @param   bs
- * @param   n
+ * @param   n - Number of bits (max 32)
  * @return  Unsigned integer
+ * @note    Zero bits are given after end of stream
  */
 static UINT32 bsReadU(BIT_STREAM_t *bs, INT32 n)
 {
-	UINT32 	retVal = 0;
-    INT32 	cnt;
+    UINT32 retVal;
 
-    for (cnt = 0; cnt < n; cnt++)
+    if (n <= 0)
     {
-        retVal |= (bsReadU1(bs) << (n - cnt - 1));
+        return 0;
     }
 
+    if (bs->cacheBits < (UINT32)n)
+    {
+        bsRefill(bs);
+    }
+
+    retVal = (UINT32)(bs->cache >> (64 - n));
+    bs->cache = (n < 64) ? (bs->cache << n) : 0;
+    bs->cacheBits = (bs->cacheBits > (UINT32)n) ? (bs->cacheBits - n) : 0;
     return retVal;
 }
 
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Skip bits from current position of bit stream
+ * @param   bs
+ * @param   n
+ */
+static void bsSkipU(BIT_STREAM_t *bs, UINT32 n)
+{
+    while (n > 32)
+    {
+        bsReadU(bs, 32);
+        n -= 32;
+    }
+
+    bsReadU(bs, n);
+}
+
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   Gives indication of end of stream.
@@ -703,7 +907,7 @@ static UINT32 bsReadU(BIT_STREAM_t *bs, INT32 n)
  */
 static BOOL bsEof(BIT_STREAM_t *bs)
 {
-    if (bs->priv >= bs->end)
+    if ((bs->cacheBits == 0) && (bs->priv >= bs->end))
 	{
         return TRUE;
 	}
@@ -721,61 +925,7 @@ static BOOL bsEof(BIT_STREAM_t *bs)
  */
 static UINT32 bsReadU1(BIT_STREAM_t *bs)
 {
-    UINT32 retVal = 0;
-
-    if (bsEof(bs) == TRUE)
-    {
-        return retVal;
-    }
-
-    bs->bitsLeft--;
-    retVal = (((*(bs->priv)) >> bs->bitsLeft) & 0x01);
-    if (bs->bitsLeft)
-    {
-        return retVal;
-    }
-
-    bs->priv++;
-    bs->bitsLeft = 8;
-
-    /* Check EPB enabled or not */
-    if (FALSE == bs->isEpbIdEnabled)
-    {
-        return retVal;
-    }
-
-    /* Check 2 consecutive 0x00 found?? */
-    if (bs->epbIdCnt >= 2)
-    {
-        /* Reset EPB identifier */
-        bs->epbIdCnt = 0;
-
-        /* If next byte is EPB then skip it */
-        if (bs->priv[0] == EMULATION_PREVENTION_BYTE)
-        {
-            /* Skip EPB */
-            bs->priv++;
-
-            /* Is there 0 after EPB */
-            if (bs->priv[0] == 0x00)
-            {
-                /* Reset EPB identifier */
-                bs->epbIdCnt++;
-            }
-        }
-    }
-    else if (bs->priv[0] == 0x00)
-    {
-        /* Wait for EPB */
-        bs->epbIdCnt++;
-    }
-    else
-    {
-        /* Reset EPB identifier */
-        bs->epbIdCnt = 0;
-    }
-
-    return retVal;
+    return bsReadU(bs, 1);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -792,17 +942,41 @@ static UINT32 bsReadU8(BIT_STREAM_t	*bs)
 //-------------------------------------------------------------------------------------------------
 /**
  * @brief   Gives unsigned integer value as per exp. glombo method from current bit stream position.
+ *          Leading zero bits are counted from cache in one go.
  * @param   bs
  * @return  Unsigned integer as per exp.
  */
 static UINT32 bsReadUe(BIT_STREAM_t *bs)
 {
     INT32  	retVal;
-	INT32	cnt = 0;
+	INT32	cnt;
+
+    if (bs->cacheBits < 33)
+    {
+        bsRefill(bs);
+    }
 
-    while(bsReadU1(bs) == 0 && cnt < 32 && (bsEof(bs) == FALSE))
+    if (bs->cacheBits == 0)
+    {
+        return 0;
+    }
+
+    /* Count leading zero bits, max 32 */
+    cnt = (bs->cache == 0) ? 64 : __builtin_clzll(bs->cache);
+    if ((cnt > 32) && (bs->cacheBits > 32))
+    {
+        cnt = 32;
+        bsSkipU(bs, cnt + 1);
+    }
+    else if ((UINT32)cnt >= bs->cacheBits)
+    {
+        /* Stream ended before 1 bit, last zero bit is not counted */
+        cnt = bs->cacheBits - 1;
+        bsSkipU(bs, bs->cacheBits);
+    }
+    else
     {
-        cnt++;
+        bsSkipU(bs, cnt + 1);
     }
 
     retVal = bsReadU(bs, cnt);
@@ -844,7 +1018,7 @@ static void h265DecodeProfileTierLevel(BIT_STREAM_t *bs, PTL_COMMON_t *ptl)
     /* Skip 32: general_profile_compatibility_flag (32bit) */
     /* Skip 4: progressive_source_flag (1bit), interlaced_source_flag (1bit), non_packed_constraint_flag (1bit), frame_only_constraint_flag (1bit) */
     /* Skip 44: max_12bit_constraint_flag to inbld_flag (43bit + 1bit) */
-    bsReadU(bs, 88);
+    bsSkipU(bs, 88);
 
     /* Avoid compilation warning */
     (void)ptl;
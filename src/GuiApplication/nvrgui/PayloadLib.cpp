@@ -111,73 +111,122 @@ QString PayloadLib :: createDevCnfgPayload(REQ_MSG_ID_e requestType,
 
 void PayloadLib::parsePayload(REQ_MSG_ID_e requestType, QString devPayload)
 {
-    QStringList recordsRowList;
-    QStringList recordColList;
-    QStringList recordList;
-    QString oneRecordRow, oneRecordCol;
-    qint32 colIndex, rowIndex, arrayIndex;
+    const QChar *payload = devPayload.constData();
+    qint32 payloadLen = devPayload.length();
+    qint32 tableStart, tableEnd, bodyStart, recordStart, recordEnd, fieldStart, fieldEnd, valueStart, valueEnd;
+    qint32 tableIndex, totalRecords, totalCols, arrayIndex;
+    bool overflowF = false;
+    const QVariant emptyValue = QString("");
+
     for(arrayIndex = 0; arrayIndex < CNFG_ARRAY_SIZE ; arrayIndex++)
     {
-        cnfgArray.replace(arrayIndex, "");
+        cnfgArray.replace(arrayIndex, emptyValue);
     }
     arrayIndex = 0;
+    m_totalTable = 0;
 
-    QString regularExpressionStringTable = "";
-    regularExpressionStringTable.append('[');
-    regularExpressionStringTable.append(SOT);
-    regularExpressionStringTable.append(EOT);
-    regularExpressionStringTable.append(']');
-    QRegExp regExpForTable(regularExpressionStringTable);
-
-    QString regularExpressionStringRecord = "";
-    regularExpressionStringRecord.append('[');
-    regularExpressionStringRecord.append(SOI);
-    regularExpressionStringRecord.append(EOI);
-    regularExpressionStringRecord.append(']');
-    QRegExp regExpForRecord(regularExpressionStringRecord);
-
-    QString regularExpressionStringField = "";
-    regularExpressionStringField.append('[');
-    regularExpressionStringField.append(FSP);
-    regularExpressionStringField.append(']');
-    QRegExp regExpForField(regularExpressionStringField);
-
-    QString regularExpressionStringFieldValue = "";
-    regularExpressionStringFieldValue.append('[');
-    regularExpressionStringFieldValue.append(FVS);
-    regularExpressionStringFieldValue.append(']');
-    QRegExp regExpForFieldValue(regularExpressionStringFieldValue);
+    memset (&m_configTableIndex,0,sizeof(m_configTableIndex));
 
+    /* Payload is scanned only once. Tables, records and fields are taken between their separators
+     * in place of splitting payload in string lists. Empty tables, records and fields are skipped. */
+    for(tableEnd = 0; tableEnd < payloadLen; tableEnd++)
+    {
+        tableStart = tableEnd;
+        while((tableEnd < payloadLen) && (payload[tableEnd] != QChar(SOT)) && (payload[tableEnd] != QChar(EOT)))
+        {
+            tableEnd++;
+        }
 
-    QStringList devicePayloadList = devPayload.split(regExpForTable, QString::SkipEmptyParts);
-    m_totalTable = devicePayloadList.length();
+        if(tableEnd == tableStart)
+        {
+            continue;
+        }
 
-    memset (&m_configTableIndex,0,sizeof(m_configTableIndex));
+        tableIndex = m_totalTable++;
+        totalRecords = 0;
+        totalCols = 0;
 
-    for(qint32 tableIndex = 0; tableIndex < m_totalTable; tableIndex++)
-    {
-        QString devicePayload = devicePayloadList.at(tableIndex);
         switch(requestType)
         {
         case MSG_GET_CFG :
-            m_configTableIndex[tableIndex] = devicePayload.mid(0, devicePayload.indexOf(QChar(FSP))).toInt();
-            devicePayload = devicePayload.mid((devicePayload.indexOf(QChar(FSP)) + 1));
-            recordsRowList = devicePayload.split(regExpForRecord, QString::SkipEmptyParts);
-            for(rowIndex = 0; rowIndex < recordsRowList.size(); rowIndex++)
+            // Table id is till first field separator. Whole table is taken as records when it is not present
+            bodyStart = tableStart;
+            while((bodyStart < tableEnd) && (payload[bodyStart] != QChar(FSP)))
             {
-                oneRecordRow = recordsRowList.at(rowIndex);
-                recordColList = oneRecordRow.split(regExpForField, QString::SkipEmptyParts);
-                recordColList.removeFirst();
-                for(colIndex = 0; colIndex < recordColList.size(); colIndex++)
+                bodyStart++;
+            }
+
+            if(tableIndex < MAX_TABLE)
+            {
+                m_configTableIndex[tableIndex] = devPayload.midRef(tableStart, (bodyStart - tableStart)).toInt();
+            }
+            bodyStart = (bodyStart < tableEnd) ? (bodyStart + 1) : tableStart;
+
+            for(recordEnd = bodyStart; recordEnd < tableEnd; recordEnd++)
+            {
+                recordStart = recordEnd;
+                while((recordEnd < tableEnd) && (payload[recordEnd] != QChar(SOI)) && (payload[recordEnd] != QChar(EOI)))
                 {
-                    oneRecordCol = recordColList.at(colIndex);
-                    recordList = oneRecordCol.split(regExpForFieldValue, QString::KeepEmptyParts);
+                    recordEnd++;
+                }
+
+                if(recordEnd == recordStart)
+                {
+                    continue;
+                }
+
+                // First field of record is its index
+                totalRecords++;
+                totalCols = -1;
+                for(fieldEnd = recordStart; fieldEnd < recordEnd; fieldEnd++)
+                {
+                    fieldStart = fieldEnd;
+                    while((fieldEnd < recordEnd) && (payload[fieldEnd] != QChar(FSP)))
+                    {
+                        fieldEnd++;
+                    }
+
+                    if(fieldEnd == fieldStart)
+                    {
+                        continue;
+                    }
+
+                    if(totalCols++ < 0)
+                    {
+                        continue;
+                    }
+
                     if(arrayIndex >= CNFG_ARRAY_SIZE)
                     {
-                        EPRINT(GUI_SYS,"ERROR: Parsing Failed,Buffer limit reached [Max=%d]",CNFG_ARRAY_SIZE);
-                        break;
+                        overflowF = true;
+                        continue;
+                    }
+
+                    // Value is after field id till next field value separator
+                    valueStart = fieldStart;
+                    while((valueStart < fieldEnd) && (payload[valueStart] != QChar(FVS)))
+                    {
+                        valueStart++;
+                    }
+
+                    if(valueStart == fieldEnd)
+                    {
+                        arrayIndex++;
+                        continue;
                     }
-                    cnfgArray.replace(arrayIndex++, recordList.at(1));
+
+                    valueStart++;
+                    valueEnd = valueStart;
+                    while((valueEnd < fieldEnd) && (payload[valueEnd] != QChar(FVS)))
+                    {
+                        valueEnd++;
+                    }
+                    cnfgArray.replace(arrayIndex++, devPayload.mid(valueStart, (valueEnd - valueStart)));
+                }
+
+                if(totalCols < 0)
+                {
+                    totalCols = 0;
                 }
             }
             break;
@@ -185,54 +234,84 @@ void PayloadLib::parsePayload(REQ_MSG_ID_e requestType, QString devPayload)
         default:
             break;
         }
-        m_configRecordForTable[tableIndex] = recordsRowList.size() * recordColList.size();
-        recordsRowList.clear();
-        recordColList.clear();
+
+        if(tableIndex < MAX_TABLE)
+        {
+            m_configRecordForTable[tableIndex] = totalRecords * totalCols;
+        }
+    }
+
+    if(overflowF)
+    {
+        EPRINT(GUI_SYS,"ERROR: Parsing Failed,Buffer limit reached [Max=%d]",CNFG_ARRAY_SIZE);
     }
 }
 
 void PayloadLib :: parseDevCmdReply(bool hasIndex, QString devCmdReply)
 {
+    const QChar *reply = devCmdReply.constData();
+    qint32 replyLen = devCmdReply.length();
+    qint32 recordStart, recordEnd, fieldStart, fieldEnd;
+    qint32 index;
+    bool skipIndexF, overflowF = false;
+    const QVariant emptyValue = QString("");
+
     m_totalCmdFields = 0;
     m_totalReplyFields = 0;
-    QString regularExpressionStringRecord = "";
-    regularExpressionStringRecord.append('[');
-    regularExpressionStringRecord.append(SOI);
-    regularExpressionStringRecord.append(EOI);
-    regularExpressionStringRecord.append(']');
-    QRegExp regExpForRecord(regularExpressionStringRecord);
-
-    QString regularExpressionStringField = "";
-    regularExpressionStringField.append('[');
-    regularExpressionStringField.append(FSP);
-    regularExpressionStringField.append(']');
-    QRegExp regExpForField(regularExpressionStringField);
-
-    for(qint32 index = 0; index < CNFG_ARRAY_SIZE ; index++)
+
+    for(index = 0; index < CNFG_ARRAY_SIZE ; index++)
     {
-        cnfgArray.replace(index, "");
+        cnfgArray.replace(index, emptyValue);
     }
-    QStringList deviceReplyList = devCmdReply.split(regExpForRecord, QString::SkipEmptyParts);
-    for(qint32 recordIndex = 0; recordIndex < deviceReplyList.length(); recordIndex++)
+
+    /* Reply is scanned only once. Every field of record ends with field separator, hence text after
+     * last separator of record is not a field. Empty records are skipped but empty fields are kept. */
+    for(recordEnd = 0; recordEnd < replyLen; recordEnd++)
     {
-        QString devicePayload = deviceReplyList.at(recordIndex);
-        QStringList replyList = devicePayload.split(regExpForField, QString::KeepEmptyParts);
-        replyList.removeLast();
-        if(hasIndex)
+        recordStart = recordEnd;
+        while((recordEnd < replyLen) && (reply[recordEnd] != QChar(SOI)) && (reply[recordEnd] != QChar(EOI)))
         {
-            replyList.removeFirst();
+            recordEnd++;
         }
-        m_totalReplyFields = replyList.length();
-        for(qint32 feildIndex = 0; feildIndex < replyList.length(); feildIndex++)
+
+        if(recordEnd == recordStart)
         {
+            continue;
+        }
+
+        m_totalReplyFields = 0;
+        skipIndexF = hasIndex;
+        for(fieldStart = recordStart, fieldEnd = recordStart; fieldEnd < recordEnd; fieldEnd++)
+        {
+            if(reply[fieldEnd] != QChar(FSP))
+            {
+                continue;
+            }
+
+            if(skipIndexF)
+            {
+                skipIndexF = false;
+                fieldStart = fieldEnd + 1;
+                continue;
+            }
+
+            m_totalReplyFields++;
             if(m_totalCmdFields >= CNFG_ARRAY_SIZE)
             {
-                EPRINT(GUI_SYS,"ERROR: Parsing Failed,Buffer limit reached [Max=%d]",CNFG_ARRAY_SIZE);
-                break;
+                overflowF = true;
+            }
+            else
+            {
+                cnfgArray.replace(m_totalCmdFields++, devCmdReply.mid(fieldStart, (fieldEnd - fieldStart)));
             }
-            cnfgArray.replace(m_totalCmdFields++, replyList.at(feildIndex));
+            fieldStart = fieldEnd + 1;
         }
     }
+
+    if(overflowF)
+    {
+        EPRINT(GUI_SYS,"ERROR: Parsing Failed,Buffer limit reached [Max=%d]",CNFG_ARRAY_SIZE);
+    }
 }
 
 void PayloadLib :: setCnfgArrayAtIndex(qint32 index, QVariant value)
@@ -0,0 +1,599 @@
+#include "PayloadLibTest.h"
+#include <cerrno>
+
+#define RANDOM_PAYLOAD_CNT      500
+#define RANDOM_VALUE_LEN_MAX    12
+#define SEARCH_REPLY_ROW_CNT    10000
+#define SEARCH_REPLY_FIELD_CNT  9
+
+/* Allocator of glibc, which is called by allocation counting functions below */
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+extern "C" void *__libc_memalign(size_t alignment, size_t size);
+
+/* Count of heap allocations. Qt containers allocate with malloc and new of C++ calls malloc too, hence
+ * all allocations of parsers are counted by replacing malloc, calloc, realloc and aligned allocations of
+ * program. Aligned new of C++ and aligned data of Qt are allocated by aligned allocation functions. */
+static QAtomicInteger<quint64> allocationCnt;
+
+extern "C" void *malloc(size_t size)
+{
+    allocationCnt.fetchAndAddRelaxed(1);
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    allocationCnt.fetchAndAddRelaxed(1);
+    return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size)
+{
+    allocationCnt.fetchAndAddRelaxed(1);
+    return __libc_realloc(ptr, size);
+}
+
+extern "C" void *memalign(size_t alignment, size_t size)
+{
+    allocationCnt.fetchAndAddRelaxed(1);
+    return __libc_memalign(alignment, size);
+}
+
+extern "C" void *aligned_alloc(size_t alignment, size_t size)
+{
+    allocationCnt.fetchAndAddRelaxed(1);
+    return __libc_memalign(alignment, size);
+}
+
+extern "C" int posix_memalign(void **memptr, size_t alignment, size_t size)
+{
+    void *ptr;
+
+    /* Alignment must be power of two and multiple of pointer size */
+    if((alignment == 0) || ((alignment & (alignment - 1)) != 0) || ((alignment % sizeof(void *)) != 0))
+    {
+        return EINVAL;
+    }
+
+    allocationCnt.fetchAndAddRelaxed(1);
+    ptr = __libc_memalign(alignment, size);
+    if(ptr == NULL)
+    {
+        return ENOMEM;
+    }
+
+    *memptr = ptr;
+    return 0;
+}
+
+/* Characters which random value is made of */
+static const char randomValueChar[] = "abcXYZ0129 .:-_@/";
+
+SplitPayloadLib :: SplitPayloadLib()
+{
+    cnfgArray.reserve(CNFG_ARRAY_SIZE);
+    for(qint32 index = 0; index < CNFG_ARRAY_SIZE; index++)
+    {
+        cnfgArray.insert(index, 0);
+    }
+
+    for(qint8 index = 0; index < MAX_TABLE; index++)
+    {
+        m_configRecordForTable[index] = 0;
+        m_configTableIndex[index] = 0;
+    }
+    m_totalCmdFields = 0;
+    m_totalReplyFields = 0;
+    m_totalTable = 0;
+}
+
+void SplitPayloadLib::parsePayload(REQ_MSG_ID_e requestType, QString devPayload)
+{
+    QStringList recordsRowList;
+    QStringList recordColList;
+    QStringList recordList;
+    QString oneRecordRow, oneRecordCol;
+    qint32 colIndex, rowIndex, arrayIndex;
+    for(arrayIndex = 0; arrayIndex < CNFG_ARRAY_SIZE ; arrayIndex++)
+    {
+        cnfgArray.replace(arrayIndex, "");
+    }
+    arrayIndex = 0;
+
+    QString regularExpressionStringTable = "";
+    regularExpressionStringTable.append('[');
+    regularExpressionStringTable.append(SOT);
+    regularExpressionStringTable.append(EOT);
+    regularExpressionStringTable.append(']');
+    QRegExp regExpForTable(regularExpressionStringTable);
+
+    QString regularExpressionStringRecord = "";
+    regularExpressionStringRecord.append('[');
+    regularExpressionStringRecord.append(SOI);
+    regularExpressionStringRecord.append(EOI);
+    regularExpressionStringRecord.append(']');
+    QRegExp regExpForRecord(regularExpressionStringRecord);
+
+    QString regularExpressionStringField = "";
+    regularExpressionStringField.append('[');
+    regularExpressionStringField.append(FSP);
+    regularExpressionStringField.append(']');
+    QRegExp regExpForField(regularExpressionStringField);
+
+    QString regularExpressionStringFieldValue = "";
+    regularExpressionStringFieldValue.append('[');
+    regularExpressionStringFieldValue.append(FVS);
+    regularExpressionStringFieldValue.append(']');
+    QRegExp regExpForFieldValue(regularExpressionStringFieldValue);
+
+    QStringList devicePayloadList = devPayload.split(regExpForTable, QString::SkipEmptyParts);
+    m_totalTable = devicePayloadList.length();
+
+    memset (&m_configTableIndex,0,sizeof(m_configTableIndex));
+
+    for(qint32 tableIndex = 0; tableIndex < m_totalTable; tableIndex++)
+    {
+        QString devicePayload = devicePayloadList.at(tableIndex);
+        switch(requestType)
+        {
+        case MSG_GET_CFG :
+            m_configTableIndex[tableIndex] = devicePayload.mid(0, devicePayload.indexOf(QChar(FSP))).toInt();
+            devicePayload = devicePayload.mid((devicePayload.indexOf(QChar(FSP)) + 1));
+            recordsRowList = devicePayload.split(regExpForRecord, QString::SkipEmptyParts);
+            for(rowIndex = 0; rowIndex < recordsRowList.size(); rowIndex++)
+            {
+                oneRecordRow = recordsRowList.at(rowIndex);
+                recordColList = oneRecordRow.split(regExpForField, QString::SkipEmptyParts);
+                recordColList.removeFirst();
+                for(colIndex = 0; colIndex < recordColList.size(); colIndex++)
+                {
+                    oneRecordCol = recordColList.at(colIndex);
+                    recordList = oneRecordCol.split(regExpForFieldValue, QString::KeepEmptyParts);
+                    if(arrayIndex >= CNFG_ARRAY_SIZE)
+                    {
+                        break;
+                    }
+                    cnfgArray.replace(arrayIndex++, recordList.at(1));
+                }
+            }
+            break;
+
+        default:
+            break;
+        }
+        m_configRecordForTable[tableIndex] = recordsRowList.size() * recordColList.size();
+        recordsRowList.clear();
+        recordColList.clear();
+    }
+}
+
+void SplitPayloadLib :: parseDevCmdReply(bool hasIndex, QString devCmdReply)
+{
+    m_totalCmdFields = 0;
+    m_totalReplyFields = 0;
+    QString regularExpressionStringRecord = "";
+    regularExpressionStringRecord.append('[');
+    regularExpressionStringRecord.append(SOI);
+    regularExpressionStringRecord.append(EOI);
+    regularExpressionStringRecord.append(']');
+    QRegExp regExpForRecord(regularExpressionStringRecord);
+
+    QString regularExpressionStringField = "";
+    regularExpressionStringField.append('[');
+    regularExpressionStringField.append(FSP);
+    regularExpressionStringField.append(']');
+    QRegExp regExpForField(regularExpressionStringField);
+
+    for(qint32 index = 0; index < CNFG_ARRAY_SIZE ; index++)
+    {
+        cnfgArray.replace(index, "");
+    }
+    QStringList deviceReplyList = devCmdReply.split(regExpForRecord, QString::SkipEmptyParts);
+    for(qint32 recordIndex = 0; recordIndex < deviceReplyList.length(); recordIndex++)
+    {
+        QString devicePayload = deviceReplyList.at(recordIndex);
+        QStringList replyList = devicePayload.split(regExpForField, QString::KeepEmptyParts);
+        replyList.removeLast();
+        if(hasIndex)
+        {
+            replyList.removeFirst();
+        }
+        m_totalReplyFields = replyList.length();
+        for(qint32 feildIndex = 0; feildIndex < replyList.length(); feildIndex++)
+        {
+            if(m_totalCmdFields >= CNFG_ARRAY_SIZE)
+            {
+                break;
+            }
+            cnfgArray.replace(m_totalCmdFields++, replyList.at(feildIndex));
+        }
+    }
+}
+
+QVariant SplitPayloadLib :: getCnfgArrayAtIndex(qint32 index)
+{
+    return cnfgArray.at(index);
+}
+
+qint32 SplitPayloadLib :: getcnfgTableIndex(qint32 tableNumber)
+{
+    return m_configTableIndex[tableNumber];
+}
+
+qint32 SplitPayloadLib::getTotalCmdFields()
+{
+    return m_totalCmdFields;
+}
+
+qint32 SplitPayloadLib::getTotalReplyFields()
+{
+    return m_totalReplyFields;
+}
+
+qint32 SplitPayloadLib::getTotalConfigFieldOfTable(qint32 tableIndex)
+{
+    return m_configRecordForTable[tableIndex];
+}
+
+QString PayloadLibTest::makeRandomValue()
+{
+    QString value = "";
+    qint32 valueLen = m_random.bounded(RANDOM_VALUE_LEN_MAX + 1);
+
+    for(qint32 index = 0; index < valueLen; index++)
+    {
+        value.append(randomValueChar[m_random.bounded((qint32)(sizeof(randomValueChar) - 1))]);
+    }
+    return value;
+}
+
+/* Reply of get config is made of tables in SOT/EOT, records of table in SOI/EOI and fields of
+ * record as field id, FVS and value. First field of record is its index. Random reply has empty
+ * tables, empty records, empty fields and random values too. */
+QString PayloadLibTest::makeGetCfgReply(qint32 totalTable, qint32 totalRecord, qint32 totalField, bool randomF)
+{
+    QString payload = "";
+
+    for(qint32 tableIndex = 0; tableIndex < totalTable; tableIndex++)
+    {
+        if(randomF && (m_random.bounded(6) == 0))
+        {
+            payload.append(SOT);
+            payload.append(EOT);
+        }
+
+        payload.append(SOT);
+        payload.append(QString("%1").arg(m_random.bounded(1, 100)));
+        payload.append(FSP);
+        for(qint32 recordIndex = 0; recordIndex < totalRecord; recordIndex++)
+        {
+            if(randomF && (m_random.bounded(8) == 0))
+            {
+                payload.append(SOI);
+                payload.append(EOI);
+            }
+
+            payload.append(SOI);
+            payload.append(QString("%1").arg(recordIndex + 1));
+            payload.append(FSP);
+            for(qint32 fieldIndex = 0; fieldIndex < totalField; fieldIndex++)
+            {
+                payload.append(QString("%1").arg(fieldIndex + 1));
+                payload.append(FVS);
+                payload.append(randomF ? makeRandomValue() : QString("V%1").arg(fieldIndex));
+                payload.append(FSP);
+                if(randomF && (m_random.bounded(10) == 0))
+                {
+                    payload.append(FSP);
+                }
+            }
+            payload.append(EOI);
+        }
+        payload.append(EOT);
+    }
+    return payload;
+}
+
+/* Reply of device command is made of records in SOI/EOI and fields of record, which end with FSP.
+ * Random reply has text after last field of record, which is not a field. */
+QString PayloadLibTest::makeDevCmdReply(bool hasIndex, qint32 totalRecord, qint32 totalField, bool randomF)
+{
+    QString payload = "";
+
+    for(qint32 recordIndex = 0; recordIndex < totalRecord; recordIndex++)
+    {
+        payload.append(SOI);
+        if(hasIndex)
+        {
+            payload.append(QString("%1").arg(recordIndex + 1));
+            payload.append(FSP);
+        }
+
+        for(qint32 fieldIndex = 0; fieldIndex < totalField; fieldIndex++)
+        {
+            payload.append(randomF ? makeRandomValue() : QString("V%1").arg(fieldIndex));
+            payload.append(FSP);
+        }
+
+        if(randomF && (m_random.bounded(5) == 0))
+        {
+            payload.append("tail");
+        }
+        payload.append(EOI);
+    }
+    return payload;
+}
+
+void PayloadLibTest::compareParsed(PayloadLib &payloadLib, SplitPayloadLib &splitPayloadLib)
+{
+    for(qint32 index = 0; index < CNFG_ARRAY_SIZE; index++)
+    {
+        QVERIFY2(payloadLib.getCnfgArrayAtIndex(index).toString() == splitPayloadLib.getCnfgArrayAtIndex(index).toString(),
+                 qPrintable(QString("value mismatch at index %1: [%2] [%3]").arg(index)
+                            .arg(payloadLib.getCnfgArrayAtIndex(index).toString())
+                            .arg(splitPayloadLib.getCnfgArrayAtIndex(index).toString())));
+    }
+
+    for(qint32 tableIndex = 0; tableIndex < MAX_TABLE; tableIndex++)
+    {
+        QCOMPARE(payloadLib.getcnfgTableIndex(tableIndex), splitPayloadLib.getcnfgTableIndex(tableIndex));
+        QCOMPARE(payloadLib.getTotalConfigFieldOfTable(tableIndex), splitPayloadLib.getTotalConfigFieldOfTable(tableIndex));
+    }
+
+    QCOMPARE(payloadLib.getTotalCmdFields(), splitPayloadLib.getTotalCmdFields());
+    QCOMPARE(payloadLib.getTotalReplyFields(), splitPayloadLib.getTotalReplyFields());
+}
+
+void PayloadLibTest::initTestCase()
+{
+    m_random.seed(1);
+}
+
+void PayloadLibTest::parsePayload_data()
+{
+    const QString sot(QChar(SOT)), eot(QChar(EOT)), soi(QChar(SOI)), eoi(QChar(EOI)), fsp(QChar(FSP)), fvs(QChar(FVS));
+
+    QTest::addColumn<int>("requestType");
+    QTest::addColumn<QString>("payload");
+    QTest::addColumn<QString>("firstValue");
+
+    QTest::newRow("single record") << (int)MSG_GET_CFG
+                                   << sot + "1" + fsp + soi + "1" + fsp + "1" + fvs + "NVR" + fsp + "2" + fvs + "10" + fsp + eoi + eot
+                                   << QString("NVR");
+    QTest::newRow("two tables") << (int)MSG_GET_CFG
+                                << sot + "17" + fsp + soi + "1" + fsp + "1" + fvs + "a" + fsp + "2" + fvs + "b" + fsp + eoi
+                                   + soi + "2" + fsp + "1" + fvs + "c" + fsp + "2" + fvs + "d" + fsp + eoi + eot
+                                   + sot + "5" + fsp + soi + "1" + fsp + "3" + fvs + "e" + fsp + eoi + eot
+                                << QString("a");
+    QTest::newRow("empty value") << (int)MSG_GET_CFG
+                                 << sot + "2" + fsp + soi + "1" + fsp + "3" + fvs + fsp + "4" + fvs + "x" + fsp + eoi + eot
+                                 << QString("");
+    QTest::newRow("empty table and record") << (int)MSG_GET_CFG
+                                            << sot + eot + sot + "2" + fsp + soi + eoi + soi + "1" + fsp + "1" + fvs + "a" + fsp + eoi + eot
+                                            << QString("a");
+    QTest::newRow("index only record") << (int)MSG_GET_CFG
+                                       << sot + "3" + fsp + soi + "1" + fsp + eoi + soi + "2" + fsp + "1" + fvs + "a" + fsp + eoi + eot
+                                       << QString("a");
+    QTest::newRow("empty fields") << (int)MSG_GET_CFG
+                                  << sot + "4" + fsp + soi + "1" + fsp + fsp + "1" + fvs + "a" + fsp + fsp + "2" + fvs + "b" + fsp + eoi + eot
+                                  << QString("a");
+    QTest::newRow("many field value separators") << (int)MSG_GET_CFG
+                                                 << sot + "6" + fsp + soi + "1" + fsp + "1" + fvs + "a" + fvs + "b" + fsp + eoi + eot
+                                                 << QString("a");
+    QTest::newRow("no table separators") << (int)MSG_GET_CFG
+                                         << "7" + fsp + soi + "1" + fsp + "1" + fvs + "x" + fsp + eoi
+                                         << QString("x");
+    QTest::newRow("more values than array") << (int)MSG_GET_CFG << makeGetCfgReply(1, SEARCH_REPLY_ROW_CNT, 10, false) << QString("V0");
+    QTest::newRow("not get config") << (int)MSG_SET_CFG
+                                    << sot + "1" + fsp + soi + "1" + fsp + "1" + fvs + "NVR" + fsp + eoi + eot
+                                    << QString("");
+}
+
+void PayloadLibTest::parsePayload()
+{
+    QFETCH(int, requestType);
+    QFETCH(QString, payload);
+    QFETCH(QString, firstValue);
+    PayloadLib payloadLib;
+    SplitPayloadLib splitPayloadLib;
+
+    payloadLib.parsePayload((REQ_MSG_ID_e)requestType, payload);
+    splitPayloadLib.parsePayload((REQ_MSG_ID_e)requestType, payload);
+    QCOMPARE(payloadLib.getCnfgArrayAtIndex(0).toString(), firstValue);
+    compareParsed(payloadLib, splitPayloadLib);
+}
+
+void PayloadLibTest::parsePayloadRandom()
+{
+    PayloadLib payloadLib;
+    SplitPayloadLib splitPayloadLib;
+
+    /* Same objects are used for all payloads to compare values left from earlier payload too */
+    for(qint32 payloadCnt = 0; payloadCnt < RANDOM_PAYLOAD_CNT; payloadCnt++)
+    {
+        QString payload = makeGetCfgReply(m_random.bounded(1, MAX_TABLE + 1), m_random.bounded(21), m_random.bounded(13), true);
+
+        payloadLib.parsePayload(MSG_GET_CFG, payload);
+        splitPayloadLib.parsePayload(MSG_GET_CFG, payload);
+        compareParsed(payloadLib, splitPayloadLib);
+        if(QTest::currentTestFailed())
+        {
+            qWarning("payload %d: [%s]", payloadCnt, qPrintable(payload.toHtmlEscaped()));
+            return;
+        }
+    }
+}
+
+void PayloadLibTest::parseDevCmdReply_data()
+{
+    const QString soi(QChar(SOI)), eoi(QChar(EOI)), fsp(QChar(FSP));
+
+    QTest::addColumn<bool>("hasIndex");
+    QTest::addColumn<QString>("reply");
+    QTest::addColumn<int>("totalCmdFields");
+
+    QTest::newRow("fields without record") << false << "a" + fsp + "b" + fsp + "c" + fsp << 3;
+    QTest::newRow("record with index") << true << soi + "1" + fsp + "a" + fsp + "b" + fsp + eoi << 2;
+    QTest::newRow("empty fields") << false << soi + fsp + "a" + fsp + fsp + eoi << 3;
+    QTest::newRow("text after last field") << false << soi + "a" + fsp + "tail" + eoi << 1;
+    QTest::newRow("empty record") << true << soi + eoi + soi + "1" + fsp + "a" + fsp + eoi << 1;
+    QTest::newRow("index only record") << true << soi + "1" + fsp + eoi << 0;
+    QTest::newRow("more fields than array") << true << makeDevCmdReply(true, SEARCH_REPLY_ROW_CNT, 10, false) << CNFG_ARRAY_SIZE;
+}
+
+void PayloadLibTest::parseDevCmdReply()
+{
+    QFETCH(bool, hasIndex);
+    QFETCH(QString, reply);
+    QFETCH(int, totalCmdFields);
+    PayloadLib payloadLib;
+    SplitPayloadLib splitPayloadLib;
+
+    payloadLib.parseDevCmdReply(hasIndex, reply);
+    splitPayloadLib.parseDevCmdReply(hasIndex, reply);
+    QCOMPARE(payloadLib.getTotalCmdFields(), totalCmdFields);
+    compareParsed(payloadLib, splitPayloadLib);
+}
+
+void PayloadLibTest::parseDevCmdReplyRandom()
+{
+    PayloadLib payloadLib;
+    SplitPayloadLib splitPayloadLib;
+
+    for(qint32 payloadCnt = 0; payloadCnt < RANDOM_PAYLOAD_CNT; payloadCnt++)
+    {
+        bool hasIndex = (m_random.bounded(2) == 0);
+        QString reply = makeDevCmdReply(hasIndex, m_random.bounded(1, 21), m_random.bounded(13), true);
+
+        payloadLib.parseDevCmdReply(hasIndex, reply);
+        splitPayloadLib.parseDevCmdReply(hasIndex, reply);
+        compareParsed(payloadLib, splitPayloadLib);
+        if(QTest::currentTestFailed())
+        {
+            qWarning("reply %d: [%s]", payloadCnt, qPrintable(reply.toHtmlEscaped()));
+            return;
+        }
+    }
+}
+
+void PayloadLibTest::benchParsePayload_data()
+{
+    QTest::addColumn<bool>("splitF");
+    QTest::addColumn<QString>("payload");
+
+    /* General settings page, camera search result and multi table page */
+    QTest::newRow("general table: scan") << false << makeGetCfgReply(1, 1, 60, false);
+    QTest::newRow("general table: split") << true << makeGetCfgReply(1, 1, 60, false);
+    QTest::newRow("camera search: scan") << false << makeGetCfgReply(1, 250, SEARCH_REPLY_FIELD_CNT, false);
+    QTest::newRow("camera search: split") << true << makeGetCfgReply(1, 250, SEARCH_REPLY_FIELD_CNT, false);
+    QTest::newRow("10000 row search: scan") << false << makeGetCfgReply(1, SEARCH_REPLY_ROW_CNT, SEARCH_REPLY_FIELD_CNT, false);
+    QTest::newRow("10000 row search: split") << true << makeGetCfgReply(1, SEARCH_REPLY_ROW_CNT, SEARCH_REPLY_FIELD_CNT, false);
+    QTest::newRow("five tables: scan") << false << makeGetCfgReply(MAX_TABLE, 40, 10, false);
+    QTest::newRow("five tables: split") << true << makeGetCfgReply(MAX_TABLE, 40, 10, false);
+}
+
+void PayloadLibTest::benchParsePayload()
+{
+    QFETCH(bool, splitF);
+    QFETCH(QString, payload);
+    PayloadLib payloadLib;
+    SplitPayloadLib splitPayloadLib;
+
+    if(splitF)
+    {
+        QBENCHMARK
+        {
+            splitPayloadLib.parsePayload(MSG_GET_CFG, payload);
+        }
+    }
+    else
+    {
+        QBENCHMARK
+        {
+            payloadLib.parsePayload(MSG_GET_CFG, payload);
+        }
+    }
+}
+
+void PayloadLibTest::benchParseDevCmdReply_data()
+{
+    QTest::addColumn<bool>("splitF");
+    QTest::addColumn<bool>("hasIndex");
+    QTest::addColumn<QString>("reply");
+
+    QTest::newRow("short reply: scan") << false << false << makeDevCmdReply(false, 1, 10, false);
+    QTest::newRow("short reply: split") << true << false << makeDevCmdReply(false, 1, 10, false);
+    QTest::newRow("camera list: scan") << false << true << makeDevCmdReply(true, 250, SEARCH_REPLY_FIELD_CNT, false);
+    QTest::newRow("camera list: split") << true << true << makeDevCmdReply(true, 250, SEARCH_REPLY_FIELD_CNT, false);
+    QTest::newRow("10000 row list: scan") << false << true << makeDevCmdReply(true, SEARCH_REPLY_ROW_CNT, SEARCH_REPLY_FIELD_CNT, false);
+    QTest::newRow("10000 row list: split") << true << true << makeDevCmdReply(true, SEARCH_REPLY_ROW_CNT, SEARCH_REPLY_FIELD_CNT, false);
+}
+
+void PayloadLibTest::benchParseDevCmdReply()
+{
+    QFETCH(bool, splitF);
+    QFETCH(bool, hasIndex);
+    QFETCH(QString, reply);
+    PayloadLib payloadLib;
+    SplitPayloadLib splitPayloadLib;
+
+    if(splitF)
+    {
+        QBENCHMARK
+        {
+            splitPayloadLib.parseDevCmdReply(hasIndex, reply);
+        }
+    }
+    else
+    {
+        QBENCHMARK
+        {
+            payloadLib.parseDevCmdReply(hasIndex, reply);
+        }
+    }
+}
+
+/* Allocations of one parsing of 10000 row search reply are counted for both parsers. Objects are used
+ * once before counting, so values left from earlier parsing are freed and replaced as in GUI. */
+void PayloadLibTest::benchAllocation()
+{
+    PayloadLib payloadLib;
+    SplitPayloadLib splitPayloadLib;
+    QString payload = makeGetCfgReply(1, SEARCH_REPLY_ROW_CNT, SEARCH_REPLY_FIELD_CNT, false);
+    QString reply = makeDevCmdReply(true, SEARCH_REPLY_ROW_CNT, SEARCH_REPLY_FIELD_CNT, false);
+    quint64 scanCnt, splitCnt;
+
+    payloadLib.parsePayload(MSG_GET_CFG, payload);
+    splitPayloadLib.parsePayload(MSG_GET_CFG, payload);
+
+    allocationCnt.storeRelaxed(0);
+    payloadLib.parsePayload(MSG_GET_CFG, payload);
+    scanCnt = allocationCnt.loadRelaxed();
+
+    allocationCnt.storeRelaxed(0);
+    splitPayloadLib.parsePayload(MSG_GET_CFG, payload);
+    splitCnt = allocationCnt.loadRelaxed();
+
+    qInfo("search reply of %d rows: scan %llu allocations, split %llu allocations",
+          SEARCH_REPLY_ROW_CNT, scanCnt, splitCnt);
+    QVERIFY(scanCnt < splitCnt);
+
+    payloadLib.parseDevCmdReply(true, reply);
+    splitPayloadLib.parseDevCmdReply(true, reply);
+
+    allocationCnt.storeRelaxed(0);
+    payloadLib.parseDevCmdReply(true, reply);
+    scanCnt = allocationCnt.loadRelaxed();
+
+    allocationCnt.storeRelaxed(0);
+    splitPayloadLib.parseDevCmdReply(true, reply);
+    splitCnt = allocationCnt.loadRelaxed();
+
+    qInfo("command reply of %d rows: scan %llu allocations, split %llu allocations",
+          SEARCH_REPLY_ROW_CNT, scanCnt, splitCnt);
+    QVERIFY(scanCnt < splitCnt);
+}
+
+QTEST_APPLESS_MAIN(PayloadLibTest)
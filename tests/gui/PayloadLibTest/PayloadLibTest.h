@@ -0,0 +1,76 @@
+#ifndef PAYLOADLIBTEST_H
+#define PAYLOADLIBTEST_H
+
+#include <QObject>
+#include <QRandomGenerator>
+#include <QtTest>
+#include "PayloadLib.h"
+
+/* Parsing of payload by splitting it in string lists, as payload library parsed it before single scan
+ * parsing. It is kept as reference of parsing semantics and as baseline of benchmark. */
+class SplitPayloadLib
+{
+private:
+    QList<QVariant> cnfgArray;
+    qint32 m_configTableIndex[MAX_TABLE];
+    qint32 m_configRecordForTable[MAX_TABLE];
+    qint32 m_totalCmdFields;
+    qint32 m_totalReplyFields;
+    qint32 m_totalTable;
+
+public:
+    SplitPayloadLib();
+
+    void parsePayload(REQ_MSG_ID_e requestType, QString devPayload);
+
+    void parseDevCmdReply(bool hasIndex, QString devCmdReply);
+
+    QVariant getCnfgArrayAtIndex(qint32 index);
+
+    qint32 getcnfgTableIndex(qint32 tableNumber = 0);
+
+    qint32 getTotalCmdFields();
+
+    qint32 getTotalReplyFields();
+
+    qint32 getTotalConfigFieldOfTable(qint32 tableIndex = 0);
+};
+
+class PayloadLibTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    QRandomGenerator m_random;
+
+    QString makeRandomValue();
+
+    QString makeGetCfgReply(qint32 totalTable, qint32 totalRecord, qint32 totalField, bool randomF);
+
+    QString makeDevCmdReply(bool hasIndex, qint32 totalRecord, qint32 totalField, bool randomF);
+
+    void compareParsed(PayloadLib &payloadLib, SplitPayloadLib &splitPayloadLib);
+
+private slots:
+    void initTestCase();
+
+    void parsePayload_data();
+    void parsePayload();
+
+    void parsePayloadRandom();
+
+    void parseDevCmdReply_data();
+    void parseDevCmdReply();
+
+    void parseDevCmdReplyRandom();
+
+    void benchParsePayload_data();
+    void benchParsePayload();
+
+    void benchParseDevCmdReply_data();
+    void benchParseDevCmdReply();
+
+    void benchAllocation();
+};
+
+#endif // PAYLOADLIBTEST_H
@@ -0,0 +1,39 @@
+# Unit test and benchmark of payload library of GUI on host. Parsing of payload library is compared
+# with parsing by splitting payload. Time of both is measured by QBENCHMARK and heap allocations of
+# both are counted for 10000 row search reply.
+#   qmake PayloadLibTest.pro && make && ./bin/PayloadLibTest
+
+# This variable contains the name of the template to use when generating the project
+TEMPLATE = app
+
+# Target file name
+TARGET      = PayloadLibTest
+OBJECTS_DIR = obj
+MOC_DIR     = moc
+DESTDIR     = bin
+
+# QT varaible control for add on feature in qt
+QT += core gui testlib
+QT -= widgets
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += $$PWD/../../../src/GuiApplication/nvrgui
+INCLUDEPATH += $$PWD/../../../src/Application/DebugLog
+INCLUDEPATH += $$PWD/../../../src/Application/Utils
+INCLUDEPATH += $$PWD/../../../src/Application/Include
+
+# Header files for the project
+HEADERS += \
+    $$PWD/PayloadLibTest.h \
+    $$PWD/../../../src/GuiApplication/nvrgui/PayloadLib.h
+
+# Source files for the project
+SOURCES += \
+    $$PWD/PayloadLibTest.cpp \
+    $$PWD/../../../src/GuiApplication/nvrgui/PayloadLib.cpp \
+    $$PWD/../../../src/Application/DebugLog/DebugLog.c \
+    $$PWD/../../../src/Application/Utils/CommonApi.c
+
+QMAKE_CFLAGS += -DGUI_SYSTEM
+QMAKE_CXXFLAGS += -DGUI_SYSTEM -Wno-deprecated-declarations
@@ -0,0 +1,830 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       TcpClientPoolTest.c
+@brief      Test of frame buffer pool of camera initiated live streams. Chaining of free buffers, reuse,
+            growth of buffer with partially received data and cache limit of pool are checked directly.
+            Then all live stream threads receive frames of all size classes on main and sub streams of
+            all cameras from loopback cameras while streams are started and stopped randomly. Frames
+            given to callback must be intact and pool must stay consistent and within its cache limit
+            all the time. Frame buffers held by streams and pool must stay within buffer of largest
+            class for each running stream and cache limit of pool.
+
+            Run with "make test SANITIZE=address" to check use of freed or cached buffers too.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* OS Includes */
+#include <stdlib.h>
+#include <netinet/in.h>
+
+/* Frame buffers allocated by unit under test are tracked to know memory held by streams and pool */
+static void *testPoolMalloc(size_t size);
+static void testPoolFree(void *ptr);
+#define malloc(size)    testPoolMalloc(size)
+#define free(ptr)       testPoolFree(ptr)
+
+/* Unit under test */
+#include "TcpClient.c"
+#undef malloc
+#undef free
+#include "UtilCommon.c"
+
+/* Application Includes */
+#include "DeviceInfoStub.c"
+#include "TcpClientStub.c"
+#include "UnitTest.h"
+
+//#################################################################################################
+// @DEFINES
+//#################################################################################################
+/* Main and sub stream of all cameras, stream index is same as channel given to frame callback */
+#define TEST_STREAM_CNT             (MAX_STREAM * MAX_CAMERA)
+#define TEST_THREAD_CNT             (MAX_TCP_LIVE_STREAM_THREAD)
+#define TEST_STRESS_TIME_MS         (2000)
+#define TEST_TOGGLE_INTERVAL_US     (2000)
+#define TEST_RESTART_TIME_MS        (10000)
+#define TEST_I_FRAME_INTERVAL       (4)
+#define TEST_PAYLOAD_SIZE_CNT       (4)
+#define TEST_SEND_CHUNK_LEN         (64 * KILO_BYTE)
+
+/* Payload byte is ((dataIdx * 31) + seed). As 31 is odd, every seed is start offset in pattern of
+ * (idx * 31) bytes and pattern repeats after 256 bytes. 223 is inverse of 31 modulo 256. */
+#define TEST_PATTERN_PERIOD         (256)
+#define TEST_SEED_TO_PATTERN_OFFSET(seed) (((UINT32)(seed) * 223) % TEST_PATTERN_PERIOD)
+
+/* Max buffers which can be cached, all of smallest class */
+#define TEST_MAX_CACHED_BUF         (CI_FRAME_BUF_POOL_CACHE_MAX / (64 * KILO_BYTE))
+
+/* Frame buffers which can be allocated at a time: one for each stream, one more for growth of buffer in
+ * each thread and cached buffers */
+#define TEST_MAX_POOL_ALLOC         (TEST_STREAM_CNT + TEST_THREAD_CNT + TEST_MAX_CACHED_BUF)
+
+//#################################################################################################
+// @DATA TYPES
+//#################################################################################################
+typedef struct
+{
+    pthread_mutex_t camLock;
+    INT32           sendFd;
+    INT32           recvFd;
+    UINT32          frameIdx;
+    UINT32          frameLen;
+    UINT32          sentLen;
+    UINT32          patternOffset;
+    UINT8           frameHeader[CI_FRAME_HEADER_LEN];
+}TEST_CAMERA_t;
+
+typedef struct
+{
+    VOIDPTR     pBuf;
+    UINT32      size;
+}TEST_POOL_ALLOC_t;
+
+//#################################################################################################
+// @STATIC VARIABLES
+//#################################################################################################
+/* Payload of frames needs buffer of each size class */
+static const UINT32 testPayloadSize[TEST_PAYLOAD_SIZE_CNT] =
+{
+    20 * KILO_BYTE, 200 * KILO_BYTE, 700 * KILO_BYTE, (3 * MEGA_BYTE) / 2
+};
+
+static TEST_CAMERA_t    testCamera[TEST_STREAM_CNT];
+static volatile BOOL    senderExitF;
+static INT32            testListenFd = INVALID_CONNECTION;
+static struct sockaddr_in testListenAddr;
+
+/* Payload of all frames is sent from this pattern */
+static UINT8            testPattern[TEST_SEND_CHUNK_LEN + TEST_PATTERN_PERIOD];
+
+/* Updated by frame callback in live stream threads */
+static UINT32           frameRecvCnt[TEST_STREAM_CNT];
+static UINT32           frameErrCnt;
+
+/* Frame buffers allocated by pool which are held by streams or cached in pool */
+static pthread_mutex_t  poolAllocLock = PTHREAD_MUTEX_INITIALIZER;
+static TEST_POOL_ALLOC_t poolAlloc[TEST_MAX_POOL_ALLOC];
+static UINT64           poolAllocSize;
+static UINT32           poolAllocOverflowCnt;
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Allocate memory for unit under test. Frame buffers of pool are tracked with their size.
+ * @param   size
+ * @return  Allocated memory
+ */
+static VOIDPTR testPoolMalloc(size_t size)
+{
+    VOIDPTR pBuf = malloc(size);
+    UINT8   bufClass;
+    UINT32  allocIdx;
+
+    for (bufClass = 0; bufClass < CI_FRAME_BUF_CLASS_MAX; bufClass++)
+    {
+        if (size == ciFrameBufSize[bufClass])
+        {
+            break;
+        }
+    }
+
+    if ((pBuf == NULL) || (bufClass >= CI_FRAME_BUF_CLASS_MAX))
+    {
+        return pBuf;
+    }
+
+    MUTEX_LOCK(poolAllocLock);
+    for (allocIdx = 0; allocIdx < TEST_MAX_POOL_ALLOC; allocIdx++)
+    {
+        if (poolAlloc[allocIdx].pBuf == NULL)
+        {
+            poolAlloc[allocIdx].pBuf = pBuf;
+            poolAlloc[allocIdx].size = size;
+            poolAllocSize += size;
+            break;
+        }
+    }
+
+    if (allocIdx >= TEST_MAX_POOL_ALLOC)
+    {
+        /* More frame buffers are allocated than streams and pool can hold */
+        poolAllocOverflowCnt++;
+    }
+    MUTEX_UNLOCK(poolAllocLock);
+    return pBuf;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Free memory of unit under test. Tracked frame buffer is removed from allocated buffers.
+ * @param   ptr
+ */
+static void testPoolFree(VOIDPTR ptr)
+{
+    UINT32 allocIdx;
+
+    MUTEX_LOCK(poolAllocLock);
+    for (allocIdx = 0; (ptr != NULL) && (allocIdx < TEST_MAX_POOL_ALLOC); allocIdx++)
+    {
+        if (poolAlloc[allocIdx].pBuf == ptr)
+        {
+            poolAllocSize -= poolAlloc[allocIdx].size;
+            poolAlloc[allocIdx].pBuf = NULL;
+            break;
+        }
+    }
+    MUTEX_UNLOCK(poolAllocLock);
+    free(ptr);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check free buffer chains of pool against its cache size. Each buffer must be present only
+ *          once and total size of chained buffers must be equal to cache size.
+ * @return  TRUE if pool is consistent
+ */
+static BOOL isPoolConsistent(void)
+{
+    UINT8PTR    pBuf, cachedBuf[TEST_MAX_CACHED_BUF];
+    UINT32      cachedCnt = 0, chainSize = 0, bufIdx, checkIdx;
+    UINT8       bufClass;
+    BOOL        consistentF = TRUE;
+
+    MUTEX_LOCK(ciFrameBufPool.poolLock);
+    for (bufClass = 0; bufClass < CI_FRAME_BUF_CLASS_MAX; bufClass++)
+    {
+        for (pBuf = ciFrameBufPool.pFreeBuf[bufClass]; pBuf != NULL; pBuf = *(UINT8PTR *)pBuf)
+        {
+            if (cachedCnt >= TEST_MAX_CACHED_BUF)
+            {
+                /* More buffers than cache can have, chain has loop or cache limit is not followed */
+                consistentF = FALSE;
+                break;
+            }
+            cachedBuf[cachedCnt++] = pBuf;
+            chainSize += ciFrameBufSize[bufClass];
+        }
+    }
+
+    if ((chainSize != ciFrameBufPool.cacheSize) || (ciFrameBufPool.cacheSize > CI_FRAME_BUF_POOL_CACHE_MAX))
+    {
+        consistentF = FALSE;
+    }
+    MUTEX_UNLOCK(ciFrameBufPool.poolLock);
+
+    for (bufIdx = 0; bufIdx < cachedCnt; bufIdx++)
+    {
+        for (checkIdx = bufIdx + 1; checkIdx < cachedCnt; checkIdx++)
+        {
+            if (cachedBuf[bufIdx] == cachedBuf[checkIdx])
+            {
+                consistentF = FALSE;
+            }
+        }
+    }
+
+    return consistentF;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check chaining, reuse and growth of frame buffers and cache limit of pool
+ */
+static void testPoolChain(void)
+{
+    FRAME_DATA_INFO_t   frameInfo[CI_FRAME_BUF_POOL_CACHE_MAX / CI_MAX_FRAME_LEN * 2];
+    FRAME_DATA_INFO_t   growInfo;
+    UINT8PTR            pOldBuf;
+    UINT32              bufIdx, cacheSize;
+    UINT8               headerData[CI_FRAME_HEADER_LEN];
+
+    memset(frameInfo, 0, sizeof(frameInfo));
+    memset(&growInfo, 0, sizeof(growInfo));
+
+    /* Buffers of largest class are cached till limit and buffers after that are freed */
+    for (bufIdx = 0; bufIdx < (sizeof(frameInfo) / sizeof(frameInfo[0])); bufIdx++)
+    {
+        UT_CHECK(reserveTcpLiveStreamFrameBuf(&frameInfo[bufIdx], CI_MAX_FRAME_LEN) == SUCCESS);
+        UT_CHECK(frameInfo[bufIdx].payloadBufClass == (CI_FRAME_BUF_CLASS_MAX - 1));
+    }
+
+    for (bufIdx = 0; bufIdx < (sizeof(frameInfo) / sizeof(frameInfo[0])); bufIdx++)
+    {
+        releaseTcpLiveStreamFrameBuf(&frameInfo[bufIdx]);
+        UT_CHECK(frameInfo[bufIdx].payloadData == NULL);
+        UT_CHECK(isPoolConsistent() == TRUE);
+    }
+    UT_CHECK_MSG(ciFrameBufPool.cacheSize == CI_FRAME_BUF_POOL_CACHE_MAX, "[cacheSize=%u]", ciFrameBufPool.cacheSize);
+
+    /* Free buffer is reused in last in first out order and size class is kept by stream */
+    pOldBuf = ciFrameBufPool.pFreeBuf[CI_FRAME_BUF_CLASS_MAX - 1];
+    frameInfo[0].payloadData = NULL;
+    UT_CHECK(reserveTcpLiveStreamFrameBuf(&frameInfo[0], ciFrameBufSize[frameInfo[0].payloadBufClass]) == SUCCESS);
+    UT_CHECK(frameInfo[0].payloadData == pOldBuf);
+    UT_CHECK(ciFrameBufPool.cacheSize == (CI_FRAME_BUF_POOL_CACHE_MAX - CI_MAX_FRAME_LEN));
+
+    /* Buffer grows with partially received data, old buffer goes back to pool as pool has space */
+    UT_CHECK(reserveTcpLiveStreamFrameBuf(&growInfo, CI_FRAME_HEADER_LEN) == SUCCESS);
+    UT_CHECK(growInfo.payloadBufClass == 0);
+    for (bufIdx = 0; bufIdx < CI_FRAME_HEADER_LEN; bufIdx++)
+    {
+        headerData[bufIdx] = (UINT8)(bufIdx * 7);
+    }
+    memcpy(growInfo.payloadData, headerData, CI_FRAME_HEADER_LEN);
+    growInfo.payloadRef = growInfo.payloadData + CI_FRAME_HEADER_LEN;
+    pOldBuf = growInfo.payloadData;
+    cacheSize = ciFrameBufPool.cacheSize;
+
+    UT_CHECK(reserveTcpLiveStreamFrameBuf(&growInfo, CI_FRAME_HEADER_LEN + (300 * KILO_BYTE)) == SUCCESS);
+    UT_CHECK(growInfo.payloadBufClass == 2);
+    UT_CHECK(growInfo.payloadRef == (growInfo.payloadData + CI_FRAME_HEADER_LEN));
+    UT_CHECK(memcmp(growInfo.payloadData, headerData, CI_FRAME_HEADER_LEN) == 0);
+    UT_CHECK(ciFrameBufPool.pFreeBuf[0] == pOldBuf);
+    UT_CHECK(ciFrameBufPool.cacheSize == (cacheSize + ciFrameBufSize[0]));
+    UT_CHECK(isPoolConsistent() == TRUE);
+
+    /* Buffer large enough is not changed and frame larger than largest class is refused */
+    pOldBuf = growInfo.payloadData;
+    UT_CHECK(reserveTcpLiveStreamFrameBuf(&growInfo, 100 * KILO_BYTE) == SUCCESS);
+    UT_CHECK(growInfo.payloadData == pOldBuf);
+    UT_CHECK(reserveTcpLiveStreamFrameBuf(&growInfo, CI_MAX_FRAME_LEN + 1) == FAIL);
+    UT_CHECK((growInfo.payloadData == pOldBuf) && (growInfo.payloadBufClass == 2));
+
+    releaseTcpLiveStreamFrameBuf(&growInfo);
+    releaseTcpLiveStreamFrameBuf(&frameInfo[0]);
+    UT_CHECK(isPoolConsistent() == TRUE);
+    UT_CHECK(ciFrameBufPool.cacheSize <= CI_FRAME_BUF_POOL_CACHE_MAX);
+}
+
+/**
+ * @brief   Frame callback of camera interface. Payload must be same as made by camera.
+ * @param   tcpFrame
+ */
+static void testFrameCb(TCP_FRAME_INFO_t *tcpFrame)
+{
+    UINT8PTR    pPayload = tcpFrame->dataPtr;
+    UINT32      dataIdx, sizeIdx;
+    UINT8       seed;
+
+    if ((tcpFrame->state != START) || (tcpFrame->channel >= TEST_STREAM_CNT))
+    {
+        return;
+    }
+
+    for (sizeIdx = 0; sizeIdx < TEST_PAYLOAD_SIZE_CNT; sizeIdx++)
+    {
+        if (tcpFrame->frameInfo.len == testPayloadSize[sizeIdx])
+        {
+            break;
+        }
+    }
+
+    seed = pPayload[0];
+    for (dataIdx = 0; (sizeIdx < TEST_PAYLOAD_SIZE_CNT) && (dataIdx < tcpFrame->frameInfo.len); dataIdx++)
+    {
+        if (pPayload[dataIdx] != (UINT8)((dataIdx * 31) + seed))
+        {
+            break;
+        }
+    }
+
+    if ((sizeIdx >= TEST_PAYLOAD_SIZE_CNT) || (dataIdx != tcpFrame->frameInfo.len))
+    {
+        __atomic_add_fetch(&frameErrCnt, 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    /* Each stream is served by only one live stream thread */
+    frameRecvCnt[tcpFrame->channel]++;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Make next frame of camera. Consecutive payload bytes differ by 31, so magic code can never
+ *          be found inside payload when receiver searches for frame after restart of stream. Only header
+ *          is made here, payload is sent from pattern.
+ * @param   pCamera
+ * @param   streamIdx
+ */
+static void makeCameraFrame(TEST_CAMERA_t *pCamera, UINT16 streamIdx)
+{
+    FRAME_HEADER_t  *pHeader = (FRAME_HEADER_t *)pCamera->frameHeader;
+    UINT32          payloadLen = testPayloadSize[(pCamera->frameIdx + streamIdx) % TEST_PAYLOAD_SIZE_CNT];
+    UINT8           seed = (UINT8)((pCamera->frameIdx * 7) + streamIdx);
+
+    memset(pHeader, 0, CI_FRAME_HEADER_LEN);
+    pHeader->magicCode = MAGIC_CODE;
+    pHeader->productType = CAM_PRODUCT_TYPE;
+    pHeader->mediaFrmLen = CI_FRAME_HEADER_LEN + payloadLen;
+    pHeader->chNo = (UINT8)(streamIdx % MAX_CAMERA);
+    pHeader->streamType = STREAM_TYPE_VIDEO;
+    pHeader->codecType = VIDEO_H264;
+    pHeader->frmType = ((pCamera->frameIdx % TEST_I_FRAME_INTERVAL) == 0) ? I_FRAME : P_FRAME;
+    pHeader->vidResolution = 1;
+
+    pCamera->frameLen = CI_FRAME_HEADER_LEN + payloadLen;
+    pCamera->sentLen = 0;
+    pCamera->patternOffset = TEST_SEED_TO_PATTERN_OFFSET(seed);
+    pCamera->frameIdx++;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Cameras send frames continuously. Camera whose socket is full is skipped, so stopped stream
+ *          does not block others.
+ * @param   threadArg
+ * @return
+ */
+static VOIDPTR cameraSender(VOIDPTR threadArg)
+{
+    TEST_CAMERA_t   *pCamera;
+    UINT16          streamIdx;
+    UINT32          dataIdx, sendLen;
+    ssize_t         sentLen;
+
+    while (senderExitF == FALSE)
+    {
+        for (streamIdx = 0; streamIdx < TEST_STREAM_CNT; streamIdx++)
+        {
+            pCamera = &testCamera[streamIdx];
+            MUTEX_LOCK(pCamera->camLock);
+            if (pCamera->sendFd == INVALID_CONNECTION)
+            {
+                MUTEX_UNLOCK(pCamera->camLock);
+                continue;
+            }
+
+            if (pCamera->sentLen >= pCamera->frameLen)
+            {
+                makeCameraFrame(pCamera, streamIdx);
+            }
+
+            if (pCamera->sentLen < CI_FRAME_HEADER_LEN)
+            {
+                sentLen = send(pCamera->sendFd, pCamera->frameHeader + pCamera->sentLen, CI_FRAME_HEADER_LEN - pCamera->sentLen,
+                               MSG_DONTWAIT | MSG_NOSIGNAL);
+            }
+            else
+            {
+                dataIdx = pCamera->sentLen - CI_FRAME_HEADER_LEN;
+                sendLen = pCamera->frameLen - pCamera->sentLen;
+                if (sendLen > TEST_SEND_CHUNK_LEN)
+                {
+                    sendLen = TEST_SEND_CHUNK_LEN;
+                }
+                sentLen = send(pCamera->sendFd, &testPattern[(dataIdx + pCamera->patternOffset) % TEST_PATTERN_PERIOD], sendLen,
+                               MSG_DONTWAIT | MSG_NOSIGNAL);
+            }
+
+            if (sentLen > 0)
+            {
+                pCamera->sentLen += sentLen;
+            }
+            MUTEX_UNLOCK(pCamera->camLock);
+        }
+        usleep(100);
+    }
+
+    return NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Open loopback socket on which cameras connect
+ * @return  SUCCESS/FAIL
+ */
+static BOOL openTestCameras(void)
+{
+    socklen_t   addrLen = sizeof(testListenAddr);
+    UINT16      streamIdx;
+
+    for (streamIdx = 0; streamIdx < TEST_STREAM_CNT; streamIdx++)
+    {
+        MUTEX_INIT(testCamera[streamIdx].camLock, NULL);
+        testCamera[streamIdx].sendFd = INVALID_CONNECTION;
+        testCamera[streamIdx].recvFd = INVALID_CONNECTION;
+    }
+
+    testListenFd = socket(AF_INET, SOCK_STREAM, 0);
+    memset(&testListenAddr, 0, sizeof(testListenAddr));
+    testListenAddr.sin_family = AF_INET;
+    testListenAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if ((testListenFd < 0) || (bind(testListenFd, (struct sockaddr *)&testListenAddr, sizeof(testListenAddr)) != STATUS_OK)
+            || (listen(testListenFd, TEST_STREAM_CNT) != STATUS_OK)
+            || (getsockname(testListenFd, (struct sockaddr *)&testListenAddr, &addrLen) != STATUS_OK))
+    {
+        fprintf(stderr, "fail to listen on loopback: [err=%s]\n", STR_ERR);
+        if (testListenFd >= 0)
+        {
+            close(testListenFd);
+        }
+        testListenFd = INVALID_CONNECTION;
+        return FAIL;
+    }
+
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Close connection of camera. Caller must hold lock of camera.
+ * @param   pCamera
+ */
+static void disconnectTestCamera(TEST_CAMERA_t *pCamera)
+{
+    if (pCamera->sendFd != INVALID_CONNECTION)
+    {
+        close(pCamera->sendFd);
+        pCamera->sendFd = INVALID_CONNECTION;
+    }
+
+    if (pCamera->recvFd != INVALID_CONNECTION)
+    {
+        close(pCamera->recvFd);
+        pCamera->recvFd = INVALID_CONNECTION;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Make new connection of camera as camera does on start of stream. Old connection is closed, so
+ *          stream always starts at frame boundary as it does with camera.
+ * @param   streamIdx
+ * @return  Socket of stream on NVR side
+ */
+static INT32 connectTestCamera(UINT16 streamIdx)
+{
+    TEST_CAMERA_t   *pCamera = &testCamera[streamIdx];
+    INT32           recvFd;
+
+    MUTEX_LOCK(pCamera->camLock);
+    disconnectTestCamera(pCamera);
+    pCamera->sendFd = socket(AF_INET, SOCK_STREAM, 0);
+    if ((pCamera->sendFd < 0) || (connect(pCamera->sendFd, (struct sockaddr *)&testListenAddr, sizeof(testListenAddr)) != STATUS_OK)
+            || ((pCamera->recvFd = accept(testListenFd, NULL, NULL)) < 0))
+    {
+        fprintf(stderr, "fail to connect on loopback: [stream=%d], [err=%s]\n", streamIdx, STR_ERR);
+        if (pCamera->sendFd < 0)
+        {
+            pCamera->sendFd = INVALID_CONNECTION;
+        }
+        pCamera->recvFd = INVALID_CONNECTION;
+        disconnectTestCamera(pCamera);
+    }
+
+    /* Next frame is made on new connection */
+    pCamera->sentLen = pCamera->frameLen;
+    recvFd = pCamera->recvFd;
+    MUTEX_UNLOCK(pCamera->camLock);
+    return recvFd;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Close loopback connections of cameras
+ */
+static void closeTestCameras(void)
+{
+    UINT16 streamIdx;
+
+    for (streamIdx = 0; streamIdx < TEST_STREAM_CNT; streamIdx++)
+    {
+        MUTEX_LOCK(testCamera[streamIdx].camLock);
+        disconnectTestCamera(&testCamera[streamIdx]);
+        MUTEX_UNLOCK(testCamera[streamIdx].camLock);
+    }
+
+    close(testListenFd);
+    testListenFd = INVALID_CONNECTION;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Start or stop live stream as done by live stream command thread
+ * @param   streamIdx
+ * @param   startF
+ */
+static void setTestStreamStatus(UINT16 streamIdx, BOOL startF)
+{
+    UINT8                   camIndex = streamIdx % MAX_CAMERA;
+    UINT8                   streamType = streamIdx / MAX_CAMERA;
+    STREAM_CAM_COMM_INFO_t  *pCommInfo = &liveStreamCommInfo[streamType][camIndex];
+
+    if (startF == TRUE)
+    {
+        /* Stream is started again only after live stream thread has taken its stop */
+        MUTEX_LOCK(pCommInfo->tcpCamLock);
+        if (pCommInfo->tcpCommFd != INVALID_CONNECTION)
+        {
+            MUTEX_UNLOCK(pCommInfo->tcpCamLock);
+            return;
+        }
+        pCommInfo->tcpCommFd = connectTestCamera(streamIdx);
+        pCommInfo->tcpFrameCb = testFrameCb;
+        MUTEX_UNLOCK(pCommInfo->tcpCamLock);
+
+        if (pCommInfo->tcpCommFd == INVALID_CONNECTION)
+        {
+            return;
+        }
+
+        MUTEX_LOCK(pCommInfo->streamMutex);
+        pCommInfo->streamState = LIVE_STREAM_STATE;
+        MUTEX_UNLOCK(pCommInfo->streamMutex);
+    }
+    else
+    {
+        /* Stream is stopped only after live stream thread has taken its start */
+        MUTEX_LOCK(pCommInfo->streamMutex);
+        if (pCommInfo->streamState != RUN_STREAM_STATE)
+        {
+            MUTEX_UNLOCK(pCommInfo->streamMutex);
+            return;
+        }
+        MUTEX_UNLOCK(pCommInfo->streamMutex);
+    }
+
+    MUTEX_LOCK(liveStreamInfo[LIVE_STREAM].mutex);
+    liveStreamInfo[LIVE_STREAM].status[streamType][camIndex] = startF;
+    pthread_cond_broadcast(&liveStreamInfo[LIVE_STREAM].signal);
+    MUTEX_UNLOCK(liveStreamInfo[LIVE_STREAM].mutex);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Get streams which are not stopped by live stream threads yet. Stream can have frame buffer only
+ *          till its stop is taken, as buffer is given back to pool before its socket is cleared.
+ * @return  Number of running streams
+ */
+static UINT16 getRunningTestStreamCnt(void)
+{
+    UINT16                  streamIdx, runningCnt = 0;
+    STREAM_CAM_COMM_INFO_t  *pCommInfo;
+
+    for (streamIdx = 0; streamIdx < TEST_STREAM_CNT; streamIdx++)
+    {
+        pCommInfo = &liveStreamCommInfo[streamIdx / MAX_CAMERA][streamIdx % MAX_CAMERA];
+        MUTEX_LOCK(pCommInfo->tcpCamLock);
+        if (pCommInfo->tcpCommFd != INVALID_CONNECTION)
+        {
+            runningCnt++;
+        }
+        MUTEX_UNLOCK(pCommInfo->tcpCamLock);
+    }
+
+    return runningCnt;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check frame buffers held by streams and cached in pool. Each running stream holds at most one
+ *          buffer of largest class. While buffer grows, live stream thread holds new buffer before old one
+ *          goes back to pool.
+ * @param   pHeldSize - Size of frame buffers held by streams and pool
+ * @return  TRUE if frame buffers are within bound
+ */
+static BOOL isPoolMemoryInBound(UINT64 *pHeldSize)
+{
+    UINT64 maxHeldSize;
+
+    /* Streams are started only by this thread, so running streams are taken before buffers they can hold */
+    maxHeldSize = ((UINT64)(getRunningTestStreamCnt() + TEST_THREAD_CNT) * CI_MAX_FRAME_LEN) + CI_FRAME_BUF_POOL_CACHE_MAX;
+
+    MUTEX_LOCK(poolAllocLock);
+    *pHeldSize = poolAllocSize;
+    MUTEX_UNLOCK(poolAllocLock);
+
+    return (*pHeldSize <= maxHeldSize) ? TRUE : FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check frame buffers held by streams and pool and update peak of it
+ * @param   pOutOfBoundCnt
+ * @param   pPeakHeldSize
+ */
+static void checkPoolMemory(UINT32 *pOutOfBoundCnt, UINT64 *pPeakHeldSize)
+{
+    UINT64 heldSize;
+
+    if (isPoolMemoryInBound(&heldSize) == FALSE)
+    {
+        (*pOutOfBoundCnt)++;
+    }
+
+    if (heldSize > *pPeakHeldSize)
+    {
+        *pPeakHeldSize = heldSize;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Start and stop streams randomly while cameras send frames of all size classes. Then all streams
+ *          are started again and each of them must receive frames.
+ */
+static void testPoolStress(void)
+{
+    pthread_t   recvTid[TEST_THREAD_CNT], sendTid;
+    UINT8       threadIdx[TEST_THREAD_CNT], threadCnt;
+    UINT16      streamIdx;
+    UINT32      seed = 1, toggleCnt = 0, inconsistentCnt = 0, outOfBoundCnt = 0, waitCnt, frameCnt = 0;
+    UINT32      restartRecvCnt[TEST_STREAM_CNT];
+    UINT64      endTimeNs, peakHeldSize = 0;
+    BOOL        frameOnAllStreamF = FALSE;
+
+    if (openTestCameras() == FAIL)
+    {
+        UT_CHECK(FALSE);
+        return;
+    }
+
+    for (streamIdx = 0; streamIdx < TEST_STREAM_CNT; streamIdx++)
+    {
+        setTestStreamStatus(streamIdx, TRUE);
+    }
+
+    threadExitF = FALSE;
+    senderExitF = FALSE;
+    for (threadCnt = 0; threadCnt < TEST_THREAD_CNT; threadCnt++)
+    {
+        threadIdx[threadCnt] = threadCnt;
+        pthread_create(&recvTid[threadCnt], NULL, tcpLiveStream, &threadIdx[threadCnt]);
+    }
+    pthread_create(&sendTid, NULL, cameraSender, NULL);
+
+    endTimeNs = UtGetTimeNs() + ((UINT64)TEST_STRESS_TIME_MS * 1000000ULL);
+    while (UtGetTimeNs() < endTimeNs)
+    {
+        streamIdx = rand_r(&seed) % TEST_STREAM_CNT;
+        setTestStreamStatus(streamIdx, (liveStreamInfo[LIVE_STREAM].status[streamIdx / MAX_CAMERA][streamIdx % MAX_CAMERA] == TRUE) ? FALSE : TRUE);
+        toggleCnt++;
+
+        if (isPoolConsistent() == FALSE)
+        {
+            inconsistentCnt++;
+        }
+
+        checkPoolMemory(&outOfBoundCnt, &peakHeldSize);
+        usleep(TEST_TOGGLE_INTERVAL_US);
+    }
+
+    /* Stream which is stopped at last toggle is started again after its stop is taken */
+    memcpy(restartRecvCnt, frameRecvCnt, sizeof(restartRecvCnt));
+    endTimeNs = UtGetTimeNs() + ((UINT64)TEST_RESTART_TIME_MS * 1000000ULL);
+    while ((frameOnAllStreamF == FALSE) && (UtGetTimeNs() < endTimeNs))
+    {
+        frameOnAllStreamF = TRUE;
+        for (streamIdx = 0; streamIdx < TEST_STREAM_CNT; streamIdx++)
+        {
+            setTestStreamStatus(streamIdx, TRUE);
+            if (frameRecvCnt[streamIdx] == restartRecvCnt[streamIdx])
+            {
+                frameOnAllStreamF = FALSE;
+            }
+        }
+
+        if (isPoolConsistent() == FALSE)
+        {
+            inconsistentCnt++;
+        }
+
+        checkPoolMemory(&outOfBoundCnt, &peakHeldSize);
+        usleep(TEST_TOGGLE_INTERVAL_US);
+    }
+
+    /* All streams give their buffers back to pool on stop */
+    for (waitCnt = 0; (waitCnt < 200) && (getRunningTestStreamCnt() != 0); waitCnt++)
+    {
+        for (streamIdx = 0; streamIdx < TEST_STREAM_CNT; streamIdx++)
+        {
+            setTestStreamStatus(streamIdx, FALSE);
+        }
+        usleep(10000);
+    }
+
+    senderExitF = TRUE;
+    threadExitF = TRUE;
+    pthread_join(sendTid, NULL);
+
+    /* Live stream threads wait for start of any stream when all are stopped, so they are woken till they exit */
+    for (threadCnt = 0; threadCnt < TEST_THREAD_CNT; threadCnt++)
+    {
+        for (waitCnt = 0; waitCnt < 200; waitCnt++)
+        {
+            MUTEX_LOCK(liveStreamInfo[LIVE_STREAM].mutex);
+            pthread_cond_broadcast(&liveStreamInfo[LIVE_STREAM].signal);
+            MUTEX_UNLOCK(liveStreamInfo[LIVE_STREAM].mutex);
+            if (pthread_tryjoin_np(recvTid[threadCnt], NULL) == 0)
+            {
+                break;
+            }
+            usleep(10000);
+        }
+        UT_CHECK_MSG(waitCnt < 200, "[thread=%d]", threadCnt);
+    }
+
+    for (streamIdx = 0; streamIdx < TEST_STREAM_CNT; streamIdx++)
+    {
+        frameCnt += frameRecvCnt[streamIdx];
+    }
+
+    printf("pool stress: [streams=%d], [threads=%d], [toggles=%u], [frames=%u], [cacheSize=%u], [peakHeld=%llu KB]\n",
+           TEST_STREAM_CNT, TEST_THREAD_CNT, toggleCnt, frameCnt, ciFrameBufPool.cacheSize, peakHeldSize / KILO_BYTE);
+    UT_CHECK(getRunningTestStreamCnt() == 0);
+    UT_CHECK_MSG(inconsistentCnt == 0, "[inconsistent=%u]", inconsistentCnt);
+    UT_CHECK_MSG(outOfBoundCnt == 0, "[outOfBound=%u]", outOfBoundCnt);
+    UT_CHECK_MSG(poolAllocOverflowCnt == 0, "[allocOverflow=%u]", poolAllocOverflowCnt);
+    UT_CHECK_MSG(frameErrCnt == 0, "[frameErr=%u]", frameErrCnt);
+    UT_CHECK(frameOnAllStreamF == TRUE);
+    UT_CHECK(isPoolConsistent() == TRUE);
+    UT_CHECK(ciFrameBufPool.cacheSize <= CI_FRAME_BUF_POOL_CACHE_MAX);
+
+    /* No stream holds buffer after stop, so only cached buffers are left */
+    UT_CHECK_MSG(poolAllocSize == ciFrameBufPool.cacheSize, "[held=%llu], [cacheSize=%u]", poolAllocSize, ciFrameBufPool.cacheSize);
+
+    closeTestCameras();
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Main function of test
+ * @return  EXIT_SUCCESS if all checks pass
+ */
+int main(void)
+{
+    UINT8   streamType, camIndex;
+    UINT32  patternIdx;
+
+    MUTEX_INIT(liveStreamInfo[LIVE_STREAM].mutex, NULL);
+    pthread_cond_init(&liveStreamInfo[LIVE_STREAM].signal, NULL);
+    MUTEX_INIT(ciFrameBufPool.poolLock, NULL);
+    for (streamType = 0; streamType < MAX_STREAM; streamType++)
+    {
+        for (camIndex = 0; camIndex < MAX_CAMERA; camIndex++)
+        {
+            MUTEX_INIT(liveStreamCommInfo[streamType][camIndex].tcpCamLock, NULL);
+            MUTEX_INIT(liveStreamCommInfo[streamType][camIndex].streamMutex, NULL);
+            liveStreamCommInfo[streamType][camIndex].tcpCommFd = INVALID_CONNECTION;
+        }
+    }
+
+    for (patternIdx = 0; patternIdx < sizeof(testPattern); patternIdx++)
+    {
+        testPattern[patternIdx] = (UINT8)(patternIdx * 31);
+    }
+
+    testPoolChain();
+    testPoolStress();
+
+    return UT_RESULT("TcpClientPoolTest");
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
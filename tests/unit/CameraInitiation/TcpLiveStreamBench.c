@@ -0,0 +1,432 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       TcpLiveStreamBench.c
+@brief      Benchmark of camera initiated live stream receive over loopback TCP. Camera side sends
+            frames with its send time in payload and latency is measured when frame is given to
+            frame callback of stream. Live stream threads which wait on poll() are compared with
+            receive sweep of all streams in every 1 ms, which was done by single live stream thread
+            before. Cases with streams of several live stream threads, till max cameras of variant,
+            show latency when all threads receive at same time. CPU time taken when streams are
+            running but cameras send nothing is also reported.
+
+            Usage: TcpLiveStreamBench [frames per stream]
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Unit under test */
+#include "TcpClient.c"
+#include "UtilCommon.c"
+
+/* OS Includes */
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+/* Application Includes */
+#include "DeviceInfoStub.c"
+#include "TcpClientStub.c"
+#include "UnitTest.h"
+
+//#################################################################################################
+// @DEFINES
+//#################################################################################################
+#define BENCH_DEFAULT_FRAME_CNT     (100)
+#define BENCH_FRAME_INTERVAL_US     (10000)
+#define BENCH_GOP_LEN               (25)
+#define BENCH_I_FRAME_LEN           (96 * KILO_BYTE)
+#define BENCH_P_FRAME_LEN           (16 * KILO_BYTE)
+#define BENCH_IDLE_TIME_US          (500000)
+#define BENCH_SWEEP_INTERVAL_US     (1000)
+
+//#################################################################################################
+// @DATA TYPES
+//#################################################################################################
+typedef enum
+{
+    BENCH_RECV_POLL,
+    BENCH_RECV_SWEEP,
+    BENCH_RECV_MAX
+}BENCH_RECV_e;
+
+typedef struct
+{
+    UINT64  sendTimeNs;
+    UINT32  frameIdx;
+}BENCH_FRAME_STAMP_t;
+
+//#################################################################################################
+// @STATIC VARIABLES
+//#################################################################################################
+static const CHAR *benchRecvName[BENCH_RECV_MAX] = {"poll", "1ms sweep"};
+
+static INT32    camSendFd[MAX_CAMERA];
+static UINT8    benchStreamCnt;
+static UINT32   benchFrameCnt = BENCH_DEFAULT_FRAME_CNT;
+
+/* Updated by frame callback in receive threads and read by main thread after they are joined */
+static UINT64   *pLatencyNs;
+static UINT32   latencyCnt;
+static UINT32   nextFrameIdx[MAX_CAMERA];
+static UINT32   frameErrCnt;
+
+static volatile BOOL sweepExitF;
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Frame callback of camera interface. It takes latency from send time stamped by camera.
+ * @param   tcpFrame
+ */
+static void benchFrameCb(TCP_FRAME_INFO_t *tcpFrame)
+{
+    BENCH_FRAME_STAMP_t frameStamp;
+    UINT8               camIndex = tcpFrame->channel;
+    UINT32              latencyIdx;
+    UINT64              recvTimeNs = UtGetTimeNs();
+
+    if ((tcpFrame->state != START) || (camIndex >= benchStreamCnt))
+    {
+        return;
+    }
+
+    /* Frames of each camera must come in order and with length sent by camera. Camera is served by only
+     * one thread, but latency and error counts are shared by all threads. */
+    memcpy(&frameStamp, tcpFrame->dataPtr, sizeof(frameStamp));
+    if ((frameStamp.frameIdx != nextFrameIdx[camIndex]) || (tcpFrame->frameInfo.len
+            != (((frameStamp.frameIdx % BENCH_GOP_LEN) == 0) ? BENCH_I_FRAME_LEN : BENCH_P_FRAME_LEN)))
+    {
+        __atomic_add_fetch(&frameErrCnt, 1, __ATOMIC_RELAXED);
+    }
+
+    nextFrameIdx[camIndex] = frameStamp.frameIdx + 1;
+    latencyIdx = __atomic_fetch_add(&latencyCnt, 1, __ATOMIC_RELAXED);
+    if (latencyIdx < (benchFrameCnt * benchStreamCnt))
+    {
+        pLatencyNs[latencyIdx] = recvTimeNs - frameStamp.sendTimeNs;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Send frame of camera on stream socket in format of camera initiated live stream
+ * @param   sendFd
+ * @param   camIndex
+ * @param   frameIdx
+ * @param   pFrameBuf - Buffer for header and payload of I frame
+ */
+static void sendBenchFrame(INT32 sendFd, UINT8 camIndex, UINT32 frameIdx, UINT8PTR pFrameBuf)
+{
+    FRAME_HEADER_t      *pHeader = (FRAME_HEADER_t *)pFrameBuf;
+    BENCH_FRAME_STAMP_t frameStamp;
+    UINT32              payloadLen = ((frameIdx % BENCH_GOP_LEN) == 0) ? BENCH_I_FRAME_LEN : BENCH_P_FRAME_LEN;
+    UINT32              sendLen = 0;
+    ssize_t             sentLen;
+
+    memset(pHeader, 0, CI_FRAME_HEADER_LEN);
+    pHeader->magicCode = MAGIC_CODE;
+    pHeader->productType = CAM_PRODUCT_TYPE;
+    pHeader->mediaFrmLen = CI_FRAME_HEADER_LEN + payloadLen;
+    pHeader->chNo = camIndex;
+    pHeader->streamType = STREAM_TYPE_VIDEO;
+    pHeader->codecType = VIDEO_H264;
+    pHeader->frmType = ((frameIdx % BENCH_GOP_LEN) == 0) ? I_FRAME : P_FRAME;
+    pHeader->vidResolution = 1;
+
+    frameStamp.frameIdx = frameIdx;
+    frameStamp.sendTimeNs = UtGetTimeNs();
+    memcpy(pFrameBuf + CI_FRAME_HEADER_LEN, &frameStamp, sizeof(frameStamp));
+
+    while (sendLen < (CI_FRAME_HEADER_LEN + payloadLen))
+    {
+        sentLen = send(sendFd, pFrameBuf + sendLen, (CI_FRAME_HEADER_LEN + payloadLen) - sendLen, MSG_NOSIGNAL);
+        if (sentLen <= 0)
+        {
+            break;
+        }
+        sendLen += sentLen;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Receive of live streams as done before. Receive is tried on every stream and then thread
+ *          sleeps for 1 ms, whether data is available or not.
+ * @param   threadArg
+ * @return
+ */
+static VOIDPTR sweepLiveStream(VOIDPTR threadArg)
+{
+    UINT8               camIndex;
+    FRAME_DATA_INFO_t   frameInfo[MAX_CAMERA];
+
+    for (camIndex = 0; camIndex < benchStreamCnt; camIndex++)
+    {
+        frameInfo[camIndex].payloadData = NULL;
+        frameInfo[camIndex].payloadBufClass = 0;
+        resetTcpLiveStreamFrameInfo(&frameInfo[camIndex]);
+        reserveTcpLiveStreamFrameBuf(&frameInfo[camIndex], ciFrameBufSize[0]);
+    }
+
+    while (sweepExitF == FALSE)
+    {
+        for (camIndex = 0; camIndex < benchStreamCnt; camIndex++)
+        {
+            recvTcpLiveStreamFrame(camIndex, MAIN_STREAM, liveStreamCommInfo[MAIN_STREAM][camIndex].tcpCommFd, &frameInfo[camIndex]);
+        }
+        usleep(BENCH_SWEEP_INTERVAL_US);
+    }
+
+    for (camIndex = 0; camIndex < benchStreamCnt; camIndex++)
+    {
+        releaseTcpLiveStreamFrameBuf(&frameInfo[camIndex]);
+    }
+    return NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Open loopback connections of cameras. Receive end is given to live stream of camera.
+ * @param   streamCnt
+ * @return  SUCCESS/FAIL
+ */
+static BOOL openBenchStreams(UINT8 streamCnt)
+{
+    struct sockaddr_in  addr;
+    socklen_t           addrLen = sizeof(addr);
+    INT32               listenFd, recvFd, optVal = 1;
+    UINT8               camIndex;
+
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if ((listenFd < 0) || (bind(listenFd, (struct sockaddr *)&addr, sizeof(addr)) != STATUS_OK)
+            || (listen(listenFd, streamCnt) != STATUS_OK) || (getsockname(listenFd, (struct sockaddr *)&addr, &addrLen) != STATUS_OK))
+    {
+        fprintf(stderr, "fail to listen on loopback: [err=%s]\n", STR_ERR);
+        if (listenFd >= 0)
+        {
+            close(listenFd);
+        }
+        return FAIL;
+    }
+
+    for (camIndex = 0; camIndex < streamCnt; camIndex++)
+    {
+        camSendFd[camIndex] = socket(AF_INET, SOCK_STREAM, 0);
+        if ((camSendFd[camIndex] < 0) || (connect(camSendFd[camIndex], (struct sockaddr *)&addr, sizeof(addr)) != STATUS_OK))
+        {
+            fprintf(stderr, "fail to connect on loopback: [camera=%d], [err=%s]\n", camIndex, STR_ERR);
+            close(listenFd);
+            return FAIL;
+        }
+        setsockopt(camSendFd[camIndex], IPPROTO_TCP, TCP_NODELAY, &optVal, sizeof(optVal));
+
+        recvFd = accept(listenFd, NULL, NULL);
+        liveStreamCommInfo[MAIN_STREAM][camIndex].tcpCommFd = recvFd;
+        liveStreamCommInfo[MAIN_STREAM][camIndex].tcpCommFdQueueIdx = 0;
+        liveStreamCommInfo[MAIN_STREAM][camIndex].streamState = LIVE_STREAM_STATE;
+        liveStreamCommInfo[MAIN_STREAM][camIndex].tcpFrameCb = benchFrameCb;
+        nextFrameIdx[camIndex] = 0;
+    }
+
+    close(listenFd);
+    benchStreamCnt = streamCnt;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Close loopback connections of cameras
+ */
+static void closeBenchStreams(void)
+{
+    UINT8 camIndex;
+
+    for (camIndex = 0; camIndex < benchStreamCnt; camIndex++)
+    {
+        close(camSendFd[camIndex]);
+        close(liveStreamCommInfo[MAIN_STREAM][camIndex].tcpCommFd);
+        liveStreamCommInfo[MAIN_STREAM][camIndex].tcpCommFd = INVALID_CONNECTION;
+        liveStreamCommInfo[MAIN_STREAM][camIndex].streamState = NONE_STREAM_STATE;
+        liveStreamInfo[LIVE_STREAM].status[MAIN_STREAM][camIndex] = FALSE;
+    }
+    benchStreamCnt = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Compare latency
+ * @param   pVal1
+ * @param   pVal2
+ * @return  Order of latency
+ */
+static int compareLatency(const void *pVal1, const void *pVal2)
+{
+    UINT64 val1 = *(const UINT64 *)pVal1, val2 = *(const UINT64 *)pVal2;
+
+    return (val1 > val2) - (val1 < val2);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Run live streams of cameras with given receiver and report frame latency and idle CPU time.
+ *          Live stream threads are started as needed for streams, as each of them serves its own range
+ *          of cameras. Receive sweep is done by single thread for all streams.
+ * @param   recvType
+ * @param   streamCnt
+ * @param   pFrameBuf
+ */
+static void runBenchCase(BENCH_RECV_e recvType, UINT8 streamCnt, UINT8PTR pFrameBuf)
+{
+    pthread_t       recvTid[MAX_TCP_LIVE_STREAM_THREAD];
+    UINT8           threadIdx[MAX_TCP_LIVE_STREAM_THREAD], threadCnt = 1, recvIdx, camIndex;
+    UINT32          frameIdx;
+    UINT64          totalLatencyNs = 0, cpuStartNs, cpuEndNs;
+    struct timespec cpuTime;
+    CHAR            caseName[64];
+
+    if (openBenchStreams(streamCnt) == FAIL)
+    {
+        UT_CHECK(FALSE);
+        return;
+    }
+    latencyCnt = 0;
+    frameErrCnt = 0;
+
+    if (recvType == BENCH_RECV_POLL)
+    {
+        threadExitF = FALSE;
+        MUTEX_LOCK(liveStreamInfo[LIVE_STREAM].mutex);
+        for (camIndex = 0; camIndex < streamCnt; camIndex++)
+        {
+            liveStreamInfo[LIVE_STREAM].status[MAIN_STREAM][camIndex] = TRUE;
+        }
+        pthread_cond_broadcast(&liveStreamInfo[LIVE_STREAM].signal);
+        MUTEX_UNLOCK(liveStreamInfo[LIVE_STREAM].mutex);
+
+        threadCnt = (streamCnt + TCP_LIVE_STREAM_CAMERA_PER_THREAD - 1) / TCP_LIVE_STREAM_CAMERA_PER_THREAD;
+        for (recvIdx = 0; recvIdx < threadCnt; recvIdx++)
+        {
+            threadIdx[recvIdx] = recvIdx;
+            pthread_create(&recvTid[recvIdx], NULL, tcpLiveStream, &threadIdx[recvIdx]);
+        }
+    }
+    else
+    {
+        sweepExitF = FALSE;
+        pthread_create(&recvTid[0], NULL, sweepLiveStream, NULL);
+    }
+
+    /* Let receiver take all streams and then measure CPU taken while cameras send nothing */
+    usleep(BENCH_IDLE_TIME_US / 10);
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpuTime);
+    cpuStartNs = ((UINT64)cpuTime.tv_sec * 1000000000ULL) + cpuTime.tv_nsec;
+    usleep(BENCH_IDLE_TIME_US);
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpuTime);
+    cpuEndNs = ((UINT64)cpuTime.tv_sec * 1000000000ULL) + cpuTime.tv_nsec;
+
+    for (frameIdx = 0; frameIdx < benchFrameCnt; frameIdx++)
+    {
+        for (camIndex = 0; camIndex < streamCnt; camIndex++)
+        {
+            sendBenchFrame(camSendFd[camIndex], camIndex, frameIdx, pFrameBuf);
+        }
+        usleep(BENCH_FRAME_INTERVAL_US);
+    }
+
+    /* Last frames are given before receiver is stopped */
+    usleep(BENCH_FRAME_INTERVAL_US * 5);
+    if (recvType == BENCH_RECV_POLL)
+    {
+        threadExitF = TRUE;
+    }
+    else
+    {
+        sweepExitF = TRUE;
+    }
+
+    for (recvIdx = 0; recvIdx < threadCnt; recvIdx++)
+    {
+        pthread_join(recvTid[recvIdx], NULL);
+    }
+
+    for (frameIdx = 0; frameIdx < latencyCnt; frameIdx++)
+    {
+        totalLatencyNs += pLatencyNs[frameIdx];
+    }
+    qsort(pLatencyNs, latencyCnt, sizeof(UINT64), compareLatency);
+
+    snprintf(caseName, sizeof(caseName), "%s, %d streams, %d threads", benchRecvName[recvType], streamCnt, threadCnt);
+    UtPrintBench(caseName, latencyCnt, totalLatencyNs);
+    if (latencyCnt > 0)
+    {
+        printf("       %-40s [p50=%.1fus], [p99=%.1fus], [max=%.1fus], [idleCpu=%.1fms/s]\n", "",
+               pLatencyNs[latencyCnt / 2] / 1000.0, pLatencyNs[(latencyCnt * 99) / 100] / 1000.0, pLatencyNs[latencyCnt - 1] / 1000.0,
+               ((cpuEndNs - cpuStartNs) / 1000000.0) / (BENCH_IDLE_TIME_US / 1000000.0));
+    }
+
+    UT_CHECK_MSG(latencyCnt == (benchFrameCnt * streamCnt), "[case=%s], [frames=%u]", caseName, latencyCnt);
+    UT_CHECK_MSG(frameErrCnt == 0, "[case=%s], [frameErr=%u]", caseName, frameErrCnt);
+    closeBenchStreams();
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Main function of benchmark
+ * @param   argc
+ * @param   argv - Optional frames per stream
+ * @return  EXIT_SUCCESS if all frames are received in order
+ */
+int main(int argc, char *argv[])
+{
+    static const UINT8  streamCntList[] = {1, TCP_LIVE_STREAM_CAMERA_PER_THREAD, 64, MAX_CAMERA};
+    UINT8PTR            pFrameBuf;
+    UINT8               recvType, caseIdx;
+
+    if ((argc > 1) && (atoi(argv[1]) > 0))
+    {
+        benchFrameCnt = atoi(argv[1]);
+    }
+
+    /* Frame header of camera is received in fixed length header */
+    UT_CHECK(sizeof(FRAME_HEADER_t) == CI_FRAME_HEADER_LEN);
+
+    MUTEX_INIT(liveStreamInfo[LIVE_STREAM].mutex, NULL);
+    pthread_cond_init(&liveStreamInfo[LIVE_STREAM].signal, NULL);
+    MUTEX_INIT(ciFrameBufPool.poolLock, NULL);
+    for (caseIdx = 0; caseIdx < MAX_CAMERA; caseIdx++)
+    {
+        MUTEX_INIT(liveStreamCommInfo[MAIN_STREAM][caseIdx].tcpCamLock, NULL);
+        MUTEX_INIT(liveStreamCommInfo[MAIN_STREAM][caseIdx].streamMutex, NULL);
+        liveStreamCommInfo[MAIN_STREAM][caseIdx].tcpCommFd = INVALID_CONNECTION;
+    }
+
+    pFrameBuf = malloc(CI_FRAME_HEADER_LEN + BENCH_I_FRAME_LEN);
+    pLatencyNs = malloc(sizeof(UINT64) * benchFrameCnt * MAX_CAMERA);
+    if ((pFrameBuf == NULL) || (pLatencyNs == NULL))
+    {
+        return EXIT_FAILURE;
+    }
+    memset(pFrameBuf, 0xA5, CI_FRAME_HEADER_LEN + BENCH_I_FRAME_LEN);
+
+    for (caseIdx = 0; caseIdx < (sizeof(streamCntList) / sizeof(streamCntList[0])); caseIdx++)
+    {
+        for (recvType = 0; recvType < BENCH_RECV_MAX; recvType++)
+        {
+            runBenchCase(recvType, streamCntList[caseIdx], pFrameBuf);
+        }
+    }
+
+    free(pFrameBuf);
+    free(pLatencyNs);
+    return UT_RESULT("TcpLiveStreamBench");
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
@@ -0,0 +1,51 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       DebugLogStub.c
+@brief      Debug log of application for host unit tests. Logs are printed on stderr only when
+            UT_VERBOSE environment variable is set, so test output stays readable.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* OS Includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+
+/* Application Includes */
+#include "DebugLog.h"
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Print debug log of module on stderr
+ * @param   priority
+ * @param   mod
+ * @param   severity
+ * @param   func
+ * @param   line
+ * @param   format
+ */
+void DebugPrint(UINT8 priority, LOG_LEVEL_MODULE mod, CHAR severity, const CHARPTR func, UINT32 line, CHAR const *format, ...)
+{
+    va_list args;
+
+    if (NULL == getenv("UT_VERBOSE"))
+    {
+        return;
+    }
+
+    fprintf(stderr, "[%c] %s:%u: ", severity, func, line);
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+    fprintf(stderr, "\n");
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
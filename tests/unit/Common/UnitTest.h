@@ -0,0 +1,96 @@
+#if !defined UNIT_TEST_H
+#define UNIT_TEST_H
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       UnitTest.h
+@brief      Check and timing helpers of host unit tests and benchmarks. Test includes source file of
+            its unit, so static functions and data of unit are directly accessible to test.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* OS Includes */
+#include <stdio.h>
+#include <time.h>
+
+/* Application Includes */
+#include "MxTypedef.h"
+
+//#################################################################################################
+// @DEFINES
+//#################################################################################################
+/* Check condition, failure is counted and reported with its location */
+#define UT_CHECK(cond)                                                                      \
+    do                                                                                      \
+    {                                                                                       \
+        utCheckCnt++;                                                                       \
+        if (!(cond))                                                                        \
+        {                                                                                   \
+            utFailCnt++;                                                                    \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);       \
+        }                                                                                   \
+    } while (0)
+
+/* Check condition with formatted detail of failure */
+#define UT_CHECK_MSG(cond, ...)                                                             \
+    do                                                                                      \
+    {                                                                                       \
+        utCheckCnt++;                                                                       \
+        if (!(cond))                                                                        \
+        {                                                                                   \
+            utFailCnt++;                                                                    \
+            fprintf(stderr, "%s:%d: check failed: %s: ", __FILE__, __LINE__, #cond);       \
+            fprintf(stderr, __VA_ARGS__);                                                   \
+            fprintf(stderr, "\n");                                                          \
+        }                                                                                   \
+    } while (0)
+
+/* Benchmark loop body is not merged or hoisted by compiler across this barrier */
+#define UT_BARRIER()    __asm__ __volatile__("" ::: "memory")
+
+/* Print summary of test and give exit status of test */
+#define UT_RESULT(name)                                                                     \
+    (printf("%s: %s: [checks=%u], [failed=%u]\n", name, (utFailCnt == 0) ? "PASS" : "FAIL", \
+            utCheckCnt, utFailCnt), (utFailCnt == 0) ? EXIT_SUCCESS : EXIT_FAILURE)
+
+//#################################################################################################
+// @STATIC VARIABLES
+//#################################################################################################
+static UINT32 utCheckCnt = 0;
+static UINT32 utFailCnt = 0;
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Get monotonic time for benchmark
+ * @return  Time in nano seconds
+ */
+static inline UINT64 UtGetTimeNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((UINT64)ts.tv_sec * 1000000000ULL) + (UINT64)ts.tv_nsec;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Print benchmark result in common format
+ * @param   name - Benchmark case name
+ * @param   iterCnt - Number of iterations run
+ * @param   elapsedNs - Time taken by all iterations
+ */
+static inline void UtPrintBench(const CHAR *name, UINT64 iterCnt, UINT64 elapsedNs)
+{
+    printf("bench: %-40s [iter=%llu], [ns/iter=%.1f]\n", name, (unsigned long long)iterCnt,
+           (iterCnt != 0) ? ((double)elapsedNs / (double)iterCnt) : 0.0);
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
+#endif // UNIT_TEST_H
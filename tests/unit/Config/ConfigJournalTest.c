@@ -0,0 +1,276 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       ConfigJournalTest.c
+@brief      Test of config journal failure handling. Failed commit drops records of every open batch
+            while master copies are already updated, so master copies of dropped configs must be
+            written again. Journal which could not be compacted at start-up must be replayed in
+            master copies and kept up to its last commit record. Commit is failed by replacing fd of
+            journal with read-only fd.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* OS Includes */
+#include <semaphore.h>
+
+/* Unit under test */
+#include "Utils.c"
+#include "Config.c"
+#include "ConfigFileIO.c"
+
+/* Application Includes */
+#include "ConfigStoreStub.c"
+#include "DeviceInfoStub.c"
+#include "UnitTest.h"
+
+//#################################################################################################
+// @STATIC VARIABLES
+//#################################################################################################
+/* Writable journal of config store and read-only fd which fails every journal write */
+static INT32 journalFd;
+static INT32 readOnlyFd;
+
+/* Batch of other thread is started before and ended after failed commit of main thread */
+static sem_t batchStartedSem;
+static sem_t batchEndSem;
+static BOOL  otherBatchStatus;
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Make every journal write fail or work again. Records written on failing fd are not in
+ *          journal file, so journal file is truncated to its last commit as failed commit does.
+ * @param   failF
+ */
+static void setJournalWriteFail(BOOL failF)
+{
+    MUTEX_LOCK(configJournal.lock);
+    configJournal.fd = (failF == TRUE) ? readOnlyFd : journalFd;
+    if (failF == FALSE)
+    {
+        UT_CHECK(ftruncate(journalFd, configJournal.commitSize) == STATUS_OK);
+    }
+    MUTEX_UNLOCK(configJournal.lock);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Replay committed records of journal in master copy of given config only. Master copy is
+ *          cleared before, so it has only data of committed records after replay.
+ * @param   configId
+ */
+static void replayCommittedConfig(UINT8 configId)
+{
+    UINT8PTR    journalBuf;
+    UINT32      offset, configSize;
+
+    memset(replayConfigF, FALSE, sizeof(replayConfigF));
+    replayConfigF[configId] = TRUE;
+    getConfigOffsetAndSize(configId, WHOLE_CONFIG, 0, 0, &offset, &configSize);
+
+    MUTEX_LOCK(configJournal.lock);
+    memset((sysConfigParam + configId)->memPtr, 0, configSize);
+    journalBuf = readConfigJournal();
+    UT_CHECK(journalBuf != NULL);
+    if (journalBuf != NULL)
+    {
+        UT_CHECK(applyConfigJournal(journalBuf, configJournal.fileSize, TRUE, NULL) == SUCCESS);
+        free(journalBuf);
+    }
+    MUTEX_UNLOCK(configJournal.lock);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Failed commit of batch must write master copies of batch configs again. If that fails
+ *          too, batch fails and configs are written again by next restore.
+ */
+static void testBatchCommitFailure(void)
+{
+    GENERAL_CONFIG_t    generalCfg;
+
+    ReadGeneralConfig(&generalCfg);
+    snprintf(generalCfg.deviceName, sizeof(generalCfg.deviceName), "JournalTestNvr");
+
+    /* Commit fails and restore written on working journal keeps master copy */
+    BeginConfigJournalBatch();
+    UT_CHECK(WriteGeneralConfig(&generalCfg) == CMD_SUCCESS);
+    setJournalWriteFail(TRUE);
+    MUTEX_LOCK(configJournal.lock);
+    UT_CHECK(commitConfigJournal() == FAIL);
+    UT_CHECK(configJournal.restoreF[GENERAL_CONFIG_ID] == TRUE);
+    MUTEX_UNLOCK(configJournal.lock);
+    setJournalWriteFail(FALSE);
+    UT_CHECK(EndConfigJournalBatch() == SUCCESS);
+    UT_CHECK(configJournal.restorePendingF == FALSE);
+    UT_CHECK(configJournal.restoreF[GENERAL_CONFIG_ID] == FALSE);
+    UT_CHECK(configJournal.fileSize == configJournal.commitSize);
+
+    replayCommittedConfig(GENERAL_CONFIG_ID);
+    ReadGeneralConfig(&generalCfg);
+    UT_CHECK_MSG(strcmp(generalCfg.deviceName, "JournalTestNvr") == 0, "[deviceName=%s]", generalCfg.deviceName);
+
+    /* Restore fails too, so batch fails and config stays marked for next restore */
+    snprintf(generalCfg.deviceName, sizeof(generalCfg.deviceName), "JournalTestNvr2");
+    BeginConfigJournalBatch();
+    UT_CHECK(WriteGeneralConfig(&generalCfg) == CMD_SUCCESS);
+    setJournalWriteFail(TRUE);
+    UT_CHECK(EndConfigJournalBatch() == FAIL);
+    UT_CHECK(configJournal.restorePendingF == TRUE);
+    UT_CHECK(configJournal.restoreF[GENERAL_CONFIG_ID] == TRUE);
+    setJournalWriteFail(FALSE);
+
+    UT_CHECK(restoreDroppedConfigs() == SUCCESS);
+    replayCommittedConfig(GENERAL_CONFIG_ID);
+    ReadGeneralConfig(&generalCfg);
+    UT_CHECK_MSG(strcmp(generalCfg.deviceName, "JournalTestNvr2") == 0, "[deviceName=%s]", generalCfg.deviceName);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Thread which writes camera name in batch while commit of main thread fails
+ * @param   arg
+ * @return  NULL
+ */
+static VOIDPTR otherBatchThread(VOIDPTR arg)
+{
+    CAMERA_CONFIG_t cameraCfg;
+
+    BeginConfigJournalBatch();
+    ReadSingleCameraConfig(0, &cameraCfg);
+    snprintf(cameraCfg.name, sizeof(cameraCfg.name), "JournalTestCam");
+    WriteSingleCameraConfig(0, &cameraCfg);
+    sem_post(&batchStartedSem);
+
+    sem_wait(&batchEndSem);
+    otherBatchStatus = EndConfigJournalBatch();
+    return NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Failed commit of one thread drops records of batch of other thread. Other thread must
+ *          get its configs written again when its batch ends.
+ */
+static void testOtherBatchDropped(void)
+{
+    CAMERA_CONFIG_t     cameraCfg;
+    DATE_TIME_CONFIG_t  dateTimeCfg;
+    pthread_t           otherThread;
+
+    sem_init(&batchStartedSem, 0, 0);
+    sem_init(&batchEndSem, 0, 0);
+    UT_CHECK(pthread_create(&otherThread, NULL, otherBatchThread, NULL) == 0);
+    sem_wait(&batchStartedSem);
+
+    /* Batch of main thread fails with restore of both threads' configs */
+    ReadDateTimeConfig(&dateTimeCfg);
+    dateTimeCfg.autoUpdateRegional = (dateTimeCfg.autoUpdateRegional == TRUE) ? FALSE : TRUE;
+    BeginConfigJournalBatch();
+    UT_CHECK(WriteDateTimeConfig(&dateTimeCfg) == CMD_SUCCESS);
+    setJournalWriteFail(TRUE);
+    UT_CHECK(EndConfigJournalBatch() == FAIL);
+    UT_CHECK(configJournal.restoreF[CAMERA_CONFIG_ID] == TRUE);
+    UT_CHECK(configJournal.restoreF[DATE_TIME_CONFIG_ID] == TRUE);
+    setJournalWriteFail(FALSE);
+
+    sem_post(&batchEndSem);
+    pthread_join(otherThread, NULL);
+    UT_CHECK(otherBatchStatus == SUCCESS);
+    UT_CHECK(configJournal.restorePendingF == FALSE);
+
+    replayCommittedConfig(CAMERA_CONFIG_ID);
+    ReadSingleCameraConfig(0, &cameraCfg);
+    UT_CHECK_MSG(strcmp(cameraCfg.name, "JournalTestCam") == 0, "[name=%s]", cameraCfg.name);
+    sem_destroy(&batchStartedSem);
+    sem_destroy(&batchEndSem);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Journal which could not be compacted at start-up must be applied in master copies of
+ *          configs whose files were of current version, without its uncommitted records, and must
+ *          be continued from its last commit record
+ */
+static void testReplayAtStartup(void)
+{
+    GENERAL_CONFIG_t    generalCfg;
+    DATE_TIME_CONFIG_t  dateTimeCfg, oldDateTimeCfg;
+    UINT32              offset, configSize, commitSize;
+    struct stat         fileInfo;
+
+    getConfigOffsetAndSize(GENERAL_CONFIG_ID, WHOLE_CONFIG, 0, 0, &offset, &configSize);
+    ReadGeneralConfig(&generalCfg);
+    ReadDateTimeConfig(&oldDateTimeCfg);
+
+    /* Journal left by previous run: committed general and date time, then uncommitted general */
+    MUTEX_LOCK(configJournal.lock);
+    UT_CHECK(ftruncate(journalFd, 0) == STATUS_OK);
+    configJournal.fileSize = 0;
+    configJournal.commitSize = 0;
+    snprintf(generalCfg.deviceName, sizeof(generalCfg.deviceName), "ReplayNvr");
+    UT_CHECK(appendConfigJournalRec(GENERAL_CONFIG_ID, &generalCfg, offset, configSize) == SUCCESS);
+    dateTimeCfg = oldDateTimeCfg;
+    dateTimeCfg.autoUpdateRegional = (dateTimeCfg.autoUpdateRegional == TRUE) ? FALSE : TRUE;
+    UT_CHECK(appendConfigJournalRec(DATE_TIME_CONFIG_ID, &dateTimeCfg, 0, sizeof(dateTimeCfg)) == SUCCESS);
+    UT_CHECK(commitConfigJournal() == SUCCESS);
+    commitSize = configJournal.commitSize;
+    snprintf(generalCfg.deviceName, sizeof(generalCfg.deviceName), "UncommittedNvr");
+    UT_CHECK(appendConfigJournalRec(GENERAL_CONFIG_ID, &generalCfg, offset, configSize) == SUCCESS);
+    configJournal.commitSize = configJournal.fileSize;
+    memset(configJournal.uncommittedF, FALSE, sizeof(configJournal.uncommittedF));
+
+    /* Only general config file was of current version when recovery failed */
+    memset(replayConfigF, FALSE, sizeof(replayConfigF));
+    replayConfigF[GENERAL_CONFIG_ID] = TRUE;
+    replayJournalF = TRUE;
+    MUTEX_UNLOCK(configJournal.lock);
+
+    replayConfigJournal();
+    UT_CHECK(replayJournalF == FALSE);
+    UT_CHECK(configJournal.fd == journalFd);
+    UT_CHECK(configJournal.fileSize == commitSize);
+    UT_CHECK(configJournal.commitSize == commitSize);
+    UT_CHECK((fstat(journalFd, &fileInfo) == STATUS_OK) && (fileInfo.st_size == commitSize));
+
+    ReadGeneralConfig(&generalCfg);
+    UT_CHECK_MSG(strcmp(generalCfg.deviceName, "ReplayNvr") == 0, "[deviceName=%s]", generalCfg.deviceName);
+    ReadDateTimeConfig(&dateTimeCfg);
+    UT_CHECK(memcmp(&dateTimeCfg, &oldDateTimeCfg, sizeof(dateTimeCfg)) == 0);
+
+    /* New update is appended after the last commit and committed records are still in journal */
+    snprintf(generalCfg.deviceName, sizeof(generalCfg.deviceName), "AfterReplayNvr");
+    UT_CHECK(WriteGeneralConfig(&generalCfg) == CMD_SUCCESS);
+    UT_CHECK(configJournal.commitSize > commitSize);
+    replayCommittedConfig(GENERAL_CONFIG_ID);
+    ReadGeneralConfig(&generalCfg);
+    UT_CHECK_MSG(strcmp(generalCfg.deviceName, "AfterReplayNvr") == 0, "[deviceName=%s]", generalCfg.deviceName);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Main function of test
+ * @return  EXIT_SUCCESS if all checks pass, EXIT_FAILURE otherwise
+ */
+int main(void)
+{
+    UT_CHECK(initDfltConfigStore() == SUCCESS);
+    journalFd = configJournal.fd;
+    readOnlyFd = open("/dev/null", O_RDONLY);
+    UT_CHECK(readOnlyFd != INVALID_FILE_FD);
+
+    testBatchCommitFailure();
+    testOtherBatchDropped();
+    testReplayAtStartup();
+
+    close(readOnlyFd);
+    return UT_RESULT("ConfigJournalTest");
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
@@ -0,0 +1,458 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       PlaybackReadBench.c
+@brief      Benchmark of playback frame read. Recording folder is replayed through SetPlayPosition()
+            and ReadRecordFrame() in forward, i-frame only and reverse play. Frames given are compared
+            with disk reads made by read ahead windows of session and with reads which were made per
+            frame before (FSH, payload and next FSH, and i-frame field for i-frame play).
+
+            Usage: PlaybackReadBench [recording hour folder]
+            Hour folder is taken from recording disk (having *.stm<N> and metaData.ifrm files). If it
+            is not given, a recording of generated frames is made in temporary folder and frame order
+            given by playback is also checked.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Unit under test */
+#include "DiskManager.c"
+
+/* Application Includes */
+#include "UnitTest.h"
+
+//#################################################################################################
+// @DEFINES
+//#################################################################################################
+#define BENCH_PLAY_SESSION      (0)
+#define BENCH_FRAME_RATE        (25)
+#define BENCH_GOP_LEN           (25)
+#define BENCH_RECORD_SEC        (120)
+#define BENCH_I_FRAME_LEN       (80 * KILO_BYTE)
+#define BENCH_P_FRAME_LEN       (10 * KILO_BYTE)
+#define BENCH_START_TIME_SEC    (1700000000)
+
+/* Reads made per frame by playback before read ahead windows */
+#define OLD_READ_PER_FRAME      (3)
+#define OLD_READ_PER_I_FRAME    (3)
+
+//#################################################################################################
+// @DATA TYPES
+//#################################################################################################
+typedef struct
+{
+    const CHAR          *name;
+    PLAYBACK_CMD_e      playCmd;
+    NW_FRAME_TYPE_e     frameType;
+    PLAYBACK_SPEED_e    speed;
+    UINT32              oldReadPerFrame;
+}BENCH_PLAY_CASE_t;
+
+//#################################################################################################
+// @STATIC VARIABLES
+//#################################################################################################
+static const BENCH_PLAY_CASE_t benchPlayCase[] =
+{
+    {"forward play",            PLAY_FORWARD,   NW_ANY_FRAME,   PLAY_1X,    OLD_READ_PER_FRAME},
+    {"forward i-frame play",    PLAY_FORWARD,   NW_I_FRAME,     PLAY_16X,   OLD_READ_PER_I_FRAME},
+    {"reverse play",            PLAY_REVERSE,   NW_I_FRAME,     PLAY_1X,    OLD_READ_PER_I_FRAME},
+};
+
+/* Frame order is checked only for generated recording */
+static BOOL benchGeneratedF = FALSE;
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Storage is always available for benchmark
+ * @param   storageType
+ * @return  TRUE
+ */
+BOOL IsStorageOperationalForRead(RECORD_ON_DISK_e storageType)
+{
+    return TRUE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Close file and invalidate its descriptor
+ * @param   fileFd
+ */
+void CloseFileFd(INT32PTR fileFd)
+{
+    if (*fileFd != INVALID_FILE_FD)
+    {
+        close(*fileFd);
+        *fileFd = INVALID_FILE_FD;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Recorder stores local time as seconds, so it is converted without time zone
+ * @param   pBrokenTime
+ * @param   pLocalTimeInSec
+ * @return  SUCCESS
+ */
+BOOL ConvertLocalTimeInSec(const struct tm *pBrokenTime, time_t *pLocalTimeInSec)
+{
+    struct tm brokenTime = *pBrokenTime;
+
+    *pLocalTimeInSec = timegm(&brokenTime);
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Convert local time in seconds to broken time without time zone
+ * @param   pLocalTimeInSec
+ * @param   pBrokenTime
+ * @return  SUCCESS
+ */
+BOOL ConvertLocalTimeInBrokenTm(const time_t *pLocalTimeInSec, struct tm *pBrokenTime)
+{
+    gmtime_r(pLocalTimeInSec, pBrokenTime);
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Get max camera of variant
+ * @return  Max camera
+ */
+UINT8 getMaxCameraForCurrentVariant(void)
+{
+    return MAX_CAMERA;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Write recording hour folder of generated frames in same format as recorder
+ * @param   playDir - Folder with trailing '/'
+ * @return  SUCCESS/FAIL
+ */
+static BOOL writeBenchRecording(const CHAR *playDir)
+{
+    CHAR                fileName[MAX_FILE_NAME_SIZE];
+    FILE                *pStrmFile, *pIFrmFile;
+    STRM_FILE_HDR_t     strmHdr = {0};
+    METADATA_FILE_HDR_t iFrmHdr = {0};
+    FSH_INFO_t          fshData;
+    IFRM_FIELD_INFO_t   iFrmField;
+    UINT8PTR            payload = malloc(BENCH_I_FRAME_LEN);
+    UINT32              frameIdx, frameLen, curFshPos = STREAM_FILE_HDR_SIZE, prevFshPos = 0, iFrmCnt = 0;
+
+    snprintf(fileName, sizeof(fileName), "%s00_00_00.stm1", playDir);
+    pStrmFile = fopen(fileName, "w");
+    snprintf(fileName, sizeof(fileName), "%s%s", playDir, I_FRAME_FILE_NAME);
+    pIFrmFile = fopen(fileName, "w");
+    if ((pStrmFile == NULL) || (pIFrmFile == NULL) || (payload == NULL))
+    {
+        fprintf(stderr, "fail to create recording: [dir=%s], [err=%s]\n", playDir, STR_ERR);
+        if (pStrmFile != NULL)
+        {
+            fclose(pStrmFile);
+        }
+        if (pIFrmFile != NULL)
+        {
+            fclose(pIFrmFile);
+        }
+        free(payload);
+        return FAIL;
+    }
+
+    strmHdr.fileSign = STREAM_FILE_SIGN;
+    strmHdr.version = STREAM_FILE_VERSION;
+    fwrite(&strmHdr, STREAM_FILE_HDR_SIZE, 1, pStrmFile);
+
+    iFrmHdr.fileSign = IFRAME_FILE_SIGN;
+    iFrmHdr.version = IFRAME_FILE_VERSION;
+    iFrmHdr.nextMetaDataIdx = (BENCH_FRAME_RATE * BENCH_RECORD_SEC) / BENCH_GOP_LEN;
+    fwrite(&iFrmHdr, IFRAME_FILE_HDR_SIZE, 1, pIFrmFile);
+
+    for (frameIdx = 0; frameIdx < (BENCH_FRAME_RATE * BENCH_RECORD_SEC); frameIdx++)
+    {
+        frameLen = ((frameIdx % BENCH_GOP_LEN) == 0) ? BENCH_I_FRAME_LEN : BENCH_P_FRAME_LEN;
+
+        memset(&fshData, 0, sizeof(fshData));
+        fshData.startCode = FSH_START_CODE;
+        fshData.fps = BENCH_FRAME_RATE;
+        fshData.fshLen = MAX_FSH_SIZE + frameLen;
+        fshData.prevFshPos = prevFshPos;
+        fshData.nextFShPos = curFshPos + fshData.fshLen;
+        fshData.mediaType = STREAM_TYPE_VIDEO;
+        fshData.codecType = VIDEO_H264;
+        fshData.vop = ((frameIdx % BENCH_GOP_LEN) == 0) ? I_FRAME : P_FRAME;
+        fshData.localTime.totalSec = BENCH_START_TIME_SEC + (frameIdx / BENCH_FRAME_RATE);
+        fshData.localTime.mSec = (frameIdx % BENCH_FRAME_RATE) * (MSEC_IN_ONE_SEC / BENCH_FRAME_RATE);
+
+        if (fshData.vop == I_FRAME)
+        {
+            /* Field of i-frame is added and FSH keeps index number after it, same as recorder */
+            iFrmField.timeSec = fshData.localTime.totalSec;
+            iFrmField.curStrmPos = curFshPos;
+            iFrmField.strmFileId = 1;
+            iFrmField.diskId = 0;
+            iFrmField.reserved = 0;
+            fwrite(&iFrmField, IFRAME_FIELD_SIZE, 1, pIFrmFile);
+            iFrmCnt++;
+        }
+        fshData.iFrmIdxNo = iFrmCnt;
+
+        /* Payload starts with frame index, so replayed frame order can be checked */
+        memset(payload, (UINT8)frameIdx, frameLen);
+        memcpy(payload, &frameIdx, sizeof(frameIdx));
+
+        fwrite(&fshData, MAX_FSH_SIZE, 1, pStrmFile);
+        fwrite(payload, frameLen, 1, pStrmFile);
+        prevFshPos = curFshPos;
+        curFshPos += fshData.fshLen;
+    }
+
+    fclose(pStrmFile);
+    fclose(pIFrmFile);
+    free(payload);
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Drop page cache of recording files, so replay reads from disk
+ * @param   playDir
+ */
+static void dropRecordingCache(const CHAR *playDir)
+{
+    DIR             *pDir = opendir(playDir);
+    struct dirent   *pEntry;
+    CHAR            fileName[MAX_FILE_NAME_SIZE];
+    INT32           fileFd;
+
+    if (pDir == NULL)
+    {
+        return;
+    }
+
+    while ((pEntry = readdir(pDir)) != NULL)
+    {
+        snprintf(fileName, sizeof(fileName), "%s%s", playDir, pEntry->d_name);
+        fileFd = open(fileName, READ_ONLY_MODE);
+        if (fileFd != INVALID_FILE_FD)
+        {
+            posix_fadvise(fileFd, 0, 0, POSIX_FADV_DONTNEED);
+            close(fileFd);
+        }
+    }
+    closedir(pDir);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Prepare playback session on recording folder in same way as OpenPlaySession
+ * @param   playDir
+ * @return  SUCCESS/FAIL
+ */
+static BOOL openBenchSession(const CHAR *playDir)
+{
+    PLAYBACK_SESSION_t  *pPlaySession = &playSession[BENCH_PLAY_SESSION];
+    CHAR                fileName[MAX_FILE_NAME_SIZE];
+    UINT32              fileSize;
+    IFRM_FIELD_INFO_t   iFrmField;
+    struct stat         fileInfo;
+    INT32               fileFd;
+    UINT8               fileId;
+
+    memset(pPlaySession, 0, sizeof(PLAYBACK_SESSION_t));
+    snprintf(pPlaySession->playDir, MAX_FILE_NAME_SIZE, "%s", playDir);
+    pPlaySession->playStatus = ON;
+    pPlaySession->playCntrl.recStorageType = LOCAL_HARD_DISK;
+    pPlaySession->playInfo.streamFileFd = INVALID_FILE_FD;
+    pPlaySession->playInfo.iFrmFileFd = INVALID_FILE_FD;
+
+    for (fileId = 1; fileId < UINT8_MAX; fileId++)
+    {
+        if (getStreamFileName(pPlaySession->playDir, fileId, fileName, &fileSize) == FAIL)
+        {
+            break;
+        }
+    }
+    pPlaySession->startFileId = 1;
+    pPlaySession->stopFileId = fileId - 1;
+
+    /* Play duration of recording is taken from first and last i-frame of folder */
+    snprintf(fileName, sizeof(fileName), "%s%s", playDir, I_FRAME_FILE_NAME);
+    fileFd = open(fileName, READ_ONLY_MODE);
+    if ((pPlaySession->stopFileId == 0) || (fileFd == INVALID_FILE_FD) || (fstat(fileFd, &fileInfo) != STATUS_OK)
+            || (fileInfo.st_size < (off_t)(IFRAME_FILE_HDR_SIZE + IFRAME_FIELD_SIZE)))
+    {
+        fprintf(stderr, "recording not found: [dir=%s], [streamFiles=%d]\n", playDir, pPlaySession->stopFileId);
+        CloseFileFd(&fileFd);
+        return FAIL;
+    }
+
+    pread(fileFd, &iFrmField, IFRAME_FIELD_SIZE, IFRAME_FILE_HDR_SIZE);
+    pPlaySession->playStartTime = iFrmField.timeSec;
+    pread(fileFd, &iFrmField, IFRAME_FIELD_SIZE, IFRAME_FILE_HDR_SIZE
+          + ((((UINT32)fileInfo.st_size - IFRAME_FILE_HDR_SIZE) / IFRAME_FIELD_SIZE) - 1) * IFRAME_FIELD_SIZE);
+    pPlaySession->playStopTime = iFrmField.timeSec + SEC_IN_ONE_MIN;
+    close(fileFd);
+
+    pPlaySession->playBuff.buffSize = DEFUALT_PLAYBACK_SIZE;
+    pPlaySession->playBuff.buffPtr = malloc(DEFUALT_PLAYBACK_SIZE);
+    return (pPlaySession->playBuff.buffPtr != NULL) ? SUCCESS : FAIL;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Replay recording from start (or end in reverse) till play is over
+ * @param   playDir
+ * @param   pPlayCase
+ */
+static void replayRecording(const CHAR *playDir, const BENCH_PLAY_CASE_t *pPlayCase)
+{
+    PLAYBACK_SESSION_t      *pPlaySession = &playSession[BENCH_PLAY_SESSION];
+    FSH_INFO_t              fshData;
+    UINT8PTR                frameData;
+    UINT32                  frameLen, frameIdx, lastFrameIdx = UINT32_MAX;
+    UINT64                  nextFrameTime, startNs, elapsedNs, byteCnt = 0;
+    PLAYBACK_FILE_READ_e    errorCode;
+    time_t                  playPosSec;
+    struct tm               playPos;
+    BOOL                    orderOkF = TRUE;
+
+    dropRecordingCache(playDir);
+    if (openBenchSession(playDir) == FAIL)
+    {
+        UT_CHECK(FALSE);
+        return;
+    }
+
+    playPosSec = (pPlayCase->playCmd == PLAY_REVERSE) ? (pPlaySession->playStopTime - SEC_IN_ONE_MIN) : pPlaySession->playStartTime;
+    ConvertLocalTimeInBrokenTm(&playPosSec, &playPos);
+
+    startNs = UtGetTimeNs();
+    UT_CHECK(SetPlayPosition(&playPos, 0, ENABLE, pPlayCase->playCmd, pPlayCase->speed, BENCH_PLAY_SESSION) == SUCCESS);
+
+    /* Read ahead counters are compared with frames given by ReadRecordFrame only */
+    pPlaySession->frameCnt = 0;
+    pPlaySession->diskReadCnt = 0;
+    do
+    {
+        frameLen = 0;
+        errorCode = PLAYBACK_FILE_READ_NORMAL;
+        if (ReadRecordFrame(BENCH_PLAY_SESSION, pPlayCase->playCmd, pPlayCase->frameType, &fshData, &frameData,
+                            &frameLen, &errorCode, &nextFrameTime) == FAIL)
+        {
+            break;
+        }
+
+        byteCnt += frameLen;
+        if ((benchGeneratedF == TRUE) && (frameLen >= sizeof(frameIdx)))
+        {
+            memcpy(&frameIdx, frameData, sizeof(frameIdx));
+            if ((frameData[frameLen - 1] != (UINT8)frameIdx) || ((lastFrameIdx != UINT32_MAX)
+                    && ((pPlayCase->playCmd == PLAY_REVERSE) ? (frameIdx >= lastFrameIdx) : (frameIdx <= lastFrameIdx))))
+            {
+                orderOkF = FALSE;
+            }
+
+            if ((pPlayCase->frameType == NW_ANY_FRAME) && (lastFrameIdx != UINT32_MAX) && (frameIdx != (lastFrameIdx + 1)))
+            {
+                orderOkF = FALSE;
+            }
+            lastFrameIdx = frameIdx;
+        }
+
+    } while (errorCode == PLAYBACK_FILE_READ_NORMAL);
+    elapsedNs = UtGetTimeNs() - startNs;
+
+    UtPrintBench(pPlayCase->name, pPlaySession->frameCnt, elapsedNs);
+    printf("       %-40s [frames=%u], [MB=%.1f], [diskReads=%u], [readsBefore=%u]\n", "", pPlaySession->frameCnt,
+           (double)byteCnt / MEGA_BYTE, pPlaySession->diskReadCnt, pPlaySession->frameCnt * pPlayCase->oldReadPerFrame);
+
+    UT_CHECK_MSG(pPlaySession->frameCnt > 0, "[case=%s]", pPlayCase->name);
+    UT_CHECK_MSG(pPlaySession->diskReadCnt < (pPlaySession->frameCnt * pPlayCase->oldReadPerFrame), "[case=%s]", pPlayCase->name);
+    if (benchGeneratedF == TRUE)
+    {
+        UT_CHECK_MSG(orderOkF == TRUE, "[case=%s]", pPlayCase->name);
+        if (pPlayCase->frameType == NW_ANY_FRAME)
+        {
+            /* Forward play starts from frame after play position, so first frame is not given */
+            UT_CHECK_MSG(pPlaySession->frameCnt == ((BENCH_FRAME_RATE * BENCH_RECORD_SEC) - 1), "[frames=%u]", pPlaySession->frameCnt);
+        }
+    }
+
+    ClosePlaySession(BENCH_PLAY_SESSION);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Remove generated recording
+ * @param   playDir
+ */
+static void removeBenchRecording(const CHAR *playDir)
+{
+    CHAR fileName[MAX_FILE_NAME_SIZE];
+
+    snprintf(fileName, sizeof(fileName), "%s00_00_00.stm1", playDir);
+    unlink(fileName);
+    snprintf(fileName, sizeof(fileName), "%s%s", playDir, I_FRAME_FILE_NAME);
+    unlink(fileName);
+    rmdir(playDir);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Main function of benchmark
+ * @param   argc
+ * @param   argv - Optional recording hour folder
+ * @return  EXIT_SUCCESS if all plays give frames
+ */
+int main(int argc, char *argv[])
+{
+    CHAR    playDir[MAX_FILE_NAME_SIZE];
+    CHAR    tmpDir[] = "/tmp/PlaybackReadBenchXXXXXX";
+    UINT8   caseIdx;
+
+    MUTEX_INIT(playbckSessionMutex, NULL);
+
+    if (argc > 1)
+    {
+        snprintf(playDir, sizeof(playDir), "%s%s", argv[1], (argv[1][strlen(argv[1]) - 1] == '/') ? "" : "/");
+    }
+    else
+    {
+        if (mkdtemp(tmpDir) == NULL)
+        {
+            fprintf(stderr, "fail to create temp dir: [err=%s]\n", STR_ERR);
+            return EXIT_FAILURE;
+        }
+
+        snprintf(playDir, sizeof(playDir), "%s/", tmpDir);
+        benchGeneratedF = TRUE;
+        if (writeBenchRecording(playDir) == FAIL)
+        {
+            removeBenchRecording(playDir);
+            return EXIT_FAILURE;
+        }
+    }
+
+    printf("replay: [dir=%s]\n", playDir);
+    for (caseIdx = 0; caseIdx < (sizeof(benchPlayCase) / sizeof(benchPlayCase[0])); caseIdx++)
+    {
+        replayRecording(playDir, &benchPlayCase[caseIdx]);
+    }
+
+    if (benchGeneratedF == TRUE)
+    {
+        removeBenchRecording(playDir);
+    }
+
+    return UT_RESULT("PlaybackReadBench");
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
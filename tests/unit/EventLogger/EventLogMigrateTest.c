@@ -0,0 +1,125 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       EventLogMigrateTest.c
+@brief      Test of migration of older version event log file, which kept write index and rollover
+            flag in separate count file. Records of older file are given to migration in mapped file
+            buffer. Newest event after migration must be record just before write index, next event
+            must be written at write index and header must be valid. Older file which has fewer
+            records than its write index is migrated with records present in file.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Unit under test */
+#include "EventLogger.c"
+
+/* Application Includes */
+#include "UnitTest.h"
+
+//#################################################################################################
+// @DEFINES
+//#################################################################################################
+/* Time of legacy record is made from its record index, so record can be identified after migration */
+#define TEST_RECORD_TIME(recordIdx)     ((time_t)(100000 + (recordIdx)))
+
+//#################################################################################################
+// @DATA TYPES
+//#################################################################################################
+typedef struct
+{
+    const CHAR  *name;
+    UINT8       rolloverFlag;
+    UINT16      writeIndex;
+    UINT32      legacyRecordCnt;    // Records present in older file
+    UINT64      writeSeq;           // Expected sequence of newest event after migration
+    UINT32      newestIdx;          // Expected record index of newest event
+}TEST_MIGRATE_CASE_t;
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Make older version event log in mapped file buffer and migrate it
+ * @param   pCase
+ */
+static void migrateLegacyCase(const TEST_MIGRATE_CASE_t *pCase)
+{
+    EVENT_CNT_t legacyCnt;
+    UINT32      recordIdx;
+    UINT64      newestSeq;
+
+    /* Older file had records from start of file */
+    memset(eventLogBaseAddr, 0, EVENT_LOG_FILE_SIZE);
+    for (recordIdx = 0; recordIdx < pCase->legacyRecordCnt; recordIdx++)
+    {
+        ((FILE_EVENT_LOG_t *)eventLogBaseAddr)[recordIdx].timeSec = TEST_RECORD_TIME(recordIdx);
+    }
+
+    legacyCnt.version = EVENT_LOG_LEGACY_VERSION;
+    legacyCnt.rolloverFlag = pCase->rolloverFlag;
+    legacyCnt.writeIndex = pCase->writeIndex;
+    migrateLegacyEventLog(&legacyCnt, (off_t)pCase->legacyRecordCnt * sizeof(FILE_EVENT_LOG_t));
+
+    UT_CHECK_MSG(eventWriteSeq == pCase->writeSeq, "[case=%s], [writeSeq=%llu]", pCase->name, eventWriteSeq);
+    newestSeq = eventWriteSeq;
+    if (newestSeq == EVENT_SEQ_NONE)
+    {
+        return;
+    }
+
+    /* Next event is written after newest one and it overwrites oldest one of rolled over log */
+    UT_CHECK_MSG(eventLogRecord[EVENT_SEQ_TO_INDEX(newestSeq)].timeSec == TEST_RECORD_TIME(pCase->newestIdx),
+                 "[case=%s], [newestTime=%ld]", pCase->name, (long)eventLogRecord[EVENT_SEQ_TO_INDEX(newestSeq)].timeSec);
+    UT_CHECK_MSG(EVENT_SEQ_TO_INDEX(newestSeq + 1) == ((pCase->newestIdx + 1) % MAX_EVENT_LOG), "[case=%s], [nextIndex=%u]",
+                 pCase->name, EVENT_SEQ_TO_INDEX(newestSeq + 1));
+    UT_CHECK_MSG(eventLogRecord[EVENT_SEQ_TO_INDEX(getOldestEventSeq())].timeSec
+                 == TEST_RECORD_TIME((pCase->rolloverFlag == SET) ? ((pCase->newestIdx + 1) % MAX_EVENT_LOG) : 0), "[case=%s]", pCase->name);
+
+    /* Header written by migration is loaded again */
+    eventWriteSeq = EVENT_SEQ_NONE;
+    UT_CHECK_MSG((loadEventLogHdr() == SUCCESS) && (eventWriteSeq == newestSeq), "[case=%s]", pCase->name);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Main function of test
+ * @return  EXIT_SUCCESS if all checks pass
+ */
+int main(void)
+{
+    const TEST_MIGRATE_CASE_t migrateCase[] =
+    {
+        {"empty",                   CLEAR,  0,                  0,                  EVENT_SEQ_NONE,             0},
+        {"not rolled over",         CLEAR,  1234,               1234,               1234,                       1233},
+        {"not rolled over, full",   CLEAR,  1234,               MAX_EVENT_LOG,      1234,                       1233},
+        {"short file",              CLEAR,  1234,               300,                300,                        299},
+        {"rolled over",             SET,    4321,               MAX_EVENT_LOG,      MAX_EVENT_LOG + 4321,       4320},
+        {"rolled over at start",    SET,    0,                  MAX_EVENT_LOG,      MAX_EVENT_LOG,              MAX_EVENT_LOG - 1},
+        {"rolled over at end",      SET,    MAX_EVENT_LOG - 1,  MAX_EVENT_LOG,      (2 * MAX_EVENT_LOG) - 1,    MAX_EVENT_LOG - 2},
+    };
+    UINT8 caseIdx;
+
+    /* Mapped file is given in memory as it is mapped by openEventLogFile() */
+    eventLogBaseAddr = malloc(EVENT_LOG_FILE_SIZE);
+    if (eventLogBaseAddr == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+    eventLogHdr = (EVENT_LOG_HDR_t *)eventLogBaseAddr;
+    eventLogRecord = (FILE_EVENT_LOG_t *)(eventLogBaseAddr + EVENT_LOG_HDR_SIZE);
+
+    for (caseIdx = 0; caseIdx < (sizeof(migrateCase) / sizeof(migrateCase[0])); caseIdx++)
+    {
+        migrateLegacyCase(&migrateCase[caseIdx]);
+    }
+
+    FREE_MEMORY(eventLogBaseAddr);
+    return UT_RESULT("EventLogMigrateTest");
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
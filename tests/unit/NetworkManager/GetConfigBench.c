@@ -0,0 +1,216 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       GetConfigBench.c
+@brief      Benchmark of get config reply composition with default configuration. Request of single
+            small table, whole camera table and all tables of configuration are given to
+            ProcessGetConfig(). Every table reply is composed from configuration when cache of table
+            replies is cleared before each request and it is copied from cache when configuration is
+            not changed. Reply of all tables is limited to receive buffer of client, which is larger than
+            reply buffer.
+
+            Usage: GetConfigBench [requests]
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Unit under test */
+#include "Utils.c"
+#include "Config.c"
+#include "ConfigFileIO.c"
+#include "NetworkCommand.c"
+#include "NetworkConfig.c"
+
+/* Application Includes */
+#include "ConfigStoreStub.c"
+#include "DeviceInfoStub.c"
+#include "NetworkManagerStub.c"
+#include "UnitTest.h"
+
+//#################################################################################################
+// @DEFINES
+//#################################################################################################
+#define BENCH_DEFAULT_REQ_CNT       (200)
+#define BENCH_REQ_STR_LEN_MAX       (MAX_GET_CFG_TABLE_REQ * 64)
+
+//#################################################################################################
+// @DATA TYPES
+//#################################################################################################
+typedef struct
+{
+    const CHAR  *name;
+    UINT16      fromTableId;
+    UINT16      toTableId;
+}BENCH_REQ_t;
+
+//#################################################################################################
+// @STATIC VARIABLES
+//#################################################################################################
+/* Reply sent to client */
+static UINT32   replyLen;
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Capture reply sent to client. Only length of reply is taken.
+ * @param   pSendBuff
+ * @param   buffLen
+ * @return  SUCCESS
+ */
+static BOOL captureTestReply(UINT8 *pSendBuff, UINT32 buffLen)
+{
+    replyLen += buffLen;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Remove all table replies from cache
+ */
+static void clearGetCfgCache(void)
+{
+    UINT8 tableId;
+
+    MUTEX_LOCK(getCfgCache.cacheLock);
+    for (tableId = 0; tableId < MAX_TBL_CFG; tableId++)
+    {
+        FREE_MEMORY(getCfgCache.entry[tableId].pText);
+    }
+    getCfgCache.cacheSize = 0;
+    MUTEX_UNLOCK(getCfgCache.cacheLock);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Make request of all indexes and fields of tables in range. Tables without table function
+ *          and tables whose whole reply does not fit in reply buffer are not requested, as request of
+ *          such table is replied with resource limit. Tables are requested till reply fits in receive
+ *          buffer of client.
+ * @param   pBenchReq
+ * @param   pReqStr
+ */
+static void makeTableRequest(const BENCH_REQ_t *pBenchReq, CHAR pReqStr[BENCH_REQ_STR_LEN_MAX])
+{
+    static CHAR tableReply[MAX_REPLY_SZ];
+    UINT16      tableId;
+    UINT32      reqLen = 0, expectedLen = 16, tableLen;
+
+    for (tableId = pBenchReq->fromTableId; tableId <= pBenchReq->toTableId; tableId++)
+    {
+        if (getCfgFuncPtr[tableId] == NULL)
+        {
+            continue;
+        }
+
+        /* Space of reply header is kept free as in reply */
+        if ((getCfgFuncPtr[tableId](0, totalIndexPerEveryTable[tableId] - 1, 0, maxFieldPerTable[tableId] - 1,
+                                    tableReply, sizeof(tableReply) - 16) != CMD_SUCCESS)
+                || ((tableLen = strlen(tableReply)) >= (sizeof(tableReply) - 16 - GET_CFG_REPLY_TAIL_LEN)))
+        {
+            continue;
+        }
+
+        /* Table id and its SOT, FSP and EOT are kept with table */
+        if ((expectedLen + tableLen + 8) >= (GET_CFG_NATIVE_REPLY_SZ - GET_CFG_REPLY_TAIL_LEN))
+        {
+            break;
+        }
+        expectedLen += tableLen + 8;
+
+        reqLen += snprintf(pReqStr + reqLen, BENCH_REQ_STR_LEN_MAX - reqLen, "%c%d%c%d%c%d%c%d%c%d%c%c",
+                           SOT, OUR_TO_CLIENT_INDEX(tableId), FSP, 1, FSP, totalIndexPerEveryTable[tableId], FSP,
+                           1, FSP, maxFieldPerTable[tableId], FSP, EOT);
+    }
+
+    snprintf(pReqStr + reqLen, BENCH_REQ_STR_LEN_MAX - reqLen, "%c", EOM);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Give same request many times and take time of composition of its reply
+ * @param   pReqStr
+ * @param   reqCnt
+ * @param   cacheF - FALSE to clear cache before every request
+ * @return  Time taken in nano seconds
+ */
+static UINT64 getConfigReplies(const CHAR *pReqStr, UINT32 reqCnt, BOOL cacheF)
+{
+    CHAR    reqStr[BENCH_REQ_STR_LEN_MAX];
+    UINT32  reqIdx;
+    UINT64  elapsedNs = 0, startNs;
+
+    for (reqIdx = 0; reqIdx < reqCnt; reqIdx++)
+    {
+        if (cacheF == FALSE)
+        {
+            clearGetCfgCache();
+        }
+
+        /* Request is parsed in place, hence it is given in copy */
+        snprintf(reqStr, sizeof(reqStr), "%s", pReqStr);
+        replyLen = 0;
+        startNs = UtGetTimeNs();
+        ProcessGetConfig(reqStr, 0, CLIENT_CB_TYPE_NATIVE);
+        elapsedNs += UtGetTimeNs() - startNs;
+        UT_BARRIER();
+    }
+
+    return elapsedNs;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Main function of benchmark
+ * @param   argc
+ * @param   argv - Optional requests per case
+ * @return  EXIT_SUCCESS if reply with cache is same size as reply without cache
+ */
+int main(int argc, char *argv[])
+{
+    const BENCH_REQ_t benchReq[] =
+    {
+        {"general table",   TBL_GENERAL_CFG,    TBL_GENERAL_CFG},
+        {"camera table",    TBL_CAMERA_CFG,     TBL_CAMERA_CFG},
+        {"all tables",      0,                  MAX_TBL_CFG - 1},
+    };
+    CHAR        reqStr[BENCH_REQ_STR_LEN_MAX];
+    CHAR        caseName[64];
+    UINT32      reqCnt = BENCH_DEFAULT_REQ_CNT, composeReplyLen;
+    UINT64      elapsedNs;
+    UINT8       reqIdx;
+
+    if ((argc > 1) && (atoi(argv[1]) > 0))
+    {
+        reqCnt = atoi(argv[1]);
+    }
+
+    UT_CHECK(initDfltConfigStore() == SUCCESS);
+    InitNetworkConfig();
+
+    for (reqIdx = 0; reqIdx < (sizeof(benchReq) / sizeof(benchReq[0])); reqIdx++)
+    {
+        makeTableRequest(&benchReq[reqIdx], reqStr);
+
+        elapsedNs = getConfigReplies(reqStr, reqCnt, FALSE);
+        composeReplyLen = replyLen;
+        snprintf(caseName, sizeof(caseName), "%s(%u bytes) compose", benchReq[reqIdx].name, replyLen);
+        UtPrintBench(caseName, reqCnt, elapsedNs);
+
+        /* Cache is filled by first request */
+        getConfigReplies(reqStr, 1, TRUE);
+        elapsedNs = getConfigReplies(reqStr, reqCnt, TRUE);
+        snprintf(caseName, sizeof(caseName), "%s(%u bytes) cached", benchReq[reqIdx].name, replyLen);
+        UtPrintBench(caseName, reqCnt, elapsedNs);
+        UT_CHECK_MSG(replyLen == composeReplyLen, "[req=%s]", benchReq[reqIdx].name);
+    }
+
+    clearGetCfgCache();
+    return UT_RESULT("GetConfigBench");
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
@@ -0,0 +1,324 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       GetConfigCacheTest.c
+@brief      Test of get config reply cache invalidation. Table reply is cached by first get config
+            request and configuration is changed by write API, which writes it by writeXXXConfigInternal().
+            Very next get config request must give reply composed from changed configuration. Cached
+            reply is marked by test to find whether reply is given from cache or composed again.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Unit under test */
+#include "Utils.c"
+#include "Config.c"
+#include "ConfigFileIO.c"
+#include "NetworkCommand.c"
+#include "NetworkConfig.c"
+
+/* Application Includes */
+#include "ConfigStoreStub.c"
+#include "DeviceInfoStub.c"
+#include "NetworkManagerStub.c"
+#include "UnitTest.h"
+
+//#################################################################################################
+// @DEFINES
+//#################################################################################################
+#define TEST_CONCURRENT_WRITE_CNT   (2000)
+#define TEST_REQ_STR_LEN_MAX        (64)
+
+/* Character which replaces start of index of cached reply to mark it */
+#define TEST_CACHE_MARK             'X'
+
+//#################################################################################################
+// @DATA TYPES
+//#################################################################################################
+typedef struct
+{
+    CHAR    data[MAX_REPLY_SZ];
+    UINT32  len;
+    UINT32  partCnt;
+}TEST_REPLY_t;
+
+//#################################################################################################
+// @STATIC VARIABLES
+//#################################################################################################
+static TEST_REPLY_t testReply;
+
+/* Writer thread stops when it is set */
+static volatile BOOL writerStopF;
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Capture reply sent to client. Reply of test fits in single part.
+ * @param   pSendBuff
+ * @param   buffLen
+ * @return  SUCCESS
+ */
+static BOOL captureTestReply(UINT8 *pSendBuff, UINT32 buffLen)
+{
+    if (buffLen >= sizeof(testReply.data))
+    {
+        buffLen = sizeof(testReply.data) - 1;
+    }
+
+    memcpy(testReply.data, pSendBuff, buffLen);
+    testReply.data[buffLen] = '\0';
+    testReply.len = buffLen;
+    testReply.partCnt++;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Give request of whole table to get config and take its reply
+ * @param   tableId
+ * @param   pReply - Reply of request
+ * @param   replyLen
+ */
+static void getTableReply(UINT8 tableId, CHARPTR pReply, UINT32 replyLen)
+{
+    CHAR reqStr[TEST_REQ_STR_LEN_MAX];
+
+    snprintf(reqStr, sizeof(reqStr), "%c%d%c%d%c%d%c%d%c%d%c%c%c", SOT, OUR_TO_CLIENT_INDEX(tableId), FSP, 1, FSP,
+             totalIndexPerEveryTable[tableId], FSP, 1, FSP, maxFieldPerTable[tableId], FSP, EOT, EOM);
+    testReply.partCnt = 0;
+    ProcessGetConfig(reqStr, 0, CLIENT_CB_TYPE_NATIVE);
+    snprintf(pReply, replyLen, "%s", testReply.data);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Mark cached reply of table. Reply given from cache has mark in place of start of index.
+ * @param   tableId
+ * @return  TRUE if cached reply is present and marked, FALSE otherwise
+ */
+static BOOL markCachedReply(UINT8 tableId)
+{
+    BOOL markedF = FALSE;
+
+    MUTEX_LOCK(getCfgCache.cacheLock);
+    if (getCfgCache.entry[tableId].pText != NULL)
+    {
+        getCfgCache.entry[tableId].pText[0] = TEST_CACHE_MARK;
+        markedF = TRUE;
+    }
+    MUTEX_UNLOCK(getCfgCache.cacheLock);
+    return markedF;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check whether reply of single table is given from marked cached reply
+ * @param   pReply
+ * @return  TRUE if reply is given from cache, FALSE otherwise
+ */
+static BOOL isMarkedReply(const CHAR *pReply)
+{
+    const CHAR *pTable = strchr(pReply, SOT);
+
+    if (pTable == NULL)
+    {
+        return FALSE;
+    }
+
+    /* Table reply starts after SOT, table id and FSP */
+    pTable = strchr(pTable, FSP);
+    return ((pTable != NULL) && (pTable[1] == TEST_CACHE_MARK)) ? TRUE : FALSE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Write of whole configuration must be given by very next get config request
+ */
+static void testWholeConfigWrite(void)
+{
+    static CHAR         firstReply[MAX_REPLY_SZ];
+    static CHAR         reply[MAX_REPLY_SZ];
+    GENERAL_CONFIG_t    generalCfg;
+    UINT32              configVersion;
+
+    getTableReply(TBL_GENERAL_CFG, firstReply, sizeof(firstReply));
+    UT_CHECK(markCachedReply(TBL_GENERAL_CFG) == TRUE);
+
+    /* Reply is given from cache till configuration is not changed */
+    getTableReply(TBL_GENERAL_CFG, reply, sizeof(reply));
+    UT_CHECK(isMarkedReply(reply) == TRUE);
+
+    ReadGeneralConfig(&generalCfg);
+    snprintf(generalCfg.deviceName, sizeof(generalCfg.deviceName), "CacheTestNvr");
+    configVersion = GetConfigVersion(GENERAL_CONFIG_ID);
+    UT_CHECK(WriteGeneralConfig(&generalCfg) == CMD_SUCCESS);
+    UT_CHECK(GetConfigVersion(GENERAL_CONFIG_ID) != configVersion);
+
+    getTableReply(TBL_GENERAL_CFG, reply, sizeof(reply));
+    UT_CHECK(isMarkedReply(reply) == FALSE);
+    UT_CHECK(strstr(reply, "CacheTestNvr") != NULL);
+    UT_CHECK(strcmp(reply, firstReply) != 0);
+
+    /* Default configuration is written by same function */
+    UT_CHECK(markCachedReply(TBL_GENERAL_CFG) == TRUE);
+    UT_CHECK(DfltGeneralConfig() == CMD_SUCCESS);
+    getTableReply(TBL_GENERAL_CFG, reply, sizeof(reply));
+    UT_CHECK(isMarkedReply(reply) == FALSE);
+    UT_CHECK_MSG(strcmp(reply, firstReply) == 0, "[reply=%s]", reply);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Write of single entry of configuration must be given by very next get config request
+ */
+static void testSingleEntryWrite(void)
+{
+    static CHAR     reply[MAX_REPLY_SZ];
+    CAMERA_CONFIG_t cameraCfg;
+    UINT8           cameraIndex = MAX_CAMERA - 1;
+
+    getTableReply(TBL_CAMERA_CFG, reply, sizeof(reply));
+    UT_CHECK(markCachedReply(TBL_CAMERA_CFG) == TRUE);
+
+    ReadSingleCameraConfig(cameraIndex, &cameraCfg);
+    snprintf(cameraCfg.name, sizeof(cameraCfg.name), "CacheTestCam");
+    UT_CHECK(WriteSingleCameraConfig(cameraIndex, &cameraCfg) == CMD_SUCCESS);
+
+    getTableReply(TBL_CAMERA_CFG, reply, sizeof(reply));
+    UT_CHECK(isMarkedReply(reply) == FALSE);
+    UT_CHECK(strstr(reply, "CacheTestCam") != NULL);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Write which does not change configuration and write of other configuration must not
+ *          change cached reply
+ */
+static void testUnchangedConfigWrite(void)
+{
+    static CHAR         reply[MAX_REPLY_SZ];
+    GENERAL_CONFIG_t    generalCfg;
+    DATE_TIME_CONFIG_t  dateTimeCfg;
+    UINT32              configVersion;
+
+    getTableReply(TBL_GENERAL_CFG, reply, sizeof(reply));
+    UT_CHECK(markCachedReply(TBL_GENERAL_CFG) == TRUE);
+
+    ReadGeneralConfig(&generalCfg);
+    configVersion = GetConfigVersion(GENERAL_CONFIG_ID);
+    UT_CHECK(WriteGeneralConfig(&generalCfg) == CMD_SUCCESS);
+    UT_CHECK(GetConfigVersion(GENERAL_CONFIG_ID) == configVersion);
+
+    ReadDateTimeConfig(&dateTimeCfg);
+    dateTimeCfg.autoUpdateRegional = (dateTimeCfg.autoUpdateRegional == TRUE) ? FALSE : TRUE;
+    UT_CHECK(WriteDateTimeConfig(&dateTimeCfg) == CMD_SUCCESS);
+
+    getTableReply(TBL_GENERAL_CFG, reply, sizeof(reply));
+    UT_CHECK(isMarkedReply(reply) == TRUE);
+
+    /* Mark is removed by composing reply again */
+    UT_CHECK(DfltGeneralConfig() == CMD_SUCCESS);
+    UT_CHECK(DfltDateTimeConfig() == CMD_SUCCESS);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Reply of table which is not composed from configuration only must not be cached
+ */
+static void testUncachedTable(void)
+{
+    static CHAR reply[MAX_REPLY_SZ];
+
+    getTableReply(TBL_LAN1_CFG, reply, sizeof(reply));
+    UT_CHECK(testReply.partCnt == 1);
+    UT_CHECK(getCfgCache.entry[TBL_LAN1_CFG].pText == NULL);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Writer thread which changes device name between two names
+ * @param   arg
+ * @return  NULL
+ */
+static VOIDPTR deviceNameWriter(VOIDPTR arg)
+{
+    GENERAL_CONFIG_t    generalCfg;
+    UINT32              writeCnt;
+
+    ReadGeneralConfig(&generalCfg);
+    for (writeCnt = 0; (writeCnt < TEST_CONCURRENT_WRITE_CNT) && (writerStopF == FALSE); writeCnt++)
+    {
+        snprintf(generalCfg.deviceName, sizeof(generalCfg.deviceName), "%s", (writeCnt % 2) ? "CacheTestOdd" : "CacheTestEven");
+        WriteGeneralConfig(&generalCfg);
+    }
+
+    return NULL;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Reply given while configuration is written by other thread must be reply of one of
+ *          written configurations and reply after last write must be of last write
+ */
+static void testConcurrentWrite(void)
+{
+    static CHAR         evenReply[MAX_REPLY_SZ];
+    static CHAR         oddReply[MAX_REPLY_SZ];
+    static CHAR         reply[MAX_REPLY_SZ];
+    GENERAL_CONFIG_t    generalCfg;
+    pthread_t           writerThread;
+    UINT32              getCnt = 0, mismatchCnt = 0;
+
+    ReadGeneralConfig(&generalCfg);
+    snprintf(generalCfg.deviceName, sizeof(generalCfg.deviceName), "CacheTestOdd");
+    UT_CHECK(WriteGeneralConfig(&generalCfg) == CMD_SUCCESS);
+    getTableReply(TBL_GENERAL_CFG, oddReply, sizeof(oddReply));
+    snprintf(generalCfg.deviceName, sizeof(generalCfg.deviceName), "CacheTestEven");
+    UT_CHECK(WriteGeneralConfig(&generalCfg) == CMD_SUCCESS);
+    getTableReply(TBL_GENERAL_CFG, evenReply, sizeof(evenReply));
+
+    writerStopF = FALSE;
+    UT_CHECK(pthread_create(&writerThread, NULL, deviceNameWriter, NULL) == 0);
+    for (getCnt = 0; getCnt < TEST_CONCURRENT_WRITE_CNT; getCnt++)
+    {
+        getTableReply(TBL_GENERAL_CFG, reply, sizeof(reply));
+        if ((strcmp(reply, evenReply) != 0) && (strcmp(reply, oddReply) != 0))
+        {
+            mismatchCnt++;
+        }
+    }
+    writerStopF = TRUE;
+    pthread_join(writerThread, NULL);
+    UT_CHECK_MSG(mismatchCnt == 0, "[mismatch=%u]", mismatchCnt);
+
+    ReadGeneralConfig(&generalCfg);
+    getTableReply(TBL_GENERAL_CFG, reply, sizeof(reply));
+    UT_CHECK(strcmp(reply, (strcmp(generalCfg.deviceName, "CacheTestOdd") == 0) ? oddReply : evenReply) == 0);
+    UT_CHECK(DfltGeneralConfig() == CMD_SUCCESS);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Main function of test
+ * @return  EXIT_SUCCESS if all checks pass, EXIT_FAILURE otherwise
+ */
+int main(void)
+{
+    UT_CHECK(initDfltConfigStore() == SUCCESS);
+    InitNetworkConfig();
+
+    testWholeConfigWrite();
+    testSingleEntryWrite();
+    testUnchangedConfigWrite();
+    testUncachedTable();
+    testConcurrentWrite();
+
+    return UT_RESULT("GetConfigCacheTest");
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
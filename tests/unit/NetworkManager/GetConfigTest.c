@@ -0,0 +1,594 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       GetConfigTest.c
+@brief      Property test of get config reply composition. Random requests of many tables are given to
+            ProcessGetConfig() with default configuration and every reply sent to client is captured.
+            Reply must be same as reply composed from table functions directly: reply header, every
+            table in SOT/EOT and EOM at end. Reply must be sent once and must fit in receive buffer of
+            client, otherwise only status is sent. Reply of same request must be same when table replies
+            are taken from cache. Invalid requests must give status of its first invalid table and
+            mutated requests must give well formed reply.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Unit under test */
+#include "Utils.c"
+#include "Config.c"
+#include "ConfigFileIO.c"
+#include "NetworkCommand.c"
+#include "NetworkConfig.c"
+
+/* Application Includes */
+#include "ConfigStoreStub.c"
+#include "DeviceInfoStub.c"
+#include "NetworkManagerStub.c"
+#include "UnitTest.h"
+
+//#################################################################################################
+// @DEFINES
+//#################################################################################################
+#define TEST_RANDOM_REQ_CNT         (300)
+#define TEST_MUTATED_REQ_CNT        (3000)
+#define TEST_MAX_RANDOM_TABLE       (12)
+#define TEST_REQ_STR_LEN_MAX        (MAX_GET_CFG_TABLE_REQ * 64)
+
+//#################################################################################################
+// @DATA TYPES
+//#################################################################################################
+typedef struct
+{
+    CHARPTR pData;
+    UINT32  len;
+    UINT32  sendCnt;
+    BOOL    sendFailF;
+}TEST_REPLY_t;
+
+typedef struct
+{
+    const CHAR          *name;
+    const CHAR          *pReqStr;
+    NET_CMD_STATUS_e    status;
+}TEST_INVALID_REQ_t;
+
+//#################################################################################################
+// @STATIC VARIABLES
+//#################################################################################################
+static UINT32       randSeed = 1;
+static TEST_REPLY_t testReply;
+
+/* Characters which mutated request is made of */
+static const CHAR   mutateChar[] = {'0', '1', '9', SOT, EOT, FSP, EOM, 'x', '-', ' '};
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Capture reply sent to client
+ * @param   pSendBuff
+ * @param   buffLen
+ * @return  SUCCESS, FAIL when test fails send
+ */
+static BOOL captureTestReply(UINT8 *pSendBuff, UINT32 buffLen)
+{
+    if (testReply.sendFailF == TRUE)
+    {
+        return FAIL;
+    }
+
+    testReply.pData = realloc(testReply.pData, testReply.len + buffLen + 1);
+    if (testReply.pData == NULL)
+    {
+        return FAIL;
+    }
+
+    memcpy(testReply.pData + testReply.len, pSendBuff, buffLen);
+    testReply.len += buffLen;
+    testReply.pData[testReply.len] = '\0';
+    testReply.sendCnt++;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Give request to get config and capture its reply
+ * @param   pReqStr
+ * @param   callbackType
+ */
+static void getConfigReply(const CHAR *pReqStr, CLIENT_CB_TYPE_e callbackType)
+{
+    CHAR reqStr[TEST_REQ_STR_LEN_MAX + 1];
+
+    /* Request is parsed in place, hence it is given in copy */
+    snprintf(reqStr, sizeof(reqStr), "%s", pReqStr);
+    testReply.len = 0;
+    testReply.sendCnt = 0;
+    ProcessGetConfig(reqStr, 0, callbackType);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Make random valid request of tables which have table function. Table, index range and
+ *          field range are random and same table can be requested many times.
+ * @param   tableReq
+ * @param   tableCnt
+ * @param   pReqStr
+ */
+static void makeRandomRequest(GET_CFG_TABLE_REQ_t *tableReq, UINT16 tableCnt, CHAR pReqStr[TEST_REQ_STR_LEN_MAX])
+{
+    UINT16  tableIdx, tableId, maxIndex, maxField;
+    UINT32  reqLen = 0;
+
+    for (tableIdx = 0; tableIdx < tableCnt; tableIdx++)
+    {
+        do
+        {
+            tableId = rand_r(&randSeed) % MAX_TBL_CFG;
+        }
+        while (getCfgFuncPtr[tableId] == NULL);
+
+        maxIndex = totalIndexPerEveryTable[tableId];
+        maxField = maxFieldPerTable[tableId];
+        tableReq[tableIdx].tableId = tableId;
+        tableReq[tableIdx].fromIndex = rand_r(&randSeed) % maxIndex;
+        tableReq[tableIdx].toIndex = tableReq[tableIdx].fromIndex + (rand_r(&randSeed) % (maxIndex - tableReq[tableIdx].fromIndex));
+        tableReq[tableIdx].fromField = rand_r(&randSeed) % maxField;
+        tableReq[tableIdx].toField = tableReq[tableIdx].fromField + (rand_r(&randSeed) % (maxField - tableReq[tableIdx].fromField));
+
+        /* Whole table is requested often, which gives largest reply */
+        if ((rand_r(&randSeed) % 4) == 0)
+        {
+            tableReq[tableIdx].fromIndex = 0;
+            tableReq[tableIdx].toIndex = maxIndex - 1;
+            tableReq[tableIdx].fromField = 0;
+            tableReq[tableIdx].toField = maxField - 1;
+        }
+
+        reqLen += snprintf(pReqStr + reqLen, TEST_REQ_STR_LEN_MAX - reqLen, "%c%d%c%d%c%d%c%d%c%d%c%c",
+                           SOT, OUR_TO_CLIENT_INDEX(tableId), FSP,
+                           OUR_TO_CLIENT_INDEX(tableReq[tableIdx].fromIndex), FSP, OUR_TO_CLIENT_INDEX(tableReq[tableIdx].toIndex), FSP,
+                           OUR_TO_CLIENT_INDEX(tableReq[tableIdx].fromField), FSP, OUR_TO_CLIENT_INDEX(tableReq[tableIdx].toField), FSP, EOT);
+    }
+
+    snprintf(pReqStr + reqLen, TEST_REQ_STR_LEN_MAX - reqLen, "%c", EOM);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Compose expected reply of request from table functions directly. Reply with tables must fit
+ *          in receive buffer of native client.
+ * @param   tableReq
+ * @param   tableCnt
+ * @param   pExpected - Buffer of native reply size
+ * @param   pStatus - Status of reply
+ * @return  Tables in expected reply
+ */
+static UINT16 composeExpectedReply(const GET_CFG_TABLE_REQ_t *tableReq, UINT16 tableCnt, CHARPTR pExpected, NET_CMD_STATUS_e *pStatus)
+{
+    static CHAR tableReply[GET_CFG_NATIVE_REPLY_SZ];
+    UINT16      tableIdx;
+    UINT32      outLen, headerLen, tableLen;
+
+    *pStatus = CMD_SUCCESS;
+    outLen = sprintf(pExpected, "%c%s%c%d%c", SOM, headerReq[RPL_CFG], FSP, CMD_SUCCESS, FSP);
+    for (tableIdx = 0; tableIdx < tableCnt; tableIdx++)
+    {
+        headerLen = snprintf(tableReply, sizeof(tableReply), "%c%d%c", SOT, OUR_TO_CLIENT_INDEX(tableReq[tableIdx].tableId), FSP);
+        *pStatus = getCfgFuncPtr[tableReq[tableIdx].tableId](tableReq[tableIdx].fromIndex, tableReq[tableIdx].toIndex,
+                                                             tableReq[tableIdx].fromField, tableReq[tableIdx].toField,
+                                                             tableReply + headerLen, sizeof(tableReply) - headerLen);
+        if (*pStatus != CMD_SUCCESS)
+        {
+            break;
+        }
+
+        tableLen = headerLen + strlen(tableReply + headerLen);
+        if ((outLen + tableLen) >= (GET_CFG_NATIVE_REPLY_SZ - GET_CFG_REPLY_TAIL_LEN))
+        {
+            *pStatus = CMD_RESOURCE_LIMIT;
+            break;
+        }
+
+        memcpy(pExpected + outLen, tableReply, tableLen);
+        outLen += tableLen;
+        pExpected[outLen++] = EOT;
+    }
+
+    pExpected[outLen++] = EOM;
+    pExpected[outLen] = '\0';
+    return tableIdx;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check reply which has status only
+ * @param   status
+ * @return  TRUE if captured reply is single send with given status
+ */
+static BOOL isStatusReply(NET_CMD_STATUS_e status)
+{
+    CHAR expected[64];
+
+    snprintf(expected, sizeof(expected), "%c%s%c%d%c%c", SOM, headerReq[RPL_CFG], FSP, status, FSP, EOM);
+    return ((testReply.sendCnt == 1) && (strcmp(testReply.pData, expected) == 0));
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check well formed reply. Reply starts with header and status and ends with EOM. Reply of
+ *          success has tables in SOT and EOT with table ids in order of request.
+ * @return  TRUE if captured reply is well formed
+ */
+static BOOL isWellFormedReply(void)
+{
+    CHAR        header[32];
+    UINT32      headerLen, pos;
+    INT32       status;
+    CHARPTR     pEnd;
+
+    headerLen = snprintf(header, sizeof(header), "%c%s%c", SOM, headerReq[RPL_CFG], FSP);
+    if ((testReply.len <= headerLen) || (memcmp(testReply.pData, header, headerLen) != 0) || (testReply.pData[testReply.len - 1] != EOM))
+    {
+        return FALSE;
+    }
+
+    status = strtol(testReply.pData + headerLen, &pEnd, 10);
+    if (*pEnd != FSP)
+    {
+        return FALSE;
+    }
+
+    pos = (pEnd - testReply.pData) + 1;
+    if (status != CMD_SUCCESS)
+    {
+        return (pos == (testReply.len - 1));
+    }
+
+    while (testReply.pData[pos] == SOT)
+    {
+        /* Reply of table has no SOT, EOT or EOM in it */
+        pos += strcspn(testReply.pData + pos + 1, "\x02\x03\x04") + 1;
+        if (testReply.pData[pos] != EOT)
+        {
+            return FALSE;
+        }
+        pos++;
+    }
+
+    return (pos == (testReply.len - 1));
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Table reply composed in smaller buffer must be start of reply composed in whole reply
+ *          buffer, and it must reach reserved tail of buffer when whole reply does not fit. Reply of
+ *          table is composed again in larger buffer on this basis. Whole table and random ranges of it are
+ *          composed in buffers of random size.
+ */
+static void testTableTruncation(void)
+{
+    static CHAR         fullReply[MAX_REPLY_SZ];
+    static CHAR         truncReply[MAX_REPLY_SZ];
+    GET_CFG_TABLE_REQ_t tableReq;
+    CHAR                reqStr[TEST_REQ_STR_LEN_MAX];
+    UINT32              fullLen, truncLen, buffLen, sizeCnt, mismatchCnt = 0;
+    UINT16              reqCnt;
+    NET_CMD_STATUS_e    fullStatus, truncStatus;
+
+    for (reqCnt = 0; reqCnt < (MAX_TBL_CFG * 4); reqCnt++)
+    {
+        makeRandomRequest(&tableReq, 1, reqStr);
+        if (reqCnt < MAX_TBL_CFG)
+        {
+            /* Whole table of every table function */
+            if (getCfgFuncPtr[reqCnt] == NULL)
+            {
+                continue;
+            }
+
+            tableReq.tableId = reqCnt;
+            tableReq.fromIndex = 0;
+            tableReq.toIndex = totalIndexPerEveryTable[reqCnt] - 1;
+            tableReq.fromField = 0;
+            tableReq.toField = maxFieldPerTable[reqCnt] - 1;
+        }
+
+        fullStatus = getCfgFuncPtr[tableReq.tableId](tableReq.fromIndex, tableReq.toIndex, tableReq.fromField,
+                                                     tableReq.toField, fullReply, sizeof(fullReply));
+        fullLen = strlen(fullReply);
+        for (sizeCnt = 0; sizeCnt < 32; sizeCnt++)
+        {
+            /* Buffer sizes near whole reply buffer and near length of reply are checked too */
+            switch (sizeCnt % 4)
+            {
+                case 0:
+                    buffLen = sizeof(truncReply) - (rand_r(&randSeed) % 16);
+                    break;
+
+                case 1:
+                    buffLen = fullLen + GET_CFG_REPLY_TAIL_LEN - 2 + (rand_r(&randSeed) % 4);
+                    break;
+
+                default:
+                    buffLen = (rand_r(&randSeed) % sizeof(truncReply)) + 1;
+                    break;
+            }
+
+            if ((buffLen <= GET_CFG_REPLY_TAIL_LEN) || (buffLen > sizeof(truncReply)))
+            {
+                continue;
+            }
+
+            truncStatus = getCfgFuncPtr[tableReq.tableId](tableReq.fromIndex, tableReq.toIndex, tableReq.fromField,
+                                                          tableReq.toField, truncReply, buffLen);
+            truncLen = strlen(truncReply);
+            if ((truncStatus != fullStatus) || (truncLen >= buffLen))
+            {
+                mismatchCnt++;
+                fprintf(stderr, "truncated reply status: [tableId=%d], [buffLen=%u], [len=%u], [status=%d/%d]\n",
+                        tableReq.tableId, buffLen, truncLen, truncStatus, fullStatus);
+            }
+            else if (fullLen < (buffLen - GET_CFG_REPLY_TAIL_LEN))
+            {
+                /* Reply which fits must be whole */
+                if ((truncLen != fullLen) || (memcmp(truncReply, fullReply, fullLen) != 0))
+                {
+                    mismatchCnt++;
+                    fprintf(stderr, "reply not whole: [tableId=%d], [buffLen=%u], [len=%u/%u]\n", tableReq.tableId, buffLen, truncLen, fullLen);
+                }
+            }
+            else if ((truncLen < (buffLen - GET_CFG_REPLY_TAIL_LEN)) || (memcmp(truncReply, fullReply, truncLen - 2) != 0))
+            {
+                /* Truncated reply ends with end of index in its last characters */
+                mismatchCnt++;
+                fprintf(stderr, "reply not truncated: [tableId=%d], [buffLen=%u], [len=%u/%u]\n", tableReq.tableId, buffLen, truncLen, fullLen);
+            }
+        }
+    }
+
+    UT_CHECK_MSG(mismatchCnt == 0, "[mismatch=%u]", mismatchCnt);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check reply of random valid requests with reply composed from table functions. Reply of
+ *          many large tables is larger than reply buffer for native client. Request is given again,
+ *          so tables are taken from cache, and its reply must be same.
+ */
+static void testRandomRequests(void)
+{
+    GET_CFG_TABLE_REQ_t tableReq[MAX_GET_CFG_TABLE_REQ];
+    CHAR                reqStr[TEST_REQ_STR_LEN_MAX];
+    CHARPTR             pExpected = malloc(GET_CFG_NATIVE_REPLY_SZ);
+    CHARPTR             pFirstReply = NULL;
+    UINT32              reqCnt, mismatchCnt = 0, largeReplyCnt = 0, firstReplyLen;
+    UINT16              tableCnt, replyTableCnt;
+    NET_CMD_STATUS_e    status;
+
+    UT_CHECK(pExpected != NULL);
+    for (reqCnt = 0; (reqCnt < TEST_RANDOM_REQ_CNT) && (pExpected != NULL); reqCnt++)
+    {
+        /* First request has all tables with max tables in request */
+        tableCnt = (reqCnt == 0) ? MAX_GET_CFG_TABLE_REQ : (rand_r(&randSeed) % TEST_MAX_RANDOM_TABLE) + 1;
+        makeRandomRequest(tableReq, tableCnt, reqStr);
+        replyTableCnt = composeExpectedReply(tableReq, tableCnt, pExpected, &status);
+
+        getConfigReply(reqStr, CLIENT_CB_TYPE_NATIVE);
+        if (testReply.len > MAX_REPLY_SZ)
+        {
+            largeReplyCnt++;
+        }
+
+        /* Reply which does not fit in receive buffer of client gives status only */
+        if (status != CMD_SUCCESS)
+        {
+            if (isStatusReply(status) == FALSE)
+            {
+                mismatchCnt++;
+                fprintf(stderr, "status reply mismatch: [req=%u], [status=%d]\n", reqCnt, status);
+            }
+            continue;
+        }
+
+        if ((testReply.len != strlen(pExpected)) || (strcmp(testReply.pData, pExpected) != 0)
+                || (testReply.sendCnt != 1) || (isWellFormedReply() == FALSE))
+        {
+            mismatchCnt++;
+            fprintf(stderr, "reply mismatch: [req=%u], [tables=%d/%d], [len=%u/%zu], [sends=%u]\n",
+                    reqCnt, replyTableCnt, tableCnt, testReply.len, strlen(pExpected), testReply.sendCnt);
+            continue;
+        }
+
+        /* Tables of second reply are taken from cache */
+        firstReplyLen = testReply.len;
+        pFirstReply = realloc(pFirstReply, firstReplyLen + 1);
+        memcpy(pFirstReply, testReply.pData, firstReplyLen + 1);
+        getConfigReply(reqStr, CLIENT_CB_TYPE_NATIVE);
+        if ((testReply.len != firstReplyLen) || (memcmp(testReply.pData, pFirstReply, firstReplyLen) != 0))
+        {
+            mismatchCnt++;
+            fprintf(stderr, "cached reply mismatch: [req=%u]\n", reqCnt);
+        }
+    }
+
+    UT_CHECK_MSG(mismatchCnt == 0, "[mismatch=%u]", mismatchCnt);
+
+    /* Replies larger than reply buffer must be covered by random requests */
+    UT_CHECK_MSG(largeReplyCnt > 0, "[largeReply=%u]", largeReplyCnt);
+    UT_CHECK(getCfgCache.cacheSize <= GET_CFG_CACHE_SIZE_MAX);
+    FREE_MEMORY(pFirstReply);
+    FREE_MEMORY(pExpected);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Reply of P2P client is limited to reply buffer. Request which does not fit in reply buffer
+ *          gives resource limit and request which fits gives same reply as native client.
+ */
+static void testP2pClient(void)
+{
+    GET_CFG_TABLE_REQ_t tableReq[MAX_GET_CFG_TABLE_REQ];
+    CHAR                reqStr[TEST_REQ_STR_LEN_MAX];
+    CHARPTR             pNativeReply;
+    UINT32              nativeReplyLen;
+
+    makeRandomRequest(tableReq, MAX_GET_CFG_TABLE_REQ, reqStr);
+    getConfigReply(reqStr, CLIENT_CB_TYPE_P2P);
+    UT_CHECK(isStatusReply(CMD_RESOURCE_LIMIT) == TRUE);
+
+    makeRandomRequest(tableReq, 1, reqStr);
+    getConfigReply(reqStr, CLIENT_CB_TYPE_NATIVE);
+    pNativeReply = strdup(testReply.pData);
+    nativeReplyLen = testReply.len;
+    getConfigReply(reqStr, CLIENT_CB_TYPE_P2P);
+    UT_CHECK(testReply.sendCnt == 1);
+    UT_CHECK((nativeReplyLen == testReply.len) && (strcmp(pNativeReply, testReply.pData) == 0));
+    FREE_MEMORY(pNativeReply);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Invalid request gives status of its first invalid table and no table in reply, even when
+ *          tables before it are valid
+ */
+static void testInvalidRequests(void)
+{
+    const TEST_INVALID_REQ_t invalidReq[] =
+    {
+        {"no SOT",              "1\x1e" "1\x1e" "1\x1e" "1\x1e" "1\x1e\x03\x04",                CMD_INVALID_SYNTAX},
+        {"no EOT",              "\x02" "1\x1e" "1\x1e" "1\x1e" "1\x1e" "1\x1e\x04",             CMD_INVALID_SYNTAX},
+        {"missing field",       "\x02" "1\x1e" "1\x1e" "1\x1e" "1\x1e\x03\x04",                 CMD_INVALID_SYNTAX},
+        {"not number",          "\x02" "1\x1e" "1\x1e" "x\x1e" "1\x1e" "1\x1e\x03\x04",         CMD_INVALID_SYNTAX},
+        {"no EOM",              "\x02" "1\x1e" "1\x1e" "1\x1e" "1\x1e" "1\x1e\x03",             CMD_INVALID_SYNTAX},
+        {"table zero",          "\x02" "0\x1e" "1\x1e" "1\x1e" "1\x1e" "1\x1e\x03\x04",         CMD_INVALID_TABLE_ID},
+        {"table above max",     "\x02" "99\x1e" "1\x1e" "1\x1e" "1\x1e" "1\x1e\x03\x04",        CMD_INVALID_TABLE_ID},
+        {"index zero",          "\x02" "1\x1e" "0\x1e" "1\x1e" "1\x1e" "1\x1e\x03\x04",         CMD_INVALID_INDEX_ID},
+        {"index above max",     "\x02" "1\x1e" "1\x1e" "2\x1e" "1\x1e" "1\x1e\x03\x04",         CMD_INVALID_INDEX_ID},
+        {"index reversed",      "\x02" "16\x1e" "3\x1e" "2\x1e" "1\x1e" "1\x1e\x03\x04",        CMD_INVALID_INDEX_ID},
+        {"field zero",          "\x02" "1\x1e" "1\x1e" "1\x1e" "0\x1e" "1\x1e\x03\x04",         CMD_INVALID_FIELD_ID},
+        {"field above max",     "\x02" "1\x1e" "1\x1e" "1\x1e" "1\x1e" "999\x1e\x03\x04",       CMD_INVALID_FIELD_ID},
+        {"field reversed",      "\x02" "1\x1e" "1\x1e" "1\x1e" "3\x1e" "2\x1e\x03\x04",         CMD_INVALID_FIELD_ID},
+        {"valid then invalid",  "\x02" "1\x1e" "1\x1e" "1\x1e" "1\x1e" "1\x1e\x03"
+                                "\x02" "0\x1e" "1\x1e" "1\x1e" "1\x1e" "1\x1e\x03\x04",         CMD_INVALID_TABLE_ID},
+    };
+    GET_CFG_TABLE_REQ_t tableReq[MAX_GET_CFG_TABLE_REQ + 1];
+    CHAR                reqStr[TEST_REQ_STR_LEN_MAX];
+    UINT8               reqIdx;
+
+    for (reqIdx = 0; reqIdx < (sizeof(invalidReq) / sizeof(invalidReq[0])); reqIdx++)
+    {
+        getConfigReply(invalidReq[reqIdx].pReqStr, CLIENT_CB_TYPE_NATIVE);
+        UT_CHECK_MSG(isStatusReply(invalidReq[reqIdx].status) == TRUE, "[req=%s]", invalidReq[reqIdx].name);
+    }
+
+    /* Tables in request are limited */
+    makeRandomRequest(tableReq, MAX_GET_CFG_TABLE_REQ + 1, reqStr);
+    getConfigReply(reqStr, CLIENT_CB_TYPE_NATIVE);
+    UT_CHECK(isStatusReply(CMD_RESOURCE_LIMIT) == TRUE);
+
+    /* Empty request has no table */
+    getConfigReply("\x04", CLIENT_CB_TYPE_NATIVE);
+    UT_CHECK((testReply.sendCnt == 1) && (isWellFormedReply() == TRUE));
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Valid requests are mutated by changing, removing or adding random characters and cutting
+ *          them. Every mutated request must give single well formed reply. Overflow of buffers is caught
+ *          by sanitizer build.
+ */
+static void testMutatedRequests(void)
+{
+    GET_CFG_TABLE_REQ_t tableReq[MAX_GET_CFG_TABLE_REQ];
+    CHAR                reqStr[TEST_REQ_STR_LEN_MAX];
+    UINT32              reqCnt, mutateCnt, reqLen, pos, malformedCnt = 0;
+
+    for (reqCnt = 0; reqCnt < TEST_MUTATED_REQ_CNT; reqCnt++)
+    {
+        makeRandomRequest(tableReq, (rand_r(&randSeed) % 4) + 1, reqStr);
+        for (mutateCnt = (rand_r(&randSeed) % 4) + 1; mutateCnt > 0; mutateCnt--)
+        {
+            reqLen = strlen(reqStr);
+            if (reqLen == 0)
+            {
+                break;
+            }
+
+            pos = rand_r(&randSeed) % reqLen;
+            switch (rand_r(&randSeed) % 4)
+            {
+                case 0:
+                    reqStr[pos] = mutateChar[rand_r(&randSeed) % sizeof(mutateChar)];
+                    break;
+
+                case 1:
+                    memmove(reqStr + pos, reqStr + pos + 1, reqLen - pos);
+                    break;
+
+                case 2:
+                    if ((reqLen + 1) < sizeof(reqStr))
+                    {
+                        memmove(reqStr + pos + 1, reqStr + pos, reqLen - pos + 1);
+                        reqStr[pos] = mutateChar[rand_r(&randSeed) % sizeof(mutateChar)];
+                    }
+                    break;
+
+                default:
+                    reqStr[pos] = '\0';
+                    break;
+            }
+        }
+
+        getConfigReply(reqStr, CLIENT_CB_TYPE_NATIVE);
+        if ((testReply.sendCnt != 1) || (testReply.len > GET_CFG_NATIVE_REPLY_SZ) || (isWellFormedReply() == FALSE))
+        {
+            malformedCnt++;
+            fprintf(stderr, "malformed reply: [req=%u], [len=%u], [sends=%u]\n", reqCnt, testReply.len, testReply.sendCnt);
+        }
+    }
+
+    UT_CHECK_MSG(malformedCnt == 0, "[malformed=%u]", malformedCnt);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Reply is not sent again after failed send
+ */
+static void testSendFail(void)
+{
+    GET_CFG_TABLE_REQ_t tableReq[MAX_GET_CFG_TABLE_REQ];
+    CHAR                reqStr[TEST_REQ_STR_LEN_MAX];
+
+    makeRandomRequest(tableReq, MAX_GET_CFG_TABLE_REQ, reqStr);
+    testReply.sendFailF = TRUE;
+    getConfigReply(reqStr, CLIENT_CB_TYPE_NATIVE);
+    testReply.sendFailF = FALSE;
+    UT_CHECK(testReply.sendCnt == 0);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Main function of test
+ * @return  EXIT_SUCCESS if all checks pass
+ */
+int main(void)
+{
+    UT_CHECK(initDfltConfigStore() == SUCCESS);
+    InitNetworkConfig();
+
+    testTableTruncation();
+    testRandomRequests();
+    testP2pClient();
+    testInvalidRequests();
+    testMutatedRequests();
+    testSendFail();
+    FREE_MEMORY(testReply.pData);
+    return UT_RESULT("GetConfigTest");
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
@@ -0,0 +1,330 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       SetConfigBench.c
+@brief      Benchmark of config get/set throughput with default configuration. Set config request of
+            single small table, whole camera table and all tables is made from get config reply of
+            tables and given to ProcessSetConfig(). Get and set of all tables is taken as full system
+            round trip of configuration. Decoding of values in set config is taken alone, in single
+            pass and by string copy which it replaced.
+
+            Usage: SetConfigBench [requests]
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Unit under test */
+#include "Utils.c"
+#include "Config.c"
+#include "ConfigFileIO.c"
+#include "NetworkCommand.c"
+#include "NetworkConfig.c"
+
+/* Application Includes */
+#include "ConfigStoreStub.c"
+#include "DeviceInfoStub.c"
+#include "NetworkManagerStub.c"
+#include "UnitTest.h"
+
+//#################################################################################################
+// @DEFINES
+//#################################################################################################
+#define BENCH_DEFAULT_REQ_CNT       (200)
+#define BENCH_DECODE_VAL_CNT        (1000000)
+#define BENCH_TABLE_REPLY_LEN_MAX   (4 * MEGA_BYTE)
+
+//#################################################################################################
+// @DATA TYPES
+//#################################################################################################
+typedef struct
+{
+    const CHAR  *name;
+    UINT16      fromTableId;
+    UINT16      toTableId;
+}BENCH_REQ_t;
+
+typedef struct
+{
+    CHARPTR     pReqStr[MAX_TBL_CFG];
+    UINT32      reqLen[MAX_TBL_CFG];
+    UINT16      tableCnt;
+    UINT32      totalLen;
+}BENCH_SET_REQ_t;
+
+//#################################################################################################
+// @STATIC VARIABLES
+//#################################################################################################
+/* Status of last reply sent to client */
+static INT32    replyStatus;
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Capture reply sent to client. Only status of set config reply is taken.
+ * @param   pSendBuff
+ * @param   buffLen
+ * @return  SUCCESS
+ */
+static BOOL captureTestReply(UINT8 *pSendBuff, UINT32 buffLen)
+{
+    CHAR    header[32];
+    UINT32  headerLen;
+
+    headerLen = snprintf(header, sizeof(header), "%c%s%c", SOM, headerReq[RPL_CFG], FSP);
+    if ((buffLen > headerLen) && (memcmp(pSendBuff, header, headerLen) == 0))
+    {
+        replyStatus = atoi((CHARPTR)pSendBuff + headerLen);
+    }
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Make set config request of every table in range from get config reply of its whole range.
+ *          Table which has no get or set function and table whose whole range can not be given by get
+ *          config are not requested.
+ * @param   pBenchReq
+ * @param   pSetReq
+ * @param   pTableReply - Buffer of BENCH_TABLE_REPLY_LEN_MAX
+ */
+static void makeSetRequest(const BENCH_REQ_t *pBenchReq, BENCH_SET_REQ_t *pSetReq, CHARPTR pTableReply)
+{
+    UINT16 tableId;
+
+    memset(pSetReq, 0, sizeof(BENCH_SET_REQ_t));
+    for (tableId = pBenchReq->fromTableId; tableId <= pBenchReq->toTableId; tableId++)
+    {
+        if ((getCfgFuncPtr[tableId] == NULL) || (setCfgFuncPtr[tableId] == NULL)
+                || (getCfgFuncPtr[tableId](0, totalIndexPerEveryTable[tableId] - 1, 0, maxFieldPerTable[tableId] - 1,
+                                           pTableReply, BENCH_TABLE_REPLY_LEN_MAX) != CMD_SUCCESS))
+        {
+            continue;
+        }
+
+        if (asprintf(&pSetReq->pReqStr[pSetReq->tableCnt], "%c%d%c%s%c%c", SOT, OUR_TO_CLIENT_INDEX(tableId), FSP, pTableReply, EOT, EOM) < 0)
+        {
+            continue;
+        }
+
+        pSetReq->reqLen[pSetReq->tableCnt] = strlen(pSetReq->pReqStr[pSetReq->tableCnt]);
+        pSetReq->totalLen += pSetReq->reqLen[pSetReq->tableCnt];
+        pSetReq->tableCnt++;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Free set config request of tables
+ * @param   pSetReq
+ */
+static void freeSetRequest(BENCH_SET_REQ_t *pSetReq)
+{
+    UINT16 tableIdx;
+
+    for (tableIdx = 0; tableIdx < pSetReq->tableCnt; tableIdx++)
+    {
+        FREE_MEMORY(pSetReq->pReqStr[tableIdx]);
+    }
+    pSetReq->tableCnt = 0;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Give set config request of all tables many times and take time of it. Set config request
+ *          is parsed in place, hence it is given in copy. Copy is not timed.
+ * @param   pSetReq
+ * @param   reqCnt
+ * @param   pReqStr - Buffer of BENCH_TABLE_REPLY_LEN_MAX
+ * @param   pFailCnt - Set config requests which are not replied with success
+ * @return  Time taken in nano seconds
+ */
+static UINT64 setConfigReplies(const BENCH_SET_REQ_t *pSetReq, UINT32 reqCnt, CHARPTR pReqStr, UINT32 *pFailCnt)
+{
+    UINT32  reqIdx;
+    UINT16  tableIdx;
+    UINT64  elapsedNs = 0, startNs;
+
+    *pFailCnt = 0;
+    for (reqIdx = 0; reqIdx < reqCnt; reqIdx++)
+    {
+        for (tableIdx = 0; tableIdx < pSetReq->tableCnt; tableIdx++)
+        {
+            memcpy(pReqStr, pSetReq->pReqStr[tableIdx], pSetReq->reqLen[tableIdx] + 1);
+            replyStatus = -1;
+            startNs = UtGetTimeNs();
+            ProcessSetConfig(pReqStr, 0, "SetConfigBench", CLIENT_CB_TYPE_NATIVE);
+            elapsedNs += UtGetTimeNs() - startNs;
+            UT_BARRIER();
+            if (replyStatus != CMD_SUCCESS)
+            {
+                (*pFailCnt)++;
+            }
+        }
+    }
+
+    return elapsedNs;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Get and set whole range of all tables many times, as full system backup and restore of
+ *          configuration through config protocol does
+ * @param   reqCnt
+ * @param   pTableReply - Buffer of BENCH_TABLE_REPLY_LEN_MAX
+ * @param   pReqStr - Buffer of BENCH_TABLE_REPLY_LEN_MAX + 32
+ * @return  Time taken in nano seconds
+ */
+static UINT64 getSetConfigRoundTrips(UINT32 reqCnt, CHARPTR pTableReply, CHARPTR pReqStr)
+{
+    UINT32  reqIdx;
+    UINT16  tableId;
+    UINT64  startNs;
+
+    startNs = UtGetTimeNs();
+    for (reqIdx = 0; reqIdx < reqCnt; reqIdx++)
+    {
+        for (tableId = 0; tableId < MAX_TBL_CFG; tableId++)
+        {
+            if ((getCfgFuncPtr[tableId] == NULL) || (setCfgFuncPtr[tableId] == NULL)
+                    || (getCfgTableReply(&(GET_CFG_TABLE_REQ_t){.tableId = tableId, .fromIndex = 0, .toIndex = totalIndexPerEveryTable[tableId] - 1,
+                                                                .fromField = 0, .toField = maxFieldPerTable[tableId] - 1},
+                                         pTableReply, BENCH_TABLE_REPLY_LEN_MAX) != CMD_SUCCESS))
+            {
+                continue;
+            }
+
+            snprintf(pReqStr, BENCH_TABLE_REPLY_LEN_MAX + 32, "%c%d%c%s%c%c", SOT, OUR_TO_CLIENT_INDEX(tableId), FSP, pTableReply, EOT, EOM);
+            ProcessSetConfig(pReqStr, 0, "SetConfigBench", CLIENT_CB_TYPE_NATIVE);
+            UT_BARRIER();
+        }
+    }
+
+    return UtGetTimeNs() - startNs;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Decode values as set config decoded them before, by copy of value string and its conversion
+ * @param   pSrc
+ * @param   pVal
+ * @param   delim
+ * @return  SUCCESS/FAIL
+ */
+static BOOL parseValByCopy(CHARPTR *pSrc, UINT64PTR pVal, UINT8 delim)
+{
+    CHAR valStr[PARSE_STR_VAL_LEN_MAX];
+
+    if (ParseStr(pSrc, delim, valStr, sizeof(valStr)) == FAIL)
+    {
+        return FAIL;
+    }
+
+    return AsciiToInt(valStr, pVal);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Decode field id and value pairs of typical set config record, in single pass or by copy
+ * @param   copyF - TRUE to decode by copy
+ * @param   pValSum - Sum of decoded values, so decoding is not removed by compiler
+ * @return  Time taken in nano seconds
+ */
+static UINT64 decodeValues(BOOL copyF, UINT64PTR pValSum)
+{
+    static CHAR recordStr[] = "1\x1f" "1\x1e" "2\x1f" "30\x1e" "3\x1f" "8080\x1e" "4\x1f" "4294967295\x1e" "5\x1f" "0\x1e";
+    UINT32      valIdx;
+    UINT64      fieldId, fieldVal, startNs;
+    CHARPTR     pSrc;
+
+    *pValSum = 0;
+    startNs = UtGetTimeNs();
+    for (valIdx = 0; valIdx < BENCH_DECODE_VAL_CNT; valIdx += 5)
+    {
+        pSrc = recordStr;
+        while (*pSrc != '\0')
+        {
+            if (copyF == TRUE)
+            {
+                parseValByCopy(&pSrc, &fieldId, FVS);
+                parseValByCopy(&pSrc, &fieldVal, FSP);
+            }
+            else
+            {
+                ParseStringGetVal(&pSrc, &fieldId, 1, FVS);
+                ParseStringGetVal(&pSrc, &fieldVal, 1, FSP);
+            }
+            *pValSum += fieldId + fieldVal;
+        }
+        UT_BARRIER();
+    }
+
+    return UtGetTimeNs() - startNs;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Main function of benchmark
+ * @param   argc
+ * @param   argv - Optional requests per case
+ * @return  EXIT_SUCCESS if every set config request is replied with success and both decodings give
+ *          same values
+ */
+int main(int argc, char *argv[])
+{
+    const BENCH_REQ_t benchReq[] =
+    {
+        {"general table",   TBL_GENERAL_CFG,    TBL_GENERAL_CFG},
+        {"camera table",    TBL_CAMERA_CFG,     TBL_CAMERA_CFG},
+        {"all tables",      0,                  MAX_TBL_CFG - 1},
+    };
+    BENCH_SET_REQ_t setReq;
+    CHARPTR         pTableReply = malloc(BENCH_TABLE_REPLY_LEN_MAX);
+    CHARPTR         pReqStr = malloc(BENCH_TABLE_REPLY_LEN_MAX + 32);
+    CHAR            caseName[64];
+    UINT32          reqCnt = BENCH_DEFAULT_REQ_CNT, failCnt;
+    UINT64          elapsedNs, singlePassSum, copySum;
+    UINT8           reqIdx;
+
+    if ((argc > 1) && (atoi(argv[1]) > 0))
+    {
+        reqCnt = atoi(argv[1]);
+    }
+
+    UT_CHECK(initDfltConfigStore() == SUCCESS);
+    UT_CHECK((pTableReply != NULL) && (pReqStr != NULL));
+    if ((pTableReply == NULL) || (pReqStr == NULL))
+    {
+        return UT_RESULT("SetConfigBench");
+    }
+    InitNetworkConfig();
+
+    for (reqIdx = 0; reqIdx < (sizeof(benchReq) / sizeof(benchReq[0])); reqIdx++)
+    {
+        makeSetRequest(&benchReq[reqIdx], &setReq, pTableReply);
+        elapsedNs = setConfigReplies(&setReq, reqCnt, pReqStr, &failCnt);
+        snprintf(caseName, sizeof(caseName), "%s(%u bytes, %u tables) set", benchReq[reqIdx].name, setReq.totalLen, setReq.tableCnt);
+        UtPrintBench(caseName, reqCnt, elapsedNs);
+        UT_CHECK_MSG(failCnt == 0, "[req=%s], [failed=%u]", benchReq[reqIdx].name, failCnt);
+        freeSetRequest(&setReq);
+    }
+
+    elapsedNs = getSetConfigRoundTrips(reqCnt, pTableReply, pReqStr);
+    UtPrintBench("all tables get and set", reqCnt, elapsedNs);
+
+    elapsedNs = decodeValues(FALSE, &singlePassSum);
+    UtPrintBench("decode value single pass", BENCH_DECODE_VAL_CNT, elapsedNs);
+    elapsedNs = decodeValues(TRUE, &copySum);
+    UtPrintBench("decode value by copy", BENCH_DECODE_VAL_CNT, elapsedNs);
+    UT_CHECK(singlePassSum == copySum);
+
+    FREE_MEMORY(pTableReply);
+    FREE_MEMORY(pReqStr);
+    return UT_RESULT("SetConfigBench");
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
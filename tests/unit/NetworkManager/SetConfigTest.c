@@ -0,0 +1,387 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       SetConfigTest.c
+@brief      Round trip and fuzz test of set config with default configuration. Reply of whole table
+            given by get config has same records as set config request, hence it is given back to
+            ProcessSetConfig() for every table. Set must succeed and must not change table. Random
+            valid set requests are mutated and every reply must have status only. Round trip of
+            table must still hold after mutated request. Single pass decoding of values in set config
+            is checked against decoding through string copy which it replaces.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Unit under test */
+#include "Utils.c"
+#include "Config.c"
+#include "ConfigFileIO.c"
+#include "NetworkCommand.c"
+#include "NetworkConfig.c"
+
+/* Application Includes */
+#include "ConfigStoreStub.c"
+#include "DeviceInfoStub.c"
+#include "NetworkManagerStub.c"
+#include "UnitTest.h"
+
+//#################################################################################################
+// @DEFINES
+//#################################################################################################
+#define TEST_PARSE_VAL_CNT          (20000)
+#define TEST_MUTATED_REQ_CNT        (3000)
+#define TEST_TABLE_REPLY_LEN_MAX    (4 * MEGA_BYTE)
+#define TEST_PARSE_ARG_MAX          (5)
+
+/* Status taken when reply is not single status reply */
+#define TEST_REPLY_MALFORMED        ((NET_CMD_STATUS_e)-1)
+
+//#################################################################################################
+// @DATA TYPES
+//#################################################################################################
+typedef struct
+{
+    CHAR    data[MAX_REPLY_SZ];
+    UINT32  len;
+    UINT32  partCnt;
+}TEST_REPLY_t;
+
+//#################################################################################################
+// @STATIC VARIABLES
+//#################################################################################################
+static UINT32       randSeed = 1;
+static TEST_REPLY_t testReply;
+
+/* Characters which mutated request and parsed value are made of */
+static const CHAR   mutateChar[] = {'0', '1', '9', SOT, EOT, SOI, EOI, FSP, FVS, EOM, 'x', '-', ' '};
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Capture reply sent to client. Set config reply is sent in single part.
+ * @param   pSendBuff
+ * @param   buffLen
+ * @return  SUCCESS/FAIL
+ */
+static BOOL captureTestReply(UINT8 *pSendBuff, UINT32 buffLen)
+{
+    if (buffLen >= sizeof(testReply.data))
+    {
+        return FAIL;
+    }
+
+    memcpy(testReply.data, pSendBuff, buffLen);
+    testReply.data[buffLen] = '\0';
+    testReply.len = buffLen;
+    testReply.partCnt++;
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Give set config request and take status of its reply
+ * @param   pReqStr - Request which is parsed in place
+ * @return  Status of reply, TEST_REPLY_MALFORMED when reply is not single status reply
+ */
+static NET_CMD_STATUS_e setConfig(CHARPTR pReqStr)
+{
+    CHAR    header[32];
+    UINT32  headerLen;
+    INT32   status;
+    CHARPTR pEnd;
+
+    testReply.len = 0;
+    testReply.partCnt = 0;
+    ProcessSetConfig(pReqStr, 0, "SetConfigTest", CLIENT_CB_TYPE_NATIVE);
+
+    headerLen = snprintf(header, sizeof(header), "%c%s%c", SOM, headerReq[RPL_CFG], FSP);
+    if ((testReply.partCnt != 1) || (testReply.len <= headerLen) || (memcmp(testReply.data, header, headerLen) != 0))
+    {
+        return TEST_REPLY_MALFORMED;
+    }
+
+    status = strtol(testReply.data + headerLen, &pEnd, 10);
+    if ((pEnd == (testReply.data + headerLen)) || (pEnd[0] != FSP) || (pEnd[1] != EOM) || (pEnd[2] != '\0')
+            || (status < CMD_SUCCESS) || (status > CMD_SESSION_EXPIRED))
+    {
+        return TEST_REPLY_MALFORMED;
+    }
+
+    return (NET_CMD_STATUS_e)status;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Compose reply of all indexes and fields of table
+ * @param   tableId
+ * @param   pReply
+ * @return  Status of table function
+ */
+static NET_CMD_STATUS_e getTableReply(UINT16 tableId, CHARPTR pReply)
+{
+    return getCfgFuncPtr[tableId](0, totalIndexPerEveryTable[tableId] - 1, 0, maxFieldPerTable[tableId] - 1,
+                                  pReply, TEST_TABLE_REPLY_LEN_MAX);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Make set config request of table from its get config reply
+ * @param   tableId
+ * @param   pTableReply
+ * @param   pReqStr - Buffer of TEST_TABLE_REPLY_LEN_MAX + 32 bytes
+ * @return  Length of request
+ */
+static UINT32 makeSetRequest(UINT16 tableId, const CHAR *pTableReply, CHARPTR pReqStr)
+{
+    return snprintf(pReqStr, TEST_TABLE_REPLY_LEN_MAX + 32, "%c%d%c%s%c%c", SOT, OUR_TO_CLIENT_INDEX(tableId), FSP, pTableReply, EOT, EOM);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Decode values as set config decoded them before, by copy of value string and its conversion
+ * @param   pSrc
+ * @param   pVal
+ * @param   argCnt
+ * @param   delim
+ * @return  SUCCESS/FAIL
+ */
+static BOOL parseValByCopy(CHARPTR *pSrc, UINT64PTR pVal, UINT8 argCnt, UINT8 delim)
+{
+    UINT8   argIdx;
+    CHAR    valStr[PARSE_STR_VAL_LEN_MAX];
+
+    for (argIdx = 0; argIdx < argCnt; argIdx++)
+    {
+        if ((ParseStr(pSrc, delim, valStr, sizeof(valStr)) == FAIL) || (AsciiToInt(valStr, &pVal[argIdx]) == FAIL))
+        {
+            return FAIL;
+        }
+    }
+
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Values decoded in single pass must be same as values decoded by copy, for digits of any
+ *          length, empty values, values which overflow and values with other characters. Position of
+ *          string after values must be same too.
+ */
+static void testParseVal(void)
+{
+    static CHAR valStr[(PARSE_STR_VAL_LEN_MAX + 8) * TEST_PARSE_ARG_MAX];
+    UINT64      singlePassVal[TEST_PARSE_ARG_MAX], copyVal[TEST_PARSE_ARG_MAX];
+    UINT32      testCnt, strLen, valLen, charIdx, mismatchCnt = 0;
+    UINT8       argCnt, argIdx;
+    CHARPTR     pSinglePass, pCopy;
+    BOOL        singlePassStatus, copyStatus;
+
+    for (testCnt = 0; testCnt < TEST_PARSE_VAL_CNT; testCnt++)
+    {
+        argCnt = (rand_r(&randSeed) % TEST_PARSE_ARG_MAX) + 1;
+        strLen = 0;
+        for (argIdx = 0; argIdx < argCnt; argIdx++)
+        {
+            /* Length near limit of value is taken often */
+            valLen = ((rand_r(&randSeed) % 4) == 0) ? (PARSE_STR_VAL_LEN_MAX - 3 + (rand_r(&randSeed) % 5)) : (rand_r(&randSeed) % 24);
+            for (charIdx = 0; charIdx < valLen; charIdx++)
+            {
+                valStr[strLen++] = ((rand_r(&randSeed) % 64) == 0) ? mutateChar[rand_r(&randSeed) % sizeof(mutateChar)] : ('0' + (rand_r(&randSeed) % 10));
+            }
+            valStr[strLen++] = FSP;
+        }
+
+        /* Value string is not always ended with delimiter */
+        if ((rand_r(&randSeed) % 8) == 0)
+        {
+            strLen = rand_r(&randSeed) % strLen;
+        }
+        memset(valStr + strLen, '\0', sizeof(valStr) - strLen);
+
+        pSinglePass = pCopy = valStr;
+        memset(singlePassVal, 0, sizeof(singlePassVal));
+        memset(copyVal, 0, sizeof(copyVal));
+        singlePassStatus = ParseStringGetVal(&pSinglePass, singlePassVal, argCnt, FSP);
+        copyStatus = parseValByCopy(&pCopy, copyVal, argCnt, FSP);
+        if ((singlePassStatus != copyStatus)
+                || ((copyStatus == SUCCESS) && ((pSinglePass != pCopy) || (memcmp(singlePassVal, copyVal, sizeof(copyVal)) != 0))))
+        {
+            mismatchCnt++;
+            fprintf(stderr, "parse mismatch: [test=%u], [args=%d], [status=%d/%d]\n", testCnt, argCnt, singlePassStatus, copyStatus);
+        }
+    }
+
+    UT_CHECK_MSG(mismatchCnt == 0, "[mismatch=%u]", mismatchCnt);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check round trip of table. Get config reply of whole table is given in set config request
+ *          and table must be same after it.
+ * @param   tableId
+ * @param   pFirstReply - Buffer of TEST_TABLE_REPLY_LEN_MAX which has reply of whole table
+ * @param   pSecondReply - Buffer of TEST_TABLE_REPLY_LEN_MAX
+ * @param   pReqStr - Buffer of TEST_TABLE_REPLY_LEN_MAX + 32
+ * @param   pStatus - Status of set config
+ * @return  TRUE if table is not changed by set config
+ */
+static BOOL isTableRoundTrip(UINT16 tableId, const CHAR *pFirstReply, CHARPTR pSecondReply, CHARPTR pReqStr, NET_CMD_STATUS_e *pStatus)
+{
+    makeSetRequest(tableId, pFirstReply, pReqStr);
+    *pStatus = setConfig(pReqStr);
+    if (getTableReply(tableId, pSecondReply) != CMD_SUCCESS)
+    {
+        return FALSE;
+    }
+
+    return (strcmp(pFirstReply, pSecondReply) == 0);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Every table which has get and set function is given back to set config and it must be set
+ *          with success without any change. Table whose whole range of fields can not be given by get
+ *          config is not checked.
+ */
+static void testRoundTrip(CHARPTR pFirstReply, CHARPTR pSecondReply, CHARPTR pReqStr)
+{
+    UINT16              tableId;
+    UINT32              tableCnt = 0, failCnt = 0;
+    NET_CMD_STATUS_e    status;
+
+    for (tableId = 0; tableId < MAX_TBL_CFG; tableId++)
+    {
+        if ((getCfgFuncPtr[tableId] == NULL) || (setCfgFuncPtr[tableId] == NULL) || (getTableReply(tableId, pFirstReply) != CMD_SUCCESS))
+        {
+            continue;
+        }
+
+        tableCnt++;
+        if ((isTableRoundTrip(tableId, pFirstReply, pSecondReply, pReqStr, &status) == FALSE) || (status != CMD_SUCCESS))
+        {
+            failCnt++;
+            fprintf(stderr, "round trip failed: [tableId=%d], [status=%d]\n", OUR_TO_CLIENT_INDEX(tableId), status);
+        }
+    }
+
+    UT_CHECK_MSG((tableCnt > 0) && (failCnt == 0), "[tables=%u], [failed=%u]", tableCnt, failCnt);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Set config request of random table is mutated by changing, removing or adding random
+ *          characters and cutting it. Every mutated request must give single status reply. Mutated
+ *          request may change table, but get config reply of table must still be set back without any
+ *          change. Overflow of buffers is caught by sanitizer build.
+ */
+static void testMutatedRequests(CHARPTR pFirstReply, CHARPTR pSecondReply, CHARPTR pReqStr)
+{
+    UINT16              tableId;
+    UINT32              reqCnt, mutateCnt, reqLen, pos;
+    UINT32              malformedCnt = 0, roundTripFailCnt = 0, successCnt = 0;
+    NET_CMD_STATUS_e    status;
+
+    for (reqCnt = 0; reqCnt < TEST_MUTATED_REQ_CNT; reqCnt++)
+    {
+        do
+        {
+            tableId = rand_r(&randSeed) % MAX_TBL_CFG;
+        }
+        while ((getCfgFuncPtr[tableId] == NULL) || (setCfgFuncPtr[tableId] == NULL));
+
+        if (getTableReply(tableId, pFirstReply) != CMD_SUCCESS)
+        {
+            continue;
+        }
+
+        reqLen = makeSetRequest(tableId, pFirstReply, pReqStr);
+        for (mutateCnt = (rand_r(&randSeed) % 4) + 1; (mutateCnt > 0) && (reqLen > 0); mutateCnt--)
+        {
+            pos = rand_r(&randSeed) % reqLen;
+            switch (rand_r(&randSeed) % 4)
+            {
+                case 0:
+                    pReqStr[pos] = mutateChar[rand_r(&randSeed) % sizeof(mutateChar)];
+                    break;
+
+                case 1:
+                    memmove(pReqStr + pos, pReqStr + pos + 1, reqLen - pos);
+                    reqLen--;
+                    break;
+
+                case 2:
+                    memmove(pReqStr + pos + 1, pReqStr + pos, reqLen - pos + 1);
+                    pReqStr[pos] = mutateChar[rand_r(&randSeed) % sizeof(mutateChar)];
+                    reqLen++;
+                    break;
+
+                default:
+                    pReqStr[pos] = '\0';
+                    reqLen = pos;
+                    break;
+            }
+        }
+
+        status = setConfig(pReqStr);
+        if (status == TEST_REPLY_MALFORMED)
+        {
+            malformedCnt++;
+            fprintf(stderr, "malformed reply: [req=%u], [tableId=%d], [len=%u]\n", reqCnt, OUR_TO_CLIENT_INDEX(tableId), testReply.len);
+        }
+        else if (status == CMD_SUCCESS)
+        {
+            successCnt++;
+        }
+
+        /* Table is taken again as mutated request may change it */
+        status = TEST_REPLY_MALFORMED;
+        if ((getTableReply(tableId, pFirstReply) != CMD_SUCCESS)
+                || (isTableRoundTrip(tableId, pFirstReply, pSecondReply, pReqStr, &status) == FALSE) || (status != CMD_SUCCESS))
+        {
+            roundTripFailCnt++;
+            fprintf(stderr, "round trip failed after mutated request: [req=%u], [tableId=%d], [status=%d]\n",
+                    reqCnt, OUR_TO_CLIENT_INDEX(tableId), status);
+        }
+    }
+
+    UT_CHECK_MSG(malformedCnt == 0, "[malformed=%u]", malformedCnt);
+    UT_CHECK_MSG(roundTripFailCnt == 0, "[roundTripFail=%u]", roundTripFailCnt);
+
+    /* Mutation which keeps request valid must be covered too */
+    UT_CHECK_MSG(successCnt > 0, "[success=%u]", successCnt);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Main function of test
+ * @return  EXIT_SUCCESS if all checks pass
+ */
+int main(void)
+{
+    CHARPTR pFirstReply = malloc(TEST_TABLE_REPLY_LEN_MAX);
+    CHARPTR pSecondReply = malloc(TEST_TABLE_REPLY_LEN_MAX);
+    CHARPTR pReqStr = malloc(TEST_TABLE_REPLY_LEN_MAX + 32);
+
+    UT_CHECK(initDfltConfigStore() == SUCCESS);
+    UT_CHECK((pFirstReply != NULL) && (pSecondReply != NULL) && (pReqStr != NULL));
+    InitNetworkConfig();
+
+    testParseVal();
+    if ((pFirstReply != NULL) && (pSecondReply != NULL) && (pReqStr != NULL))
+    {
+        testRoundTrip(pFirstReply, pSecondReply, pReqStr);
+        testMutatedRequests(pFirstReply, pSecondReply, pReqStr);
+    }
+
+    FREE_MEMORY(pFirstReply);
+    FREE_MEMORY(pSecondReply);
+    FREE_MEMORY(pReqStr);
+    return UT_RESULT("SetConfigTest");
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
@@ -0,0 +1,406 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       ConfigStoreStub.c
+@brief      Stubs of modules used by configuration store (ConfigFileIO.c) for host unit tests. Test
+            which includes configuration store includes this file after it. Modules are not notified
+            of configuration change and every new configuration is taken as valid.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Application Includes */
+#include "ConfigApi.h"
+#include "CameraInterface.h"
+#include "DiskController.h"
+#include "DiskManagerComn.h"
+#include "FcmPushNotification.h"
+#include "TcpNotification.h"
+#include "DdnsClient.h"
+#include "SmtpClient.h"
+#include "DhcpServer.h"
+#include "DateTime.h"
+#include "SysTimer.h"
+#include "EventLogger.h"
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+/** ******************************************************************************************* **/
+/**                          Validation and change notification of modules                      **/
+/** ******************************************************************************************* **/
+//-------------------------------------------------------------------------------------------------
+void CiCameraConfigNotify(CAMERA_CONFIG_t newCameraConfig, CAMERA_CONFIG_t *oldCameraConfig, UINT8 cameraIndex)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void CiGeneralCfgUpdate(GENERAL_CONFIG_t generalConfig, GENERAL_CONFIG_t *oldgeneralConfig)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void CiIpCameraConfigNotify(IP_CAMERA_CONFIG_t newIpCfg, IP_CAMERA_CONFIG_t *oldIpCfg, UINT8 cameraIndex)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void CiLanCfgUpdate(LAN_CONFIG_ID_e lanNo, LAN_CONFIG_t newLanConfig, LAN_CONFIG_t *oldLanConfig)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void CiPtzPositionConfigNotify(PTZ_PRESET_CONFIG_t newPtzPresetCfg, PTZ_PRESET_CONFIG_t *oldPtzPresetCfg, UINT8 cameraIndex, UINT8 ptzIndex)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void CiServerConfigChangeNotify(GENERAL_CONFIG_t newGeneralConfig, GENERAL_CONFIG_t *oldGeneralConfig)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void CiStreamCamConfigChange(CAMERA_CONFIG_t newCameraConfig, CAMERA_CONFIG_t *oldCameraConfig, UINT8 cameraIndex)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void CiStreamConfigNotify(STREAM_CONFIG_t *newStreamConfig, STREAM_CONFIG_t *oldStreamConfig, UINT8 cameraIndex)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void DhcpServerConfigNotify(DHCP_SERVER_CONFIG_t newCopy, DHCP_SERVER_CONFIG_t *oldCopy)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void DhcpServerLanConfigUpdate(LAN_CONFIG_ID_e lanNo, LAN_CONFIG_t newLanConfig, LAN_CONFIG_t *oldLanConfig)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void DiGeneralConfigNotify(GENERAL_CONFIG_t newGeneralConfig, GENERAL_CONFIG_t *oldGeneralConfig)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+BOOL DmCfgChange(HDD_CONFIG_t newHddConfig, HDD_CONFIG_t *oldHddConfig)
+{
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+BOOL DmFTPUploadCfgUpdate(FTP_SERVER_e index)
+{
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+void DmFileAccessCfgUpdate(FILE_ACCESS_CONFIG_t newFileAccessCfg, FILE_ACCESS_CONFIG_t *oldFileAccessCfg)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+BOOL DmNddCfgChange(NETWORK_DRIVE_CONFIG_t newNddConfig, NETWORK_DRIVE_CONFIG_t *oldNddConfig, UINT8 nwDriveIndex)
+{
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+void DmStorageCfgUpdate(STORAGE_CONFIG_t newStorageConfig, STORAGE_CONFIG_t *oldStorageConfig)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void EvntHndlrCamEventCfgUpdate(CAMERA_EVENT_CONFIG_t newCfg, CAMERA_EVENT_CONFIG_t *oldCfg, UINT8 camIndex, UINT8 camEventIndex)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void EvntHndlrSensorEventCfgUpdate(SENSOR_EVENT_CONFIG_t newCfg, SENSOR_EVENT_CONFIG_t *oldCfg, UINT8 sensorIndex)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void EvntHndlrSystemEventCfgUpdate(SYSTEM_EVENT_CONFIG_t newCfg, SYSTEM_EVENT_CONFIG_t *oldCfg, UINT8 systemIndex)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+BOOL FcmPushNotifyConfigUpdate(FCM_PUSH_NOTIFY_CONFIG_t newCopyPtr, FCM_PUSH_NOTIFY_CONFIG_t *oldCopy)
+{
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+void FirmwareManagementConfigNotify(FIRMWARE_MANAGEMENT_CONFIG_t newCopy, FIRMWARE_MANAGEMENT_CONFIG_t *oldCopy)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void ImageSettingConfigNotify(IMG_SETTING_CONFIG_t newCopy, IMG_SETTING_CONFIG_t *oldCopy, UINT8 camIndex)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void LoginPolicyCfgUpdate(LOGIN_POLICY_CONFIG_t newLoginPolicyCfg, LOGIN_POLICY_CONFIG_t *oldLoginPolicyCfg)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void ManualBackupCfgUpdate(MANUAL_BACKUP_CONFIG_t newCfg)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void MobileBroadbandCfgUpdate(BROAD_BAND_CONFIG_t newCopy, BROAD_BAND_CONFIG_t *oldCopy)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void NcGeneralCfgUpdate(GENERAL_CONFIG_t updateConfig, GENERAL_CONFIG_t *oldGenCfg)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void NotifyAlarmConfigChange(CAMERA_ALARM_CONFIG_t newAlarmConfig, CAMERA_ALARM_CONFIG_t *oldAlarmConfig, UINT8 cameraIndex, UINT8 alarmIndex)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void NwGeneralCfgUpdate(GENERAL_CONFIG_t newGenCfg, GENERAL_CONFIG_t *oldGenCfg)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void P2pConfigNotify(P2P_CONFIG_t newP2PConfig, P2P_CONFIG_t *oldP2PConfig)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void P2pDateTimeCfgUpdate(DATE_TIME_CONFIG_t newCopy, DATE_TIME_CONFIG_t *oldCopy)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void P2pLanConfigUpdate(LAN_CONFIG_ID_e lanNo)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void P2pMobileBroadbandCfgUpdate(void)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void P2pUpdateDefaultRoute(STATIC_ROUTING_CONFIG_t newCopy, STATIC_ROUTING_CONFIG_t *oldCopy)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void RMConfigNotify(CAMERA_CONFIG_t newCameraConfig, CAMERA_CONFIG_t *oldCameraConfig, UINT8 cameraIndex)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void RmConfigChangeNotify(MANUAL_RECORD_CONFIG_t newManualRecordConfig, MANUAL_RECORD_CONFIG_t *oldManualRecordConfig, UINT8 cameraIndex)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void ScheduleBackupCfgUpdate(SCHEDULE_BACKUP_CONFIG_t *newCfg, SCHEDULE_BACKUP_CONFIG_t *oldCfg)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void StorageAllocationConfigNotify(STORAGE_ALLOCATION_CONFIG_t newCopy, STORAGE_ALLOCATION_CONFIG_t *oldCopy)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void TcpConfigUpdate(TCP_NOTIFY_CONFIG_t newCopyPtr, TCP_NOTIFY_CONFIG_t *oldCopy)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateAlarmConfig(ALARM_CONFIG_t newCfg, ALARM_CONFIG_t *oldCfg, UINT8 alarmNo)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateDateTimeConfig(DATE_TIME_CONFIG_t newDateTimeConfig, DATE_TIME_CONFIG_t *oldDateTimeConfig)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateDdnsConfig(DDNS_CONFIG_t newDdnsConfig, DDNS_CONFIG_t *oldDdnsConfig)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateDstConfig(DST_CONFIG_t newDstConfig)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+BOOL UpdateLanConfig(LAN_CONFIG_ID_e lanNo, LAN_CONFIG_t newLanConfig, LAN_CONFIG_t *oldLanConfig)
+{
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateMatrixDnsServerCfg(MATRIX_DNS_SERVER_CONFIG_t *newCopy, MATRIX_DNS_SERVER_CONFIG_t *oldCopy)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateSensorConfig(SENSOR_CONFIG_t newSensorConfig, SENSOR_CONFIG_t *oldSensorConfig, UINT8 sensorNo)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateSmtpConfig(SMTP_CONFIG_t newCopy, SMTP_CONFIG_t *oldCopy)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+BOOL UpdateStaticRouting(STATIC_ROUTING_CONFIG_t newCopy, STATIC_ROUTING_CONFIG_t *oldCopy)
+{
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateTourCfg(UINT8 camIndex, PRESET_TOUR_CONFIG_t newTourCfg, PRESET_TOUR_CONFIG_t *oldPresetPtr)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void UpdateTourScheduleCfg(UINT8 camIndex, TOUR_SCHEDULE_CONFIG_t newTourSchCfg, TOUR_SCHEDULE_CONFIG_t *oldSchedule)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+void UserAccountCfgUpdate(USER_ACCOUNT_CONFIG_t newUsrAccontCfg, USER_ACCOUNT_CONFIG_t *oldUsrAccontCfg, UINT8 usrIndx)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+NET_CMD_STATUS_e ValidateCameraCfg(CAMERA_CONFIG_t *newCfg, CAMERA_CONFIG_t *oldCfg)
+{
+    return CMD_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+NET_CMD_STATUS_e ValidateDhcpServerCfg(DHCP_SERVER_CONFIG_t newDhcpServerConfig)
+{
+    return CMD_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+NET_CMD_STATUS_e ValidateHddConfig(HDD_CONFIG_t newHddConfig, HDD_CONFIG_t *oldHddConfig)
+{
+    return CMD_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+NET_CMD_STATUS_e ValidateLanConfig(LAN_CONFIG_ID_e lanNo, LAN_CONFIG_t newLanConfig)
+{
+    return CMD_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+NET_CMD_STATUS_e ValidatePtzPresetCfg(PTZ_PRESET_CONFIG_t *newCfg, UINT8 cameraIndex)
+{
+    return CMD_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+NET_CMD_STATUS_e ValidateStaticRoutingCfg(STATIC_ROUTING_CONFIG_t newCfg)
+{
+    return CMD_SUCCESS;
+}
+
+/** ******************************************************************************************* **/
+/**                                     System services                                         **/
+/** ******************************************************************************************* **/
+//-------------------------------------------------------------------------------------------------
+void DeleteTimer(TIMER_HANDLE *handle)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+UINT64 GetMonotonicTimeInSec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec;
+}
+
+//-------------------------------------------------------------------------------------------------
+BOOL GetNetworkParamInfo(NETWORK_PORT_e portType, LAN_CONFIG_t *networkInfo)
+{
+    /* Runtime parameters of LAN port are same as its configuration on host */
+    if (portType == NETWORK_PORT_LAN1)
+    {
+        return ReadLan1Config(networkInfo);
+    }
+
+    return ReadLan2Config(networkInfo);
+}
+
+//-------------------------------------------------------------------------------------------------
+BOOL StartTimer(TIMER_INFO_t timerInfo, TIMER_HANDLE *handle)
+{
+    return SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+BOOL WriteEvent(LOG_EVENT_TYPE_e eventType, LOG_EVENT_SUBTYPE_e eventSubtype, const CHAR *detail, const CHAR *advncDetail, LOG_EVENT_STATE_e eventState)
+{
+    return SUCCESS;
+}
+
+/** ******************************************************************************************* **/
+/**                                 Configuration store of test                                 **/
+/** ******************************************************************************************* **/
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Load default of all configurations in master copy, like system init does when config
+ *          files are not present. Updates are written in config journal of temporary file instead
+ *          of config files, so configuration can be written by test on host.
+ * @return  SUCCESS/FAIL
+ * @note    Test has to include ConfigFileIO.c before this file
+ */
+static BOOL initDfltConfigStore(void)
+{
+    UINT8   configId;
+    CHAR    journalPath[] = "/tmp/ConfigJournalXXXXXX";
+
+    configJournal.fd = mkstemp(journalPath);
+    if (configJournal.fd == INVALID_FILE_FD)
+    {
+        return FAIL;
+    }
+
+    /* Journal file is removed on exit of test */
+    unlink(journalPath);
+
+    for (configId = 0; configId < MAX_CONFIG_ID; configId++)
+    {
+        pthread_rwlock_init(&rwLock[configId], NULL);
+        configVersion[configId] = CONFIG_VERSION_INVALID + 1;
+        if (dfltXXXConfigInternal(configId, TRUE, WHOLE_CONFIG, 0, 0) == FAIL)
+        {
+            return FAIL;
+        }
+    }
+
+    return SUCCESS;
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
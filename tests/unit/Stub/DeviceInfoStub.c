@@ -0,0 +1,30 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       DeviceInfoStub.c
+@brief      Stub of device information for host unit tests. Test which includes unit using variant of
+            device includes this file after it. Host is taken as variant of max cameras of build.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Application Includes */
+#include "DeviceInfo.h"
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Get max camera of variant
+ * @return  Max camera
+ */
+UINT8 getMaxCameraForCurrentVariant(void)
+{
+    return MAX_CAMERA;
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
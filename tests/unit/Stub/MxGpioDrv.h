@@ -0,0 +1,14 @@
+#if !defined MX_GPIO_DRV_H
+#define MX_GPIO_DRV_H
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       MxGpioDrv.h
+@brief      Placeholder of GPIO driver header of platform for host unit tests. Driver header is
+            taken from platform build, which is not available for host build.
+*/
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
+#endif // MX_GPIO_DRV_H
@@ -0,0 +1,97 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       NetworkManagerStub.c
+@brief      Stubs of modules used by configuration commands of network manager (NetworkConfig.c) for
+            host unit tests. Test which includes network manager includes this file after it. Reply
+            sent to client on native TCP or P2P is given to captureTestReply() of test. Copy of
+            configuration to other cameras is not done.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Application Includes */
+#include "UtilCommon.h"
+#include "P2pInterface.h"
+#include "CameraInterface.h"
+
+//#################################################################################################
+// @PROTOTYPES
+//#################################################################################################
+/* Test takes reply sent to client. It is defined by test. */
+static BOOL captureTestReply(UINT8 *pSendBuff, UINT32 buffLen);
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Native TCP send of reply
+ * @param   connFd
+ * @param   pSendBuff
+ * @param   buffLen
+ * @param   timeoutSec
+ * @return  SUCCESS/FAIL as given by test
+ */
+BOOL SendToSocket(INT32 connFd, UINT8 *pSendBuff, UINT32 buffLen, UINT32 timeoutSec)
+{
+    return captureTestReply(pSendBuff, buffLen);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   P2P send of reply
+ * @param   connFd
+ * @param   pSendBuff
+ * @param   sendLen
+ * @param   timeout
+ * @return  SUCCESS/FAIL as given by test
+ */
+BOOL P2pCmdSendCallback(INT32 connFd, UINT8 *pSendBuff, UINT32 sendLen, UINT32 timeout)
+{
+    return captureTestReply(pSendBuff, sendLen);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Copy of image setting to other cameras
+ * @param   sourceCamera
+ * @param   pSrcImgSettingCfg
+ * @param   copyToCamera
+ * @return  CMD_SUCCESS
+ */
+NET_CMD_STATUS_e WriteImageSettingAfterAdjust(UINT8 sourceCamera, IMG_SETTING_CONFIG_t *pSrcImgSettingCfg, CAMERA_BIT_MASK_t copyToCamera)
+{
+    return CMD_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Copy of stream parameters to other cameras
+ * @param   srcCamIndex
+ * @param   pSrcStreamCfg
+ * @param   pCopyToCamMask
+ * @return  CMD_SUCCESS
+ */
+NET_CMD_STATUS_e StreamParamCopyToCamera(UINT8 srcCamIndex, STREAM_CONFIG_t *pSrcStreamCfg, CAMERA_BIT_MASK_t *pCopyToCamMask)
+{
+    return CMD_SUCCESS;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Copy of motion detection to other cameras
+ * @param   srcCamIndex
+ * @param   pSrcCamConfig
+ * @param   copyToCamMask
+ * @return  CMD_SUCCESS
+ */
+NET_CMD_STATUS_e MotionDetectionCopyToCamera(UINT8 srcCamIndex, CAMERA_CONFIG_t *pSrcCamConfig, CAMERA_BIT_MASK_t copyToCamMask)
+{
+    return CMD_SUCCESS;
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
@@ -0,0 +1,55 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       TcpClientStub.c
+@brief      Stubs of modules used by TCP client of camera initiation (TcpClient.c) for host unit tests.
+            Test which includes TCP client includes this file after it. Camera is always connected
+            and stream sockets are closed by test itself.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Application Includes */
+#include "CameraInitiation.h"
+#include "DateTime.h"
+#include "UnitTest.h"
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Camera is always connected in test
+ * @param   camIndex
+ * @return  ACTIVE
+ */
+UINT8 GetCameraConnectionStatus(UINT8 camIndex)
+{
+    return ACTIVE;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Stream sockets are closed by test itself
+ * @param   camIndex
+ * @param   handle
+ * @param   isFdNeeded
+ */
+void CloseCamCmdFd(UINT8 camIndex, UINT8 handle, BOOL isFdNeeded)
+{
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Get monotonic time
+ * @return  Time in milli seconds
+ */
+UINT64 GetMonotonicTimeInMilliSec(void)
+{
+    return UtGetTimeNs() / 1000000ULL;
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
@@ -0,0 +1,149 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       StrIndexTableBench.c
+@brief      Benchmark of string index lookup of message headers and SET_CMD commands. Lookup through
+            string index table is compared with linear search of ConvertStringToIndex(). Tokens of
+            table are looked up in order as well as unknown tokens, which are worst case of linear search.
+
+            Usage: StrIndexTableBench [rounds]
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Unit under test */
+#include "Utils.c"
+#include "NetworkCommand.c"
+
+/* Application Includes */
+#include "UnitTest.h"
+
+//#################################################################################################
+// @DEFINES
+//#################################################################################################
+#define BENCH_DEFAULT_ROUND_CNT     (20000)
+#define BENCH_UNKNOWN_TOKEN_CNT     (8)
+
+//#################################################################################################
+// @DATA TYPES
+//#################################################################################################
+typedef struct
+{
+    const CHAR      *name;
+    const CHARPTR   *pStrTbl;
+    UINT8           maxIndex;
+}BENCH_STR_TABLE_t;
+
+//#################################################################################################
+// @STATIC VARIABLES
+//#################################################################################################
+static const CHARPTR unknownToken[BENCH_UNKNOWN_TOKEN_CNT] =
+{
+    "SET_CMDX", "GET_CFG_X", "UNKNOWN", "REQ_LOGX", "ack_log_1", "SRT_LV_STRM_X", "PLAYBACK", "X",
+};
+
+/* Sum of indexes, so lookups are not removed by compiler */
+static volatile UINT32 indexSum;
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Lookup tokens in rounds by string index table or linear search
+ * @param   pIndexTbl
+ * @param   pToken - Tokens to lookup
+ * @param   tokenCnt
+ * @param   roundCnt
+ * @param   hashF - TRUE for string index table, FALSE for linear search
+ * @return  Time taken in nano seconds
+ */
+static UINT64 lookupTokens(STR_INDEX_TABLE_t *pIndexTbl, const CHARPTR *pToken, UINT32 tokenCnt, UINT32 roundCnt, BOOL hashF)
+{
+    UINT32  roundIdx, tokenIdx, sum = 0;
+    UINT64  startNs = UtGetTimeNs();
+
+    for (roundIdx = 0; roundIdx < roundCnt; roundIdx++)
+    {
+        for (tokenIdx = 0; tokenIdx < tokenCnt; tokenIdx++)
+        {
+            if (hashF == TRUE)
+            {
+                sum += FindStrIndex(pIndexTbl, pToken[tokenIdx]);
+            }
+            else
+            {
+                sum += ConvertStringToIndex(pToken[tokenIdx], pIndexTbl->pStrTbl, pIndexTbl->maxIndex);
+            }
+            UT_BARRIER();
+        }
+    }
+
+    indexSum += sum;
+    return UtGetTimeNs() - startNs;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Main function of benchmark
+ * @param   argc
+ * @param   argv - Optional rounds of lookup
+ * @return  EXIT_SUCCESS if both lookups give same indexes
+ */
+int main(int argc, char *argv[])
+{
+    const BENCH_STR_TABLE_t strTable[] =
+    {
+        {"headerReq",       headerReq,      MAX_HEADER_REQ},
+        {"netCommandStr",   netCommandStr,  MAX_NET_COMMAND},
+    };
+    STR_INDEX_TABLE_t       indexTbl;
+    UINT32                  roundCnt = BENCH_DEFAULT_ROUND_CNT, tokenIdx, hashSum, linearSum;
+    UINT64                  elapsedNs;
+    UINT8                   tblIdx;
+    CHAR                    caseName[64];
+
+    if ((argc > 1) && (atoi(argv[1]) > 0))
+    {
+        roundCnt = atoi(argv[1]);
+    }
+
+    for (tblIdx = 0; tblIdx < (sizeof(strTable) / sizeof(strTable[0])); tblIdx++)
+    {
+        indexTbl = (STR_INDEX_TABLE_t)STR_INDEX_TABLE_INIT(strTable[tblIdx].pStrTbl, strTable[tblIdx].maxIndex);
+        UT_CHECK(InitStrIndexTable(&indexTbl) == SUCCESS);
+
+        elapsedNs = lookupTokens(&indexTbl, strTable[tblIdx].pStrTbl, strTable[tblIdx].maxIndex, roundCnt, FALSE);
+        snprintf(caseName, sizeof(caseName), "%s(%d) linear, all tokens", strTable[tblIdx].name, strTable[tblIdx].maxIndex);
+        UtPrintBench(caseName, (UINT64)roundCnt * strTable[tblIdx].maxIndex, elapsedNs);
+
+        elapsedNs = lookupTokens(&indexTbl, strTable[tblIdx].pStrTbl, strTable[tblIdx].maxIndex, roundCnt, TRUE);
+        snprintf(caseName, sizeof(caseName), "%s(%d) hash, all tokens", strTable[tblIdx].name, strTable[tblIdx].maxIndex);
+        UtPrintBench(caseName, (UINT64)roundCnt * strTable[tblIdx].maxIndex, elapsedNs);
+
+        elapsedNs = lookupTokens(&indexTbl, unknownToken, BENCH_UNKNOWN_TOKEN_CNT, roundCnt, FALSE);
+        snprintf(caseName, sizeof(caseName), "%s(%d) linear, unknown tokens", strTable[tblIdx].name, strTable[tblIdx].maxIndex);
+        UtPrintBench(caseName, (UINT64)roundCnt * BENCH_UNKNOWN_TOKEN_CNT, elapsedNs);
+
+        elapsedNs = lookupTokens(&indexTbl, unknownToken, BENCH_UNKNOWN_TOKEN_CNT, roundCnt, TRUE);
+        snprintf(caseName, sizeof(caseName), "%s(%d) hash, unknown tokens", strTable[tblIdx].name, strTable[tblIdx].maxIndex);
+        UtPrintBench(caseName, (UINT64)roundCnt * BENCH_UNKNOWN_TOKEN_CNT, elapsedNs);
+
+        /* Both lookups must give same index for every token */
+        hashSum = linearSum = 0;
+        for (tokenIdx = 0; tokenIdx < strTable[tblIdx].maxIndex; tokenIdx++)
+        {
+            hashSum += FindStrIndex(&indexTbl, strTable[tblIdx].pStrTbl[tokenIdx]);
+            linearSum += ConvertStringToIndex(strTable[tblIdx].pStrTbl[tokenIdx], indexTbl.pStrTbl, indexTbl.maxIndex);
+        }
+        UT_CHECK_MSG(hashSum == linearSum, "[table=%s]", strTable[tblIdx].name);
+        FREE_MEMORY(indexTbl.pBucket);
+    }
+
+    return UT_RESULT("StrIndexTableBench");
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
@@ -0,0 +1,278 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       StrIndexTableTest.c
+@brief      Conformance test of string index table against ConvertStringToIndex(). Index given by
+            FindStrIndex() must be same as linear search for every string of table in any case, for
+            repeated strings (first index) and for unknown tokens (max index), before and after table
+            is built. Message header and SET_CMD command tables of network manager are checked along
+            with random tables which have many repeated strings and hash collisions.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Unit under test */
+#include "Utils.c"
+#include "NetworkCommand.c"
+
+/* Application Includes */
+#include "UnitTest.h"
+
+//#################################################################################################
+// @DEFINES
+//#################################################################################################
+#define TEST_RANDOM_TABLE_CNT       (200)
+#define TEST_RANDOM_QUERY_CNT       (500)
+#define TEST_MAX_TOKEN_LEN          (24)
+#define TEST_CASE_VARIANT_CNT       (4)
+
+//#################################################################################################
+// @DATA TYPES
+//#################################################################################################
+typedef struct
+{
+    const CHAR      *name;
+    const CHARPTR   *pStrTbl;
+    UINT8           maxIndex;
+}TEST_STR_TABLE_t;
+
+//#################################################################################################
+// @STATIC VARIABLES
+//#################################################################################################
+static UINT32 randSeed = 1;
+
+/* Tokens which are not present in tables, including prefix and suffix of present ones */
+static const CHARPTR unknownToken[] =
+{
+    "", " ", "SET_CM", "SET_CMDX", "GET_CFG ", " GET_CFG", "RPL_CMD\n", "\xc3\x89VENT", "unknown_header_token",
+};
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Make copy of string with case changed as per variant. Variant 0 keeps string as it is,
+ *          1 makes lower case, 2 makes upper case and others change case of random characters.
+ * @param   strPtr
+ * @param   variant
+ * @param   outStr
+ */
+static void makeCaseVariant(const CHAR *strPtr, UINT8 variant, CHAR outStr[TEST_MAX_TOKEN_LEN * 4])
+{
+    UINT32 charIdx;
+
+    for (charIdx = 0; (strPtr[charIdx] != '\0') && (charIdx < ((TEST_MAX_TOKEN_LEN * 4) - 1)); charIdx++)
+    {
+        switch (variant)
+        {
+            case 0:
+                outStr[charIdx] = strPtr[charIdx];
+                break;
+
+            case 1:
+                outStr[charIdx] = tolower((UINT8)strPtr[charIdx]);
+                break;
+
+            case 2:
+                outStr[charIdx] = toupper((UINT8)strPtr[charIdx]);
+                break;
+
+            default:
+                outStr[charIdx] = (rand_r(&randSeed) & 1) ? toupper((UINT8)strPtr[charIdx]) : tolower((UINT8)strPtr[charIdx]);
+                break;
+        }
+    }
+    outStr[charIdx] = '\0';
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Compare index of token given by string index table with linear search
+ * @param   pIndexTbl
+ * @param   strPtr
+ * @return  TRUE if both give same index
+ */
+static BOOL isSameIndex(STR_INDEX_TABLE_t *pIndexTbl, const CHAR *strPtr)
+{
+    return (FindStrIndex(pIndexTbl, (CHARPTR)strPtr) == ConvertStringToIndex((CHARPTR)strPtr, pIndexTbl->pStrTbl, pIndexTbl->maxIndex));
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check all strings of table in all case variants and unknown tokens
+ * @param   pIndexTbl
+ * @param   name
+ */
+static void checkStrTable(STR_INDEX_TABLE_t *pIndexTbl, const CHAR *name)
+{
+    UINT32  index, mismatchCnt = 0;
+    UINT8   variant;
+    CHAR    token[TEST_MAX_TOKEN_LEN * 4];
+
+    for (index = 0; index < pIndexTbl->maxIndex; index++)
+    {
+        for (variant = 0; variant < TEST_CASE_VARIANT_CNT; variant++)
+        {
+            makeCaseVariant(pIndexTbl->pStrTbl[index], variant, token);
+            if (isSameIndex(pIndexTbl, token) == FALSE)
+            {
+                mismatchCnt++;
+                fprintf(stderr, "%s: index mismatch: [token=%s], [find=%d], [linear=%d]\n", name, token, FindStrIndex(pIndexTbl, token),
+                        ConvertStringToIndex(token, pIndexTbl->pStrTbl, pIndexTbl->maxIndex));
+            }
+        }
+    }
+
+    for (index = 0; index < (sizeof(unknownToken) / sizeof(unknownToken[0])); index++)
+    {
+        if (isSameIndex(pIndexTbl, unknownToken[index]) == FALSE)
+        {
+            mismatchCnt++;
+            fprintf(stderr, "%s: index mismatch: [token=%s]\n", name, unknownToken[index]);
+        }
+    }
+
+    UT_CHECK_MSG(mismatchCnt == 0, "[table=%s], [mismatch=%u]", name, mismatchCnt);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check message header and command tables of network manager before and after build of table
+ */
+static void testNetworkTables(void)
+{
+    const TEST_STR_TABLE_t  strTable[] =
+    {
+        {"headerReq",       headerReq,      MAX_HEADER_REQ},
+        {"netCommandStr",   netCommandStr,  MAX_NET_COMMAND},
+    };
+    STR_INDEX_TABLE_t       indexTbl;
+    UINT8                   tblIdx;
+
+    for (tblIdx = 0; tblIdx < (sizeof(strTable) / sizeof(strTable[0])); tblIdx++)
+    {
+        indexTbl = (STR_INDEX_TABLE_t)STR_INDEX_TABLE_INIT(strTable[tblIdx].pStrTbl, strTable[tblIdx].maxIndex);
+
+        /* Linear search is used till table is built */
+        checkStrTable(&indexTbl, strTable[tblIdx].name);
+        UT_CHECK(InitStrIndexTable(&indexTbl) == SUCCESS);
+        UT_CHECK(indexTbl.pBucket != NULL);
+
+        /* Table is at most half filled */
+        UT_CHECK((UINT32)indexTbl.bucketMask + 1 >= ((UINT32)strTable[tblIdx].maxIndex * 2));
+        checkStrTable(&indexTbl, strTable[tblIdx].name);
+
+        /* Building again keeps same table */
+        UT_CHECK(InitStrIndexTable(&indexTbl) == SUCCESS);
+        FREE_MEMORY(indexTbl.pBucket);
+    }
+
+    /* Table of module is built by its init function */
+    UT_CHECK(InitStrIndexTable(&netCommandIndexTbl) == SUCCESS);
+    UT_CHECK(FindStrIndex(&netCommandIndexTbl, netCommandStr[MAX_NET_COMMAND - 1]) == (MAX_NET_COMMAND - 1));
+    UT_CHECK(FindStrIndex(&netCommandIndexTbl, "SET_CMDX") == MAX_NET_COMMAND);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check repeated strings in fixed table. Repeated string in other case also gives first index.
+ */
+static void testRepeatedStrings(void)
+{
+    static const CHARPTR    repeatStr[] = {"ACK", "SET", "ack", "GET", "Set", "", "GET", ""};
+    STR_INDEX_TABLE_t       indexTbl = STR_INDEX_TABLE_INIT(repeatStr, sizeof(repeatStr) / sizeof(repeatStr[0]));
+
+    UT_CHECK(InitStrIndexTable(&indexTbl) == SUCCESS);
+    UT_CHECK(FindStrIndex(&indexTbl, "ack") == 0);
+    UT_CHECK(FindStrIndex(&indexTbl, "sEt") == 1);
+    UT_CHECK(FindStrIndex(&indexTbl, "GET") == 3);
+    UT_CHECK(FindStrIndex(&indexTbl, "") == 5);
+    UT_CHECK(FindStrIndex(&indexTbl, "PUT") == indexTbl.maxIndex);
+    checkStrTable(&indexTbl, "repeatStr");
+    FREE_MEMORY(indexTbl.pBucket);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check random tables of all sizes. Tokens are made of few characters, so tables have many
+ *          repeated strings (in different case too) and strings of same hash bucket.
+ */
+static void testRandomTables(void)
+{
+    static CHAR         tokenData[UINT8_MAX][TEST_MAX_TOKEN_LEN];
+    static CHARPTR      tokenTbl[UINT8_MAX];
+    static const CHAR   tokenChar[] = "aAbB_1";
+    STR_INDEX_TABLE_t   indexTbl;
+    UINT32              tblCnt, queryCnt, mismatchCnt = 0;
+    UINT8               maxIndex, index, tokenLen, charIdx;
+    CHAR                token[TEST_MAX_TOKEN_LEN];
+
+    for (tblCnt = 0; tblCnt < TEST_RANDOM_TABLE_CNT; tblCnt++)
+    {
+        /* Empty bucket is marked with UINT8_MAX, so table can have at most UINT8_MAX strings */
+        maxIndex = (tblCnt == 0) ? UINT8_MAX : (rand_r(&randSeed) % UINT8_MAX) + 1;
+        for (index = 0; index < maxIndex; index++)
+        {
+            tokenLen = rand_r(&randSeed) % 5;
+            for (charIdx = 0; charIdx < tokenLen; charIdx++)
+            {
+                tokenData[index][charIdx] = tokenChar[rand_r(&randSeed) % (sizeof(tokenChar) - 1)];
+            }
+            tokenData[index][tokenLen] = '\0';
+            tokenTbl[index] = tokenData[index];
+        }
+
+        indexTbl = (STR_INDEX_TABLE_t)STR_INDEX_TABLE_INIT(tokenTbl, maxIndex);
+        if (InitStrIndexTable(&indexTbl) == FAIL)
+        {
+            mismatchCnt++;
+            continue;
+        }
+
+        for (index = 0; index < maxIndex; index++)
+        {
+            if (isSameIndex(&indexTbl, tokenTbl[index]) == FALSE)
+            {
+                mismatchCnt++;
+            }
+        }
+
+        /* Random queries are present or unknown in table */
+        for (queryCnt = 0; queryCnt < TEST_RANDOM_QUERY_CNT; queryCnt++)
+        {
+            tokenLen = rand_r(&randSeed) % 6;
+            for (charIdx = 0; charIdx < tokenLen; charIdx++)
+            {
+                token[charIdx] = tokenChar[rand_r(&randSeed) % (sizeof(tokenChar) - 1)];
+            }
+            token[tokenLen] = '\0';
+            if (isSameIndex(&indexTbl, token) == FALSE)
+            {
+                mismatchCnt++;
+                fprintf(stderr, "random table index mismatch: [table=%u], [token=%s]\n", tblCnt, token);
+            }
+        }
+        FREE_MEMORY(indexTbl.pBucket);
+    }
+
+    UT_CHECK_MSG(mismatchCnt == 0, "[mismatch=%u]", mismatchCnt);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Main function of test
+ * @return  EXIT_SUCCESS if all checks pass
+ */
+int main(void)
+{
+    testNetworkTables();
+    testRepeatedStrings();
+    testRandomTables();
+    return UT_RESULT("StrIndexTableTest");
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################
@@ -0,0 +1,377 @@
+//#################################################################################################
+// FILE BRIEF
+//#################################################################################################
+/**
+@file       VideoParserBench.c
+@brief      Benchmark of start code scan and bit reader of video parser. Start code scan is compared
+            with byte by byte scan which was used before. Results of parser are checked on generated
+            H264 stream, so benchmark doesn't measure a parser which gives wrong result.
+*/
+//#################################################################################################
+// @INCLUDES
+//#################################################################################################
+/* Unit under test */
+#include "VideoParser.c"
+
+/* Application Includes */
+#include "UnitTest.h"
+
+//#################################################################################################
+// @DEFINES
+//#################################################################################################
+/* Filler NAL before SPS, as seen in large SEI or slice data before config of some cameras */
+#define BENCH_FILLER_NAL_LEN    (400 * KILO_BYTE)
+#define BENCH_FRAME_BUF_LEN     (BENCH_FILLER_NAL_LEN + 1024)
+#define BENCH_SCAN_ITER         (2000)
+#define BENCH_SMALL_ITER        (1000000)
+#define BENCH_UE_CNT            (100000)
+
+#define H264_NAL_SEI            (6)
+
+//#################################################################################################
+// @DATA TYPES
+//#################################################################################################
+typedef struct
+{
+    UINT8PTR    buf;
+    UINT32      size;
+    UINT32      bitPos;
+}BIT_WRITER_t;
+
+//#################################################################################################
+// @STATIC VARIABLES
+//#################################################################################################
+static const UINT8 benchStartCode[H264_H265_START_CODE_LEN] = {0x00, 0x00, 0x00, 0x01};
+
+//#################################################################################################
+// @FUNCTIONS
+//#################################################################################################
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Write bits in MSB first order
+ * @param   bw
+ * @param   value
+ * @param   bitCnt
+ */
+static void bwPutU(BIT_WRITER_t *bw, UINT32 value, UINT32 bitCnt)
+{
+    while (bitCnt-- > 0)
+    {
+        if (((value >> bitCnt) & 1) != 0)
+        {
+            bw->buf[bw->bitPos >> 3] |= (UINT8)(0x80 >> (bw->bitPos & 7));
+        }
+        bw->bitPos++;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Write unsigned Exp-Golomb code
+ * @param   bw
+ * @param   value
+ */
+static void bwPutUe(BIT_WRITER_t *bw, UINT32 value)
+{
+    UINT64 codeNum = (UINT64)value + 1;
+    UINT32 bitCnt = 64 - __builtin_clzll(codeNum);
+
+    bwPutU(bw, 0, bitCnt - 1);
+    bwPutU(bw, (UINT32)(codeNum >> 32), (bitCnt > 32) ? (bitCnt - 32) : 0);
+    bwPutU(bw, (UINT32)codeNum, (bitCnt > 32) ? 32 : bitCnt);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Copy RBSP in NAL payload with emulation prevention bytes
+ * @param   dst
+ * @param   rbsp
+ * @param   rbspLen
+ * @return  Length of NAL payload
+ */
+static UINT32 insertEpb(UINT8PTR dst, const UINT8 *rbsp, UINT32 rbspLen)
+{
+    UINT32 idx, len = 0, zeroCnt = 0;
+
+    for (idx = 0; idx < rbspLen; idx++)
+    {
+        if ((zeroCnt == 2) && (rbsp[idx] <= 0x03))
+        {
+            dst[len++] = EMULATION_PREVENTION_BYTE;
+            zeroCnt = 0;
+        }
+        dst[len++] = rbsp[idx];
+        zeroCnt = (rbsp[idx] == 0x00) ? (zeroCnt + 1) : 0;
+    }
+
+    return len;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Write H264 SPS NAL of given resolution with start code
+ * @param   dst
+ * @param   width - Multiple of 16
+ * @param   height - Multiple of 2
+ * @param   refFrameCnt
+ * @return  Length of NAL with start code
+ */
+static UINT32 writeH264Sps(UINT8PTR dst, UINT32 width, UINT32 height, UINT32 refFrameCnt)
+{
+    UINT8           rbsp[64] = {0};
+    BIT_WRITER_t    bw = {rbsp, sizeof(rbsp), 0};
+    UINT32          heightInMbs = (height + 15) / 16;
+
+    bwPutU(&bw, 66, 8);                 /* profile_idc: baseline */
+    bwPutU(&bw, 0, 8);                  /* constraint flags and reserved bits */
+    bwPutU(&bw, 40, 8);                 /* level_idc */
+    bwPutUe(&bw, 0);                    /* seq_parameter_set_id */
+    bwPutUe(&bw, 0);                    /* log2_max_frame_num_minus4 */
+    bwPutUe(&bw, 2);                    /* pic_order_cnt_type */
+    bwPutUe(&bw, refFrameCnt);          /* num_ref_frames */
+    bwPutU(&bw, 0, 1);                  /* gaps_in_frame_num_value_allowed_flag */
+    bwPutUe(&bw, (width / 16) - 1);     /* pic_width_in_mbs_minus1 */
+    bwPutUe(&bw, heightInMbs - 1);      /* pic_height_in_map_units_minus1 */
+    bwPutU(&bw, 1, 1);                  /* frame_mbs_only_flag */
+    bwPutU(&bw, 1, 1);                  /* direct_8x8_inference_flag */
+    bwPutU(&bw, ((heightInMbs * 16) != height) ? 1 : 0, 1);
+    if ((heightInMbs * 16) != height)
+    {
+        bwPutUe(&bw, 0);
+        bwPutUe(&bw, 0);
+        bwPutUe(&bw, 0);
+        bwPutUe(&bw, ((heightInMbs * 16) - height) / 2);
+    }
+    bwPutU(&bw, 0, 1);                  /* vui_parameters_present_flag */
+    bwPutU(&bw, 1, 1);                  /* rbsp_stop_one_bit */
+
+    memcpy(dst, benchStartCode, H264_H265_START_CODE_LEN);
+    dst[H264_H265_START_CODE_LEN] = 0x67;
+    return H264_H265_START_CODE_LEN + 1 + insertEpb(dst + H264_H265_START_CODE_LEN + 1, rbsp, (bw.bitPos + 7) / 8);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Write H264 IDR slice NAL header with start code
+ * @param   dst
+ * @param   sliceType
+ * @return  Length of NAL with start code
+ */
+static UINT32 writeH264Slice(UINT8PTR dst, UINT32 sliceType)
+{
+    UINT8           rbsp[16] = {0};
+    BIT_WRITER_t    bw = {rbsp, sizeof(rbsp), 0};
+
+    bwPutUe(&bw, 0);                    /* first_mb_in_slice */
+    bwPutUe(&bw, sliceType);            /* slice_type */
+    bwPutUe(&bw, 0);                    /* pic_parameter_set_id */
+    bwPutU(&bw, 1, 1);
+
+    memcpy(dst, benchStartCode, H264_H265_START_CODE_LEN);
+    dst[H264_H265_START_CODE_LEN] = 0x65;
+    return H264_H265_START_CODE_LEN + 1 + insertEpb(dst + H264_H265_START_CODE_LEN + 1, rbsp, (bw.bitPos + 7) / 8);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Write filler NAL which has zero bytes and 0x01 bytes but no start code, like coded data
+ * @param   dst
+ * @param   len
+ * @return  Length of NAL with start code
+ */
+static UINT32 writeFillerNal(UINT8PTR dst, UINT32 len)
+{
+    UINT32 idx;
+
+    memcpy(dst, benchStartCode, H264_H265_START_CODE_LEN);
+    dst[H264_H265_START_CODE_LEN] = H264_NAL_SEI;
+    for (idx = 0; idx < len; idx++)
+    {
+        dst[H264_H265_START_CODE_LEN + 1 + idx] = (UINT8)(rand() & 0xFF);
+        if ((idx >= 2) && (dst[H264_H265_START_CODE_LEN + idx] == 0x00) && (dst[H264_H265_START_CODE_LEN - 1 + idx] == 0x00))
+        {
+            /* Coded data never has start code */
+            dst[H264_H265_START_CODE_LEN + 1 + idx] |= 0x80;
+        }
+    }
+
+    return H264_H265_START_CODE_LEN + 1 + len;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Start code scan which compares pattern at every position, as parser did before
+ * @param   buf
+ * @param   pos
+ * @param   size
+ * @return  Position of start code or size if not found
+ */
+static UINT32 bytewiseFindStartCode(const UINT8 *buf, UINT32 pos, UINT32 size)
+{
+    while ((pos + H264_H265_START_CODE_LEN) < size)
+    {
+        if ((buf[pos] == benchStartCode[0]) && (buf[pos + 1] == benchStartCode[1])
+                && (buf[pos + 2] == benchStartCode[2]) && (buf[pos + 3] == benchStartCode[3]))
+        {
+            return pos;
+        }
+        pos++;
+    }
+
+    return size;
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Check parser results on generated stream
+ * @param   frameBuf
+ * @param   spsFrameLen - Length of frame with filler and SPS
+ * @param   spsPos - Position of SPS in frame
+ */
+static void checkParserResult(UINT8PTR frameBuf, UINT32 spsFrameLen, UINT32 spsPos)
+{
+    UINT8           smallBuf[64];
+    UINT32          smallLen;
+    VIDEO_INFO_t    videoInfo;
+    UINT8           configPresent;
+
+    UT_CHECK(findStartCode(frameBuf, 1, spsFrameLen, H264_H265_START_CODE_LEN) == spsPos);
+    UT_CHECK(bytewiseFindStartCode(frameBuf, 1, spsFrameLen) == spsPos);
+
+    memset(&videoInfo, 0, sizeof(videoInfo));
+    UT_CHECK(GetH264Info(frameBuf, spsFrameLen, &videoInfo, &configPresent) == SUCCESS);
+    UT_CHECK(videoInfo.frameType == SPS_FRAME);
+    UT_CHECK(configPresent == TRUE);
+    UT_CHECK_MSG((videoInfo.width == 1920) && (videoInfo.height == 1080), "[width=%d], [height=%d]", videoInfo.width, videoInfo.height);
+    UT_CHECK(videoInfo.noOfRefFrame == 1);
+
+    memset(smallBuf, 0, sizeof(smallBuf));
+    smallLen = writeH264Sps(smallBuf, 3840, 2160, 4);
+    UT_CHECK(GetH264Info(smallBuf, smallLen, &videoInfo, &configPresent) == SUCCESS);
+    UT_CHECK_MSG((videoInfo.width == 3840) && (videoInfo.height == 2160), "[width=%d], [height=%d]", videoInfo.width, videoInfo.height);
+    UT_CHECK(videoInfo.noOfRefFrame == 4);
+
+    memset(smallBuf, 0, sizeof(smallBuf));
+    smallLen = writeH264Slice(smallBuf, 7);
+    UT_CHECK(GetH264Info(smallBuf, smallLen, &videoInfo, &configPresent) == SUCCESS);
+    UT_CHECK(videoInfo.frameType == I_FRAME);
+
+    memset(smallBuf, 0, sizeof(smallBuf));
+    smallLen = writeH264Slice(smallBuf, 5);
+    UT_CHECK(GetH264Info(smallBuf, smallLen, &videoInfo, &configPresent) == SUCCESS);
+    UT_CHECK(videoInfo.frameType == P_FRAME);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Benchmark of Exp-Golomb reads through bit reader, with and without EPB identification
+ */
+static void benchBitReader(void)
+{
+    UINT8PTR        rbsp = calloc(1, BENCH_UE_CNT * 8);
+    UINT8PTR        nal = calloc(1, BENCH_UE_CNT * 12);
+    BIT_WRITER_t    bw = {rbsp, BENCH_UE_CNT * 8, 0};
+    BIT_STREAM_t    bs;
+    UINT32          idx, nalLen, sum;
+    UINT64          startNs;
+    BOOL            epbF;
+
+    if ((rbsp == NULL) || (nal == NULL))
+    {
+        UT_CHECK(FALSE);
+        free(rbsp);
+        free(nal);
+        return;
+    }
+
+    for (idx = 0; idx < BENCH_UE_CNT; idx++)
+    {
+        bwPutUe(&bw, idx & 0x3FF);
+    }
+    nalLen = insertEpb(nal, rbsp, (bw.bitPos + 7) / 8);
+
+    for (epbF = FALSE; epbF <= TRUE; epbF++)
+    {
+        sum = 0;
+        startNs = UtGetTimeNs();
+        bsInit(&bs, (epbF == TRUE) ? nal : rbsp, (epbF == TRUE) ? nalLen : ((bw.bitPos + 7) / 8), epbF);
+        for (idx = 0; idx < BENCH_UE_CNT; idx++)
+        {
+            sum += bsReadUe(&bs);
+        }
+        UtPrintBench((epbF == TRUE) ? "bsReadUe with epb identification" : "bsReadUe", BENCH_UE_CNT, UtGetTimeNs() - startNs);
+        UT_CHECK_MSG(sum == ((BENCH_UE_CNT / 1024) * ((1023 * 1024) / 2)) + (((BENCH_UE_CNT % 1024) * ((BENCH_UE_CNT % 1024) - 1)) / 2),
+                     "[epb=%d], [sum=%u]", epbF, sum);
+    }
+
+    free(rbsp);
+    free(nal);
+}
+
+//-------------------------------------------------------------------------------------------------
+/**
+ * @brief   Main function of benchmark
+ * @return  EXIT_SUCCESS if parser results are correct
+ */
+int main(void)
+{
+    UINT8PTR        frameBuf = calloc(1, BENCH_FRAME_BUF_LEN);
+    UINT8           smallBuf[64] = {0};
+    UINT32          spsPos, frameLen, smallLen, iter, pos = 0;
+    UINT64          startNs;
+    VIDEO_INFO_t    videoInfo;
+    UINT8           configPresent;
+
+    if (frameBuf == NULL)
+    {
+        return EXIT_FAILURE;
+    }
+
+    srand(6);
+    spsPos = writeFillerNal(frameBuf, BENCH_FILLER_NAL_LEN);
+    frameLen = spsPos + writeH264Sps(frameBuf + spsPos, 1920, 1080, 1);
+    checkParserResult(frameBuf, frameLen, spsPos);
+
+    startNs = UtGetTimeNs();
+    for (iter = 0; iter < BENCH_SCAN_ITER; iter++)
+    {
+        UT_BARRIER();
+        pos += bytewiseFindStartCode(frameBuf, 1, frameLen);
+    }
+    UtPrintBench("start code scan 400KB, bytewise", BENCH_SCAN_ITER, UtGetTimeNs() - startNs);
+
+    startNs = UtGetTimeNs();
+    for (iter = 0; iter < BENCH_SCAN_ITER; iter++)
+    {
+        UT_BARRIER();
+        pos += findStartCode(frameBuf, 1, frameLen, H264_H265_START_CODE_LEN);
+    }
+    UtPrintBench("start code scan 400KB, findStartCode", BENCH_SCAN_ITER, UtGetTimeNs() - startNs);
+    UT_CHECK(pos == (spsPos * BENCH_SCAN_ITER * 2));
+
+    startNs = UtGetTimeNs();
+    for (iter = 0; iter < BENCH_SCAN_ITER; iter++)
+    {
+        UT_BARRIER();
+        GetH264Info(frameBuf, frameLen, &videoInfo, &configPresent);
+    }
+    UtPrintBench("GetH264Info sps after 400KB nal", BENCH_SCAN_ITER, UtGetTimeNs() - startNs);
+
+    smallLen = writeH264Sps(smallBuf, 1920, 1080, 1);
+    startNs = UtGetTimeNs();
+    for (iter = 0; iter < BENCH_SMALL_ITER; iter++)
+    {
+        UT_BARRIER();
+        GetH264Info(smallBuf, smallLen, &videoInfo, &configPresent);
+    }
+    UtPrintBench("GetH264Info sps only", BENCH_SMALL_ITER, UtGetTimeNs() - startNs);
+
+    benchBitReader();
+
+    free(frameBuf);
+    return UT_RESULT("VideoParserBench");
+}
+
+//#################################################################################################
+// @END OF FILE
+//#################################################################################################